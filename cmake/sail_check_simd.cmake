@@ -0,0 +1,78 @@
+# Intended to be included by SAIL.
+#
+# Checks whether the compiler builds SSE2, AVX2, AVX-512, and NEON intrinsics, and with what flags.
+# Only the files with the SIMD kernels are built with the flags. The kernels are selected
+# at runtime, so the binaries still run on CPUs without these instruction sets.
+#
+# Sets SAIL_HAVE_<ISA> and SAIL_<ISA>_FLAGS for every instruction set.
+#
+function(sail_check_simd_isa ISA SOURCE)
+    foreach (FLAGS "" ${ARGN})
+        cmake_push_check_state(RESET)
+            set(CMAKE_REQUIRED_FLAGS "${FLAGS}")
+            unset(SAIL_CHECK_SIMD_RESULT CACHE)
+            check_c_source_compiles("${SOURCE}" SAIL_CHECK_SIMD_RESULT)
+        cmake_pop_check_state()
+
+        if (SAIL_CHECK_SIMD_RESULT)
+            unset(SAIL_CHECK_SIMD_RESULT CACHE)
+            set(SAIL_HAVE_${ISA} ON CACHE INTERNAL "")
+            set(SAIL_${ISA}_FLAGS "${FLAGS}" CACHE INTERNAL "")
+            return()
+        endif()
+    endforeach()
+
+    unset(SAIL_CHECK_SIMD_RESULT CACHE)
+    set(SAIL_HAVE_${ISA} OFF CACHE INTERNAL "")
+    set(SAIL_${ISA}_FLAGS "" CACHE INTERNAL "")
+endfunction()
+
+function(sail_check_simd)
+    sail_check_simd_isa(SSE2
+    "
+        #include <emmintrin.h>
+        int main(int argc, char *argv[]) {
+            __m128i v = _mm_set1_epi32(argc);
+            v = _mm_madd_epi16(v, v);
+            return _mm_cvtsi128_si32(v);
+        }
+    "
+    "-msse2")
+
+    sail_check_simd_isa(AVX2
+    "
+        #include <immintrin.h>
+        int main(int argc, char *argv[]) {
+            __m256i v = _mm256_set1_epi32(argc);
+            v = _mm256_shuffle_epi8(v, v);
+            return _mm256_extract_epi32(v, 0);
+        }
+    "
+    "-mavx2")
+
+    sail_check_simd_isa(AVX512
+    "
+        #include <immintrin.h>
+        int main(int argc, char *argv[]) {
+            __m512i v = _mm512_set1_epi32(argc);
+            v = _mm512_shuffle_epi8(v, v);
+            return _mm_cvtsi128_si32(_mm512_castsi512_si128(v));
+        }
+    "
+    "-mavx512f -mavx512bw")
+
+    sail_check_simd_isa(NEON
+    "
+        #include <arm_neon.h>
+        #if !defined(__aarch64__) && !defined(_M_ARM64)
+        #error NEON is optional on 32-bit ARM
+        #endif
+        int main(int argc, char *argv[]) {
+            uint8x16x4_t v;
+            v.val[0] = v.val[1] = v.val[2] = v.val[3] = vdupq_n_u8((uint8_t)argc);
+            uint8_t data[64];
+            vst4q_u8(data, v);
+            return data[0];
+        }
+    ")
+endfunction()
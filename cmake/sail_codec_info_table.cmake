@@ -0,0 +1,217 @@
+# Intended to be included by SAIL.
+#
+# Converts a codec info file into a sail_codec_info_table initializer (see src/sail/codec_info_table.h)
+# at configure time, so the combined sail-codecs library doesn't parse codec info files at run time.
+# Follows the codec info parser in src/sail/codec_info_private.c: empty values are ignored, and magic
+# numbers, extensions, and MIME types are converted to lower case. Unknown features, pixel formats,
+# and compressions fail the build.
+#
+# Sets ARRAYS to the definitions of the arrays referenced by the table, and ENTRY to the initializer.
+#
+# Usage: sail_codec_info_table(CODEC png PATH png.codec.info ARRAYS arrays_var ENTRY entry_var)
+#
+function(sail_codec_info_table)
+    cmake_parse_arguments(SAIL_TABLE "" "CODEC;PATH;ARRAYS;ENTRY" "" ${ARGN})
+
+    set(PREFIX "sail_codec_${SAIL_TABLE_CODEC}")
+    set(ARRAYS "")
+
+    # Defaults match a freshly allocated codec info
+    #
+    set(LAYOUT 0)
+    set(VERSION NULL)
+    set(PRIORITY SAIL_CODEC_PRIORITY_HIGHEST)
+    set(NAME NULL)
+    set(DESCRIPTION NULL)
+    set(MAGIC_NUMBERS NULL)
+    set(EXTENSIONS NULL)
+    set(MIME_TYPES NULL)
+    set(LOAD_FEATURES 0)
+    set(LOAD_TUNING NULL)
+    set(SAVE_FEATURES 0)
+    set(PIXEL_FORMATS NULL)
+    set(PIXEL_FORMATS_LENGTH 0)
+    set(COMPRESSIONS NULL)
+    set(COMPRESSIONS_LENGTH 0)
+    set(DEFAULT_COMPRESSION SAIL_COMPRESSION_UNKNOWN)
+    set(HAS_COMPRESSION_LEVEL false)
+    set(COMPRESSION_LEVEL_MIN 0)
+    set(COMPRESSION_LEVEL_MAX 0)
+    set(COMPRESSION_LEVEL_DEFAULT 0)
+    set(COMPRESSION_LEVEL_STEP 0)
+    set(SAVE_TUNING NULL)
+
+    # Protect list separators and brackets before splitting the file into lines
+    #
+    file(READ ${SAIL_TABLE_PATH} CONTENTS)
+    string(REPLACE ";" "<SAIL_SEMICOLON>" CONTENTS "${CONTENTS}")
+    string(REPLACE "[" "<SAIL_LEFT_BRACKET>" CONTENTS "${CONTENTS}")
+    string(REPLACE "]" "<SAIL_RIGHT_BRACKET>" CONTENTS "${CONTENTS}")
+    string(REPLACE "\r" "" CONTENTS "${CONTENTS}")
+    string(REPLACE "\n" ";" LINES "${CONTENTS}")
+
+    set(SECTION "")
+
+    foreach(LINE IN LISTS LINES)
+        string(STRIP "${LINE}" LINE)
+
+        if (LINE STREQUAL "" OR LINE MATCHES "^[#]" OR LINE MATCHES "^<SAIL_SEMICOLON>")
+            continue()
+        endif()
+
+        if (LINE MATCHES "^<SAIL_LEFT_BRACKET>(.*)<SAIL_RIGHT_BRACKET>$")
+            set(SECTION "${CMAKE_MATCH_1}")
+            continue()
+        endif()
+
+        if (NOT LINE MATCHES "^([^=]+)=(.*)$")
+            message(FATAL_ERROR "${SAIL_TABLE_PATH}: invalid line '${LINE}'")
+        endif()
+
+        string(STRIP "${CMAKE_MATCH_1}" KEY)
+        string(STRIP "${CMAKE_MATCH_2}" VALUE)
+
+        if (VALUE STREQUAL "")
+            continue()
+        endif()
+
+        # C string literal and CMake list of the value
+        #
+        string(REPLACE "<SAIL_LEFT_BRACKET>" "[" VALUE "${VALUE}")
+        string(REPLACE "<SAIL_RIGHT_BRACKET>" "]" VALUE "${VALUE}")
+        string(REPLACE "\\" "\\\\" C_VALUE "${VALUE}")
+        string(REPLACE "\"" "\\\"" C_VALUE "${C_VALUE}")
+        string(REPLACE "<SAIL_SEMICOLON>" ";" C_VALUE "${C_VALUE}")
+        string(REPLACE "<SAIL_SEMICOLON>" ";" VALUE_LIST "${C_VALUE}")
+
+        set(KEY "${SECTION}/${KEY}")
+        string(MAKE_C_IDENTIFIER "${KEY}" KEY_ID)
+
+        if (KEY STREQUAL "codec/layout")
+            set(LAYOUT "${VALUE}")
+        elseif (KEY STREQUAL "codec/version")
+            set(VERSION "\"${C_VALUE}\"")
+        elseif (KEY STREQUAL "codec/priority")
+            set(PRIORITY "SAIL_CODEC_PRIORITY_${VALUE}")
+        elseif (KEY STREQUAL "codec/name")
+            set(NAME "\"${C_VALUE}\"")
+        elseif (KEY STREQUAL "codec/description")
+            set(DESCRIPTION "\"${C_VALUE}\"")
+        elseif (KEY STREQUAL "codec/magic-numbers" OR KEY STREQUAL "codec/extensions" OR KEY STREQUAL "codec/mime-types"
+                OR KEY STREQUAL "load-features/tuning" OR KEY STREQUAL "save-features/tuning")
+            if (SECTION STREQUAL "codec")
+                string(TOLOWER "${VALUE_LIST}" VALUE_LIST)
+            endif()
+
+            set(STRINGS "")
+            foreach(STRING IN LISTS VALUE_LIST)
+                string(STRIP "${STRING}" STRING)
+                if (NOT STRING STREQUAL "")
+                    string(APPEND STRINGS "\"${STRING}\", ")
+                endif()
+            endforeach()
+
+            string(APPEND ARRAYS "static const char* const ${PREFIX}_${KEY_ID}[] = { ${STRINGS}NULL };\n")
+
+            if (KEY STREQUAL "codec/magic-numbers")
+                set(MAGIC_NUMBERS "${PREFIX}_${KEY_ID}")
+            elseif (KEY STREQUAL "codec/extensions")
+                set(EXTENSIONS "${PREFIX}_${KEY_ID}")
+            elseif (KEY STREQUAL "codec/mime-types")
+                set(MIME_TYPES "${PREFIX}_${KEY_ID}")
+            elseif (KEY STREQUAL "load-features/tuning")
+                set(LOAD_TUNING "${PREFIX}_${KEY_ID}")
+            else()
+                set(SAVE_TUNING "${PREFIX}_${KEY_ID}")
+            endif()
+        elseif (KEY STREQUAL "load-features/features" OR KEY STREQUAL "save-features/features")
+            set(FEATURES "")
+            foreach(FEATURE IN LISTS VALUE_LIST)
+                string(STRIP "${FEATURE}" FEATURE)
+                if (NOT FEATURE STREQUAL "")
+                    string(MAKE_C_IDENTIFIER "${FEATURE}" FEATURE)
+                    list(APPEND FEATURES "SAIL_CODEC_FEATURE_${FEATURE}")
+                endif()
+            endforeach()
+
+            if (FEATURES)
+                list(JOIN FEATURES " | " FEATURES)
+            else()
+                set(FEATURES 0)
+            endif()
+
+            if (SECTION STREQUAL "load-features")
+                set(LOAD_FEATURES "${FEATURES}")
+            else()
+                set(SAVE_FEATURES "${FEATURES}")
+            endif()
+        elseif (KEY STREQUAL "save-features/pixel-formats" OR KEY STREQUAL "save-features/compressions")
+            if (KEY STREQUAL "save-features/pixel-formats")
+                set(ENUM_PREFIX SAIL_PIXEL_FORMAT)
+                set(ENUM_TYPE SailPixelFormat)
+            else()
+                set(ENUM_PREFIX SAIL_COMPRESSION)
+                set(ENUM_TYPE SailCompression)
+            endif()
+
+            set(VALUES "")
+            set(VALUES_LENGTH 0)
+            foreach(ENUM_VALUE IN LISTS VALUE_LIST)
+                string(STRIP "${ENUM_VALUE}" ENUM_VALUE)
+                if (NOT ENUM_VALUE STREQUAL "")
+                    string(MAKE_C_IDENTIFIER "${ENUM_VALUE}" ENUM_VALUE)
+                    string(APPEND VALUES "${ENUM_PREFIX}_${ENUM_VALUE}, ")
+                    math(EXPR VALUES_LENGTH "${VALUES_LENGTH} + 1")
+                endif()
+            endforeach()
+
+            if (VALUES_LENGTH GREATER 0)
+                string(APPEND ARRAYS "static const enum ${ENUM_TYPE} ${PREFIX}_${KEY_ID}[] = { ${VALUES}};\n")
+
+                if (KEY STREQUAL "save-features/pixel-formats")
+                    set(PIXEL_FORMATS "${PREFIX}_${KEY_ID}")
+                    set(PIXEL_FORMATS_LENGTH ${VALUES_LENGTH})
+                else()
+                    set(COMPRESSIONS "${PREFIX}_${KEY_ID}")
+                    set(COMPRESSIONS_LENGTH ${VALUES_LENGTH})
+                endif()
+            endif()
+        elseif (KEY STREQUAL "save-features/default-compression")
+            string(MAKE_C_IDENTIFIER "${VALUE}" VALUE)
+            set(DEFAULT_COMPRESSION "SAIL_COMPRESSION_${VALUE}")
+        elseif (KEY MATCHES "^save-features/compression-level-(min|max|default|step)$")
+            string(TOUPPER "${CMAKE_MATCH_1}" LEVEL)
+            set(HAS_COMPRESSION_LEVEL true)
+            set(COMPRESSION_LEVEL_${LEVEL} "${VALUE}")
+        else()
+            message(FATAL_ERROR "${SAIL_TABLE_PATH}: unsupported codec info key '${KEY}'")
+        endif()
+    endforeach()
+
+    set(${SAIL_TABLE_ARRAYS} "${ARRAYS}" PARENT_SCOPE)
+    set(${SAIL_TABLE_ENTRY} "
+    {
+        .layout                    = ${LAYOUT},
+        .version                   = ${VERSION},
+        .priority                  = ${PRIORITY},
+        .name                      = ${NAME},
+        .description               = ${DESCRIPTION},
+        .magic_numbers             = ${MAGIC_NUMBERS},
+        .extensions                = ${EXTENSIONS},
+        .mime_types                = ${MIME_TYPES},
+        .load_features             = ${LOAD_FEATURES},
+        .load_tuning               = ${LOAD_TUNING},
+        .save_features             = ${SAVE_FEATURES},
+        .pixel_formats             = ${PIXEL_FORMATS},
+        .pixel_formats_length      = ${PIXEL_FORMATS_LENGTH},
+        .compressions              = ${COMPRESSIONS},
+        .compressions_length       = ${COMPRESSIONS_LENGTH},
+        .default_compression       = ${DEFAULT_COMPRESSION},
+        .has_compression_level     = ${HAS_COMPRESSION_LEVEL},
+        .compression_level_min     = ${COMPRESSION_LEVEL_MIN},
+        .compression_level_max     = ${COMPRESSION_LEVEL_MAX},
+        .compression_level_default = ${COMPRESSION_LEVEL_DEFAULT},
+        .compression_level_step    = ${COMPRESSION_LEVEL_STEP},
+        .save_tuning               = ${SAVE_TUNING},
+    },\n" PARENT_SCOPE)
+endfunction()
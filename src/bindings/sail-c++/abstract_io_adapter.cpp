@@ -144,6 +144,7 @@ public:
         sail_io.close          = wrapped_close;
         sail_io.eof            = wrapped_eof;
         sail_io.size           = wrapped_size;
+        sail_io.borrow         = nullptr;
     }
 
     sail::abstract_io& abstract_io;
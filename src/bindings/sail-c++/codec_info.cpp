@@ -33,23 +33,111 @@ namespace sail
 class SAIL_HIDDEN codec_info::pimpl
 {
 public:
+    /*
+     * Immutable copy of a C codec info object. Copies of codec_info share it,
+     * so returning a codec info object doesn't duplicate the string lists.
+     */
+    struct shared_data
+    {
+        std::string version;
+        std::string name;
+        std::string description;
+        std::vector<std::string> magic_numbers;
+        std::vector<std::string> extensions;
+        std::vector<std::string> mime_types;
+        sail::load_features load_features;
+        sail::save_features save_features;
+    };
+
     pimpl()
         : sail_codec_info_c(nullptr)
+        , data(empty_data())
     {
     }
 
+    static const std::shared_ptr<const shared_data>& empty_data();
+
+    static std::shared_ptr<const shared_data> build_data(const sail_codec_info* ci);
+
+    static std::shared_ptr<const shared_data> cached_data(const sail_codec_info* ci);
+
+    static void destroy_cached_data(void* binding_data);
+
     const sail_codec_info* sail_codec_info_c;
 
-    std::string version;
-    std::string name;
-    std::string description;
-    std::vector<std::string> magic_numbers;
-    std::vector<std::string> extensions;
-    std::vector<std::string> mime_types;
-    sail::load_features load_features;
-    sail::save_features save_features;
+    std::shared_ptr<const shared_data> data;
 };
 
+const std::shared_ptr<const codec_info::pimpl::shared_data>& codec_info::pimpl::empty_data()
+{
+    static const std::shared_ptr<const shared_data> empty = std::make_shared<const shared_data>();
+
+    return empty;
+}
+
+std::shared_ptr<const codec_info::pimpl::shared_data> codec_info::pimpl::build_data(const sail_codec_info* ci)
+{
+    auto data = std::make_shared<shared_data>();
+
+    // magic numbers
+    for (const sail_string_node* magic_number_node = ci->magic_number_node; magic_number_node != nullptr;
+         magic_number_node                         = magic_number_node->next)
+    {
+        data->magic_numbers.push_back(magic_number_node->string);
+    }
+
+    // extensions
+    for (const sail_string_node* extension_node = ci->extension_node; extension_node != nullptr;
+         extension_node                         = extension_node->next)
+    {
+        data->extensions.push_back(extension_node->string);
+    }
+
+    // mime types
+    for (const sail_string_node* mime_type_node = ci->mime_type_node; mime_type_node != nullptr;
+         mime_type_node                         = mime_type_node->next)
+    {
+        data->mime_types.push_back(mime_type_node->string);
+    }
+
+    data->version       = ci->version;
+    data->name          = ci->name;
+    data->description   = ci->description;
+    data->load_features = sail::load_features(ci->load_features);
+    data->save_features = sail::save_features(ci->save_features);
+
+    return data;
+}
+
+/*
+ * Shared copies are built once per codec info object and attached to it as binding data.
+ * SAIL destroys them together with the codec info objects, even when sail_finish() is called directly.
+ */
+std::shared_ptr<const codec_info::pimpl::shared_data> codec_info::pimpl::cached_data(const sail_codec_info* ci)
+{
+    void* binding_data = sail_codec_info_binding_data(ci);
+
+    if (binding_data == nullptr)
+    {
+        auto* data = new std::shared_ptr<const shared_data>(build_data(ci));
+
+        /* If another thread attached its copy first, ours is destroyed, and binding_data points to theirs. */
+        if (sail_attach_codec_info_binding_data(ci, data, destroy_cached_data, &binding_data) != SAIL_OK)
+        {
+            std::shared_ptr<const shared_data> local = std::move(*data);
+            destroy_cached_data(data);
+            return local;
+        }
+    }
+
+    return *static_cast<const std::shared_ptr<const shared_data>*>(binding_data);
+}
+
+void codec_info::pimpl::destroy_cached_data(void* binding_data)
+{
+    delete static_cast<std::shared_ptr<const shared_data>*>(binding_data);
+}
+
 codec_info::codec_info()
     : d(new pimpl)
 {
@@ -64,15 +152,7 @@ codec_info::codec_info(const codec_info& ci)
 codec_info& codec_info::operator=(const codec_info& ci)
 {
     d->sail_codec_info_c = ci.d->sail_codec_info_c;
-
-    d->version       = ci.version();
-    d->name          = ci.name();
-    d->description   = ci.description();
-    d->magic_numbers = ci.magic_numbers();
-    d->extensions    = ci.extensions();
-    d->mime_types    = ci.mime_types();
-    d->load_features = ci.load_features();
-    d->save_features = ci.save_features();
+    d->data              = ci.d->data;
 
     return *this;
 }
@@ -95,47 +175,47 @@ codec_info::~codec_info()
 
 bool codec_info::is_valid() const
 {
-    return d->sail_codec_info_c != nullptr && !d->name.empty() && !d->version.empty();
+    return d->sail_codec_info_c != nullptr && !d->data->name.empty() && !d->data->version.empty();
 }
 
 const std::string& codec_info::version() const
 {
-    return d->version;
+    return d->data->version;
 }
 
 const std::string& codec_info::name() const
 {
-    return d->name;
+    return d->data->name;
 }
 
 const std::string& codec_info::description() const
 {
-    return d->description;
+    return d->data->description;
 }
 
 const std::vector<std::string>& codec_info::magic_numbers() const
 {
-    return d->magic_numbers;
+    return d->data->magic_numbers;
 }
 
 const std::vector<std::string>& codec_info::extensions() const
 {
-    return d->extensions;
+    return d->data->extensions;
 }
 
 const std::vector<std::string>& codec_info::mime_types() const
 {
-    return d->mime_types;
+    return d->data->mime_types;
 }
 
 const load_features& codec_info::load_features() const
 {
-    return d->load_features;
+    return d->data->load_features;
 }
 
 const save_features& codec_info::save_features() const
 {
-    return d->save_features;
+    return d->data->save_features;
 }
 
 const char* codec_info::codec_feature_to_string(SailCodecFeature codec_feature)
@@ -236,40 +316,7 @@ codec_info::codec_info(const sail_codec_info* ci)
     }
 
     d->sail_codec_info_c = ci;
-
-    std::vector<std::string> magic_numbers;
-    std::vector<std::string> extensions;
-    std::vector<std::string> mime_types;
-
-    // magic numbers
-    for (const sail_string_node* magic_number_node = ci->magic_number_node; magic_number_node != nullptr;
-         magic_number_node                         = magic_number_node->next)
-    {
-        magic_numbers.push_back(magic_number_node->string);
-    }
-
-    // extensions
-    for (const sail_string_node* extension_node = ci->extension_node; extension_node != nullptr;
-         extension_node                         = extension_node->next)
-    {
-        extensions.push_back(extension_node->string);
-    }
-
-    // mime types
-    for (const sail_string_node* mime_type_node = ci->mime_type_node; mime_type_node != nullptr;
-         mime_type_node                         = mime_type_node->next)
-    {
-        mime_types.push_back(mime_type_node->string);
-    }
-
-    d->version       = ci->version;
-    d->name          = ci->name;
-    d->description   = ci->description;
-    d->magic_numbers = magic_numbers;
-    d->extensions    = extensions;
-    d->mime_types    = mime_types;
-    d->load_features = sail::load_features(ci->load_features);
-    d->save_features = sail::save_features(ci->save_features);
+    d->data              = pimpl::cached_data(ci);
 }
 
 const sail_codec_info* codec_info::sail_codec_info_c() const
@@ -47,6 +47,7 @@ class save_features;
  */
 class SAIL_EXPORT codec_info
 {
+    friend class context;
     friend class image_input;
     friend class image_output;
 
@@ -265,7 +266,8 @@ public:
 
 private:
     /*
-     * Makes a deep copy of the specified codec metadata fields for further use.
+     * Makes a deep copy of the specified codec metadata fields for further use. The copy is made once
+     * per codec and shared by all the codec info objects constructed from the same pointer.
      * sail_codec_info_c() returns the original borrowed pointer which becomes invalid after
      * sail_finish(). Prefer the accessor methods (name(), extensions(), etc.) to read copied data.
      */
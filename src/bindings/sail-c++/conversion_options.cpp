@@ -80,6 +80,7 @@ conversion_options& conversion_options::operator=(const conversion_options& co)
     set_options(co.options());
     set_background(co.background48());
     set_background(co.background24());
+    set_max_threads(co.max_threads());
 
     return *this;
 }
@@ -115,6 +116,11 @@ sail_rgb24_t conversion_options::background24() const
     return d->conversion_options->background24;
 }
 
+unsigned conversion_options::max_threads() const
+{
+    return d->conversion_options->max_threads;
+}
+
 void conversion_options::set_options(int options)
 {
     d->conversion_options->options = options;
@@ -150,6 +156,11 @@ void conversion_options::set_background(const sail_rgb24_t& rgb24)
                                            static_cast<std::uint16_t>(rgb24.component3 * 257)};
 }
 
+void conversion_options::set_max_threads(unsigned max_threads)
+{
+    d->conversion_options->max_threads = max_threads;
+}
+
 sail_status_t conversion_options::to_sail_conversion_options(sail_conversion_options** conversion_options) const
 {
     SAIL_CHECK_PTR(conversion_options);
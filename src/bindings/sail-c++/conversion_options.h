@@ -107,6 +107,11 @@ public:
      */
     sail_rgb24_t background24() const;
 
+    /*
+     * Returns the maximum number of threads to convert images with. 0 means sail_max_threads().
+     */
+    unsigned max_threads() const;
+
     /*
      * Sets new or-ed SailConversionOption-s. If zero, SAIL_CONVERSION_OPTION_DROP_ALPHA is assumed.
      */
@@ -131,6 +136,12 @@ public:
      */
     void set_background(const sail_rgb24_t& rgb24);
 
+    /*
+     * Sets the maximum number of threads to convert images with. 0 means sail_max_threads().
+     * Values greater than sail_max_threads() are truncated.
+     */
+    void set_max_threads(unsigned max_threads);
+
 private:
     sail_status_t to_sail_conversion_options(sail_conversion_options** conversion_options) const;
 
@@ -62,12 +62,20 @@ public:
     {
         if (!shallow_pixels)
         {
-            sail_free(sail_image->pixels);
+            if (sail_image->pixels_alignment != 0)
+            {
+                sail_free_aligned(sail_image->pixels);
+            }
+            else
+            {
+                sail_free(sail_image->pixels);
+            }
         }
 
-        sail_image->pixels = nullptr;
-        pixels_size        = 0;
-        shallow_pixels     = false;
+        sail_image->pixels           = nullptr;
+        sail_image->pixels_alignment = 0;
+        pixels_size                  = 0;
+        shallow_pixels               = false;
     }
 
     struct sail_image* sail_image;
@@ -439,7 +447,8 @@ sail_status_t image::convert(SailPixelFormat pixel_format, const conversion_opti
 
     d->sail_image->bytes_per_line = sail_image_output->bytes_per_line;
     d->sail_image->pixel_format   = sail_image_output->pixel_format;
-    d->sail_image->pixels         = sail_image_output->pixels;
+    d->sail_image->pixels           = sail_image_output->pixels;
+    d->sail_image->pixels_alignment = sail_image_output->pixels_alignment;
     d->pixels_size    = static_cast<std::size_t>(sail_image_output->height) * sail_image_output->bytes_per_line;
     d->shallow_pixels = false;
 
@@ -865,19 +874,16 @@ sail_status_t image::transfer_pixels_pointer(const sail_image* sail_image)
 {
     SAIL_CHECK_PTR(sail_image);
 
-    sail_free(d->sail_image->pixels);
-
-    d->sail_image->pixels = nullptr;
-    d->pixels_size        = 0;
-    d->shallow_pixels     = false;
+    d->reset_pixels();
 
     if (sail_image->pixels == nullptr)
     {
         return SAIL_OK;
     }
 
-    d->sail_image->pixels = sail_image->pixels;
-    d->pixels_size        = static_cast<std::size_t>(sail_image->height) * sail_image->bytes_per_line;
+    d->sail_image->pixels           = sail_image->pixels;
+    d->sail_image->pixels_alignment = sail_image->pixels_alignment;
+    d->pixels_size                  = static_cast<std::size_t>(sail_image->height) * sail_image->bytes_per_line;
 
     return SAIL_OK;
 }
@@ -1015,6 +1021,11 @@ void image::set_shallow_pixels(void* pixels, std::size_t pixels_size)
     d->shallow_pixels     = true;
 }
 
+bool image::shallow_pixels() const
+{
+    return d->shallow_pixels;
+}
+
 void image::set_source_image(const sail::source_image& source_image)
 {
     d->source_image = source_image;
@@ -851,6 +851,7 @@ private:
     void set_pixels(const void* pixels, std::size_t pixels_size);
     void set_shallow_pixels(void* pixels);
     void set_shallow_pixels(void* pixels, std::size_t pixels_size);
+    bool shallow_pixels() const;
     void set_source_image(const sail::source_image& source_image);
 
 private:
@@ -61,6 +61,7 @@ public:
 
     sail_status_t start();
     std::tuple<image, sail::codec_info> probe();
+    image thumbnail(unsigned min_size);
 
 private:
     std::unique_ptr<sail::abstract_io> abstract_io;
@@ -150,6 +151,27 @@ std::tuple<image, sail::codec_info> image_input::pimpl::probe()
     return std::tuple<image, sail::codec_info>{image(sail_image), codec_info};
 }
 
+image image_input::pimpl::thumbnail(unsigned min_size)
+{
+    if (!override_codec_info)
+    {
+        codec_info = abstract_io_ref.codec_info();
+    }
+
+    sail_image* sail_image = nullptr;
+
+    SAIL_AT_SCOPE_EXIT(sail_destroy_image(sail_image););
+
+    SAIL_TRY_OR_EXECUTE(sail_load_thumbnail_from_io(&abstract_io_adapter->sail_io_c(), codec_info.sail_codec_info_c(),
+                                                    min_size, &sail_image),
+                        /* on error */ return {});
+
+    sail::image image(sail_image);
+    sail_image->pixels = nullptr;
+
+    return image;
+}
+
 image_input::image_input(const std::string& path)
     : d(new pimpl(new io_file(path)))
 {
@@ -224,6 +246,21 @@ sail_status_t image_input::next_frame(sail::image* image)
         sail_destroy_image(sail_image);
     );
 
+    // Decode directly into caller-owned pixels
+    if (image->shallow_pixels())
+    {
+        void* pixels                  = image->pixels();
+        const std::size_t pixels_size = image->pixels_size();
+
+        SAIL_TRY(sail_load_next_frame_into(d->state, pixels, pixels_size, image->bytes_per_line(), &sail_image));
+
+        sail_image->pixels = nullptr;
+        *image             = sail::image(sail_image);
+        image->set_shallow_pixels(pixels, pixels_size);
+
+        return SAIL_OK;
+    }
+
     SAIL_TRY(sail_load_next_frame(d->state, &sail_image));
 
     *image             = sail::image(sail_image);
@@ -242,6 +279,55 @@ image image_input::next_frame()
     return image;
 }
 
+sail_status_t image_input::next_frame_rows(
+    unsigned rows_per_band,
+    const std::function<sail_status_t(const sail::image& band, unsigned first_row, unsigned frame_height)>& callback)
+{
+    if (d->finished)
+    {
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_CONFLICTING_OPERATION);
+    }
+    else if (d->state == nullptr)
+    {
+        SAIL_TRY(d->start());
+    }
+
+    using rows_callback = std::function<sail_status_t(const sail::image&, unsigned, unsigned)>;
+
+    auto pass_rows = [](void* user_data, const sail_image* band, unsigned first_row, unsigned frame_height) {
+        // Wrap the band pixels without copying them
+        sail_image band_skeleton = *band;
+        band_skeleton.pixels     = nullptr;
+
+        sail::image band_image(&band_skeleton);
+        band_image.set_shallow_pixels(band->pixels, static_cast<std::size_t>(band->height) * band->bytes_per_line);
+
+        return (*static_cast<const rows_callback*>(user_data))(band_image, first_row, frame_height);
+    };
+
+    void* user_data = const_cast<rows_callback*>(&callback);
+
+    SAIL_TRY(sail_load_next_frame_rows(d->state, rows_per_band, pass_rows, user_data));
+
+    return SAIL_OK;
+}
+
+sail_status_t image_input::seek_to_frame(unsigned frame)
+{
+    if (d->finished)
+    {
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_CONFLICTING_OPERATION);
+    }
+    else if (d->state == nullptr)
+    {
+        SAIL_TRY(d->start());
+    }
+
+    SAIL_TRY(sail_seek_to_frame(d->state, frame));
+
+    return SAIL_OK;
+}
+
 sail_status_t image_input::finish()
 {
     sail_status_t saved_status = SAIL_OK;
@@ -264,4 +350,58 @@ std::tuple<image, codec_info> image_input::probe()
     return d->probe();
 }
 
+image image_input::thumbnail(unsigned min_size)
+{
+    if (d->finished || d->state != nullptr)
+    {
+        SAIL_LOG_ERROR("Thumbnails cannot be loaded after loading frames");
+        return {};
+    }
+
+    return d->thumbnail(min_size);
+}
+
+std::vector<std::tuple<sail_status_t, image, codec_info>> image_input::probe_many(const std::vector<std::string>& paths,
+                                                                                  unsigned threads,
+                                                                                  std::size_t prefix_size)
+{
+    std::vector<const char*> sail_paths;
+    sail_paths.reserve(paths.size());
+
+    for (const std::string& path : paths)
+    {
+        sail_paths.push_back(path.c_str());
+    }
+
+    sail_probe_many_options options;
+    options.threads     = threads;
+    options.prefix_size = prefix_size;
+
+    sail_probe_result* sail_probe_results = nullptr;
+
+    SAIL_AT_SCOPE_EXIT(sail_destroy_probe_results(sail_probe_results, paths.size()););
+
+    SAIL_TRY_OR_EXECUTE(sail_probe_many(sail_paths.data(), sail_paths.size(), &sail_probe_results, &options),
+                        /* on error */ return {});
+
+    std::vector<std::tuple<sail_status_t, image, codec_info>> results;
+    results.reserve(paths.size());
+
+    for (std::size_t i = 0; i < paths.size(); i++)
+    {
+        const sail_probe_result& sail_probe_result = sail_probe_results[i];
+
+        if (sail_probe_result.status == SAIL_OK)
+        {
+            results.emplace_back(SAIL_OK, image(sail_probe_result.image), codec_info(sail_probe_result.codec_info));
+        }
+        else
+        {
+            results.emplace_back(sail_probe_result.status, image{}, codec_info{});
+        }
+    }
+
+    return results;
+}
+
 } // namespace sail
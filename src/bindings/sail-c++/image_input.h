@@ -26,9 +26,11 @@
 #pragma once
 
 #include <cstddef> /* std::size_t */
+#include <functional>
 #include <memory>
 #include <string>
 #include <tuple>
+#include <vector>
 
 #include <sail-common/export.h>
 #include <sail-common/status.h>
@@ -97,6 +99,10 @@ public:
     /*
      * Continues loading the image. Assigns the loaded image to the 'image' argument.
      *
+     * If the image was constructed over caller-owned pixels, the frame is decoded directly into them
+     * with the image bytes per line as the scan line stride, and the image keeps using them.
+     * See sail_load_next_frame_into() for the buffer requirements.
+     *
      * Returns SAIL_OK on success.
      * Returns SAIL_ERROR_NO_MORE_FRAMES when no more frames are available.
      */
@@ -109,6 +115,31 @@ public:
      */
     image next_frame();
 
+    /*
+     * Continues loading the image in bands of up to rows_per_band scan lines, and passes every band
+     * to the callback instead of returning the whole frame. first_row is the index of the first band
+     * scan line in the frame, and frame_height is the frame height. The band doesn't own its pixels,
+     * so they're valid only until the callback returns. See sail_load_next_frame_rows() for details.
+     *
+     * Returns SAIL_OK on success.
+     * Returns SAIL_ERROR_NO_MORE_FRAMES when no more frames are available.
+     * Returns the callback status when the callback fails.
+     */
+    sail_status_t next_frame_rows(
+        unsigned rows_per_band,
+        const std::function<sail_status_t(const sail::image& band, unsigned first_row, unsigned frame_height)>&
+            callback);
+
+    /*
+     * Positions loading at the specified zero-based frame, so the next call to next_frame() returns it.
+     * See sail_seek_to_frame() for details.
+     *
+     * Returns SAIL_OK on success.
+     * Returns SAIL_ERROR_NO_MORE_FRAMES when the image has less frames than the seek requires.
+     * Returns SAIL_ERROR_NOT_IMPLEMENTED when seeking backwards in a non-seekable I/O source.
+     */
+    sail_status_t seek_to_frame(unsigned frame);
+
     /*
      * Finishes loading and flushes the I/O stream. Call to finish() is optional
      * as it is automatically invoked in the destructor.
@@ -142,6 +173,31 @@ public:
      */
     std::tuple<image, codec_info> probe();
 
+    /*
+     * Loads the smallest embedded preview, like an EXIF thumbnail, that is at least min_size x min_size pixels.
+     * When there is no such preview, loads the first frame at the cheapest reduced size that still covers
+     * min_size x min_size. See sail_load_thumbnail_from_io() for details.
+     *
+     * Codec selection matches probe(). Overrides from with(load_options) are ignored. Must be called
+     * instead of next_frame(), not in addition to it.
+     *
+     * Returns an invalid image on error.
+     */
+    image thumbnail(unsigned min_size);
+
+    /*
+     * Probes the specified image files concurrently in up to 'threads' threads and reads at most
+     * 'prefix_size' bytes from every file when its headers fit into them. Zeros select the defaults.
+     * See sail_probe_many() for details.
+     *
+     * Returns the probe status, the image without pixels, and the codec info for every path
+     * in the same order. The image and the codec info are invalid when the status is not SAIL_OK.
+     * Returns an empty vector if the probing could not be started at all.
+     */
+    static std::vector<std::tuple<sail_status_t, image, codec_info>> probe_many(const std::vector<std::string>& paths,
+                                                                                unsigned threads         = 0,
+                                                                                std::size_t prefix_size = 0);
+
 private:
     class pimpl;
     std::unique_ptr<pimpl> d;
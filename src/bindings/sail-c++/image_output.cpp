@@ -190,6 +190,44 @@ sail_status_t image_output::next_frame(const sail::image& image)
     return SAIL_OK;
 }
 
+sail_status_t image_output::next_frame_rows(
+    const sail::image& image,
+    unsigned rows_per_band,
+    const std::function<sail_status_t(sail::image& band, unsigned first_row, unsigned frame_height)>& callback)
+{
+    if (d->finished)
+    {
+        return SAIL_ERROR_CONFLICTING_OPERATION;
+    }
+    else if (d->state == nullptr)
+    {
+        SAIL_TRY(d->start());
+    }
+
+    sail_image* sail_image = nullptr;
+    SAIL_TRY(image.to_sail_image(&sail_image));
+
+    SAIL_AT_SCOPE_EXIT(
+        sail_image->pixels = nullptr;
+        sail_destroy_image(sail_image);
+    );
+
+    using rows_callback = std::function<sail_status_t(sail::image&, unsigned, unsigned)>;
+
+    auto fill_rows = [](void* user_data, struct sail_image* band, unsigned first_row, unsigned frame_height) {
+        // Wrap the band pixels without copying them
+        sail::image band_image(band->pixels, band->pixel_format, band->width, band->height, band->bytes_per_line);
+
+        return (*static_cast<const rows_callback*>(user_data))(band_image, first_row, frame_height);
+    };
+
+    void* user_data = const_cast<rows_callback*>(&callback);
+
+    SAIL_TRY(sail_write_next_frame_rows(d->state, sail_image, rows_per_band, fill_rows, user_data));
+
+    return SAIL_OK;
+}
+
 sail_status_t image_output::finish()
 {
     sail_status_t saved_status = SAIL_OK;
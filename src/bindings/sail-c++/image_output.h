@@ -26,6 +26,7 @@
 #pragma once
 
 #include <cstddef> /* std::size_t */
+#include <functional>
 #include <memory>
 #include <string>
 
@@ -104,6 +105,22 @@ public:
      */
     sail_status_t next_frame(const sail::image& image);
 
+    /*
+     * Continues saving into the I/O target. Writes a frame with the properties of the specified image,
+     * and pulls its pixels from the callback in bands of up to rows_per_band scan lines instead of
+     * taking them from the image. The image may have no pixels at all. The callback must fill all
+     * the scan lines of the band. first_row is the index of the first band scan line in the frame,
+     * and frame_height is the frame height. The band doesn't own its pixels, so they're valid only
+     * until the callback returns. See sail_write_next_frame_rows() for details.
+     *
+     * Returns SAIL_OK on success.
+     * Returns the callback status when the callback fails.
+     */
+    sail_status_t next_frame_rows(
+        const sail::image& image,
+        unsigned rows_per_band,
+        const std::function<sail_status_t(sail::image& band, unsigned first_row, unsigned frame_height)>& callback);
+
     /*
      * Finishes saving and flushes the I/O stream. Call to finish() is optional
      * as it is automatically invoked in the destructor.
@@ -72,6 +72,9 @@ load_options& load_options::operator=(const sail::load_options& load_options)
 {
     set_options(load_options.options());
     set_tuning(load_options.tuning());
+    set_pixels_alignment(load_options.pixels_alignment());
+    set_crop(load_options.crop_x(), load_options.crop_y(), load_options.crop_width(), load_options.crop_height());
+    set_max_size(load_options.max_width(), load_options.max_height());
 
     return *this;
 }
@@ -107,6 +110,41 @@ const sail::tuning& load_options::tuning() const
     return d->tuning;
 }
 
+unsigned load_options::pixels_alignment() const
+{
+    return d->sail_load_options->pixels_alignment;
+}
+
+unsigned load_options::crop_x() const
+{
+    return d->sail_load_options->crop_x;
+}
+
+unsigned load_options::crop_y() const
+{
+    return d->sail_load_options->crop_y;
+}
+
+unsigned load_options::crop_width() const
+{
+    return d->sail_load_options->crop_width;
+}
+
+unsigned load_options::crop_height() const
+{
+    return d->sail_load_options->crop_height;
+}
+
+unsigned load_options::max_width() const
+{
+    return d->sail_load_options->max_width;
+}
+
+unsigned load_options::max_height() const
+{
+    return d->sail_load_options->max_height;
+}
+
 void load_options::set_options(int options)
 {
     d->sail_load_options->options = options;
@@ -117,6 +155,25 @@ void load_options::set_tuning(const sail::tuning& tuning)
     d->tuning = tuning;
 }
 
+void load_options::set_pixels_alignment(unsigned pixels_alignment)
+{
+    d->sail_load_options->pixels_alignment = pixels_alignment;
+}
+
+void load_options::set_crop(unsigned x, unsigned y, unsigned width, unsigned height)
+{
+    d->sail_load_options->crop_x      = x;
+    d->sail_load_options->crop_y      = y;
+    d->sail_load_options->crop_width  = width;
+    d->sail_load_options->crop_height = height;
+}
+
+void load_options::set_max_size(unsigned width, unsigned height)
+{
+    d->sail_load_options->max_width  = width;
+    d->sail_load_options->max_height = height;
+}
+
 load_options::load_options(const sail_load_options* ro)
     : load_options()
 {
@@ -128,6 +185,9 @@ load_options::load_options(const sail_load_options* ro)
 
     set_options(ro->options);
     set_tuning(utils_private::to_cpp_tuning(ro->tuning));
+    set_pixels_alignment(ro->pixels_alignment);
+    set_crop(ro->crop_x, ro->crop_y, ro->crop_width, ro->crop_height);
+    set_max_size(ro->max_width, ro->max_height);
 }
 
 sail_status_t load_options::to_sail_load_options(sail_load_options** load_options) const
@@ -138,7 +198,14 @@ sail_status_t load_options::to_sail_load_options(sail_load_options** load_option
 
     SAIL_TRY(sail_alloc_load_options(&load_options_local));
 
-    load_options_local->options = d->sail_load_options->options;
+    load_options_local->options          = d->sail_load_options->options;
+    load_options_local->pixels_alignment = d->sail_load_options->pixels_alignment;
+    load_options_local->crop_x           = d->sail_load_options->crop_x;
+    load_options_local->crop_y           = d->sail_load_options->crop_y;
+    load_options_local->crop_width       = d->sail_load_options->crop_width;
+    load_options_local->crop_height      = d->sail_load_options->crop_height;
+    load_options_local->max_width        = d->sail_load_options->max_width;
+    load_options_local->max_height       = d->sail_load_options->max_height;
 
     SAIL_TRY_OR_CLEANUP(sail_alloc_hash_map(&load_options_local->tuning),
                         /* cleanup */ sail_destroy_load_options(load_options_local));
@@ -114,6 +114,42 @@ public:
      */
     const sail::tuning& tuning() const;
 
+    /*
+     * Returns the alignment of the loaded pixels in bytes. 0 means the default pixels alignment.
+     * See sail_set_default_pixels_alignment().
+     */
+    unsigned pixels_alignment() const;
+
+    /*
+     * Returns the X coordinate of the region of interest.
+     */
+    unsigned crop_x() const;
+
+    /*
+     * Returns the Y coordinate of the region of interest.
+     */
+    unsigned crop_y() const;
+
+    /*
+     * Returns the width of the region of interest. 0 means no cropping.
+     */
+    unsigned crop_width() const;
+
+    /*
+     * Returns the height of the region of interest. 0 means no cropping.
+     */
+    unsigned crop_height() const;
+
+    /*
+     * Returns the maximum width hint for loading reduced frames. 0 means no limit.
+     */
+    unsigned max_width() const;
+
+    /*
+     * Returns the maximum height hint for loading reduced frames. 0 means no limit.
+     */
+    unsigned max_height() const;
+
     /*
      * Sets new or-ed manipulation options for loading operations. See SailOption.
      */
@@ -124,6 +160,26 @@ public:
      */
     void set_tuning(const sail::tuning& tuning);
 
+    /*
+     * Sets the alignment of the loaded pixels in bytes. Must be a power of two. When non-zero,
+     * scan lines are padded to a multiple of it, and the pixels are aligned to it.
+     */
+    void set_pixels_alignment(unsigned pixels_alignment);
+
+    /*
+     * Sets the region of interest to load. Loaded frames get the dimensions of the intersection
+     * of the region with the frames. 0 width or height disables cropping.
+     * See sail_load_options.crop_width.
+     */
+    void set_crop(unsigned x, unsigned y, unsigned width, unsigned height);
+
+    /*
+     * Sets the size hint for loading reduced frames. Codecs with SAIL_CODEC_FEATURE_SCALE
+     * load frames that are smaller than the original but still at least width x height.
+     * 0 means no limit. See sail_load_options.max_width.
+     */
+    void set_max_size(unsigned width, unsigned height);
+
 private:
     /*
      * Makes a deep copy of the specified load options and stores the pointer for further use.
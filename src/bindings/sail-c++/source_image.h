@@ -123,6 +123,24 @@ public:
      */
     bool interlaced() const;
 
+    /*
+     * Returns the original frame width. It differs from the image width when the frame
+     * is reduced or cropped while loading.
+     *
+     * LOAD: Set by SAIL to the original frame width.
+     * SAVE: Ignored.
+     */
+    unsigned width() const;
+
+    /*
+     * Returns the original frame height. It differs from the image height when the frame
+     * is reduced or cropped while loading.
+     *
+     * LOAD: Set by SAIL to the original frame height.
+     * SAVE: Ignored.
+     */
+    unsigned height() const;
+
     /*
      * Returns image format-specific properties that cannot be expressed
      * in a common way. For example, a cursor hot spot.
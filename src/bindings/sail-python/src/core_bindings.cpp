@@ -264,6 +264,8 @@ void init_core_classes(py::module_& m)
         .def_property_readonly("orientation", &sail::source_image::orientation, "Get source image orientation")
         .def_property_readonly("compression", &sail::source_image::compression, "Get source image compression type")
         .def_property_readonly("interlaced", &sail::source_image::interlaced, "Check if source image was interlaced")
+        .def_property_readonly("width", &sail::source_image::width, "Get original frame width")
+        .def_property_readonly("height", &sail::source_image::height, "Get original frame height")
 
         .def("__repr__", [](const sail::source_image& si) {
             return "SourceImage(format=" + std::to_string(si.pixel_format())
@@ -331,6 +331,12 @@ void init_enums(py::module_& m)
         .value("INTERLACED", SAIL_CODEC_FEATURE_INTERLACED)
         .value("ICCP", SAIL_CODEC_FEATURE_ICCP)
         .value("SOURCE_IMAGE", SAIL_CODEC_FEATURE_SOURCE_IMAGE)
+        .value("CROP", SAIL_CODEC_FEATURE_CROP)
+        .value("SCALE", SAIL_CODEC_FEATURE_SCALE)
+        .value("THUMBNAIL", SAIL_CODEC_FEATURE_THUMBNAIL)
+        .value("SEEK", SAIL_CODEC_FEATURE_SEEK)
+        .value("ROW_BANDS", SAIL_CODEC_FEATURE_ROW_BANDS)
+        .value("FRAME_INDEX", SAIL_CODEC_FEATURE_FRAME_INDEX)
         .export_values();
 
     // ============================================================================
@@ -401,6 +407,8 @@ void init_enums(py::module_& m)
         .value("INTERLACED", SAIL_OPTION_INTERLACED, "Save interlaced images")
         .value("ICCP", SAIL_OPTION_ICCP, "Load or save embedded ICC profile")
         .value("SOURCE_IMAGE", SAIL_OPTION_SOURCE_IMAGE, "Preserve source image information in loading")
+        .value("PROBE", SAIL_OPTION_PROBE, "Parse image headers only without starting the decoder")
+        .value("THUMBNAIL", SAIL_OPTION_THUMBNAIL, "Load the smallest embedded preview covering the size hint")
         .export_values();
 
     // ============================================================================
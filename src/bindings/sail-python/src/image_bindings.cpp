@@ -32,6 +32,7 @@
 
 #include <fstream>
 #include <limits>
+#include <memory>
 
 namespace py = pybind11;
 
@@ -51,6 +52,27 @@ static bool is_16bit_per_channel(SailPixelFormat pixel_format)
     return bits_per_channel == 16;
 }
 
+// Convert probed image properties to the dict returned by ImageInput.probe()
+static py::dict probe_result_to_dict(const sail::image& img, const sail::codec_info& codec_info)
+{
+    py::dict result;
+    result["width"]             = img.width();
+    result["height"]            = img.height();
+    result["pixel_format"]      = img.pixel_format();
+    result["bits_per_pixel"]    = img.bits_per_pixel();
+    result["codec_name"]        = codec_info.name();
+    result["codec_description"] = codec_info.description();
+
+    // Add source image info if available
+    if (img.source_image().is_valid())
+    {
+        result["source_pixel_format"] = img.source_image().pixel_format();
+        result["source_compression"]  = img.source_image().compression();
+    }
+
+    return result;
+}
+
 // Convert sail::image to NumPy array with appropriate dtype (uint8 or uint16)
 py::object image_to_numpy(sail::image& img)
 {
@@ -204,6 +226,9 @@ void init_image(py::module_& m)
                 opts.set_option(SAIL_CONVERSION_OPTION_PRESERVE_ICCP, preserve);
             },
             "Preserve ICC profile when converting between pixel formats")
+        .def_property("max_threads", &sail::conversion_options::max_threads,
+                      &sail::conversion_options::set_max_threads,
+                      "Maximum number of threads to convert with. 0 uses the global thread limit")
         .def("__repr__", [](const sail::conversion_options&) { return "ConversionOptions()"; });
 
     // ============================================================================
@@ -712,6 +737,67 @@ void init_image(py::module_& m)
             },
             "Load all frames/images")
 
+        .def(
+            "thumbnail",
+            [](sail::image_input& input, unsigned min_size) {
+                sail::image img = input.thumbnail(min_size);
+                if (!img.is_valid())
+                {
+                    throw std::runtime_error("Failed to load thumbnail");
+                }
+                return img;
+            },
+            py::arg("min_size") = 0,
+            "Load the smallest embedded preview of at least min_size x min_size pixels, "
+            "or the first frame reduced to cover that size when there is no such preview. "
+            "Call instead of load()")
+
+        .def(
+            "load_rows",
+            [](sail::image_input& input, unsigned rows_per_band, const py::function& callback) {
+                // Python exceptions must not cross the C decoding code, so stop loading and rethrow afterwards
+                std::unique_ptr<py::error_already_set> error;
+
+                auto status = input.next_frame_rows(
+                    rows_per_band, [&](const sail::image& band, unsigned first_row, unsigned frame_height) {
+                        try
+                        {
+                            // The band pixels are reused, so pass a copy
+                            callback(sail::image(band), first_row, frame_height);
+                        }
+                        catch (py::error_already_set& e)
+                        {
+                            error.reset(new py::error_already_set(std::move(e)));
+                            return SAIL_ERROR_CONFLICTING_OPERATION;
+                        }
+
+                        return SAIL_OK;
+                    });
+
+                if (error != nullptr)
+                {
+                    throw std::move(*error);
+                }
+                if (status != SAIL_OK)
+                {
+                    throw std::runtime_error("Failed to load frame rows");
+                }
+            },
+            py::arg("rows_per_band"), py::arg("callback"),
+            "Load next frame in bands of up to rows_per_band scan lines with bounded memory. "
+            "Calls callback(band, first_row, frame_height) for every band")
+
+        .def(
+            "seek",
+            [](sail::image_input& input, unsigned frame) {
+                auto status = input.seek_to_frame(frame);
+                if (status != SAIL_OK)
+                {
+                    throw std::runtime_error("Failed to seek to frame " + std::to_string(frame));
+                }
+            },
+            py::arg("frame"), "Position loading at the zero-based frame, so the next load() returns it")
+
         .def_static(
             "probe",
             [](const std::string& path) -> py::dict {
@@ -722,22 +808,7 @@ void init_image(py::module_& m)
                     sail::image img             = std::get<0>(probe_result);
                     sail::codec_info codec_info = std::get<1>(probe_result);
 
-                    py::dict result;
-                    result["width"]             = img.width();
-                    result["height"]            = img.height();
-                    result["pixel_format"]      = img.pixel_format();
-                    result["bits_per_pixel"]    = img.bits_per_pixel();
-                    result["codec_name"]        = codec_info.name();
-                    result["codec_description"] = codec_info.description();
-
-                    // Add source image info if available
-                    if (img.source_image().is_valid())
-                    {
-                        result["source_pixel_format"] = img.source_image().pixel_format();
-                        result["source_compression"]  = img.source_image().compression();
-                    }
-
-                    return result;
+                    return probe_result_to_dict(img, codec_info);
                 }
                 catch (const std::exception& e)
                 {
@@ -746,6 +817,41 @@ void init_image(py::module_& m)
             },
             py::arg("path"), "Probe image metadata without loading pixels (static method)")
 
+        .def_static(
+            "probe_many",
+            [](const std::vector<std::string>& paths, unsigned threads, std::size_t prefix_size) -> py::list {
+                std::vector<std::tuple<sail_status_t, sail::image, sail::codec_info>> probe_results;
+
+                {
+                    py::gil_scoped_release release;
+                    probe_results = sail::image_input::probe_many(paths, threads, prefix_size);
+                }
+
+                if (probe_results.size() != paths.size())
+                {
+                    throw std::runtime_error("Failed to probe images");
+                }
+
+                py::list results;
+
+                for (const auto& probe_result : probe_results)
+                {
+                    const sail_status_t status = std::get<0>(probe_result);
+
+                    py::dict result =
+                        (status == SAIL_OK) ? probe_result_to_dict(std::get<1>(probe_result), std::get<2>(probe_result))
+                                            : py::dict();
+                    result["status"] = status;
+
+                    results.append(result);
+                }
+
+                return results;
+            },
+            py::arg("paths"), py::arg("threads") = 0, py::arg("prefix_size") = 0,
+            "Probe multiple image files concurrently reading at most prefix_size bytes per file when possible. "
+            "Returns a list of dicts in the same order with a 'status' key and probe metadata on success (static method)")
+
         .def(
             "finish",
             [](sail::image_input& input) {
@@ -828,6 +934,59 @@ void init_image(py::module_& m)
             },
             py::arg("images"), "Save multiple frames/images")
 
+        .def(
+            "save_rows",
+            [](sail::image_output& output, SailPixelFormat pixel_format, unsigned width, unsigned height,
+               unsigned rows_per_band, const py::function& callback) {
+                // The frame pixels are never allocated
+                const sail::image skeleton(nullptr, pixel_format, width, height);
+
+                // Python exceptions must not cross the C encoding code, so stop saving and rethrow afterwards
+                std::unique_ptr<py::error_already_set> error;
+
+                auto status = output.next_frame_rows(
+                    skeleton, rows_per_band, [&](sail::image& band, unsigned first_row, unsigned frame_height) {
+                        try
+                        {
+                            // The callback returns the band scan lines as a NumPy array or a bytes-like object
+                            py::array rows = py::array::ensure(callback(first_row, band.height(), frame_height),
+                                                               py::array::c_style);
+                            const std::size_t band_size =
+                                static_cast<std::size_t>(band.height()) * band.bytes_per_line();
+
+                            if (!rows || static_cast<std::size_t>(rows.nbytes()) != band_size)
+                            {
+                                PyErr_SetString(PyExc_ValueError,
+                                                ("Rows callback must return " + std::to_string(band_size) + " bytes")
+                                                    .c_str());
+                                throw py::error_already_set();
+                            }
+
+                            std::memcpy(band.pixels(), rows.data(), band_size);
+                        }
+                        catch (py::error_already_set& e)
+                        {
+                            error.reset(new py::error_already_set(std::move(e)));
+                            return SAIL_ERROR_CONFLICTING_OPERATION;
+                        }
+
+                        return SAIL_OK;
+                    });
+
+                if (error != nullptr)
+                {
+                    throw std::move(*error);
+                }
+                if (status != SAIL_OK)
+                {
+                    throw std::runtime_error("Failed to save frame rows");
+                }
+            },
+            py::arg("pixel_format"), py::arg("width"), py::arg("height"), py::arg("rows_per_band"), py::arg("callback"),
+            "Save a frame in bands of up to rows_per_band scan lines with bounded memory. "
+            "Calls callback(first_row, rows, frame_height) for every band, which must return the band scan lines "
+            "as a NumPy array or a bytes-like object without padding")
+
         .def(
             "finish",
             [](sail::image_output& output) {
@@ -52,6 +52,30 @@ void init_options_classes(py::module_& m)
             },
             py::return_value_policy::reference_internal, "Codec-specific tuning options (dict[str, Variant])")
 
+        .def_property("pixels_alignment", &sail::load_options::pixels_alignment,
+                      &sail::load_options::set_pixels_alignment,
+                      "Alignment of loaded pixels and padded scan lines in bytes (0 = default)")
+
+        .def_property(
+            "crop",
+            [](const sail::load_options& opts) {
+                return py::make_tuple(opts.crop_x(), opts.crop_y(), opts.crop_width(), opts.crop_height());
+            },
+            [](sail::load_options& opts, const std::tuple<unsigned, unsigned, unsigned, unsigned>& crop) {
+                opts.set_crop(std::get<0>(crop), std::get<1>(crop), std::get<2>(crop), std::get<3>(crop));
+            },
+            "Region of interest to load as (x, y, width, height); 0 width or height = no cropping")
+
+        .def_property(
+            "max_size",
+            [](const sail::load_options& opts) {
+                return py::make_tuple(opts.max_width(), opts.max_height());
+            },
+            [](sail::load_options& opts, const std::tuple<unsigned, unsigned>& max_size) {
+                opts.set_max_size(std::get<0>(max_size), std::get<1>(max_size));
+            },
+            "Size hint as (width, height) for loading reduced frames with cheap codec reductions; 0 = no limit")
+
         // Methods
         .def("__repr__", [](const sail::load_options& opts) {
             return "LoadOptions(options=" + std::to_string(opts.options()) + ")";
@@ -316,6 +316,21 @@ def test_convert_to_with_options():
     assert rgb.is_valid
 
 
+def test_convert_to_with_max_threads():
+    """Test that limiting conversion threads does not change the result"""
+    img = sailpy.Image(sailpy.PixelFormat.BPP24_RGB, 64, 64)
+    options = sailpy.ConversionOptions()
+    assert options.max_threads == 0
+
+    options.max_threads = 1
+    serial = img.convert_to(sailpy.PixelFormat.BPP32_BGRA, options)
+
+    options.max_threads = 0
+    parallel = img.convert_to(sailpy.PixelFormat.BPP32_BGRA, options)
+
+    assert serial.to_numpy().tobytes() == parallel.to_numpy().tobytes()
+
+
 def test_convert_to_grayscale():
     """Test conversion to grayscale"""
     img = sailpy.Image(sailpy.PixelFormat.BPP24_RGB, 10, 10)
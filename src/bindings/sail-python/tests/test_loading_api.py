@@ -143,6 +143,24 @@ def test_image_input_probe(test_png):
     assert metadata["codec_name"] == "PNG"
 
 
+def test_image_input_probe_many(test_png, test_jpeg, tmp_path):
+    """Test ImageInput.probe_many() for several files at once"""
+    missing = tmp_path / "missing.png"
+    results = sailpy.ImageInput.probe_many([str(test_png), str(missing), str(test_jpeg)], threads=2)
+
+    assert len(results) == 3
+
+    assert results[0]["status"] == sailpy.Status.OK
+    assert results[0]["width"] == 16
+    assert results[0]["codec_name"] == "PNG"
+
+    assert results[1]["status"] != sailpy.Status.OK
+    assert "width" not in results[1]
+
+    assert results[2]["status"] == sailpy.Status.OK
+    assert results[2]["codec_name"] == "JPEG"
+
+
 def test_image_input_repr(test_png):
     """Test ImageInput string representation"""
     input = sailpy.ImageInput(str(test_png))
@@ -27,6 +27,7 @@ Advanced loading API tests
 Extensions based on tests/sail/advanced-api.c
 """
 
+import numpy as np
 import pytest
 import sailpy
 
@@ -83,6 +84,59 @@ def test_probe_returns_all_metadata(test_jpeg):
     assert len(metadata["codec_name"]) > 0
 
 
+def test_load_thumbnail(test_jpeg):
+    """Test that thumbnails cover the requested size and never exceed the full image"""
+    full = sailpy.ImageInput(str(test_jpeg)).load()
+    min_size = min(full.width, full.height) // 4
+
+    img = sailpy.ImageInput(str(test_jpeg)).thumbnail(min_size)
+    assert img.is_valid
+    assert min_size <= img.width <= full.width
+    assert min_size <= img.height <= full.height
+
+
+def test_seek_to_frame(test_jpeg):
+    """Test that seeking back to the first frame reloads it and seeking past the end fails"""
+    input = sailpy.ImageInput(str(test_jpeg))
+    first = input.load()
+
+    input.seek(0)
+    img = input.load()
+    assert img.is_valid
+    assert (img.width, img.height) == (first.width, first.height)
+
+    with pytest.raises(RuntimeError):
+        input.seek(2)
+
+
+def test_load_rows(test_jpeg):
+    """Test that loading in bands produces the same rows as loading the whole frame"""
+    reference = sailpy.ImageInput(str(test_jpeg)).load()
+    rows = []
+
+    def on_band(band, first_row, frame_height):
+        assert band.width == reference.width
+        assert band.height <= 16
+        assert frame_height == reference.height
+        assert first_row == len(rows)
+        rows.extend(band.to_numpy())
+
+    sailpy.ImageInput(str(test_jpeg)).load_rows(16, on_band)
+
+    assert len(rows) == reference.height
+    assert (np.array(rows) == reference.to_numpy()).all()
+
+
+def test_load_rows_callback_error(test_jpeg):
+    """Test that an exception raised by the callback stops loading and propagates"""
+
+    def on_band(band, first_row, frame_height):
+        raise ValueError("stop")
+
+    with pytest.raises(ValueError):
+        sailpy.ImageInput(str(test_jpeg)).load_rows(16, on_band)
+
+
 def test_reader_finish_idempotent(test_jpeg):
     """Test that calling finish() multiple times is safe"""
     input = sailpy.ImageInput(str(test_jpeg))
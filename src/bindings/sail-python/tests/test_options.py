@@ -107,6 +107,41 @@ def test_load_options_with_image_input(test_jpeg):
     assert img.is_valid
 
 
+def test_load_options_crop(test_jpeg):
+    """Test LoadOptions crop loads just the region of interest"""
+    options = sailpy.LoadOptions()
+    assert options.crop == (0, 0, 0, 0)
+
+    options.crop = (1, 2, 3, 4)
+    assert options.crop == (1, 2, 3, 4)
+
+    input = sailpy.ImageInput(str(test_jpeg))
+    input.with_options(options)
+
+    img = input.load()
+    assert img.width == 3
+    assert img.height == 4
+
+
+def test_load_options_max_size(test_jpeg):
+    """Test LoadOptions max_size loads reduced frames and keeps the original size"""
+    options = sailpy.LoadOptions()
+    assert options.max_size == (0, 0)
+
+    options.max_size = (8, 8)
+    options.options = sailpy.Option.SOURCE_IMAGE
+    assert options.max_size == (8, 8)
+
+    input = sailpy.ImageInput(str(test_jpeg))
+    input.with_options(options)
+
+    img = input.load()
+    assert img.width == 8
+    assert img.height == 8
+    assert img.source_image.width == 32
+    assert img.source_image.height == 32
+
+
 # ============================================================================
 # SaveOptions - Full Coverage
 # ============================================================================
@@ -27,6 +27,8 @@ Advanced saving API tests
 Extensions based on tests/sail/advanced-api.c
 """
 
+import numpy as np
+import pytest
 import sailpy
 import tempfile
 import os
@@ -489,3 +491,37 @@ def test_tuning_compare_filter_sizes(tmp_path):
     assert len(sizes) == 3
     # Filters can produce different sizes (though not always)
     assert all(size > 0 for size in sizes.values())
+
+
+def test_save_rows(tmp_path):
+    """Test saving a frame generated in bands"""
+    output_path = tmp_path / "rows.png"
+    bands = []
+
+    def on_band(first_row, rows, frame_height):
+        assert rows <= 16
+        assert frame_height == 40
+        bands.append(first_row)
+        return np.full((rows, 24, 3), first_row, dtype=np.uint8)
+
+    with sailpy.ImageOutput(str(output_path)) as output:
+        output.save_rows(sailpy.PixelFormat.BPP24_RGB, 24, 40, 16, on_band)
+
+    assert bands == [0, 16, 32]
+
+    img = sailpy.Image.from_file(str(output_path))
+    assert img.width == 24
+    assert img.height == 40
+    assert (img.to_numpy()[:, :, 0] == np.repeat([0, 16, 32], [16, 16, 8])[:, None]).all()
+
+
+def test_save_rows_callback_error(tmp_path):
+    """Test that an exception raised by the callback stops saving and propagates"""
+
+    def on_band(first_row, rows, frame_height):
+        raise ValueError("stop")
+
+    output = sailpy.ImageOutput(str(tmp_path / "rows.png"))
+
+    with pytest.raises(ValueError):
+        output.save_rows(sailpy.PixelFormat.BPP24_RGB, 24, 40, 16, on_band)
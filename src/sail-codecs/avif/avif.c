@@ -50,6 +50,7 @@ struct avif_state
     struct sail_avif_context avif_context;
     struct avifImage* avif_image;
     unsigned frames_saved;
+    bool frame_probed;
 };
 
 static sail_status_t alloc_avif_state(struct sail_io* io,
@@ -90,6 +91,7 @@ static sail_status_t alloc_avif_state(struct sail_io* io,
                                        .avif_encoder = NULL,
                                        .avif_image   = NULL,
                                        .frames_saved = 0,
+                                       .frame_probed = false,
                                        .avif_context = (struct sail_avif_context){
                                            .io          = io,
                                            .buffer      = buffer,
@@ -177,16 +179,56 @@ SAIL_EXPORT sail_status_t sail_codec_load_seek_next_frame_v8_avif(void* state, s
 {
     struct avif_state* avif_state = state;
 
-    avifResult avif_result = avifDecoderNextImage(avif_state->avif_decoder);
-    if (avif_result == AVIF_RESULT_NO_IMAGES_REMAINING)
+    /*
+     * avifDecoderParse() fills the image properties. Probing reports them without decoding
+     * the first frame. Older libavif versions don't report alpha presence before decoding.
+     */
+#if AVIF_VERSION_MAJOR >= 1
+    const bool probe = (avif_state->load_options->options & SAIL_OPTION_PROBE) != 0;
+#else
+    const bool probe = false;
+#endif
+
+    avifImageTiming image_timing;
+    bool has_alpha = false;
+
+    if (probe)
     {
-        return SAIL_ERROR_NO_MORE_FRAMES;
-    }
+        if (avif_state->frame_probed)
+        {
+            return SAIL_ERROR_NO_MORE_FRAMES;
+        }
 
-    if (avif_result != AVIF_RESULT_OK)
+        avif_state->frame_probed = true;
+
+        avifResult avif_result = avifDecoderNthImageTiming(avif_state->avif_decoder, 0, &image_timing);
+
+        if (avif_result != AVIF_RESULT_OK)
+        {
+            SAIL_LOG_ERROR("AVIF: %s", avifResultToString(avif_result));
+            SAIL_LOG_AND_RETURN(SAIL_ERROR_UNDERLYING_CODEC);
+        }
+
+#if AVIF_VERSION_MAJOR >= 1
+        has_alpha = avif_state->avif_decoder->alphaPresent;
+#endif
+    }
+    else
     {
-        SAIL_LOG_ERROR("AVIF: %s", avifResultToString(avif_result));
-        SAIL_LOG_AND_RETURN(SAIL_ERROR_UNDERLYING_CODEC);
+        avifResult avif_result = avifDecoderNextImage(avif_state->avif_decoder);
+        if (avif_result == AVIF_RESULT_NO_IMAGES_REMAINING)
+        {
+            return SAIL_ERROR_NO_MORE_FRAMES;
+        }
+
+        if (avif_result != AVIF_RESULT_OK)
+        {
+            SAIL_LOG_ERROR("AVIF: %s", avifResultToString(avif_result));
+            SAIL_LOG_AND_RETURN(SAIL_ERROR_UNDERLYING_CODEC);
+        }
+
+        image_timing = avif_state->avif_decoder->imageTiming;
+        has_alpha    = avif_state->avif_decoder->image->alphaPlane != NULL;
     }
 
     const struct avifImage* avif_image = avif_state->avif_decoder->image;
@@ -203,7 +245,7 @@ SAIL_EXPORT sail_status_t sail_codec_load_seek_next_frame_v8_avif(void* state, s
                             /* cleanup */ sail_destroy_image(image_local));
 
         image_local->source_image->pixel_format =
-            avif_private_sail_pixel_format(avif_image->yuvFormat, avif_image->depth, avif_image->alphaPlane != NULL);
+            avif_private_sail_pixel_format(avif_image->yuvFormat, avif_image->depth, has_alpha);
         image_local->source_image->chroma_subsampling = avif_private_sail_chroma_subsampling(avif_image->yuvFormat);
         image_local->source_image->compression        = SAIL_COMPRESSION_AV1;
     }
@@ -213,7 +255,7 @@ SAIL_EXPORT sail_status_t sail_codec_load_seek_next_frame_v8_avif(void* state, s
     image_local->pixel_format =
         avif_private_rgb_sail_pixel_format(avif_state->rgb_image.format, avif_state->rgb_image.depth);
     image_local->bytes_per_line = sail_bytes_per_line(image_local->width, image_local->pixel_format);
-    image_local->delay          = (int)(avif_state->avif_decoder->imageTiming.duration * 1000);
+    image_local->delay          = (int)(image_timing.duration * 1000);
 
     /* Fetch ICC profile. */
     if (avif_state->load_options->options & SAIL_OPTION_ICCP)
@@ -477,7 +477,11 @@ sail_status_t bmp_private_read_frame(void* state, struct sail_io* io, struct sai
 
     for (unsigned i = image->height; i > 0; i--)
     {
-        unsigned char* scan = sail_scan_line(image, bmp_state->flipped ? (i - 1) : (image->height - i));
+        void* scan_line;
+        SAIL_TRY(sail_load_scan_line(bmp_state->load_options, image, bmp_state->flipped ? (i - 1) : (image->height - i),
+                                     &scan_line));
+
+        unsigned char* scan = scan_line;
 
         for (unsigned pixel_index = 0; pixel_index < image->width;)
         {
@@ -987,7 +991,8 @@ sail_status_t bmp_private_write_frame(void* state, struct sail_io* io, const str
         /* RLE8 compression. */
         for (unsigned row = image->height; row > 0; row--)
         {
-            const unsigned char* scan = sail_scan_line(image, row - 1);
+            const void* scan;
+            SAIL_TRY(sail_save_scan_line(bmp_state->save_options, image, row - 1, &scan));
             SAIL_TRY(bmp_private_write_rle8_scan_line(io, scan, image->width));
         }
 
@@ -1000,7 +1005,8 @@ sail_status_t bmp_private_write_frame(void* state, struct sail_io* io, const str
         /* RLE4 compression. */
         for (unsigned row = image->height; row > 0; row--)
         {
-            const unsigned char* scan = sail_scan_line(image, row - 1);
+            const void* scan;
+            SAIL_TRY(sail_save_scan_line(bmp_state->save_options, image, row - 1, &scan));
             SAIL_TRY(bmp_private_write_rle4_scan_line(io, scan, image->width));
         }
 
@@ -1013,7 +1019,8 @@ sail_status_t bmp_private_write_frame(void* state, struct sail_io* io, const str
         /* Uncompressed. */
         for (unsigned row = image->height; row > 0; row--)
         {
-            const unsigned char* scan = sail_scan_line(image, row - 1);
+            const void* scan;
+            SAIL_TRY(sail_save_scan_line(bmp_state->save_options, image, row - 1, &scan));
             SAIL_TRY(io->strict_write(io->stream, scan, bmp_state->bytes_in_row));
 
             if (bmp_state->pad_bytes > 0)
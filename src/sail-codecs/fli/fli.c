@@ -45,7 +45,8 @@ struct fli_state
     struct sail_palette* current_palette;
     unsigned char* prev_frame;
     unsigned current_frame_index;
-    bool is_fli; /* true for FLI (0xAF11), false for FLC (0xAF12). */
+    bool is_fli;        /* true for FLI (0xAF11), false for FLC (0xAF12). */
+    bool frame_pending; /* The last returned frame is not loaded yet. */
 
     /* For saving. */
     int frames_written;
@@ -71,6 +72,7 @@ static sail_status_t alloc_fli_state(struct sail_io* io,
         .prev_frame          = NULL,
         .current_frame_index = 0,
         .is_fli              = false,
+        .frame_pending       = false,
 
         .frames_written = 0,
         .is_first_frame = true,
@@ -161,11 +163,60 @@ SAIL_EXPORT sail_status_t sail_codec_load_seek_next_frame_v8_fli(void* state, st
 {
     struct fli_state* fli_state = state;
 
+    unsigned resume_frame;
+    const struct sail_frame_index_entry* resume_entry;
+
+    if (sail_take_frame_to_resume(fli_state->load_options, &resume_frame, &resume_entry))
+    {
+        /* Keyframes replace all the pixels, so just the palette they start with is restored. */
+        if (resume_entry->data_size != 256 * 3)
+        {
+            SAIL_LOG_ERROR("FLI: Recorded frame #%u has no palette", resume_frame);
+            SAIL_LOG_AND_RETURN(SAIL_ERROR_INVALID_ARGUMENT);
+        }
+
+        SAIL_TRY(fli_state->io->seek(fli_state->io->stream, (long)resume_entry->offset, SEEK_SET));
+
+        size_t prev_frame_size;
+        SAIL_TRY(sail_size_mul(fli_state->fli_header.width, fli_state->fli_header.height, &prev_frame_size));
+
+        memcpy(fli_state->current_palette->data, resume_entry->data, resume_entry->data_size);
+        memset(fli_state->prev_frame, 0, prev_frame_size);
+
+        fli_state->current_frame_index = resume_frame;
+        fli_state->frame_pending       = false;
+    }
+    else if (fli_state->frame_pending)
+    {
+        /* The previous frame was skipped without loading it. Follow its palette changes. */
+        bool keyframe;
+        SAIL_TRY(fli_private_scan_frame(fli_state->io, fli_state->current_palette, &keyframe));
+
+        fli_state->current_frame_index++;
+        fli_state->frame_pending = false;
+    }
+
     if (fli_state->current_frame_index >= fli_state->fli_header.frames)
     {
         return SAIL_ERROR_NO_MORE_FRAMES;
     }
 
+    /* Record the frame with the palette it starts with. The first frame starts with black pixels. */
+    if (sail_indexing_frame(fli_state->load_options))
+    {
+        size_t frame_offset;
+        SAIL_TRY(fli_state->io->tell(fli_state->io->stream, &frame_offset));
+
+        bool keyframe;
+        SAIL_TRY(fli_private_scan_frame(fli_state->io, NULL, &keyframe));
+        SAIL_TRY(fli_state->io->seek(fli_state->io->stream, (long)frame_offset, SEEK_SET));
+
+        keyframe = keyframe || fli_state->current_frame_index == 0;
+
+        SAIL_TRY(sail_record_frame(fli_state->load_options, frame_offset, keyframe, 0, fli_state->current_palette->data,
+                                   256 * 3));
+    }
+
     struct sail_image* image_local;
     SAIL_TRY(sail_alloc_image(&image_local));
 
@@ -199,6 +250,8 @@ SAIL_EXPORT sail_status_t sail_codec_load_seek_next_frame_v8_fli(void* state, st
     SAIL_TRY_OR_CLEANUP(sail_copy_palette(fli_state->current_palette, &image_local->palette),
                         /* cleanup */ sail_destroy_image(image_local));
 
+    fli_state->frame_pending = true;
+
     *image = image_local;
 
     return SAIL_OK;
@@ -343,6 +396,7 @@ SAIL_EXPORT sail_status_t sail_codec_load_frame_v8_fli(void* state, struct sail_
     memcpy(fli_state->prev_frame, image->pixels, frame_size);
 
     fli_state->current_frame_index++;
+    fli_state->frame_pending = false;
 
     return SAIL_OK;
 }
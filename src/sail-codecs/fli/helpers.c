@@ -535,3 +535,74 @@ sail_status_t fli_private_decode_ss2(struct sail_io* io, unsigned char* pixels,
 
     return SAIL_OK;
 }
+
+sail_status_t fli_private_scan_frame(struct sail_io* io, struct sail_palette* palette, bool* keyframe)
+{
+    size_t frame_start_pos;
+    SAIL_TRY(io->tell(io->stream, &frame_start_pos));
+
+    struct SailFliFrameHeader frame_header;
+    SAIL_TRY(fli_private_read_frame_header(io, &frame_header));
+
+    if (frame_header.magic != SAIL_FLI_FRAME_MAGIC)
+    {
+        SAIL_LOG_ERROR("FLI: Invalid frame magic 0x%04X", frame_header.magic);
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_INVALID_IMAGE);
+    }
+
+    *keyframe = false;
+
+    for (unsigned i = 0; i < frame_header.chunks; i++)
+    {
+        size_t chunk_start_pos;
+        SAIL_TRY(io->tell(io->stream, &chunk_start_pos));
+
+        struct SailFliChunkHeader chunk_header;
+        SAIL_TRY(fli_private_read_chunk_header(io, &chunk_header));
+
+        /* On-disk chunk header is 6 bytes (uint32 size + uint16 type). */
+        if (chunk_header.size < 6)
+        {
+            SAIL_LOG_ERROR("FLI: Invalid chunk size %u (less than header size)", chunk_header.size);
+            SAIL_LOG_AND_RETURN(SAIL_ERROR_INVALID_IMAGE);
+        }
+
+        switch (chunk_header.type)
+        {
+        case SAIL_FLI_COLOR256:
+        {
+            if (palette != NULL)
+            {
+                SAIL_TRY(fli_private_decode_color256(io, chunk_header.size, palette));
+            }
+            break;
+        }
+
+        case SAIL_FLI_COLOR64:
+        {
+            if (palette != NULL)
+            {
+                SAIL_TRY(fli_private_decode_color64(io, chunk_header.size, palette));
+            }
+            break;
+        }
+
+        /* These chunks replace the whole frame. */
+        case SAIL_FLI_BLACK:
+        case SAIL_FLI_BRUN:
+        case SAIL_FLI_DTA_BRUN:
+        case SAIL_FLI_COPY:
+        case SAIL_FLI_DTA_COPY:
+        {
+            *keyframe = true;
+            break;
+        }
+        }
+
+        SAIL_TRY(io->seek(io->stream, (long)(chunk_start_pos + chunk_header.size), SEEK_SET));
+    }
+
+    SAIL_TRY(io->seek(io->stream, (long)(frame_start_pos + frame_header.size), SEEK_SET));
+
+    return SAIL_OK;
+}
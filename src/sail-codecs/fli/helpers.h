@@ -25,6 +25,7 @@
 
 #pragma once
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include <sail-common/common.h>
@@ -145,3 +146,5 @@ SAIL_HIDDEN sail_status_t fli_private_decode_ss2(struct sail_io* io,
                                                  unsigned char* pixels,
                                                  unsigned width,
                                                  unsigned height);
+
+SAIL_HIDDEN sail_status_t fli_private_scan_frame(struct sail_io* io, struct sail_palette* palette, bool* keyframe);
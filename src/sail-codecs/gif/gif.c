@@ -65,6 +65,7 @@ struct gif_state
     unsigned prev_height;
     unsigned char** first_frame;
     unsigned char background[4]; /* RGBA */
+    bool frame_pending;          /* The image data of the last returned frame is not read yet. */
 
     /* For saving. */
     int frames_written;
@@ -105,6 +106,7 @@ static sail_status_t alloc_gif_state(struct sail_io* io,
         .prev_width         = 0,
         .prev_height        = 0,
         .first_frame        = NULL,
+        .frame_pending      = false,
 
         .frames_written          = 0,
         .color_map               = NULL,
@@ -144,6 +146,57 @@ static void destroy_gif_state(struct gif_state* gif_state)
     sail_free(gif_state);
 }
 
+/*
+ * Skips the LZW data of the current image without decoding it.
+ */
+static sail_status_t skip_image_data(struct gif_state* gif_state)
+{
+    int code_size;
+    GifByteType* code_block;
+
+    if (DGifGetCode(gif_state->gif, &code_size, &code_block) == GIF_ERROR)
+    {
+        SAIL_LOG_ERROR("GIF: %s", GifErrorString(gif_state->gif->Error));
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_UNDERLYING_CODEC);
+    }
+
+    while (code_block != NULL)
+    {
+        if (DGifGetCodeNext(gif_state->gif, &code_block) == GIF_ERROR)
+        {
+            SAIL_LOG_ERROR("GIF: %s", GifErrorString(gif_state->gif->Error));
+            SAIL_LOG_AND_RETURN(SAIL_ERROR_UNDERLYING_CODEC);
+        }
+    }
+
+    return SAIL_OK;
+}
+
+/*
+ * Resumes reading records at the recorded frame with an empty canvas and no previous frame to dispose.
+ */
+static sail_status_t resume_at_frame(struct gif_state* gif_state,
+                                     unsigned frame,
+                                     const struct sail_frame_index_entry* entry)
+{
+    SAIL_TRY(gif_state->io->seek(gif_state->io->stream, (long)entry->offset, SEEK_SET));
+
+    for (int i = 0; i < gif_state->first_frame_height; i++)
+    {
+        memset(gif_state->first_frame[i], 0, (size_t)gif_state->gif->SWidth * 4); /* 4 = RGBA */
+    }
+
+    gif_state->current_image = (int)frame - 1;
+    gif_state->disposal      = DISPOSAL_UNSPECIFIED;
+    gif_state->row           = 0;
+    gif_state->column        = 0;
+    gif_state->width         = 0;
+    gif_state->height        = 0;
+    gif_state->frame_pending = false;
+
+    return SAIL_OK;
+}
+
 /*
  * Decoding functions.
  */
@@ -227,6 +280,31 @@ SAIL_EXPORT sail_status_t sail_codec_load_seek_next_frame_v8_gif(void* state, st
         image_local->source_image->compression  = SAIL_COMPRESSION_LZW;
     }
 
+    unsigned resume_frame;
+    const struct sail_frame_index_entry* resume_entry;
+
+    if (sail_take_frame_to_resume(gif_state->load_options, &resume_frame, &resume_entry))
+    {
+        SAIL_TRY_OR_CLEANUP(resume_at_frame(gif_state, resume_frame, resume_entry),
+                            /* cleanup */ sail_destroy_image(image_local));
+    }
+    else if (gif_state->frame_pending)
+    {
+        /* The previous frame was skipped without loading it. */
+        SAIL_TRY_OR_CLEANUP(skip_image_data(gif_state),
+                            /* cleanup */ sail_destroy_image(image_local));
+        gif_state->frame_pending = false;
+    }
+
+    /* Records of the frame start here. */
+    size_t frame_offset = 0;
+
+    if (sail_indexing_frame(gif_state->load_options))
+    {
+        SAIL_TRY_OR_CLEANUP(gif_state->io->tell(gif_state->io->stream, &frame_offset),
+                            /* cleanup */ sail_destroy_image(image_local));
+    }
+
     gif_state->current_image++;
 
     gif_state->prev_disposal      = gif_state->disposal;
@@ -396,6 +474,26 @@ SAIL_EXPORT sail_status_t sail_codec_load_seek_next_frame_v8_gif(void* state, st
         }
     }
 
+    /*
+     * A frame doesn't depend on the previous ones when it covers the whole screen without
+     * transparent pixels, or when the previous frame cleared the whole screen.
+     */
+    const unsigned screen_width  = (unsigned)gif_state->gif->SWidth;
+    const unsigned screen_height = (unsigned)gif_state->gif->SHeight;
+
+    const bool full_frame = gif_state->row == 0 && gif_state->column == 0 && gif_state->width == screen_width
+                            && gif_state->height == screen_height;
+    const bool prev_full_frame = gif_state->prev_row == 0 && gif_state->prev_column == 0
+                                 && gif_state->prev_width == screen_width && gif_state->prev_height == screen_height;
+    const bool keyframe = gif_state->current_image == 0 || (full_frame && gif_state->transparency_index < 0)
+                          || (gif_state->prev_disposal == DISPOSE_BACKGROUND && prev_full_frame);
+
+    SAIL_TRY_OR_CLEANUP(
+        sail_record_frame(gif_state->load_options, frame_offset, keyframe, gif_state->disposal, NULL, 0),
+        /* cleanup */ sail_destroy_image(image_local));
+
+    gif_state->frame_pending = true;
+
     *image = image_local;
 
     return SAIL_OK;
@@ -515,6 +613,8 @@ SAIL_EXPORT sail_status_t sail_codec_load_frame_v8_gif(void* state, struct sail_
         }
     }
 
+    gif_state->frame_pending = false;
+
     return SAIL_OK;
 }
 
@@ -40,6 +40,9 @@ struct hdr_codec_state
     const struct sail_load_options* load_options;
     const struct sail_save_options* save_options;
 
+    /* The header and scanlines are parsed byte by byte. One reader serves the whole decoding session. */
+    struct sail_buffered_reader* reader;
+
     bool frame_processed;
 
     struct hdr_header header;
@@ -60,6 +63,8 @@ static sail_status_t alloc_hdr_codec_state(struct sail_io* io,
         .load_options = load_options,
         .save_options = save_options,
 
+        .reader = NULL,
+
         .frame_processed = false,
 
         .header =
@@ -95,6 +100,8 @@ static void destroy_hdr_codec_state(struct hdr_codec_state* hdr_codec_state)
 
     hdr_private_destroy_header(&hdr_codec_state->header);
 
+    sail_destroy_buffered_reader(hdr_codec_state->reader);
+
     sail_free(hdr_codec_state);
 }
 
@@ -113,6 +120,8 @@ SAIL_EXPORT sail_status_t sail_codec_load_init_v8_hdr(struct sail_io* io,
     SAIL_TRY(alloc_hdr_codec_state(io, load_options, NULL, &hdr_codec_state));
     *state = hdr_codec_state;
 
+    SAIL_TRY(sail_alloc_buffered_reader(io, 0, &hdr_codec_state->reader));
+
     return SAIL_OK;
 }
 
@@ -128,7 +137,7 @@ SAIL_EXPORT sail_status_t sail_codec_load_seek_next_frame_v8_hdr(void* state, st
     hdr_state->frame_processed = true;
 
     /* Read HDR header. */
-    SAIL_TRY(hdr_private_read_header(hdr_state->io, &hdr_state->header));
+    SAIL_TRY(hdr_private_read_header(hdr_state->reader, &hdr_state->header));
 
     SAIL_LOG_TRACE("HDR: %dx%d, Y%s X%s", hdr_state->header.width, hdr_state->header.height,
                    hdr_state->header.y_increasing ? "+" : "-", hdr_state->header.x_increasing ? "+" : "-");
@@ -220,11 +229,15 @@ SAIL_EXPORT sail_status_t sail_codec_load_frame_v8_hdr(void* state, struct sail_
             target_y = y;
         }
 
-        SAIL_TRY_OR_CLEANUP(hdr_private_read_scanline(hdr_codec_state->io, hdr_codec_state->header.width, scanline),
+        SAIL_TRY_OR_CLEANUP(hdr_private_read_scanline(hdr_codec_state->reader, hdr_codec_state->header.width, scanline),
                             /* cleanup */ sail_free(scanline));
 
         /* Copy to image buffer. */
-        float* dest = (float*)((uint8_t*)image->pixels + target_y * image->bytes_per_line);
+        void* scan_line;
+        SAIL_TRY_OR_CLEANUP(sail_load_scan_line(hdr_codec_state->load_options, image, (unsigned)target_y, &scan_line),
+                            /* cleanup */ sail_free(scanline));
+
+        float* dest = scan_line;
 
         if (hdr_codec_state->header.x_increasing)
         {
@@ -345,7 +358,8 @@ SAIL_EXPORT sail_status_t sail_codec_save_frame_v8_hdr(void* state, const struct
     /* Write scanlines. */
     for (int y = 0; y < hdr_codec_state->header.height; y++)
     {
-        const float* scanline = (const float*)((const uint8_t*)image->pixels + y * image->bytes_per_line);
+        const void* scanline;
+        SAIL_TRY(sail_save_scan_line(hdr_codec_state->save_options, image, (unsigned)y, &scanline));
 
         SAIL_TRY(hdr_private_write_scanline(hdr_codec_state->io, hdr_codec_state->header.width, scanline,
                                             hdr_codec_state->write_ctx.use_rle));
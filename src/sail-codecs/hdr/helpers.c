@@ -52,21 +52,22 @@ bool hdr_private_is_hdr(const void* data, size_t size)
     return false;
 }
 
-static sail_status_t read_line(struct sail_io* io, char* buffer, size_t buffer_size)
+static sail_status_t read_line(struct sail_buffered_reader* reader, char* buffer, size_t buffer_size)
 {
     size_t pos = 0;
-    char ch;
+    unsigned char ch;
 
     while (pos < buffer_size - 1)
     {
-        size_t bytes_read;
-        SAIL_TRY(io->tolerant_read(io->stream, &ch, 1, &bytes_read));
+        const sail_status_t status = sail_buffered_reader_get_byte(reader, &ch);
 
-        if (bytes_read == 0)
+        if (status == SAIL_ERROR_EOF)
         {
             break;
         }
 
+        SAIL_TRY(status);
+
         if (ch == '\n')
         {
             break;
@@ -74,7 +75,7 @@ static sail_status_t read_line(struct sail_io* io, char* buffer, size_t buffer_s
 
         if (ch != '\r')
         {
-            buffer[pos++] = ch;
+            buffer[pos++] = (char)ch;
         }
     }
 
@@ -83,7 +84,7 @@ static sail_status_t read_line(struct sail_io* io, char* buffer, size_t buffer_s
     return SAIL_OK;
 }
 
-sail_status_t hdr_private_read_header(struct sail_io* io, struct hdr_header* header)
+sail_status_t hdr_private_read_header(struct sail_buffered_reader* reader, struct hdr_header* header)
 {
     char line[1024];
 
@@ -96,7 +97,7 @@ sail_status_t hdr_private_read_header(struct sail_io* io, struct hdr_header* hea
     header->colorcorr[2] = 1.0f;
 
     /* Read and verify signature. */
-    SAIL_TRY(read_line(io, line, sizeof(line)));
+    SAIL_TRY(read_line(reader, line, sizeof(line)));
 
     if (strncmp(line, "#?RADIANCE", 10) != 0 && strncmp(line, "#?RGBE", 6) != 0)
     {
@@ -107,7 +108,7 @@ sail_status_t hdr_private_read_header(struct sail_io* io, struct hdr_header* hea
     /* Read header lines until we find the empty line. */
     while (true)
     {
-        SAIL_TRY(read_line(io, line, sizeof(line)));
+        SAIL_TRY(read_line(reader, line, sizeof(line)));
 
         /* Empty line marks end of header, resolution line follows. */
         if (line[0] == '\0')
@@ -156,7 +157,7 @@ sail_status_t hdr_private_read_header(struct sail_io* io, struct hdr_header* hea
     }
 
     /* Read dimensions (e.g., "-Y 512 +X 768"). */
-    SAIL_TRY(read_line(io, line, sizeof(line)));
+    SAIL_TRY(read_line(reader, line, sizeof(line)));
 
     char y_sign, x_sign;
     char y_axis, x_axis;
@@ -318,7 +319,14 @@ void hdr_private_float_to_rgbe(const float* rgb, uint8_t* rgbe)
     rgbe[3] = (uint8_t)(exponent + 128);
 }
 
-static sail_status_t read_old_rle_scanline(struct sail_io* io, int width, uint8_t* scanline)
+/*
+ * Reads an old RLE scanline. 'first_rgbe' is the already read first pixel or NULL. Passing it
+ * instead of seeking back keeps the decoder working on non-seekable I/O objects.
+ */
+static sail_status_t read_old_rle_scanline(struct sail_buffered_reader* reader,
+                                           int width,
+                                           const uint8_t* first_rgbe,
+                                           uint8_t* scanline)
 {
     uint8_t rgbe[4];
     int rshift = 0;
@@ -326,12 +334,14 @@ static sail_status_t read_old_rle_scanline(struct sail_io* io, int width, uint8_
 
     while (pos < width)
     {
-        size_t bytes_read;
-        SAIL_TRY(io->tolerant_read(io->stream, rgbe, 4, &bytes_read));
-
-        if (bytes_read != 4)
+        if (first_rgbe != NULL)
+        {
+            memcpy(rgbe, first_rgbe, 4);
+            first_rgbe = NULL;
+        }
+        else
         {
-            SAIL_LOG_AND_RETURN(SAIL_ERROR_INVALID_IMAGE);
+            SAIL_TRY(sail_buffered_reader_read(reader, rgbe, 4));
         }
 
         if (rgbe[0] == 1 && rgbe[1] == 1 && rgbe[2] == 1)
@@ -368,29 +378,22 @@ static sail_status_t read_old_rle_scanline(struct sail_io* io, int width, uint8_
     return SAIL_OK;
 }
 
-static sail_status_t read_new_rle_scanline(struct sail_io* io, int width, uint8_t* scanline)
+static sail_status_t read_new_rle_scanline(struct sail_buffered_reader* reader, int width, uint8_t* scanline)
 {
     if (width < 8 || width > 32767)
     {
-        return read_old_rle_scanline(io, width, scanline);
+        return read_old_rle_scanline(reader, width, NULL, scanline);
     }
 
     /* Read RLE header. */
     uint8_t header[4];
-    size_t bytes_read;
-    SAIL_TRY(io->tolerant_read(io->stream, header, 4, &bytes_read));
-
-    if (bytes_read != 4)
-    {
-        SAIL_LOG_AND_RETURN(SAIL_ERROR_INVALID_IMAGE);
-    }
+    SAIL_TRY(sail_buffered_reader_read(reader, header, 4));
 
     /* Check for new RLE format. */
     if (header[0] != 2 || header[1] != 2 || (header[2] & 0x80))
     {
-        /* Old format - seek back and read as old RLE. */
-        SAIL_TRY(io->seek(io->stream, -4, SEEK_CUR));
-        return read_old_rle_scanline(io, width, scanline);
+        /* Old format - the header is the first pixel. */
+        return read_old_rle_scanline(reader, width, header, scanline);
     }
 
     /* Decode width from header. */
@@ -410,12 +413,7 @@ static sail_status_t read_new_rle_scanline(struct sail_io* io, int width, uint8_
         while (pos < width)
         {
             uint8_t code;
-            SAIL_TRY(io->tolerant_read(io->stream, &code, 1, &bytes_read));
-
-            if (bytes_read != 1)
-            {
-                SAIL_LOG_AND_RETURN(SAIL_ERROR_INVALID_IMAGE);
-            }
+            SAIL_TRY(sail_buffered_reader_get_byte(reader, &code));
 
             if (code > 128)
             {
@@ -427,12 +425,7 @@ static sail_status_t read_new_rle_scanline(struct sail_io* io, int width, uint8_
                     SAIL_LOG_AND_RETURN(SAIL_ERROR_INVALID_IMAGE);
                 }
                 uint8_t value;
-                SAIL_TRY(io->tolerant_read(io->stream, &value, 1, &bytes_read));
-
-                if (bytes_read != 1)
-                {
-                    SAIL_LOG_AND_RETURN(SAIL_ERROR_INVALID_IMAGE);
-                }
+                SAIL_TRY(sail_buffered_reader_get_byte(reader, &value));
 
                 for (int i = 0; i < count; i++)
                 {
@@ -461,12 +454,7 @@ static sail_status_t read_new_rle_scanline(struct sail_io* io, int width, uint8_
                     }
 
                     uint8_t value;
-                    SAIL_TRY(io->tolerant_read(io->stream, &value, 1, &bytes_read));
-
-                    if (bytes_read != 1)
-                    {
-                        SAIL_LOG_AND_RETURN(SAIL_ERROR_INVALID_IMAGE);
-                    }
+                    SAIL_TRY(sail_buffered_reader_get_byte(reader, &value));
 
                     scanline[pos * 4 + channel] = value;
                     pos++;
@@ -478,7 +466,7 @@ static sail_status_t read_new_rle_scanline(struct sail_io* io, int width, uint8_
     return SAIL_OK;
 }
 
-sail_status_t hdr_private_read_scanline(struct sail_io* io, int width, float* scanline)
+sail_status_t hdr_private_read_scanline(struct sail_buffered_reader* reader, int width, float* scanline)
 {
     uint8_t* rgbe_scanline = NULL;
     void* ptr;
@@ -494,7 +482,7 @@ sail_status_t hdr_private_read_scanline(struct sail_io* io, int width, float* sc
     SAIL_TRY(sail_malloc(rgbe_scanline_size, &ptr));
     rgbe_scanline = ptr;
 
-    sail_status_t status = read_new_rle_scanline(io, width, rgbe_scanline);
+    sail_status_t status = read_new_rle_scanline(reader, width, rgbe_scanline);
 
     if (status != SAIL_OK)
     {
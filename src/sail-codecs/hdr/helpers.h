@@ -33,6 +33,7 @@
 #include <sail-common/export.h>
 #include <sail-common/status.h>
 
+struct sail_buffered_reader;
 struct sail_io;
 struct sail_hash_map;
 struct sail_meta_data_node;
@@ -62,13 +63,13 @@ struct hdr_write_context
 
 SAIL_HIDDEN bool hdr_private_is_hdr(const void* data, size_t size);
 
-SAIL_HIDDEN sail_status_t hdr_private_read_header(struct sail_io* io, struct hdr_header* header);
+SAIL_HIDDEN sail_status_t hdr_private_read_header(struct sail_buffered_reader* reader, struct hdr_header* header);
 
 SAIL_HIDDEN sail_status_t hdr_private_write_header(struct sail_io* io,
                                                    const struct hdr_header* header,
                                                    const struct sail_meta_data_node* meta_data_node);
 
-SAIL_HIDDEN sail_status_t hdr_private_read_scanline(struct sail_io* io, int width, float* scanline);
+SAIL_HIDDEN sail_status_t hdr_private_read_scanline(struct sail_buffered_reader* reader, int width, float* scanline);
 
 SAIL_HIDDEN sail_status_t hdr_private_write_scanline(struct sail_io* io,
                                                      int width,
@@ -53,6 +53,11 @@ struct heif_state
 
     struct heif_context* heif_context;
     struct heif_image_handle** image_handles;
+    /*
+     * Thumbnails decoded instead of the images with SAIL_OPTION_THUMBNAIL when they cover the size hint.
+     * NULL entries mean no thumbnail.
+     */
+    struct heif_image_handle** thumbnail_handles;
     int num_images;
     int current_image;
 
@@ -79,21 +84,22 @@ static sail_status_t alloc_heif_state(struct sail_io* io,
     *heif_state = ptr;
 
     **heif_state = (struct heif_state){
-        .io               = io,
-        .load_options     = load_options,
-        .save_options     = save_options,
-        .heif_context     = NULL,
-        .image_handles    = NULL,
-        .num_images       = 0,
-        .current_image    = -1,
-        .reader_context   = {.io = NULL, .buffer = NULL, .buffer_size = 0},
-        .reader           = {0},
-        .encoder          = NULL,
-        .encoding_options = NULL,
-        .writer_context   = {.io = NULL},
-        .writer           = {0},
-        .frames_saved     = 0,
-        .threads          = 1,
+        .io                = io,
+        .load_options      = load_options,
+        .save_options      = save_options,
+        .heif_context      = NULL,
+        .image_handles     = NULL,
+        .thumbnail_handles = NULL,
+        .num_images        = 0,
+        .current_image     = -1,
+        .reader_context    = {.io = NULL, .buffer = NULL, .buffer_size = 0},
+        .reader            = {0},
+        .encoder           = NULL,
+        .encoding_options  = NULL,
+        .writer_context    = {.io = NULL},
+        .writer            = {0},
+        .frames_saved      = 0,
+        .threads           = 1,
     };
 
     return SAIL_OK;
@@ -118,6 +124,18 @@ static void destroy_heif_state(struct heif_state* heif_state)
         sail_free(heif_state->image_handles);
     }
 
+    if (heif_state->thumbnail_handles != NULL)
+    {
+        for (int i = 0; i < heif_state->num_images; i++)
+        {
+            if (heif_state->thumbnail_handles[i] != NULL)
+            {
+                heif_image_handle_release(heif_state->thumbnail_handles[i]);
+            }
+        }
+        sail_free(heif_state->thumbnail_handles);
+    }
+
     if (heif_state->encoder != NULL)
     {
         heif_encoder_release(heif_state->encoder);
@@ -195,12 +213,22 @@ SAIL_EXPORT sail_status_t sail_codec_load_init_v8_heif(struct sail_io* io,
         return SAIL_ERROR_NO_MORE_FRAMES;
     }
 
+    /* Probing reports the first image only. Don't fetch handles of the others. */
+    if (heif_state->load_options->options & SAIL_OPTION_PROBE)
+    {
+        heif_state->num_images = 1;
+    }
+
     /* Allocate array for image handles. */
     void* ptr;
     SAIL_TRY(sail_malloc(heif_state->num_images * sizeof(struct heif_image_handle*), &ptr));
     heif_state->image_handles = ptr;
     memset(heif_state->image_handles, 0, heif_state->num_images * sizeof(struct heif_image_handle*));
 
+    SAIL_TRY(sail_malloc(heif_state->num_images * sizeof(struct heif_image_handle*), &ptr));
+    heif_state->thumbnail_handles = ptr;
+    memset(heif_state->thumbnail_handles, 0, heif_state->num_images * sizeof(struct heif_image_handle*));
+
     /* Get all top-level image IDs. */
     heif_item_id* image_ids;
     SAIL_TRY(sail_malloc(heif_state->num_images * sizeof(heif_item_id), &ptr));
@@ -219,6 +247,10 @@ SAIL_EXPORT sail_status_t sail_codec_load_init_v8_heif(struct sail_io* io,
             SAIL_LOG_ERROR("HEIF: Failed to get image handle #%d: %s", i, error.message);
             SAIL_LOG_AND_RETURN(heif_private_heif_error_to_sail_status(&error));
         }
+
+        SAIL_TRY_OR_CLEANUP(heif_private_find_thumbnail(heif_state->image_handles[i], heif_state->load_options,
+                                                        &heif_state->thumbnail_handles[i]),
+                            /* cleanup */ sail_free(image_ids));
     }
 
     sail_free(image_ids);
@@ -230,6 +262,15 @@ SAIL_EXPORT sail_status_t sail_codec_load_seek_next_frame_v8_heif(void* state, s
 {
     struct heif_state* heif_state = state;
 
+    /* Resume at the recorded top-level image. */
+    unsigned resume_frame;
+    const struct sail_frame_index_entry* resume_entry;
+
+    if (sail_take_frame_to_resume(heif_state->load_options, &resume_frame, &resume_entry))
+    {
+        heif_state->current_image = (int)resume_entry->offset - 1;
+    }
+
     heif_state->current_image++;
 
     if (heif_state->current_image >= heif_state->num_images)
@@ -237,14 +278,30 @@ SAIL_EXPORT sail_status_t sail_codec_load_seek_next_frame_v8_heif(void* state, s
         return SAIL_ERROR_NO_MORE_FRAMES;
     }
 
-    struct heif_image_handle* handle = heif_state->image_handles[heif_state->current_image];
+    /* The embedded preview is loaded instead of the frames. */
+    if (heif_state->current_image > 0 && (heif_state->load_options->options & SAIL_OPTION_THUMBNAIL)
+        && heif_state->thumbnail_handles[0] != NULL)
+    {
+        return SAIL_ERROR_NO_MORE_FRAMES;
+    }
+
+    struct heif_image_handle* handle           = heif_state->image_handles[heif_state->current_image];
+    struct heif_image_handle* thumbnail_handle = heif_state->thumbnail_handles[heif_state->current_image];
 
     struct sail_image* image_local;
     SAIL_TRY(sail_alloc_image(&image_local));
 
     /* Get image dimensions. */
-    image_local->width  = heif_image_handle_get_width(handle);
-    image_local->height = heif_image_handle_get_height(handle);
+    if (thumbnail_handle != NULL)
+    {
+        image_local->width  = heif_image_handle_get_width(thumbnail_handle);
+        image_local->height = heif_image_handle_get_height(thumbnail_handle);
+    }
+    else
+    {
+        image_local->width  = heif_image_handle_get_width(handle);
+        image_local->height = heif_image_handle_get_height(handle);
+    }
 
     /* Determine pixel format. */
     int has_alpha      = heif_image_handle_has_alpha_channel(handle);
@@ -276,6 +333,8 @@ SAIL_EXPORT sail_status_t sail_codec_load_seek_next_frame_v8_heif(void* state, s
         image_local->source_image->pixel_format = heif_private_sail_pixel_format_from_heif(
             heif_chroma_interleaved_RGB, heif_channel_interleaved, bits_per_pixel);
         image_local->source_image->compression = SAIL_COMPRESSION_HEVC;
+        image_local->source_image->width       = heif_image_handle_get_width(handle);
+        image_local->source_image->height      = heif_image_handle_get_height(handle);
     }
 
     /* Fetch ICC profile. */
@@ -311,6 +370,11 @@ SAIL_EXPORT sail_status_t sail_codec_load_seek_next_frame_v8_heif(void* state, s
                             /* cleanup */ sail_destroy_image(image_local));
     }
 
+    /* Every top-level image is independent. */
+    SAIL_TRY_OR_CLEANUP(sail_record_frame(heif_state->load_options, (size_t)heif_state->current_image,
+                                          /* keyframe */ true, 0, NULL, 0),
+                        /* cleanup */ sail_destroy_image(image_local));
+
     *image = image_local;
 
     return SAIL_OK;
@@ -348,7 +412,12 @@ SAIL_EXPORT sail_status_t sail_codec_load_frame_v8_heif(void* state, struct sail
         chroma = (bits_per_pixel <= 8) ? heif_chroma_interleaved_RGB : heif_chroma_interleaved_RRGGBB_BE;
     }
 
-    struct heif_error error = heif_decode_image(handle, &heif_image, heif_colorspace_RGB, chroma, NULL);
+    /* Thumbnails are converted to the pixel format of their images. */
+    struct heif_image_handle* decode_handle = (heif_state->thumbnail_handles[heif_state->current_image] != NULL)
+                                                  ? heif_state->thumbnail_handles[heif_state->current_image]
+                                                  : handle;
+
+    struct heif_error error = heif_decode_image(decode_handle, &heif_image, heif_colorspace_RGB, chroma, NULL);
 
     if (error.code != heif_error_Ok)
     {
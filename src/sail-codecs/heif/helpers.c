@@ -408,6 +408,73 @@ sail_status_t heif_private_fetch_thumbnail_info(const struct heif_image_handle*
     return SAIL_OK;
 }
 
+sail_status_t heif_private_find_thumbnail(const struct heif_image_handle* image_handle,
+                                          const struct sail_load_options* load_options,
+                                          struct heif_image_handle** thumbnail_handle)
+{
+    SAIL_CHECK_PTR(image_handle);
+    SAIL_CHECK_PTR(thumbnail_handle);
+
+    *thumbnail_handle = NULL;
+
+    /* Thumbnails replace the images only when they're explicitly requested. */
+    if (load_options == NULL || !(load_options->options & SAIL_OPTION_THUMBNAIL))
+    {
+        return SAIL_OK;
+    }
+
+    const int thumbnail_count = heif_image_handle_get_number_of_thumbnails(image_handle);
+
+    if (thumbnail_count <= 0)
+    {
+        return SAIL_OK;
+    }
+
+    void* ptr;
+    SAIL_TRY(sail_malloc((size_t)thumbnail_count * sizeof(heif_item_id), &ptr));
+    heif_item_id* thumbnail_ids = ptr;
+
+    heif_image_handle_get_list_of_thumbnail_IDs(image_handle, thumbnail_ids, thumbnail_count);
+
+    for (int i = 0; i < thumbnail_count; i++)
+    {
+        struct heif_image_handle* candidate;
+        struct heif_error error = heif_image_handle_get_thumbnail(image_handle, thumbnail_ids[i], &candidate);
+
+        if (error.code != heif_error_Ok)
+        {
+            SAIL_LOG_WARNING("HEIF: Failed to get thumbnail #%d: %s", i, error.message);
+            continue;
+        }
+
+        const unsigned width  = (unsigned)heif_image_handle_get_width(candidate);
+        const unsigned height = (unsigned)heif_image_handle_get_height(candidate);
+
+        const bool covers  = width >= load_options->max_width && height >= load_options->max_height;
+        const bool smaller = *thumbnail_handle == NULL
+                             || (uint64_t)width * height < (uint64_t)heif_image_handle_get_width(*thumbnail_handle)
+                                                               * heif_image_handle_get_height(*thumbnail_handle);
+
+        if (covers && smaller)
+        {
+            if (*thumbnail_handle != NULL)
+            {
+                heif_image_handle_release(*thumbnail_handle);
+            }
+
+            *thumbnail_handle = candidate;
+        }
+        else
+        {
+            heif_image_handle_release(candidate);
+        }
+    }
+
+    sail_free(thumbnail_ids);
+
+    return SAIL_OK;
+}
+
 sail_status_t heif_private_fetch_primary_flag(const struct heif_image_handle* image_handle,
                                               struct sail_hash_map* special_properties)
 {
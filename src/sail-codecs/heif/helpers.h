@@ -40,6 +40,7 @@ struct heif_image;
 struct heif_image_handle;
 struct sail_hash_map;
 struct sail_iccp;
+struct sail_load_options;
 struct sail_meta_data_node;
 struct sail_variant;
 
@@ -77,6 +78,14 @@ SAIL_HIDDEN sail_status_t heif_private_fetch_depth_info(const struct heif_image_
 SAIL_HIDDEN sail_status_t heif_private_fetch_thumbnail_info(const struct heif_image_handle* image_handle,
                                                             struct sail_hash_map* special_properties);
 
+/*
+ * Finds the smallest thumbnail that still covers the size hint in the load options.
+ * Assigns NULL when no thumbnail covers it, or when the load options have no SAIL_OPTION_THUMBNAIL.
+ */
+SAIL_HIDDEN sail_status_t heif_private_find_thumbnail(const struct heif_image_handle* image_handle,
+                                                      const struct sail_load_options* load_options,
+                                                      struct heif_image_handle** thumbnail_handle);
+
 SAIL_HIDDEN sail_status_t heif_private_fetch_primary_flag(const struct heif_image_handle* image_handle,
                                                           struct sail_hash_map* special_properties);
 
@@ -155,6 +155,21 @@ SAIL_EXPORT sail_status_t sail_codec_load_seek_next_frame_v8_ico(void* state, st
 {
     struct ico_state* ico_state = state;
 
+    /* The previous frame was skipped without reading it. */
+    if (ico_state->common_bmp_state != NULL)
+    {
+        SAIL_TRY(bmp_private_read_finish(&ico_state->common_bmp_state, ico_state->io));
+    }
+
+    /* Resume at the recorded directory entry. */
+    unsigned resume_frame;
+    const struct sail_frame_index_entry* resume_entry;
+
+    if (sail_take_frame_to_resume(ico_state->load_options, &resume_frame, &resume_entry))
+    {
+        ico_state->current_frame = (unsigned)resume_entry->offset;
+    }
+
     /* Skip non-BMP images. */
     enum SailIcoImageType ico_image_type;
 
@@ -173,6 +188,9 @@ SAIL_EXPORT sail_status_t sail_codec_load_seek_next_frame_v8_ico(void* state, st
         SAIL_TRY(ico_private_probe_image_type(ico_state->io, &ico_image_type));
     } while (ico_image_type != SAIL_ICO_IMAGE_BMP);
 
+    /* Every frame is independent. */
+    SAIL_TRY(sail_record_frame(ico_state->load_options, ico_state->current_frame - 1, /* keyframe */ true, 0, NULL, 0));
+
     /* Continue to loading BMP. */
     struct sail_image* image_local;
 
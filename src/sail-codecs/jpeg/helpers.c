@@ -167,16 +167,184 @@ sail_status_t jpeg_private_fetch_iccp(struct jpeg_decompress_struct* decompress_
     SAIL_LOG_TRACE("JPEG: ICC profile is %sfound",
                    jpeg_read_icc_profile(decompress_context, &data, &data_size) ? "" : "not ");
 
+    /* libjpeg allocates the profile with malloc(), so copy it into memory owned by SAIL. */
     if (data != NULL && data_size > 0)
     {
-        SAIL_TRY_OR_CLEANUP(sail_alloc_iccp_from_shallow_data(data, data_size, iccp),
-                            /* cleanup */ sail_free(data));
+        SAIL_TRY_OR_CLEANUP(sail_alloc_iccp_from_data(data, data_size, iccp),
+                            /* cleanup */ free(data));
     }
 
+    free(data);
+
     return SAIL_OK;
 }
 #endif
 
+static unsigned exif_read_u16(const JOCTET* data, bool big_endian)
+{
+    return big_endian ? (unsigned)((data[0] << 8) | data[1]) : (unsigned)((data[1] << 8) | data[0]);
+}
+
+static unsigned exif_read_u32(const JOCTET* data, bool big_endian)
+{
+    return big_endian ? ((unsigned)data[0] << 24) | ((unsigned)data[1] << 16) | ((unsigned)data[2] << 8) | data[3]
+                      : ((unsigned)data[3] << 24) | ((unsigned)data[2] << 16) | ((unsigned)data[1] << 8) | data[0];
+}
+
+/* Reads the dimensions from the first SOF marker of the JPEG stream. */
+static bool jpeg_stream_dimensions(const JOCTET* data, unsigned data_length, unsigned* width, unsigned* height)
+{
+    if (data_length < 4 || data[0] != 0xFF || data[1] != 0xD8)
+    {
+        return false;
+    }
+
+    unsigned offset = 2;
+
+    while (offset + 4 <= data_length)
+    {
+        if (data[offset] != 0xFF)
+        {
+            return false;
+        }
+
+        const unsigned marker = data[offset + 1];
+
+        if (marker == 0xFF)
+        {
+            offset++;
+            continue;
+        }
+
+        const unsigned length = exif_read_u16(data + offset + 2, true);
+
+        /* SOF0..SOF15 except DHT, JPG, and DAC. */
+        if (marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC)
+        {
+            if (length < 7 || offset + 2 + 7 > data_length)
+            {
+                return false;
+            }
+
+            *height = exif_read_u16(data + offset + 5, true);
+            *width  = exif_read_u16(data + offset + 7, true);
+
+            return *width > 0 && *height > 0;
+        }
+
+        if (marker == 0xD9 || marker == 0xDA || length < 2)
+        {
+            return false;
+        }
+
+        offset += 2 + length;
+    }
+
+    return false;
+}
+
+bool jpeg_private_find_exif_thumbnail(struct jpeg_decompress_struct* decompress_context,
+                                      const JOCTET** data,
+                                      unsigned* data_length,
+                                      unsigned* width,
+                                      unsigned* height)
+{
+    static const JOCTET EXIF_SIGNATURE[] = {'E', 'x', 'i', 'f', 0, 0};
+
+    for (jpeg_saved_marker_ptr it = decompress_context->marker_list; it != NULL; it = it->next)
+    {
+        if (it->marker != JPEG_APP0 + 1 || it->data_length < sizeof(EXIF_SIGNATURE) + 8
+            || memcmp(it->data, EXIF_SIGNATURE, sizeof(EXIF_SIGNATURE)) != 0)
+        {
+            continue;
+        }
+
+        /* Offsets in EXIF are relative to the TIFF header. */
+        const JOCTET* tiff       = it->data + sizeof(EXIF_SIGNATURE);
+        const unsigned tiff_size = it->data_length - (unsigned)sizeof(EXIF_SIGNATURE);
+        bool big_endian;
+
+        if (tiff[0] == 'M' && tiff[1] == 'M')
+        {
+            big_endian = true;
+        }
+        else if (tiff[0] == 'I' && tiff[1] == 'I')
+        {
+            big_endian = false;
+        }
+        else
+        {
+            continue;
+        }
+
+        /* Skip IFD0 to get to IFD1 that describes the thumbnail. */
+        unsigned ifd_offset = exif_read_u32(tiff + 4, big_endian);
+
+        if (ifd_offset > tiff_size - 2)
+        {
+            continue;
+        }
+
+        unsigned entries = exif_read_u16(tiff + ifd_offset, big_endian);
+
+        if (entries > (tiff_size - ifd_offset - 2) / 12 || ifd_offset + 2 + entries * 12 + 4 > tiff_size)
+        {
+            continue;
+        }
+
+        ifd_offset = exif_read_u32(tiff + ifd_offset + 2 + entries * 12, big_endian);
+
+        if (ifd_offset == 0 || ifd_offset > tiff_size - 2)
+        {
+            continue;
+        }
+
+        entries = exif_read_u16(tiff + ifd_offset, big_endian);
+
+        if (entries > (tiff_size - ifd_offset - 2) / 12)
+        {
+            continue;
+        }
+
+        unsigned thumbnail_offset = 0;
+        unsigned thumbnail_length = 0;
+
+        for (unsigned i = 0; i < entries; i++)
+        {
+            const JOCTET* entry = tiff + ifd_offset + 2 + i * 12;
+            const unsigned tag  = exif_read_u16(entry, big_endian);
+
+            /* JPEGInterchangeFormat and JPEGInterchangeFormatLength are LONGs. */
+            if (tag == 0x0201)
+            {
+                thumbnail_offset = exif_read_u32(entry + 8, big_endian);
+            }
+            else if (tag == 0x0202)
+            {
+                thumbnail_length = exif_read_u32(entry + 8, big_endian);
+            }
+        }
+
+        if (thumbnail_offset == 0 || thumbnail_length == 0 || thumbnail_offset > tiff_size
+            || thumbnail_length > tiff_size - thumbnail_offset)
+        {
+            continue;
+        }
+
+        if (!jpeg_stream_dimensions(tiff + thumbnail_offset, thumbnail_length, width, height))
+        {
+            continue;
+        }
+
+        *data        = tiff + thumbnail_offset;
+        *data_length = thumbnail_length;
+
+        return true;
+    }
+
+    return false;
+}
+
 sail_status_t jpeg_private_fetch_resolution(struct jpeg_decompress_struct* decompress_context,
                                             struct sail_resolution** resolution)
 {
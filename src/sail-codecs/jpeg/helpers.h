@@ -62,6 +62,16 @@ SAIL_HIDDEN sail_status_t jpeg_private_fetch_iccp(struct jpeg_decompress_struct*
                                                   struct sail_iccp** iccp);
 #endif
 
+/*
+ * Finds the JPEG thumbnail embedded into the saved EXIF APP1 marker and parses its dimensions.
+ * Returns false when there is no such thumbnail or it's malformed.
+ */
+SAIL_HIDDEN bool jpeg_private_find_exif_thumbnail(struct jpeg_decompress_struct* decompress_context,
+                                                  const JOCTET** data,
+                                                  unsigned* data_length,
+                                                  unsigned* width,
+                                                  unsigned* height);
+
 SAIL_HIDDEN sail_status_t jpeg_private_fetch_resolution(struct jpeg_decompress_struct* decompress_context,
                                                         struct sail_resolution** resolution);
 
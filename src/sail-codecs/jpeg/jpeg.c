@@ -60,6 +60,18 @@ struct jpeg_state
     bool libjpeg_error;
     bool frame_processed;
     bool started_compress;
+
+    /* Region of interest. Scan lines are decoded into crop_scanline when they're wider than the region. */
+    unsigned crop_y;
+    unsigned crop_width;
+    unsigned crop_height;
+    unsigned crop_column;
+    JSAMPROW crop_scanline;
+
+    /* Embedded EXIF thumbnail loaded instead of the main image, and the main image dimensions. */
+    JOCTET* thumbnail_data;
+    unsigned source_width;
+    unsigned source_height;
 };
 
 static sail_status_t alloc_jpeg_state(const struct sail_load_options* load_options,
@@ -79,6 +91,16 @@ static sail_status_t alloc_jpeg_state(const struct sail_load_options* load_optio
         .libjpeg_error      = false,
         .frame_processed    = false,
         .started_compress   = false,
+
+        .crop_y        = 0,
+        .crop_width    = 0,
+        .crop_height   = 0,
+        .crop_column   = 0,
+        .crop_scanline = NULL,
+
+        .thumbnail_data = NULL,
+        .source_width   = 0,
+        .source_height  = 0,
     };
 
     return SAIL_OK;
@@ -94,6 +116,10 @@ static void destroy_jpeg_state(struct jpeg_state* jpeg_state)
     sail_free(jpeg_state->decompress_context);
     sail_free(jpeg_state->compress_context);
 
+    sail_free(jpeg_state->crop_scanline);
+
+    sail_free(jpeg_state->thumbnail_data);
+
     sail_free(jpeg_state);
 }
 
@@ -140,9 +166,48 @@ SAIL_EXPORT sail_status_t sail_codec_load_init_v8_jpeg(struct sail_io* io,
     {
         jpeg_save_markers(jpeg_state->decompress_context, JPEG_APP0 + 2, 0xFFFF);
     }
+#ifdef SAIL_HAVE_JPEG_MEM_SRC
+    if (jpeg_state->load_options->options & SAIL_OPTION_THUMBNAIL)
+    {
+        jpeg_save_markers(jpeg_state->decompress_context, JPEG_APP0 + 1, 0xFFFF);
+    }
+#endif
 
     jpeg_read_header(jpeg_state->decompress_context, true);
 
+    jpeg_state->source_width  = jpeg_state->decompress_context->image_width;
+    jpeg_state->source_height = jpeg_state->decompress_context->image_height;
+
+#ifdef SAIL_HAVE_JPEG_MEM_SRC
+    /*
+     * Switch to the EXIF thumbnail when it still covers the requested size. The thumbnail
+     * is decoded from a copy as the saved markers die with the main image context.
+     */
+    if (jpeg_state->load_options->options & SAIL_OPTION_THUMBNAIL)
+    {
+        const JOCTET* thumbnail_data;
+        unsigned thumbnail_data_length;
+        unsigned thumbnail_width;
+        unsigned thumbnail_height;
+
+        if (jpeg_private_find_exif_thumbnail(jpeg_state->decompress_context, &thumbnail_data, &thumbnail_data_length,
+                                             &thumbnail_width, &thumbnail_height)
+            && thumbnail_width >= jpeg_state->load_options->max_width
+            && thumbnail_height >= jpeg_state->load_options->max_height
+            && (thumbnail_width < jpeg_state->source_width || thumbnail_height < jpeg_state->source_height))
+        {
+            SAIL_TRY(sail_memdup(thumbnail_data, thumbnail_data_length, &ptr));
+            jpeg_state->thumbnail_data = ptr;
+
+            jpeg_destroy_decompress(jpeg_state->decompress_context);
+            jpeg_create_decompress(jpeg_state->decompress_context);
+            jpeg_mem_src(jpeg_state->decompress_context, jpeg_state->thumbnail_data, thumbnail_data_length);
+
+            jpeg_read_header(jpeg_state->decompress_context, true);
+        }
+    }
+#endif
+
     /* Handle the requested color space. */
     if (jpeg_state->decompress_context->jpeg_color_space == JCS_YCbCr)
     {
@@ -156,9 +221,67 @@ SAIL_EXPORT sail_status_t sail_codec_load_init_v8_jpeg(struct sail_io* io,
     /* We don't want colormapped output. */
     jpeg_state->decompress_context->quantize_colors = false;
 
+    /* Decode at the cheapest DCT scale that still covers the requested size. */
+    jpeg_state->decompress_context->scale_num   = 1;
+    jpeg_state->decompress_context->scale_denom = sail_reduction_from_load_options(
+        jpeg_state->load_options, jpeg_state->decompress_context->image_width,
+        jpeg_state->decompress_context->image_height, 8);
+
+    /*
+     * Probing needs just the output dimensions. Compute them without allocating
+     * the whole decompression pipeline.
+     */
+    if (jpeg_state->load_options->options & SAIL_OPTION_PROBE)
+    {
+        jpeg_calc_output_dimensions(jpeg_state->decompress_context);
+
+        unsigned crop_x;
+        SAIL_TRY(sail_crop_rectangle_from_load_options(
+            jpeg_state->load_options, jpeg_state->decompress_context->output_width,
+            jpeg_state->decompress_context->output_height, &crop_x, &jpeg_state->crop_y, &jpeg_state->crop_width,
+            &jpeg_state->crop_height));
+
+        return SAIL_OK;
+    }
+
     /* Launch decompression! */
     jpeg_start_decompress(jpeg_state->decompress_context);
 
+    unsigned crop_x;
+    SAIL_TRY(sail_crop_rectangle_from_load_options(
+        jpeg_state->load_options, jpeg_state->decompress_context->output_width,
+        jpeg_state->decompress_context->output_height, &crop_x, &jpeg_state->crop_y, &jpeg_state->crop_width,
+        &jpeg_state->crop_height));
+
+#ifdef SAIL_HAVE_JPEG_CROP
+    /*
+     * libjpeg-turbo decodes just the iMCU columns covering the region. Fancy upsampling needs
+     * neighbor samples, so the region is extended by one iMCU on both sides to decode its edges
+     * exactly like a full decode does.
+     */
+    if (jpeg_state->crop_width != jpeg_state->decompress_context->output_width)
+    {
+        const unsigned imcu_width = (unsigned)(jpeg_state->decompress_context->max_h_samp_factor
+                                               * jpeg_state->decompress_context->min_DCT_scaled_size);
+        const unsigned output_width = jpeg_state->decompress_context->output_width;
+        const unsigned left         = (crop_x > imcu_width) ? crop_x - imcu_width : 0;
+        const unsigned right        = (output_width - (crop_x + jpeg_state->crop_width) > imcu_width)
+                                          ? crop_x + jpeg_state->crop_width + imcu_width
+                                          : output_width;
+
+        JDIMENSION xoffset = left;
+        JDIMENSION width   = right - left;
+
+        jpeg_crop_scanline(jpeg_state->decompress_context, &xoffset, &width);
+
+        jpeg_state->crop_column = crop_x - xoffset;
+
+        void* ptr;
+        SAIL_TRY(sail_malloc((size_t)width * jpeg_state->decompress_context->output_components, &ptr));
+        jpeg_state->crop_scanline = ptr;
+    }
+#endif
+
     return SAIL_OK;
 }
 
@@ -190,11 +313,13 @@ SAIL_EXPORT sail_status_t sail_codec_load_seek_next_frame_v8_jpeg(void* state, s
         image_local->source_image->pixel_format =
             jpeg_private_color_space_to_pixel_format(jpeg_state->decompress_context->jpeg_color_space);
         image_local->source_image->compression = SAIL_COMPRESSION_JPEG;
+        image_local->source_image->width       = jpeg_state->source_width;
+        image_local->source_image->height      = jpeg_state->source_height;
     }
 
     /* Image properties. */
-    image_local->width  = jpeg_state->decompress_context->output_width;
-    image_local->height = jpeg_state->decompress_context->output_height;
+    image_local->width  = jpeg_state->crop_width;
+    image_local->height = jpeg_state->crop_height;
     image_local->pixel_format =
         jpeg_private_color_space_to_pixel_format(jpeg_state->decompress_context->out_color_space);
     image_local->bytes_per_line = sail_bytes_per_line(image_local->width, image_local->pixel_format);
@@ -239,12 +364,32 @@ SAIL_EXPORT sail_status_t sail_codec_load_frame_v8_jpeg(void* state, struct sail
         SAIL_LOG_AND_RETURN(SAIL_ERROR_UNDERLYING_CODEC);
     }
 
+#ifdef SAIL_HAVE_JPEG_CROP
+    if (jpeg_state->crop_y > 0)
+    {
+        (void)jpeg_skip_scanlines(jpeg_state->decompress_context, jpeg_state->crop_y);
+    }
+#endif
+
     for (unsigned row = 0; row < image->height; row++)
     {
-        unsigned char* scanline = sail_scan_line(image, row);
+        void* scanline;
+        SAIL_TRY(sail_load_scan_line(jpeg_state->load_options, image, row, &scanline));
+
+        if (jpeg_state->crop_scanline == NULL)
+        {
+            JSAMPROW samprow = (JSAMPROW)scanline;
+            (void)jpeg_read_scanlines(jpeg_state->decompress_context, &samprow, 1);
+        }
+        else
+        {
+            (void)jpeg_read_scanlines(jpeg_state->decompress_context, &jpeg_state->crop_scanline, 1);
 
-        JSAMPROW samprow = (JSAMPROW)scanline;
-        (void)jpeg_read_scanlines(jpeg_state->decompress_context, &samprow, 1);
+            memcpy(scanline,
+                   jpeg_state->crop_scanline
+                       + (size_t)jpeg_state->crop_column * jpeg_state->decompress_context->output_components,
+                   image->bytes_per_line);
+        }
     }
 
     return SAIL_OK;
@@ -412,7 +557,10 @@ SAIL_EXPORT sail_status_t sail_codec_save_frame_v8_jpeg(void* state, const struc
 
     for (unsigned row = 0; row < image->height; row++)
     {
-        JSAMPROW samprow = (JSAMPROW)sail_scan_line(image, row);
+        const void* scan_line;
+        SAIL_TRY(sail_save_scan_line(jpeg_state->save_options, image, row, &scan_line));
+
+        JSAMPROW samprow = (JSAMPROW)scan_line;
         jpeg_write_scanlines(jpeg_state->compress_context, &samprow, 1);
     }
 
@@ -428,6 +576,8 @@ SAIL_EXPORT sail_status_t sail_codec_save_finish_v8_jpeg(void** state)
 
     if (setjmp(jpeg_state->error_context.setjmp_buffer) != 0)
     {
+        /* jpeg_finish_compress() fails when the frame was not fully written. Release libjpeg memory anyway. */
+        jpeg_destroy_compress(jpeg_state->compress_context);
         destroy_jpeg_state(jpeg_state);
         SAIL_LOG_AND_RETURN(SAIL_ERROR_UNDERLYING_CODEC);
     }
@@ -281,6 +281,37 @@ sail_status_t jpeg2000_private_pixel_format_to_openjpeg(enum SailPixelFormat pix
     }
 }
 
+unsigned jpeg2000_private_max_reduction_divisor(opj_codec_t* opj_codec)
+{
+    opj_codestream_info_v2_t* cstr_info = opj_get_cstr_info(opj_codec);
+
+    if (cstr_info == NULL)
+    {
+        return 1;
+    }
+
+    if (cstr_info->m_default_tile_info.tccp_info == NULL)
+    {
+        opj_destroy_cstr_info(&cstr_info);
+        return 1;
+    }
+
+    /* Every component must keep at least one resolution level. */
+    OPJ_UINT32 min_resolutions = 32;
+
+    for (OPJ_UINT32 i = 0; i < cstr_info->nbcomps; i++)
+    {
+        if (cstr_info->m_default_tile_info.tccp_info[i].numresolutions < min_resolutions)
+        {
+            min_resolutions = cstr_info->m_default_tile_info.tccp_info[i].numresolutions;
+        }
+    }
+
+    opj_destroy_cstr_info(&cstr_info);
+
+    return (min_resolutions == 0) ? 1 : 1U << (min_resolutions - 1);
+}
+
 bool jpeg2000_private_tuning_key_value_callback_load(const char* key, const struct sail_variant* value, void* user_data)
 {
     opj_dparameters_t* parameters = user_data;
@@ -44,6 +44,12 @@ SAIL_HIDDEN sail_status_t jpeg2000_private_pixel_format_to_openjpeg(enum SailPix
                                                                     int* num_comps,
                                                                     int* prec);
 
+/*
+ * Returns the strongest reduction divisor the resolution levels of the codestream allow.
+ * Must be called after reading the header.
+ */
+SAIL_HIDDEN unsigned jpeg2000_private_max_reduction_divisor(opj_codec_t* opj_codec);
+
 SAIL_HIDDEN bool jpeg2000_private_tuning_key_value_callback_load(const char* key,
                                                                  const struct sail_variant* value,
                                                                  void* user_data);
@@ -224,6 +224,59 @@ SAIL_EXPORT sail_status_t sail_codec_load_seek_next_frame_v8_jpeg2000(void* stat
         SAIL_LOG_AND_RETURN(SAIL_ERROR_UNDERLYING_CODEC);
     }
 
+    const unsigned full_width  = jpeg2000_state->opj_image->x1 - jpeg2000_state->opj_image->x0;
+    const unsigned full_height = jpeg2000_state->opj_image->y1 - jpeg2000_state->opj_image->y0;
+
+    /* Decode just the coarser resolution levels that still cover the requested size. */
+    unsigned reduction = 0;
+
+    for (unsigned divisor = sail_reduction_from_load_options(jpeg2000_state->load_options, full_width, full_height,
+                                                             jpeg2000_private_max_reduction_divisor(
+                                                                 jpeg2000_state->opj_codec));
+         divisor > 1; divisor /= 2)
+    {
+        reduction++;
+    }
+
+    if (reduction > 0 && !opj_set_decoded_resolution_factor(jpeg2000_state->opj_codec, reduction))
+    {
+        SAIL_LOG_ERROR("JPEG2000: Failed to set the resolution reduction to %u", reduction);
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_UNDERLYING_CODEC);
+    }
+
+    const unsigned reduced_width  = (unsigned)(((uint64_t)full_width + (1U << reduction) - 1) >> reduction);
+    const unsigned reduced_height = (unsigned)(((uint64_t)full_height + (1U << reduction) - 1) >> reduction);
+
+    /*
+     * Region of interest. Just the code blocks covering the region are decoded.
+     * The region is in reduced coordinates, and the decode area is on the full resolution grid.
+     */
+    unsigned crop_x;
+    unsigned crop_y;
+    unsigned crop_width;
+    unsigned crop_height;
+
+    SAIL_TRY(sail_crop_rectangle_from_load_options(jpeg2000_state->load_options, reduced_width, reduced_height,
+                                                   &crop_x, &crop_y, &crop_width, &crop_height));
+
+    if (crop_width != reduced_width || crop_height != reduced_height)
+    {
+        const uint64_t area_x1 = (uint64_t)(crop_x + crop_width) << reduction;
+        const uint64_t area_y1 = (uint64_t)(crop_y + crop_height) << reduction;
+        const unsigned area_x0 = crop_x << reduction;
+        const unsigned area_y0 = crop_y << reduction;
+
+        if (!opj_set_decode_area(jpeg2000_state->opj_codec, jpeg2000_state->opj_image,
+                                 (OPJ_INT32)(jpeg2000_state->opj_image->x0 + area_x0),
+                                 (OPJ_INT32)(jpeg2000_state->opj_image->y0 + area_y0),
+                                 (OPJ_INT32)(jpeg2000_state->opj_image->x0 + SAIL_MIN(area_x1, full_width)),
+                                 (OPJ_INT32)(jpeg2000_state->opj_image->y0 + SAIL_MIN(area_y1, full_height))))
+        {
+            SAIL_LOG_ERROR("JPEG2000: Failed to set the decode area");
+            SAIL_LOG_AND_RETURN(SAIL_ERROR_UNDERLYING_CODEC);
+        }
+    }
+
     /* Decode the image. */
     if (!opj_decode(jpeg2000_state->opj_codec, jpeg2000_state->opj_stream, jpeg2000_state->opj_image))
     {
@@ -273,9 +326,9 @@ SAIL_EXPORT sail_status_t sail_codec_load_seek_next_frame_v8_jpeg2000(void* stat
             SAIL_LOG_AND_RETURN(SAIL_ERROR_INVALID_IMAGE);
         }
 
-        if (opj_image->comps[i].x0 != 0 || opj_image->comps[i].y0 != 0)
+        if (opj_image->comps[i].x0 != crop_x || opj_image->comps[i].y0 != crop_y)
         {
-            SAIL_LOG_ERROR("JPEG2000: Component %u has non-zero position", i);
+            SAIL_LOG_ERROR("JPEG2000: Component %u has unexpected position", i);
             SAIL_LOG_AND_RETURN(SAIL_ERROR_INVALID_IMAGE);
         }
 
@@ -322,6 +375,8 @@ SAIL_EXPORT sail_status_t sail_codec_load_seek_next_frame_v8_jpeg2000(void* stat
 
         image_local->source_image->pixel_format = pixel_format;
         image_local->source_image->compression  = SAIL_COMPRESSION_JPEG_2000;
+        image_local->source_image->width        = full_width;
+        image_local->source_image->height       = full_height;
     }
 
     image_local->width          = width;
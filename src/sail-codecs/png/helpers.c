@@ -31,6 +31,10 @@
 
 #include <sail-common/sail-common.h>
 
+#ifdef SAIL_X86_KERNELS
+#include <immintrin.h>
+#endif
+
 #include "helpers.h"
 
 /*
@@ -122,6 +126,143 @@ static sail_status_t hex_string_to_meta_data_node(const char* hex_str,
     return SAIL_OK;
 }
 
+#ifdef PNG_APNG_SUPPORTED
+/*
+ * Blending 8-bit RGBA pixels over the previous frame. The SIMD variants compute the same
+ * double expressions per component as the scalar one, so they produce identical pixels.
+ */
+typedef void (*blend_over_rgba32_func_t)(uint8_t* dst, const uint8_t* src, unsigned width);
+
+static void blend_over_rgba32_scalar(uint8_t* dst, const uint8_t* src, unsigned width)
+{
+    while (width--)
+    {
+        const double src_a = *(src + 3) / 255.0;
+        const double dst_a = *(dst + 3) / 255.0;
+
+        *dst = (uint8_t)(src_a * (*src) + (1 - src_a) * dst_a * (*dst));
+        src++;
+        dst++;
+        *dst = (uint8_t)(src_a * (*src) + (1 - src_a) * dst_a * (*dst));
+        src++;
+        dst++;
+        *dst = (uint8_t)(src_a * (*src) + (1 - src_a) * dst_a * (*dst));
+        src++;
+        dst++;
+        *dst = (uint8_t)((src_a + (1 - src_a) * dst_a) * 255);
+        src++;
+        dst++;
+    }
+}
+
+#ifdef SAIL_X86_KERNELS
+/* Two pixels per iteration. Every component of the pixels is a pair of doubles. */
+SAIL_TARGET_SSE2 static void blend_over_rgba32_sse2(uint8_t* dst, const uint8_t* src, unsigned width)
+{
+    const __m128i byte_mask = _mm_set1_epi32(0xFF);
+    const __m128d one       = _mm_set1_pd(1.0);
+    const __m128d max       = _mm_set1_pd(255.0);
+    unsigned i              = 0;
+
+#define SAIL_COMPONENT(pixels, n) _mm_cvtepi32_pd(_mm_and_si128(_mm_srli_epi32(pixels, (n) * 8), byte_mask))
+#define SAIL_BLEND(n)                                                                                                  \
+    _mm_slli_epi32(_mm_cvttpd_epi32(_mm_add_pd(_mm_mul_pd(src_a, SAIL_COMPONENT(src_pixels, n)),                       \
+                                               _mm_mul_pd(t, SAIL_COMPONENT(dst_pixels, n)))),                         \
+                   (n) * 8)
+    for (; i + 2 <= width; i += 2)
+    {
+        const __m128i src_pixels = _mm_loadl_epi64((const __m128i*)(src + i * 4));
+        const __m128i dst_pixels = _mm_loadl_epi64((const __m128i*)(dst + i * 4));
+
+        const __m128d src_a = _mm_div_pd(SAIL_COMPONENT(src_pixels, 3), max);
+        const __m128d dst_a = _mm_div_pd(SAIL_COMPONENT(dst_pixels, 3), max);
+        const __m128d t     = _mm_mul_pd(_mm_sub_pd(one, src_a), dst_a);
+        const __m128i alpha = _mm_slli_epi32(_mm_cvttpd_epi32(_mm_mul_pd(_mm_add_pd(src_a, t), max)), 24);
+
+        _mm_storel_epi64((__m128i*)(dst + i * 4),
+                         _mm_or_si128(_mm_or_si128(SAIL_BLEND(0), SAIL_BLEND(1)), _mm_or_si128(SAIL_BLEND(2), alpha)));
+    }
+#undef SAIL_BLEND
+#undef SAIL_COMPONENT
+
+    blend_over_rgba32_scalar(dst + i * 4, src + i * 4, width - i);
+}
+
+/* Four pixels per iteration. */
+SAIL_TARGET_AVX2 static void blend_over_rgba32_avx2(uint8_t* dst, const uint8_t* src, unsigned width)
+{
+    const __m128i byte_mask = _mm_set1_epi32(0xFF);
+    const __m256d one       = _mm256_set1_pd(1.0);
+    const __m256d max       = _mm256_set1_pd(255.0);
+    unsigned i              = 0;
+
+#define SAIL_COMPONENT(pixels, n) _mm256_cvtepi32_pd(_mm_and_si128(_mm_srli_epi32(pixels, (n) * 8), byte_mask))
+#define SAIL_BLEND(n)                                                                                                  \
+    _mm_slli_epi32(_mm256_cvttpd_epi32(_mm256_add_pd(_mm256_mul_pd(src_a, SAIL_COMPONENT(src_pixels, n)),              \
+                                                     _mm256_mul_pd(t, SAIL_COMPONENT(dst_pixels, n)))),                \
+                   (n) * 8)
+    for (; i + 4 <= width; i += 4)
+    {
+        const __m128i src_pixels = _mm_loadu_si128((const __m128i*)(src + i * 4));
+        const __m128i dst_pixels = _mm_loadu_si128((const __m128i*)(dst + i * 4));
+
+        const __m256d src_a = _mm256_div_pd(SAIL_COMPONENT(src_pixels, 3), max);
+        const __m256d dst_a = _mm256_div_pd(SAIL_COMPONENT(dst_pixels, 3), max);
+        const __m256d t     = _mm256_mul_pd(_mm256_sub_pd(one, src_a), dst_a);
+        const __m128i alpha = _mm_slli_epi32(_mm256_cvttpd_epi32(_mm256_mul_pd(_mm256_add_pd(src_a, t), max)), 24);
+
+        _mm_storeu_si128((__m128i*)(dst + i * 4),
+                         _mm_or_si128(_mm_or_si128(SAIL_BLEND(0), SAIL_BLEND(1)), _mm_or_si128(SAIL_BLEND(2), alpha)));
+    }
+#undef SAIL_BLEND
+#undef SAIL_COMPONENT
+
+    blend_over_rgba32_scalar(dst + i * 4, src + i * 4, width - i);
+}
+
+/* Eight pixels per iteration. */
+SAIL_TARGET_AVX512 static void blend_over_rgba32_avx512(uint8_t* dst, const uint8_t* src, unsigned width)
+{
+    const __m256i byte_mask = _mm256_set1_epi32(0xFF);
+    const __m512d one       = _mm512_set1_pd(1.0);
+    const __m512d max       = _mm512_set1_pd(255.0);
+    unsigned i              = 0;
+
+#define SAIL_COMPONENT(pixels, n) _mm512_cvtepi32_pd(_mm256_and_si256(_mm256_srli_epi32(pixels, (n) * 8), byte_mask))
+#define SAIL_BLEND(n)                                                                                                  \
+    _mm256_slli_epi32(_mm512_cvttpd_epi32(_mm512_add_pd(_mm512_mul_pd(src_a, SAIL_COMPONENT(src_pixels, n)),           \
+                                                        _mm512_mul_pd(t, SAIL_COMPONENT(dst_pixels, n)))),             \
+                      (n) * 8)
+    for (; i + 8 <= width; i += 8)
+    {
+        const __m256i src_pixels = _mm256_loadu_si256((const __m256i*)(src + i * 4));
+        const __m256i dst_pixels = _mm256_loadu_si256((const __m256i*)(dst + i * 4));
+
+        const __m512d src_a = _mm512_div_pd(SAIL_COMPONENT(src_pixels, 3), max);
+        const __m512d dst_a = _mm512_div_pd(SAIL_COMPONENT(dst_pixels, 3), max);
+        const __m512d t     = _mm512_mul_pd(_mm512_sub_pd(one, src_a), dst_a);
+        const __m256i alpha = _mm256_slli_epi32(_mm512_cvttpd_epi32(_mm512_mul_pd(_mm512_add_pd(src_a, t), max)), 24);
+
+        _mm256_storeu_si256((__m256i*)(dst + i * 4), _mm256_or_si256(_mm256_or_si256(SAIL_BLEND(0), SAIL_BLEND(1)),
+                                                                     _mm256_or_si256(SAIL_BLEND(2), alpha)));
+    }
+#undef SAIL_BLEND
+#undef SAIL_COMPONENT
+
+    blend_over_rgba32_scalar(dst + i * 4, src + i * 4, width - i);
+}
+#endif
+
+static const struct sail_kernel_variant BLEND_OVER_RGBA32_VARIANTS[] = {
+#ifdef SAIL_X86_KERNELS
+    {SAIL_CPU_FEATURE_AVX512, (sail_kernel_func_t)blend_over_rgba32_avx512},
+    {SAIL_CPU_FEATURE_AVX2,   (sail_kernel_func_t)blend_over_rgba32_avx2  },
+    {SAIL_CPU_FEATURE_SSE2,   (sail_kernel_func_t)blend_over_rgba32_sse2  },
+#endif
+    {0,                       (sail_kernel_func_t)blend_over_rgba32_scalar},
+};
+#endif
+
 /*
  * Public functions.
  */
@@ -700,27 +841,10 @@ sail_status_t png_private_blend_over(
     }
     case SAIL_PIXEL_FORMAT_BPP32_RGBA:
     {
-        const uint8_t* src = src_raw;
-        uint8_t* dst       = (uint8_t*)dst_raw + dst_offset * bytes_per_pixel;
-
-        while (width--)
-        {
-            const double src_a = *(src + 3) / 255.0;
-            const double dst_a = *(dst + 3) / 255.0;
+        const blend_over_rgba32_func_t blend_over_rgba32 = (blend_over_rgba32_func_t)sail_select_kernel(
+            BLEND_OVER_RGBA32_VARIANTS, sizeof(BLEND_OVER_RGBA32_VARIANTS) / sizeof(BLEND_OVER_RGBA32_VARIANTS[0]));
 
-            *dst = (uint8_t)(src_a * (*src) + (1 - src_a) * dst_a * (*dst));
-            src++;
-            dst++;
-            *dst = (uint8_t)(src_a * (*src) + (1 - src_a) * dst_a * (*dst));
-            src++;
-            dst++;
-            *dst = (uint8_t)(src_a * (*src) + (1 - src_a) * dst_a * (*dst));
-            src++;
-            dst++;
-            *dst = (uint8_t)((src_a + (1 - src_a) * dst_a) * 255);
-            src++;
-            dst++;
-        }
+        blend_over_rgba32((uint8_t*)dst_raw + dst_offset * bytes_per_pixel, src_raw, width);
         break;
     }
     case SAIL_PIXEL_FORMAT_BPP64_RGBA:
@@ -64,6 +64,17 @@ struct png_state
     int frames;
     int current_frame;
 
+    /* Region of interest. */
+    bool crop;
+    unsigned crop_x;
+    unsigned crop_y;
+    unsigned crop_width;
+    unsigned crop_height;
+    /* Full scan line to read rows outside of the region into. */
+    void* crop_scanline;
+    /* Full-width region rows kept between interlaced passes. */
+    void* crop_rows;
+
     /* APNG-specific. */
 #ifdef PNG_APNG_SUPPORTED
     bool is_apng;
@@ -121,6 +132,14 @@ static sail_status_t alloc_png_state(const struct sail_load_options* load_option
         .frames            = 0,
         .current_frame     = 0,
 
+        .crop          = false,
+        .crop_x        = 0,
+        .crop_y        = 0,
+        .crop_width    = 0,
+        .crop_height   = 0,
+        .crop_scanline = NULL,
+        .crop_rows     = NULL,
+
 /* APNG-specific. */
 #ifdef PNG_APNG_SUPPORTED
         .is_apng         = false,
@@ -161,6 +180,9 @@ static void destroy_png_state(struct png_state* png_state)
         return;
     }
 
+    sail_free(png_state->crop_scanline);
+    sail_free(png_state->crop_rows);
+
 #ifdef PNG_APNG_SUPPORTED
     sail_free(png_state->temp_scanline);
     sail_free(png_state->scanline_for_skipping);
@@ -238,6 +260,15 @@ SAIL_EXPORT sail_status_t sail_codec_load_init_v8_png(struct sail_io* io,
     png_state->first_image->bytes_per_line =
         sail_bytes_per_line(png_state->first_image->width, png_state->first_image->pixel_format);
 
+    /* Region of interest. */
+    SAIL_TRY(sail_crop_rectangle_from_load_options(png_state->load_options, png_state->first_image->width,
+                                                   png_state->first_image->height, &png_state->crop_x,
+                                                   &png_state->crop_y, &png_state->crop_width,
+                                                   &png_state->crop_height));
+
+    png_state->crop = png_state->crop_width != png_state->first_image->width
+                      || png_state->crop_height != png_state->first_image->height;
+
     /* Fetch palette. */
     if (png_state->color_type == PNG_COLOR_TYPE_PALETTE)
     {
@@ -264,8 +295,12 @@ SAIL_EXPORT sail_status_t sail_codec_load_init_v8_png(struct sail_io* io,
 
     if (png_state->is_apng)
     {
-        SAIL_TRY(png_private_alloc_rows(&png_state->prev, png_state->first_image->bytes_per_line,
-                                        png_state->first_image->height));
+        /* The previous frame is needed for composing frames, not for probing. */
+        if ((png_state->load_options->options & SAIL_OPTION_PROBE) == 0)
+        {
+            SAIL_TRY(png_private_alloc_rows(&png_state->prev, png_state->first_image->bytes_per_line,
+                                            png_state->first_image->height));
+        }
 
         if (png_state->load_options->options & (SAIL_OPTION_META_DATA | SAIL_OPTION_SOURCE_IMAGE))
         {
@@ -291,6 +326,8 @@ SAIL_EXPORT sail_status_t sail_codec_load_init_v8_png(struct sail_io* io,
         png_state->first_image->source_image->pixel_format =
             png_private_png_color_type_to_pixel_format(png_state->color_type, png_state->bit_depth);
         png_state->first_image->source_image->compression = SAIL_COMPRESSION_DEFLATE;
+        png_state->first_image->source_image->width       = png_state->first_image->width;
+        png_state->first_image->source_image->height      = png_state->first_image->height;
 
         if (png_state->interlaced_passes > 1)
         {
@@ -318,12 +355,92 @@ SAIL_EXPORT sail_status_t sail_codec_load_init_v8_png(struct sail_io* io,
     }
 
 #ifdef PNG_APNG_SUPPORTED
-    if (png_state->is_apng)
+    if (png_state->is_apng && (png_state->load_options->options & SAIL_OPTION_PROBE) == 0)
     {
         SAIL_TRY(sail_malloc(png_state->first_image->bytes_per_line, &png_state->temp_scanline));
     }
 #endif
 
+    if (png_state->crop && (png_state->load_options->options & SAIL_OPTION_PROBE) == 0)
+    {
+        SAIL_TRY(sail_malloc(png_state->first_image->bytes_per_line, &png_state->crop_scanline));
+
+        if (png_state->interlaced_passes > 1 && png_state->crop_width != png_state->first_image->width)
+        {
+            size_t crop_rows_size;
+            SAIL_TRY(sail_pixels_buffer_size(png_state->crop_height, png_state->first_image->bytes_per_line,
+                                             &crop_rows_size));
+            SAIL_TRY(sail_malloc(crop_rows_size, &png_state->crop_rows));
+        }
+    }
+
+    return SAIL_OK;
+}
+
+/* Assigns the region of interest dimensions to a frame. */
+static void apply_crop(const struct png_state* png_state, struct sail_image* image)
+{
+    image->width          = png_state->crop_width;
+    image->height         = png_state->crop_height;
+    image->bytes_per_line = sail_bytes_per_line(image->width, image->pixel_format);
+}
+
+/*
+ * Reads the rows of a static frame, decoding just the rows up to the end of the region of interest
+ * for non-interlaced images. Interlaced images keep full-width region rows between passes.
+ */
+static sail_status_t read_cropped_rows(struct png_state* png_state, struct sail_image* image)
+{
+    const unsigned full_bytes_per_line = png_state->first_image->bytes_per_line;
+    const bool full_width              = png_state->crop_width == png_state->first_image->width;
+    const unsigned last_row            = (png_state->interlaced_passes > 1) ? png_state->first_image->height
+                                                                            : png_state->crop_y + png_state->crop_height;
+
+    for (int current_pass = 0; current_pass < png_state->interlaced_passes; current_pass++)
+    {
+        for (unsigned row = 0; row < last_row; row++)
+        {
+            png_bytep target = png_state->crop_scanline;
+
+            if (row >= png_state->crop_y && row < png_state->crop_y + png_state->crop_height)
+            {
+                const unsigned crop_row = row - png_state->crop_y;
+
+                if (full_width)
+                {
+                    void* scan_line;
+                    SAIL_TRY(sail_load_scan_line(png_state->load_options, image, crop_row, &scan_line));
+
+                    target = scan_line;
+                }
+                else if (png_state->crop_rows != NULL)
+                {
+                    target = (png_bytep)png_state->crop_rows + (size_t)crop_row * full_bytes_per_line;
+                }
+            }
+
+            png_read_row(png_state->png_ptr, target, NULL);
+
+            /* Non-interlaced rows are complete now. */
+            if (png_state->interlaced_passes == 1 && !full_width && row >= png_state->crop_y)
+            {
+                void* scan_line;
+                SAIL_TRY(sail_load_scan_line(png_state->load_options, image, row - png_state->crop_y, &scan_line));
+
+                SAIL_TRY(sail_copy_pixels_rectangle(png_state->crop_scanline, full_bytes_per_line, image->pixel_format,
+                                                    png_state->crop_x, 0, png_state->crop_width, 1, scan_line,
+                                                    image->bytes_per_line));
+            }
+        }
+    }
+
+    if (png_state->crop_rows != NULL)
+    {
+        SAIL_TRY(sail_copy_pixels_rectangle(png_state->crop_rows, full_bytes_per_line, image->pixel_format,
+                                            png_state->crop_x, 0, png_state->crop_width, png_state->crop_height,
+                                            image->pixels, image->bytes_per_line));
+    }
+
     return SAIL_OK;
 }
 
@@ -356,6 +473,15 @@ SAIL_EXPORT sail_status_t sail_codec_load_seek_next_frame_v8_png(void* state, st
         /* APNG feature: a hidden frame. */
         if (!png_state->skipped_hidden && png_get_first_frame_is_hidden(png_state->png_ptr, png_state->info_ptr))
         {
+            /* Skipping the hidden frame decodes it. Probing reports the canvas instead. */
+            if (png_state->load_options->options & SAIL_OPTION_PROBE)
+            {
+                png_state->current_frame++;
+                apply_crop(png_state, image_local);
+                *image = image_local;
+                return SAIL_OK;
+            }
+
             SAIL_LOG_TRACE("PNG: Skipping hidden frame");
             SAIL_TRY_OR_CLEANUP(png_private_skip_hidden_frame(png_state->first_image->bytes_per_line,
                                                               png_state->first_image->height, png_state->png_ptr,
@@ -422,6 +548,11 @@ SAIL_EXPORT sail_status_t sail_codec_load_seek_next_frame_v8_png(void* state, st
 
     png_state->current_frame++;
 
+    if (png_state->crop)
+    {
+        apply_crop(png_state, image_local);
+    }
+
     *image = image_local;
 
     return SAIL_OK;
@@ -436,20 +567,41 @@ SAIL_EXPORT sail_status_t sail_codec_load_frame_v8_png(void* state, struct sail_
         SAIL_LOG_AND_RETURN(SAIL_ERROR_UNDERLYING_CODEC);
     }
 
+    /* Animated frames are composed on full-width canvas rows and cropped afterwards. */
+    bool is_apng = false;
+#ifdef PNG_APNG_SUPPORTED
+    is_apng = png_state->is_apng;
+#endif
+
+    /* Interlaced passes and animated frames revisit rows, so they're decoded whole. */
+    if (sail_loading_row_bands(png_state->load_options) && (png_state->interlaced_passes > 1 || is_apng))
+    {
+        SAIL_TRY(sail_load_frame_through_row_band(png_state->load_options, image, sail_codec_load_frame_v8_png,
+                                                  state));
+        return SAIL_OK;
+    }
+
     if (setjmp(png_jmpbuf(png_state->png_ptr)))
     {
         png_state->libpng_error = true;
         SAIL_LOG_AND_RETURN(SAIL_ERROR_UNDERLYING_CODEC);
     }
 
+    if (png_state->crop && !is_apng)
+    {
+        SAIL_TRY(read_cropped_rows(png_state, image));
+        return SAIL_OK;
+    }
+
     for (int current_pass = 0; current_pass < png_state->interlaced_passes; current_pass++)
     {
 #ifdef PNG_APNG_SUPPORTED
         if (png_state->is_apng)
         {
-            for (unsigned row = 0; row < image->height; row++)
+            for (unsigned row = 0; row < png_state->first_image->height; row++)
             {
-                unsigned char* scanline = sail_scan_line(image, row);
+                unsigned char* scanline =
+                    png_state->crop ? (unsigned char*)png_state->crop_scanline : sail_scan_line(image, row);
 
                 memcpy(scanline, png_state->prev[row], png_state->first_image->bytes_per_line);
 
@@ -490,19 +642,34 @@ SAIL_EXPORT sail_status_t sail_codec_load_frame_v8_png(void* state, struct sail_
                         }
                     }
                 }
+
+                if (png_state->crop && row >= png_state->crop_y && row < png_state->crop_y + png_state->crop_height)
+                {
+                    SAIL_TRY(sail_copy_pixels_rectangle(scanline, png_state->first_image->bytes_per_line,
+                                                        image->pixel_format, png_state->crop_x, 0,
+                                                        png_state->crop_width, 1,
+                                                        sail_scan_line(image, row - png_state->crop_y),
+                                                        image->bytes_per_line));
+                }
             }
         }
         else
         {
             for (unsigned row = 0; row < image->height; row++)
             {
-                png_read_row(png_state->png_ptr, sail_scan_line(image, row), NULL);
+                void* scan_line;
+                SAIL_TRY(sail_load_scan_line(png_state->load_options, image, row, &scan_line));
+
+                png_read_row(png_state->png_ptr, scan_line, NULL);
             }
         }
 #else
         for (unsigned row = 0; row < image->height; row++)
         {
-            png_read_row(png_state->png_ptr, sail_scan_line(image, row), NULL);
+            void* scan_line;
+            SAIL_TRY(sail_load_scan_line(png_state->load_options, image, row, &scan_line));
+
+            png_read_row(png_state->png_ptr, scan_line, NULL);
         }
 #endif
     }
@@ -846,6 +1013,14 @@ SAIL_EXPORT sail_status_t sail_codec_save_frame_v8_png(void* state, const struct
         SAIL_LOG_AND_RETURN(SAIL_ERROR_UNDERLYING_CODEC);
     }
 
+    /* Interlaced passes revisit rows, so they're encoded from the whole frame. */
+    if (sail_saving_row_bands(png_state->save_options) && png_state->interlaced_passes > 1)
+    {
+        SAIL_TRY(sail_save_frame_through_row_band(png_state->save_options, image, sail_codec_save_frame_v8_png,
+                                                  state));
+        return SAIL_OK;
+    }
+
     /* Error handling setup. */
     if (setjmp(png_jmpbuf(png_state->png_ptr)))
     {
@@ -857,7 +1032,10 @@ SAIL_EXPORT sail_status_t sail_codec_save_frame_v8_png(void* state, const struct
     {
         for (unsigned row = 0; row < image->height; row++)
         {
-            png_write_row(png_state->png_ptr, sail_scan_line(image, row));
+            const void* scan_line;
+            SAIL_TRY(sail_save_scan_line(png_state->save_options, image, row, &scan_line));
+
+            png_write_row(png_state->png_ptr, scan_line);
         }
     }
 
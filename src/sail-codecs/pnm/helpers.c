@@ -33,29 +33,31 @@
 
 #include "helpers.h"
 
-sail_status_t pnm_private_skip_to_letters_numbers_force_read(struct sail_io* io, char* first_char)
+sail_status_t pnm_private_skip_to_letters_numbers_force_read(struct sail_buffered_reader* reader, char* first_char)
 {
-    char c;
+    unsigned char c;
 
     do
     {
-        SAIL_TRY(io->strict_read(io->stream, &c, 1));
+        SAIL_TRY(sail_buffered_reader_get_byte(reader, &c));
 
         if (c == '#')
         {
             do
             {
-                SAIL_TRY(io->strict_read(io->stream, &c, 1));
+                SAIL_TRY(sail_buffered_reader_get_byte(reader, &c));
             } while (c != '\n');
         }
     } while (!isalnum(c));
 
-    *first_char = c;
+    *first_char = (char)c;
 
     return SAIL_OK;
 }
 
-sail_status_t pnm_private_skip_to_letters_numbers(struct sail_io* io, char starting_char, char* first_char)
+sail_status_t pnm_private_skip_to_letters_numbers(struct sail_buffered_reader* reader,
+                                                  char starting_char,
+                                                  char* first_char)
 {
     if (isalnum(starting_char))
     {
@@ -63,12 +65,12 @@ sail_status_t pnm_private_skip_to_letters_numbers(struct sail_io* io, char start
         return SAIL_OK;
     }
 
-    SAIL_TRY(pnm_private_skip_to_letters_numbers_force_read(io, first_char));
+    SAIL_TRY(pnm_private_skip_to_letters_numbers_force_read(reader, first_char));
 
     return SAIL_OK;
 }
 
-sail_status_t pnm_private_read_word(struct sail_io* io, char* str, size_t str_size)
+sail_status_t pnm_private_read_word(struct sail_buffered_reader* reader, char* str, size_t str_size)
 {
     if (str_size < 2)
     {
@@ -76,34 +78,32 @@ sail_status_t pnm_private_read_word(struct sail_io* io, char* str, size_t str_si
     }
 
     char first_char;
-    SAIL_TRY(pnm_private_skip_to_letters_numbers(io, SAIL_PNM_INVALID_STARTING_CHAR, &first_char));
+    SAIL_TRY(pnm_private_skip_to_letters_numbers(reader, SAIL_PNM_INVALID_STARTING_CHAR, &first_char));
 
-    unsigned i = 0;
-    char c     = first_char;
+    unsigned i      = 0;
+    unsigned char c = (unsigned char)first_char;
 
-    bool eof;
-    SAIL_TRY(io->eof(io->stream, &eof));
-
-    if (eof)
-    {
-        *(str + i++) = c;
-    }
-    else
+    while (isalnum(c) || c == '_')
     {
-        while ((isalnum(c) || c == '_') && i < str_size - 1 && !eof)
+        /* The buffer is full but no word delimiter found. */
+        if (i == str_size - 1)
         {
-            *(str + i++) = c;
+            SAIL_LOG_ERROR("PNM: No word delimiter found");
+            SAIL_LOG_AND_RETURN(SAIL_ERROR_INVALID_IMAGE);
+        }
+
+        *(str + i++) = (char)c;
+
+        /* The last word might be not followed by a delimiter. */
+        bool eof;
+        SAIL_TRY(sail_buffered_reader_eof(reader, &eof));
 
-            SAIL_TRY(io->strict_read(io->stream, &c, 1));
-            SAIL_TRY(io->eof(io->stream, &eof));
+        if (eof)
+        {
+            break;
         }
-    }
 
-    /* The buffer is full but no word delimiter found. */
-    if (i == str_size - 1 && !eof)
-    {
-        SAIL_LOG_ERROR("PNM: No word delimiter found");
-        SAIL_LOG_AND_RETURN(SAIL_ERROR_INVALID_IMAGE);
+        SAIL_TRY(sail_buffered_reader_get_byte(reader, &c));
     }
 
     *(str + i) = '\0';
@@ -111,20 +111,27 @@ sail_status_t pnm_private_read_word(struct sail_io* io, char* str, size_t str_si
     return SAIL_OK;
 }
 
-sail_status_t pnm_private_read_pixels(
-    struct sail_io* io, struct sail_image* image, unsigned channels, unsigned bpc, double multiplier_to_full_range)
+sail_status_t pnm_private_read_pixels(struct sail_buffered_reader* reader,
+                                      const struct sail_load_options* load_options,
+                                      struct sail_image* image,
+                                      unsigned channels,
+                                      unsigned bpc,
+                                      double multiplier_to_full_range)
 {
     for (unsigned row = 0; row < image->height; row++)
     {
-        uint8_t* scan8   = sail_scan_line(image, row);
-        uint16_t* scan16 = sail_scan_line(image, row);
+        void* scan_line;
+        SAIL_TRY(sail_load_scan_line(load_options, image, row, &scan_line));
+
+        uint8_t* scan8   = scan_line;
+        uint16_t* scan16 = scan_line;
 
         for (unsigned column = 0; column < image->width; column++)
         {
             for (unsigned channel = 0; channel < channels; channel++)
             {
                 char buffer[8];
-                SAIL_TRY(pnm_private_read_word(io, buffer, sizeof(buffer)));
+                SAIL_TRY(pnm_private_read_word(reader, buffer, sizeof(buffer)));
 
                 unsigned value;
 #ifdef _MSC_VER
@@ -217,7 +224,7 @@ sail_status_t pnm_private_store_ascii(enum SailPnmVersion pnm_version, struct sa
     return SAIL_OK;
 }
 
-sail_status_t pnm_private_read_pam_header(struct sail_io* io,
+sail_status_t pnm_private_read_pam_header(struct sail_buffered_reader* reader,
                                           unsigned* width,
                                           unsigned* height,
                                           unsigned* depth,
@@ -234,7 +241,7 @@ sail_status_t pnm_private_read_pam_header(struct sail_io* io,
 
     while (true)
     {
-        SAIL_TRY(pnm_private_read_word(io, buffer, sizeof(buffer)));
+        SAIL_TRY(pnm_private_read_word(reader, buffer, sizeof(buffer)));
 
         if (strcmp(buffer, "ENDHDR") == 0)
         {
@@ -242,7 +249,7 @@ sail_status_t pnm_private_read_pam_header(struct sail_io* io,
         }
         else if (strcmp(buffer, "WIDTH") == 0)
         {
-            SAIL_TRY(pnm_private_read_word(io, buffer, sizeof(buffer)));
+            SAIL_TRY(pnm_private_read_word(reader, buffer, sizeof(buffer)));
 #ifdef _MSC_VER
             if (sscanf_s(buffer, "%u", width) != 1)
             {
@@ -256,7 +263,7 @@ sail_status_t pnm_private_read_pam_header(struct sail_io* io,
         }
         else if (strcmp(buffer, "HEIGHT") == 0)
         {
-            SAIL_TRY(pnm_private_read_word(io, buffer, sizeof(buffer)));
+            SAIL_TRY(pnm_private_read_word(reader, buffer, sizeof(buffer)));
 #ifdef _MSC_VER
             if (sscanf_s(buffer, "%u", height) != 1)
             {
@@ -270,7 +277,7 @@ sail_status_t pnm_private_read_pam_header(struct sail_io* io,
         }
         else if (strcmp(buffer, "DEPTH") == 0)
         {
-            SAIL_TRY(pnm_private_read_word(io, buffer, sizeof(buffer)));
+            SAIL_TRY(pnm_private_read_word(reader, buffer, sizeof(buffer)));
 #ifdef _MSC_VER
             if (sscanf_s(buffer, "%u", depth) != 1)
             {
@@ -284,7 +291,7 @@ sail_status_t pnm_private_read_pam_header(struct sail_io* io,
         }
         else if (strcmp(buffer, "MAXVAL") == 0)
         {
-            SAIL_TRY(pnm_private_read_word(io, buffer, sizeof(buffer)));
+            SAIL_TRY(pnm_private_read_word(reader, buffer, sizeof(buffer)));
 #ifdef _MSC_VER
             if (sscanf_s(buffer, "%u", maxval) != 1)
             {
@@ -298,7 +305,7 @@ sail_status_t pnm_private_read_pam_header(struct sail_io* io,
         }
         else if (strcmp(buffer, "TUPLTYPE") == 0)
         {
-            SAIL_TRY(pnm_private_read_word(io, buffer, sizeof(buffer)));
+            SAIL_TRY(pnm_private_read_word(reader, buffer, sizeof(buffer)));
 
             if (strcmp(buffer, "BLACKANDWHITE") == 0)
             {
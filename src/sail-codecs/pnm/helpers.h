@@ -31,7 +31,9 @@
 #include <sail-common/export.h>
 #include <sail-common/status.h>
 
+struct sail_buffered_reader;
 struct sail_image;
+struct sail_load_options;
 struct sail_io;
 struct sail_hash_map;
 
@@ -58,21 +60,28 @@ enum SailPamTuplType
 
 static const char SAIL_PNM_INVALID_STARTING_CHAR = '\0';
 
-SAIL_HIDDEN sail_status_t pnm_private_skip_to_letters_numbers_force_read(struct sail_io* io, char* first_char);
+SAIL_HIDDEN sail_status_t pnm_private_skip_to_letters_numbers_force_read(struct sail_buffered_reader* reader,
+                                                                         char* first_char);
 
-SAIL_HIDDEN sail_status_t pnm_private_skip_to_letters_numbers(struct sail_io* io, char starting_char, char* first_char);
+SAIL_HIDDEN sail_status_t pnm_private_skip_to_letters_numbers(struct sail_buffered_reader* reader,
+                                                              char starting_char,
+                                                              char* first_char);
 
-SAIL_HIDDEN sail_status_t pnm_private_read_word(struct sail_io* io, char* str, size_t str_size);
+SAIL_HIDDEN sail_status_t pnm_private_read_word(struct sail_buffered_reader* reader, char* str, size_t str_size);
 
-SAIL_HIDDEN sail_status_t pnm_private_read_pixels(
-    struct sail_io* io, struct sail_image* image, unsigned channels, unsigned bpc, double multiplier_to_full_range);
+SAIL_HIDDEN sail_status_t pnm_private_read_pixels(struct sail_buffered_reader* reader,
+                                                  const struct sail_load_options* load_options,
+                                                  struct sail_image* image,
+                                                  unsigned channels,
+                                                  unsigned bpc,
+                                                  double multiplier_to_full_range);
 
 SAIL_HIDDEN enum SailPixelFormat pnm_private_rgb_sail_pixel_format(enum SailPnmVersion pnm_version, unsigned bpc);
 
 SAIL_HIDDEN sail_status_t pnm_private_store_ascii(enum SailPnmVersion pnm_version,
                                                   struct sail_hash_map* special_properties);
 
-SAIL_HIDDEN sail_status_t pnm_private_read_pam_header(struct sail_io* io,
+SAIL_HIDDEN sail_status_t pnm_private_read_pam_header(struct sail_buffered_reader* reader,
                                                       unsigned* width,
                                                       unsigned* height,
                                                       unsigned* depth,
@@ -40,6 +40,7 @@ static const uint8_t SAIL_PNM_MONO_PALETTE[] = {255, 255, 255, 0, 0, 0};
 struct pnm_state
 {
     struct sail_io* io;
+    struct sail_buffered_reader* reader;
     const struct sail_load_options* load_options;
     const struct sail_save_options* save_options;
 
@@ -64,6 +65,7 @@ static sail_status_t alloc_pnm_state(struct sail_io* io,
 
     **pnm_state = (struct pnm_state){
         .io           = io,
+        .reader       = NULL,
         .load_options = load_options,
         .save_options = save_options,
 
@@ -86,6 +88,8 @@ static void destroy_pnm_state(struct pnm_state* pnm_state)
         return;
     }
 
+    sail_destroy_buffered_reader(pnm_state->reader);
+
     sail_free(pnm_state);
 }
 
@@ -104,9 +108,12 @@ SAIL_EXPORT sail_status_t sail_codec_load_init_v8_pnm(struct sail_io* io,
     SAIL_TRY(alloc_pnm_state(io, load_options, NULL, &pnm_state));
     *state = pnm_state;
 
+    /* Headers and ASCII pixels are parsed byte by byte. */
+    SAIL_TRY(sail_alloc_buffered_reader(pnm_state->io, 0, &pnm_state->reader));
+
     /* Init decoder. */
     char str[8];
-    SAIL_TRY(pnm_private_read_word(pnm_state->io, str, sizeof(str)));
+    SAIL_TRY(pnm_private_read_word(pnm_state->reader, str, sizeof(str)));
 
     const char pnm = str[1];
 
@@ -150,7 +157,7 @@ SAIL_EXPORT sail_status_t sail_codec_load_seek_next_frame_v8_pnm(void* state, st
     if (pnm_state->version == SAIL_PNM_VERSION_P7)
     {
         unsigned maxval;
-        SAIL_TRY(pnm_private_read_pam_header(pnm_state->io, &w, &h, &pnm_state->pam_depth, &maxval,
+        SAIL_TRY(pnm_private_read_pam_header(pnm_state->reader, &w, &h, &pnm_state->pam_depth, &maxval,
                                              &pnm_state->pam_tupltype));
 
         if (maxval <= 255)
@@ -180,7 +187,7 @@ SAIL_EXPORT sail_status_t sail_codec_load_seek_next_frame_v8_pnm(void* state, st
         char buffer[32];
 
         /* Dimensions. */
-        SAIL_TRY(pnm_private_read_word(pnm_state->io, buffer, sizeof(buffer)));
+        SAIL_TRY(pnm_private_read_word(pnm_state->reader, buffer, sizeof(buffer)));
 
 #ifdef _MSC_VER
         if (sscanf_s(buffer, "%u", &w) != 1)
@@ -193,7 +200,7 @@ SAIL_EXPORT sail_status_t sail_codec_load_seek_next_frame_v8_pnm(void* state, st
             SAIL_LOG_AND_RETURN(SAIL_ERROR_INVALID_IMAGE);
         }
 
-        SAIL_TRY(pnm_private_read_word(pnm_state->io, buffer, sizeof(buffer)));
+        SAIL_TRY(pnm_private_read_word(pnm_state->reader, buffer, sizeof(buffer)));
 
 #ifdef _MSC_VER
         if (sscanf_s(buffer, "%u", &h) != 1)
@@ -210,7 +217,7 @@ SAIL_EXPORT sail_status_t sail_codec_load_seek_next_frame_v8_pnm(void* state, st
         if (pnm_state->version == SAIL_PNM_VERSION_P2 || pnm_state->version == SAIL_PNM_VERSION_P3
             || pnm_state->version == SAIL_PNM_VERSION_P5 || pnm_state->version == SAIL_PNM_VERSION_P6)
         {
-            SAIL_TRY(pnm_private_read_word(pnm_state->io, buffer, sizeof(buffer)));
+            SAIL_TRY(pnm_private_read_word(pnm_state->reader, buffer, sizeof(buffer)));
 
             unsigned max_color;
 #ifdef _MSC_VER
@@ -317,13 +324,16 @@ SAIL_EXPORT sail_status_t sail_codec_load_frame_v8_pnm(void* state, struct sail_
     {
         for (unsigned row = 0; row < image->height; row++)
         {
-            uint8_t* scan  = sail_scan_line(image, row);
+            void* scan_line;
+            SAIL_TRY(sail_load_scan_line(pnm_state->load_options, image, row, &scan_line));
+
+            uint8_t* scan  = scan_line;
             unsigned shift = 8;
 
             for (unsigned column = 0; column < image->width; column++)
             {
                 char first_char;
-                SAIL_TRY(pnm_private_skip_to_letters_numbers_force_read(pnm_state->io, &first_char));
+                SAIL_TRY(pnm_private_skip_to_letters_numbers_force_read(pnm_state->reader, &first_char));
 
                 const unsigned value = first_char - '0';
 
@@ -351,53 +361,33 @@ SAIL_EXPORT sail_status_t sail_codec_load_frame_v8_pnm(void* state, struct sail_
     }
     case SAIL_PNM_VERSION_P2:
     {
-        SAIL_TRY(pnm_private_read_pixels(pnm_state->io, image, 1, pnm_state->bpc, pnm_state->multiplier_to_full_range));
+        SAIL_TRY(pnm_private_read_pixels(pnm_state->reader, pnm_state->load_options, image, 1, pnm_state->bpc,
+                                         pnm_state->multiplier_to_full_range));
         break;
     }
     case SAIL_PNM_VERSION_P3:
     {
-        SAIL_TRY(pnm_private_read_pixels(pnm_state->io, image, 3, pnm_state->bpc, pnm_state->multiplier_to_full_range));
+        SAIL_TRY(pnm_private_read_pixels(pnm_state->reader, pnm_state->load_options, image, 3, pnm_state->bpc,
+                                         pnm_state->multiplier_to_full_range));
         break;
     }
     case SAIL_PNM_VERSION_P4:
     case SAIL_PNM_VERSION_P5:
     case SAIL_PNM_VERSION_P6:
-    {
-        for (unsigned row = 0; row < image->height; row++)
-        {
-            SAIL_TRY(
-                pnm_state->io->strict_read(pnm_state->io->stream, sail_scan_line(image, row), image->bytes_per_line));
-        }
-
-        /* For 16-bit formats, swap from big-endian to little-endian (SAIL internal). */
-        if (pnm_state->bpc == 16)
-        {
-            for (unsigned row = 0; row < image->height; row++)
-            {
-                uint16_t* pixels = (uint16_t*)sail_scan_line(image, row);
-                for (unsigned i = 0; i < image->bytes_per_line / 2; i++)
-                {
-                    pixels[i] = sail_reverse_uint16(pixels[i]);
-                }
-            }
-        }
-        break;
-    }
     case SAIL_PNM_VERSION_P7:
     {
-        /* PAM: Binary format, read raw pixel data. */
+        /* P7 is PAM with raw pixel data as well. */
         for (unsigned row = 0; row < image->height; row++)
         {
-            SAIL_TRY(
-                pnm_state->io->strict_read(pnm_state->io->stream, sail_scan_line(image, row), image->bytes_per_line));
-        }
+            void* scan_line;
+            SAIL_TRY(sail_load_scan_line(pnm_state->load_options, image, row, &scan_line));
 
-        /* For 16-bit formats, swap from big-endian to little-endian (SAIL internal). */
-        if (pnm_state->bpc == 16)
-        {
-            for (unsigned row = 0; row < image->height; row++)
+            SAIL_TRY(sail_buffered_reader_read(pnm_state->reader, scan_line, image->bytes_per_line));
+
+            /* For 16-bit formats, swap from big-endian to little-endian (SAIL internal). */
+            if (pnm_state->bpc == 16)
             {
-                uint16_t* pixels = (uint16_t*)sail_scan_line(image, row);
+                uint16_t* pixels = scan_line;
                 for (unsigned i = 0; i < image->bytes_per_line / 2; i++)
                 {
                     pixels[i] = sail_reverse_uint16(pixels[i]);
@@ -492,7 +482,9 @@ SAIL_EXPORT sail_status_t sail_codec_save_frame_v8_pnm(void* state, const struct
     {
         for (unsigned row = 0; row < image->height; row++)
         {
-            const uint8_t* scan = sail_scan_line(image, row);
+            const void* scan;
+            SAIL_TRY(sail_save_scan_line(pnm_state->save_options, image, row, &scan));
+
             void* buffer;
             SAIL_TRY(sail_malloc(image->bytes_per_line, &buffer));
 
@@ -515,8 +507,10 @@ SAIL_EXPORT sail_status_t sail_codec_save_frame_v8_pnm(void* state, const struct
         /* For 8-bit and 1-bit formats, write as-is. */
         for (unsigned row = 0; row < image->height; row++)
         {
-            SAIL_TRY(
-                pnm_state->io->strict_write(pnm_state->io->stream, sail_scan_line(image, row), image->bytes_per_line));
+            const void* scan;
+            SAIL_TRY(sail_save_scan_line(pnm_state->save_options, image, row, &scan));
+
+            SAIL_TRY(pnm_state->io->strict_write(pnm_state->io->stream, scan, image->bytes_per_line));
         }
     }
 
@@ -203,3 +203,99 @@ enum SailCompression psd_private_sail_compression(enum SailPsdCompression compre
     default: return SAIL_COMPRESSION_UNKNOWN;
     }
 }
+
+static sail_status_t decode_thumbnail(struct sail_io* io,
+                                      uint16_t id,
+                                      uint32_t data_size,
+                                      const struct sail_load_options* load_options,
+                                      unsigned width,
+                                      unsigned height,
+                                      struct sail_image** thumbnail)
+{
+    /* Format, width, height, width bytes, total size, compressed size, bits per pixel, planes. */
+    uint32_t format;
+    SAIL_TRY(psd_private_get_big_endian_uint32_t(io, &format));
+    uint32_t thumbnail_width;
+    SAIL_TRY(psd_private_get_big_endian_uint32_t(io, &thumbnail_width));
+    uint32_t thumbnail_height;
+    SAIL_TRY(psd_private_get_big_endian_uint32_t(io, &thumbnail_height));
+    SAIL_TRY(io->seek(io->stream, 16, SEEK_CUR));
+
+    /* 1 is kJpegRGB. */
+    if (format != 1 || thumbnail_width < load_options->max_width || thumbnail_height < load_options->max_height
+        || (thumbnail_width >= width && thumbnail_height >= height))
+    {
+        return SAIL_OK;
+    }
+
+    const size_t jfif_size = data_size - 28;
+
+    void* jfif_data;
+    SAIL_TRY(sail_malloc(jfif_size, &jfif_data));
+
+    SAIL_TRY_OR_CLEANUP(io->strict_read(io->stream, jfif_data, jfif_size),
+                        /* cleanup */ sail_free(jfif_data));
+
+    SAIL_TRY_OR_SUPPRESS(sail_load_embedded_image(jfif_data, jfif_size, thumbnail));
+
+    sail_free(jfif_data);
+
+    if (*thumbnail != NULL && id == SAIL_PSD_RESOURCE_THUMBNAIL_BGR
+        && (*thumbnail)->pixel_format == SAIL_PIXEL_FORMAT_BPP24_RGB)
+    {
+        (*thumbnail)->pixel_format = SAIL_PIXEL_FORMAT_BPP24_BGR;
+    }
+
+    return SAIL_OK;
+}
+
+sail_status_t psd_private_load_thumbnail(struct sail_io* io,
+                                         uint32_t resources_size,
+                                         const struct sail_load_options* load_options,
+                                         unsigned width,
+                                         unsigned height,
+                                         struct sail_image** thumbnail)
+{
+    *thumbnail = NULL;
+
+    /* Signature, ID, empty name, and data size. */
+    for (uint32_t offset = 0; resources_size - offset >= 12;)
+    {
+        uint32_t signature;
+        SAIL_TRY(psd_private_get_big_endian_uint32_t(io, &signature));
+        uint16_t id;
+        SAIL_TRY(psd_private_get_big_endian_uint16_t(io, &id));
+
+        /* Pascal string padded to an even size. */
+        unsigned char name_length;
+        SAIL_TRY(io->strict_read(io->stream, &name_length, 1));
+        const uint32_t name_size = ((uint32_t)name_length + 2) & ~1U;
+        SAIL_TRY(io->seek(io->stream, (long)name_size - 1, SEEK_CUR));
+
+        uint32_t data_size;
+        SAIL_TRY(psd_private_get_big_endian_uint32_t(io, &data_size));
+
+        offset += 4 + 2 + name_size + 4;
+
+        if (offset > resources_size || data_size > resources_size - offset)
+        {
+            SAIL_LOG_WARNING("PSD: Image resource #%u is truncated", id);
+            return SAIL_OK;
+        }
+
+        /* '8BIM'. */
+        if (signature == 0x3842494D
+            && (id == SAIL_PSD_RESOURCE_THUMBNAIL || id == SAIL_PSD_RESOURCE_THUMBNAIL_BGR) && data_size > 28)
+        {
+            return decode_thumbnail(io, id, data_size, load_options, width, height, thumbnail);
+        }
+
+        const uint32_t padded_data_size = data_size + (data_size & 1);
+
+        SAIL_TRY(io->seek(io->stream, (long)padded_data_size, SEEK_CUR));
+
+        offset += SAIL_MIN(padded_data_size, resources_size - offset);
+    }
+
+    return SAIL_OK;
+}
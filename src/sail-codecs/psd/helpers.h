@@ -53,7 +53,17 @@ enum SailPsdCompression
     SAIL_PSD_COMPRESSION_ZIP_WITH_PREDICTION    = 3,
 };
 
+/* PSD image resources. */
+enum SailPsdResource
+{
+    /* JFIF thumbnail with BGR pixels written by Photoshop 4.0. */
+    SAIL_PSD_RESOURCE_THUMBNAIL_BGR = 1033,
+    SAIL_PSD_RESOURCE_THUMBNAIL     = 1036,
+};
+
+struct sail_image;
 struct sail_io;
+struct sail_load_options;
 
 SAIL_HIDDEN sail_status_t psd_private_get_big_endian_uint16_t(struct sail_io* io, uint16_t* v);
 
@@ -65,3 +75,15 @@ SAIL_HIDDEN sail_status_t psd_private_sail_pixel_format(enum SailPsdMode mode,
                                                         enum SailPixelFormat* result);
 
 SAIL_HIDDEN enum SailCompression psd_private_sail_compression(enum SailPsdCompression compression);
+
+/*
+ * Reads the image resources of the specified size and decodes the first JFIF thumbnail that still
+ * covers the size requested in the load options and is less than the image. Sets the thumbnail
+ * to NULL when there is no such thumbnail. Doesn't restore the I/O position.
+ */
+SAIL_HIDDEN sail_status_t psd_private_load_thumbnail(struct sail_io* io,
+                                                     uint32_t resources_size,
+                                                     const struct sail_load_options* load_options,
+                                                     unsigned width,
+                                                     unsigned height,
+                                                     struct sail_image** thumbnail);
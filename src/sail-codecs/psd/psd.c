@@ -52,6 +52,7 @@ struct psd_state
     unsigned bytes_per_channel;
     unsigned char* scan_buffer;
     struct sail_palette* palette;
+    struct sail_image* thumbnail;
 };
 
 static sail_status_t alloc_psd_state(struct sail_io* io,
@@ -76,6 +77,7 @@ static sail_status_t alloc_psd_state(struct sail_io* io,
         .bytes_per_channel = 0,
         .scan_buffer       = NULL,
         .palette           = NULL,
+        .thumbnail         = NULL,
     };
 
     return SAIL_OK;
@@ -92,6 +94,8 @@ static void destroy_psd_state(struct psd_state* psd_state)
 
     sail_destroy_palette(psd_state->palette);
 
+    sail_destroy_image(psd_state->thumbnail);
+
     sail_free(psd_state);
 }
 
@@ -213,9 +217,24 @@ SAIL_EXPORT sail_status_t sail_codec_load_seek_next_frame_v8_psd(void* state, st
         memcpy(psd_state->palette->data, SAIL_PSD_MONO_PALETTE, 6);
     }
 
-    /* Skip the image resources. */
+    /* Skip the image resources. Look for the JFIF thumbnail in them first when requested. */
     SAIL_TRY(psd_private_get_big_endian_uint32_t(psd_state->io, &data_size));
-    SAIL_TRY(psd_state->io->seek(psd_state->io->stream, data_size, SEEK_CUR));
+
+    if (psd_state->load_options->options & SAIL_OPTION_THUMBNAIL)
+    {
+        size_t resources_offset;
+        SAIL_TRY(psd_state->io->tell(psd_state->io->stream, &resources_offset));
+
+        SAIL_TRY(psd_private_load_thumbnail(psd_state->io, data_size, psd_state->load_options, width, height,
+                                            &psd_state->thumbnail));
+
+        SAIL_TRY(psd_state->io->seek(psd_state->io->stream, (long)(resources_offset + data_size), SEEK_SET));
+    }
+    else
+    {
+        SAIL_TRY(psd_state->io->seek(psd_state->io->stream, data_size, SEEK_CUR));
+    }
+
     /* Skip the layer and mask information. */
     SAIL_TRY(psd_private_get_big_endian_uint32_t(psd_state->io, &data_size));
     SAIL_TRY(psd_state->io->seek(psd_state->io->stream, data_size, SEEK_CUR));
@@ -237,14 +256,18 @@ SAIL_EXPORT sail_status_t sail_codec_load_seek_next_frame_v8_psd(void* state, st
     enum SailPixelFormat pixel_format;
     SAIL_TRY(psd_private_sail_pixel_format(mode, psd_state->channels, psd_state->depth, &pixel_format));
 
+    /* Neither probing nor loading the thumbnail reads the image pixels. */
+    const bool skip_pixels =
+        (psd_state->load_options->options & SAIL_OPTION_PROBE) != 0 || psd_state->thumbnail != NULL;
+
     /* Skip byte counts for all the scan lines. */
-    if (psd_state->compression == SAIL_PSD_COMPRESSION_RLE)
+    if (psd_state->compression == SAIL_PSD_COMPRESSION_RLE && !skip_pixels)
     {
         SAIL_TRY(psd_state->io->seek(psd_state->io->stream, (long)height * psd_state->channels * 2, SEEK_CUR));
     }
 
     /* Used to optimize uncompressed readings. */
-    if (psd_state->compression == SAIL_PSD_COMPRESSION_NONE)
+    if (psd_state->compression == SAIL_PSD_COMPRESSION_NONE && !skip_pixels)
     {
         psd_state->bytes_per_channel = ((unsigned)width * psd_state->depth + 7) / 8;
 
@@ -266,94 +289,131 @@ SAIL_EXPORT sail_status_t sail_codec_load_seek_next_frame_v8_psd(void* state, st
         image_local->source_image->compression  = psd_private_sail_compression(psd_state->compression);
     }
 
-    image_local->width          = width;
-    image_local->height         = height;
-    image_local->pixel_format   = pixel_format;
-    image_local->palette        = psd_state->palette;
-    image_local->bytes_per_line = sail_bytes_per_line(image_local->width, image_local->pixel_format);
-
-    /* Palette has been moved. */
-    psd_state->palette = NULL;
+    if (psd_state->thumbnail != NULL)
+    {
+        image_local->width          = psd_state->thumbnail->width;
+        image_local->height         = psd_state->thumbnail->height;
+        image_local->pixel_format   = psd_state->thumbnail->pixel_format;
+        image_local->bytes_per_line = sail_bytes_per_line(image_local->width, image_local->pixel_format);
+    }
+    else
+    {
+        image_local->width          = width;
+        image_local->height         = height;
+        image_local->pixel_format   = pixel_format;
+        image_local->palette        = psd_state->palette;
+        image_local->bytes_per_line = sail_bytes_per_line(image_local->width, image_local->pixel_format);
+
+        /* Palette has been moved. */
+        psd_state->palette = NULL;
+    }
 
     *image = image_local;
 
     return SAIL_OK;
 }
 
-SAIL_EXPORT sail_status_t sail_codec_load_frame_v8_psd(void* state, struct sail_image* image)
+static sail_status_t load_rle_frame(const struct psd_state* psd_state,
+                                    struct sail_buffered_reader* reader,
+                                    struct sail_image* image)
 {
-    const struct psd_state* psd_state = state;
+    const unsigned bytes_per_pixel  = (sail_bits_per_pixel(image->pixel_format) + 7) / 8;
+    const unsigned bytes_per_sample = (psd_state->depth + 7) / 8;
 
-    const unsigned bytes_per_pixel = (sail_bits_per_pixel(image->pixel_format) + 7) / 8;
-
-    if (psd_state->compression == SAIL_PSD_COMPRESSION_RLE)
+    for (unsigned channel = 0; channel < psd_state->channels; channel++)
     {
-        const unsigned bytes_per_sample = (psd_state->depth + 7) / 8;
-
-        for (unsigned channel = 0; channel < psd_state->channels; channel++)
+        for (unsigned row = 0; row < image->height; row++)
         {
-            for (unsigned row = 0; row < image->height; row++)
+            for (unsigned count = 0; count < image->width;)
             {
-                for (unsigned count = 0; count < image->width;)
+                unsigned char c;
+                SAIL_TRY(sail_buffered_reader_get_byte(reader, &c));
+
+                if (c > 128)
                 {
-                    unsigned char c;
-                    SAIL_TRY(psd_state->io->strict_read(psd_state->io->stream, &c, sizeof(c)));
+                    c ^= 0xFF;
+                    c += 2;
 
-                    if (c > 128)
-                    {
-                        c ^= 0xFF;
-                        c += 2;
+                    unsigned char value[4]; // To support 32-bit depth.
+                    SAIL_TRY(sail_buffered_reader_read(reader, value, bytes_per_sample));
 
-                        unsigned char value[4]; // To support 32-bit depth.
-                        SAIL_TRY(psd_state->io->strict_read(psd_state->io->stream, value, bytes_per_sample));
+                    /* Clamp to the buffer size. */
+                    c = (count + c) <= image->width ? c : (unsigned char)(image->width - count);
 
-                        /* Clamp to the buffer size. */
-                        c = (count + c) <= image->width ? c : (unsigned char)(image->width - count);
-
-                        for (unsigned i = count; i < count + c; i++)
+                    for (unsigned i = count; i < count + c; i++)
+                    {
+                        unsigned char* scan = (unsigned char*)sail_scan_line(image, row) + i * bytes_per_pixel;
+                        for (unsigned b = 0; b < bytes_per_sample; b++)
                         {
-                            unsigned char* scan = (unsigned char*)sail_scan_line(image, row) + i * bytes_per_pixel;
-                            for (unsigned b = 0; b < bytes_per_sample; b++)
-                            {
-                                *(scan + channel * bytes_per_sample + b) = value[b];
-                            }
+                            *(scan + channel * bytes_per_sample + b) = value[b];
                         }
-
-                        count += c;
                     }
-                    else if (c < 128)
-                    {
-                        c++;
 
-                        /* Clamp to the buffer size. */
-                        unsigned actual_count = (count + c) <= image->width ? c : (image->width - count);
+                    count += c;
+                }
+                else if (c < 128)
+                {
+                    c++;
 
-                        for (unsigned i = 0; i < actual_count; i++)
-                        {
-                            unsigned char value[4]; // To support 32-bit depth.
-                            SAIL_TRY(psd_state->io->strict_read(psd_state->io->stream, value, bytes_per_sample));
-
-                            unsigned char* scan = (unsigned char*)sail_scan_line(image, row) + (count + i) * bytes_per_pixel;
-                            for (unsigned b = 0; b < bytes_per_sample; b++)
-                            {
-                                *(scan + channel * bytes_per_sample + b) = value[b];
-                            }
-                        }
+                    /* Clamp to the buffer size. */
+                    unsigned actual_count = (count + c) <= image->width ? c : (image->width - count);
+
+                    for (unsigned i = 0; i < actual_count; i++)
+                    {
+                        unsigned char value[4]; // To support 32-bit depth.
+                        SAIL_TRY(sail_buffered_reader_read(reader, value, bytes_per_sample));
 
-                        /* Skip remaining bytes if we had to truncate. */
-                        if (actual_count < c)
+                        unsigned char* scan = (unsigned char*)sail_scan_line(image, row) + (count + i) * bytes_per_pixel;
+                        for (unsigned b = 0; b < bytes_per_sample; b++)
                         {
-                            SAIL_TRY(psd_state->io->seek(psd_state->io->stream, (long)((unsigned)c - actual_count) * bytes_per_sample,
-                                                         SEEK_CUR));
+                            *(scan + channel * bytes_per_sample + b) = value[b];
                         }
+                    }
 
-                        count += c;
+                    /* Skip remaining bytes if we had to truncate. */
+                    if (actual_count < c)
+                    {
+                        SAIL_TRY(sail_buffered_reader_seek(reader, (long)((unsigned)c - actual_count) * bytes_per_sample,
+                                                           SEEK_CUR));
                     }
-                    /* c == 128 is NOP, do nothing. */
+
+                    count += c;
                 }
+                /* c == 128 is NOP, do nothing. */
             }
         }
     }
+
+    return SAIL_OK;
+}
+
+SAIL_EXPORT sail_status_t sail_codec_load_frame_v8_psd(void* state, struct sail_image* image)
+{
+    const struct psd_state* psd_state = state;
+
+    const unsigned bytes_per_pixel = (sail_bits_per_pixel(image->pixel_format) + 7) / 8;
+
+    if (psd_state->thumbnail != NULL)
+    {
+        const unsigned row_size = sail_bytes_per_line(image->width, image->pixel_format);
+
+        for (unsigned row = 0; row < image->height; row++)
+        {
+            memcpy(sail_scan_line(image, row), sail_scan_line(psd_state->thumbnail, row), row_size);
+        }
+    }
+    else if (psd_state->compression == SAIL_PSD_COMPRESSION_RLE)
+    {
+        /* RLE data is parsed byte by byte, so buffer it. */
+        struct sail_buffered_reader* reader;
+        SAIL_TRY(sail_alloc_buffered_reader(psd_state->io, 0, &reader));
+
+        /* The frame is the last thing PSD reads, so the read-ahead is not given back with a seek. */
+        SAIL_TRY_OR_CLEANUP(load_rle_frame(psd_state, reader, image),
+                            /* cleanup */ sail_destroy_buffered_reader(reader));
+
+        sail_destroy_buffered_reader(reader);
+    }
     else
     {
         for (unsigned channel = 0; channel < psd_state->channels; channel++)
@@ -50,10 +50,8 @@ struct qoi_state
 
     bool frame_processed;
 
-    void* image_data;
-    size_t image_data_size;
-    void* pixels;
-    int encoded_size;
+    struct sail_buffered_reader* reader;
+    unsigned char* row_chunks;
 
     qoi_desc qoi_desc;
 };
@@ -74,10 +72,8 @@ static sail_status_t alloc_qoi_state(struct sail_io* io,
 
         .frame_processed = false,
 
-        .image_data      = NULL,
-        .image_data_size = 0,
-        .pixels          = NULL,
-        .encoded_size    = 0,
+        .reader     = NULL,
+        .row_chunks = NULL,
     };
 
     return SAIL_OK;
@@ -90,12 +86,25 @@ static void destroy_qoi_state(struct qoi_state* qoi_state)
         return;
     }
 
-    sail_free(qoi_state->image_data);
-    sail_free(qoi_state->pixels);
+    sail_destroy_buffered_reader(qoi_state->reader);
+    sail_free(qoi_state->row_chunks);
 
     sail_free(qoi_state);
 }
 
+static unsigned read_big_endian_uint32(const unsigned char* data)
+{
+    return (unsigned)data[0] << 24 | (unsigned)data[1] << 16 | (unsigned)data[2] << 8 | data[3];
+}
+
+static void write_big_endian_uint32(unsigned char* data, unsigned value)
+{
+    data[0] = (unsigned char)(value >> 24);
+    data[1] = (unsigned char)(value >> 16);
+    data[2] = (unsigned char)(value >> 8);
+    data[3] = (unsigned char)value;
+}
+
 /*
  * Decoding functions.
  */
@@ -111,8 +120,12 @@ SAIL_EXPORT sail_status_t sail_codec_load_init_v8_qoi(struct sail_io* io,
     SAIL_TRY(alloc_qoi_state(io, load_options, NULL, &qoi_state));
     *state = qoi_state;
 
-    /* Cache the entire file as the QOI API requires. */
-    SAIL_TRY(sail_alloc_data_from_io_contents(io, &qoi_state->image_data, &qoi_state->image_data_size));
+    /*
+     * The QOI API decodes the entire file at once. Decode the chunks while reading instead,
+     * so rows are decoded straight into the image or the row band. QOI chunks are parsed byte by byte,
+     * so buffer them.
+     */
+    SAIL_TRY(sail_alloc_buffered_reader(io, 0, &qoi_state->reader));
 
     return SAIL_OK;
 }
@@ -128,13 +141,27 @@ SAIL_EXPORT sail_status_t sail_codec_load_seek_next_frame_v8_qoi(void* state, st
 
     qoi_state->frame_processed = true;
 
-    /* Decode the image. */
-    /* TODO Remove (int) when QOI supports size_t. */
-    qoi_state->pixels = qoi_decode(qoi_state->image_data, (int)qoi_state->image_data_size, &qoi_state->qoi_desc, 0);
+    /* Read the header. */
+    unsigned char header[QOI_HEADER_SIZE];
+    SAIL_TRY(sail_buffered_reader_read(qoi_state->reader, header, sizeof(header)));
+
+    const unsigned magic = read_big_endian_uint32(header);
+
+    qoi_state->qoi_desc.width      = read_big_endian_uint32(header + 4);
+    qoi_state->qoi_desc.height     = read_big_endian_uint32(header + 8);
+    qoi_state->qoi_desc.channels   = header[12];
+    qoi_state->qoi_desc.colorspace = header[13];
+
+    if (magic != QOI_MAGIC)
+    {
+        SAIL_LOG_ERROR("QOI: Invalid magic 0x%X (expected 0x%X)", magic, QOI_MAGIC);
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_INVALID_IMAGE);
+    }
 
-    if (qoi_state->pixels == NULL)
+    if (qoi_state->qoi_desc.width == 0 || qoi_state->qoi_desc.height == 0
+        || qoi_state->qoi_desc.height >= QOI_PIXELS_MAX / qoi_state->qoi_desc.width)
     {
-        SAIL_LOG_ERROR("QOI: Image is broken without any details");
+        SAIL_LOG_ERROR("QOI: Invalid dimensions %ux%u", qoi_state->qoi_desc.width, qoi_state->qoi_desc.height);
         SAIL_LOG_AND_RETURN(SAIL_ERROR_INVALID_IMAGE);
     }
 
@@ -184,10 +211,74 @@ SAIL_EXPORT sail_status_t sail_codec_load_frame_v8_qoi(void* state, struct sail_
 {
     const struct qoi_state* qoi_state = state;
 
-    size_t pixels_size;
-    SAIL_TRY(sail_pixels_buffer_size(image->height, image->bytes_per_line, &pixels_size));
+    struct sail_buffered_reader* reader = qoi_state->reader;
+    const unsigned channels             = qoi_state->qoi_desc.channels;
 
-    memcpy(image->pixels, qoi_state->pixels, pixels_size);
+    /* The same decoding as in qoi_decode(), but chunk by chunk. */
+    qoi_rgba_t index[64];
+    memset(index, 0, sizeof(index));
+
+    qoi_rgba_t px = {.rgba = {.r = 0, .g = 0, .b = 0, .a = 255}};
+    unsigned run  = 0;
+
+    for (unsigned row = 0; row < image->height; row++)
+    {
+        void* scan_line;
+        SAIL_TRY(sail_load_scan_line(qoi_state->load_options, image, row, &scan_line));
+
+        unsigned char* scan = scan_line;
+
+        for (unsigned column = 0; column < image->width; column++)
+        {
+            if (run > 0)
+            {
+                run--;
+            }
+            else
+            {
+                unsigned char b1;
+                SAIL_TRY(sail_buffered_reader_get_byte(reader, &b1));
+
+                if (b1 == QOI_OP_RGB)
+                {
+                    SAIL_TRY(sail_buffered_reader_read(reader, &px.rgba, 3));
+                }
+                else if (b1 == QOI_OP_RGBA)
+                {
+                    SAIL_TRY(sail_buffered_reader_read(reader, &px.rgba, 4));
+                }
+                else if ((b1 & QOI_MASK_2) == QOI_OP_INDEX)
+                {
+                    px = index[b1];
+                }
+                else if ((b1 & QOI_MASK_2) == QOI_OP_DIFF)
+                {
+                    px.rgba.r += ((b1 >> 4) & 0x03) - 2;
+                    px.rgba.g += ((b1 >> 2) & 0x03) - 2;
+                    px.rgba.b += (b1 & 0x03) - 2;
+                }
+                else if ((b1 & QOI_MASK_2) == QOI_OP_LUMA)
+                {
+                    unsigned char b2;
+                    SAIL_TRY(sail_buffered_reader_get_byte(reader, &b2));
+
+                    const int vg = (b1 & 0x3f) - 32;
+                    px.rgba.r += vg - 8 + ((b2 >> 4) & 0x0f);
+                    px.rgba.g += vg;
+                    px.rgba.b += vg - 8 + (b2 & 0x0f);
+                }
+                else
+                {
+                    run = b1 & 0x3f;
+                }
+
+                index[QOI_COLOR_HASH(px) & (64 - 1)] = px;
+            }
+
+            memcpy(scan, &px.rgba, channels);
+            scan += channels;
+        }
+    }
 
     return SAIL_OK;
 }
@@ -231,6 +322,13 @@ SAIL_EXPORT sail_status_t sail_codec_save_seek_next_frame_v8_qoi(void* state, co
 {
     struct qoi_state* qoi_state = state;
 
+    if (qoi_state->frame_processed)
+    {
+        return SAIL_ERROR_NO_MORE_FRAMES;
+    }
+
+    qoi_state->frame_processed = true;
+
     unsigned char channels;
 
     switch (image->pixel_format)
@@ -245,27 +343,147 @@ SAIL_EXPORT sail_status_t sail_codec_save_seek_next_frame_v8_qoi(void* state, co
     }
     }
 
-    qoi_state->pixels = qoi_encode(
-        image->pixels,
-        &(qoi_desc){.width = image->width, .height = image->height, .channels = channels, .colorspace = QOI_SRGB},
-        &qoi_state->encoded_size);
-
-    if (qoi_state->pixels == NULL)
+    if (image->width == 0 || image->height == 0 || image->height >= QOI_PIXELS_MAX / image->width)
     {
-        SAIL_LOG_ERROR("QOI: Encoding failed without any details");
-        SAIL_LOG_AND_RETURN(SAIL_ERROR_UNDERLYING_CODEC);
+        SAIL_LOG_ERROR("QOI: Invalid dimensions %ux%u", image->width, image->height);
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_INVALID_IMAGE_DIMENSIONS);
     }
 
+    qoi_state->qoi_desc = (qoi_desc){
+        .width      = image->width,
+        .height     = image->height,
+        .channels   = channels,
+        .colorspace = QOI_SRGB,
+    };
+
+    /*
+     * The QOI API encodes the entire frame into memory at once. Encode the chunks row by row instead.
+     * A pixel takes up to 5 bytes, and the last row also holds the end marker.
+     */
+    SAIL_TRY(sail_malloc((size_t)image->width * 5 + sizeof(qoi_padding), (void**)&qoi_state->row_chunks));
+
+    unsigned char header[QOI_HEADER_SIZE];
+    write_big_endian_uint32(header, QOI_MAGIC);
+    write_big_endian_uint32(header + 4, image->width);
+    write_big_endian_uint32(header + 8, image->height);
+    header[12] = channels;
+    header[13] = QOI_SRGB;
+
+    SAIL_TRY(qoi_state->io->strict_write(qoi_state->io->stream, header, sizeof(header)));
+
     return SAIL_OK;
 }
 
 SAIL_EXPORT sail_status_t sail_codec_save_frame_v8_qoi(void* state, const struct sail_image* image)
 {
-    struct qoi_state* qoi_state = state;
+    const struct qoi_state* qoi_state = state;
 
-    (void)image; /* Not used in this implementation */
+    const unsigned channels = qoi_state->qoi_desc.channels;
 
-    SAIL_TRY(qoi_state->io->strict_write(qoi_state->io->stream, qoi_state->pixels, qoi_state->encoded_size));
+    /* The same encoding as in qoi_encode(), but row by row. */
+    qoi_rgba_t index[64];
+    memset(index, 0, sizeof(index));
+
+    qoi_rgba_t px_prev = {.rgba = {.r = 0, .g = 0, .b = 0, .a = 255}};
+    qoi_rgba_t px      = px_prev;
+    unsigned run       = 0;
+
+    for (unsigned row = 0; row < image->height; row++)
+    {
+        const void* scan_line;
+        SAIL_TRY(sail_save_scan_line(qoi_state->save_options, image, row, &scan_line));
+
+        const unsigned char* scan = scan_line;
+        unsigned char* chunks     = qoi_state->row_chunks;
+
+        for (unsigned column = 0; column < image->width; column++, scan += channels)
+        {
+            px.rgba.r = scan[0];
+            px.rgba.g = scan[1];
+            px.rgba.b = scan[2];
+
+            if (channels == 4)
+            {
+                px.rgba.a = scan[3];
+            }
+
+            if (px.v == px_prev.v)
+            {
+                run++;
+
+                if (run == 62 || (row == image->height - 1 && column == image->width - 1))
+                {
+                    *chunks++ = (unsigned char)(QOI_OP_RUN | (run - 1));
+                    run       = 0;
+                }
+            }
+            else
+            {
+                if (run > 0)
+                {
+                    *chunks++ = (unsigned char)(QOI_OP_RUN | (run - 1));
+                    run       = 0;
+                }
+
+                const unsigned index_pos = QOI_COLOR_HASH(px) & (64 - 1);
+
+                if (index[index_pos].v == px.v)
+                {
+                    *chunks++ = (unsigned char)(QOI_OP_INDEX | index_pos);
+                }
+                else
+                {
+                    index[index_pos] = px;
+
+                    if (px.rgba.a == px_prev.rgba.a)
+                    {
+                        const signed char vr = (signed char)(px.rgba.r - px_prev.rgba.r);
+                        const signed char vg = (signed char)(px.rgba.g - px_prev.rgba.g);
+                        const signed char vb = (signed char)(px.rgba.b - px_prev.rgba.b);
+
+                        const signed char vg_r = (signed char)(vr - vg);
+                        const signed char vg_b = (signed char)(vb - vg);
+
+                        if (vr > -3 && vr < 2 && vg > -3 && vg < 2 && vb > -3 && vb < 2)
+                        {
+                            *chunks++ = (unsigned char)(QOI_OP_DIFF | (vr + 2) << 4 | (vg + 2) << 2 | (vb + 2));
+                        }
+                        else if (vg_r > -9 && vg_r < 8 && vg > -33 && vg < 32 && vg_b > -9 && vg_b < 8)
+                        {
+                            *chunks++ = (unsigned char)(QOI_OP_LUMA | (vg + 32));
+                            *chunks++ = (unsigned char)((vg_r + 8) << 4 | (vg_b + 8));
+                        }
+                        else
+                        {
+                            *chunks++ = QOI_OP_RGB;
+                            *chunks++ = px.rgba.r;
+                            *chunks++ = px.rgba.g;
+                            *chunks++ = px.rgba.b;
+                        }
+                    }
+                    else
+                    {
+                        *chunks++ = QOI_OP_RGBA;
+                        *chunks++ = px.rgba.r;
+                        *chunks++ = px.rgba.g;
+                        *chunks++ = px.rgba.b;
+                        *chunks++ = px.rgba.a;
+                    }
+                }
+            }
+
+            px_prev = px;
+        }
+
+        if (row == image->height - 1)
+        {
+            memcpy(chunks, qoi_padding, sizeof(qoi_padding));
+            chunks += sizeof(qoi_padding);
+        }
+
+        SAIL_TRY(qoi_state->io->strict_write(qoi_state->io->stream, qoi_state->row_chunks,
+                                             (size_t)(chunks - qoi_state->row_chunks)));
+    }
 
     return SAIL_OK;
 }
@@ -66,6 +66,35 @@ enum SailPixelFormat raw_private_libraw_to_pixel_format(unsigned colors, unsigne
     return SAIL_PIXEL_FORMAT_UNKNOWN;
 }
 
+/*
+ * Predicts the number of colors in the image dcraw_make_mem_image() returns from the processing parameters,
+ * the same way dcraw_process() changes them: Bayer RGB data gets a fourth color when four_color_rgb or half_size
+ * is set, and mix_green merges it back when just one of them is set. Conversion to an output color space
+ * drops the fourth color. Raw colors (output_color 0) keep it.
+ */
+unsigned raw_private_output_colors(const libraw_data_t* raw_data)
+{
+    unsigned colors = raw_data->idata.colors;
+
+    if (raw_data->idata.filters > 999 && colors == 3)
+    {
+        const bool four_color_rgb = raw_data->params.four_color_rgb != 0;
+        const bool half_size      = raw_data->params.half_size != 0;
+
+        if (four_color_rgb && half_size)
+        {
+            colors = 4;
+        }
+    }
+
+    if (colors == 4 && raw_data->params.output_color != 0)
+    {
+        colors = 3;
+    }
+
+    return colors;
+}
+
 static sail_status_t add_string_meta_data(enum SailMetaData key,
                                           const char* value,
                                           struct sail_meta_data_node*** last_meta_data_node)
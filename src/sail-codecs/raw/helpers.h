@@ -38,6 +38,8 @@ struct sail_resolution;
 
 SAIL_HIDDEN enum SailPixelFormat raw_private_libraw_to_pixel_format(unsigned colors, unsigned bits);
 
+SAIL_HIDDEN unsigned raw_private_output_colors(const libraw_data_t* raw_data);
+
 SAIL_HIDDEN sail_status_t raw_private_fetch_meta_data(libraw_data_t* raw_data,
                                                       struct sail_meta_data_node** meta_data_node,
                                                       const std::vector<unsigned char>& exif_data);
@@ -67,9 +67,15 @@ struct raw_state
 
     std::unique_ptr<LibRaw> raw_processor;
     libraw_processed_image_t* processed_image;
+    // Decoded JPEG preview.
+    struct sail_image* thumbnail;
     std::unique_ptr<LibRaw_abstract_datastream> datastream;
     std::vector<unsigned char> exif_data;
     bool frame_processed;
+
+    // Output dimensions without the half-size reduction.
+    unsigned source_width;
+    unsigned source_height;
 };
 
 static sail_status_t alloc_raw_state(struct sail_io* io,
@@ -83,9 +89,12 @@ static sail_status_t alloc_raw_state(struct sail_io* io,
         save_options,                                    // save_options
         std::unique_ptr<LibRaw>(),                       // raw_processor
         nullptr,                                         // processed_image
+        nullptr,                                         // thumbnail
         std::unique_ptr<sail::raw::SailRawDatastream>(), // datastream
         {},                                              // exif_data
-        false                                            // frame_processed
+        false,                                           // frame_processed
+        0,                                               // source_width
+        0                                                // source_height
     };
 
     return SAIL_OK;
@@ -103,6 +112,8 @@ static void destroy_raw_state(struct raw_state* raw_state)
         libraw_dcraw_clear_mem(raw_state->processed_image);
     }
 
+    sail_destroy_image(raw_state->thumbnail);
+
     delete raw_state;
 }
 
@@ -153,6 +164,61 @@ extern "C" SAIL_EXPORT sail_status_t sail_codec_load_init_v8_raw(struct sail_io*
         SAIL_LOG_ERROR("RAW: %s", libraw_strerror(ret));
         SAIL_LOG_AND_RETURN(SAIL_ERROR_UNDERLYING_CODEC);
     }
+
+    // Demosaic at half size when it still covers the requested size. It's much cheaper than the full interpolation.
+    {
+        int width, height, colors, bps;
+        raw_state->raw_processor->get_mem_image_format(&width, &height, &colors, &bps);
+
+        raw_state->source_width  = static_cast<unsigned>(width);
+        raw_state->source_height = static_cast<unsigned>(height);
+
+        if (sail_reduction_from_load_options(load_options, raw_state->source_width, raw_state->source_height, 2) == 2)
+        {
+            raw_state->raw_processor->imgdata.params.half_size = 1;
+        }
+    }
+
+    // Load the embedded preview instead when it still covers the requested size. JPEG previews,
+    // the most common ones, are decoded with the JPEG codec.
+    if (raw_state->load_options->options & SAIL_OPTION_THUMBNAIL)
+    {
+        const libraw_thumbnail_t& thumbnail = raw_state->raw_processor->imgdata.thumbnail;
+
+        if (thumbnail.twidth >= load_options->max_width && thumbnail.theight >= load_options->max_height
+            && thumbnail.twidth > 0 && thumbnail.theight > 0
+            && (thumbnail.twidth < raw_state->source_width || thumbnail.theight < raw_state->source_height)
+            && raw_state->raw_processor->unpack_thumb() == LIBRAW_SUCCESS
+            && (thumbnail.tformat == LIBRAW_THUMBNAIL_BITMAP || thumbnail.tformat == LIBRAW_THUMBNAIL_JPEG))
+        {
+            libraw_processed_image_t* processed = raw_state->raw_processor->dcraw_make_mem_thumb(&ret);
+
+            if (processed != NULL && processed->type == LIBRAW_IMAGE_BITMAP)
+            {
+                raw_state->processed_image = processed;
+                return SAIL_OK;
+            }
+
+            if (processed != NULL && processed->type == LIBRAW_IMAGE_JPEG
+                && sail_load_embedded_image(processed->data, processed->data_size, &raw_state->thumbnail) == SAIL_OK)
+            {
+                libraw_dcraw_clear_mem(processed);
+                return SAIL_OK;
+            }
+
+            if (processed != NULL)
+            {
+                libraw_dcraw_clear_mem(processed);
+            }
+        }
+    }
+
+    // Probing needs just the metadata parsed by open_datastream(). Don't unpack and process the raw data.
+    if (raw_state->load_options->options & SAIL_OPTION_PROBE)
+    {
+        return SAIL_OK;
+    }
+
     if (ret = raw_state->raw_processor->unpack(); ret != LIBRAW_SUCCESS)
     {
         SAIL_LOG_ERROR("RAW: %s", libraw_strerror(ret));
@@ -195,15 +261,49 @@ extern "C" SAIL_EXPORT sail_status_t sail_codec_load_seek_next_frame_v8_raw(void
                             /* cleanup */ sail_destroy_image(image_local));
     }
 
-    libraw_processed_image_t* processed = raw_state->processed_image;
+    unsigned bits_per_pixel = 0;
+    unsigned colors         = 0;
 
-    image_local->width  = processed->width;
-    image_local->height = processed->height;
+    if (raw_state->thumbnail != NULL)
+    {
+        image_local->width        = raw_state->thumbnail->width;
+        image_local->height       = raw_state->thumbnail->height;
+        image_local->pixel_format = raw_state->thumbnail->pixel_format;
+    }
+    else if (raw_state->processed_image != NULL)
+    {
+        libraw_processed_image_t* processed = raw_state->processed_image;
+
+        image_local->width  = processed->width;
+        image_local->height = processed->height;
+
+        bits_per_pixel = processed->bits;
+        colors         = processed->colors;
+    }
+    else
+    {
+        // Probing. Predict the output image format from the processing parameters without processing.
+        int width, height, colors_local, bps;
+        raw_state->raw_processor->get_mem_image_format(&width, &height, &colors_local, &bps);
+
+        image_local->width  = static_cast<unsigned>(width);
+        image_local->height = static_cast<unsigned>(height);
+
+        // half_size takes effect in dcraw_process(). Predict the halved dimensions.
+        if (raw_state->raw_processor->imgdata.params.half_size)
+        {
+            image_local->width  = (raw_state->source_width + 1) / 2;
+            image_local->height = (raw_state->source_height + 1) / 2;
+        }
 
-    unsigned bits_per_pixel = processed->bits;
-    unsigned colors         = processed->colors;
+        bits_per_pixel = static_cast<unsigned>(bps);
+        colors         = raw_private_output_colors(&raw_state->raw_processor->imgdata);
+    }
 
-    image_local->pixel_format = raw_private_libraw_to_pixel_format(colors, bits_per_pixel);
+    if (raw_state->thumbnail == NULL)
+    {
+        image_local->pixel_format = raw_private_libraw_to_pixel_format(colors, bits_per_pixel);
+    }
 
     if (image_local->pixel_format == SAIL_PIXEL_FORMAT_UNKNOWN)
     {
@@ -217,6 +317,8 @@ extern "C" SAIL_EXPORT sail_status_t sail_codec_load_seek_next_frame_v8_raw(void
     if (raw_state->load_options->options & SAIL_OPTION_SOURCE_IMAGE)
     {
         image_local->source_image->pixel_format = image_local->pixel_format;
+        image_local->source_image->width        = raw_state->source_width;
+        image_local->source_image->height       = raw_state->source_height;
 
         if (image_local->source_image->special_properties == NULL)
         {
@@ -245,6 +347,18 @@ extern "C" SAIL_EXPORT sail_status_t sail_codec_load_frame_v8_raw(void* state, s
 {
     struct raw_state* raw_state = static_cast<struct raw_state*>(state);
 
+    if (raw_state->thumbnail != NULL)
+    {
+        const unsigned row_size = sail_bytes_per_line(image->width, image->pixel_format);
+
+        for (unsigned row = 0; row < image->height; row++)
+        {
+            memcpy(sail_scan_line(image, row), sail_scan_line(raw_state->thumbnail, row), row_size);
+        }
+
+        return SAIL_OK;
+    }
+
     libraw_processed_image_t* processed = raw_state->processed_image;
 
     unsigned bytes_per_pixel = processed->colors * (processed->bits / 8);
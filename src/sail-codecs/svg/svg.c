@@ -122,23 +122,19 @@ SAIL_EXPORT sail_status_t sail_codec_load_init_v8_svg(struct sail_io* io,
     SAIL_TRY(alloc_svg_state(load_options, NULL, &svg_state));
     *state = svg_state;
 
-    /* Read the entire image. */
+#ifdef SAIL_RESVG
+    /* Read the entire image. Borrow it from memory-backed I/O objects without copying. */
+    const void* image_data;
     size_t image_size;
-    SAIL_TRY(sail_io_size(io, &image_size));
-
-    void* image_data;
-    SAIL_TRY(sail_malloc(image_size + 1, &image_data)); /* Allocate +1 byte for '\0' (for nsvgParse). */
+    void* image_data_to_free;
+    SAIL_TRY(sail_borrow_or_alloc_data_from_io_contents(io, &image_data, &image_size, &image_data_to_free));
 
-    SAIL_TRY_OR_CLEANUP(sail_io_contents_into_data(io, image_data),
-                        /* cleanup */ sail_free(image_data));
-
-#ifdef SAIL_RESVG
     svg_state->resvg_options = resvg_options_create();
 
     const int result =
         resvg_parse_tree_from_data(image_data, image_size, svg_state->resvg_options, &svg_state->resvg_tree);
 
-    sail_free(image_data);
+    sail_free(image_data_to_free);
 
     if (result != RESVG_OK)
     {
@@ -146,6 +142,16 @@ SAIL_EXPORT sail_status_t sail_codec_load_init_v8_svg(struct sail_io* io,
         SAIL_LOG_AND_RETURN(SAIL_ERROR_INVALID_IMAGE);
     }
 #else
+    /* Read the entire image. nsvgParse() modifies the input, so it must be copied. */
+    size_t image_size;
+    SAIL_TRY(sail_io_size(io, &image_size));
+
+    void* image_data;
+    SAIL_TRY(sail_malloc(image_size + 1, &image_data)); /* Allocate +1 byte for '\0' (for nsvgParse). */
+
+    SAIL_TRY_OR_CLEANUP(sail_io_contents_into_data(io, image_data),
+                        /* cleanup */ sail_free(image_data));
+
     ((char*)image_data)[image_size] = '\0';
 
     svg_state->nsvg_image = nsvgParse(image_data, "px", 96.0f);
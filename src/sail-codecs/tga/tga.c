@@ -91,6 +91,83 @@ static void destroy_tga_state(struct tga_state* tga_state)
     sail_free(tga_state);
 }
 
+/* Reverses the order of pixels in the scan line. */
+static void mirror_row(unsigned char* scan_line, unsigned width, unsigned pixel_size)
+{
+    unsigned char pixel[4];
+
+    for (unsigned left = 0, right = width - 1; left < right; left++, right--)
+    {
+        unsigned char* left_pixel  = scan_line + (size_t)left * pixel_size;
+        unsigned char* right_pixel = scan_line + (size_t)right * pixel_size;
+
+        memcpy(pixel, left_pixel, pixel_size);
+        memcpy(left_pixel, right_pixel, pixel_size);
+        memcpy(right_pixel, pixel, pixel_size);
+    }
+}
+
+/* Writes the scan line as RLE packets. Packets never cross scan lines as recommended by TGA 2.0. */
+static sail_status_t write_rle_row(struct sail_io* io, const unsigned char* pixels, unsigned width, unsigned pixel_size)
+{
+    for (unsigned i = 0; i < width;)
+    {
+        /* Look ahead for run length. */
+        unsigned run_length                = 1;
+        const unsigned char* current_pixel = pixels;
+
+        /* Check for RLE run (repeated pixels). */
+        while (run_length < 128 && (i + run_length) < width)
+        {
+            if (memcmp(current_pixel, current_pixel + (size_t)run_length * pixel_size, pixel_size) != 0)
+            {
+                break;
+            }
+            run_length++;
+        }
+
+        if (run_length > 1)
+        {
+            /* RLE packet: 1-bit flag (1) + 7-bit count. */
+            unsigned char marker = 0x80 | (unsigned char)(run_length - 1);
+            SAIL_TRY(io->strict_write(io->stream, &marker, 1));
+            SAIL_TRY(io->strict_write(io->stream, current_pixel, pixel_size));
+
+            pixels += (size_t)run_length * pixel_size;
+            i      += run_length;
+        }
+        else
+        {
+            /* Find raw run (non-repeated pixels). */
+            unsigned raw_length = 1;
+            while (raw_length < 128 && (i + raw_length) < width)
+            {
+                /* Check if next pixel starts a run. */
+                if (raw_length + 1 < 128 && (i + raw_length + 1) < width)
+                {
+                    if (memcmp(pixels + (size_t)raw_length * pixel_size, pixels + (size_t)(raw_length + 1) * pixel_size,
+                               pixel_size)
+                        == 0)
+                    {
+                        break;
+                    }
+                }
+                raw_length++;
+            }
+
+            /* Raw packet: 1-bit flag (0) + 7-bit count. */
+            unsigned char marker = (unsigned char)(raw_length - 1);
+            SAIL_TRY(io->strict_write(io->stream, &marker, 1));
+            SAIL_TRY(io->strict_write(io->stream, pixels, (size_t)raw_length * pixel_size));
+
+            pixels += (size_t)raw_length * pixel_size;
+            i      += raw_length;
+        }
+    }
+
+    return SAIL_OK;
+}
+
 /*
  * Decoding functions.
  */
@@ -260,79 +337,95 @@ SAIL_EXPORT sail_status_t sail_codec_load_frame_v8_tga(void* state, struct sail_
 {
     struct tga_state* tga_state = state;
 
-    size_t pixels_size;
-    SAIL_TRY(sail_pixels_buffer_size(image->height, image->bytes_per_line, &pixels_size));
+    const unsigned pixel_size = (sail_bits_per_pixel(image->pixel_format) + 7) / 8;
+    const unsigned row_size   = image->width * pixel_size;
+
+    bool rle;
 
     switch (tga_state->file_header.image_type)
     {
-    case TGA_INDEXED:
-    case TGA_TRUE_COLOR:
-    case TGA_GRAY:
-    {
-        SAIL_TRY(tga_state->io->strict_read(tga_state->io->stream, image->pixels, pixels_size));
-        break;
-    }
     case TGA_INDEXED_RLE:
     case TGA_TRUE_COLOR_RLE:
     case TGA_GRAY_RLE:
     {
-        const unsigned pixel_size = (sail_bits_per_pixel(image->pixel_format) + 7) / 8;
-        const unsigned pixels_num = image->width * image->height;
+        rle = true;
+        break;
+    }
+    default:
+    {
+        rle = false;
+        break;
+    }
+    }
 
-        unsigned char* pixels = image->pixels;
+    /* RLE packets may span scan lines, so the current packet is carried over to the next row. */
+    unsigned packet_left = 0;
+    bool packet_rle      = false;
+    unsigned char packet_pixel[4];
 
-        for (unsigned i = 0; i < pixels_num;)
-        {
-            unsigned char marker;
-            SAIL_TRY(tga_state->io->strict_read(tga_state->io->stream, &marker, 1));
+    for (unsigned i = 0; i < image->height; i++)
+    {
+        void* scan_line;
+        SAIL_TRY(sail_load_scan_line(tga_state->load_options, image, tga_state->flipped_v ? (image->height - 1 - i) : i,
+                                     &scan_line));
 
-            const unsigned packet_count = (marker & 0x7F) + 1;
-            const unsigned remaining    = pixels_num - i;
+        unsigned char* pixels = scan_line;
 
-            /* 7th bit set = RLE packet. */
-            if (marker & 0x80)
+        if (!rle)
+        {
+            SAIL_TRY(tga_state->io->strict_read(tga_state->io->stream, pixels, row_size));
+        }
+        else
+        {
+            for (unsigned column = 0; column < image->width;)
             {
-                unsigned char pixel[4];
+                if (packet_left == 0)
+                {
+                    unsigned char marker;
+                    SAIL_TRY(tga_state->io->strict_read(tga_state->io->stream, &marker, 1));
 
-                SAIL_TRY(tga_state->io->strict_read(tga_state->io->stream, pixel, pixel_size));
+                    packet_left = (marker & 0x7F) + 1;
 
-                const unsigned count = packet_count <= remaining ? packet_count : remaining;
+                    /* 7th bit set = RLE packet. */
+                    packet_rle = marker & 0x80;
 
-                for (unsigned j = 0; j < count; j++, i++)
-                {
-                    memcpy(pixels, pixel, pixel_size);
-                    pixels += pixel_size;
+                    if (packet_rle)
+                    {
+                        SAIL_TRY(tga_state->io->strict_read(tga_state->io->stream, packet_pixel, pixel_size));
+                    }
                 }
-            }
-            else
-            {
-                const unsigned count = packet_count <= remaining ? packet_count : remaining;
 
-                for (unsigned j = 0; j < count; j++, i++)
+                const unsigned count = (packet_left < image->width - column) ? packet_left : image->width - column;
+
+                if (packet_rle)
                 {
-                    SAIL_TRY(tga_state->io->strict_read(tga_state->io->stream, pixels, pixel_size));
-                    pixels += pixel_size;
+                    for (unsigned j = 0; j < count; j++)
+                    {
+                        memcpy(pixels, packet_pixel, pixel_size);
+                        pixels += pixel_size;
+                    }
                 }
-
-                if (count < packet_count)
+                else
                 {
-                    SAIL_TRY(tga_state->io->seek(tga_state->io->stream,
-                                                 (long)((packet_count - count) * pixel_size), SEEK_CUR));
+                    SAIL_TRY(tga_state->io->strict_read(tga_state->io->stream, pixels, (size_t)count * pixel_size));
+                    pixels += (size_t)count * pixel_size;
                 }
+
+                column      += count;
+                packet_left -= count;
             }
         }
-        break;
-    }
-    }
 
-    /* TODO: We can avoid this by putting pixels in reverse order like in the BMP codec. */
-    if (tga_state->flipped_v)
-    {
-        sail_mirror_vertically(image);
+        if (tga_state->flipped_h)
+        {
+            mirror_row(scan_line, image->width, pixel_size);
+        }
     }
-    if (tga_state->flipped_h)
+
+    /* Skip the rest of the last raw packet that doesn't fit into the image. */
+    if (packet_left > 0 && !packet_rle)
     {
-        sail_mirror_horizontally(image);
+        SAIL_TRY(tga_state->io->seek(tga_state->io->stream, (long)(packet_left * pixel_size), SEEK_CUR));
     }
 
     return SAIL_OK;
@@ -486,83 +579,24 @@ SAIL_EXPORT sail_status_t sail_codec_save_frame_v8_tga(void* state, const struct
 {
     struct tga_state* tga_state = state;
 
-    size_t pixels_size;
-    SAIL_TRY(sail_pixels_buffer_size(image->height, image->bytes_per_line, &pixels_size));
-
     const unsigned pixel_size = (tga_state->file_header.bpp + 7) / 8;
 
+    bool rle;
+
     switch (tga_state->file_header.image_type)
     {
     case TGA_INDEXED:
     case TGA_TRUE_COLOR:
     case TGA_GRAY:
     {
-        /* Write uncompressed pixel data. */
-        SAIL_TRY(tga_state->io->strict_write(tga_state->io->stream, image->pixels, pixels_size));
+        rle = false;
         break;
     }
     case TGA_INDEXED_RLE:
     case TGA_TRUE_COLOR_RLE:
     case TGA_GRAY_RLE:
     {
-        /* Write RLE compressed pixel data. */
-        const unsigned pixels_num   = image->width * image->height;
-        const unsigned char* pixels = image->pixels;
-
-        for (unsigned i = 0; i < pixels_num;)
-        {
-            /* Look ahead for run length. */
-            unsigned run_length                = 1;
-            const unsigned char* current_pixel = pixels;
-
-            /* Check for RLE run (repeated pixels). */
-            while (run_length < 128 && (i + run_length) < pixels_num)
-            {
-                if (memcmp(current_pixel, current_pixel + (size_t)run_length * pixel_size, pixel_size) != 0)
-                {
-                    break;
-                }
-                run_length++;
-            }
-
-            if (run_length > 1)
-            {
-                /* RLE packet: 1-bit flag (1) + 7-bit count. */
-                unsigned char marker = 0x80 | (unsigned char)(run_length - 1);
-                SAIL_TRY(tga_state->io->strict_write(tga_state->io->stream, &marker, 1));
-                SAIL_TRY(tga_state->io->strict_write(tga_state->io->stream, current_pixel, pixel_size));
-
-                pixels += (size_t)run_length * pixel_size;
-                i      += run_length;
-            }
-            else
-            {
-                /* Find raw run (non-repeated pixels). */
-                unsigned raw_length = 1;
-                while (raw_length < 128 && (i + raw_length) < pixels_num)
-                {
-                    /* Check if next pixel starts a run. */
-                    if (raw_length + 1 < 128 && (i + raw_length + 1) < pixels_num)
-                    {
-                        if (memcmp(pixels + (size_t)raw_length * pixel_size,
-                                   pixels + (size_t)(raw_length + 1) * pixel_size, pixel_size)
-                            == 0)
-                        {
-                            break;
-                        }
-                    }
-                    raw_length++;
-                }
-
-                /* Raw packet: 1-bit flag (0) + 7-bit count. */
-                unsigned char marker = (unsigned char)(raw_length - 1);
-                SAIL_TRY(tga_state->io->strict_write(tga_state->io->stream, &marker, 1));
-                SAIL_TRY(tga_state->io->strict_write(tga_state->io->stream, pixels, (size_t)raw_length * pixel_size));
-
-                pixels += (size_t)raw_length * pixel_size;
-                i      += raw_length;
-            }
-        }
+        rle = true;
         break;
     }
     default:
@@ -571,6 +605,22 @@ SAIL_EXPORT sail_status_t sail_codec_save_frame_v8_tga(void* state, const struct
     }
     }
 
+    for (unsigned row = 0; row < image->height; row++)
+    {
+        const void* scan_line;
+        SAIL_TRY(sail_save_scan_line(tga_state->save_options, image, row, &scan_line));
+
+        if (rle)
+        {
+            SAIL_TRY(write_rle_row(tga_state->io, scan_line, image->width, pixel_size));
+        }
+        else
+        {
+            /* Write uncompressed pixel data. */
+            SAIL_TRY(tga_state->io->strict_write(tga_state->io->stream, scan_line, image->bytes_per_line));
+        }
+    }
+
     /* Write extension area if meta data or gamma is present. */
     if ((tga_state->save_options->options & SAIL_OPTION_META_DATA && image->meta_data_node != NULL)
         || image->gamma != 0)
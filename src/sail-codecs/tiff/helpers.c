@@ -982,6 +982,50 @@ sail_status_t tiff_private_write_resolution(TIFF* tiff, const struct sail_resolu
     return SAIL_OK;
 }
 
+sail_status_t tiff_private_find_reduced_image(TIFF* tiff, const struct sail_load_options* load_options, int* directory)
+{
+    SAIL_CHECK_PTR(tiff);
+    SAIL_CHECK_PTR(load_options);
+    SAIL_CHECK_PTR(directory);
+
+    *directory = -1;
+
+    unsigned best_width  = 0;
+    unsigned best_height = 0;
+
+    for (tdir_t i = 0; TIFFSetDirectory(tiff, i); i++)
+    {
+        uint32_t subfile_type = 0;
+        uint32_t width;
+        uint32_t height;
+
+        if (!TIFFGetField(tiff, TIFFTAG_SUBFILETYPE, &subfile_type) || !(subfile_type & FILETYPE_REDUCEDIMAGE)
+            || !TIFFGetField(tiff, TIFFTAG_IMAGEWIDTH, &width) || !TIFFGetField(tiff, TIFFTAG_IMAGELENGTH, &height))
+        {
+            continue;
+        }
+
+        if (width < load_options->max_width || height < load_options->max_height)
+        {
+            continue;
+        }
+
+        if (*directory < 0 || (uint64_t)width * height < (uint64_t)best_width * best_height)
+        {
+            *directory  = i;
+            best_width  = width;
+            best_height = height;
+        }
+    }
+
+    if (!TIFFSetDirectory(tiff, 0))
+    {
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_UNDERLYING_CODEC);
+    }
+
+    return SAIL_OK;
+}
+
 bool tiff_private_tuning_key_value_callback(const char* key, const struct sail_variant* value, void* user_data)
 {
     TIFF* tiff = user_data;
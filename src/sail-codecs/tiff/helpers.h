@@ -36,6 +36,7 @@
 #include <sail-common/status.h>
 
 struct sail_iccp;
+struct sail_load_options;
 struct sail_meta_data_node;
 struct sail_resolution;
 struct sail_variant;
@@ -74,6 +75,14 @@ SAIL_HIDDEN sail_status_t tiff_private_fetch_resolution(TIFF* tiff, struct sail_
 
 SAIL_HIDDEN sail_status_t tiff_private_write_resolution(TIFF* tiff, const struct sail_resolution* resolution);
 
+/*
+ * Finds the smallest reduced-resolution directory that still covers the size hint in the load options.
+ * Assigns -1 when no such directory covers it. Leaves the TIFF positioned at the first directory.
+ */
+SAIL_HIDDEN sail_status_t tiff_private_find_reduced_image(TIFF* tiff,
+                                                          const struct sail_load_options* load_options,
+                                                          int* directory);
+
 SAIL_HIDDEN bool tiff_private_tuning_key_value_callback(const char* key,
                                                         const struct sail_variant* value,
                                                         void* user_data);
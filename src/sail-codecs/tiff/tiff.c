@@ -27,6 +27,7 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <tiffio.h>
 
@@ -35,6 +36,9 @@
 #include "helpers.h"
 #include "io.h"
 
+/* Strips of up to this many rows are decoded whole when loading whole frames. */
+static const uint32_t SAIL_TIFF_MAX_STRIP_ROWS = 64;
+
 /*
  * Codec-specific state.
  */
@@ -52,6 +56,17 @@ struct tiff_state
     uint16_t bits_per_sample;
     uint16_t samples_per_pixel;
     int line;
+
+    /* Region of interest of the current frame. */
+    unsigned crop_x;
+    unsigned crop_y;
+    unsigned frame_width;
+    unsigned frame_bytes_per_line;
+
+    /* Reduced-resolution directory loaded instead of the frames, and the first frame dimensions. */
+    int thumbnail_directory;
+    uint32_t source_width;
+    uint32_t source_height;
 };
 
 static sail_status_t alloc_tiff_state(const struct sail_load_options* load_options,
@@ -75,6 +90,15 @@ static sail_status_t alloc_tiff_state(const struct sail_load_options* load_optio
         .bits_per_sample   = 0,
         .samples_per_pixel = 0,
         .line              = 0,
+
+        .crop_x               = 0,
+        .crop_y               = 0,
+        .frame_width          = 0,
+        .frame_bytes_per_line = 0,
+
+        .thumbnail_directory = -1,
+        .source_width        = 0,
+        .source_height       = 0,
     };
 
     return SAIL_OK;
@@ -113,9 +137,12 @@ SAIL_EXPORT sail_status_t sail_codec_load_init_v8_tiff(struct sail_io* io,
      * 'r': reading operation
      * 'h': read TIFF header only
      * 'm': disable use of memory-mapped files
+     * 'O': load strip and tile offsets on demand, probing never needs them
      */
+    const char* mode = (load_options->options & SAIL_OPTION_PROBE) ? "rhmO" : "rhm";
+
     tiff_state->tiff =
-        TIFFClientOpen("sail-codec-tiff", "rhm", io, tiff_private_my_read_proc, tiff_private_my_write_proc,
+        TIFFClientOpen("sail-codec-tiff", mode, io, tiff_private_my_read_proc, tiff_private_my_write_proc,
                        tiff_private_my_seek_proc, tiff_private_my_dummy_close_proc, tiff_private_my_dummy_size_proc,
                        /* map */ NULL,
                        /* unmap */ NULL);
@@ -126,6 +153,15 @@ SAIL_EXPORT sail_status_t sail_codec_load_init_v8_tiff(struct sail_io* io,
         SAIL_LOG_AND_RETURN(SAIL_ERROR_UNDERLYING_CODEC);
     }
 
+    if (load_options->options & SAIL_OPTION_THUMBNAIL)
+    {
+        SAIL_TRY(tiff_private_find_reduced_image(tiff_state->tiff, load_options, &tiff_state->thumbnail_directory));
+
+        /* The header-only open doesn't read the first directory, the search above leaves it current. */
+        TIFFGetField(tiff_state->tiff, TIFFTAG_IMAGEWIDTH, &tiff_state->source_width);
+        TIFFGetField(tiff_state->tiff, TIFFTAG_IMAGELENGTH, &tiff_state->source_height);
+    }
+
     return SAIL_OK;
 }
 
@@ -141,12 +177,48 @@ SAIL_EXPORT sail_status_t sail_codec_load_seek_next_frame_v8_tiff(void* state, s
     struct sail_image* image_local;
     SAIL_TRY(sail_alloc_image(&image_local));
 
-    /* Start reading the next directory. */
-    if (!TIFFSetDirectory(tiff_state->tiff, tiff_state->current_frame++))
+    /* Resume at the recorded directory offset without walking the directory chain. */
+    unsigned resume_frame;
+    const struct sail_frame_index_entry* resume_entry;
+
+    if (sail_take_frame_to_resume(tiff_state->load_options, &resume_frame, &resume_entry))
     {
-        sail_destroy_image(image_local);
-        return SAIL_ERROR_NO_MORE_FRAMES;
+        if (!TIFFSetSubDirectory(tiff_state->tiff, (toff_t)resume_entry->offset))
+        {
+            SAIL_LOG_ERROR("TIFF: Failed to read the directory at offset %zu", resume_entry->offset);
+            sail_destroy_image(image_local);
+            SAIL_LOG_AND_RETURN(SAIL_ERROR_UNDERLYING_CODEC);
+        }
+
+        tiff_state->current_frame = (uint16_t)(resume_frame + 1);
     }
+    else
+    {
+        /* Start reading the next directory. A reduced-resolution directory is the only frame. */
+        tdir_t directory = tiff_state->current_frame++;
+
+        if (tiff_state->thumbnail_directory >= 0)
+        {
+            if (directory > 0)
+            {
+                sail_destroy_image(image_local);
+                return SAIL_ERROR_NO_MORE_FRAMES;
+            }
+
+            directory = (tdir_t)tiff_state->thumbnail_directory;
+        }
+
+        if (!TIFFSetDirectory(tiff_state->tiff, directory))
+        {
+            sail_destroy_image(image_local);
+            return SAIL_ERROR_NO_MORE_FRAMES;
+        }
+    }
+
+    /* Every directory is independent. */
+    SAIL_TRY_OR_CLEANUP(sail_record_frame(tiff_state->load_options, (size_t)TIFFCurrentDirOffset(tiff_state->tiff),
+                                          /* keyframe */ true, 0, NULL, 0),
+                        /* cleanup */ sail_destroy_image(image_local));
 
     /* Fill the image properties. */
     if (!TIFFGetField(tiff_state->tiff, TIFFTAG_IMAGEWIDTH, &image_local->width)
@@ -226,7 +298,19 @@ SAIL_EXPORT sail_status_t sail_codec_load_seek_next_frame_v8_tiff(void* state, s
         }
     }
 
-    image_local->pixel_format   = tiff_state->pixel_format;
+    image_local->pixel_format = tiff_state->pixel_format;
+
+    /* Region of interest. Whole strips above the region are never decoded. */
+    tiff_state->frame_width          = image_local->width;
+    tiff_state->frame_bytes_per_line = sail_bytes_per_line(image_local->width, image_local->pixel_format);
+    const unsigned frame_height      = image_local->height;
+
+    SAIL_TRY_OR_CLEANUP(sail_crop_rectangle_from_load_options(tiff_state->load_options, image_local->width,
+                                                              image_local->height, &tiff_state->crop_x,
+                                                              &tiff_state->crop_y, &image_local->width,
+                                                              &image_local->height),
+                        /* cleanup */ sail_destroy_image(image_local));
+
     image_local->bytes_per_line = sail_bytes_per_line(image_local->width, image_local->pixel_format);
 
     /* Source image. */
@@ -245,6 +329,10 @@ SAIL_EXPORT sail_status_t sail_codec_load_seek_next_frame_v8_tiff(void* state, s
 
         image_local->source_image->pixel_format = tiff_state->pixel_format;
         image_local->source_image->compression  = tiff_private_compression_to_sail_compression(compression);
+        image_local->source_image->width =
+            (tiff_state->thumbnail_directory >= 0) ? tiff_state->source_width : tiff_state->frame_width;
+        image_local->source_image->height =
+            (tiff_state->thumbnail_directory >= 0) ? tiff_state->source_height : frame_height;
     }
 
     *image = image_local;
@@ -252,39 +340,165 @@ SAIL_EXPORT sail_status_t sail_codec_load_seek_next_frame_v8_tiff(void* state, s
     return SAIL_OK;
 }
 
-SAIL_EXPORT sail_status_t sail_codec_load_frame_v8_tiff(void* state, struct sail_image* image)
+/*
+ * Copies the row of the frame to the scan line returned by sail_load_scan_line(), cropping it
+ * to the region of interest, and inverts PHOTOMETRIC_MINISWHITE values.
+ */
+static sail_status_t store_scan_line(const struct tiff_state* tiff_state,
+                                     const struct sail_image* image,
+                                     const void* frame_scan,
+                                     void* scan_line)
 {
-    struct tiff_state* tiff_state = state;
+    if (frame_scan != scan_line)
+    {
+        SAIL_TRY(sail_copy_pixels_rectangle(frame_scan, tiff_state->frame_bytes_per_line, image->pixel_format,
+                                            tiff_state->crop_x, 0, image->width, 1, scan_line,
+                                            image->bytes_per_line));
+    }
 
-    if (tiff_state->libtiff_error)
+    if (tiff_state->photometric == PHOTOMETRIC_MINISWHITE)
     {
-        SAIL_LOG_AND_RETURN(SAIL_ERROR_UNDERLYING_CODEC);
+        uint8_t* scan = scan_line;
+
+        for (unsigned i = 0; i < image->bytes_per_line; i++)
+        {
+            scan[i] = ~scan[i];
+        }
     }
 
-    /* Read scanlines one by one. */
-    for (unsigned row = 0; row < image->height; row++)
+    return SAIL_OK;
+}
+
+/*
+ * Reads whole strips with TIFFReadEncodedStrip(). It decodes every strip in a single call
+ * and never touches the strips above the region of interest.
+ */
+static sail_status_t load_strips(const struct tiff_state* tiff_state,
+                                 struct sail_image* image,
+                                 uint32_t rows_per_strip,
+                                 void* strip_buffer)
+{
+    const tmsize_t scanline_size = TIFFScanlineSize(tiff_state->tiff);
+
+    for (unsigned row = 0; row < image->height;)
     {
-        uint8_t* scan = sail_scan_line(image, row);
+        const uint32_t strip           = TIFFComputeStrip(tiff_state->tiff, tiff_state->crop_y + row, 0);
+        const unsigned strip_first_row = strip * rows_per_strip;
+
+        const tmsize_t strip_bytes = TIFFReadEncodedStrip(tiff_state->tiff, strip, strip_buffer, (tmsize_t)-1);
+        const unsigned strip_rows  = (strip_bytes > 0) ? (unsigned)(strip_bytes / scanline_size) : 0;
+
+        if (tiff_state->crop_y + row >= strip_first_row + strip_rows)
+        {
+            SAIL_LOG_ERROR("TIFF: Failed to read strip %u", strip);
+            SAIL_LOG_AND_RETURN(SAIL_ERROR_UNDERLYING_CODEC);
+        }
 
-        if (TIFFReadScanline(tiff_state->tiff, scan, row, 0) < 0)
+        for (; row < image->height && tiff_state->crop_y + row < strip_first_row + strip_rows; row++)
         {
-            SAIL_LOG_ERROR("TIFF: Failed to read scanline %u", row);
+            const uint8_t* frame_scan =
+                (const uint8_t*)strip_buffer + (size_t)(tiff_state->crop_y + row - strip_first_row) * scanline_size;
+
+            void* scan_line;
+            SAIL_TRY(sail_load_scan_line(tiff_state->load_options, image, row, &scan_line));
+
+            SAIL_TRY(store_scan_line(tiff_state, image, frame_scan, scan_line));
+        }
+    }
+
+    return SAIL_OK;
+}
+
+/*
+ * Reads scan lines one by one with TIFFReadScanline(). libtiff decodes a strip incrementally,
+ * so only a single scan line is buffered. Narrower regions are read into a full scan line first.
+ */
+static sail_status_t load_scan_lines(const struct tiff_state* tiff_state,
+                                     struct sail_image* image,
+                                     uint32_t rows_per_strip,
+                                     void* frame_scan)
+{
+    /*
+     * Most compressions cannot seek inside a strip, so decode the rows above the region
+     * starting from the beginning of its first strip.
+     */
+    const unsigned strip_first_row =
+        (rows_per_strip > 0) ? tiff_state->crop_y - tiff_state->crop_y % rows_per_strip : 0;
+
+    for (unsigned source_row = strip_first_row; source_row < tiff_state->crop_y; source_row++)
+    {
+        if (TIFFReadScanline(tiff_state->tiff, frame_scan, source_row, 0) < 0)
+        {
+            SAIL_LOG_ERROR("TIFF: Failed to read scanline %u", source_row);
             SAIL_LOG_AND_RETURN(SAIL_ERROR_UNDERLYING_CODEC);
         }
     }
 
-    /* Handle PHOTOMETRIC_MINISWHITE - invert the values. */
-    if (tiff_state->photometric == PHOTOMETRIC_MINISWHITE)
+    for (unsigned row = 0; row < image->height; row++)
     {
-        size_t pixels_size;
-        SAIL_TRY(sail_pixels_buffer_size(image->height, image->bytes_per_line, &pixels_size));
+        const unsigned source_row = tiff_state->crop_y + row;
+
+        void* scan_line;
+        SAIL_TRY(sail_load_scan_line(tiff_state->load_options, image, row, &scan_line));
 
-        for (size_t i = 0; i < pixels_size; i++)
+        void* target = (image->width == tiff_state->frame_width) ? scan_line : frame_scan;
+
+        if (TIFFReadScanline(tiff_state->tiff, target, source_row, 0) < 0)
         {
-            ((uint8_t*)image->pixels)[i] = ~((uint8_t*)image->pixels)[i];
+            SAIL_LOG_ERROR("TIFF: Failed to read scanline %u", source_row);
+            SAIL_LOG_AND_RETURN(SAIL_ERROR_UNDERLYING_CODEC);
         }
+
+        SAIL_TRY(store_scan_line(tiff_state, image, target, scan_line));
+    }
+
+    return SAIL_OK;
+}
+
+SAIL_EXPORT sail_status_t sail_codec_load_frame_v8_tiff(void* state, struct sail_image* image)
+{
+    struct tiff_state* tiff_state = state;
+
+    if (tiff_state->libtiff_error)
+    {
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_UNDERLYING_CODEC);
+    }
+
+    /*
+     * Decode whole strips only when a strip is small: not taller than the row band, or than
+     * SAIL_TIFF_MAX_STRIP_ROWS for whole frames. Large strips like a single compressed strip
+     * for the whole frame are decoded scan line by scan line instead, so the strip buffer
+     * never doubles the memory the frame itself needs.
+     */
+    uint32_t rows_per_strip = 0;
+    TIFFGetFieldDefaulted(tiff_state->tiff, TIFFTAG_ROWSPERSTRIP, &rows_per_strip);
+
+    const uint32_t max_strip_rows = sail_loading_row_bands(tiff_state->load_options)
+                                        ? sail_loading_row_band_rows(tiff_state->load_options)
+                                        : SAIL_TIFF_MAX_STRIP_ROWS;
+
+    const bool read_strips =
+        !TIFFIsTiled(tiff_state->tiff) && TIFFScanlineSize(tiff_state->tiff) > 0 && rows_per_strip <= max_strip_rows;
+
+    const size_t buffer_size =
+        read_strips ? (size_t)TIFFStripSize(tiff_state->tiff) : (size_t)TIFFScanlineSize(tiff_state->tiff);
+
+    void* buffer;
+    SAIL_TRY(sail_malloc(SAIL_MAX(buffer_size, tiff_state->frame_bytes_per_line), &buffer));
+
+    if (read_strips)
+    {
+        SAIL_TRY_OR_CLEANUP(load_strips(tiff_state, image, rows_per_strip, buffer),
+                            /* cleanup */ sail_free(buffer));
+    }
+    else
+    {
+        SAIL_TRY_OR_CLEANUP(load_scan_lines(tiff_state, image, rows_per_strip, buffer),
+                            /* cleanup */ sail_free(buffer));
     }
 
+    sail_free(buffer);
+
     return SAIL_OK;
 }
 
@@ -493,14 +707,43 @@ SAIL_EXPORT sail_status_t sail_codec_save_frame_v8_tiff(void* state, const struc
         SAIL_LOG_AND_RETURN(SAIL_ERROR_UNDERLYING_CODEC);
     }
 
+    /*
+     * libtiff accumulates scan lines into strips of TIFFDefaultStripSize() rows, so encoding
+     * row by row needs only one strip of memory.
+     *
+     * Predictors difference the scan line in place. Pass a copy then to keep the image intact.
+     */
+    uint16_t predictor = PREDICTOR_NONE;
+    TIFFGetField(tiff_state->tiff, TIFFTAG_PREDICTOR, &predictor);
+
+    void* scan_line_copy = NULL;
+
+    if (predictor != PREDICTOR_NONE)
+    {
+        SAIL_TRY(sail_malloc(image->bytes_per_line, &scan_line_copy));
+    }
+
     for (unsigned row = 0; row < image->height; row++)
     {
-        if (TIFFWriteScanline(tiff_state->tiff, sail_scan_line(image, row), tiff_state->line++, 0) < 0)
+        const void* scan_line;
+        SAIL_TRY_OR_CLEANUP(sail_save_scan_line(tiff_state->save_options, image, row, &scan_line),
+                            /* cleanup */ sail_free(scan_line_copy));
+
+        if (scan_line_copy != NULL)
         {
+            memcpy(scan_line_copy, scan_line, image->bytes_per_line);
+            scan_line = scan_line_copy;
+        }
+
+        if (TIFFWriteScanline(tiff_state->tiff, (void*)scan_line, tiff_state->line++, 0) < 0)
+        {
+            sail_free(scan_line_copy);
             SAIL_LOG_AND_RETURN(SAIL_ERROR_UNDERLYING_CODEC);
         }
     }
 
+    sail_free(scan_line_copy);
+
     if (!TIFFWriteDirectory(tiff_state->tiff))
     {
         SAIL_LOG_AND_RETURN(SAIL_ERROR_UNDERLYING_CODEC);
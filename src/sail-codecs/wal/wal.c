@@ -113,8 +113,25 @@ SAIL_EXPORT sail_status_t sail_codec_load_init_v8_wal(struct sail_io* io,
     /* Read WAL header. */
     SAIL_TRY(wal_private_read_file_header(wal_state->io, &wal_state->wal_header));
 
-    wal_state->width  = wal_state->wal_header.width;
-    wal_state->height = wal_state->wal_header.height;
+    /*
+     * Start from the smallest mipmap level that still covers the requested size. Mipmap dimensions
+     * are rounded down, unlike in sail_reduction_from_load_options(), so check them directly.
+     */
+    if (load_options->max_width > 0 || load_options->max_height > 0)
+    {
+        for (unsigned level = 1; level < 4; level++)
+        {
+            const unsigned width  = wal_state->wal_header.width >> level;
+            const unsigned height = wal_state->wal_header.height >> level;
+
+            if (width == 0 || height == 0 || width < load_options->max_width || height < load_options->max_height)
+            {
+                break;
+            }
+
+            wal_state->frame_number = level;
+        }
+    }
 
     return SAIL_OK;
 }
@@ -123,17 +140,23 @@ SAIL_EXPORT sail_status_t sail_codec_load_seek_next_frame_v8_wal(void* state, st
 {
     struct wal_state* wal_state = state;
 
-    if (wal_state->frame_number >= 4)
+    /* Resume at the recorded mipmap level. */
+    unsigned resume_frame;
+    const struct sail_frame_index_entry* resume_entry;
+
+    if (sail_take_frame_to_resume(wal_state->load_options, &resume_frame, &resume_entry))
     {
-        return SAIL_ERROR_NO_MORE_FRAMES;
+        wal_state->frame_number = (unsigned)resume_entry->offset;
     }
 
-    if (wal_state->frame_number > 0)
+    if (wal_state->frame_number >= 4)
     {
-        wal_state->width  /= 2;
-        wal_state->height /= 2;
+        return SAIL_ERROR_NO_MORE_FRAMES;
     }
 
+    wal_state->width  = wal_state->wal_header.width >> wal_state->frame_number;
+    wal_state->height = wal_state->wal_header.height >> wal_state->frame_number;
+
     /* Validate dimensions for this mipmap level. */
     if (wal_state->width == 0 || wal_state->height == 0)
     {
@@ -161,6 +184,8 @@ SAIL_EXPORT sail_status_t sail_codec_load_seek_next_frame_v8_wal(void* state, st
 
         image_local->source_image->pixel_format = SAIL_PIXEL_FORMAT_BPP8_INDEXED;
         image_local->source_image->compression  = SAIL_COMPRESSION_NONE;
+        image_local->source_image->width        = wal_state->wal_header.width;
+        image_local->source_image->height       = wal_state->wal_header.height;
     }
 
     image_local->width          = wal_state->width;
@@ -177,6 +202,11 @@ SAIL_EXPORT sail_status_t sail_codec_load_seek_next_frame_v8_wal(void* state, st
         wal_state->io->seek(wal_state->io->stream, wal_state->wal_header.offset[wal_state->frame_number], SEEK_SET),
         /* cleanup */ sail_destroy_image(image_local));
 
+    /* Every mipmap level is independent. */
+    SAIL_TRY_OR_CLEANUP(
+        sail_record_frame(wal_state->load_options, wal_state->frame_number, /* keyframe */ true, 0, NULL, 0),
+        /* cleanup */ sail_destroy_image(image_local));
+
     wal_state->frame_number++;
 
     *image = image_local;
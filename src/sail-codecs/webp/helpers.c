@@ -29,8 +29,247 @@
 
 #include <sail-common/sail-common.h>
 
+#ifdef SAIL_X86_KERNELS
+#include <immintrin.h>
+#endif
+
 #include "helpers.h"
 
+/*
+ * Private functions.
+ */
+
+/*
+ * Blending 8-bit RGBA pixels over the previous frame. The SIMD variants compute the same
+ * double expressions per component as the scalar one, so they produce identical pixels.
+ */
+typedef void (*blend_over_rgba32_func_t)(uint8_t* dst, const uint8_t* src, unsigned width);
+
+static void blend_over_rgba32_scalar(uint8_t* dst, const uint8_t* src, unsigned width)
+{
+    while (width--)
+    {
+        const double src_a = *(src + 3) / 255.0;
+        const double dst_a = *(dst + 3) / 255.0;
+
+        *dst = (uint8_t)(src_a * (*src) + (1 - src_a) * dst_a * (*dst));
+        src++;
+        dst++;
+        *dst = (uint8_t)(src_a * (*src) + (1 - src_a) * dst_a * (*dst));
+        src++;
+        dst++;
+        *dst = (uint8_t)(src_a * (*src) + (1 - src_a) * dst_a * (*dst));
+        src++;
+        dst++;
+        *dst = (uint8_t)((src_a + (1 - src_a) * dst_a) * 255);
+        src++;
+        dst++;
+    }
+}
+
+#ifdef SAIL_X86_KERNELS
+/* Two pixels per iteration. Every component of the pixels is a pair of doubles. */
+SAIL_TARGET_SSE2 static void blend_over_rgba32_sse2(uint8_t* dst, const uint8_t* src, unsigned width)
+{
+    const __m128i byte_mask = _mm_set1_epi32(0xFF);
+    const __m128d one       = _mm_set1_pd(1.0);
+    const __m128d max       = _mm_set1_pd(255.0);
+    unsigned i              = 0;
+
+#define SAIL_COMPONENT(pixels, n) _mm_cvtepi32_pd(_mm_and_si128(_mm_srli_epi32(pixels, (n) * 8), byte_mask))
+#define SAIL_BLEND(n)                                                                                                  \
+    _mm_slli_epi32(_mm_cvttpd_epi32(_mm_add_pd(_mm_mul_pd(src_a, SAIL_COMPONENT(src_pixels, n)),                       \
+                                               _mm_mul_pd(t, SAIL_COMPONENT(dst_pixels, n)))),                         \
+                   (n) * 8)
+    for (; i + 2 <= width; i += 2)
+    {
+        const __m128i src_pixels = _mm_loadl_epi64((const __m128i*)(src + i * 4));
+        const __m128i dst_pixels = _mm_loadl_epi64((const __m128i*)(dst + i * 4));
+
+        const __m128d src_a = _mm_div_pd(SAIL_COMPONENT(src_pixels, 3), max);
+        const __m128d dst_a = _mm_div_pd(SAIL_COMPONENT(dst_pixels, 3), max);
+        const __m128d t     = _mm_mul_pd(_mm_sub_pd(one, src_a), dst_a);
+        const __m128i alpha = _mm_slli_epi32(_mm_cvttpd_epi32(_mm_mul_pd(_mm_add_pd(src_a, t), max)), 24);
+
+        _mm_storel_epi64((__m128i*)(dst + i * 4),
+                         _mm_or_si128(_mm_or_si128(SAIL_BLEND(0), SAIL_BLEND(1)), _mm_or_si128(SAIL_BLEND(2), alpha)));
+    }
+#undef SAIL_BLEND
+#undef SAIL_COMPONENT
+
+    blend_over_rgba32_scalar(dst + i * 4, src + i * 4, width - i);
+}
+
+/* Four pixels per iteration. */
+SAIL_TARGET_AVX2 static void blend_over_rgba32_avx2(uint8_t* dst, const uint8_t* src, unsigned width)
+{
+    const __m128i byte_mask = _mm_set1_epi32(0xFF);
+    const __m256d one       = _mm256_set1_pd(1.0);
+    const __m256d max       = _mm256_set1_pd(255.0);
+    unsigned i              = 0;
+
+#define SAIL_COMPONENT(pixels, n) _mm256_cvtepi32_pd(_mm_and_si128(_mm_srli_epi32(pixels, (n) * 8), byte_mask))
+#define SAIL_BLEND(n)                                                                                                  \
+    _mm_slli_epi32(_mm256_cvttpd_epi32(_mm256_add_pd(_mm256_mul_pd(src_a, SAIL_COMPONENT(src_pixels, n)),              \
+                                                     _mm256_mul_pd(t, SAIL_COMPONENT(dst_pixels, n)))),                \
+                   (n) * 8)
+    for (; i + 4 <= width; i += 4)
+    {
+        const __m128i src_pixels = _mm_loadu_si128((const __m128i*)(src + i * 4));
+        const __m128i dst_pixels = _mm_loadu_si128((const __m128i*)(dst + i * 4));
+
+        const __m256d src_a = _mm256_div_pd(SAIL_COMPONENT(src_pixels, 3), max);
+        const __m256d dst_a = _mm256_div_pd(SAIL_COMPONENT(dst_pixels, 3), max);
+        const __m256d t     = _mm256_mul_pd(_mm256_sub_pd(one, src_a), dst_a);
+        const __m128i alpha = _mm_slli_epi32(_mm256_cvttpd_epi32(_mm256_mul_pd(_mm256_add_pd(src_a, t), max)), 24);
+
+        _mm_storeu_si128((__m128i*)(dst + i * 4),
+                         _mm_or_si128(_mm_or_si128(SAIL_BLEND(0), SAIL_BLEND(1)), _mm_or_si128(SAIL_BLEND(2), alpha)));
+    }
+#undef SAIL_BLEND
+#undef SAIL_COMPONENT
+
+    blend_over_rgba32_scalar(dst + i * 4, src + i * 4, width - i);
+}
+
+/* Eight pixels per iteration. */
+SAIL_TARGET_AVX512 static void blend_over_rgba32_avx512(uint8_t* dst, const uint8_t* src, unsigned width)
+{
+    const __m256i byte_mask = _mm256_set1_epi32(0xFF);
+    const __m512d one       = _mm512_set1_pd(1.0);
+    const __m512d max       = _mm512_set1_pd(255.0);
+    unsigned i              = 0;
+
+#define SAIL_COMPONENT(pixels, n) _mm512_cvtepi32_pd(_mm256_and_si256(_mm256_srli_epi32(pixels, (n) * 8), byte_mask))
+#define SAIL_BLEND(n)                                                                                                  \
+    _mm256_slli_epi32(_mm512_cvttpd_epi32(_mm512_add_pd(_mm512_mul_pd(src_a, SAIL_COMPONENT(src_pixels, n)),           \
+                                                        _mm512_mul_pd(t, SAIL_COMPONENT(dst_pixels, n)))),             \
+                      (n) * 8)
+    for (; i + 8 <= width; i += 8)
+    {
+        const __m256i src_pixels = _mm256_loadu_si256((const __m256i*)(src + i * 4));
+        const __m256i dst_pixels = _mm256_loadu_si256((const __m256i*)(dst + i * 4));
+
+        const __m512d src_a = _mm512_div_pd(SAIL_COMPONENT(src_pixels, 3), max);
+        const __m512d dst_a = _mm512_div_pd(SAIL_COMPONENT(dst_pixels, 3), max);
+        const __m512d t     = _mm512_mul_pd(_mm512_sub_pd(one, src_a), dst_a);
+        const __m256i alpha = _mm256_slli_epi32(_mm512_cvttpd_epi32(_mm512_mul_pd(_mm512_add_pd(src_a, t), max)), 24);
+
+        _mm256_storeu_si256((__m256i*)(dst + i * 4), _mm256_or_si256(_mm256_or_si256(SAIL_BLEND(0), SAIL_BLEND(1)),
+                                                                     _mm256_or_si256(SAIL_BLEND(2), alpha)));
+    }
+#undef SAIL_BLEND
+#undef SAIL_COMPONENT
+
+    blend_over_rgba32_scalar(dst + i * 4, src + i * 4, width - i);
+}
+#endif
+
+static const struct sail_kernel_variant BLEND_OVER_RGBA32_VARIANTS[] = {
+#ifdef SAIL_X86_KERNELS
+    {SAIL_CPU_FEATURE_AVX512, (sail_kernel_func_t)blend_over_rgba32_avx512},
+    {SAIL_CPU_FEATURE_AVX2,   (sail_kernel_func_t)blend_over_rgba32_avx2  },
+    {SAIL_CPU_FEATURE_SSE2,   (sail_kernel_func_t)blend_over_rgba32_sse2  },
+#endif
+    {0,                       (sail_kernel_func_t)blend_over_rgba32_scalar},
+};
+
+/*
+ * Reordering the bytes of 4-byte pixels. Output byte N of every pixel takes byte order[N]
+ * of the input pixel.
+ */
+typedef void (*swizzle_row_func_t)(const uint8_t* src, uint8_t* dst, unsigned width, const uint8_t order[4]);
+
+static void swizzle_row_scalar(const uint8_t* src, uint8_t* dst, unsigned width, const uint8_t order[4])
+{
+    for (unsigned x = 0; x < width; x++)
+    {
+        dst[0]  = src[order[0]];
+        dst[1]  = src[order[1]];
+        dst[2]  = src[order[2]];
+        dst[3]  = src[order[3]];
+        src    += 4;
+        dst    += 4;
+    }
+}
+
+#ifdef SAIL_X86_KERNELS
+/* The byte shuffle mask of four pixels. */
+SAIL_TARGET_SSE2 static __m128i swizzle_mask(const uint8_t order[4])
+{
+#define SAIL_PIXEL(n) (char)(order[0] + (n)), (char)(order[1] + (n)), (char)(order[2] + (n)), (char)(order[3] + (n))
+    return _mm_setr_epi8(SAIL_PIXEL(0), SAIL_PIXEL(4), SAIL_PIXEL(8), SAIL_PIXEL(12));
+#undef SAIL_PIXEL
+}
+
+SAIL_TARGET_SSSE3 static void swizzle_row_ssse3(const uint8_t* src,
+                                                uint8_t* dst,
+                                                unsigned width,
+                                                const uint8_t order[4])
+{
+    const __m128i mask = swizzle_mask(order);
+    unsigned i         = 0;
+
+    for (; i + 4 <= width; i += 4)
+    {
+        const __m128i pixels = _mm_loadu_si128((const __m128i*)(src + i * 4));
+        _mm_storeu_si128((__m128i*)(dst + i * 4), _mm_shuffle_epi8(pixels, mask));
+    }
+
+    swizzle_row_scalar(src + i * 4, dst + i * 4, width - i, order);
+}
+
+SAIL_TARGET_AVX2 static void swizzle_row_avx2(const uint8_t* src, uint8_t* dst, unsigned width, const uint8_t order[4])
+{
+    const __m256i mask = _mm256_broadcastsi128_si256(swizzle_mask(order));
+    unsigned i         = 0;
+
+    for (; i + 8 <= width; i += 8)
+    {
+        const __m256i pixels = _mm256_loadu_si256((const __m256i*)(src + i * 4));
+        _mm256_storeu_si256((__m256i*)(dst + i * 4), _mm256_shuffle_epi8(pixels, mask));
+    }
+
+    swizzle_row_scalar(src + i * 4, dst + i * 4, width - i, order);
+}
+
+/* Masked loads and stores convert the last pixels. */
+SAIL_TARGET_AVX512 static void swizzle_row_avx512(const uint8_t* src,
+                                                 uint8_t* dst,
+                                                 unsigned width,
+                                                 const uint8_t order[4])
+{
+    const __m512i mask = _mm512_broadcast_i32x4(swizzle_mask(order));
+    unsigned i         = 0;
+
+    for (; i + 16 <= width; i += 16)
+    {
+        const __m512i pixels = _mm512_loadu_si512(src + i * 4);
+        _mm512_storeu_si512(dst + i * 4, _mm512_shuffle_epi8(pixels, mask));
+    }
+
+    if (i < width)
+    {
+        const __mmask16 tail = (__mmask16)((1u << (width - i)) - 1);
+        const __m512i pixels = _mm512_maskz_loadu_epi32(tail, src + i * 4);
+        _mm512_mask_storeu_epi32(dst + i * 4, tail, _mm512_shuffle_epi8(pixels, mask));
+    }
+}
+#endif
+
+static const struct sail_kernel_variant SWIZZLE_ROW_VARIANTS[] = {
+#ifdef SAIL_X86_KERNELS
+    {SAIL_CPU_FEATURE_AVX512, (sail_kernel_func_t)swizzle_row_avx512},
+    {SAIL_CPU_FEATURE_AVX2,   (sail_kernel_func_t)swizzle_row_avx2  },
+    {SAIL_CPU_FEATURE_SSSE3,  (sail_kernel_func_t)swizzle_row_ssse3 },
+#endif
+    {0,                       (sail_kernel_func_t)swizzle_row_scalar},
+};
+
+/*
+ * Public functions.
+ */
+
 void webp_private_fill_color(uint8_t* pixels,
                              unsigned bytes_per_line,
                              unsigned bytes_per_pixel,
@@ -59,27 +298,10 @@ sail_status_t webp_private_blend_over(
 
     if (bytes_per_pixel == 4)
     {
-        const uint8_t* src = src_raw;
-        uint8_t* dst       = (uint8_t*)dst_raw + dst_offset * bytes_per_pixel;
+        const blend_over_rgba32_func_t blend_over_rgba32 = (blend_over_rgba32_func_t)sail_select_kernel(
+            BLEND_OVER_RGBA32_VARIANTS, sizeof(BLEND_OVER_RGBA32_VARIANTS) / sizeof(BLEND_OVER_RGBA32_VARIANTS[0]));
 
-        while (width--)
-        {
-            const double src_a = *(src + 3) / 255.0;
-            const double dst_a = *(dst + 3) / 255.0;
-
-            *dst = (uint8_t)(src_a * (*src) + (1 - src_a) * dst_a * (*dst));
-            src++;
-            dst++;
-            *dst = (uint8_t)(src_a * (*src) + (1 - src_a) * dst_a * (*dst));
-            src++;
-            dst++;
-            *dst = (uint8_t)(src_a * (*src) + (1 - src_a) * dst_a * (*dst));
-            src++;
-            dst++;
-            *dst = (uint8_t)((src_a + (1 - src_a) * dst_a) * 255);
-            src++;
-            dst++;
-        }
+        blend_over_rgba32((uint8_t*)dst_raw + dst_offset * bytes_per_pixel, src_raw, width);
     }
     else
     {
@@ -223,19 +445,13 @@ sail_status_t webp_private_convert_argb_to_rgba(
     SAIL_TRY(sail_malloc((size_t)stride * height, rgba_pixels));
 
     /* Convert ARGB to RGBA. */
+    static const uint8_t order[4] = {1, 2, 3, 0};
+    const swizzle_row_func_t swizzle_row = (swizzle_row_func_t)sail_select_kernel(
+        SWIZZLE_ROW_VARIANTS, sizeof(SWIZZLE_ROW_VARIANTS) / sizeof(SWIZZLE_ROW_VARIANTS[0]));
+
     for (unsigned y = 0; y < height; y++)
     {
-        const uint8_t* src = pixels + y * stride;
-        uint8_t* dst       = (uint8_t*)*rgba_pixels + y * stride;
-        for (unsigned x = 0; x < width; x++)
-        {
-            dst[0]  = src[1]; /* R */
-            dst[1]  = src[2]; /* G */
-            dst[2]  = src[3]; /* B */
-            dst[3]  = src[0]; /* A */
-            src    += 4;
-            dst    += 4;
-        }
+        swizzle_row(pixels + (size_t)y * stride, (uint8_t*)*rgba_pixels + (size_t)y * stride, width, order);
     }
 
     return SAIL_OK;
@@ -250,19 +466,13 @@ sail_status_t webp_private_convert_abgr_to_rgba(
     SAIL_TRY(sail_malloc((size_t)stride * height, rgba_pixels));
 
     /* Convert ABGR to RGBA. */
+    static const uint8_t order[4] = {3, 2, 1, 0};
+    const swizzle_row_func_t swizzle_row = (swizzle_row_func_t)sail_select_kernel(
+        SWIZZLE_ROW_VARIANTS, sizeof(SWIZZLE_ROW_VARIANTS) / sizeof(SWIZZLE_ROW_VARIANTS[0]));
+
     for (unsigned y = 0; y < height; y++)
     {
-        const uint8_t* src = pixels + y * stride;
-        uint8_t* dst       = (uint8_t*)*rgba_pixels + y * stride;
-        for (unsigned x = 0; x < width; x++)
-        {
-            dst[0]  = src[3]; /* R */
-            dst[1]  = src[2]; /* G */
-            dst[2]  = src[1]; /* B */
-            dst[3]  = src[0]; /* A */
-            src    += 4;
-            dst    += 4;
-        }
+        swizzle_row(pixels + (size_t)y * stride, (uint8_t*)*rgba_pixels + (size_t)y * stride, width, order);
     }
 
     return SAIL_OK;
@@ -62,8 +62,20 @@ struct webp_state
     WebPMuxAnimDispose frame_dispose_method;
     WebPMuxAnimBlend frame_blend_method;
 
-    void* image_data;
+    /*
+     * Region of interest. Still images are cropped by libwebp, animations are cropped from the canvas.
+     * Still images are also scaled down by libwebp. The region is in scaled coordinates.
+     */
+    unsigned crop_x;
+    unsigned crop_y;
+    unsigned crop_width;
+    unsigned crop_height;
+    unsigned reduction;
+    bool crop_still;
+
+    const void* image_data;
     size_t image_data_size;
+    void* image_data_to_free;
 
     /* Saving-specific fields. */
     struct sail_io* io;
@@ -101,8 +113,16 @@ static sail_status_t alloc_webp_state(struct sail_io* io,
         .frame_dispose_method = WEBP_MUX_DISPOSE_NONE,
         .frame_blend_method   = WEBP_MUX_NO_BLEND,
 
-        .image_data      = NULL,
-        .image_data_size = 0,
+        .crop_x      = 0,
+        .crop_y      = 0,
+        .crop_width  = 0,
+        .crop_height = 0,
+        .reduction   = 1,
+        .crop_still  = false,
+
+        .image_data         = NULL,
+        .image_data_size    = 0,
+        .image_data_to_free = NULL,
 
         .io             = io,
         .anim_encoder   = NULL,
@@ -129,7 +149,7 @@ static void destroy_webp_state(struct webp_state* webp_state)
         sail_free(webp_state->webp_iterator);
     }
 
-    sail_free(webp_state->image_data);
+    sail_free(webp_state->image_data_to_free);
 
     WebPDemuxDelete(webp_state->webp_demux);
 
@@ -185,11 +205,9 @@ SAIL_EXPORT sail_status_t sail_codec_load_init_v8_webp(struct sail_io* io,
 
     SAIL_TRY(io->seek(io->stream, 0, SEEK_SET));
 
-    void* ptr;
-    SAIL_TRY(sail_malloc(webp_state->image_data_size, &ptr));
-    webp_state->image_data = ptr;
-
-    SAIL_TRY(io->strict_read(io->stream, webp_state->image_data, webp_state->image_data_size));
+    /* Borrow the data from memory-backed I/O objects without copying. */
+    SAIL_TRY(sail_borrow_or_alloc_data_from_io(io, webp_state->image_data_size, &webp_state->image_data,
+                                               &webp_state->image_data_to_free));
 
     /* Construct a WebP demuxer. */
     const WebPData data = {webp_state->image_data, webp_state->image_data_size};
@@ -202,6 +220,7 @@ SAIL_EXPORT sail_status_t sail_codec_load_init_v8_webp(struct sail_io* io,
         SAIL_LOG_AND_RETURN(SAIL_ERROR_INVALID_IMAGE);
     }
 
+    void* ptr;
     SAIL_TRY(sail_malloc(sizeof(WebPIterator), &ptr));
     webp_state->webp_iterator = ptr;
 
@@ -270,6 +289,8 @@ SAIL_EXPORT sail_status_t sail_codec_load_init_v8_webp(struct sail_io* io,
         }
 
         image_local->source_image->compression = SAIL_COMPRESSION_WEBP;
+        image_local->source_image->width       = WebPDemuxGetI(webp_state->webp_demux, WEBP_FF_CANVAS_WIDTH);
+        image_local->source_image->height      = WebPDemuxGetI(webp_state->webp_demux, WEBP_FF_CANVAS_HEIGHT);
     }
 
     image_local->width  = WebPDemuxGetI(webp_state->webp_demux, WEBP_FF_CANVAS_WIDTH);
@@ -287,6 +308,21 @@ SAIL_EXPORT sail_status_t sail_codec_load_init_v8_webp(struct sail_io* io,
 
     webp_state->bytes_per_pixel = sail_bits_per_pixel(image_local->pixel_format) / 8;
 
+    /* Animations are composed on the full canvas, so just still images are scaled down. */
+    if (!features.has_animation)
+    {
+        webp_state->reduction =
+            sail_reduction_from_load_options(webp_state->load_options, image_local->width, image_local->height, 8);
+    }
+
+    const unsigned reduced_width  = (image_local->width + webp_state->reduction - 1) / webp_state->reduction;
+    const unsigned reduced_height = (image_local->height + webp_state->reduction - 1) / webp_state->reduction;
+
+    SAIL_TRY_OR_CLEANUP(sail_crop_rectangle_from_load_options(webp_state->load_options, reduced_width, reduced_height,
+                                                              &webp_state->crop_x, &webp_state->crop_y,
+                                                              &webp_state->crop_width, &webp_state->crop_height),
+                        /* cleanup */ sail_destroy_image(image_local));
+
     /* Fetch ICCP. */
     if (webp_state->load_options->options & SAIL_OPTION_ICCP)
     {
@@ -322,6 +358,10 @@ SAIL_EXPORT sail_status_t sail_codec_load_seek_next_frame_v8_webp(void* state, s
 {
     struct webp_state* webp_state = state;
 
+    unsigned resume_frame;
+    const struct sail_frame_index_entry* resume_entry;
+    const bool resume = sail_take_frame_to_resume(webp_state->load_options, &resume_frame, &resume_entry);
+
     /* Start demuxing. */
     if (webp_state->frame_number == 0)
     {
@@ -331,21 +371,66 @@ SAIL_EXPORT sail_status_t sail_codec_load_seek_next_frame_v8_webp(void* state, s
             SAIL_LOG_AND_RETURN(SAIL_ERROR_UNDERLYING_CODEC);
         }
 
-        /* Allocate a canvas frame to apply disposal later. */
-        size_t image_size;
-        SAIL_TRY(sail_pixels_buffer_size(webp_state->canvas_image->height, webp_state->canvas_image->bytes_per_line,
-                                        &image_size));
+        const bool covers_canvas = webp_state->webp_iterator->x_offset == 0 && webp_state->webp_iterator->y_offset == 0
+                                   && (unsigned)webp_state->webp_iterator->width == webp_state->canvas_image->width
+                                   && (unsigned)webp_state->webp_iterator->height == webp_state->canvas_image->height;
+
+        /*
+         * Still images whose frame doesn't cover the canvas are composed on the full canvas like animations,
+         * so they are not scaled down. The crop rectangle is applied to the full frames then.
+         */
+        if (webp_state->reduction > 1 && !covers_canvas)
+        {
+            webp_state->reduction = 1;
+
+            SAIL_TRY(sail_crop_rectangle_from_load_options(webp_state->load_options, webp_state->canvas_image->width,
+                                                           webp_state->canvas_image->height, &webp_state->crop_x,
+                                                           &webp_state->crop_y, &webp_state->crop_width,
+                                                           &webp_state->crop_height));
+        }
+
+        /* A cropped or scaled still image is decoded straight into the frame without a canvas. */
+        webp_state->crop_still = webp_state->frame_count == 1 && covers_canvas
+                                 && (webp_state->crop_width != webp_state->canvas_image->width
+                                     || webp_state->crop_height != webp_state->canvas_image->height);
+
+        /* Allocate a canvas frame to apply disposal later. Probing doesn't compose frames. */
+        if ((webp_state->load_options->options & SAIL_OPTION_PROBE) == 0 && !webp_state->crop_still)
+        {
+            size_t image_size;
+            SAIL_TRY(sail_pixels_buffer_size(webp_state->canvas_image->height,
+                                             webp_state->canvas_image->bytes_per_line, &image_size));
 
-        void* ptr;
-        SAIL_TRY(sail_malloc(image_size, &ptr));
-        webp_state->canvas_image->pixels = ptr;
+            void* ptr;
+            SAIL_TRY(sail_malloc(image_size, &ptr));
+            webp_state->canvas_image->pixels = ptr;
 
-        /* Fill background. */
-        webp_private_fill_color(webp_state->canvas_image->pixels, webp_state->canvas_image->bytes_per_line,
-                                webp_state->bytes_per_pixel, webp_state->background_color, 0, 0,
-                                webp_state->canvas_image->width, webp_state->canvas_image->height);
+            /* Fill background. */
+            webp_private_fill_color(webp_state->canvas_image->pixels, webp_state->canvas_image->bytes_per_line,
+                                    webp_state->bytes_per_pixel, webp_state->background_color, 0, 0,
+                                    webp_state->canvas_image->width, webp_state->canvas_image->height);
+        }
     }
-    else
+
+    if (resume)
+    {
+        /* Resume at the recorded frame. Keyframes are composed on the background. */
+        if (WebPDemuxGetFrame(webp_state->webp_demux, (int)resume_entry->offset, webp_state->webp_iterator) == 0)
+        {
+            SAIL_LOG_ERROR("WEBP: Failed to get frame #%zu", resume_entry->offset);
+            SAIL_LOG_AND_RETURN(SAIL_ERROR_UNDERLYING_CODEC);
+        }
+
+        if (webp_state->canvas_image->pixels != NULL)
+        {
+            webp_private_fill_color(webp_state->canvas_image->pixels, webp_state->canvas_image->bytes_per_line,
+                                    webp_state->bytes_per_pixel, webp_state->background_color, 0, 0,
+                                    webp_state->canvas_image->width, webp_state->canvas_image->height);
+        }
+
+        webp_state->frame_number = resume_frame;
+    }
+    else if (webp_state->frame_number > 0)
     {
         switch (webp_state->frame_dispose_method)
         {
@@ -373,6 +458,28 @@ SAIL_EXPORT sail_status_t sail_codec_load_seek_next_frame_v8_webp(void* state, s
         }
     }
 
+    /*
+     * A frame doesn't depend on the previous ones when it replaces the whole canvas,
+     * or when the previous frame disposed the whole canvas to the background.
+     */
+    const WebPIterator* webp_iterator = webp_state->webp_iterator;
+    const unsigned canvas_width       = WebPDemuxGetI(webp_state->webp_demux, WEBP_FF_CANVAS_WIDTH);
+    const unsigned canvas_height      = WebPDemuxGetI(webp_state->webp_demux, WEBP_FF_CANVAS_HEIGHT);
+
+    const bool full_frame = webp_iterator->x_offset == 0 && webp_iterator->y_offset == 0
+                            && (unsigned)webp_iterator->width == canvas_width
+                            && (unsigned)webp_iterator->height == canvas_height;
+    const bool prev_full_frame = webp_state->frame_x == 0 && webp_state->frame_y == 0
+                                 && webp_state->frame_width == canvas_width
+                                 && webp_state->frame_height == canvas_height;
+    const bool keyframe =
+        webp_state->frame_number == 0
+        || (full_frame && (!webp_iterator->has_alpha || webp_iterator->blend_method == WEBP_MUX_NO_BLEND))
+        || (webp_state->frame_dispose_method == WEBP_MUX_DISPOSE_BACKGROUND && prev_full_frame);
+
+    SAIL_TRY(sail_record_frame(webp_state->load_options, (size_t)webp_iterator->frame_num, keyframe,
+                               webp_iterator->dispose_method, NULL, 0));
+
     webp_state->frame_number++;
     webp_state->frame_x              = webp_state->webp_iterator->x_offset;
     webp_state->frame_y              = webp_state->webp_iterator->y_offset;
@@ -385,6 +492,10 @@ SAIL_EXPORT sail_status_t sail_codec_load_seek_next_frame_v8_webp(void* state, s
     struct sail_image* image_local;
     SAIL_TRY(sail_copy_image_skeleton(webp_state->canvas_image, &image_local));
 
+    image_local->width          = webp_state->crop_width;
+    image_local->height         = webp_state->crop_height;
+    image_local->bytes_per_line = sail_bytes_per_line(image_local->width, image_local->pixel_format);
+
     if (webp_state->load_options->options & SAIL_OPTION_SOURCE_IMAGE)
     {
         image_local->source_image->pixel_format =
@@ -402,15 +513,107 @@ SAIL_EXPORT sail_status_t sail_codec_load_seek_next_frame_v8_webp(void* state, s
     return SAIL_OK;
 }
 
+/*
+ * Decodes just the region of interest of a still image. libwebp rounds odd crop offsets down,
+ * so such regions are decoded with an extra column or row into a temporary buffer.
+ *
+ * Scaled images are cropped on the full resolution grid first and scaled to the region size.
+ * Their crop offsets are always even.
+ */
+static sail_status_t load_cropped_still_frame(const struct webp_state* webp_state, struct sail_image* image)
+{
+    const unsigned reduction              = webp_state->reduction;
+    const unsigned extra_x                = (reduction > 1) ? 0 : webp_state->crop_x & 1;
+    const unsigned extra_y                = (reduction > 1) ? 0 : webp_state->crop_y & 1;
+    const unsigned decoded_bytes_per_line = (image->width + extra_x) * webp_state->bytes_per_pixel;
+
+    size_t decoded_size;
+    SAIL_TRY(sail_pixels_buffer_size(image->height + extra_y, decoded_bytes_per_line, &decoded_size));
+
+    WebPDecoderConfig config;
+
+    if (!WebPInitDecoderConfig(&config))
+    {
+        SAIL_LOG_ERROR("WEBP: Failed to initialize decoder configuration");
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_UNDERLYING_CODEC);
+    }
+
+    void* decoded = image->pixels;
+
+    if (extra_x != 0 || extra_y != 0)
+    {
+        SAIL_TRY(sail_malloc(decoded_size, &decoded));
+    }
+
+    if (reduction > 1)
+    {
+        const unsigned crop_x      = webp_state->crop_x * reduction;
+        const unsigned crop_y      = webp_state->crop_y * reduction;
+        const unsigned crop_width  = SAIL_MIN(image->width * reduction, webp_state->canvas_image->width - crop_x);
+        const unsigned crop_height = SAIL_MIN(image->height * reduction, webp_state->canvas_image->height - crop_y);
+
+        config.options.use_cropping  = 1;
+        config.options.crop_left     = (int)crop_x;
+        config.options.crop_top      = (int)crop_y;
+        config.options.crop_width    = (int)crop_width;
+        config.options.crop_height   = (int)crop_height;
+        config.options.use_scaling   = 1;
+        config.options.scaled_width  = (int)image->width;
+        config.options.scaled_height = (int)image->height;
+    }
+    else
+    {
+        config.options.use_cropping = 1;
+        config.options.crop_left    = (int)(webp_state->crop_x - extra_x);
+        config.options.crop_top     = (int)(webp_state->crop_y - extra_y);
+        config.options.crop_width   = (int)(image->width + extra_x);
+        config.options.crop_height  = (int)(image->height + extra_y);
+    }
+
+    config.output.colorspace         = MODE_RGBA;
+    config.output.is_external_memory = 1;
+    config.output.u.RGBA.rgba        = decoded;
+    config.output.u.RGBA.stride      = (int)decoded_bytes_per_line;
+    config.output.u.RGBA.size        = decoded_size;
+
+    if (WebPDecode(webp_state->webp_iterator->fragment.bytes, webp_state->webp_iterator->fragment.size, &config)
+        != VP8_STATUS_OK)
+    {
+        if (decoded != image->pixels)
+        {
+            sail_free(decoded);
+        }
+
+        SAIL_LOG_ERROR("WEBP: Failed to decode image");
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_UNDERLYING_CODEC);
+    }
+
+    if (decoded != image->pixels)
+    {
+        SAIL_TRY_OR_CLEANUP(sail_copy_pixels_rectangle(decoded, decoded_bytes_per_line, image->pixel_format, extra_x,
+                                                       extra_y, image->width, image->height, image->pixels,
+                                                       image->bytes_per_line),
+                            /* cleanup */ sail_free(decoded));
+
+        sail_free(decoded);
+    }
+
+    return SAIL_OK;
+}
+
 SAIL_EXPORT sail_status_t sail_codec_load_frame_v8_webp(void* state, struct sail_image* image)
 {
     struct webp_state* webp_state = state;
-    size_t canvas_pixels_size;
-    size_t frame_pixels_size;
 
+    if (webp_state->crop_still)
+    {
+        SAIL_TRY(load_cropped_still_frame(webp_state, image));
+        return SAIL_OK;
+    }
+
+    size_t canvas_pixels_size;
     SAIL_TRY(sail_pixels_buffer_size(webp_state->canvas_image->height, webp_state->canvas_image->bytes_per_line,
                                      &canvas_pixels_size));
-    SAIL_TRY(sail_pixels_buffer_size(image->height, image->bytes_per_line, &frame_pixels_size));
 
     switch (webp_state->frame_blend_method)
     {
@@ -431,25 +634,51 @@ SAIL_EXPORT sail_status_t sail_codec_load_frame_v8_webp(void* state, struct sail
     }
     case WEBP_MUX_BLEND:
     {
+        /* Decode into the frame pixels first. A cropped frame may be too small to hold the whole fragment. */
+        size_t frame_pixels_size;
+        size_t fragment_pixels_size;
+
+        SAIL_TRY(sail_pixels_buffer_size(image->height, image->bytes_per_line, &frame_pixels_size));
+        SAIL_TRY(sail_pixels_buffer_size(webp_state->frame_height,
+                                         webp_state->frame_width * webp_state->bytes_per_pixel, &fragment_pixels_size));
+
+        void* fragment_pixels = image->pixels;
+
+        if (fragment_pixels_size > frame_pixels_size)
+        {
+            SAIL_TRY(sail_malloc(fragment_pixels_size, &fragment_pixels));
+        }
+
         if (WebPDecodeRGBAInto(webp_state->webp_iterator->fragment.bytes, webp_state->webp_iterator->fragment.size,
-                               image->pixels, frame_pixels_size,
+                               fragment_pixels, fragment_pixels_size,
                                webp_state->frame_width * webp_state->bytes_per_pixel)
             == NULL)
         {
+            if (fragment_pixels != image->pixels)
+            {
+                sail_free(fragment_pixels);
+            }
+
             SAIL_LOG_ERROR("WEBP: Failed to decode image");
             SAIL_LOG_AND_RETURN(SAIL_ERROR_UNDERLYING_CODEC);
         }
 
         uint8_t* dst_scanline = (uint8_t*)sail_scan_line(webp_state->canvas_image, webp_state->frame_y)
                                 + webp_state->frame_x * webp_state->bytes_per_pixel;
-        uint8_t* src_scanline = image->pixels;
+        uint8_t* src_scanline = fragment_pixels;
 
         for (unsigned row           = 0; row < webp_state->frame_height; row++,
                       dst_scanline += webp_state->canvas_image->bytes_per_line,
                       src_scanline += webp_state->frame_width * webp_state->bytes_per_pixel)
         {
-            SAIL_TRY(webp_private_blend_over(dst_scanline, 0, src_scanline, webp_state->frame_width,
-                                             webp_state->bytes_per_pixel));
+            SAIL_TRY_OR_CLEANUP(webp_private_blend_over(dst_scanline, 0, src_scanline, webp_state->frame_width,
+                                                        webp_state->bytes_per_pixel),
+                                /* cleanup */ if (fragment_pixels != image->pixels) sail_free(fragment_pixels));
+        }
+
+        if (fragment_pixels != image->pixels)
+        {
+            sail_free(fragment_pixels);
         }
         break;
     }
@@ -460,7 +689,9 @@ SAIL_EXPORT sail_status_t sail_codec_load_frame_v8_webp(void* state, struct sail
     }
     }
 
-    memcpy(image->pixels, webp_state->canvas_image->pixels, frame_pixels_size);
+    SAIL_TRY(sail_copy_pixels_rectangle(webp_state->canvas_image->pixels, webp_state->canvas_image->bytes_per_line,
+                                        image->pixel_format, webp_state->crop_x, webp_state->crop_y, image->width,
+                                        image->height, image->pixels, image->bytes_per_line));
 
     return SAIL_OK;
 }
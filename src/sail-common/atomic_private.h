@@ -0,0 +1,136 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <sail-common/config.h>
+
+#ifdef SAIL_WIN32
+#include <Windows.h>
+#endif
+
+/*
+ * Lock-free atomic helpers shared by SAIL libraries. Not installed.
+ *
+ * Pointers are published with release/acquire semantics, so the data they point to is visible
+ * to the threads that load them. Counters are relaxed.
+ */
+
+static inline void* sail_atomic_load_pointer(void* const* pointer)
+{
+#ifdef SAIL_WIN32
+    return InterlockedCompareExchangePointer((PVOID volatile*)pointer, NULL, NULL);
+#else
+    return __atomic_load_n(pointer, __ATOMIC_ACQUIRE);
+#endif
+}
+
+static inline void sail_atomic_store_pointer(void** pointer, void* value)
+{
+#ifdef SAIL_WIN32
+    InterlockedExchangePointer((PVOID volatile*)pointer, value);
+#else
+    __atomic_store_n(pointer, value, __ATOMIC_RELEASE);
+#endif
+}
+
+/*
+ * Replaces the pointer with desired if it's equal to expected. Returns the previous pointer,
+ * so the exchange succeeded if the returned value is equal to expected.
+ */
+static inline void* sail_atomic_compare_exchange_pointer(void** pointer, void* expected, void* desired)
+{
+#ifdef SAIL_WIN32
+    return InterlockedCompareExchangePointer((PVOID volatile*)pointer, desired, expected);
+#else
+    __atomic_compare_exchange_n(pointer, &expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+
+    return expected;
+#endif
+}
+
+static inline uint64_t sail_atomic_load_u64(const uint64_t* value)
+{
+#ifdef SAIL_WIN32
+    return (uint64_t)InterlockedCompareExchange64((volatile LONG64*)value, 0, 0);
+#else
+    return __atomic_load_n(value, __ATOMIC_RELAXED);
+#endif
+}
+
+static inline void sail_atomic_store_u64(uint64_t* value, uint64_t new_value)
+{
+#ifdef SAIL_WIN32
+    InterlockedExchange64((volatile LONG64*)value, (LONG64)new_value);
+#else
+    __atomic_store_n(value, new_value, __ATOMIC_RELAXED);
+#endif
+}
+
+/* Returns the new value. */
+static inline uint64_t sail_atomic_add_u64(uint64_t* value, uint64_t delta)
+{
+#ifdef SAIL_WIN32
+    return (uint64_t)InterlockedAdd64((volatile LONG64*)value, (LONG64)delta);
+#else
+    return __atomic_add_fetch(value, delta, __ATOMIC_RELAXED);
+#endif
+}
+
+/* Returns the new value. */
+static inline uint64_t sail_atomic_sub_u64(uint64_t* value, uint64_t delta)
+{
+#ifdef SAIL_WIN32
+    return (uint64_t)InterlockedAdd64((volatile LONG64*)value, -(LONG64)delta);
+#else
+    return __atomic_sub_fetch(value, delta, __ATOMIC_RELAXED);
+#endif
+}
+
+/*
+ * Replaces the value with desired if it's equal to *expected. Otherwise, assigns the current value
+ * to *expected. Returns true if the value was replaced.
+ */
+static inline bool sail_atomic_compare_exchange_u64(uint64_t* value, uint64_t* expected, uint64_t desired)
+{
+#ifdef SAIL_WIN32
+    const uint64_t previous =
+        (uint64_t)InterlockedCompareExchange64((volatile LONG64*)value, (LONG64)desired, (LONG64)*expected);
+
+    if (previous == *expected)
+    {
+        return true;
+    }
+
+    *expected = previous;
+
+    return false;
+#else
+    return __atomic_compare_exchange_n(value, expected, desired, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+#endif
+}
@@ -0,0 +1,249 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <limits.h>
+#include <stdio.h> /* SEEK_CUR */
+#include <string.h>
+
+#include "sail-common.h"
+
+/* Large enough to amortize I/O calls, small enough to not waste memory on small images. */
+static const size_t SAIL_BUFFERED_READER_DEFAULT_CAPACITY = 64 * 1024;
+
+sail_status_t sail_alloc_buffered_reader(struct sail_io* io, size_t capacity, struct sail_buffered_reader** reader)
+{
+    SAIL_CHECK_PTR(io);
+    SAIL_CHECK_PTR(reader);
+
+    if (capacity == 0)
+    {
+        capacity = SAIL_BUFFERED_READER_DEFAULT_CAPACITY;
+    }
+
+    void* ptr;
+    SAIL_TRY(sail_malloc(sizeof(struct sail_buffered_reader), &ptr));
+    struct sail_buffered_reader* reader_local = ptr;
+
+    SAIL_TRY_OR_CLEANUP(sail_malloc(capacity, &ptr),
+                        /* cleanup */ sail_free(reader_local));
+
+    reader_local->io       = io;
+    reader_local->buffer   = ptr;
+    reader_local->capacity = capacity;
+    reader_local->pos      = 0;
+    reader_local->length   = 0;
+
+    *reader = reader_local;
+
+    return SAIL_OK;
+}
+
+void sail_destroy_buffered_reader(struct sail_buffered_reader* reader)
+{
+    if (reader == NULL)
+    {
+        return;
+    }
+
+    sail_free(reader->buffer);
+    sail_free(reader);
+}
+
+sail_status_t sail_buffered_reader_refill(struct sail_buffered_reader* reader)
+{
+    SAIL_CHECK_PTR(reader);
+
+    if (reader->pos < reader->length)
+    {
+        return SAIL_OK;
+    }
+
+    reader->pos    = 0;
+    reader->length = 0;
+
+    size_t read_size;
+    const sail_status_t status = reader->io->tolerant_read(reader->io->stream, reader->buffer, reader->capacity, &read_size);
+
+    /* Some I/O objects report EOF with an error, others with zero bytes read. */
+    if (status == SAIL_ERROR_EOF || (status == SAIL_OK && read_size == 0))
+    {
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_EOF);
+    }
+
+    SAIL_TRY(status);
+
+    reader->length = read_size;
+
+    return SAIL_OK;
+}
+
+sail_status_t sail_buffered_reader_read(struct sail_buffered_reader* reader, void* buf, size_t size)
+{
+    SAIL_CHECK_PTR(reader);
+    SAIL_CHECK_PTR(buf);
+
+    unsigned char* buf_ptr = buf;
+
+    while (size > 0)
+    {
+        if (reader->pos == reader->length)
+        {
+            /* Read large chunks directly to avoid copying them twice. */
+            if (size >= reader->capacity)
+            {
+                SAIL_TRY(reader->io->strict_read(reader->io->stream, buf_ptr, size));
+                return SAIL_OK;
+            }
+
+            SAIL_TRY(sail_buffered_reader_refill(reader));
+        }
+
+        const size_t available = reader->length - reader->pos;
+        const size_t chunk     = (size < available) ? size : available;
+
+        memcpy(buf_ptr, reader->buffer + reader->pos, chunk);
+
+        reader->pos += chunk;
+        buf_ptr     += chunk;
+        size        -= chunk;
+    }
+
+    return SAIL_OK;
+}
+
+sail_status_t sail_buffered_reader_seek(struct sail_buffered_reader* reader, long offset, int whence)
+{
+    SAIL_CHECK_PTR(reader);
+
+    if (whence == SEEK_CUR)
+    {
+        /* Fast path: the target is within the buffer. */
+        if (offset >= 0 && (unsigned long)offset <= reader->length - reader->pos)
+        {
+            reader->pos += (size_t)offset;
+            return SAIL_OK;
+        }
+        else if (offset < 0 && (unsigned long)(-(offset + 1)) < reader->pos)
+        {
+            reader->pos -= (size_t)(-(offset + 1)) + 1;
+            return SAIL_OK;
+        }
+
+        /* Skip forward by reading when the I/O object cannot seek. */
+        if (offset > 0 && (reader->io->features & SAIL_IO_FEATURE_SEEKABLE) == 0)
+        {
+            size_t to_skip = (size_t)offset - (reader->length - reader->pos);
+            reader->pos    = reader->length;
+
+            while (to_skip > 0)
+            {
+                SAIL_TRY(sail_buffered_reader_refill(reader));
+
+                const size_t chunk = (to_skip < reader->length) ? to_skip : reader->length;
+
+                reader->pos  = chunk;
+                to_skip     -= chunk;
+            }
+
+            return SAIL_OK;
+        }
+
+        /* The I/O object position runs ahead, so convert to an absolute position. */
+        size_t current_offset;
+        SAIL_TRY(sail_buffered_reader_tell(reader, &current_offset));
+
+        size_t new_offset;
+        SAIL_TRY(sail_io_compute_seek_position(current_offset, offset, &new_offset));
+
+        if (new_offset > LONG_MAX)
+        {
+            SAIL_LOG_AND_RETURN(SAIL_ERROR_SEEK_IO);
+        }
+
+        SAIL_TRY(reader->io->seek(reader->io->stream, (long)new_offset, SEEK_SET));
+    }
+    else
+    {
+        SAIL_TRY(reader->io->seek(reader->io->stream, offset, whence));
+    }
+
+    reader->pos    = 0;
+    reader->length = 0;
+
+    return SAIL_OK;
+}
+
+sail_status_t sail_buffered_reader_tell(struct sail_buffered_reader* reader, size_t* offset)
+{
+    SAIL_CHECK_PTR(reader);
+    SAIL_CHECK_PTR(offset);
+
+    size_t io_offset;
+    SAIL_TRY(reader->io->tell(reader->io->stream, &io_offset));
+
+    *offset = io_offset - (reader->length - reader->pos);
+
+    return SAIL_OK;
+}
+
+sail_status_t sail_buffered_reader_eof(struct sail_buffered_reader* reader, bool* result)
+{
+    SAIL_CHECK_PTR(reader);
+    SAIL_CHECK_PTR(result);
+
+    if (reader->pos < reader->length)
+    {
+        *result = false;
+        return SAIL_OK;
+    }
+
+    SAIL_TRY(reader->io->eof(reader->io->stream, result));
+
+    return SAIL_OK;
+}
+
+sail_status_t sail_buffered_reader_sync(struct sail_buffered_reader* reader)
+{
+    SAIL_CHECK_PTR(reader);
+
+    const size_t unread = reader->length - reader->pos;
+
+    if (unread > 0)
+    {
+        /* The read-ahead bytes cannot be given back to a non-seekable I/O object. */
+        if ((reader->io->features & SAIL_IO_FEATURE_SEEKABLE) == 0)
+        {
+            SAIL_LOG_ERROR("Cannot sync a buffered reader over a non-seekable I/O object");
+            SAIL_LOG_AND_RETURN(SAIL_ERROR_NOT_IMPLEMENTED);
+        }
+
+        SAIL_TRY(reader->io->seek(reader->io->stream, -(long)unread, SEEK_CUR));
+    }
+
+    reader->pos    = 0;
+    reader->length = 0;
+
+    return SAIL_OK;
+}
@@ -0,0 +1,170 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h> /* size_t */
+
+#include <sail-common/compiler_specifics.h>
+#include <sail-common/export.h>
+#include <sail-common/status.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+struct sail_io;
+
+/*
+ * Buffered reader over an I/O object. Codecs that parse their input byte by byte should use
+ * it instead of calling the I/O read callbacks for every byte.
+ *
+ * The reader reads ahead, so the position of the underlying I/O object runs ahead of the reader
+ * position. While the reader is in use, use sail_buffered_reader_seek() and sail_buffered_reader_tell()
+ * instead of the I/O callbacks. Call sail_buffered_reader_sync() before using the I/O object directly again.
+ *
+ * Syncing and seeking backwards need a seekable I/O object. Codecs that must also support non-seekable
+ * I/O objects should keep one reader for the whole decoding session, so nothing has to be given back.
+ */
+struct sail_buffered_reader
+{
+    struct sail_io* io;
+
+    unsigned char* buffer;
+    size_t capacity;
+
+    /* The position of the next unread byte in the buffer. */
+    size_t pos;
+
+    /* The number of valid bytes in the buffer. */
+    size_t length;
+};
+
+typedef struct sail_buffered_reader sail_buffered_reader_t;
+
+/*
+ * Allocates a new buffered reader over the specified I/O object. The I/O object must stay alive
+ * while the reader is in use. Pass 0 as the capacity to use the default buffer size.
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_EXPORT sail_status_t sail_alloc_buffered_reader(struct sail_io* io,
+                                                     size_t capacity,
+                                                     struct sail_buffered_reader** reader);
+
+/*
+ * Destroys the specified buffered reader. Does not sync the underlying I/O object position.
+ * Does nothing if the reader is NULL.
+ */
+SAIL_EXPORT void sail_destroy_buffered_reader(struct sail_buffered_reader* reader);
+
+/*
+ * Reads the next chunk of data into the buffer if all the buffered bytes are consumed.
+ * Does nothing otherwise.
+ *
+ * Returns SAIL_OK on success.
+ * Returns SAIL_ERROR_EOF if there is no more data.
+ */
+SAIL_EXPORT sail_status_t sail_buffered_reader_refill(struct sail_buffered_reader* reader);
+
+/*
+ * Reads exactly the specified number of bytes. Large reads bypass the buffer.
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_EXPORT sail_status_t sail_buffered_reader_read(struct sail_buffered_reader* reader, void* buf, size_t size);
+
+/*
+ * Seeks the reader like sail_io.seek. Seeks within the buffered data do not touch the I/O object.
+ * Forward SEEK_CUR seeks on non-seekable I/O objects skip the data by reading it.
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_EXPORT sail_status_t sail_buffered_reader_seek(struct sail_buffered_reader* reader, long offset, int whence);
+
+/*
+ * Assigns the current reader position to the 'offset' argument.
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_EXPORT sail_status_t sail_buffered_reader_tell(struct sail_buffered_reader* reader, size_t* offset);
+
+/*
+ * Assigns true to the specified result if there are no buffered bytes left and the underlying
+ * I/O object reached the end-of-file indicator.
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_EXPORT sail_status_t sail_buffered_reader_eof(struct sail_buffered_reader* reader, bool* result);
+
+/*
+ * Moves the underlying I/O object position back to the reader position and discards the buffer,
+ * so the I/O object can be used directly again.
+ *
+ * Returns SAIL_OK on success.
+ * Returns SAIL_ERROR_NOT_IMPLEMENTED if there are unread buffered bytes and the I/O object is not seekable.
+ */
+SAIL_EXPORT sail_status_t sail_buffered_reader_sync(struct sail_buffered_reader* reader);
+
+/*
+ * Reads the next byte.
+ *
+ * Returns SAIL_OK on success.
+ */
+static inline sail_status_t sail_buffered_reader_get_byte(struct sail_buffered_reader* reader, unsigned char* byte)
+{
+    if (SAIL_UNLIKELY(reader->pos == reader->length))
+    {
+        SAIL_TRY(sail_buffered_reader_refill(reader));
+    }
+
+    *byte = reader->buffer[reader->pos++];
+
+    return SAIL_OK;
+}
+
+/*
+ * Returns the next byte without consuming it.
+ *
+ * Returns SAIL_OK on success.
+ */
+static inline sail_status_t sail_buffered_reader_peek_byte(struct sail_buffered_reader* reader, unsigned char* byte)
+{
+    if (SAIL_UNLIKELY(reader->pos == reader->length))
+    {
+        SAIL_TRY(sail_buffered_reader_refill(reader));
+    }
+
+    *byte = reader->buffer[reader->pos];
+
+    return SAIL_OK;
+}
+
+/* extern "C" */
+#ifdef __cplusplus
+}
+#endif
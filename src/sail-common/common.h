@@ -384,6 +384,30 @@ enum SailCodecFeature
 
     /* Can preserve the source image information. */
     SAIL_CODEC_FEATURE_SOURCE_IMAGE = 1 << 7,
+
+    /* Can load just a region of interest without decoding whole frames. See sail_load_options.crop_width. */
+    SAIL_CODEC_FEATURE_CROP = 1 << 8,
+
+    /* Can decode frames at cheaper reduced sizes. See sail_load_options.max_width. */
+    SAIL_CODEC_FEATURE_SCALE = 1 << 9,
+
+    /* Can load embedded previews instead of frames. See SAIL_OPTION_THUMBNAIL. */
+    SAIL_CODEC_FEATURE_THUMBNAIL = 1 << 10,
+
+    /* Can skip frames without decoding them. See sail_seek_to_frame(). */
+    SAIL_CODEC_FEATURE_SEEK = 1 << 11,
+
+    /*
+     * Can load or save frames in bands of scan lines with bounded memory.
+     * See sail_load_next_frame_rows() and sail_write_next_frame_rows().
+     */
+    SAIL_CODEC_FEATURE_ROW_BANDS = 1 << 12,
+
+    /*
+     * Can record frames in a frame index and resume loading at recorded frames.
+     * sail_seek_to_frame() uses it to seek backwards and to keyframes. See sail_record_frame().
+     */
+    SAIL_CODEC_FEATURE_FRAME_INDEX = 1 << 13,
 };
 
 /* Load or save options. */
@@ -406,4 +430,19 @@ enum SailOption
      * Specifying this option for saving operations has no effect.
      */
     SAIL_OPTION_SOURCE_IMAGE = 1 << 3,
+
+    /*
+     * Instruction to parse image headers only in loading operations. Codecs skip starting their decoders
+     * and allocating decoding buffers, so frames cannot be loaded. Probing functions like sail_probe_file()
+     * set this option automatically. Specifying this option for saving operations has no effect.
+     */
+    SAIL_OPTION_PROBE = 1 << 4,
+
+    /*
+     * Instruction to load the smallest embedded preview, like an EXIF thumbnail, that is at least
+     * sail_load_options.max_width x max_height instead of the frames. Such loading produces a single frame.
+     * When no preview covers the size hint, frames are loaded as usual. sail_load_thumbnail_from_file()
+     * sets this option automatically. Specifying this option for saving operations has no effect.
+     */
+    SAIL_OPTION_THUMBNAIL = 1 << 5,
 };
@@ -654,6 +654,12 @@ const char* sail_codec_feature_to_string(enum SailCodecFeature codec_feature)
     case SAIL_CODEC_FEATURE_INTERLACED: return "INTERLACED";
     case SAIL_CODEC_FEATURE_ICCP: return "ICCP";
     case SAIL_CODEC_FEATURE_SOURCE_IMAGE: return "SOURCE-IMAGE";
+    case SAIL_CODEC_FEATURE_CROP: return "CROP";
+    case SAIL_CODEC_FEATURE_SCALE: return "SCALE";
+    case SAIL_CODEC_FEATURE_THUMBNAIL: return "THUMBNAIL";
+    case SAIL_CODEC_FEATURE_SEEK: return "SEEK";
+    case SAIL_CODEC_FEATURE_ROW_BANDS: return "ROW-BANDS";
+    case SAIL_CODEC_FEATURE_FRAME_INDEX: return "FRAME-INDEX";
     }
 
     return NULL;
@@ -671,6 +677,12 @@ enum SailCodecFeature sail_codec_feature_from_string(const char* str)
     case UINT64_C(8244927930303708800): return SAIL_CODEC_FEATURE_INTERLACED;
     case UINT64_C(6384139556): return SAIL_CODEC_FEATURE_ICCP;
     case UINT64_C(14115912967723543398): return SAIL_CODEC_FEATURE_SOURCE_IMAGE;
+    case UINT64_C(6383940665): return SAIL_CODEC_FEATURE_CROP;
+    case UINT64_C(210688462317): return SAIL_CODEC_FEATURE_SCALE;
+    case UINT64_C(249861517288085449): return SAIL_CODEC_FEATURE_THUMBNAIL;
+    case UINT64_C(6384501165): return SAIL_CODEC_FEATURE_SEEK;
+    case UINT64_C(249859004130099986): return SAIL_CODEC_FEATURE_ROW_BANDS;
+    case UINT64_C(13823769178261880405): return SAIL_CODEC_FEATURE_FRAME_INDEX;
     }
 
     return SAIL_CODEC_FEATURE_UNKNOWN;
@@ -63,3 +63,24 @@
         #define SAIL_ASAN_ENABLED
     #endif
 #endif
+
+/*
+ * Compiles a function with the instruction set regardless of the compiler flags. Such functions
+ * must be called only when sail_cpu_features() reports the instruction set, for example through
+ * a dispatch table. See sail_select_kernel(). SAIL_X86_KERNELS is defined if x86 kernels can be built.
+ */
+#if (defined __x86_64__ || defined __i386__) && (defined __GNUC__ || defined __clang__)
+#define SAIL_X86_KERNELS
+#define SAIL_TARGET_SSE2 __attribute__((target("sse2")))
+#define SAIL_TARGET_SSSE3 __attribute__((target("ssse3")))
+#define SAIL_TARGET_SSE4_1 __attribute__((target("sse4.1")))
+#define SAIL_TARGET_AVX2 __attribute__((target("avx2")))
+#define SAIL_TARGET_AVX512 __attribute__((target("avx512f,avx512bw")))
+#elif defined _MSC_VER && (defined _M_X64 || defined _M_IX86)
+#define SAIL_X86_KERNELS
+#define SAIL_TARGET_SSE2
+#define SAIL_TARGET_SSSE3
+#define SAIL_TARGET_SSE4_1
+#define SAIL_TARGET_AVX2
+#define SAIL_TARGET_AVX512
+#endif
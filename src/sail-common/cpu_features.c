@@ -0,0 +1,296 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <sail-common/sail-common.h>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define SAIL_CPU_X86
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <immintrin.h>
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define SAIL_CPU_AARCH64
+#elif defined(__arm__) && defined(__linux__)
+#define SAIL_CPU_ARM_LINUX
+#include <asm/hwcap.h>
+#include <sys/auxv.h>
+#endif
+
+#ifdef SAIL_WIN32
+#include <Windows.h>
+#endif
+
+/* -1 until detected. */
+static int cached_cpu_features = -1;
+
+/* The features every level of SAIL_CPU_LEVEL keeps. Every x86 level includes the older ones. */
+enum
+{
+    CPU_LEVEL_SSE2   = SAIL_CPU_FEATURE_SSE2,
+    CPU_LEVEL_SSSE3  = CPU_LEVEL_SSE2 | SAIL_CPU_FEATURE_SSSE3,
+    CPU_LEVEL_SSE4_1 = CPU_LEVEL_SSSE3 | SAIL_CPU_FEATURE_SSE4_1,
+    CPU_LEVEL_AVX2   = CPU_LEVEL_SSE4_1 | SAIL_CPU_FEATURE_AVX2,
+    CPU_LEVEL_AVX512 = CPU_LEVEL_AVX2 | SAIL_CPU_FEATURE_AVX512,
+};
+
+static const struct
+{
+    const char* name;
+    int cpu_features;
+} CPU_LEVELS[] = {
+    {"scalar", 0                    },
+    {"sse2",   CPU_LEVEL_SSE2       },
+    {"ssse3",  CPU_LEVEL_SSSE3      },
+    {"sse4.1", CPU_LEVEL_SSE4_1     },
+    {"avx2",   CPU_LEVEL_AVX2       },
+    {"avx512", CPU_LEVEL_AVX512     },
+    {"neon",   SAIL_CPU_FEATURE_NEON},
+};
+
+/*
+ * Private functions.
+ */
+
+#ifdef SAIL_CPU_X86
+static void cpuid(unsigned leaf, unsigned subleaf, unsigned registers[4])
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    __cpuidex((int*)registers, (int)leaf, (int)subleaf);
+#else
+    if (!__get_cpuid_count(leaf, subleaf, &registers[0], &registers[1], &registers[2], &registers[3]))
+    {
+        registers[0] = registers[1] = registers[2] = registers[3] = 0;
+    }
+#endif
+}
+
+/* Returns the register states the operating system saves on context switches. */
+static unsigned long long xgetbv(void)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    return _xgetbv(0);
+#else
+    unsigned eax, edx;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+
+    return ((unsigned long long)edx << 32) | eax;
+#endif
+}
+
+static int detect_cpu_features(void)
+{
+    unsigned registers[4];
+    int cpu_features = 0;
+
+    cpuid(0, 0, registers);
+    const unsigned max_leaf = registers[0];
+
+    if (max_leaf < 1)
+    {
+        return 0;
+    }
+
+    cpuid(1, 0, registers);
+
+    const unsigned ecx1 = registers[2];
+    const unsigned edx1 = registers[3];
+
+    if (edx1 & (1u << 26))
+    {
+        cpu_features |= SAIL_CPU_FEATURE_SSE2;
+    }
+    if (ecx1 & (1u << 9))
+    {
+        cpu_features |= SAIL_CPU_FEATURE_SSSE3;
+    }
+    if (ecx1 & (1u << 19))
+    {
+        cpu_features |= SAIL_CPU_FEATURE_SSE4_1;
+    }
+
+    /* OSXSAVE and AVX. */
+    if ((ecx1 & (1u << 27)) == 0 || (ecx1 & (1u << 28)) == 0 || max_leaf < 7)
+    {
+        return cpu_features;
+    }
+
+    const unsigned long long xcr0 = xgetbv();
+
+    cpuid(7, 0, registers);
+    const unsigned ebx7 = registers[1];
+
+    /* XMM and YMM states. */
+    if ((xcr0 & 0x6) == 0x6 && (ebx7 & (1u << 5)))
+    {
+        cpu_features |= SAIL_CPU_FEATURE_AVX2;
+    }
+
+    /* Opmask, and ZMM states. AVX512F and AVX512BW. */
+    if ((xcr0 & 0xE6) == 0xE6 && (ebx7 & (1u << 16)) && (ebx7 & (1u << 30)))
+    {
+        cpu_features |= SAIL_CPU_FEATURE_AVX512;
+    }
+
+    return cpu_features;
+}
+#elif defined(SAIL_CPU_AARCH64)
+static int detect_cpu_features(void)
+{
+    /* NEON is a mandatory part of AArch64. */
+    return SAIL_CPU_FEATURE_NEON;
+}
+#elif defined(SAIL_CPU_ARM_LINUX)
+static int detect_cpu_features(void)
+{
+    return (getauxval(AT_HWCAP) & HWCAP_NEON) ? SAIL_CPU_FEATURE_NEON : 0;
+}
+#else
+static int detect_cpu_features(void)
+{
+    return 0;
+}
+#endif
+
+static int limit_cpu_features(int cpu_features)
+{
+    const char* env;
+
+#ifdef SAIL_WIN32
+    char* env_dup = NULL;
+    _dupenv_s(&env_dup, NULL, "SAIL_CPU_LEVEL");
+    env = env_dup;
+#else
+    env = getenv("SAIL_CPU_LEVEL");
+#endif
+
+    if (env == NULL || env[0] == '\0')
+    {
+#ifdef SAIL_WIN32
+        free(env_dup);
+#endif
+        return cpu_features;
+    }
+
+    bool found = false;
+
+    for (size_t i = 0; i < sizeof(CPU_LEVELS) / sizeof(CPU_LEVELS[0]); i++)
+    {
+        if (strcmp(env, CPU_LEVELS[i].name) == 0)
+        {
+            SAIL_LOG_DEBUG("SAIL_CPU_LEVEL is set to '%s'", env);
+            cpu_features &= CPU_LEVELS[i].cpu_features;
+            found         = true;
+            break;
+        }
+    }
+
+    if (!found)
+    {
+        SAIL_LOG_WARNING("Ignoring unknown SAIL_CPU_LEVEL '%s'", env);
+    }
+
+#ifdef SAIL_WIN32
+    free(env_dup);
+#endif
+
+    return cpu_features;
+}
+
+static int load_cached_cpu_features(void)
+{
+#ifdef SAIL_WIN32
+    return (int)InterlockedCompareExchange((volatile LONG*)&cached_cpu_features, -1, -1);
+#else
+    return __atomic_load_n(&cached_cpu_features, __ATOMIC_ACQUIRE);
+#endif
+}
+
+static void store_cached_cpu_features(int cpu_features)
+{
+#ifdef SAIL_WIN32
+    InterlockedExchange((volatile LONG*)&cached_cpu_features, (LONG)cpu_features);
+#else
+    __atomic_store_n(&cached_cpu_features, cpu_features, __ATOMIC_RELEASE);
+#endif
+}
+
+/*
+ * Public functions.
+ */
+
+int sail_cpu_features(void)
+{
+    int cpu_features = load_cached_cpu_features();
+
+    /* Threads racing here detect the same features. */
+    if (cpu_features < 0)
+    {
+        cpu_features = limit_cpu_features(detect_cpu_features());
+        store_cached_cpu_features(cpu_features);
+    }
+
+    return cpu_features;
+}
+
+const char* sail_cpu_feature_to_string(enum SailCpuFeature cpu_feature)
+{
+    switch (cpu_feature)
+    {
+    case SAIL_CPU_FEATURE_SSE2: return "SSE2";
+    case SAIL_CPU_FEATURE_SSSE3: return "SSSE3";
+    case SAIL_CPU_FEATURE_SSE4_1: return "SSE4.1";
+    case SAIL_CPU_FEATURE_AVX2: return "AVX2";
+    case SAIL_CPU_FEATURE_AVX512: return "AVX-512";
+    case SAIL_CPU_FEATURE_NEON: return "NEON";
+    }
+
+    return NULL;
+}
+
+sail_kernel_func_t sail_select_kernel(const struct sail_kernel_variant* variants, size_t count)
+{
+    if (variants == NULL)
+    {
+        return NULL;
+    }
+
+    const int cpu_features = sail_cpu_features();
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if ((variants[i].cpu_features & cpu_features) == variants[i].cpu_features)
+        {
+            return variants[i].kernel;
+        }
+    }
+
+    return NULL;
+}
@@ -0,0 +1,106 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <stddef.h>
+
+#include <sail-common/export.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*
+ * CPU features SAIL kernels are specialized for.
+ */
+enum SailCpuFeature
+{
+    SAIL_CPU_FEATURE_SSE2   = 1 << 0,
+    SAIL_CPU_FEATURE_SSSE3  = 1 << 1,
+    SAIL_CPU_FEATURE_SSE4_1 = 1 << 2,
+    SAIL_CPU_FEATURE_AVX2   = 1 << 3,
+    /* AVX-512 Foundation, and Byte and Word instructions. */
+    SAIL_CPU_FEATURE_AVX512 = 1 << 4,
+    SAIL_CPU_FEATURE_NEON   = 1 << 5,
+};
+
+/*
+ * Returns the Or-ed SailCpuFeature-s of the CPU that SAIL kernels may use. AVX2 and AVX-512
+ * are reported only when the operating system saves their registers.
+ *
+ * The SAIL_CPU_LEVEL environment variable limits the features for testing and benchmarking:
+ *   - "scalar": no features, only the portable kernels are used
+ *   - "sse2", "ssse3", "sse4.1", "avx2", "avx512": the x86 instruction set and the older ones
+ *   - "neon": NEON on ARM
+ * A level above what the CPU supports has no effect. The features are detected and the variable
+ * is read once, so change it before SAIL starts.
+ *
+ * Thread-safe.
+ */
+SAIL_EXPORT int sail_cpu_features(void);
+
+/*
+ * Returns a string representation of the specified CPU feature. For example: "AVX2".
+ * Returns NULL if the feature is not known.
+ */
+SAIL_EXPORT const char* sail_cpu_feature_to_string(enum SailCpuFeature cpu_feature);
+
+/*
+ * Generic kernel type stored in dispatch tables. Cast kernels to and from their real types.
+ */
+typedef void (*sail_kernel_func_t)(void);
+
+/*
+ * Kernel specialized for CPU features. A dispatch table is an array of variants sorted
+ * from the fastest kernel to the portable one, for example:
+ *
+ *     static const struct sail_kernel_variant VARIANTS[] = {
+ *         { SAIL_CPU_FEATURE_AVX2,   (sail_kernel_func_t)convert_avx2   },
+ *         { SAIL_CPU_FEATURE_SSE4_1, (sail_kernel_func_t)convert_sse4_1 },
+ *         { 0,                       (sail_kernel_func_t)convert_scalar },
+ *     };
+ */
+struct sail_kernel_variant
+{
+    /* Or-ed SailCpuFeature-s the kernel needs. 0 for portable kernels. */
+    int cpu_features;
+
+    sail_kernel_func_t kernel;
+};
+
+/*
+ * Returns the kernel of the first variant all the CPU features of which are available.
+ * See sail_cpu_features(). Returns NULL if no variant matches.
+ *
+ * Thread-safe.
+ */
+SAIL_EXPORT sail_kernel_func_t sail_select_kernel(const struct sail_kernel_variant* variants, size_t count);
+
+/* extern "C" */
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,53 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <sail-common/sail-common.h>
+
+static sail_embedded_image_loader_t embedded_image_loader = NULL;
+
+/*
+ * Public functions.
+ */
+
+void sail_set_embedded_image_loader(sail_embedded_image_loader_t loader)
+{
+    embedded_image_loader = loader;
+}
+
+sail_status_t sail_load_embedded_image(const void* buffer, size_t buffer_size, struct sail_image** image)
+{
+    SAIL_CHECK_PTR(buffer);
+    SAIL_CHECK_PTR(image);
+
+    if (embedded_image_loader == NULL)
+    {
+        SAIL_LOG_ERROR("No loader is set to decode embedded images");
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_NOT_IMPLEMENTED);
+    }
+
+    SAIL_TRY(embedded_image_loader(buffer, buffer_size, image));
+
+    return SAIL_OK;
+}
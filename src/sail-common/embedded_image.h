@@ -0,0 +1,67 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <stddef.h>
+
+#include <sail-common/export.h>
+#include <sail-common/status.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+struct sail_image;
+
+/*
+ * Loads the first frame of an image stored in memory in any supported format.
+ *
+ * Returns SAIL_OK on success.
+ */
+typedef sail_status_t (*sail_embedded_image_loader_t)(const void* buffer, size_t buffer_size, struct sail_image** image);
+
+/*
+ * Sets the loader that codecs use to decode images embedded into other images, like JPEG previews
+ * in RAW or PSD files. libsail sets it to sail_load_from_memory() on initialization, so codecs can
+ * decode formats they don't link against. Pass NULL to disable decoding embedded images.
+ *
+ * Not thread-safe. Don't call it while loading images.
+ */
+SAIL_EXPORT void sail_set_embedded_image_loader(sail_embedded_image_loader_t loader);
+
+/*
+ * Loads the image embedded into another image with the loader set by sail_set_embedded_image_loader().
+ *
+ * Returns SAIL_OK on success.
+ * Returns SAIL_ERROR_NOT_IMPLEMENTED when no loader is set.
+ */
+SAIL_EXPORT sail_status_t sail_load_embedded_image(const void* buffer, size_t buffer_size, struct sail_image** image);
+
+/* extern "C" */
+#ifdef __cplusplus
+}
+#endif
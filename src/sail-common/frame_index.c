@@ -0,0 +1,159 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <string.h>
+
+#include "sail-common.h"
+
+#include "options_private.h"
+
+/*
+ * Public functions.
+ */
+
+sail_status_t sail_alloc_frame_index(struct sail_frame_index** frame_index)
+{
+    SAIL_CHECK_PTR(frame_index);
+
+    void* ptr;
+    SAIL_TRY(sail_malloc(sizeof(struct sail_frame_index), &ptr));
+    struct sail_frame_index* frame_index_local = ptr;
+
+    frame_index_local->entries          = NULL;
+    frame_index_local->entries_count    = 0;
+    frame_index_local->entries_capacity = 0;
+    frame_index_local->next_frame       = 0;
+    frame_index_local->resume           = false;
+
+    *frame_index = frame_index_local;
+
+    return SAIL_OK;
+}
+
+void sail_destroy_frame_index(struct sail_frame_index* frame_index)
+{
+    if (frame_index == NULL)
+    {
+        return;
+    }
+
+    for (unsigned i = 0; i < frame_index->entries_count; i++)
+    {
+        sail_free(frame_index->entries[i].data);
+    }
+
+    sail_free(frame_index->entries);
+    sail_free(frame_index);
+}
+
+bool sail_indexing_frame(const struct sail_load_options* load_options)
+{
+    const struct sail_frame_index* frame_index = sail_load_options_frame_index(load_options);
+
+    return frame_index != NULL && !frame_index->resume && frame_index->next_frame == frame_index->entries_count;
+}
+
+sail_status_t sail_record_frame(const struct sail_load_options* load_options,
+                                size_t offset,
+                                bool keyframe,
+                                int disposal,
+                                const void* data,
+                                size_t data_size)
+{
+    SAIL_CHECK_PTR(load_options);
+
+    if (!sail_indexing_frame(load_options))
+    {
+        return SAIL_OK;
+    }
+
+    struct sail_frame_index* frame_index = sail_load_options_frame_index(load_options);
+
+    if (frame_index->entries_count == frame_index->entries_capacity)
+    {
+        const unsigned entries_capacity = (frame_index->entries_capacity == 0) ? 16 : frame_index->entries_capacity * 2;
+
+        void* ptr = frame_index->entries;
+        SAIL_TRY(sail_realloc(sizeof(struct sail_frame_index_entry) * entries_capacity, &ptr));
+        frame_index->entries          = ptr;
+        frame_index->entries_capacity = entries_capacity;
+    }
+
+    struct sail_frame_index_entry* entry = &frame_index->entries[frame_index->entries_count];
+
+    entry->offset    = offset;
+    entry->keyframe  = keyframe;
+    entry->disposal  = disposal;
+    entry->data      = NULL;
+    entry->data_size = 0;
+
+    if (data != NULL && data_size > 0)
+    {
+        SAIL_TRY(sail_memdup(data, data_size, &entry->data));
+        entry->data_size = data_size;
+    }
+
+    frame_index->entries_count++;
+
+    return SAIL_OK;
+}
+
+bool sail_take_frame_to_resume(const struct sail_load_options* load_options,
+                               unsigned* frame,
+                               const struct sail_frame_index_entry** entry)
+{
+    struct sail_frame_index* frame_index = sail_load_options_frame_index(load_options);
+
+    if (frame_index == NULL || !frame_index->resume || frame_index->next_frame >= frame_index->entries_count)
+    {
+        return false;
+    }
+
+    frame_index->resume = false;
+
+    *frame = frame_index->next_frame;
+    *entry = &frame_index->entries[frame_index->next_frame];
+
+    return true;
+}
+
+bool sail_find_keyframe(const struct sail_frame_index* frame_index, unsigned frame, unsigned* keyframe)
+{
+    if (frame_index->entries_count == 0)
+    {
+        return false;
+    }
+
+    for (unsigned i = SAIL_MIN(frame, frame_index->entries_count - 1) + 1; i > 0; i--)
+    {
+        if (frame_index->entries[i - 1].keyframe)
+        {
+            *keyframe = i - 1;
+            return true;
+        }
+    }
+
+    return false;
+}
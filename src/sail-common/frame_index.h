@@ -0,0 +1,144 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include <sail-common/export.h>
+#include <sail-common/status.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+struct sail_load_options;
+
+/*
+ * Frame recorded in the frame index by codecs with SAIL_CODEC_FEATURE_FRAME_INDEX.
+ */
+struct sail_frame_index_entry
+{
+    /*
+     * Codec-defined position of the frame to resume loading at. For example, an I/O offset,
+     * a TIFF directory offset, or a frame number in a container.
+     */
+    size_t offset;
+
+    /* True when the frame is decoded without the preceding frames. */
+    bool keyframe;
+
+    /* Codec-defined disposal of the frame. For example, a GIF or WebP disposal method. 0 if unused. */
+    int disposal;
+
+    /*
+     * Codec-defined decoder state to restore when resuming at the frame. For example,
+     * the palette an FLI frame starts with. NULL if unused.
+     */
+    void* data;
+    size_t data_size;
+};
+
+/*
+ * Per-state index of the frames visited so far. SAIL uses it in sail_seek_to_frame() to resume
+ * loading at a recorded frame, or at the nearest keyframe before it, without walking the frames
+ * from the beginning.
+ */
+struct sail_frame_index
+{
+    /* Recorded frames in the frame order. */
+    struct sail_frame_index_entry* entries;
+    unsigned entries_count;
+    unsigned entries_capacity;
+
+    /* Zero-based number of the frame returned by the next seek_next_frame(). Set by SAIL. */
+    unsigned next_frame;
+
+    /* True when the next seek_next_frame() must resume at the recorded next_frame. Set by SAIL. */
+    bool resume;
+};
+
+typedef struct sail_frame_index_entry sail_frame_index_entry_t;
+typedef struct sail_frame_index sail_frame_index_t;
+
+/*
+ * Allocates a new empty frame index.
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_EXPORT sail_status_t sail_alloc_frame_index(struct sail_frame_index** frame_index);
+
+/*
+ * Destroys the specified frame index and the data of its entries. Does nothing if the frame index is NULL.
+ */
+SAIL_EXPORT void sail_destroy_frame_index(struct sail_frame_index* frame_index);
+
+/*
+ * Returns true if the frame returned by the current seek_next_frame() is not recorded yet.
+ * Codecs use it to skip gathering the frame index entry when it's not needed.
+ */
+SAIL_EXPORT bool sail_indexing_frame(const struct sail_load_options* load_options);
+
+/*
+ * Records the frame returned by the current seek_next_frame() in the frame index. Codecs
+ * with SAIL_CODEC_FEATURE_FRAME_INDEX must call it for every frame they return. data of data_size
+ * bytes is copied. Does nothing if sail_indexing_frame() returns false.
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_EXPORT sail_status_t sail_record_frame(const struct sail_load_options* load_options,
+                                            size_t offset,
+                                            bool keyframe,
+                                            int disposal,
+                                            const void* data,
+                                            size_t data_size);
+
+/*
+ * Returns true if SAIL asks the codec to resume loading at a recorded frame. Codecs with
+ * SAIL_CODEC_FEATURE_FRAME_INDEX must call it at the start of seek_next_frame(). Then *frame is
+ * the zero-based number of the frame to return, and *entry is its recorded entry. The codec
+ * must restore its position and state from the entry, forget any pending frame, and return
+ * the recorded frame. The request is reset.
+ *
+ * The codec state is restored just for keyframes. SAIL decodes all the frames from a keyframe
+ * to the requested frame.
+ */
+SAIL_EXPORT bool sail_take_frame_to_resume(const struct sail_load_options* load_options,
+                                           unsigned* frame,
+                                           const struct sail_frame_index_entry** entry);
+
+/*
+ * Finds the nearest recorded keyframe at or before the specified frame.
+ *
+ * Returns true if the keyframe is found.
+ */
+SAIL_EXPORT bool sail_find_keyframe(const struct sail_frame_index* frame_index, unsigned frame, unsigned* keyframe);
+
+/* extern "C" */
+#ifdef __cplusplus
+}
+#endif
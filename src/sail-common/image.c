@@ -36,22 +36,81 @@ sail_status_t sail_alloc_image(struct sail_image** image)
     SAIL_TRY(sail_malloc(sizeof(struct sail_image), &ptr));
     *image = ptr;
 
-    (*image)->pixels         = NULL;
-    (*image)->width          = 0;
-    (*image)->height         = 0;
-    (*image)->bytes_per_line = 0;
-    (*image)->resolution     = NULL;
-    (*image)->pixel_format   = SAIL_PIXEL_FORMAT_UNKNOWN;
-    (*image)->gamma          = 0;
-    (*image)->delay          = -1;
-    (*image)->palette        = NULL;
-    (*image)->meta_data_node = NULL;
-    (*image)->iccp           = NULL;
-    (*image)->source_image   = NULL;
+    (*image)->pixels           = NULL;
+    (*image)->width            = 0;
+    (*image)->height           = 0;
+    (*image)->bytes_per_line   = 0;
+    (*image)->resolution       = NULL;
+    (*image)->pixel_format     = SAIL_PIXEL_FORMAT_UNKNOWN;
+    (*image)->gamma            = 0;
+    (*image)->delay            = -1;
+    (*image)->palette          = NULL;
+    (*image)->meta_data_node   = NULL;
+    (*image)->iccp             = NULL;
+    (*image)->source_image     = NULL;
+    (*image)->pixels_alignment = 0;
 
     return SAIL_OK;
 }
 
+sail_status_t sail_alloc_image_with_alignment(enum SailPixelFormat pixel_format,
+                                              unsigned width,
+                                              unsigned height,
+                                              unsigned alignment,
+                                              struct sail_image** image)
+{
+    SAIL_CHECK_PTR(image);
+
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0)
+    {
+        SAIL_LOG_ERROR("Pixels alignment %u is not a power of two", alignment);
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_INVALID_ARGUMENT);
+    }
+
+    struct sail_image* image_local;
+    SAIL_TRY(sail_alloc_image(&image_local));
+
+    image_local->width          = width;
+    image_local->height         = height;
+    image_local->pixel_format   = pixel_format;
+    image_local->bytes_per_line = sail_align_bytes_per_line(sail_bytes_per_line(width, pixel_format), alignment);
+
+    SAIL_TRY_OR_CLEANUP(sail_check_image_skeleton_valid(image_local),
+                        /* cleanup */ sail_destroy_image(image_local));
+
+    size_t pixels_size;
+    SAIL_TRY_OR_CLEANUP(sail_pixels_buffer_size(image_local->height, image_local->bytes_per_line, &pixels_size),
+                        /* cleanup */ sail_destroy_image(image_local));
+    SAIL_TRY_OR_CLEANUP(sail_malloc_aligned(alignment, pixels_size, &image_local->pixels),
+                        /* cleanup */ sail_destroy_image(image_local));
+
+    image_local->pixels_alignment = alignment;
+
+    *image = image_local;
+
+    return SAIL_OK;
+}
+
+static unsigned default_pixels_alignment = 0;
+
+sail_status_t sail_set_default_pixels_alignment(unsigned alignment)
+{
+    if ((alignment & (alignment - 1)) != 0)
+    {
+        SAIL_LOG_ERROR("Pixels alignment %u is not a power of two", alignment);
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_INVALID_ARGUMENT);
+    }
+
+    default_pixels_alignment = alignment;
+
+    return SAIL_OK;
+}
+
+unsigned sail_default_pixels_alignment(void)
+{
+    return default_pixels_alignment;
+}
+
 void sail_destroy_image(struct sail_image* image)
 {
     if (image == NULL)
@@ -59,7 +118,14 @@ void sail_destroy_image(struct sail_image* image)
         return;
     }
 
-    sail_free(image->pixels);
+    if (image->pixels_alignment != 0)
+    {
+        sail_free_aligned(image->pixels);
+    }
+    else
+    {
+        sail_free(image->pixels);
+    }
 
     sail_destroy_resolution(image->resolution);
     sail_destroy_palette(image->palette);
@@ -85,8 +151,19 @@ sail_status_t sail_copy_image(const struct sail_image* source, struct sail_image
 
         SAIL_TRY_OR_CLEANUP(sail_pixels_buffer_size(source->height, source->bytes_per_line, &pixels_size),
                             /* cleanup */ sail_destroy_image(image_local));
-        SAIL_TRY_OR_CLEANUP(sail_malloc(pixels_size, &image_local->pixels),
-                            /* cleanup */ sail_destroy_image(image_local));
+
+        if (source->pixels_alignment != 0)
+        {
+            SAIL_TRY_OR_CLEANUP(sail_malloc_aligned(source->pixels_alignment, pixels_size, &image_local->pixels),
+                                /* cleanup */ sail_destroy_image(image_local));
+
+            image_local->pixels_alignment = source->pixels_alignment;
+        }
+        else
+        {
+            SAIL_TRY_OR_CLEANUP(sail_malloc(pixels_size, &image_local->pixels),
+                                /* cleanup */ sail_destroy_image(image_local));
+        }
 
         memcpy(image_local->pixels, source->pixels, pixels_size);
     }
@@ -160,6 +160,17 @@ struct sail_image
      * SAVE: Ignored.
      */
     struct sail_source_image* source_image;
+
+    /*
+     * Alignment of the pixels in bytes if they were allocated with sail_malloc_aligned(), or 0
+     * if they were allocated with sail_malloc(). sail_destroy_image() uses it to free the pixels.
+     * Pixels taken out of the image must be freed accordingly.
+     *
+     * LOAD: Set by SAIL to the pixels alignment requested in the load options, or to the default
+     *       pixels alignment. See sail_set_default_pixels_alignment().
+     * SAVE: Ignored.
+     */
+    unsigned pixels_alignment;
 };
 
 typedef struct sail_image sail_image_t;
@@ -171,6 +182,35 @@ typedef struct sail_image sail_image_t;
  */
 SAIL_EXPORT sail_status_t sail_alloc_image(struct sail_image** image);
 
+/*
+ * Allocates a new image with pixels of the specified format and dimensions. The scan lines are padded
+ * to a multiple of the alignment, and the pixels are aligned to it. The alignment must be a power
+ * of two, for example 64 to let SIMD code use aligned loads on every scan line. The pixels have
+ * uninitialized values.
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_EXPORT sail_status_t sail_alloc_image_with_alignment(enum SailPixelFormat pixel_format,
+                                                          unsigned width,
+                                                          unsigned height,
+                                                          unsigned alignment,
+                                                          struct sail_image** image);
+
+/*
+ * Sets the default alignment of the pixels of loaded images. Load options can override it.
+ * 0 disables alignment, which is the default. The alignment must be a power of two.
+ *
+ * This function is not thread-safe. Call it before loading images.
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_EXPORT sail_status_t sail_set_default_pixels_alignment(unsigned alignment);
+
+/*
+ * Returns the default alignment of the pixels of loaded images. See sail_set_default_pixels_alignment().
+ */
+SAIL_EXPORT unsigned sail_default_pixels_alignment(void);
+
 /*
  * Destroys the specified image and all its internal allocated memory buffers. The image MUST NOT be used anymore
  * after calling this function. Does nothing if the image is NULL.
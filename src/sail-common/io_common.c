@@ -49,6 +49,7 @@ sail_status_t sail_alloc_io(struct sail_io** io)
     (*io)->close          = NULL;
     (*io)->eof            = NULL;
     (*io)->size           = NULL;
+    (*io)->borrow         = NULL;
 
     return SAIL_OK;
 }
@@ -201,6 +202,61 @@ sail_status_t sail_alloc_data_from_io_contents(struct sail_io* io, void** data,
     return SAIL_OK;
 }
 
+sail_status_t sail_borrow_or_alloc_data_from_io(struct sail_io* io,
+                                                size_t size,
+                                                const void** data,
+                                                void** data_to_free)
+{
+    SAIL_CHECK_PTR(io);
+    SAIL_CHECK_PTR(data);
+    SAIL_CHECK_PTR(data_to_free);
+
+    if (io->borrow != NULL)
+    {
+        SAIL_TRY(io->borrow(io->stream, size, data));
+        *data_to_free = NULL;
+
+        return SAIL_OK;
+    }
+
+    void* data_local;
+    SAIL_TRY(sail_malloc(size, &data_local));
+
+    SAIL_TRY_OR_CLEANUP(io->strict_read(io->stream, data_local, size),
+                        /* cleanup */ sail_free(data_local));
+
+    *data         = data_local;
+    *data_to_free = data_local;
+
+    return SAIL_OK;
+}
+
+sail_status_t sail_borrow_or_alloc_data_from_io_contents(struct sail_io* io,
+                                                         const void** data,
+                                                         size_t* data_size,
+                                                         void** data_to_free)
+{
+    SAIL_CHECK_PTR(io);
+    SAIL_CHECK_PTR(data_size);
+
+    size_t size;
+    SAIL_TRY(sail_io_size(io, &size));
+
+    size_t offset;
+    SAIL_TRY(io->tell(io->stream, &offset));
+
+    if (offset > size)
+    {
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_READ_IO);
+    }
+
+    SAIL_TRY(sail_borrow_or_alloc_data_from_io(io, size - offset, data, data_to_free));
+
+    *data_size = size - offset;
+
+    return SAIL_OK;
+}
+
 sail_status_t sail_read_string_from_io(struct sail_io* io, char* str, size_t str_size)
 {
     SAIL_CHECK_PTR(io);
@@ -124,6 +124,19 @@ typedef sail_status_t (*sail_io_eof_t)(void* stream, bool* result);
  */
 typedef sail_status_t (*sail_io_size_t)(void* stream, size_t* size);
 
+/*
+ * Assigns a pointer to 'size' contiguous bytes starting at the current position
+ * of the underlying I/O object to the 'data' argument without copying them, and advances
+ * the current position by 'size'. The memory is owned by the I/O object and stays valid
+ * until the I/O object is closed. Must not be modified.
+ *
+ * This callback is optional. Only I/O objects backed by memory (like memory buffers or
+ * memory-mapped files) implement it.
+ *
+ * Returns SAIL_OK on success.
+ */
+typedef sail_status_t (*sail_io_borrow_t)(void* stream, size_t size, const void** data);
+
 /* I/O features. */
 enum SailIoFeature
 {
@@ -199,6 +212,12 @@ struct sail_io
      * Size callback.
      */
     sail_io_size_t size;
+
+    /*
+     * Optional borrow callback. NULL if the I/O object cannot expose its contents
+     * without copying.
+     */
+    sail_io_borrow_t borrow;
 };
 
 typedef struct sail_io sail_io_t;
@@ -260,6 +279,35 @@ SAIL_EXPORT sail_status_t sail_io_contents_into_data(struct sail_io* io, void* d
  */
 SAIL_EXPORT sail_status_t sail_alloc_data_from_io_contents(struct sail_io* io, void** data, size_t* data_size);
 
+/*
+ * Gets 'size' bytes from the specified I/O stream starting at the current position.
+ * If the I/O object implements the borrow callback, the bytes are borrowed from it without
+ * copying, and NULL is stored in 'data_to_free'. Otherwise, a memory buffer is allocated and
+ * the bytes are read into it. The allocated buffer is also stored in 'data_to_free'.
+ *
+ * Borrowed data stays valid until the I/O object is closed. Always call sail_free()
+ * on 'data_to_free' when the data is not needed anymore.
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_EXPORT sail_status_t sail_borrow_or_alloc_data_from_io(struct sail_io* io,
+                                                            size_t size,
+                                                            const void** data,
+                                                            void** data_to_free);
+
+/*
+ * Gets the rest of the specified I/O stream starting at the current position. Borrows
+ * the contents without copying when possible. See sail_borrow_or_alloc_data_from_io().
+ *
+ * The size of the data is stored in 'data_size'.
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_EXPORT sail_status_t sail_borrow_or_alloc_data_from_io_contents(struct sail_io* io,
+                                                                     const void** data,
+                                                                     size_t* data_size,
+                                                                     void** data_to_free);
+
 /*
  * Reads a string ended with '\n' from the I/O stream. Trailing new line characters
  * are not stripped. The string buffer size must be >= 2 to hold at least "\n".
@@ -23,20 +23,44 @@
     SOFTWARE.
 */
 
+#include <stdint.h>
 #include <stdlib.h>
 
 #include "sail-common.h"
 
+#include "options_private.h"
+
+/* Load options followed by the per-operation state SAIL attaches to them. */
+struct load_options_with_state
+{
+    struct sail_load_options load_options;
+
+    struct sail_row_band* row_band;
+    struct sail_frame_index* frame_index;
+};
+
 sail_status_t sail_alloc_load_options(struct sail_load_options** load_options)
 {
     SAIL_CHECK_PTR(load_options);
 
     void* ptr;
-    SAIL_TRY(sail_malloc(sizeof(struct sail_load_options), &ptr));
-    *load_options = ptr;
+    SAIL_TRY(sail_malloc(sizeof(struct load_options_with_state), &ptr));
+    struct load_options_with_state* load_options_with_state = ptr;
+
+    load_options_with_state->row_band    = NULL;
+    load_options_with_state->frame_index = NULL;
+
+    *load_options = &load_options_with_state->load_options;
 
-    (*load_options)->options = 0;
-    (*load_options)->tuning  = NULL;
+    (*load_options)->options          = 0;
+    (*load_options)->tuning           = NULL;
+    (*load_options)->pixels_alignment = 0;
+    (*load_options)->crop_x           = 0;
+    (*load_options)->crop_y           = 0;
+    (*load_options)->crop_width       = 0;
+    (*load_options)->crop_height      = 0;
+    (*load_options)->max_width        = 0;
+    (*load_options)->max_height       = 0;
 
     return SAIL_OK;
 }
@@ -90,7 +114,14 @@ sail_status_t sail_copy_load_options(const struct sail_load_options* source, str
     struct sail_load_options* target_local;
     SAIL_TRY(sail_alloc_load_options(&target_local));
 
-    target_local->options = source->options;
+    target_local->options          = source->options;
+    target_local->pixels_alignment = source->pixels_alignment;
+    target_local->crop_x           = source->crop_x;
+    target_local->crop_y           = source->crop_y;
+    target_local->crop_width       = source->crop_width;
+    target_local->crop_height      = source->crop_height;
+    target_local->max_width        = source->max_width;
+    target_local->max_height       = source->max_height;
 
     if (source->tuning != NULL)
     {
@@ -102,3 +133,91 @@ sail_status_t sail_copy_load_options(const struct sail_load_options* source, str
 
     return SAIL_OK;
 }
+
+sail_status_t sail_crop_rectangle_from_load_options(const struct sail_load_options* load_options,
+                                                    unsigned width,
+                                                    unsigned height,
+                                                    unsigned* x,
+                                                    unsigned* y,
+                                                    unsigned* crop_width,
+                                                    unsigned* crop_height)
+{
+    SAIL_CHECK_PTR(load_options);
+    SAIL_CHECK_PTR(x);
+    SAIL_CHECK_PTR(y);
+    SAIL_CHECK_PTR(crop_width);
+    SAIL_CHECK_PTR(crop_height);
+
+    if (load_options->crop_width == 0 || load_options->crop_height == 0)
+    {
+        *x           = 0;
+        *y           = 0;
+        *crop_width  = width;
+        *crop_height = height;
+
+        return SAIL_OK;
+    }
+
+    if (load_options->crop_x >= width || load_options->crop_y >= height)
+    {
+        SAIL_LOG_ERROR("Crop rectangle %u,%u %ux%u lies outside of the %ux%u frame", load_options->crop_x,
+                       load_options->crop_y, load_options->crop_width, load_options->crop_height, width, height);
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_INVALID_ARGUMENT);
+    }
+
+    *x           = load_options->crop_x;
+    *y           = load_options->crop_y;
+    *crop_width  = (load_options->crop_width < width - *x) ? load_options->crop_width : width - *x;
+    *crop_height = (load_options->crop_height < height - *y) ? load_options->crop_height : height - *y;
+
+    return SAIL_OK;
+}
+
+unsigned sail_reduction_from_load_options(const struct sail_load_options* load_options,
+                                          unsigned width,
+                                          unsigned height,
+                                          unsigned max_divisor)
+{
+    if (load_options == NULL || (load_options->max_width == 0 && load_options->max_height == 0))
+    {
+        return 1;
+    }
+
+    unsigned divisor = 1;
+
+    while (divisor * 2 <= max_divisor)
+    {
+        const unsigned next_divisor = divisor * 2;
+        const unsigned next_width   = (unsigned)(((uint64_t)width + next_divisor - 1) / next_divisor);
+        const unsigned next_height  = (unsigned)(((uint64_t)height + next_divisor - 1) / next_divisor);
+
+        if (next_width < load_options->max_width || next_height < load_options->max_height)
+        {
+            break;
+        }
+
+        divisor = next_divisor;
+    }
+
+    return divisor;
+}
+
+struct sail_row_band* sail_load_options_row_band(const struct sail_load_options* load_options)
+{
+    return ((const struct load_options_with_state*)load_options)->row_band;
+}
+
+void sail_set_load_options_row_band(struct sail_load_options* load_options, struct sail_row_band* row_band)
+{
+    ((struct load_options_with_state*)load_options)->row_band = row_band;
+}
+
+struct sail_frame_index* sail_load_options_frame_index(const struct sail_load_options* load_options)
+{
+    return ((const struct load_options_with_state*)load_options)->frame_index;
+}
+
+void sail_set_load_options_frame_index(struct sail_load_options* load_options, struct sail_frame_index* frame_index)
+{
+    ((struct load_options_with_state*)load_options)->frame_index = frame_index;
+}
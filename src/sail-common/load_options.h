@@ -59,6 +59,44 @@ struct sail_load_options
      * or forward compatible.
      */
     struct sail_hash_map* tuning;
+
+    /*
+     * Alignment of the loaded pixels in bytes. Must be a power of two. When non-zero, scan lines are padded
+     * to a multiple of it, and the pixels base pointer is aligned to it. For example, 64 makes every
+     * scan line start on a cache line boundary. sail_image.bytes_per_line reflects the padding.
+     *
+     * 0 means the default pixels alignment. See sail_set_default_pixels_alignment().
+     */
+    unsigned pixels_alignment;
+
+    /*
+     * Region of interest to load. When both crop_width and crop_height are non-zero, only the intersection
+     * of the rectangle with every frame is loaded, and loaded images get the dimensions of the intersection.
+     * Loading fails with SAIL_ERROR_INVALID_ARGUMENT when the rectangle lies outside of a frame.
+     *
+     * Codecs with SAIL_CODEC_FEATURE_CROP decode just the required region. For other codecs, SAIL decodes
+     * whole frames and crops them afterwards.
+     *
+     * 0 crop_width or crop_height means no cropping.
+     */
+    unsigned crop_x;
+    unsigned crop_y;
+    unsigned crop_width;
+    unsigned crop_height;
+
+    /*
+     * Size hint for loading reduced frames, for example, for thumbnails. Codecs with SAIL_CODEC_FEATURE_SCALE
+     * use their cheap native reductions, like JPEG DCT scaling or JPEG 2000 resolution levels, and pick
+     * the strongest one that keeps frames at least max_width x max_height. Loaded frames are not scaled
+     * exactly to the hint, so use sail_scale_image() afterwards to get the exact size. The original
+     * dimensions are available in sail_source_image when SAIL_OPTION_SOURCE_IMAGE is enabled.
+     *
+     * The crop rectangle is applied to reduced frames. Other codecs ignore the hint.
+     *
+     * 0 means no limit in that dimension. 0 in both means loading frames in their original size.
+     */
+    unsigned max_width;
+    unsigned max_height;
 };
 
 typedef struct sail_load_options sail_load_options_t;
@@ -92,6 +130,33 @@ SAIL_EXPORT sail_status_t sail_alloc_load_options_from_features(const struct sai
 SAIL_EXPORT sail_status_t sail_copy_load_options(const struct sail_load_options* source,
                                                  struct sail_load_options** target);
 
+/*
+ * Intersects the crop rectangle of the load options with a frame of the specified dimensions
+ * and assigns the intersection. Assigns the whole frame when the load options don't request cropping.
+ * Codecs use it to decode just the requested region.
+ *
+ * Returns SAIL_OK on success.
+ * Returns SAIL_ERROR_INVALID_ARGUMENT when the crop rectangle lies outside of the frame.
+ */
+SAIL_EXPORT sail_status_t sail_crop_rectangle_from_load_options(const struct sail_load_options* load_options,
+                                                                unsigned width,
+                                                                unsigned height,
+                                                                unsigned* x,
+                                                                unsigned* y,
+                                                                unsigned* crop_width,
+                                                                unsigned* crop_height);
+
+/*
+ * Returns the strongest power-of-two reduction divisor, up to max_divisor, that keeps a frame
+ * of the specified dimensions, divided and rounded up, at least as large as the size hint
+ * in the load options. Returns 1 when the load options have no size hint.
+ * Codecs use it to pick their native reduction level.
+ */
+SAIL_EXPORT unsigned sail_reduction_from_load_options(const struct sail_load_options* load_options,
+                                                      unsigned width,
+                                                      unsigned height,
+                                                      unsigned max_divisor);
+
 /* extern "C" */
 #ifdef __cplusplus
 }
@@ -123,7 +123,7 @@ static bool check_ansi_colors_supported(void)
 void sail_log(enum SailLogLevel level, const char* file, int line, const char* format, ...)
 {
     /* Filter out. */
-    if (level > sail_max_log_level)
+    if (!sail_is_log_level_enabled(level))
     {
         return;
     }
@@ -249,6 +249,11 @@ void sail_set_log_barrier(enum SailLogLevel max_level)
     sail_max_log_level = max_level;
 }
 
+bool sail_is_log_level_enabled(enum SailLogLevel level)
+{
+    return level <= sail_max_log_level;
+}
+
 void sail_set_logger(sail_logger logger)
 {
     sail_external_logger = logger;
@@ -69,6 +69,12 @@ SAIL_EXPORT enum SailLogLevel sail_log_level_from_string(const char* str);
  */
 SAIL_EXPORT void sail_set_log_barrier(enum SailLogLevel max_level);
 
+/*
+ * Returns true if messages of the specified log level pass the log barrier set by sail_set_log_barrier().
+ * Use it to skip building expensive log messages that would be filtered out anyway.
+ */
+SAIL_EXPORT bool sail_is_log_level_enabled(enum SailLogLevel level);
+
 /*
  * Sets an external logger to pass all filtered log messages into.
  *
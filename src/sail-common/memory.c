@@ -23,22 +23,398 @@
     SOFTWARE.
 */
 
+#include <inttypes.h>
 #include <limits.h> /* SIZE_MAX */
 #include <stdlib.h>
+#include <string.h>
 
 #include "sail-common.h"
 
+#include "atomic_private.h"
+
+/*
+ * Allocator.
+ */
+static void* default_allocate(void* user_data, size_t size)
+{
+    (void)user_data;
+
+    return malloc(size);
+}
+
+static void* default_reallocate(void* user_data, void* ptr, size_t size)
+{
+    (void)user_data;
+
+    return realloc(ptr, size);
+}
+
+static void default_deallocate(void* user_data, void* ptr)
+{
+    (void)user_data;
+
+    free(ptr);
+}
+
+/*
+ * Memory configuration. It may be changed only until the first allocation. After that, it's published
+ * through active_config and never changes again, so the allocation functions read it without locking.
+ */
+struct memory_config
+{
+    struct sail_allocator allocator;
+    bool accounting_enabled;
+};
+
+static struct memory_config pending_config = {
+    .allocator =
+        {
+            .allocate   = default_allocate,
+            .reallocate = default_reallocate,
+            .deallocate = default_deallocate,
+            .user_data  = NULL,
+        },
+    .accounting_enabled = false,
+};
+
+/* NULL until the first allocation, then &pending_config. */
+static void* active_config = NULL;
+
+/* Spin lock that serializes changing and activating pending_config. */
+static void* config_lock = NULL;
+
+static void lock_config(void)
+{
+    while (sail_atomic_compare_exchange_pointer(&config_lock, NULL, &pending_config) != NULL)
+    {
+    }
+}
+
+static void unlock_config(void)
+{
+    sail_atomic_store_pointer(&config_lock, NULL);
+}
+
+static const struct memory_config* memory_config(void)
+{
+    const struct memory_config* config = sail_atomic_load_pointer(&active_config);
+
+    if (SAIL_LIKELY(config != NULL))
+    {
+        return config;
+    }
+
+    lock_config();
+    sail_atomic_store_pointer(&active_config, &pending_config);
+    unlock_config();
+
+    return &pending_config;
+}
+
+/*
+ * Locks the configuration for changing. Fails if SAIL has already allocated memory with it.
+ */
+static sail_status_t lock_config_for_changing(void)
+{
+    lock_config();
+
+    if (sail_atomic_load_pointer(&active_config) != NULL)
+    {
+        unlock_config();
+        SAIL_LOG_ERROR("Memory configuration cannot be changed after SAIL has allocated memory");
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_CONFLICTING_OPERATION);
+    }
+
+    return SAIL_OK;
+}
+
+/*
+ * Accounting. Every allocation is prefixed with a header that stores the requested size and the tag
+ * of the memory scope it was allocated in. The header size keeps the returned pointers aligned
+ * like malloc() does.
+ */
+#define SAIL_MEMORY_HEADER_SIZE 16
+
+struct memory_header
+{
+    size_t size;
+    uint64_t scope_tag;
+};
+
+static uint64_t current_bytes = 0;
+static uint64_t peak_bytes    = 0;
+static uint64_t allocations   = 0;
+static uint64_t deallocations = 0;
+
+/* Bytes requested by allocations on the current thread. Counted even when accounting is disabled. */
+static SAIL_THREAD_LOCAL uint64_t thread_allocated_bytes = 0;
+
+/*
+ * Memory scopes. Every thread has a stack of scopes. An allocation counts towards every scope
+ * on the stack, and its header stores the tag of the innermost one.
+ *
+ * A tag combines a session number, unique for every outermost scope, with a serial number
+ * that grows with every nested scope of the session. So a block counts towards a scope on the stack
+ * if it has the same session and a serial not less than the scope serial: it was allocated
+ * while the scope was active. Blocks allocated outside of the current session, for example
+ * on other threads, don't affect the scopes when freed.
+ */
+#define SAIL_MEMORY_MAX_SCOPES       8
+#define SAIL_MEMORY_SCOPE_SERIAL_BITS 24
+#define SAIL_MEMORY_SCOPE_SERIAL_MASK ((UINT64_C(1) << SAIL_MEMORY_SCOPE_SERIAL_BITS) - 1)
+
+struct memory_scope
+{
+    uint64_t tag;
+    uint64_t limit_bytes;
+    uint64_t current_bytes;
+    uint64_t peak_bytes;
+    uint64_t allocations;
+    uint64_t deallocations;
+};
+
+static uint64_t last_scope_session = 0;
+
+static SAIL_THREAD_LOCAL struct memory_scope scopes[SAIL_MEMORY_MAX_SCOPES];
+static SAIL_THREAD_LOCAL unsigned scopes_count = 0;
+static SAIL_THREAD_LOCAL uint64_t last_scope_tag = 0;
+
+/* Returns the number of scopes from the bottom of the stack the block with the tag counts towards. */
+static unsigned owning_scopes_count(uint64_t tag)
+{
+    if (SAIL_LIKELY(scopes_count == 0))
+    {
+        return 0;
+    }
+
+    if ((tag & ~SAIL_MEMORY_SCOPE_SERIAL_MASK) != (scopes[0].tag & ~SAIL_MEMORY_SCOPE_SERIAL_MASK))
+    {
+        return 0;
+    }
+
+    unsigned count = 0;
+
+    while (count < scopes_count && scopes[count].tag <= tag)
+    {
+        count++;
+    }
+
+    return count;
+}
+
+static bool scopes_fit(unsigned count, size_t growth)
+{
+    for (unsigned i = 0; i < count; i++)
+    {
+        if (scopes[i].limit_bytes > 0 && scopes[i].current_bytes + growth > scopes[i].limit_bytes)
+        {
+            SAIL_LOG_ERROR("Memory scope limit of %" PRIu64 " bytes is exceeded", scopes[i].limit_bytes);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static void scopes_account_allocation(unsigned count, size_t old_size, size_t new_size)
+{
+    for (unsigned i = 0; i < count; i++)
+    {
+        scopes[i].allocations++;
+        scopes[i].current_bytes = scopes[i].current_bytes - old_size + new_size;
+
+        if (scopes[i].current_bytes > scopes[i].peak_bytes)
+        {
+            scopes[i].peak_bytes = scopes[i].current_bytes;
+        }
+    }
+}
+
+static void scopes_account_deallocation(unsigned count, size_t size)
+{
+    for (unsigned i = 0; i < count; i++)
+    {
+        scopes[i].deallocations++;
+        scopes[i].current_bytes -= size;
+    }
+}
+
+static uint64_t innermost_scope_tag(void)
+{
+    return scopes_count == 0 ? 0 : scopes[scopes_count - 1].tag;
+}
+
+static void update_peak_bytes(uint64_t bytes)
+{
+    uint64_t peak = sail_atomic_load_u64(&peak_bytes);
+
+    /* A failed exchange reloads the peak. */
+    while (bytes > peak)
+    {
+        if (sail_atomic_compare_exchange_u64(&peak_bytes, &peak, bytes))
+        {
+            break;
+        }
+    }
+}
+
+static void account_allocation(size_t old_size, size_t new_size)
+{
+    sail_atomic_add_u64(&allocations, 1);
+
+    if (new_size >= old_size)
+    {
+        update_peak_bytes(sail_atomic_add_u64(&current_bytes, new_size - old_size));
+    }
+    else
+    {
+        sail_atomic_sub_u64(&current_bytes, old_size - new_size);
+    }
+}
+
+static void* allocate(const struct memory_config* config, size_t size)
+{
+    const struct sail_allocator* allocator = &config->allocator;
+
+    if (SAIL_LIKELY(!config->accounting_enabled))
+    {
+        return allocator->allocate(allocator->user_data, size);
+    }
+
+    if (size > SIZE_MAX - SAIL_MEMORY_HEADER_SIZE || !scopes_fit(scopes_count, size))
+    {
+        return NULL;
+    }
+
+    unsigned char* block = allocator->allocate(allocator->user_data, size + SAIL_MEMORY_HEADER_SIZE);
+
+    if (block == NULL)
+    {
+        return NULL;
+    }
+
+    const struct memory_header header = {
+        .size      = size,
+        .scope_tag = innermost_scope_tag(),
+    };
+
+    memcpy(block, &header, sizeof(header));
+    account_allocation(0, size);
+    scopes_account_allocation(scopes_count, 0, size);
+
+    return block + SAIL_MEMORY_HEADER_SIZE;
+}
+
+/*
+ * Stores the size of the reallocated block into old_size. The size is known only in the accounting mode
+ * and for NULL pointers. Otherwise, it's 0.
+ */
+static void* reallocate(const struct memory_config* config, void* ptr, size_t size, size_t* old_size)
+{
+    const struct sail_allocator* allocator = &config->allocator;
+
+    *old_size = 0;
+
+    if (SAIL_LIKELY(!config->accounting_enabled))
+    {
+        return allocator->reallocate(allocator->user_data, ptr, size);
+    }
+
+    if (ptr == NULL)
+    {
+        return allocate(config, size);
+    }
+
+    if (size > SIZE_MAX - SAIL_MEMORY_HEADER_SIZE)
+    {
+        return NULL;
+    }
+
+    unsigned char* block = (unsigned char*)ptr - SAIL_MEMORY_HEADER_SIZE;
+
+    struct memory_header header;
+    memcpy(&header, block, sizeof(header));
+
+    *old_size = header.size;
+
+    /*
+     * The scopes that own the block account the size difference. Blocks allocated outside
+     * of the scopes are adopted by them like new allocations.
+     */
+    unsigned scopes_to_account = owning_scopes_count(header.scope_tag);
+    size_t scopes_old_size     = header.size;
+
+    if (scopes_to_account == 0 && scopes_count > 0)
+    {
+        scopes_to_account = scopes_count;
+        scopes_old_size   = 0;
+        header.scope_tag  = innermost_scope_tag();
+    }
+
+    if (!scopes_fit(scopes_to_account, size > scopes_old_size ? size - scopes_old_size : 0))
+    {
+        return NULL;
+    }
+
+    block = allocator->reallocate(allocator->user_data, block, size + SAIL_MEMORY_HEADER_SIZE);
+
+    if (block == NULL)
+    {
+        return NULL;
+    }
+
+    header.size = size;
+
+    memcpy(block, &header, sizeof(header));
+    account_allocation(*old_size, size);
+    scopes_account_allocation(scopes_to_account, scopes_old_size, size);
+
+    return block + SAIL_MEMORY_HEADER_SIZE;
+}
+
+static void deallocate(const struct memory_config* config, void* ptr)
+{
+    const struct sail_allocator* allocator = &config->allocator;
+
+    if (SAIL_LIKELY(!config->accounting_enabled))
+    {
+        allocator->deallocate(allocator->user_data, ptr);
+        return;
+    }
+
+    if (ptr == NULL)
+    {
+        return;
+    }
+
+    unsigned char* block = (unsigned char*)ptr - SAIL_MEMORY_HEADER_SIZE;
+
+    struct memory_header header;
+    memcpy(&header, block, sizeof(header));
+
+    sail_atomic_sub_u64(&current_bytes, header.size);
+    sail_atomic_add_u64(&deallocations, 1);
+    scopes_account_deallocation(owning_scopes_count(header.scope_tag), header.size);
+
+    allocator->deallocate(allocator->user_data, block);
+}
+
+/*
+ * Public API.
+ */
 sail_status_t sail_malloc(size_t size, void** ptr)
 {
     SAIL_CHECK_PTR(ptr);
 
-    void* ptr_local = malloc(size);
+    void* ptr_local = allocate(memory_config(), size);
 
     if (ptr_local == NULL)
     {
         SAIL_LOG_AND_RETURN(SAIL_ERROR_MEMORY_ALLOCATION);
     }
 
+    thread_allocated_bytes += size;
+
     *ptr = ptr_local;
 
     return SAIL_OK;
@@ -58,13 +434,20 @@ sail_status_t sail_realloc(size_t size, void** ptr)
 {
     SAIL_CHECK_PTR(ptr);
 
-    void* ptr_local = realloc(*ptr, size);
+    size_t old_size;
+    void* ptr_local = reallocate(memory_config(), *ptr, size, &old_size);
 
     if (ptr_local == NULL)
     {
         SAIL_LOG_AND_RETURN(SAIL_ERROR_MEMORY_ALLOCATION);
     }
 
+    /* Count only the growth. Shrinking releases memory rather than requests it. */
+    if (size > old_size)
+    {
+        thread_allocated_bytes += size - old_size;
+    }
+
     *ptr = ptr_local;
 
     return SAIL_OK;
@@ -89,13 +472,31 @@ sail_status_t sail_calloc(size_t nmemb, size_t size, void** ptr)
         SAIL_LOG_AND_RETURN(SAIL_ERROR_MEMORY_ALLOCATION);
     }
 
-    void* ptr_local = calloc(nmemb, size);
+    const struct memory_config* config = memory_config();
+    void* ptr_local;
+
+    /* calloc() may get zeroed pages from the OS for free, so prefer it when possible. */
+    if (config->allocator.allocate == default_allocate && !config->accounting_enabled)
+    {
+        ptr_local = calloc(nmemb, size);
+    }
+    else
+    {
+        ptr_local = allocate(config, nmemb * size);
+
+        if (ptr_local != NULL)
+        {
+            memset(ptr_local, 0, nmemb * size);
+        }
+    }
 
     if (ptr_local == NULL)
     {
         SAIL_LOG_AND_RETURN(SAIL_ERROR_MEMORY_ALLOCATION);
     }
 
+    thread_allocated_bytes += nmemb * size;
+
     *ptr = ptr_local;
 
     return SAIL_OK;
@@ -103,5 +504,202 @@ sail_status_t sail_calloc(size_t nmemb, size_t size, void** ptr)
 
 void sail_free(void* ptr)
 {
-    free(ptr);
+    if (ptr == NULL)
+    {
+        return;
+    }
+
+    deallocate(memory_config(), ptr);
+}
+
+sail_status_t sail_malloc_aligned(size_t alignment, size_t size, void** ptr)
+{
+    SAIL_CHECK_PTR(ptr);
+
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0)
+    {
+        SAIL_LOG_ERROR("Alignment %zu is not a power of two", alignment);
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_INVALID_ARGUMENT);
+    }
+
+    /* Over-allocate and store the original pointer right before the aligned one. */
+    const size_t overhead = alignment - 1 + sizeof(void*);
+
+    if (size > SIZE_MAX - overhead)
+    {
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_MEMORY_ALLOCATION);
+    }
+
+    void* block;
+    SAIL_TRY(sail_malloc(size + overhead, &block));
+
+    const uintptr_t aligned = ((uintptr_t)block + sizeof(void*) + alignment - 1) & ~(uintptr_t)(alignment - 1);
+
+    memcpy((void*)(aligned - sizeof(void*)), &block, sizeof(void*));
+
+    *ptr = (void*)aligned;
+
+    return SAIL_OK;
+}
+
+void sail_free_aligned(void* ptr)
+{
+    if (ptr == NULL)
+    {
+        return;
+    }
+
+    void* block;
+    memcpy(&block, (unsigned char*)ptr - sizeof(void*), sizeof(void*));
+
+    sail_free(block);
+}
+
+sail_status_t sail_set_allocator(const struct sail_allocator* new_allocator)
+{
+    if (new_allocator != NULL)
+    {
+        SAIL_CHECK_PTR(new_allocator->allocate);
+        SAIL_CHECK_PTR(new_allocator->reallocate);
+        SAIL_CHECK_PTR(new_allocator->deallocate);
+    }
+
+    SAIL_TRY(lock_config_for_changing());
+
+    if (new_allocator == NULL)
+    {
+        pending_config.allocator = (struct sail_allocator){
+            .allocate   = default_allocate,
+            .reallocate = default_reallocate,
+            .deallocate = default_deallocate,
+            .user_data  = NULL,
+        };
+    }
+    else
+    {
+        pending_config.allocator = *new_allocator;
+    }
+
+    unlock_config();
+
+    return SAIL_OK;
+}
+
+sail_status_t sail_set_memory_accounting(bool enabled)
+{
+    SAIL_TRY(lock_config_for_changing());
+
+    pending_config.accounting_enabled = enabled;
+
+    unlock_config();
+
+    return SAIL_OK;
+}
+
+sail_status_t sail_memory_stats(struct sail_memory_stats* stats)
+{
+    SAIL_CHECK_PTR(stats);
+
+    *stats = (struct sail_memory_stats){
+        .current_bytes = (size_t)sail_atomic_load_u64(&current_bytes),
+        .peak_bytes    = (size_t)sail_atomic_load_u64(&peak_bytes),
+        .allocations   = sail_atomic_load_u64(&allocations),
+        .deallocations = sail_atomic_load_u64(&deallocations),
+    };
+
+    return SAIL_OK;
+}
+
+void sail_reset_memory_peak(void)
+{
+    sail_atomic_store_u64(&peak_bytes, sail_atomic_load_u64(&current_bytes));
+}
+
+uint64_t sail_thread_allocated_bytes(void)
+{
+    return thread_allocated_bytes;
+}
+
+sail_status_t sail_begin_memory_scope(size_t limit_bytes)
+{
+    if (!memory_config()->accounting_enabled)
+    {
+        SAIL_LOG_ERROR("Memory scopes require the memory accounting mode");
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_CONFLICTING_OPERATION);
+    }
+
+    if (scopes_count == SAIL_MEMORY_MAX_SCOPES)
+    {
+        SAIL_LOG_ERROR("Memory scopes cannot be nested deeper than %d levels", SAIL_MEMORY_MAX_SCOPES);
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_CONFLICTING_OPERATION);
+    }
+
+    uint64_t tag;
+
+    if (scopes_count == 0)
+    {
+        tag = sail_atomic_add_u64(&last_scope_session, 1) << SAIL_MEMORY_SCOPE_SERIAL_BITS;
+    }
+    else
+    {
+        if ((last_scope_tag & SAIL_MEMORY_SCOPE_SERIAL_MASK) == SAIL_MEMORY_SCOPE_SERIAL_MASK)
+        {
+            SAIL_LOG_ERROR("Too many nested memory scopes in the outermost scope");
+            SAIL_LOG_AND_RETURN(SAIL_ERROR_CONFLICTING_OPERATION);
+        }
+
+        tag = last_scope_tag + 1;
+    }
+
+    last_scope_tag = tag;
+
+    scopes[scopes_count++] = (struct memory_scope){
+        .tag           = tag,
+        .limit_bytes   = limit_bytes,
+        .current_bytes = 0,
+        .peak_bytes    = 0,
+        .allocations   = 0,
+        .deallocations = 0,
+    };
+
+    return SAIL_OK;
+}
+
+sail_status_t sail_memory_scope_stats(struct sail_memory_stats* stats)
+{
+    SAIL_CHECK_PTR(stats);
+
+    if (scopes_count == 0)
+    {
+        SAIL_LOG_ERROR("No memory scope is active on the calling thread");
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_CONFLICTING_OPERATION);
+    }
+
+    const struct memory_scope* scope = &scopes[scopes_count - 1];
+
+    *stats = (struct sail_memory_stats){
+        .current_bytes = (size_t)scope->current_bytes,
+        .peak_bytes    = (size_t)scope->peak_bytes,
+        .allocations   = scope->allocations,
+        .deallocations = scope->deallocations,
+    };
+
+    return SAIL_OK;
+}
+
+sail_status_t sail_end_memory_scope(struct sail_memory_stats* stats)
+{
+    if (stats != NULL)
+    {
+        SAIL_TRY(sail_memory_scope_stats(stats));
+    }
+    else if (scopes_count == 0)
+    {
+        SAIL_LOG_ERROR("No memory scope is active on the calling thread");
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_CONFLICTING_OPERATION);
+    }
+
+    scopes_count--;
+
+    return SAIL_OK;
 }
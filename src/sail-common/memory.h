@@ -25,7 +25,9 @@
 
 #pragma once
 
+#include <stdbool.h>
 #include <stddef.h> /* size_t */
+#include <stdint.h>
 
 #include <sail-common/export.h>
 #include <sail-common/status.h>
@@ -79,6 +81,142 @@ SAIL_EXPORT sail_status_t sail_calloc(size_t nmemb, size_t size, void** ptr);
  */
 SAIL_EXPORT void sail_free(void* ptr);
 
+/*
+ * Allocates memory aligned to the specified alignment. The alignment must be a power of two.
+ * The memory must be freed with sail_free_aligned(), not with sail_free().
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_EXPORT sail_status_t sail_malloc_aligned(size_t alignment, size_t size, void** ptr);
+
+/*
+ * Frees memory allocated with sail_malloc_aligned(). Does nothing if the pointer is NULL.
+ */
+SAIL_EXPORT void sail_free_aligned(void* ptr);
+
+/*
+ * Custom memory allocator. All the functions are mandatory. user_data is passed to every function as is.
+ *
+ * allocate() and reallocate() must return NULL on error. reallocate() must behave like allocate()
+ * when ptr is NULL. deallocate() must do nothing when ptr is NULL. The returned pointers
+ * must be aligned suitably for any built-in type, like malloc() does.
+ */
+struct sail_allocator
+{
+    void* (*allocate)(void* user_data, size_t size);
+    void* (*reallocate)(void* user_data, void* ptr, size_t size);
+    void (*deallocate)(void* user_data, void* ptr);
+
+    void* user_data;
+};
+
+typedef struct sail_allocator sail_allocator_t;
+
+/*
+ * Replaces the allocator used by sail_malloc() and friends. Pass NULL to restore the default
+ * malloc()-based allocator. The allocator is copied.
+ *
+ * Call it before any other SAIL function. The allocator cannot be replaced after SAIL has allocated
+ * memory, as that memory would be freed with another allocator.
+ *
+ * Returns SAIL_OK on success or SAIL_ERROR_CONFLICTING_OPERATION if SAIL has already allocated memory.
+ */
+SAIL_EXPORT sail_status_t sail_set_allocator(const struct sail_allocator* allocator);
+
+/*
+ * Memory usage statistics collected in the accounting mode.
+ */
+struct sail_memory_stats
+{
+    /* The number of bytes currently allocated. */
+    size_t current_bytes;
+
+    /* The maximum number of bytes allocated at the same time since accounting was enabled or the peak was reset. */
+    size_t peak_bytes;
+
+    /* The number of successful allocations, including reallocations. */
+    uint64_t allocations;
+
+    /* The number of deallocations of non-NULL pointers. */
+    uint64_t deallocations;
+};
+
+typedef struct sail_memory_stats sail_memory_stats_t;
+
+/*
+ * Enables or disables the memory accounting mode. In this mode, sail_malloc() and friends track
+ * the number of allocated bytes and allocations. It adds a small header to every allocation.
+ *
+ * Call it before any other SAIL function, like sail_set_allocator(). The mode cannot be switched
+ * after SAIL has allocated memory, as the allocations made in different modes are incompatible.
+ *
+ * Returns SAIL_OK on success or SAIL_ERROR_CONFLICTING_OPERATION if SAIL has already allocated memory.
+ */
+SAIL_EXPORT sail_status_t sail_set_memory_accounting(bool enabled);
+
+/*
+ * Assigns the current process-wide memory usage statistics to the 'stats' argument. All the values
+ * are zero if the accounting mode is disabled. Thread-safe.
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_EXPORT sail_status_t sail_memory_stats(struct sail_memory_stats* stats);
+
+/*
+ * Resets the process-wide peak number of allocated bytes to the current number of allocated bytes.
+ * The peak includes allocations made by all threads. Use memory scopes to measure a single request.
+ * Thread-safe.
+ */
+SAIL_EXPORT void sail_reset_memory_peak(void);
+
+/*
+ * Starts a memory scope on the calling thread. The scope accounts the memory allocated on the calling
+ * thread until sail_end_memory_scope() is called. If limit_bytes is not zero, the allocations that
+ * would make the scope hold more than limit_bytes bytes fail with SAIL_ERROR_MEMORY_ALLOCATION.
+ * For example, to limit and measure the memory usage of a single request:
+ *
+ *     sail_begin_memory_scope(64 * 1024 * 1024);
+ *     sail_load_from_file(path, &image);
+ *     sail_end_memory_scope(&stats);
+ *
+ * Scopes can be nested up to 8 levels. An allocation counts towards all the active scopes.
+ * A block counts towards the scopes that were active when it was allocated: freeing it on the same
+ * thread inside these scopes decreases their current number of bytes. Freeing blocks allocated
+ * before the scope or on other threads doesn't affect it. Reallocating them makes the scope adopt
+ * the new block.
+ *
+ * Requires the accounting mode. See sail_set_memory_accounting().
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_EXPORT sail_status_t sail_begin_memory_scope(size_t limit_bytes);
+
+/*
+ * Assigns the memory usage statistics of the innermost memory scope on the calling thread
+ * to the 'stats' argument. peak_bytes is the maximum number of bytes the scope held at the same time.
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_EXPORT sail_status_t sail_memory_scope_stats(struct sail_memory_stats* stats);
+
+/*
+ * Ends the innermost memory scope on the calling thread. Assigns its memory usage statistics
+ * to the 'stats' argument if it's not NULL.
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_EXPORT sail_status_t sail_end_memory_scope(struct sail_memory_stats* stats);
+
+/*
+ * Returns the total number of bytes requested by allocations and reallocations made
+ * on the calling thread. The counter works even if the accounting mode is disabled.
+ * Subtract two values to get the number of bytes allocated between them.
+ *
+ * Reallocations count the growth of the block. The previous block size is known only
+ * in the accounting mode, so without it reallocations count their full new size.
+ */
+SAIL_EXPORT uint64_t sail_thread_allocated_bytes(void);
+
 /* extern "C" */
 #ifdef __cplusplus
 }
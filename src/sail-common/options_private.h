@@ -0,0 +1,77 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <sail-common/export.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+struct sail_frame_index;
+struct sail_load_options;
+struct sail_row_band;
+struct sail_save_options;
+
+/*
+ * Per-operation state SAIL attaches to the load and save options it passes to codecs. Not installed.
+ *
+ * The state lives in the memory allocated by sail_alloc_load_options() and sail_alloc_save_options()
+ * right after the public structs, so callers and bindings never see it. The options must be allocated
+ * by these functions. sail_copy_load_options() and sail_copy_save_options() don't copy the state.
+ */
+
+/*
+ * Returns the row band of the frame being loaded with sail_load_next_frame_rows(), or NULL
+ * when loading whole frames.
+ */
+SAIL_EXPORT struct sail_row_band* sail_load_options_row_band(const struct sail_load_options* load_options);
+
+SAIL_EXPORT void sail_set_load_options_row_band(struct sail_load_options* load_options,
+                                                struct sail_row_band* row_band);
+
+/*
+ * Returns the index of the frames visited so far, or NULL when frames are not indexed.
+ */
+SAIL_EXPORT struct sail_frame_index* sail_load_options_frame_index(const struct sail_load_options* load_options);
+
+SAIL_EXPORT void sail_set_load_options_frame_index(struct sail_load_options* load_options,
+                                                   struct sail_frame_index* frame_index);
+
+/*
+ * Returns the row band of the frame being saved with sail_write_next_frame_rows(), or NULL
+ * when saving whole frames.
+ */
+SAIL_EXPORT struct sail_row_band* sail_save_options_row_band(const struct sail_save_options* save_options);
+
+SAIL_EXPORT void sail_set_save_options_row_band(struct sail_save_options* save_options,
+                                                struct sail_row_band* row_band);
+
+/* extern "C" */
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,401 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdint.h>
+#include <string.h>
+
+#include "sail-common.h"
+
+#include "options_private.h"
+
+/*
+ * Private functions.
+ */
+
+static sail_status_t alloc_row_band(unsigned rows,
+                                    unsigned bytes_per_line,
+                                    unsigned pixels_alignment,
+                                    void* user_data,
+                                    struct sail_row_band** row_band)
+{
+    if (rows == 0)
+    {
+        SAIL_LOG_ERROR("Row band must have at least one scan line");
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_INVALID_ARGUMENT);
+    }
+
+    size_t pixels_size;
+    SAIL_TRY(sail_pixels_buffer_size(rows, bytes_per_line, &pixels_size));
+
+    void* ptr;
+    SAIL_TRY(sail_malloc(sizeof(struct sail_row_band), &ptr));
+    struct sail_row_band* row_band_local = ptr;
+
+    if (pixels_alignment != 0)
+    {
+        SAIL_TRY_OR_CLEANUP(sail_malloc_aligned(pixels_alignment, pixels_size, &row_band_local->pixels),
+                            /* cleanup */ sail_free(row_band_local));
+    }
+    else
+    {
+        SAIL_TRY_OR_CLEANUP(sail_malloc(pixels_size, &row_band_local->pixels),
+                            /* cleanup */ sail_free(row_band_local));
+    }
+
+    row_band_local->callback         = NULL;
+    row_band_local->save_callback    = NULL;
+    row_band_local->user_data        = user_data;
+    row_band_local->bytes_per_line   = bytes_per_line;
+    row_band_local->rows             = rows;
+    row_band_local->pixels_alignment = pixels_alignment;
+    row_band_local->first_row        = 0;
+    row_band_local->rows_count       = 0;
+    row_band_local->rows_flushed     = 0;
+    row_band_local->bypass           = false;
+
+    *row_band = row_band_local;
+
+    return SAIL_OK;
+}
+
+/*
+ * Returns true if the band must move upwards to reach the specified row. Frames stored
+ * upside down start from the last row and continue upwards.
+ */
+static bool row_band_moves_upwards(const struct sail_row_band* row_band, const struct sail_image* image, unsigned row)
+{
+    return (row_band->rows_count > 0) ? (row < row_band->first_row) : (row > 0 && row + 1 == image->height);
+}
+
+static void move_row_band(struct sail_row_band* row_band, const struct sail_image* image, unsigned row, bool upwards)
+{
+    if (upwards)
+    {
+        row_band->rows_count = (row + 1 < row_band->rows) ? row + 1 : row_band->rows;
+        row_band->first_row  = row + 1 - row_band->rows_count;
+    }
+    else
+    {
+        const unsigned rows_left = image->height - row;
+
+        row_band->first_row  = row;
+        row_band->rows_count = (rows_left < row_band->rows) ? rows_left : row_band->rows;
+    }
+}
+
+static bool row_band_holds_row(const struct sail_row_band* row_band, unsigned row)
+{
+    return row_band->rows_count > 0 && row >= row_band->first_row && row < row_band->first_row + row_band->rows_count;
+}
+
+/* Shallow view of the frame rows the band holds. It doesn't own anything, so it's never destroyed. */
+static struct sail_image row_band_view(const struct sail_row_band* row_band, const struct sail_image* image)
+{
+    struct sail_image band = *image;
+
+    band.pixels           = row_band->pixels;
+    band.height           = row_band->rows_count;
+    band.bytes_per_line   = row_band->bytes_per_line;
+    band.pixels_alignment = row_band->pixels_alignment;
+
+    return band;
+}
+
+/*
+ * Public functions.
+ */
+
+sail_status_t sail_alloc_row_band(unsigned rows,
+                                  unsigned bytes_per_line,
+                                  unsigned pixels_alignment,
+                                  sail_load_rows_func_t callback,
+                                  void* user_data,
+                                  struct sail_row_band** row_band)
+{
+    SAIL_CHECK_PTR(callback);
+    SAIL_CHECK_PTR(row_band);
+
+    SAIL_TRY(alloc_row_band(rows, bytes_per_line, pixels_alignment, user_data, row_band));
+
+    (*row_band)->callback = callback;
+
+    return SAIL_OK;
+}
+
+sail_status_t sail_alloc_save_row_band(unsigned rows,
+                                       unsigned bytes_per_line,
+                                       unsigned pixels_alignment,
+                                       sail_save_rows_func_t save_callback,
+                                       void* user_data,
+                                       struct sail_row_band** row_band)
+{
+    SAIL_CHECK_PTR(save_callback);
+    SAIL_CHECK_PTR(row_band);
+
+    SAIL_TRY(alloc_row_band(rows, bytes_per_line, pixels_alignment, user_data, row_band));
+
+    (*row_band)->save_callback = save_callback;
+
+    return SAIL_OK;
+}
+
+void sail_destroy_row_band(struct sail_row_band* row_band)
+{
+    if (row_band == NULL)
+    {
+        return;
+    }
+
+    if (row_band->pixels_alignment != 0)
+    {
+        sail_free_aligned(row_band->pixels);
+    }
+    else
+    {
+        sail_free(row_band->pixels);
+    }
+
+    sail_free(row_band);
+}
+
+sail_status_t sail_flush_row_band(struct sail_row_band* row_band, const struct sail_image* image)
+{
+    SAIL_CHECK_PTR(row_band);
+    SAIL_CHECK_PTR(image);
+    SAIL_CHECK_PTR(row_band->callback);
+
+    if (row_band->rows_count == 0)
+    {
+        return SAIL_OK;
+    }
+
+    struct sail_image band = row_band_view(row_band, image);
+
+    const unsigned first_row = row_band->first_row;
+
+    row_band->rows_count    = 0;
+    row_band->rows_flushed += band.height;
+
+    SAIL_TRY(row_band->callback(row_band->user_data, &band, first_row, image->height));
+
+    return SAIL_OK;
+}
+
+bool sail_loading_row_bands(const struct sail_load_options* load_options)
+{
+    if (load_options == NULL)
+    {
+        return false;
+    }
+
+    const struct sail_row_band* row_band = sail_load_options_row_band(load_options);
+
+    return row_band != NULL && !row_band->bypass;
+}
+
+unsigned sail_loading_row_band_rows(const struct sail_load_options* load_options)
+{
+    return sail_loading_row_bands(load_options) ? sail_load_options_row_band(load_options)->rows : 0;
+}
+
+sail_status_t sail_load_scan_line(const struct sail_load_options* load_options,
+                                  struct sail_image* image,
+                                  unsigned row,
+                                  void** scan_line)
+{
+    SAIL_CHECK_PTR(image);
+    SAIL_CHECK_PTR(scan_line);
+
+    if (!sail_loading_row_bands(load_options))
+    {
+        *scan_line = sail_scan_line(image, row);
+        return SAIL_OK;
+    }
+
+    struct sail_row_band* row_band = sail_load_options_row_band(load_options);
+
+    if (row >= image->height)
+    {
+        SAIL_LOG_ERROR("Scan line %u is out of the frame height %u", row, image->height);
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_INVALID_ARGUMENT);
+    }
+
+    if (!row_band_holds_row(row_band, row))
+    {
+        const bool upwards = row_band_moves_upwards(row_band, image, row);
+
+        SAIL_TRY(sail_flush_row_band(row_band, image));
+
+        move_row_band(row_band, image, row, upwards);
+    }
+
+    *scan_line = (uint8_t*)row_band->pixels + (size_t)(row - row_band->first_row) * row_band->bytes_per_line;
+
+    return SAIL_OK;
+}
+
+sail_status_t sail_load_frame_through_row_band(const struct sail_load_options* load_options,
+                                               struct sail_image* image,
+                                               sail_status_t (*load_frame)(void* state, struct sail_image* image),
+                                               void* state)
+{
+    SAIL_CHECK_PTR(image);
+    SAIL_CHECK_PTR(load_frame);
+
+    if (!sail_loading_row_bands(load_options))
+    {
+        SAIL_TRY(load_frame(state, image));
+        return SAIL_OK;
+    }
+
+    struct sail_row_band* row_band = sail_load_options_row_band(load_options);
+
+    size_t pixels_size;
+    SAIL_TRY(sail_pixels_buffer_size(image->height, image->bytes_per_line, &pixels_size));
+
+    void* pixels;
+    SAIL_TRY(sail_malloc(pixels_size, &pixels));
+
+    void* band_pixels = image->pixels;
+    image->pixels     = pixels;
+    row_band->bypass  = true;
+
+    SAIL_TRY_OR_CLEANUP(load_frame(state, image),
+                        /* cleanup */ row_band->bypass = false, image->pixels = band_pixels, sail_free(pixels));
+
+    row_band->bypass = false;
+
+    for (unsigned row = 0; row < image->height; row++)
+    {
+        void* scan_line;
+        SAIL_TRY_OR_CLEANUP(sail_load_scan_line(load_options, image, row, &scan_line),
+                            /* cleanup */ image->pixels = band_pixels, sail_free(pixels));
+
+        memcpy(scan_line, (const uint8_t*)pixels + (size_t)row * image->bytes_per_line, image->bytes_per_line);
+    }
+
+    image->pixels = band_pixels;
+    sail_free(pixels);
+
+    return SAIL_OK;
+}
+
+bool sail_saving_row_bands(const struct sail_save_options* save_options)
+{
+    if (save_options == NULL)
+    {
+        return false;
+    }
+
+    const struct sail_row_band* row_band = sail_save_options_row_band(save_options);
+
+    return row_band != NULL && !row_band->bypass;
+}
+
+sail_status_t sail_save_scan_line(const struct sail_save_options* save_options,
+                                  const struct sail_image* image,
+                                  unsigned row,
+                                  const void** scan_line)
+{
+    SAIL_CHECK_PTR(image);
+    SAIL_CHECK_PTR(scan_line);
+
+    if (!sail_saving_row_bands(save_options))
+    {
+        *scan_line = sail_scan_line(image, row);
+        return SAIL_OK;
+    }
+
+    struct sail_row_band* row_band = sail_save_options_row_band(save_options);
+
+    SAIL_CHECK_PTR(row_band->save_callback);
+
+    if (row >= image->height)
+    {
+        SAIL_LOG_ERROR("Scan line %u is out of the frame height %u", row, image->height);
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_INVALID_ARGUMENT);
+    }
+
+    if (!row_band_holds_row(row_band, row))
+    {
+        move_row_band(row_band, image, row, row_band_moves_upwards(row_band, image, row));
+
+        struct sail_image band = row_band_view(row_band, image);
+
+        SAIL_TRY_OR_CLEANUP(row_band->save_callback(row_band->user_data, &band, row_band->first_row, image->height),
+                            /* cleanup */ row_band->rows_count = 0);
+
+        row_band->rows_flushed += row_band->rows_count;
+    }
+
+    *scan_line = (const uint8_t*)row_band->pixels + (size_t)(row - row_band->first_row) * row_band->bytes_per_line;
+
+    return SAIL_OK;
+}
+
+sail_status_t sail_save_frame_through_row_band(const struct sail_save_options* save_options,
+                                               const struct sail_image* image,
+                                               sail_status_t (*save_frame)(void* state, const struct sail_image* image),
+                                               void* state)
+{
+    SAIL_CHECK_PTR(image);
+    SAIL_CHECK_PTR(save_frame);
+
+    if (!sail_saving_row_bands(save_options))
+    {
+        SAIL_TRY(save_frame(state, image));
+        return SAIL_OK;
+    }
+
+    struct sail_row_band* row_band = sail_save_options_row_band(save_options);
+
+    size_t pixels_size;
+    SAIL_TRY(sail_pixels_buffer_size(image->height, image->bytes_per_line, &pixels_size));
+
+    void* pixels;
+    SAIL_TRY(sail_malloc(pixels_size, &pixels));
+
+    for (unsigned row = 0; row < image->height; row++)
+    {
+        const void* scan_line;
+        SAIL_TRY_OR_CLEANUP(sail_save_scan_line(save_options, image, row, &scan_line),
+                            /* cleanup */ sail_free(pixels));
+
+        memcpy((uint8_t*)pixels + (size_t)row * image->bytes_per_line, scan_line, image->bytes_per_line);
+    }
+
+    /* Shallow view of the frame with the whole frame pixels. */
+    struct sail_image frame = *image;
+    frame.pixels            = pixels;
+    row_band->bypass        = true;
+
+    SAIL_TRY_OR_CLEANUP(save_frame(state, &frame),
+                        /* cleanup */ row_band->bypass = false, sail_free(pixels));
+
+    row_band->bypass = false;
+    sail_free(pixels);
+
+    return SAIL_OK;
+}
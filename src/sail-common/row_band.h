@@ -0,0 +1,232 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <stdbool.h>
+
+#include <sail-common/export.h>
+#include <sail-common/status.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+struct sail_image;
+struct sail_load_options;
+struct sail_save_options;
+
+/*
+ * Receives a band of decoded scan lines of a frame loaded with sail_load_next_frame_rows().
+ *
+ * band is a temporary image with the frame properties like the width, the pixel format,
+ * and the palette. It holds band->height scan lines starting at the first_row row of the frame.
+ * frame_height is the height of the whole frame. The band and its pixels are valid only
+ * until the callback returns.
+ *
+ * Returns SAIL_OK to continue loading. Any other status stops loading and is returned
+ * from sail_load_next_frame_rows().
+ */
+typedef sail_status_t (*sail_load_rows_func_t)(void* user_data,
+                                                const struct sail_image* band,
+                                                unsigned first_row,
+                                                unsigned frame_height);
+
+/*
+ * Fills a band of scan lines of a frame saved with sail_write_next_frame_rows().
+ *
+ * band is a temporary image with the frame properties like the width, the pixel format,
+ * and the palette. The callback must write band->height scan lines starting at the first_row
+ * row of the frame into band->pixels. frame_height is the height of the whole frame. The band
+ * and its pixels are valid only until the callback returns.
+ *
+ * Returns SAIL_OK to continue saving. Any other status stops saving and is returned
+ * from sail_write_next_frame_rows().
+ */
+typedef sail_status_t (*sail_save_rows_func_t)(void* user_data,
+                                                struct sail_image* band,
+                                                unsigned first_row,
+                                                unsigned frame_height);
+
+/*
+ * Row band buffer used to load or save frames in bands of scan lines.
+ */
+struct sail_row_band
+{
+    /* Callback to pass complete bands to when loading. NULL when saving. */
+    sail_load_rows_func_t callback;
+
+    /* Callback to fill bands from when saving. NULL when loading. */
+    sail_save_rows_func_t save_callback;
+
+    void* user_data;
+
+    /* Buffer of 'rows' scan lines of 'bytes_per_line' bytes each. */
+    void* pixels;
+    unsigned bytes_per_line;
+    unsigned rows;
+    unsigned pixels_alignment;
+
+    /* Frame rows [first_row, first_row + rows_count) the buffer currently holds. */
+    unsigned first_row;
+    unsigned rows_count;
+
+    /* The number of scan lines passed to or filled by the callback so far. */
+    unsigned rows_flushed;
+
+    /*
+     * True when the codec processes the whole frame with sail_load_frame_through_row_band()
+     * or sail_save_frame_through_row_band().
+     */
+    bool bypass;
+};
+
+typedef struct sail_row_band sail_row_band_t;
+
+/*
+ * Allocates a new row band of the specified number of scan lines. pixels_alignment
+ * is the alignment of the buffer. 0 means no alignment.
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_EXPORT sail_status_t sail_alloc_row_band(unsigned rows,
+                                              unsigned bytes_per_line,
+                                              unsigned pixels_alignment,
+                                              sail_load_rows_func_t callback,
+                                              void* user_data,
+                                              struct sail_row_band** row_band);
+
+/*
+ * Allocates a new row band of the specified number of scan lines to save frames. The band
+ * is filled with save_callback. pixels_alignment is the alignment of the buffer. 0 means no alignment.
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_EXPORT sail_status_t sail_alloc_save_row_band(unsigned rows,
+                                                   unsigned bytes_per_line,
+                                                   unsigned pixels_alignment,
+                                                   sail_save_rows_func_t save_callback,
+                                                   void* user_data,
+                                                   struct sail_row_band** row_band);
+
+/*
+ * Destroys the specified row band and its buffer. Does nothing if the row band is NULL.
+ */
+SAIL_EXPORT void sail_destroy_row_band(struct sail_row_band* row_band);
+
+/*
+ * Passes the scan lines held in the row band to the callback and empties the band.
+ * image is the frame being loaded. Does nothing if the band is empty.
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_EXPORT sail_status_t sail_flush_row_band(struct sail_row_band* row_band, const struct sail_image* image);
+
+/*
+ * Returns true if the frame is being loaded in row bands with sail_load_next_frame_rows().
+ * Codecs use it to pick a row by row decoding path.
+ */
+SAIL_EXPORT bool sail_loading_row_bands(const struct sail_load_options* load_options);
+
+/*
+ * Returns the number of scan lines in the row band of the frame being loaded with
+ * sail_load_next_frame_rows(), or 0 when loading whole frames. Codecs use it to keep
+ * their decoding buffers within the band.
+ */
+SAIL_EXPORT unsigned sail_loading_row_band_rows(const struct sail_load_options* load_options);
+
+/*
+ * Returns the buffer to decode the specified scan line of the frame into. Codecs with
+ * SAIL_CODEC_FEATURE_ROW_BANDS must use it instead of sail_scan_line() when loading frames.
+ *
+ * When loading whole frames, returns the scan line of the image. When loading row bands, returns
+ * the scan line in the band buffer. If the row doesn't fit into the band, the band is passed
+ * to the callback first. Rows must be requested top to bottom, or bottom to top for formats
+ * that store frames upside down. A previously returned scan line must not be accessed after
+ * requesting the next one outside of its band.
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_EXPORT sail_status_t sail_load_scan_line(const struct sail_load_options* load_options,
+                                              struct sail_image* image,
+                                              unsigned row,
+                                              void** scan_line);
+
+/*
+ * Loads the frame with the specified codec function into a temporary buffer for the whole frame,
+ * and passes its scan lines to the row band. Codecs with SAIL_CODEC_FEATURE_ROW_BANDS use it
+ * for frames they cannot decode row by row, like interlaced frames. load_frame accesses the image
+ * pixels with sail_scan_line() or sail_load_scan_line() as if the whole frame was loaded.
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_EXPORT sail_status_t sail_load_frame_through_row_band(const struct sail_load_options* load_options,
+                                                           struct sail_image* image,
+                                                           sail_status_t (*load_frame)(void* state,
+                                                                                       struct sail_image* image),
+                                                           void* state);
+
+/*
+ * Returns true if the frame is being saved in row bands with sail_write_next_frame_rows().
+ * Codecs use it to pick a row by row encoding path.
+ */
+SAIL_EXPORT bool sail_saving_row_bands(const struct sail_save_options* save_options);
+
+/*
+ * Returns the specified scan line of the frame to encode. Codecs with SAIL_CODEC_FEATURE_ROW_BANDS
+ * in their save features must use it instead of sail_scan_line() when saving frames.
+ *
+ * When saving whole frames, returns the scan line of the image. When saving row bands, returns
+ * the scan line in the band buffer. If the row doesn't fit into the band, the band is filled
+ * by the callback first. Rows must be requested top to bottom, or bottom to top for formats
+ * that store frames upside down. A previously returned scan line must not be accessed after
+ * requesting the next one outside of its band.
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_EXPORT sail_status_t sail_save_scan_line(const struct sail_save_options* save_options,
+                                              const struct sail_image* image,
+                                              unsigned row,
+                                              const void** scan_line);
+
+/*
+ * Fills a temporary buffer for the whole frame from the row band, and saves the frame with
+ * the specified codec function. Codecs with SAIL_CODEC_FEATURE_ROW_BANDS in their save features
+ * use it for frames they cannot encode row by row, like interlaced frames. save_frame accesses
+ * the image pixels with sail_scan_line() or sail_save_scan_line() as if the whole frame was passed.
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_EXPORT sail_status_t sail_save_frame_through_row_band(const struct sail_save_options* save_options,
+                                                           const struct sail_image* image,
+                                                           sail_status_t (*save_frame)(void* state,
+                                                                                       const struct sail_image* image),
+                                                           void* state);
+
+/* extern "C" */
+#ifdef __cplusplus
+}
+#endif
@@ -29,11 +29,15 @@
 
 #include <sail-common/config.h>
 
+#include <sail-common/buffered_reader.h>
 #include <sail-common/common.h>
 #include <sail-common/common_serialize.h>
 #include <sail-common/compiler_specifics.h>
 #include <sail-common/compression_level.h>
+#include <sail-common/cpu_features.h>
+#include <sail-common/embedded_image.h>
 #include <sail-common/export.h>
+#include <sail-common/frame_index.h>
 #include <sail-common/hash_map.h>
 #include <sail-common/iccp.h>
 #include <sail-common/image.h>
@@ -47,11 +51,14 @@
 #include <sail-common/palette.h>
 #include <sail-common/pixel.h>
 #include <sail-common/resolution.h>
+#include <sail-common/row_band.h>
 #include <sail-common/save_features.h>
 #include <sail-common/save_options.h>
 #include <sail-common/source_image.h>
 #include <sail-common/status.h>
 #include <sail-common/string_node.h>
+#include <sail-common/thread_pool.h>
+#include <sail-common/trace.h>
 #include <sail-common/utils.h>
 #include <sail-common/variant.h>
 #include <sail-common/variant_node.h>
@@ -28,13 +28,27 @@
 
 #include "sail-common.h"
 
+#include "options_private.h"
+
+/* Save options followed by the per-operation state SAIL attaches to them. */
+struct save_options_with_state
+{
+    struct sail_save_options save_options;
+
+    struct sail_row_band* row_band;
+};
+
 sail_status_t sail_alloc_save_options(struct sail_save_options** save_options)
 {
     SAIL_CHECK_PTR(save_options);
 
     void* ptr;
-    SAIL_TRY(sail_malloc(sizeof(struct sail_save_options), &ptr));
-    *save_options = ptr;
+    SAIL_TRY(sail_malloc(sizeof(struct save_options_with_state), &ptr));
+    struct save_options_with_state* save_options_with_state = ptr;
+
+    save_options_with_state->row_band = NULL;
+
+    *save_options = &save_options_with_state->save_options;
 
     (*save_options)->options           = 0;
     (*save_options)->compression       = SAIL_COMPRESSION_UNKNOWN;
@@ -104,3 +118,13 @@ sail_status_t sail_copy_save_options(const struct sail_save_options* source, str
 
     return SAIL_OK;
 }
+
+struct sail_row_band* sail_save_options_row_band(const struct sail_save_options* save_options)
+{
+    return ((const struct save_options_with_state*)save_options)->row_band;
+}
+
+void sail_set_save_options_row_band(struct sail_save_options* save_options, struct sail_row_band* row_band)
+{
+    ((struct save_options_with_state*)save_options)->row_band = row_band;
+}
@@ -86,6 +86,16 @@ struct sail_source_image
      */
     bool interlaced;
 
+    /*
+     * Source image dimensions. Differ from the loaded image dimensions when the image
+     * is reduced or cropped while loading. See sail_load_options.max_width.
+     *
+     * LOAD: Set by SAIL to the dimensions of the original frame.
+     * SAVE: Ignored.
+     */
+    unsigned width;
+    unsigned height;
+
     /*
      * Image format-specific properties that cannot be expressed
      * in a common way. For example, a cursor hot spot.
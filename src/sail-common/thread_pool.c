@@ -0,0 +1,600 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <sail-common/sail-common.h>
+
+#ifdef SAIL_WIN32
+#include <Windows.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+/*
+ * A global pool of worker threads shared by all parallel loops. Every loop splits its rows
+ * into slots, one slot per participating thread. A thread processes its own slot in small chunks
+ * and, when the slot is empty, steals the upper half of the rows left in another slot.
+ *
+ * The calling thread always participates in its own loop, so a loop completes even when
+ * no worker is free or no worker could be started.
+ */
+
+#ifdef SAIL_WIN32
+typedef HANDLE pool_thread_t;
+typedef SRWLOCK pool_mutex_t;
+typedef CONDITION_VARIABLE pool_cond_t;
+#define POOL_MUTEX_INITIALIZER SRWLOCK_INIT
+#define POOL_COND_INITIALIZER CONDITION_VARIABLE_INIT
+#else
+typedef pthread_t pool_thread_t;
+typedef pthread_mutex_t pool_mutex_t;
+typedef pthread_cond_t pool_cond_t;
+#define POOL_MUTEX_INITIALIZER PTHREAD_MUTEX_INITIALIZER
+#define POOL_COND_INITIALIZER PTHREAD_COND_INITIALIZER
+#endif
+
+/* The number of chunks every slot is split into. More chunks balance the load better. */
+static const unsigned CHUNKS_PER_SLOT = 8;
+
+/* Parallel loops with up to this number of threads keep their slots on the stack and don't allocate memory. */
+#define PARALLEL_STACK_SLOTS 32
+
+struct parallel_slot
+{
+    pool_mutex_t mutex;
+
+    /* Rows left to process. */
+    unsigned row_begin;
+    unsigned row_end;
+};
+
+struct parallel_job
+{
+    sail_parallel_rows_func_t func;
+    void* context;
+
+    /* The number of rows a thread takes from a slot at once. */
+    unsigned chunk;
+
+    struct parallel_slot* slots;
+    unsigned slots_count;
+
+    /* Guarded by the pool mutex. */
+    unsigned slots_taken;
+    unsigned workers_running;
+    sail_status_t status;
+    struct parallel_job* next;
+};
+
+static struct
+{
+    pool_mutex_t mutex;
+
+    /* Signaled when a new job is queued or the thread limit changes. */
+    pool_cond_t work_cond;
+
+    /* Signaled when the last worker leaves a job. */
+    pool_cond_t done_cond;
+
+    /* Jobs with slots not taken by any thread yet. */
+    struct parallel_job* jobs;
+
+    /* Started workers. Joined by sail_shutdown_thread_pool(). */
+    pool_thread_t* workers;
+    unsigned workers_count;
+    unsigned workers_capacity;
+
+    /* Set while sail_shutdown_thread_pool() stops the workers. */
+    bool quit;
+
+    /* 0 means the number of CPU cores. */
+    unsigned max_threads;
+} pool = {POOL_MUTEX_INITIALIZER, POOL_COND_INITIALIZER, POOL_COND_INITIALIZER, NULL, NULL, 0, 0, false, 0};
+
+/* Set in the pool workers and in the threads that run a parallel loop. */
+static SAIL_THREAD_LOCAL bool in_parallel_loop = false;
+
+/*
+ * Private functions.
+ */
+
+#ifdef SAIL_WIN32
+static void pool_init_mutex(pool_mutex_t* mutex)
+{
+    InitializeSRWLock(mutex);
+}
+
+static void pool_destroy_mutex(pool_mutex_t* mutex)
+{
+    (void)mutex;
+}
+
+static void pool_lock(pool_mutex_t* mutex)
+{
+    AcquireSRWLockExclusive(mutex);
+}
+
+static void pool_unlock(pool_mutex_t* mutex)
+{
+    ReleaseSRWLockExclusive(mutex);
+}
+
+static void pool_wait(pool_cond_t* cond, pool_mutex_t* mutex)
+{
+    SleepConditionVariableSRW(cond, mutex, INFINITE, 0);
+}
+
+static void pool_broadcast(pool_cond_t* cond)
+{
+    WakeAllConditionVariable(cond);
+}
+
+static void pool_join(pool_thread_t thread)
+{
+    WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+}
+
+static unsigned cpu_cores(void)
+{
+    SYSTEM_INFO system_info;
+    GetSystemInfo(&system_info);
+
+    return system_info.dwNumberOfProcessors > 0 ? (unsigned)system_info.dwNumberOfProcessors : 1;
+}
+#else
+static void pool_init_mutex(pool_mutex_t* mutex)
+{
+    pthread_mutex_init(mutex, NULL);
+}
+
+static void pool_destroy_mutex(pool_mutex_t* mutex)
+{
+    pthread_mutex_destroy(mutex);
+}
+
+static void pool_lock(pool_mutex_t* mutex)
+{
+    pthread_mutex_lock(mutex);
+}
+
+static void pool_unlock(pool_mutex_t* mutex)
+{
+    pthread_mutex_unlock(mutex);
+}
+
+static void pool_wait(pool_cond_t* cond, pool_mutex_t* mutex)
+{
+    pthread_cond_wait(cond, mutex);
+}
+
+static void pool_broadcast(pool_cond_t* cond)
+{
+    pthread_cond_broadcast(cond);
+}
+
+static void pool_join(pool_thread_t thread)
+{
+    pthread_join(thread, NULL);
+}
+
+static unsigned cpu_cores(void)
+{
+    const long cores = sysconf(_SC_NPROCESSORS_ONLN);
+
+    return cores > 0 ? (unsigned)cores : 1;
+}
+#endif
+
+/* Must be called with the pool mutex locked. */
+static unsigned max_threads_locked(void)
+{
+    if (pool.max_threads == 0)
+    {
+        pool.max_threads = cpu_cores();
+    }
+
+    return pool.max_threads;
+}
+
+static bool take_chunk(const struct parallel_job* job,
+                       struct parallel_slot* slot,
+                       unsigned* row_begin,
+                       unsigned* row_end)
+{
+    bool taken = false;
+
+    pool_lock(&slot->mutex);
+
+    if (slot->row_begin < slot->row_end)
+    {
+        const unsigned rows = slot->row_end - slot->row_begin;
+
+        *row_begin      = slot->row_begin;
+        *row_end        = *row_begin + (rows < job->chunk ? rows : job->chunk);
+        slot->row_begin = *row_end;
+        taken           = true;
+    }
+
+    pool_unlock(&slot->mutex);
+
+    return taken;
+}
+
+/* Moves the upper half of the rows left in another slot into the specified slot. */
+static bool steal_rows(struct parallel_job* job, unsigned slot_index)
+{
+    for (unsigned i = 1; i < job->slots_count; i++)
+    {
+        struct parallel_slot* victim = &job->slots[(slot_index + i) % job->slots_count];
+
+        pool_lock(&victim->mutex);
+
+        if (victim->row_begin < victim->row_end)
+        {
+            const unsigned rows      = victim->row_end - victim->row_begin;
+            const unsigned row_begin = rows > job->chunk ? victim->row_begin + rows / 2 : victim->row_begin;
+            const unsigned row_end   = victim->row_end;
+
+            victim->row_end = row_begin;
+            pool_unlock(&victim->mutex);
+
+            struct parallel_slot* slot = &job->slots[slot_index];
+
+            pool_lock(&slot->mutex);
+            slot->row_begin = row_begin;
+            slot->row_end   = row_end;
+            pool_unlock(&slot->mutex);
+
+            return true;
+        }
+
+        pool_unlock(&victim->mutex);
+    }
+
+    return false;
+}
+
+/* Empties all the slots, so the other threads stop taking rows. */
+static void cancel_job(struct parallel_job* job)
+{
+    for (unsigned i = 0; i < job->slots_count; i++)
+    {
+        struct parallel_slot* slot = &job->slots[i];
+
+        pool_lock(&slot->mutex);
+        slot->row_begin = slot->row_end;
+        pool_unlock(&slot->mutex);
+    }
+}
+
+static sail_status_t process_slot(struct parallel_job* job, unsigned slot_index)
+{
+    struct parallel_slot* slot = &job->slots[slot_index];
+
+    do
+    {
+        unsigned row_begin;
+        unsigned row_end;
+
+        while (take_chunk(job, slot, &row_begin, &row_end))
+        {
+            SAIL_TRY_OR_EXECUTE(job->func(job->context, row_begin, row_end),
+                                /* on error */ cancel_job(job); return __sail_status);
+        }
+    } while (steal_rows(job, slot_index));
+
+    return SAIL_OK;
+}
+
+static sail_status_t run_slot(struct parallel_job* job, unsigned slot_index)
+{
+    sail_trace_begin("parallel_for", "parallel");
+    const sail_status_t status = process_slot(job, slot_index);
+    sail_trace_end("parallel_for", "parallel");
+
+    return status;
+}
+
+/* Must be called with the pool mutex locked. */
+static void dequeue_job(struct parallel_job* job)
+{
+    for (struct parallel_job** node = &pool.jobs; *node != NULL; node = &(*node)->next)
+    {
+        if (*node == job)
+        {
+            *node = job->next;
+            break;
+        }
+    }
+}
+
+#ifdef SAIL_WIN32
+static DWORD WINAPI worker_routine(LPVOID arg)
+#else
+static void* worker_routine(void* arg)
+#endif
+{
+    const unsigned worker_index = (unsigned)(uintptr_t)arg;
+
+    /* Parallel loops started from the rows processed by a worker run serially. */
+    in_parallel_loop = true;
+
+    pool_lock(&pool.mutex);
+
+    for (;;)
+    {
+        /* The calling thread of every loop counts against the limit, so the workers use one thread less. */
+        while (!pool.quit && (pool.jobs == NULL || worker_index + 1 >= max_threads_locked()))
+        {
+            pool_wait(&pool.work_cond, &pool.mutex);
+        }
+
+        if (pool.quit)
+        {
+            break;
+        }
+
+        struct parallel_job* job  = pool.jobs;
+        const unsigned slot_index = job->slots_taken++;
+
+        if (job->slots_taken == job->slots_count)
+        {
+            dequeue_job(job);
+        }
+
+        job->workers_running++;
+        pool_unlock(&pool.mutex);
+
+        const sail_status_t status = run_slot(job, slot_index);
+
+        pool_lock(&pool.mutex);
+
+        if (status != SAIL_OK && job->status == SAIL_OK)
+        {
+            job->status = status;
+        }
+
+        if (--job->workers_running == 0)
+        {
+            pool_broadcast(&pool.done_cond);
+        }
+    }
+
+    pool_unlock(&pool.mutex);
+
+#ifdef SAIL_WIN32
+    return 0;
+#else
+    return NULL;
+#endif
+}
+
+/* Must be called with the pool mutex locked. */
+static void start_workers_locked(unsigned workers_count)
+{
+    /* Workers started while shutting down would never be joined. */
+    if (pool.quit)
+    {
+        return;
+    }
+
+    while (pool.workers_count < workers_count)
+    {
+        if (pool.workers_count == pool.workers_capacity)
+        {
+            const unsigned new_capacity = pool.workers_capacity == 0 ? 8 : pool.workers_capacity * 2;
+
+            void* ptr = pool.workers;
+            SAIL_TRY_OR_EXECUTE(sail_realloc(sizeof(pool_thread_t) * new_capacity, &ptr),
+                                /* on error */ return);
+            pool.workers          = ptr;
+            pool.workers_capacity = new_capacity;
+        }
+
+        void* arg = (void*)(uintptr_t)pool.workers_count;
+
+#ifdef SAIL_WIN32
+        HANDLE thread = CreateThread(NULL, 0, worker_routine, arg, 0, NULL);
+
+        if (thread == NULL)
+        {
+            SAIL_LOG_WARNING("Failed to start a pool worker. Error: 0x%X", GetLastError());
+            return;
+        }
+#else
+        pthread_t thread;
+
+        if (pthread_create(&thread, NULL, worker_routine, arg) != 0)
+        {
+            SAIL_LOG_WARNING("Failed to start a pool worker");
+            return;
+        }
+#endif
+
+        pool.workers[pool.workers_count++] = thread;
+    }
+}
+
+/*
+ * Public functions.
+ */
+
+void sail_set_max_threads(unsigned max_threads)
+{
+    pool_lock(&pool.mutex);
+    pool.max_threads = max_threads == 0 ? cpu_cores() : max_threads;
+    pool_broadcast(&pool.work_cond);
+    pool_unlock(&pool.mutex);
+}
+
+unsigned sail_max_threads(void)
+{
+    pool_lock(&pool.mutex);
+    const unsigned max_threads = max_threads_locked();
+    pool_unlock(&pool.mutex);
+
+    return max_threads;
+}
+
+void sail_shutdown_thread_pool(void)
+{
+    /* A worker would join itself. */
+    if (in_parallel_loop)
+    {
+        SAIL_LOG_ERROR("The thread pool cannot be shut down from a parallel loop");
+        return;
+    }
+
+    pool_lock(&pool.mutex);
+
+    pool_thread_t* workers       = pool.workers;
+    const unsigned workers_count = pool.workers_count;
+
+    pool.workers          = NULL;
+    pool.workers_count    = 0;
+    pool.workers_capacity = 0;
+    pool.quit             = true;
+
+    pool_broadcast(&pool.work_cond);
+    pool_unlock(&pool.mutex);
+
+    /* Workers processing rows finish their slots first. */
+    for (unsigned i = 0; i < workers_count; i++)
+    {
+        pool_join(workers[i]);
+    }
+
+    sail_free(workers);
+
+    pool_lock(&pool.mutex);
+    pool.quit = false;
+    pool_unlock(&pool.mutex);
+}
+
+sail_status_t sail_parallel_for(unsigned rows, unsigned max_threads, sail_parallel_rows_func_t func, void* context)
+{
+    SAIL_CHECK_PTR(func);
+
+    unsigned threads = sail_max_threads();
+
+    if (max_threads > 0 && max_threads < threads)
+    {
+        threads = max_threads;
+    }
+    if (threads > rows)
+    {
+        threads = rows;
+    }
+
+    struct parallel_slot stack_slots[PARALLEL_STACK_SLOTS];
+    void* ptr = stack_slots;
+
+    if (threads <= 1 || in_parallel_loop
+        || (threads > PARALLEL_STACK_SLOTS && sail_malloc(sizeof(struct parallel_slot) * threads, &ptr) != SAIL_OK))
+    {
+        if (rows > 0)
+        {
+            SAIL_TRY(func(context, 0, rows));
+        }
+
+        return SAIL_OK;
+    }
+
+    struct parallel_job job = {
+        .func            = func,
+        .context         = context,
+        .chunk           = rows / (threads * CHUNKS_PER_SLOT) > 0 ? rows / (threads * CHUNKS_PER_SLOT) : 1,
+        .slots           = ptr,
+        .slots_count     = threads,
+        .slots_taken     = 1, /* The calling thread takes the first slot. */
+        .workers_running = 0,
+        .status          = SAIL_OK,
+        .next            = NULL,
+    };
+
+    for (unsigned i = 0; i < threads; i++)
+    {
+        pool_init_mutex(&job.slots[i].mutex);
+        job.slots[i].row_begin = (unsigned)((uint64_t)rows * i / threads);
+        job.slots[i].row_end   = (unsigned)((uint64_t)rows * (i + 1) / threads);
+    }
+
+    pool_lock(&pool.mutex);
+
+    start_workers_locked(threads - 1);
+
+    struct parallel_job** tail = &pool.jobs;
+    while (*tail != NULL)
+    {
+        tail = &(*tail)->next;
+    }
+    *tail = &job;
+
+    pool_broadcast(&pool.work_cond);
+    pool_unlock(&pool.mutex);
+
+    in_parallel_loop     = true;
+    sail_status_t status = run_slot(&job, 0);
+    in_parallel_loop     = false;
+
+    /* Stop the workers from joining the loop and wait for the ones still processing rows. */
+    pool_lock(&pool.mutex);
+
+    if (job.slots_taken < job.slots_count)
+    {
+        dequeue_job(&job);
+    }
+
+    while (job.workers_running > 0)
+    {
+        pool_wait(&pool.done_cond, &pool.mutex);
+    }
+
+    if (status == SAIL_OK)
+    {
+        status = job.status;
+    }
+
+    pool_unlock(&pool.mutex);
+
+    for (unsigned i = 0; i < threads; i++)
+    {
+        pool_destroy_mutex(&job.slots[i].mutex);
+    }
+
+    if (job.slots != stack_slots)
+    {
+        sail_free(job.slots);
+    }
+
+    SAIL_TRY(status);
+
+    return SAIL_OK;
+}
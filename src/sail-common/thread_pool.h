@@ -0,0 +1,92 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <sail-common/export.h>
+#include <sail-common/status.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*
+ * Processes the rows [row_begin, row_end) of a parallel loop started with sail_parallel_for().
+ * Rows of the same loop may be processed concurrently by different threads.
+ *
+ * Returns SAIL_OK on success.
+ */
+typedef sail_status_t (*sail_parallel_rows_func_t)(void* context, unsigned row_begin, unsigned row_end);
+
+/*
+ * Sets the maximum number of threads, including the calling thread, that a single parallel
+ * operation like an image conversion or scaling may use. The worker threads are shared between
+ * all the calling threads, so the total number of threads SAIL runs never exceeds the number
+ * of the calling threads plus max_threads - 1.
+ *
+ * 0 resets the limit to the number of CPU cores, which is the default. 1 disables parallel processing.
+ *
+ * Thread-safe.
+ */
+SAIL_EXPORT void sail_set_max_threads(unsigned max_threads);
+
+/*
+ * Returns the maximum number of threads that a single parallel operation may use.
+ *
+ * Thread-safe.
+ */
+SAIL_EXPORT unsigned sail_max_threads(void);
+
+/*
+ * Stops and joins the worker threads of the global pool. Parallel loops started afterwards
+ * start new workers on demand. sail_finish() calls it.
+ *
+ * Must not be called from a parallel loop. Loops running in other threads complete, but may lose
+ * their workers and finish in the calling threads.
+ */
+SAIL_EXPORT void sail_shutdown_thread_pool(void);
+
+/*
+ * Runs func over the rows [0, rows) split into chunks. The calling thread processes the chunks along with
+ * the worker threads of the global pool. Idle threads steal the remaining chunks from the busy ones.
+ *
+ * max_threads limits the number of threads that process the rows. 0 means sail_max_threads().
+ * Values greater than sail_max_threads() are truncated.
+ *
+ * The rows are processed serially in the calling thread when the call is nested into another
+ * parallel loop, so parallel operations never oversubscribe the CPU.
+ *
+ * Returns SAIL_OK on success or the first error returned by func.
+ */
+SAIL_EXPORT sail_status_t sail_parallel_for(unsigned rows,
+                                            unsigned max_threads,
+                                            sail_parallel_rows_func_t func,
+                                            void* context);
+
+/* extern "C" */
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,445 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include <sail-common/sail-common.h>
+
+#include "atomic_private.h"
+
+#ifdef SAIL_WIN32
+#include <Windows.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#endif
+
+#ifdef SAIL_WIN32
+typedef SRWLOCK trace_mutex_t;
+#define TRACE_MUTEX_INITIALIZER SRWLOCK_INIT
+#else
+typedef pthread_mutex_t trace_mutex_t;
+#define TRACE_MUTEX_INITIALIZER PTHREAD_MUTEX_INITIALIZER
+#endif
+
+/*
+ * Trace callbacks are immutable once published. NULL disables tracing.
+ *
+ * Threads calling the callbacks are counted in the reader count of the current epoch.
+ * sail_set_trace_callbacks() publishes new callbacks, switches the epoch, and waits for
+ * the readers of the previous epoch before it frees the replaced callbacks.
+ */
+struct trace_callbacks
+{
+    sail_trace_func_t begin;
+    sail_trace_func_t end;
+    void* user_data;
+};
+
+static struct trace_callbacks* published_trace_callbacks = NULL;
+
+static unsigned trace_epoch        = 0;
+static long trace_epoch_readers[2] = {0, 0};
+
+/* Serializes replacing the callbacks. */
+static trace_mutex_t trace_callbacks_mutex = TRACE_MUTEX_INITIALIZER;
+
+/* The built-in Chrome trace event sink. */
+static struct
+{
+    trace_mutex_t mutex;
+
+    FILE* file;
+    unsigned long pid;
+    bool first_event;
+} chrome_trace = {TRACE_MUTEX_INITIALIZER, NULL, 0, true};
+
+/* Small sequential thread IDs are easier to read on a timeline than system ones. */
+static unsigned next_thread_id = 0;
+static SAIL_THREAD_LOCAL unsigned thread_id = 0;
+
+/*
+ * Private functions.
+ */
+
+#ifdef SAIL_WIN32
+static void trace_lock(trace_mutex_t* mutex)
+{
+    AcquireSRWLockExclusive(mutex);
+}
+
+static void trace_unlock(trace_mutex_t* mutex)
+{
+    ReleaseSRWLockExclusive(mutex);
+}
+
+static unsigned long current_process_id(void)
+{
+    return (unsigned long)GetCurrentProcessId();
+}
+
+static unsigned new_thread_id(void)
+{
+    return (unsigned)InterlockedIncrement((volatile LONG*)&next_thread_id);
+}
+
+static unsigned load_trace_epoch(void)
+{
+    return (unsigned)InterlockedCompareExchange((volatile LONG*)&trace_epoch, 0, 0);
+}
+
+static void store_trace_epoch(unsigned epoch)
+{
+    InterlockedExchange((volatile LONG*)&trace_epoch, (LONG)epoch);
+}
+
+static long load_trace_readers(unsigned epoch)
+{
+    return InterlockedCompareExchange((volatile LONG*)&trace_epoch_readers[epoch], 0, 0);
+}
+
+static void add_trace_reader(unsigned epoch)
+{
+    InterlockedIncrement((volatile LONG*)&trace_epoch_readers[epoch]);
+}
+
+static void remove_trace_reader(unsigned epoch)
+{
+    InterlockedDecrement((volatile LONG*)&trace_epoch_readers[epoch]);
+}
+
+static void yield_thread(void)
+{
+    SwitchToThread();
+}
+#else
+static void trace_lock(trace_mutex_t* mutex)
+{
+    pthread_mutex_lock(mutex);
+}
+
+static void trace_unlock(trace_mutex_t* mutex)
+{
+    pthread_mutex_unlock(mutex);
+}
+
+static unsigned long current_process_id(void)
+{
+    return (unsigned long)getpid();
+}
+
+static unsigned new_thread_id(void)
+{
+    return __atomic_add_fetch(&next_thread_id, 1, __ATOMIC_RELAXED);
+}
+
+/* The epoch and the reader counts need a single total order with the published callbacks. */
+static unsigned load_trace_epoch(void)
+{
+    return __atomic_load_n(&trace_epoch, __ATOMIC_SEQ_CST);
+}
+
+static void store_trace_epoch(unsigned epoch)
+{
+    __atomic_store_n(&trace_epoch, epoch, __ATOMIC_SEQ_CST);
+}
+
+static long load_trace_readers(unsigned epoch)
+{
+    return __atomic_load_n(&trace_epoch_readers[epoch], __ATOMIC_SEQ_CST);
+}
+
+static void add_trace_reader(unsigned epoch)
+{
+    __atomic_add_fetch(&trace_epoch_readers[epoch], 1, __ATOMIC_SEQ_CST);
+}
+
+static void remove_trace_reader(unsigned epoch)
+{
+    __atomic_sub_fetch(&trace_epoch_readers[epoch], 1, __ATOMIC_SEQ_CST);
+}
+
+static void yield_thread(void)
+{
+    sched_yield();
+}
+#endif
+
+static const struct trace_callbacks* load_trace_callbacks(void)
+{
+    return sail_atomic_load_pointer((void* const*)&published_trace_callbacks);
+}
+
+/*
+ * Counts the calling thread as a reader of the current epoch. The epoch is checked again after
+ * counting, so a thread is never counted in an epoch the callbacks writer has already waited for.
+ * Returns the epoch to pass to leave_trace_callbacks().
+ */
+static unsigned enter_trace_callbacks(void)
+{
+    for (;;)
+    {
+        const unsigned epoch = load_trace_epoch();
+
+        add_trace_reader(epoch);
+
+        if (load_trace_epoch() == epoch)
+        {
+            return epoch;
+        }
+
+        remove_trace_reader(epoch);
+    }
+}
+
+static void leave_trace_callbacks(unsigned epoch)
+{
+    remove_trace_reader(epoch);
+}
+
+/* Must be called with the callbacks mutex locked. */
+static void wait_trace_readers_locked(void)
+{
+    const unsigned epoch = load_trace_epoch();
+
+    store_trace_epoch(epoch ^ 1);
+
+    while (load_trace_readers(epoch) != 0)
+    {
+        yield_thread();
+    }
+}
+
+static unsigned current_thread_id(void)
+{
+    if (thread_id == 0)
+    {
+        thread_id = new_thread_id();
+    }
+
+    return thread_id;
+}
+
+/* Writes the string escaped for JSON. */
+static void write_json_string(FILE* file, const char* str)
+{
+    for (; *str != '\0'; str++)
+    {
+        const unsigned char c = (unsigned char)*str;
+
+        if (c == '"' || c == '\\')
+        {
+            fputc('\\', file);
+            fputc(c, file);
+        }
+        else if (c < 0x20)
+        {
+            fprintf(file, "\\u%04x", c);
+        }
+        else
+        {
+            fputc(c, file);
+        }
+    }
+}
+
+static void write_chrome_event(const char* name, const char* category, char phase)
+{
+    const uint64_t timestamp = sail_now_us();
+    const unsigned tid       = current_thread_id();
+
+    trace_lock(&chrome_trace.mutex);
+
+    if (chrome_trace.file != NULL)
+    {
+        fputs(chrome_trace.first_event ? "\n{\"name\":\"" : ",\n{\"name\":\"", chrome_trace.file);
+        write_json_string(chrome_trace.file, name);
+        fputs("\",\"cat\":\"", chrome_trace.file);
+        write_json_string(chrome_trace.file, category);
+        fprintf(chrome_trace.file, "\",\"ph\":\"%c\",\"ts\":%llu,\"pid\":%lu,\"tid\":%u}", phase,
+                (unsigned long long)timestamp, chrome_trace.pid, tid);
+
+        chrome_trace.first_event = false;
+    }
+
+    trace_unlock(&chrome_trace.mutex);
+}
+
+static void chrome_trace_begin(void* user_data, const char* name, const char* category)
+{
+    (void)user_data;
+
+    write_chrome_event(name, category, 'B');
+}
+
+static void chrome_trace_end(void* user_data, const char* name, const char* category)
+{
+    (void)user_data;
+
+    write_chrome_event(name, category, 'E');
+}
+
+/*
+ * Public functions.
+ */
+
+sail_status_t sail_set_trace_callbacks(sail_trace_func_t begin, sail_trace_func_t end, void* user_data)
+{
+    if ((begin == NULL) != (end == NULL))
+    {
+        SAIL_LOG_ERROR("Both trace callbacks must be set or NULL");
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_INVALID_ARGUMENT);
+    }
+
+    struct trace_callbacks* new_callbacks = NULL;
+
+    if (begin != NULL)
+    {
+        void* ptr;
+        SAIL_TRY(sail_malloc(sizeof(struct trace_callbacks), &ptr));
+        new_callbacks = ptr;
+
+        new_callbacks->begin     = begin;
+        new_callbacks->end       = end;
+        new_callbacks->user_data = user_data;
+    }
+
+    trace_lock(&trace_callbacks_mutex);
+
+    struct trace_callbacks* old_callbacks = published_trace_callbacks;
+    sail_atomic_store_pointer((void**)&published_trace_callbacks, new_callbacks);
+
+    /* Threads that loaded the old callbacks have returned from them after this. */
+    if (old_callbacks != NULL)
+    {
+        wait_trace_readers_locked();
+    }
+
+    sail_free(old_callbacks);
+
+    trace_unlock(&trace_callbacks_mutex);
+
+    return SAIL_OK;
+}
+
+void sail_trace_begin(const char* name, const char* category)
+{
+    if (SAIL_LIKELY(load_trace_callbacks() == NULL))
+    {
+        return;
+    }
+
+    const unsigned epoch                    = enter_trace_callbacks();
+    const struct trace_callbacks* callbacks = load_trace_callbacks();
+
+    if (callbacks != NULL)
+    {
+        callbacks->begin(callbacks->user_data, name, category);
+    }
+
+    leave_trace_callbacks(epoch);
+}
+
+void sail_trace_end(const char* name, const char* category)
+{
+    if (SAIL_LIKELY(load_trace_callbacks() == NULL))
+    {
+        return;
+    }
+
+    const unsigned epoch                    = enter_trace_callbacks();
+    const struct trace_callbacks* callbacks = load_trace_callbacks();
+
+    if (callbacks != NULL)
+    {
+        callbacks->end(callbacks->user_data, name, category);
+    }
+
+    leave_trace_callbacks(epoch);
+}
+
+sail_status_t sail_start_chrome_trace(const char* path)
+{
+    SAIL_CHECK_PTR(path);
+
+    SAIL_TRY(sail_stop_chrome_trace());
+
+    FILE* file = fopen(path, "w");
+
+    if (file == NULL)
+    {
+        SAIL_LOG_ERROR("Failed to open '%s' for writing: %s", path, sail_strerror());
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_OPEN_FILE);
+    }
+
+    fputc('[', file);
+
+    trace_lock(&chrome_trace.mutex);
+    chrome_trace.file        = file;
+    chrome_trace.pid         = current_process_id();
+    chrome_trace.first_event = true;
+    trace_unlock(&chrome_trace.mutex);
+
+    SAIL_TRY(sail_set_trace_callbacks(chrome_trace_begin, chrome_trace_end, NULL));
+
+    return SAIL_OK;
+}
+
+sail_status_t sail_stop_chrome_trace(void)
+{
+    /* The callbacks are freed under the mutex when replaced. */
+    trace_lock(&trace_callbacks_mutex);
+    const bool chrome_trace_published =
+        published_trace_callbacks != NULL && published_trace_callbacks->begin == chrome_trace_begin;
+    trace_unlock(&trace_callbacks_mutex);
+
+    if (chrome_trace_published)
+    {
+        SAIL_TRY(sail_set_trace_callbacks(NULL, NULL, NULL));
+    }
+
+    trace_lock(&chrome_trace.mutex);
+    FILE* file        = chrome_trace.file;
+    chrome_trace.file = NULL;
+    trace_unlock(&chrome_trace.mutex);
+
+    if (file == NULL)
+    {
+        return SAIL_OK;
+    }
+
+    fputs("\n]\n", file);
+
+    if (fclose(file) != 0)
+    {
+        SAIL_LOG_ERROR("Failed to close the trace file: %s", sail_strerror());
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_WRITE_IO);
+    }
+
+    return SAIL_OK;
+}
@@ -0,0 +1,99 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <sail-common/export.h>
+#include <sail-common/status.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*
+ * Called when a traced region begins or ends on the calling thread. Regions nest like function
+ * calls, so every end callback closes the last region begun on the same thread. The name and the
+ * category are static strings like "load_frame" and "codec".
+ *
+ * SAIL traces the following categories:
+ *   - "codec": codec functions like load_init or save_frame
+ *   - "io": reading and writing through the I/O objects of loading and saving operations
+ *   - "manip": sail_convert_image(), sail_scale_image(), and sail_quantize_image()
+ *   - "parallel": the rows every thread processes in a parallel loop
+ *
+ * Callbacks may be called concurrently from different threads.
+ */
+typedef void (*sail_trace_func_t)(void* user_data, const char* name, const char* category);
+
+/*
+ * Sets the callbacks called around the traced regions. Pass NULL callbacks to disable tracing,
+ * which is the default. Without callbacks, tracing costs a single branch per region.
+ *
+ * Thread-safe. Waits until the threads calling the previous callbacks return from them, so
+ * the previous user data may be freed right after this call. Must not be called from trace
+ * callbacks, which would wait for themselves forever.
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_EXPORT sail_status_t sail_set_trace_callbacks(sail_trace_func_t begin, sail_trace_func_t end, void* user_data);
+
+/*
+ * Begins a traced region on the calling thread. Use it to mark regions of your own code
+ * on the same timeline with SAIL regions. Does nothing if tracing is disabled.
+ */
+SAIL_EXPORT void sail_trace_begin(const char* name, const char* category);
+
+/*
+ * Ends the traced region begun with sail_trace_begin() on the calling thread.
+ * Does nothing if tracing is disabled.
+ */
+SAIL_EXPORT void sail_trace_end(const char* name, const char* category);
+
+/*
+ * Starts writing the traced regions into the specified file in the Chrome trace event format.
+ * Load the file into Perfetto UI or chrome://tracing to see the timeline of all threads.
+ * Replaces the trace callbacks.
+ *
+ * Don't call it concurrently with sail_stop_chrome_trace().
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_EXPORT sail_status_t sail_start_chrome_trace(const char* path);
+
+/*
+ * Disables tracing, finishes and closes the file started with sail_start_chrome_trace().
+ * Does nothing if no file is started.
+ *
+ * Don't call it concurrently with sail_start_chrome_trace().
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_EXPORT sail_status_t sail_stop_chrome_trace(void);
+
+/* extern "C" */
+#ifdef __cplusplus
+}
+#endif
@@ -41,6 +41,7 @@
 #else
 #include <errno.h>
 #include <sys/time.h>
+#include <time.h> /* clock_gettime() */
 #include <unistd.h>
 #endif
 
@@ -647,6 +648,83 @@ unsigned sail_bytes_per_line(unsigned width, enum SailPixelFormat pixel_format)
     return (bytes_per_line < UINT_MAX) ? (unsigned)bytes_per_line : 0;
 }
 
+unsigned sail_align_bytes_per_line(unsigned bytes_per_line, unsigned alignment)
+{
+    if (alignment == 0)
+    {
+        return bytes_per_line;
+    }
+
+    if (bytes_per_line > UINT_MAX - (alignment - 1))
+    {
+        return 0;
+    }
+
+    return (bytes_per_line + alignment - 1) & ~(alignment - 1);
+}
+
+sail_status_t sail_copy_pixels_rectangle(const void* src,
+                                         unsigned src_bytes_per_line,
+                                         enum SailPixelFormat pixel_format,
+                                         unsigned x,
+                                         unsigned y,
+                                         unsigned width,
+                                         unsigned height,
+                                         void* dst,
+                                         unsigned dst_bytes_per_line)
+{
+    SAIL_CHECK_PTR(src);
+    SAIL_CHECK_PTR(dst);
+
+    const unsigned bits_per_pixel = sail_bits_per_pixel(pixel_format);
+
+    if (bits_per_pixel == 0)
+    {
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_UNSUPPORTED_PIXEL_FORMAT);
+    }
+
+    const unsigned row_size = sail_bytes_per_line(width, pixel_format);
+
+    if (row_size > dst_bytes_per_line)
+    {
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_INVALID_BYTES_PER_LINE);
+    }
+
+    /*
+     * Rows are processed top to bottom, so cropping in place never overwrites
+     * source rows that are not copied yet.
+     */
+    for (unsigned row = 0; row < height; row++)
+    {
+        const unsigned char* src_scan = (const unsigned char*)src + (size_t)(y + row) * src_bytes_per_line;
+        unsigned char* dst_scan       = (unsigned char*)dst + (size_t)row * dst_bytes_per_line;
+
+        if (bits_per_pixel % 8 == 0)
+        {
+            memmove(dst_scan, src_scan + (size_t)x * (bits_per_pixel / 8), row_size);
+        }
+        else
+        {
+            /* Sub-byte pixels are packed MSB first. */
+            const unsigned mask = (1U << bits_per_pixel) - 1;
+
+            for (unsigned column = 0; column < width; column++)
+            {
+                const size_t src_bit     = (size_t)(x + column) * bits_per_pixel;
+                const size_t dst_bit     = (size_t)column * bits_per_pixel;
+                const unsigned src_shift = 8 - bits_per_pixel - (unsigned)(src_bit % 8);
+                const unsigned dst_shift = 8 - bits_per_pixel - (unsigned)(dst_bit % 8);
+                const unsigned value     = (src_scan[src_bit / 8] >> src_shift) & mask;
+
+                dst_scan[dst_bit / 8] =
+                    (unsigned char)((dst_scan[dst_bit / 8] & ~(mask << dst_shift)) | (value << dst_shift));
+            }
+        }
+    }
+
+    return SAIL_OK;
+}
+
 bool sail_is_indexed(enum SailPixelFormat pixel_format)
 {
     switch (pixel_format)
@@ -933,6 +1011,45 @@ uint64_t sail_now(void)
 #endif
 }
 
+uint64_t sail_now_us(void)
+{
+#ifdef SAIL_WIN32
+    static SAIL_THREAD_LOCAL LONGLONG frequency = 0;
+
+    LARGE_INTEGER li;
+
+    if (frequency == 0)
+    {
+        if (!QueryPerformanceFrequency(&li))
+        {
+            SAIL_LOG_ERROR("Failed to get the current time. Error: 0x%X", GetLastError());
+            return 0;
+        }
+
+        frequency = li.QuadPart;
+    }
+
+    if (!QueryPerformanceCounter(&li))
+    {
+        SAIL_LOG_ERROR("Failed to get the current time. Error: 0x%X", GetLastError());
+        return 0;
+    }
+
+    /* Split the division to avoid overflowing the multiplication. */
+    return (uint64_t)(li.QuadPart / frequency) * 1000000 + (uint64_t)(li.QuadPart % frequency) * 1000000 / frequency;
+#else
+    struct timespec ts;
+
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0)
+    {
+        SAIL_LOG_ERROR("Failed to get the current time: %s", sail_strerror());
+        return 0;
+    }
+
+    return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+#endif
+}
+
 bool sail_path_exists(const char* path)
 {
     if (path == NULL)
@@ -151,6 +151,16 @@ SAIL_EXPORT bool sail_greater_bits_per_pixel(enum SailPixelFormat pixel_format1,
  */
 SAIL_EXPORT unsigned sail_bytes_per_line(unsigned width, enum SailPixelFormat pixel_format);
 
+/*
+ * Rounds the specified number of bytes per line up to a multiple of the alignment.
+ * The alignment must be a power of two. 0 alignment returns the bytes per line as is.
+ * Returns 0 if the result doesn't fit into an unsigned int.
+ *
+ * For example:
+ *   sail_align_bytes_per_line(100, 64) == 128
+ */
+SAIL_EXPORT unsigned sail_align_bytes_per_line(unsigned bytes_per_line, unsigned alignment);
+
 /*
  * Multiplies a and b into *result when the product fits in size_t.
  *
@@ -166,6 +176,26 @@ SAIL_EXPORT sail_status_t sail_size_mul(unsigned a, unsigned b, size_t* result);
  */
 SAIL_EXPORT sail_status_t sail_pixels_buffer_size(unsigned height, unsigned bytes_per_line, size_t* pixels_size);
 
+/*
+ * Copies the rectangle x,y width x height of the source pixels into the destination pixels.
+ * Both the buffers have the same pixel format. Destination scan lines start at the beginning
+ * of the destination buffer. Works for pixel formats with less than 8 bits per pixel too.
+ *
+ * The destination may point to the source buffer to crop in place when dst_bytes_per_line
+ * is less than or equal to src_bytes_per_line.
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_EXPORT sail_status_t sail_copy_pixels_rectangle(const void* src,
+                                                     unsigned src_bytes_per_line,
+                                                     enum SailPixelFormat pixel_format,
+                                                     unsigned x,
+                                                     unsigned y,
+                                                     unsigned width,
+                                                     unsigned height,
+                                                     void* dst,
+                                                     unsigned dst_bytes_per_line);
+
 /*
  * Returns true if the given pixel format is indexed and assumes having a palette.
  */
@@ -217,6 +247,12 @@ SAIL_EXPORT const char* sail_strerror(void);
  */
 SAIL_EXPORT uint64_t sail_now(void);
 
+/*
+ * Returns the current number of microseconds of a monotonic clock or 0 on error. Use it to measure
+ * time intervals. The starting point is unspecified.
+ */
+SAIL_EXPORT uint64_t sail_now_us(void);
+
 /*
  * Returns true if the specified file system path exists.
  */
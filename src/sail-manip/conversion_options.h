@@ -57,6 +57,12 @@ struct sail_conversion_options
      * when options has SAIL_CONVERSION_OPTION_BLEND_ALPHA.
      */
     sail_rgb24_t background24;
+
+    /*
+     * The maximum number of threads to convert the image with. 0 means sail_max_threads().
+     * Values greater than sail_max_threads() are truncated.
+     */
+    unsigned max_threads;
 };
 
 typedef struct sail_conversion_options sail_conversion_options_t;
@@ -32,6 +32,7 @@
 #include <sail-manip/sail-manip.h>
 
 #include "fast_conversions.h"
+#include "row_conversions.h"
 #include "swscale_conversions.h"
 
 /*
@@ -167,6 +168,13 @@ struct output_context
     int b;
     int a;
     const struct sail_conversion_options* options;
+
+    /* Input palette converted to RGBA32. Set for indexed input images only. */
+    const sail_rgba32_t* palette;
+
+    /* Rows to convert. */
+    unsigned row_begin;
+    unsigned row_end;
 };
 
 typedef void (*pixel_consumer_t)(const struct output_context* output_context,
@@ -1154,14 +1162,7 @@ static sail_status_t convert_from_indexed(const struct sail_image* image,
                                           pixel_consumer_t pixel_consumer,
                                           const struct output_context* output_context)
 {
-    /* Pre-convert palette once to avoid repeated lookups and format conversions */
-    sail_rgba32_t* preconverted_palette = NULL;
-    SAIL_TRY(preconvert_palette_to_rgba32(image->palette, &preconverted_palette));
-
-    unsigned row;
-
-    SAIL_OMP_PARALLEL_FOR
-    for (row = 0; row < image->height; row++)
+    for (unsigned row = output_context->row_begin; row < output_context->row_end; row++)
     {
         const uint8_t* scan_input = sail_scan_line(image, row);
         uint8_t* scan_output8     = sail_scan_line(output_context->image, row);
@@ -1179,7 +1180,7 @@ static sail_status_t convert_from_indexed(const struct sail_image* image,
 
                 /* Direct lookup in pre-converted palette. */
                 const uint8_t safe_index   = (index < image->palette->color_count) ? index : 0;
-                const sail_rgba32_t rgba32 = preconverted_palette[safe_index];
+                const sail_rgba32_t rgba32 = output_context->palette[safe_index];
                 pixel_consumer(output_context, &scan_output8, &scan_output16, &rgba32, NULL);
 
                 bit_shift  -= bit_shift_decrease_by;
@@ -1189,7 +1190,6 @@ static sail_status_t convert_from_indexed(const struct sail_image* image,
         }
     }
 
-    sail_free(preconverted_palette);
     return SAIL_OK;
 }
 
@@ -1238,10 +1238,7 @@ static sail_status_t convert_from_grayscale_up_to_bpp8(const struct sail_image*
                                                        pixel_consumer_t pixel_consumer,
                                                        const struct output_context* output_context)
 {
-    unsigned row;
-
-    SAIL_OMP_PARALLEL_FOR
-    for (row = 0; row < image->height; row++)
+    for (unsigned row = output_context->row_begin; row < output_context->row_end; row++)
     {
         const uint8_t* scan_input = sail_scan_line(image, row);
         uint8_t* scan_output8     = sail_scan_line(output_context->image, row);
@@ -1314,10 +1311,7 @@ static sail_status_t convert_from_bpp16_grayscale(const struct sail_image* image
                                                   pixel_consumer_t pixel_consumer,
                                                   const struct output_context* output_context)
 {
-    unsigned row;
-
-    SAIL_OMP_PARALLEL_FOR
-    for (row = 0; row < image->height; row++)
+    for (unsigned row = output_context->row_begin; row < output_context->row_end; row++)
     {
         const uint16_t* scan_input = sail_scan_line(image, row);
         uint8_t* scan_output8      = sail_scan_line(output_context->image, row);
@@ -1338,10 +1332,7 @@ static sail_status_t convert_from_bpp16_grayscale_alpha(const struct sail_image*
                                                         pixel_consumer_t pixel_consumer,
                                                         const struct output_context* output_context)
 {
-    unsigned row;
-
-    SAIL_OMP_PARALLEL_FOR
-    for (row = 0; row < image->height; row++)
+    for (unsigned row = output_context->row_begin; row < output_context->row_end; row++)
     {
         const uint8_t* scan_input = sail_scan_line(image, row);
         uint8_t* scan_output8     = sail_scan_line(output_context->image, row);
@@ -1364,10 +1355,7 @@ static sail_status_t convert_from_bpp32_grayscale_alpha(const struct sail_image*
                                                         pixel_consumer_t pixel_consumer,
                                                         const struct output_context* output_context)
 {
-    unsigned row;
-
-    SAIL_OMP_PARALLEL_FOR
-    for (row = 0; row < image->height; row++)
+    for (unsigned row = output_context->row_begin; row < output_context->row_end; row++)
     {
         const uint16_t* scan_input = sail_scan_line(image, row);
         uint8_t* scan_output8      = sail_scan_line(output_context->image, row);
@@ -1390,10 +1378,7 @@ static sail_status_t convert_from_bpp16_rgb555(const struct sail_image* image,
                                                pixel_consumer_t pixel_consumer,
                                                const struct output_context* output_context)
 {
-    unsigned row;
-
-    SAIL_OMP_PARALLEL_FOR
-    for (row = 0; row < image->height; row++)
+    for (unsigned row = output_context->row_begin; row < output_context->row_end; row++)
     {
         const uint16_t* scan_input = sail_scan_line(image, row);
         uint8_t* scan_output8      = sail_scan_line(output_context->image, row);
@@ -1416,10 +1401,7 @@ static sail_status_t convert_from_bpp16_bgr555(const struct sail_image* image,
                                                pixel_consumer_t pixel_consumer,
                                                const struct output_context* output_context)
 {
-    unsigned row;
-
-    SAIL_OMP_PARALLEL_FOR
-    for (row = 0; row < image->height; row++)
+    for (unsigned row = output_context->row_begin; row < output_context->row_end; row++)
     {
         const uint16_t* scan_input = sail_scan_line(image, row);
         uint8_t* scan_output8      = sail_scan_line(output_context->image, row);
@@ -1442,10 +1424,7 @@ static sail_status_t convert_from_bpp16_rgb565(const struct sail_image* image,
                                                pixel_consumer_t pixel_consumer,
                                                const struct output_context* output_context)
 {
-    unsigned row;
-
-    SAIL_OMP_PARALLEL_FOR
-    for (row = 0; row < image->height; row++)
+    for (unsigned row = output_context->row_begin; row < output_context->row_end; row++)
     {
         const uint16_t* scan_input = sail_scan_line(image, row);
         uint8_t* scan_output8      = sail_scan_line(output_context->image, row);
@@ -1468,10 +1447,7 @@ static sail_status_t convert_from_bpp16_bgr565(const struct sail_image* image,
                                                pixel_consumer_t pixel_consumer,
                                                const struct output_context* output_context)
 {
-    unsigned row;
-
-    SAIL_OMP_PARALLEL_FOR
-    for (row = 0; row < image->height; row++)
+    for (unsigned row = output_context->row_begin; row < output_context->row_end; row++)
     {
         const uint16_t* scan_input = sail_scan_line(image, row);
         uint8_t* scan_output8      = sail_scan_line(output_context->image, row);
@@ -1497,10 +1473,7 @@ static sail_status_t convert_from_bpp24_rgb_kind(const struct sail_image* image,
                                                  pixel_consumer_t pixel_consumer,
                                                  const struct output_context* output_context)
 {
-    unsigned row;
-
-    SAIL_OMP_PARALLEL_FOR
-    for (row = 0; row < image->height; row++)
+    for (unsigned row = output_context->row_begin; row < output_context->row_end; row++)
     {
         const uint8_t* scan_input = sail_scan_line(image, row);
         uint8_t* scan_output8     = sail_scan_line(output_context->image, row);
@@ -1525,10 +1498,7 @@ static sail_status_t convert_from_bpp48_rgb_kind(const struct sail_image* image,
                                                  pixel_consumer_t pixel_consumer,
                                                  const struct output_context* output_context)
 {
-    unsigned row;
-
-    SAIL_OMP_PARALLEL_FOR
-    for (row = 0; row < image->height; row++)
+    for (unsigned row = output_context->row_begin; row < output_context->row_end; row++)
     {
         const uint16_t* scan_input = sail_scan_line(image, row);
         uint8_t* scan_output8      = sail_scan_line(output_context->image, row);
@@ -1554,10 +1524,7 @@ static sail_status_t convert_from_bpp32_rgba_kind(const struct sail_image* image
                                                   pixel_consumer_t pixel_consumer,
                                                   const struct output_context* output_context)
 {
-    unsigned row;
-
-    SAIL_OMP_PARALLEL_FOR
-    for (row = 0; row < image->height; row++)
+    for (unsigned row = output_context->row_begin; row < output_context->row_end; row++)
     {
         const uint8_t* scan_input = sail_scan_line(image, row);
         uint8_t* scan_output8     = sail_scan_line(output_context->image, row);
@@ -1584,10 +1551,7 @@ static sail_status_t convert_from_bpp64_rgba_kind(const struct sail_image* image
                                                   pixel_consumer_t pixel_consumer,
                                                   const struct output_context* output_context)
 {
-    unsigned row;
-
-    SAIL_OMP_PARALLEL_FOR
-    for (row = 0; row < image->height; row++)
+    for (unsigned row = output_context->row_begin; row < output_context->row_end; row++)
     {
         const uint16_t* scan_input = sail_scan_line(image, row);
         uint8_t* scan_output8      = sail_scan_line(output_context->image, row);
@@ -1610,10 +1574,7 @@ static sail_status_t convert_from_bpp32_cmyk(const struct sail_image* image,
                                              pixel_consumer_t pixel_consumer,
                                              const struct output_context* output_context)
 {
-    unsigned row;
-
-    SAIL_OMP_PARALLEL_FOR
-    for (row = 0; row < image->height; row++)
+    for (unsigned row = output_context->row_begin; row < output_context->row_end; row++)
     {
         const uint8_t* scan_input = sail_scan_line(image, row);
         uint8_t* scan_output8     = sail_scan_line(output_context->image, row);
@@ -1637,10 +1598,7 @@ static sail_status_t convert_from_bpp64_cmyk(const struct sail_image* image,
                                              pixel_consumer_t pixel_consumer,
                                              const struct output_context* output_context)
 {
-    unsigned row;
-
-    SAIL_OMP_PARALLEL_FOR
-    for (row = 0; row < image->height; row++)
+    for (unsigned row = output_context->row_begin; row < output_context->row_end; row++)
     {
         const uint16_t* scan_input = sail_scan_line(image, row);
         uint8_t* scan_output8      = sail_scan_line(output_context->image, row);
@@ -1664,10 +1622,7 @@ static sail_status_t convert_from_bpp40_cmyka(const struct sail_image* image,
                                               pixel_consumer_t pixel_consumer,
                                               const struct output_context* output_context)
 {
-    unsigned row;
-
-    SAIL_OMP_PARALLEL_FOR
-    for (row = 0; row < image->height; row++)
+    for (unsigned row = output_context->row_begin; row < output_context->row_end; row++)
     {
         const uint8_t* scan_input = sail_scan_line(image, row);
         uint8_t* scan_output8     = sail_scan_line(output_context->image, row);
@@ -1691,10 +1646,7 @@ static sail_status_t convert_from_bpp80_cmyka(const struct sail_image* image,
                                               pixel_consumer_t pixel_consumer,
                                               const struct output_context* output_context)
 {
-    unsigned row;
-
-    SAIL_OMP_PARALLEL_FOR
-    for (row = 0; row < image->height; row++)
+    for (unsigned row = output_context->row_begin; row < output_context->row_end; row++)
     {
         const uint16_t* scan_input = sail_scan_line(image, row);
         uint8_t* scan_output8      = sail_scan_line(output_context->image, row);
@@ -1718,10 +1670,7 @@ static sail_status_t convert_from_bpp24_ycbcr(const struct sail_image* image,
                                               pixel_consumer_t pixel_consumer,
                                               const struct output_context* output_context)
 {
-    unsigned row;
-
-    SAIL_OMP_PARALLEL_FOR
-    for (row = 0; row < image->height; row++)
+    for (unsigned row = output_context->row_begin; row < output_context->row_end; row++)
     {
         const uint8_t* scan_input = sail_scan_line(image, row);
         uint8_t* scan_output8     = sail_scan_line(output_context->image, row);
@@ -1744,10 +1693,7 @@ static sail_status_t convert_from_bpp32_ycck(const struct sail_image* image,
                                              pixel_consumer_t pixel_consumer,
                                              const struct output_context* output_context)
 {
-    unsigned row;
-
-    SAIL_OMP_PARALLEL_FOR
-    for (row = 0; row < image->height; row++)
+    for (unsigned row = output_context->row_begin; row < output_context->row_end; row++)
     {
         const uint8_t* scan_input = sail_scan_line(image, row);
         uint8_t* scan_output8     = sail_scan_line(output_context->image, row);
@@ -1772,10 +1718,7 @@ static sail_status_t convert_from_bpp16_grayscale_half(const struct sail_image*
                                                         pixel_consumer_t pixel_consumer,
                                                         const struct output_context* output_context)
 {
-    unsigned row;
-
-    SAIL_OMP_PARALLEL_FOR
-    for (row = 0; row < image->height; row++)
+    for (unsigned row = output_context->row_begin; row < output_context->row_end; row++)
     {
         const uint16_t* scan_input = sail_scan_line(image, row);
         uint8_t* scan_output8      = sail_scan_line(output_context->image, row);
@@ -1797,10 +1740,7 @@ static sail_status_t convert_from_bpp32_grayscale_float(const struct sail_image*
                                                          pixel_consumer_t pixel_consumer,
                                                          const struct output_context* output_context)
 {
-    unsigned row;
-
-    SAIL_OMP_PARALLEL_FOR
-    for (row = 0; row < image->height; row++)
+    for (unsigned row = output_context->row_begin; row < output_context->row_end; row++)
     {
         const float* scan_input = sail_scan_line(image, row);
         uint8_t* scan_output8   = sail_scan_line(output_context->image, row);
@@ -1822,10 +1762,7 @@ static sail_status_t convert_from_bpp48_rgb_half(const struct sail_image* image,
                                                   pixel_consumer_t pixel_consumer,
                                                   const struct output_context* output_context)
 {
-    unsigned row;
-
-    SAIL_OMP_PARALLEL_FOR
-    for (row = 0; row < image->height; row++)
+    for (unsigned row = output_context->row_begin; row < output_context->row_end; row++)
     {
         const uint16_t* scan_input = sail_scan_line(image, row);
         uint8_t* scan_output8      = sail_scan_line(output_context->image, row);
@@ -1852,10 +1789,7 @@ static sail_status_t convert_from_bpp64_rgba_half(const struct sail_image* image
                                                    pixel_consumer_t pixel_consumer,
                                                    const struct output_context* output_context)
 {
-    unsigned row;
-
-    SAIL_OMP_PARALLEL_FOR
-    for (row = 0; row < image->height; row++)
+    for (unsigned row = output_context->row_begin; row < output_context->row_end; row++)
     {
         const uint16_t* scan_input = sail_scan_line(image, row);
         uint8_t* scan_output8      = sail_scan_line(output_context->image, row);
@@ -1882,10 +1816,7 @@ static sail_status_t convert_from_bpp96_rgb_float(const struct sail_image* image
                                                    pixel_consumer_t pixel_consumer,
                                                    const struct output_context* output_context)
 {
-    unsigned row;
-
-    SAIL_OMP_PARALLEL_FOR
-    for (row = 0; row < image->height; row++)
+    for (unsigned row = output_context->row_begin; row < output_context->row_end; row++)
     {
         const float* scan_input = sail_scan_line(image, row);
         uint8_t* scan_output8   = sail_scan_line(output_context->image, row);
@@ -1912,10 +1843,7 @@ static sail_status_t convert_from_bpp128_rgba_float(const struct sail_image* ima
                                                      pixel_consumer_t pixel_consumer,
                                                      const struct output_context* output_context)
 {
-    unsigned row;
-
-    SAIL_OMP_PARALLEL_FOR
-    for (row = 0; row < image->height; row++)
+    for (unsigned row = output_context->row_begin; row < output_context->row_end; row++)
     {
         const float* scan_input = sail_scan_line(image, row);
         uint8_t* scan_output8   = sail_scan_line(output_context->image, row);
@@ -1938,16 +1866,22 @@ static sail_status_t convert_from_bpp128_rgba_float(const struct sail_image* ima
     return SAIL_OK;
 }
 
-static sail_status_t conversion_impl(const struct sail_image* image,
-                                     struct sail_image* image_output,
-                                     pixel_consumer_t pixel_consumer,
-                                     int r, /* Index of the RED component.   */
-                                     int g, /* Index of the GREEN component. */
-                                     int b, /* Index of the BLUE component.  */
-                                     int a, /* Index of the ALPHA component. */
-                                     const struct sail_conversion_options* options)
+struct conversion_context
+{
+    const struct sail_image* image;
+    pixel_consumer_t pixel_consumer;
+    const struct output_context* output_context;
+};
+
+static sail_status_t convert_rows(void* context, unsigned row_begin, unsigned row_end)
 {
-    const struct output_context output_context = {image_output, r, g, b, a, options};
+    const struct conversion_context* conversion_context = context;
+    const struct sail_image* image                      = conversion_context->image;
+    const pixel_consumer_t pixel_consumer               = conversion_context->pixel_consumer;
+
+    struct output_context output_context = *conversion_context->output_context;
+    output_context.row_begin             = row_begin;
+    output_context.row_end               = row_end;
 
     /* After adding a new input pixel format, also update the switch in sail_can_convert(). */
     switch (image->pixel_format)
@@ -2198,6 +2132,194 @@ static sail_status_t conversion_impl(const struct sail_image* image,
     return SAIL_OK;
 }
 
+/* palette is the input palette converted to RGBA32 for indexed input images. */
+static sail_status_t convert_with_palette(const struct sail_image* image,
+                                          struct sail_image* image_output,
+                                          pixel_consumer_t pixel_consumer,
+                                          int r, /* Index of the RED component.   */
+                                          int g, /* Index of the GREEN component. */
+                                          int b, /* Index of the BLUE component.  */
+                                          int a, /* Index of the ALPHA component. */
+                                          const struct sail_conversion_options* options,
+                                          const sail_rgba32_t* palette)
+{
+    const struct output_context output_context         = {image_output, r, g, b, a, options, palette, 0, 0};
+    const struct conversion_context conversion_context = {image, pixel_consumer, &output_context};
+    const unsigned max_threads                         = (options == NULL) ? 0 : options->max_threads;
+
+    /* Converting no rows fails for unsupported input pixel formats. Check them once before the parallel loop. */
+    SAIL_TRY(convert_rows((void*)&conversion_context, 0, 0));
+    SAIL_TRY(sail_parallel_for(image->height, max_threads, convert_rows, (void*)&conversion_context));
+
+    return SAIL_OK;
+}
+
+static sail_status_t conversion_impl(const struct sail_image* image,
+                                     struct sail_image* image_output,
+                                     pixel_consumer_t pixel_consumer,
+                                     int r, /* Index of the RED component.   */
+                                     int g, /* Index of the GREEN component. */
+                                     int b, /* Index of the BLUE component.  */
+                                     int a, /* Index of the ALPHA component. */
+                                     const struct sail_conversion_options* options)
+{
+    sail_rgba32_t* palette = NULL;
+
+    if (sail_is_indexed(image->pixel_format))
+    {
+        /* Pre-convert palette once to avoid repeated lookups and format conversions */
+        SAIL_TRY(preconvert_palette_to_rgba32(image->palette, &palette));
+    }
+
+    SAIL_TRY_OR_CLEANUP(convert_with_palette(image, image_output, pixel_consumer, r, g, b, a, options, palette),
+                        /* cleanup */ sail_free(palette));
+
+    sail_free(palette);
+
+    return SAIL_OK;
+}
+
+/* Conversion paths in the order sail_convert_image_with_options() tries them. */
+enum SailConversionPathPrivate
+{
+    SAIL_CONVERSION_PATH_PRIVATE_SWSCALE,
+    SAIL_CONVERSION_PATH_PRIVATE_ROW,
+    SAIL_CONVERSION_PATH_PRIVATE_FAST,
+    SAIL_CONVERSION_PATH_PRIVATE_GENERIC,
+};
+
+static const char* conversion_path_to_string(enum SailConversionPathPrivate conversion_path)
+{
+    switch (conversion_path)
+    {
+    case SAIL_CONVERSION_PATH_PRIVATE_SWSCALE: return "swscale";
+    case SAIL_CONVERSION_PATH_PRIVATE_ROW: return "row";
+    case SAIL_CONVERSION_PATH_PRIVATE_FAST: return "fast";
+    case SAIL_CONVERSION_PATH_PRIVATE_GENERIC: return "generic";
+    }
+
+    return NULL;
+}
+
+struct sail_conversion_plan
+{
+    enum SailPixelFormat input_pixel_format;
+    enum SailPixelFormat output_pixel_format;
+    unsigned width;
+    unsigned height;
+
+    /* Points to options_copy or is NULL. */
+    const struct sail_conversion_options* options;
+    struct sail_conversion_options options_copy;
+
+    enum SailConversionPathPrivate conversion_path;
+
+    /* Set for SAIL_CONVERSION_PATH_PRIVATE_SWSCALE. */
+    struct SwsContext* sws_context;
+    /* Set for SAIL_CONVERSION_PATH_PRIVATE_ROW. */
+    struct sail_row_conversion row_conversion;
+    /* Set for SAIL_CONVERSION_PATH_PRIVATE_FAST. */
+    struct sail_fast_conversion fast_conversion;
+
+    /* The generic path. Also used when the chosen path fails. */
+    pixel_consumer_t pixel_consumer;
+    int r;
+    int g;
+    int b;
+    int a;
+
+    /* Input palette converted to RGBA32. Rebuilt for every indexed input image. */
+    sail_rgba32_t palette[256];
+};
+
+static sail_status_t check_conversion_plan_image(const struct sail_conversion_plan* conversion_plan,
+                                                 const struct sail_image* image,
+                                                 enum SailPixelFormat pixel_format)
+{
+    SAIL_TRY(sail_check_image_valid(image));
+
+    if (image->pixel_format != pixel_format)
+    {
+        SAIL_LOG_ERROR("Conversion plan expects %s image, but got %s", sail_pixel_format_to_string(pixel_format),
+                       sail_pixel_format_to_string(image->pixel_format));
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_UNSUPPORTED_PIXEL_FORMAT);
+    }
+
+    if (image->width != conversion_plan->width || image->height != conversion_plan->height)
+    {
+        SAIL_LOG_ERROR("Conversion plan expects %ux%u image, but got %ux%u", conversion_plan->width,
+                       conversion_plan->height, image->width, image->height);
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_INVALID_IMAGE_DIMENSIONS);
+    }
+
+    if (image->bytes_per_line < sail_bytes_per_line(image->width, image->pixel_format))
+    {
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_INVALID_BYTES_PER_LINE);
+    }
+
+    return SAIL_OK;
+}
+
+static sail_status_t execute_conversion_plan(struct sail_conversion_plan* conversion_plan,
+                                             const struct sail_image* image_input,
+                                             struct sail_image* image_output)
+{
+    SAIL_CHECK_PTR(conversion_plan);
+    SAIL_TRY(check_conversion_plan_image(conversion_plan, image_input, conversion_plan->input_pixel_format));
+    SAIL_TRY(check_conversion_plan_image(conversion_plan, image_output, conversion_plan->output_pixel_format));
+
+    const unsigned max_threads   = (conversion_plan->options == NULL) ? 0 : conversion_plan->options->max_threads;
+    const sail_rgba32_t* palette = NULL;
+
+    if (sail_is_indexed(image_input->pixel_format))
+    {
+        if (!sail_build_row_palette(image_input->palette, conversion_plan->palette))
+        {
+            SAIL_LOG_ERROR("Palette of %u colors in %s format cannot be converted", image_input->palette->color_count,
+                           sail_pixel_format_to_string(image_input->palette->pixel_format));
+            SAIL_LOG_AND_RETURN(SAIL_ERROR_UNSUPPORTED_PIXEL_FORMAT);
+        }
+
+        palette = conversion_plan->palette;
+    }
+
+    bool converted = false;
+
+    switch (conversion_plan->conversion_path)
+    {
+    case SAIL_CONVERSION_PATH_PRIVATE_SWSCALE:
+    {
+        converted = sail_execute_swscale_conversion(conversion_plan->sws_context, image_input, image_output);
+        break;
+    }
+    case SAIL_CONVERSION_PATH_PRIVATE_ROW:
+    {
+        converted = sail_execute_row_conversion(&conversion_plan->row_conversion, image_input, image_output, palette,
+                                                max_threads);
+        break;
+    }
+    case SAIL_CONVERSION_PATH_PRIVATE_FAST:
+    {
+        converted =
+            sail_execute_fast_conversion(&conversion_plan->fast_conversion, image_input, image_output, max_threads);
+        break;
+    }
+    case SAIL_CONVERSION_PATH_PRIVATE_GENERIC:
+    {
+        break;
+    }
+    }
+
+    if (!converted)
+    {
+        SAIL_TRY(convert_with_palette(image_input, image_output, conversion_plan->pixel_consumer, conversion_plan->r,
+                                      conversion_plan->g, conversion_plan->b, conversion_plan->a,
+                                      conversion_plan->options, palette));
+    }
+
+    return SAIL_OK;
+}
+
 /*
  * Public functions.
  */
@@ -2211,10 +2333,10 @@ sail_status_t sail_convert_image(const struct sail_image* image,
     return SAIL_OK;
 }
 
-sail_status_t sail_convert_image_with_options(const struct sail_image* image,
-                                              enum SailPixelFormat output_pixel_format,
-                                              const struct sail_conversion_options* options,
-                                              struct sail_image** image_output)
+static sail_status_t convert_image_with_options(const struct sail_image* image,
+                                                enum SailPixelFormat output_pixel_format,
+                                                const struct sail_conversion_options* options,
+                                                struct sail_image** image_output)
 {
     SAIL_TRY(sail_check_image_valid(image));
     SAIL_CHECK_PTR(image_output);
@@ -2306,10 +2428,18 @@ sail_status_t sail_convert_image_with_options(const struct sail_image* image,
         }
     }
 
+    /* Try row-batched conversion with SIMD kernels (alpha blending is left to the standard conversion) */
+    if (sail_try_row_conversion(image, image_local, options))
+    {
+        *image_output = image_local;
+        return SAIL_OK;
+    }
+
     /* Try fast-path conversion (no alpha blending support in fast-path) */
     if (options == NULL || !(options->options & SAIL_CONVERSION_OPTION_BLEND_ALPHA))
     {
-        if (sail_try_fast_conversion(image, image_local, output_pixel_format))
+        if (sail_try_fast_conversion(image, image_local, output_pixel_format,
+                                     (options == NULL) ? 0 : options->max_threads))
         {
             *image_output = image_local;
             return SAIL_OK;
@@ -2325,6 +2455,119 @@ sail_status_t sail_convert_image_with_options(const struct sail_image* image,
     return SAIL_OK;
 }
 
+sail_status_t sail_convert_image_with_options(const struct sail_image* image,
+                                              enum SailPixelFormat output_pixel_format,
+                                              const struct sail_conversion_options* options,
+                                              struct sail_image** image_output)
+{
+    sail_trace_begin("sail_convert_image", "manip");
+    const sail_status_t status = convert_image_with_options(image, output_pixel_format, options, image_output);
+    sail_trace_end("sail_convert_image", "manip");
+
+    return status;
+}
+
+sail_status_t sail_alloc_conversion_plan(enum SailPixelFormat input_pixel_format,
+                                         enum SailPixelFormat output_pixel_format,
+                                         unsigned width,
+                                         unsigned height,
+                                         const struct sail_conversion_options* options,
+                                         struct sail_conversion_plan** conversion_plan)
+{
+    SAIL_CHECK_PTR(conversion_plan);
+
+    if (width == 0 || height == 0)
+    {
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_INVALID_IMAGE_DIMENSIONS);
+    }
+
+    /* Quantization builds a new palette for every image. */
+    if (sail_is_indexed(output_pixel_format) || !sail_can_convert(input_pixel_format, output_pixel_format))
+    {
+        SAIL_LOG_ERROR("Conversion plans cannot convert %s to %s", sail_pixel_format_to_string(input_pixel_format),
+                       sail_pixel_format_to_string(output_pixel_format));
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_UNSUPPORTED_PIXEL_FORMAT);
+    }
+
+    void* ptr;
+    SAIL_TRY(sail_malloc(sizeof(struct sail_conversion_plan), &ptr));
+    struct sail_conversion_plan* conversion_plan_local = ptr;
+
+    conversion_plan_local->input_pixel_format  = input_pixel_format;
+    conversion_plan_local->output_pixel_format = output_pixel_format;
+    conversion_plan_local->width               = width;
+    conversion_plan_local->height              = height;
+    conversion_plan_local->options             = NULL;
+    conversion_plan_local->sws_context         = NULL;
+
+    if (options != NULL)
+    {
+        conversion_plan_local->options_copy = *options;
+        conversion_plan_local->options      = &conversion_plan_local->options_copy;
+    }
+
+    SAIL_TRY_OR_CLEANUP(verify_and_construct_rgba_indexes_verbose(
+                            output_pixel_format, &conversion_plan_local->pixel_consumer, &conversion_plan_local->r,
+                            &conversion_plan_local->g, &conversion_plan_local->b, &conversion_plan_local->a),
+                        /* cleanup */ sail_free(conversion_plan_local));
+
+    /* Choose the path like sail_convert_image_with_options() does. */
+    const bool blend_alpha = options != NULL && (options->options & SAIL_CONVERSION_OPTION_BLEND_ALPHA);
+
+    if (!blend_alpha
+        && (conversion_plan_local->sws_context =
+                sail_alloc_swscale_conversion(input_pixel_format, output_pixel_format, width, height))
+               != NULL)
+    {
+        conversion_plan_local->conversion_path = SAIL_CONVERSION_PATH_PRIVATE_SWSCALE;
+    }
+    else if (sail_prepare_row_conversion(input_pixel_format, output_pixel_format, options,
+                                         &conversion_plan_local->row_conversion))
+    {
+        conversion_plan_local->conversion_path = SAIL_CONVERSION_PATH_PRIVATE_ROW;
+    }
+    else if (!blend_alpha
+             && sail_prepare_fast_conversion(input_pixel_format, output_pixel_format,
+                                             &conversion_plan_local->fast_conversion))
+    {
+        conversion_plan_local->conversion_path = SAIL_CONVERSION_PATH_PRIVATE_FAST;
+    }
+    else
+    {
+        conversion_plan_local->conversion_path = SAIL_CONVERSION_PATH_PRIVATE_GENERIC;
+    }
+
+    SAIL_LOG_DEBUG("Conversion plan from %s to %s uses the %s path", sail_pixel_format_to_string(input_pixel_format),
+                   sail_pixel_format_to_string(output_pixel_format),
+                   conversion_path_to_string(conversion_plan_local->conversion_path));
+
+    *conversion_plan = conversion_plan_local;
+
+    return SAIL_OK;
+}
+
+sail_status_t sail_execute_conversion_plan(struct sail_conversion_plan* conversion_plan,
+                                           const struct sail_image* image_input,
+                                           struct sail_image* image_output)
+{
+    sail_trace_begin("sail_execute_conversion_plan", "manip");
+    const sail_status_t status = execute_conversion_plan(conversion_plan, image_input, image_output);
+    sail_trace_end("sail_execute_conversion_plan", "manip");
+
+    return status;
+}
+
+void sail_destroy_conversion_plan(struct sail_conversion_plan* conversion_plan)
+{
+    if (conversion_plan == NULL)
+    {
+        return;
+    }
+
+    sail_destroy_swscale_conversion(conversion_plan->sws_context);
+    sail_free(conversion_plan);
+}
+
 sail_status_t sail_update_image(struct sail_image* image, enum SailPixelFormat output_pixel_format)
 {
     SAIL_TRY(sail_update_image_with_options(image, output_pixel_format, NULL /* options */));
@@ -2374,7 +2617,7 @@ bool sail_can_convert(enum SailPixelFormat input_pixel_format, enum SailPixelFor
         return sail_can_convert(input_pixel_format, SAIL_PIXEL_FORMAT_BPP24_RGB);
     }
 
-    /* After adding a new input pixel format, also update the switch in conversion_impl(). */
+    /* After adding a new input pixel format, also update the switch in convert_rows(). */
     switch (input_pixel_format)
     {
     case SAIL_PIXEL_FORMAT_BPP1_INDEXED:
@@ -38,6 +38,7 @@ extern "C"
 #endif
 
 struct sail_conversion_options;
+struct sail_conversion_plan;
 struct sail_image;
 struct sail_save_features;
 
@@ -48,9 +49,15 @@ struct sail_save_features;
  * when converting RGBA pixels to RGB. If you need to control this behavior,
  * use sail_convert_image_with_options().
  *
- * The conversion procedure may be slow. It converts every pixel into the BPP32-RGBA or
- * BPP64-RGBA formats first, and only then to the requested output format. No platform-specific
- * instructions (like AVX or SSE) are used.
+ * Conversions between BPP8-GRAYSCALE, BPP16-GRAYSCALE-ALPHA, BPP8-INDEXED (input only), BPP24-RGB-like
+ * and BPP32-RGBA-like pixel formats take the row path. Scan lines are converted in batches with
+ * kernels that use the best SIMD instruction set the CPU supports (SSE2, AVX2, AVX-512, or NEON).
+ * See sail_cpu_features(). The row path sets the padding bytes of BPP32-RGBX-like output formats
+ * to 255. Other paths leave the padding bytes unspecified. Blending alpha into output formats
+ * without alpha is not done on the row path.
+ *
+ * Other conversions may be slow. They convert every pixel into the BPP32-RGBA or BPP64-RGBA
+ * formats first, and only then to the requested output format.
  *
  * The image ICC profile is not involved in the conversion procedure.
  *
@@ -143,9 +150,15 @@ SAIL_EXPORT sail_status_t sail_convert_image(const struct sail_image* image,
  *
  * Options (which may be NULL) control the conversion behavior.
  *
- * The conversion procedure may be slow. It converts every pixel into the BPP32-RGBA or
- * BPP64-RGBA formats first, and only then to the requested output format. No platform-specific
- * instructions (like AVX or SSE) are used.
+ * Conversions between BPP8-GRAYSCALE, BPP16-GRAYSCALE-ALPHA, BPP8-INDEXED (input only), BPP24-RGB-like
+ * and BPP32-RGBA-like pixel formats take the row path. Scan lines are converted in batches with
+ * kernels that use the best SIMD instruction set the CPU supports (SSE2, AVX2, AVX-512, or NEON).
+ * See sail_cpu_features(). The row path sets the padding bytes of BPP32-RGBX-like output formats
+ * to 255. Other paths leave the padding bytes unspecified. Blending alpha into output formats
+ * without alpha is not done on the row path.
+ *
+ * Other conversions may be slow. They convert every pixel into the BPP32-RGBA or BPP64-RGBA
+ * formats first, and only then to the requested output format.
  *
  * The image ICC profile (if any) is not involved in the conversion procedure.
  *
@@ -222,6 +235,48 @@ SAIL_EXPORT sail_status_t sail_convert_image_with_options(const struct sail_imag
                                                            const struct sail_conversion_options* options,
                                                            struct sail_image** image_output);
 
+/*
+ * Allocates a conversion plan that converts width x height images from the input pixel format
+ * to the output pixel format. Use it to convert many images of the same size and pixel formats,
+ * like the frames of an animation or a video.
+ *
+ * The plan chooses the conversion path, row kernels, and swscale context once. Executing it
+ * allocates no memory, unless a single conversion runs on more than 32 threads.
+ *
+ * Options (which may be NULL) control the conversion behavior. They are copied into the plan.
+ *
+ * Allowed input and output pixel formats are the same as in sail_convert_image_with_options()
+ * except the indexed output pixel formats. Their palettes are built for every image.
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_EXPORT sail_status_t sail_alloc_conversion_plan(enum SailPixelFormat input_pixel_format,
+                                                     enum SailPixelFormat output_pixel_format,
+                                                     unsigned width,
+                                                     unsigned height,
+                                                     const struct sail_conversion_options* options,
+                                                     struct sail_conversion_plan** conversion_plan);
+
+/*
+ * Converts the input image pixels into the output image pixels with the conversion plan.
+ * Produces the same pixels as sail_convert_image_with_options().
+ *
+ * Both images must have the plan size and pixel formats, and allocated pixels. Only the output
+ * pixels are written. Other properties like the ICC profile are left to the caller.
+ *
+ * Executing the same plan from multiple threads at the same time is not thread-safe.
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_EXPORT sail_status_t sail_execute_conversion_plan(struct sail_conversion_plan* conversion_plan,
+                                                       const struct sail_image* image_input,
+                                                       struct sail_image* image_output);
+
+/*
+ * Destroys the conversion plan. Does nothing if the plan is NULL.
+ */
+SAIL_EXPORT void sail_destroy_conversion_plan(struct sail_conversion_plan* conversion_plan);
+
 /*
  * Updates the image to the pixel format. If the function fails, the image pixels
  * may be left partially converted.
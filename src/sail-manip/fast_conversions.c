@@ -34,13 +34,30 @@
  * These provide significant performance improvements (10-20x) for common conversion pairs.
  */
 
+/* Arguments of the parallel loops. Component indexes not used by a conversion are left zero. */
+struct fast_conversion_context
+{
+    const struct sail_image* image_input;
+    struct sail_image* image_output;
+
+    int r_in;
+    int g_in;
+    int b_in;
+    int a_in;
+    int r_out;
+    int g_out;
+    int b_out;
+    int a_out;
+};
+
 /* RGB24 ↔ BGR24: Simple byte swap */
-static bool fast_convert_rgb24_bgr24(const struct sail_image* image_input, struct sail_image* image_output)
+static sail_status_t fast_convert_rgb24_bgr24_rows(void* context, unsigned row_begin, unsigned row_end)
 {
-    unsigned row;
+    const struct fast_conversion_context* fast_context = context;
+    const struct sail_image* image_input               = fast_context->image_input;
+    struct sail_image* image_output                    = fast_context->image_output;
 
-    SAIL_OMP_PARALLEL_FOR
-    for (row = 0; row < image_input->height; row++)
+    for (unsigned row = row_begin; row < row_end; row++)
     {
         const uint8_t* scan_input = sail_scan_line(image_input, row);
         uint8_t* scan_output      = sail_scan_line(image_output, row);
@@ -56,16 +73,17 @@ static bool fast_convert_rgb24_bgr24(const struct sail_image* image_input, struc
         }
     }
 
-    return true;
+    return SAIL_OK;
 }
 
 /* RGB48 ↔ BGR48: Simple word swap */
-static bool fast_convert_rgb48_bgr48(const struct sail_image* image_input, struct sail_image* image_output)
+static sail_status_t fast_convert_rgb48_bgr48_rows(void* context, unsigned row_begin, unsigned row_end)
 {
-    unsigned row;
+    const struct fast_conversion_context* fast_context = context;
+    const struct sail_image* image_input               = fast_context->image_input;
+    struct sail_image* image_output                    = fast_context->image_output;
 
-    SAIL_OMP_PARALLEL_FOR
-    for (row = 0; row < image_input->height; row++)
+    for (unsigned row = row_begin; row < row_end; row++)
     {
         const uint16_t* scan_input = sail_scan_line(image_input, row);
         uint16_t* scan_output      = sail_scan_line(image_output, row);
@@ -81,218 +99,177 @@ static bool fast_convert_rgb48_bgr48(const struct sail_image* image_input, struc
         }
     }
 
-    return true;
+    return SAIL_OK;
 }
 
 /* RGBA32 variants: RGBA ↔ BGRA, ARGB, ABGR */
-static bool fast_convert_rgba32_variants(const struct sail_image* image_input,
-                                         struct sail_image* image_output,
-                                         int r_in,
-                                         int g_in,
-                                         int b_in,
-                                         int a_in,
-                                         int r_out,
-                                         int g_out,
-                                         int b_out,
-                                         int a_out)
+static sail_status_t fast_convert_rgba32_variants_rows(void* context, unsigned row_begin, unsigned row_end)
 {
-    unsigned row;
+    const struct fast_conversion_context* fast_context = context;
+    const struct sail_image* image_input               = fast_context->image_input;
+    struct sail_image* image_output                    = fast_context->image_output;
 
-    SAIL_OMP_PARALLEL_FOR
-    for (row = 0; row < image_input->height; row++)
+    for (unsigned row = row_begin; row < row_end; row++)
     {
         const uint8_t* scan_input = sail_scan_line(image_input, row);
         uint8_t* scan_output      = sail_scan_line(image_output, row);
 
         for (unsigned column = 0; column < image_input->width; column++)
         {
-            scan_output[r_out] = scan_input[r_in];
-            scan_output[g_out] = scan_input[g_in];
-            scan_output[b_out] = scan_input[b_in];
-            scan_output[a_out] = scan_input[a_in];
+            scan_output[fast_context->r_out] = scan_input[fast_context->r_in];
+            scan_output[fast_context->g_out] = scan_input[fast_context->g_in];
+            scan_output[fast_context->b_out] = scan_input[fast_context->b_in];
+            scan_output[fast_context->a_out] = scan_input[fast_context->a_in];
 
             scan_input  += 4;
             scan_output += 4;
         }
     }
 
-    return true;
+    return SAIL_OK;
 }
 
 /* RGBA64 variants */
-static bool fast_convert_rgba64_variants(const struct sail_image* image_input,
-                                         struct sail_image* image_output,
-                                         int r_in,
-                                         int g_in,
-                                         int b_in,
-                                         int a_in,
-                                         int r_out,
-                                         int g_out,
-                                         int b_out,
-                                         int a_out)
+static sail_status_t fast_convert_rgba64_variants_rows(void* context, unsigned row_begin, unsigned row_end)
 {
-    unsigned row;
+    const struct fast_conversion_context* fast_context = context;
+    const struct sail_image* image_input               = fast_context->image_input;
+    struct sail_image* image_output                    = fast_context->image_output;
 
-    SAIL_OMP_PARALLEL_FOR
-    for (row = 0; row < image_input->height; row++)
+    for (unsigned row = row_begin; row < row_end; row++)
     {
         const uint16_t* scan_input = sail_scan_line(image_input, row);
         uint16_t* scan_output      = sail_scan_line(image_output, row);
 
         for (unsigned column = 0; column < image_input->width; column++)
         {
-            scan_output[r_out] = scan_input[r_in];
-            scan_output[g_out] = scan_input[g_in];
-            scan_output[b_out] = scan_input[b_in];
-            scan_output[a_out] = scan_input[a_in];
+            scan_output[fast_context->r_out] = scan_input[fast_context->r_in];
+            scan_output[fast_context->g_out] = scan_input[fast_context->g_in];
+            scan_output[fast_context->b_out] = scan_input[fast_context->b_in];
+            scan_output[fast_context->a_out] = scan_input[fast_context->a_in];
 
             scan_input  += 4;
             scan_output += 4;
         }
     }
 
-    return true;
+    return SAIL_OK;
 }
 
 /* RGBA32 → RGB24: Drop alpha channel */
-static bool fast_convert_rgba32_to_rgb24(const struct sail_image* image_input,
-                                         struct sail_image* image_output,
-                                         int r_in,
-                                         int g_in,
-                                         int b_in,
-                                         int r_out,
-                                         int g_out,
-                                         int b_out)
+static sail_status_t fast_convert_rgba32_to_rgb24_rows(void* context, unsigned row_begin, unsigned row_end)
 {
-    unsigned row;
+    const struct fast_conversion_context* fast_context = context;
+    const struct sail_image* image_input               = fast_context->image_input;
+    struct sail_image* image_output                    = fast_context->image_output;
 
-    SAIL_OMP_PARALLEL_FOR
-    for (row = 0; row < image_input->height; row++)
+    for (unsigned row = row_begin; row < row_end; row++)
     {
         const uint8_t* scan_input = sail_scan_line(image_input, row);
         uint8_t* scan_output      = sail_scan_line(image_output, row);
 
         for (unsigned column = 0; column < image_input->width; column++)
         {
-            scan_output[r_out] = scan_input[r_in];
-            scan_output[g_out] = scan_input[g_in];
-            scan_output[b_out] = scan_input[b_in];
+            scan_output[fast_context->r_out] = scan_input[fast_context->r_in];
+            scan_output[fast_context->g_out] = scan_input[fast_context->g_in];
+            scan_output[fast_context->b_out] = scan_input[fast_context->b_in];
 
             scan_input  += 4;
             scan_output += 3;
         }
     }
 
-    return true;
+    return SAIL_OK;
 }
 
 /* RGBA64 → RGB48: Drop alpha channel */
-static bool fast_convert_rgba64_to_rgb48(const struct sail_image* image_input,
-                                         struct sail_image* image_output,
-                                         int r_in,
-                                         int g_in,
-                                         int b_in,
-                                         int r_out,
-                                         int g_out,
-                                         int b_out)
+static sail_status_t fast_convert_rgba64_to_rgb48_rows(void* context, unsigned row_begin, unsigned row_end)
 {
-    unsigned row;
+    const struct fast_conversion_context* fast_context = context;
+    const struct sail_image* image_input               = fast_context->image_input;
+    struct sail_image* image_output                    = fast_context->image_output;
 
-    SAIL_OMP_PARALLEL_FOR
-    for (row = 0; row < image_input->height; row++)
+    for (unsigned row = row_begin; row < row_end; row++)
     {
         const uint16_t* scan_input = sail_scan_line(image_input, row);
         uint16_t* scan_output      = sail_scan_line(image_output, row);
 
         for (unsigned column = 0; column < image_input->width; column++)
         {
-            scan_output[r_out] = scan_input[r_in];
-            scan_output[g_out] = scan_input[g_in];
-            scan_output[b_out] = scan_input[b_in];
+            scan_output[fast_context->r_out] = scan_input[fast_context->r_in];
+            scan_output[fast_context->g_out] = scan_input[fast_context->g_in];
+            scan_output[fast_context->b_out] = scan_input[fast_context->b_in];
 
             scan_input  += 4;
             scan_output += 3;
         }
     }
 
-    return true;
+    return SAIL_OK;
 }
 
 /* RGB24 → RGBA32: Add opaque alpha */
-static bool fast_convert_rgb24_to_rgba32(const struct sail_image* image_input,
-                                         struct sail_image* image_output,
-                                         int r_in,
-                                         int g_in,
-                                         int b_in,
-                                         int r_out,
-                                         int g_out,
-                                         int b_out,
-                                         int a_out)
+static sail_status_t fast_convert_rgb24_to_rgba32_rows(void* context, unsigned row_begin, unsigned row_end)
 {
-    unsigned row;
+    const struct fast_conversion_context* fast_context = context;
+    const struct sail_image* image_input               = fast_context->image_input;
+    struct sail_image* image_output                    = fast_context->image_output;
 
-    SAIL_OMP_PARALLEL_FOR
-    for (row = 0; row < image_input->height; row++)
+    for (unsigned row = row_begin; row < row_end; row++)
     {
         const uint8_t* scan_input = sail_scan_line(image_input, row);
         uint8_t* scan_output      = sail_scan_line(image_output, row);
 
         for (unsigned column = 0; column < image_input->width; column++)
         {
-            scan_output[r_out] = scan_input[r_in];
-            scan_output[g_out] = scan_input[g_in];
-            scan_output[b_out] = scan_input[b_in];
-            scan_output[a_out] = 255; /* Opaque */
+            scan_output[fast_context->r_out] = scan_input[fast_context->r_in];
+            scan_output[fast_context->g_out] = scan_input[fast_context->g_in];
+            scan_output[fast_context->b_out] = scan_input[fast_context->b_in];
+            scan_output[fast_context->a_out] = 255; /* Opaque */
 
             scan_input  += 3;
             scan_output += 4;
         }
     }
 
-    return true;
+    return SAIL_OK;
 }
 
 /* RGB48 → RGBA64: Add opaque alpha */
-static bool fast_convert_rgb48_to_rgba64(const struct sail_image* image_input,
-                                         struct sail_image* image_output,
-                                         int r_in,
-                                         int g_in,
-                                         int b_in,
-                                         int r_out,
-                                         int g_out,
-                                         int b_out,
-                                         int a_out)
+static sail_status_t fast_convert_rgb48_to_rgba64_rows(void* context, unsigned row_begin, unsigned row_end)
 {
-    unsigned row;
+    const struct fast_conversion_context* fast_context = context;
+    const struct sail_image* image_input               = fast_context->image_input;
+    struct sail_image* image_output                    = fast_context->image_output;
 
-    SAIL_OMP_PARALLEL_FOR
-    for (row = 0; row < image_input->height; row++)
+    for (unsigned row = row_begin; row < row_end; row++)
     {
         const uint16_t* scan_input = sail_scan_line(image_input, row);
         uint16_t* scan_output      = sail_scan_line(image_output, row);
 
         for (unsigned column = 0; column < image_input->width; column++)
         {
-            scan_output[r_out] = scan_input[r_in];
-            scan_output[g_out] = scan_input[g_in];
-            scan_output[b_out] = scan_input[b_in];
-            scan_output[a_out] = 65535; /* Opaque */
+            scan_output[fast_context->r_out] = scan_input[fast_context->r_in];
+            scan_output[fast_context->g_out] = scan_input[fast_context->g_in];
+            scan_output[fast_context->b_out] = scan_input[fast_context->b_in];
+            scan_output[fast_context->a_out] = 65535; /* Opaque */
 
             scan_input  += 3;
             scan_output += 4;
         }
     }
 
-    return true;
+    return SAIL_OK;
 }
 
 /* RGB555 ↔ BGR555: Swap color bits */
-static bool fast_convert_rgb555_bgr555(const struct sail_image* image_input, struct sail_image* image_output)
+static sail_status_t fast_convert_rgb555_bgr555_rows(void* context, unsigned row_begin, unsigned row_end)
 {
-    unsigned row;
+    const struct fast_conversion_context* fast_context = context;
+    const struct sail_image* image_input               = fast_context->image_input;
+    struct sail_image* image_output                    = fast_context->image_output;
 
-    SAIL_OMP_PARALLEL_FOR
-    for (row = 0; row < image_input->height; row++)
+    for (unsigned row = row_begin; row < row_end; row++)
     {
         const uint16_t* scan_input = sail_scan_line(image_input, row);
         uint16_t* scan_output      = sail_scan_line(image_output, row);
@@ -307,16 +284,17 @@ static bool fast_convert_rgb555_bgr555(const struct sail_image* image_input, str
         }
     }
 
-    return true;
+    return SAIL_OK;
 }
 
 /* RGB565 ↔ BGR565: Swap color bits */
-static bool fast_convert_rgb565_bgr565(const struct sail_image* image_input, struct sail_image* image_output)
+static sail_status_t fast_convert_rgb565_bgr565_rows(void* context, unsigned row_begin, unsigned row_end)
 {
-    unsigned row;
+    const struct fast_conversion_context* fast_context = context;
+    const struct sail_image* image_input               = fast_context->image_input;
+    struct sail_image* image_output                    = fast_context->image_output;
 
-    SAIL_OMP_PARALLEL_FOR
-    for (row = 0; row < image_input->height; row++)
+    for (unsigned row = row_begin; row < row_end; row++)
     {
         const uint16_t* scan_input = sail_scan_line(image_input, row);
         uint16_t* scan_output      = sail_scan_line(image_output, row);
@@ -331,12 +309,25 @@ static bool fast_convert_rgb565_bgr565(const struct sail_image* image_input, str
         }
     }
 
-    return true;
+    return SAIL_OK;
 }
 
 /* Identical format: direct memcpy */
 static bool fast_convert_identical(const struct sail_image* image_input, struct sail_image* image_output)
 {
+    /* Strides differ when the input scan lines are padded. Copy only the pixel data of every row. */
+    if (image_input->bytes_per_line != image_output->bytes_per_line)
+    {
+        const unsigned row_size = sail_bytes_per_line(image_input->width, image_input->pixel_format);
+
+        for (unsigned row = 0; row < image_input->height; row++)
+        {
+            memcpy(sail_scan_line(image_output, row), sail_scan_line(image_input, row), row_size);
+        }
+
+        return true;
+    }
+
     size_t total_size;
 
     if (sail_pixels_buffer_size(image_input->height, image_input->bytes_per_line, &total_size) != SAIL_OK)
@@ -349,225 +340,291 @@ static bool fast_convert_identical(const struct sail_image* image_input, struct
     return true;
 }
 
-/* Main fast-path dispatcher */
-bool sail_try_fast_conversion(const struct sail_image* image_input,
-                              struct sail_image* image_output,
-                              enum SailPixelFormat output_pixel_format)
+/* Component indexes not used by the rows function are zero. */
+static bool set_fast_conversion(struct sail_fast_conversion* fast_conversion,
+                                sail_parallel_rows_func_t rows,
+                                int r_in,
+                                int g_in,
+                                int b_in,
+                                int a_in,
+                                int r_out,
+                                int g_out,
+                                int b_out,
+                                int a_out)
 {
-    const enum SailPixelFormat input_format = image_input->pixel_format;
+    fast_conversion->rows  = rows;
+    fast_conversion->r_in  = r_in;
+    fast_conversion->g_in  = g_in;
+    fast_conversion->b_in  = b_in;
+    fast_conversion->a_in  = a_in;
+    fast_conversion->r_out = r_out;
+    fast_conversion->g_out = g_out;
+    fast_conversion->b_out = b_out;
+    fast_conversion->a_out = a_out;
 
+    return true;
+}
+
+/* Main fast-path dispatcher */
+bool sail_prepare_fast_conversion(enum SailPixelFormat input_pixel_format,
+                                  enum SailPixelFormat output_pixel_format,
+                                  struct sail_fast_conversion* fast_conversion)
+{
     /* Fast-path 1: Identical formats - just memcpy */
-    if (input_format == output_pixel_format)
+    if (input_pixel_format == output_pixel_format)
     {
-        return fast_convert_identical(image_input, image_output);
+        return set_fast_conversion(fast_conversion, NULL, 0, 0, 0, 0, 0, 0, 0, 0);
     }
 
     /* Fast-path 2: RGB24 ↔ BGR24 */
-    if ((input_format == SAIL_PIXEL_FORMAT_BPP24_RGB && output_pixel_format == SAIL_PIXEL_FORMAT_BPP24_BGR)
-        || (input_format == SAIL_PIXEL_FORMAT_BPP24_BGR && output_pixel_format == SAIL_PIXEL_FORMAT_BPP24_RGB))
+    if ((input_pixel_format == SAIL_PIXEL_FORMAT_BPP24_RGB && output_pixel_format == SAIL_PIXEL_FORMAT_BPP24_BGR)
+        || (input_pixel_format == SAIL_PIXEL_FORMAT_BPP24_BGR && output_pixel_format == SAIL_PIXEL_FORMAT_BPP24_RGB))
     {
-        return fast_convert_rgb24_bgr24(image_input, image_output);
+        return set_fast_conversion(fast_conversion, fast_convert_rgb24_bgr24_rows, 0, 0, 0, 0, 0, 0, 0, 0);
     }
 
     /* Fast-path 3: RGB48 ↔ BGR48 */
-    if ((input_format == SAIL_PIXEL_FORMAT_BPP48_RGB && output_pixel_format == SAIL_PIXEL_FORMAT_BPP48_BGR)
-        || (input_format == SAIL_PIXEL_FORMAT_BPP48_BGR && output_pixel_format == SAIL_PIXEL_FORMAT_BPP48_RGB))
+    if ((input_pixel_format == SAIL_PIXEL_FORMAT_BPP48_RGB && output_pixel_format == SAIL_PIXEL_FORMAT_BPP48_BGR)
+        || (input_pixel_format == SAIL_PIXEL_FORMAT_BPP48_BGR && output_pixel_format == SAIL_PIXEL_FORMAT_BPP48_RGB))
     {
-        return fast_convert_rgb48_bgr48(image_input, image_output);
+        return set_fast_conversion(fast_conversion, fast_convert_rgb48_bgr48_rows, 0, 0, 0, 0, 0, 0, 0, 0);
     }
 
     /* Fast-path 4: RGBA32 ↔ BGRA32 */
-    if ((input_format == SAIL_PIXEL_FORMAT_BPP32_RGBA && output_pixel_format == SAIL_PIXEL_FORMAT_BPP32_BGRA)
-        || (input_format == SAIL_PIXEL_FORMAT_BPP32_BGRA && output_pixel_format == SAIL_PIXEL_FORMAT_BPP32_RGBA))
+    if ((input_pixel_format == SAIL_PIXEL_FORMAT_BPP32_RGBA && output_pixel_format == SAIL_PIXEL_FORMAT_BPP32_BGRA)
+        || (input_pixel_format == SAIL_PIXEL_FORMAT_BPP32_BGRA && output_pixel_format == SAIL_PIXEL_FORMAT_BPP32_RGBA))
     {
-        return fast_convert_rgba32_variants(image_input, image_output, 0, 1, 2, 3, 2, 1, 0, 3);
+        return set_fast_conversion(fast_conversion, fast_convert_rgba32_variants_rows, 0, 1, 2, 3, 2, 1, 0, 3);
     }
 
     /* Fast-path 5: RGBA32 ↔ ARGB32 */
-    if ((input_format == SAIL_PIXEL_FORMAT_BPP32_RGBA && output_pixel_format == SAIL_PIXEL_FORMAT_BPP32_ARGB)
-        || (input_format == SAIL_PIXEL_FORMAT_BPP32_ARGB && output_pixel_format == SAIL_PIXEL_FORMAT_BPP32_RGBA))
+    if ((input_pixel_format == SAIL_PIXEL_FORMAT_BPP32_RGBA && output_pixel_format == SAIL_PIXEL_FORMAT_BPP32_ARGB)
+        || (input_pixel_format == SAIL_PIXEL_FORMAT_BPP32_ARGB && output_pixel_format == SAIL_PIXEL_FORMAT_BPP32_RGBA))
     {
-        return fast_convert_rgba32_variants(image_input, image_output, 0, 1, 2, 3, 1, 2, 3, 0);
+        return set_fast_conversion(fast_conversion, fast_convert_rgba32_variants_rows, 0, 1, 2, 3, 1, 2, 3, 0);
     }
 
     /* Fast-path 6: RGBA32 ↔ ABGR32 */
-    if ((input_format == SAIL_PIXEL_FORMAT_BPP32_RGBA && output_pixel_format == SAIL_PIXEL_FORMAT_BPP32_ABGR)
-        || (input_format == SAIL_PIXEL_FORMAT_BPP32_ABGR && output_pixel_format == SAIL_PIXEL_FORMAT_BPP32_RGBA))
+    if ((input_pixel_format == SAIL_PIXEL_FORMAT_BPP32_RGBA && output_pixel_format == SAIL_PIXEL_FORMAT_BPP32_ABGR)
+        || (input_pixel_format == SAIL_PIXEL_FORMAT_BPP32_ABGR && output_pixel_format == SAIL_PIXEL_FORMAT_BPP32_RGBA))
     {
-        return fast_convert_rgba32_variants(image_input, image_output, 0, 1, 2, 3, 3, 2, 1, 0);
+        return set_fast_conversion(fast_conversion, fast_convert_rgba32_variants_rows, 0, 1, 2, 3, 3, 2, 1, 0);
     }
 
     /* Fast-path 7: BGRA32 ↔ ARGB32 */
-    if ((input_format == SAIL_PIXEL_FORMAT_BPP32_BGRA && output_pixel_format == SAIL_PIXEL_FORMAT_BPP32_ARGB)
-        || (input_format == SAIL_PIXEL_FORMAT_BPP32_ARGB && output_pixel_format == SAIL_PIXEL_FORMAT_BPP32_BGRA))
+    if ((input_pixel_format == SAIL_PIXEL_FORMAT_BPP32_BGRA && output_pixel_format == SAIL_PIXEL_FORMAT_BPP32_ARGB)
+        || (input_pixel_format == SAIL_PIXEL_FORMAT_BPP32_ARGB && output_pixel_format == SAIL_PIXEL_FORMAT_BPP32_BGRA))
     {
-        return fast_convert_rgba32_variants(image_input, image_output, 2, 1, 0, 3, 1, 2, 3, 0);
+        return set_fast_conversion(fast_conversion, fast_convert_rgba32_variants_rows, 2, 1, 0, 3, 1, 2, 3, 0);
     }
 
     /* Fast-path 8: BGRA32 ↔ ABGR32 */
-    if ((input_format == SAIL_PIXEL_FORMAT_BPP32_BGRA && output_pixel_format == SAIL_PIXEL_FORMAT_BPP32_ABGR)
-        || (input_format == SAIL_PIXEL_FORMAT_BPP32_ABGR && output_pixel_format == SAIL_PIXEL_FORMAT_BPP32_BGRA))
+    if ((input_pixel_format == SAIL_PIXEL_FORMAT_BPP32_BGRA && output_pixel_format == SAIL_PIXEL_FORMAT_BPP32_ABGR)
+        || (input_pixel_format == SAIL_PIXEL_FORMAT_BPP32_ABGR && output_pixel_format == SAIL_PIXEL_FORMAT_BPP32_BGRA))
     {
-        return fast_convert_rgba32_variants(image_input, image_output, 2, 1, 0, 3, 3, 2, 1, 0);
+        return set_fast_conversion(fast_conversion, fast_convert_rgba32_variants_rows, 2, 1, 0, 3, 3, 2, 1, 0);
     }
 
     /* Fast-path 9: RGBA64 ↔ BGRA64 */
-    if ((input_format == SAIL_PIXEL_FORMAT_BPP64_RGBA && output_pixel_format == SAIL_PIXEL_FORMAT_BPP64_BGRA)
-        || (input_format == SAIL_PIXEL_FORMAT_BPP64_BGRA && output_pixel_format == SAIL_PIXEL_FORMAT_BPP64_RGBA))
+    if ((input_pixel_format == SAIL_PIXEL_FORMAT_BPP64_RGBA && output_pixel_format == SAIL_PIXEL_FORMAT_BPP64_BGRA)
+        || (input_pixel_format == SAIL_PIXEL_FORMAT_BPP64_BGRA && output_pixel_format == SAIL_PIXEL_FORMAT_BPP64_RGBA))
     {
-        return fast_convert_rgba64_variants(image_input, image_output, 0, 1, 2, 3, 2, 1, 0, 3);
+        return set_fast_conversion(fast_conversion, fast_convert_rgba64_variants_rows, 0, 1, 2, 3, 2, 1, 0, 3);
     }
 
     /* Fast-path 10: RGBA64 ↔ ARGB64 */
-    if ((input_format == SAIL_PIXEL_FORMAT_BPP64_RGBA && output_pixel_format == SAIL_PIXEL_FORMAT_BPP64_ARGB)
-        || (input_format == SAIL_PIXEL_FORMAT_BPP64_ARGB && output_pixel_format == SAIL_PIXEL_FORMAT_BPP64_RGBA))
+    if ((input_pixel_format == SAIL_PIXEL_FORMAT_BPP64_RGBA && output_pixel_format == SAIL_PIXEL_FORMAT_BPP64_ARGB)
+        || (input_pixel_format == SAIL_PIXEL_FORMAT_BPP64_ARGB && output_pixel_format == SAIL_PIXEL_FORMAT_BPP64_RGBA))
     {
-        return fast_convert_rgba64_variants(image_input, image_output, 0, 1, 2, 3, 1, 2, 3, 0);
+        return set_fast_conversion(fast_conversion, fast_convert_rgba64_variants_rows, 0, 1, 2, 3, 1, 2, 3, 0);
     }
 
     /* Fast-path 11: RGBA64 ↔ ABGR64 */
-    if ((input_format == SAIL_PIXEL_FORMAT_BPP64_RGBA && output_pixel_format == SAIL_PIXEL_FORMAT_BPP64_ABGR)
-        || (input_format == SAIL_PIXEL_FORMAT_BPP64_ABGR && output_pixel_format == SAIL_PIXEL_FORMAT_BPP64_RGBA))
+    if ((input_pixel_format == SAIL_PIXEL_FORMAT_BPP64_RGBA && output_pixel_format == SAIL_PIXEL_FORMAT_BPP64_ABGR)
+        || (input_pixel_format == SAIL_PIXEL_FORMAT_BPP64_ABGR && output_pixel_format == SAIL_PIXEL_FORMAT_BPP64_RGBA))
     {
-        return fast_convert_rgba64_variants(image_input, image_output, 0, 1, 2, 3, 3, 2, 1, 0);
+        return set_fast_conversion(fast_conversion, fast_convert_rgba64_variants_rows, 0, 1, 2, 3, 3, 2, 1, 0);
     }
 
     /* Fast-path 12: BGRA64 ↔ ARGB64 */
-    if ((input_format == SAIL_PIXEL_FORMAT_BPP64_BGRA && output_pixel_format == SAIL_PIXEL_FORMAT_BPP64_ARGB)
-        || (input_format == SAIL_PIXEL_FORMAT_BPP64_ARGB && output_pixel_format == SAIL_PIXEL_FORMAT_BPP64_BGRA))
+    if ((input_pixel_format == SAIL_PIXEL_FORMAT_BPP64_BGRA && output_pixel_format == SAIL_PIXEL_FORMAT_BPP64_ARGB)
+        || (input_pixel_format == SAIL_PIXEL_FORMAT_BPP64_ARGB && output_pixel_format == SAIL_PIXEL_FORMAT_BPP64_BGRA))
     {
-        return fast_convert_rgba64_variants(image_input, image_output, 2, 1, 0, 3, 1, 2, 3, 0);
+        return set_fast_conversion(fast_conversion, fast_convert_rgba64_variants_rows, 2, 1, 0, 3, 1, 2, 3, 0);
     }
 
     /* Fast-path 13: BGRA64 ↔ ABGR64 */
-    if ((input_format == SAIL_PIXEL_FORMAT_BPP64_BGRA && output_pixel_format == SAIL_PIXEL_FORMAT_BPP64_ABGR)
-        || (input_format == SAIL_PIXEL_FORMAT_BPP64_ABGR && output_pixel_format == SAIL_PIXEL_FORMAT_BPP64_BGRA))
+    if ((input_pixel_format == SAIL_PIXEL_FORMAT_BPP64_BGRA && output_pixel_format == SAIL_PIXEL_FORMAT_BPP64_ABGR)
+        || (input_pixel_format == SAIL_PIXEL_FORMAT_BPP64_ABGR && output_pixel_format == SAIL_PIXEL_FORMAT_BPP64_BGRA))
     {
-        return fast_convert_rgba64_variants(image_input, image_output, 2, 1, 0, 3, 3, 2, 1, 0);
+        return set_fast_conversion(fast_conversion, fast_convert_rgba64_variants_rows, 2, 1, 0, 3, 3, 2, 1, 0);
     }
 
     /* Fast-path 14: RGBA32 → RGB24 */
-    if (input_format == SAIL_PIXEL_FORMAT_BPP32_RGBA && output_pixel_format == SAIL_PIXEL_FORMAT_BPP24_RGB)
+    if (input_pixel_format == SAIL_PIXEL_FORMAT_BPP32_RGBA && output_pixel_format == SAIL_PIXEL_FORMAT_BPP24_RGB)
     {
-        return fast_convert_rgba32_to_rgb24(image_input, image_output, 0, 1, 2, 0, 1, 2);
+        return set_fast_conversion(fast_conversion, fast_convert_rgba32_to_rgb24_rows, 0, 1, 2, 0, 0, 1, 2, 0);
     }
 
     /* Fast-path 15: RGBA32 → BGR24 */
-    if (input_format == SAIL_PIXEL_FORMAT_BPP32_RGBA && output_pixel_format == SAIL_PIXEL_FORMAT_BPP24_BGR)
+    if (input_pixel_format == SAIL_PIXEL_FORMAT_BPP32_RGBA && output_pixel_format == SAIL_PIXEL_FORMAT_BPP24_BGR)
     {
-        return fast_convert_rgba32_to_rgb24(image_input, image_output, 0, 1, 2, 2, 1, 0);
+        return set_fast_conversion(fast_conversion, fast_convert_rgba32_to_rgb24_rows, 0, 1, 2, 0, 2, 1, 0, 0);
     }
 
     /* Fast-path 16: BGRA32 → RGB24 */
-    if (input_format == SAIL_PIXEL_FORMAT_BPP32_BGRA && output_pixel_format == SAIL_PIXEL_FORMAT_BPP24_RGB)
+    if (input_pixel_format == SAIL_PIXEL_FORMAT_BPP32_BGRA && output_pixel_format == SAIL_PIXEL_FORMAT_BPP24_RGB)
     {
-        return fast_convert_rgba32_to_rgb24(image_input, image_output, 2, 1, 0, 0, 1, 2);
+        return set_fast_conversion(fast_conversion, fast_convert_rgba32_to_rgb24_rows, 2, 1, 0, 0, 0, 1, 2, 0);
     }
 
     /* Fast-path 17: BGRA32 → BGR24 */
-    if (input_format == SAIL_PIXEL_FORMAT_BPP32_BGRA && output_pixel_format == SAIL_PIXEL_FORMAT_BPP24_BGR)
+    if (input_pixel_format == SAIL_PIXEL_FORMAT_BPP32_BGRA && output_pixel_format == SAIL_PIXEL_FORMAT_BPP24_BGR)
     {
-        return fast_convert_rgba32_to_rgb24(image_input, image_output, 2, 1, 0, 2, 1, 0);
+        return set_fast_conversion(fast_conversion, fast_convert_rgba32_to_rgb24_rows, 2, 1, 0, 0, 2, 1, 0, 0);
     }
 
     /* Fast-path 18: ARGB32 → RGB24 */
-    if (input_format == SAIL_PIXEL_FORMAT_BPP32_ARGB && output_pixel_format == SAIL_PIXEL_FORMAT_BPP24_RGB)
+    if (input_pixel_format == SAIL_PIXEL_FORMAT_BPP32_ARGB && output_pixel_format == SAIL_PIXEL_FORMAT_BPP24_RGB)
     {
-        return fast_convert_rgba32_to_rgb24(image_input, image_output, 1, 2, 3, 0, 1, 2);
+        return set_fast_conversion(fast_conversion, fast_convert_rgba32_to_rgb24_rows, 1, 2, 3, 0, 0, 1, 2, 0);
     }
 
     /* Fast-path 19: ABGR32 → BGR24 */
-    if (input_format == SAIL_PIXEL_FORMAT_BPP32_ABGR && output_pixel_format == SAIL_PIXEL_FORMAT_BPP24_BGR)
+    if (input_pixel_format == SAIL_PIXEL_FORMAT_BPP32_ABGR && output_pixel_format == SAIL_PIXEL_FORMAT_BPP24_BGR)
     {
-        return fast_convert_rgba32_to_rgb24(image_input, image_output, 3, 2, 1, 2, 1, 0);
+        return set_fast_conversion(fast_conversion, fast_convert_rgba32_to_rgb24_rows, 3, 2, 1, 0, 2, 1, 0, 0);
     }
 
     /* Fast-path 20: RGBA64 → RGB48 */
-    if (input_format == SAIL_PIXEL_FORMAT_BPP64_RGBA && output_pixel_format == SAIL_PIXEL_FORMAT_BPP48_RGB)
+    if (input_pixel_format == SAIL_PIXEL_FORMAT_BPP64_RGBA && output_pixel_format == SAIL_PIXEL_FORMAT_BPP48_RGB)
     {
-        return fast_convert_rgba64_to_rgb48(image_input, image_output, 0, 1, 2, 0, 1, 2);
+        return set_fast_conversion(fast_conversion, fast_convert_rgba64_to_rgb48_rows, 0, 1, 2, 0, 0, 1, 2, 0);
     }
 
     /* Fast-path 21: RGBA64 → BGR48 */
-    if (input_format == SAIL_PIXEL_FORMAT_BPP64_RGBA && output_pixel_format == SAIL_PIXEL_FORMAT_BPP48_BGR)
+    if (input_pixel_format == SAIL_PIXEL_FORMAT_BPP64_RGBA && output_pixel_format == SAIL_PIXEL_FORMAT_BPP48_BGR)
     {
-        return fast_convert_rgba64_to_rgb48(image_input, image_output, 0, 1, 2, 2, 1, 0);
+        return set_fast_conversion(fast_conversion, fast_convert_rgba64_to_rgb48_rows, 0, 1, 2, 0, 2, 1, 0, 0);
     }
 
     /* Fast-path 22: BGRA64 → RGB48 */
-    if (input_format == SAIL_PIXEL_FORMAT_BPP64_BGRA && output_pixel_format == SAIL_PIXEL_FORMAT_BPP48_RGB)
+    if (input_pixel_format == SAIL_PIXEL_FORMAT_BPP64_BGRA && output_pixel_format == SAIL_PIXEL_FORMAT_BPP48_RGB)
     {
-        return fast_convert_rgba64_to_rgb48(image_input, image_output, 2, 1, 0, 0, 1, 2);
+        return set_fast_conversion(fast_conversion, fast_convert_rgba64_to_rgb48_rows, 2, 1, 0, 0, 0, 1, 2, 0);
     }
 
     /* Fast-path 23: BGRA64 → BGR48 */
-    if (input_format == SAIL_PIXEL_FORMAT_BPP64_BGRA && output_pixel_format == SAIL_PIXEL_FORMAT_BPP48_BGR)
+    if (input_pixel_format == SAIL_PIXEL_FORMAT_BPP64_BGRA && output_pixel_format == SAIL_PIXEL_FORMAT_BPP48_BGR)
     {
-        return fast_convert_rgba64_to_rgb48(image_input, image_output, 2, 1, 0, 2, 1, 0);
+        return set_fast_conversion(fast_conversion, fast_convert_rgba64_to_rgb48_rows, 2, 1, 0, 0, 2, 1, 0, 0);
     }
 
     /* Fast-path 24: RGB24 → RGBA32 */
-    if (input_format == SAIL_PIXEL_FORMAT_BPP24_RGB && output_pixel_format == SAIL_PIXEL_FORMAT_BPP32_RGBA)
+    if (input_pixel_format == SAIL_PIXEL_FORMAT_BPP24_RGB && output_pixel_format == SAIL_PIXEL_FORMAT_BPP32_RGBA)
     {
-        return fast_convert_rgb24_to_rgba32(image_input, image_output, 0, 1, 2, 0, 1, 2, 3);
+        return set_fast_conversion(fast_conversion, fast_convert_rgb24_to_rgba32_rows, 0, 1, 2, 0, 0, 1, 2, 3);
     }
 
     /* Fast-path 25: RGB24 → BGRA32 */
-    if (input_format == SAIL_PIXEL_FORMAT_BPP24_RGB && output_pixel_format == SAIL_PIXEL_FORMAT_BPP32_BGRA)
+    if (input_pixel_format == SAIL_PIXEL_FORMAT_BPP24_RGB && output_pixel_format == SAIL_PIXEL_FORMAT_BPP32_BGRA)
     {
-        return fast_convert_rgb24_to_rgba32(image_input, image_output, 0, 1, 2, 2, 1, 0, 3);
+        return set_fast_conversion(fast_conversion, fast_convert_rgb24_to_rgba32_rows, 0, 1, 2, 0, 2, 1, 0, 3);
     }
 
     /* Fast-path 26: BGR24 → RGBA32 */
-    if (input_format == SAIL_PIXEL_FORMAT_BPP24_BGR && output_pixel_format == SAIL_PIXEL_FORMAT_BPP32_RGBA)
+    if (input_pixel_format == SAIL_PIXEL_FORMAT_BPP24_BGR && output_pixel_format == SAIL_PIXEL_FORMAT_BPP32_RGBA)
     {
-        return fast_convert_rgb24_to_rgba32(image_input, image_output, 2, 1, 0, 0, 1, 2, 3);
+        return set_fast_conversion(fast_conversion, fast_convert_rgb24_to_rgba32_rows, 2, 1, 0, 0, 0, 1, 2, 3);
     }
 
     /* Fast-path 27: BGR24 → BGRA32 */
-    if (input_format == SAIL_PIXEL_FORMAT_BPP24_BGR && output_pixel_format == SAIL_PIXEL_FORMAT_BPP32_BGRA)
+    if (input_pixel_format == SAIL_PIXEL_FORMAT_BPP24_BGR && output_pixel_format == SAIL_PIXEL_FORMAT_BPP32_BGRA)
     {
-        return fast_convert_rgb24_to_rgba32(image_input, image_output, 2, 1, 0, 2, 1, 0, 3);
+        return set_fast_conversion(fast_conversion, fast_convert_rgb24_to_rgba32_rows, 2, 1, 0, 0, 2, 1, 0, 3);
     }
 
     /* Fast-path 28: RGB48 → RGBA64 */
-    if (input_format == SAIL_PIXEL_FORMAT_BPP48_RGB && output_pixel_format == SAIL_PIXEL_FORMAT_BPP64_RGBA)
+    if (input_pixel_format == SAIL_PIXEL_FORMAT_BPP48_RGB && output_pixel_format == SAIL_PIXEL_FORMAT_BPP64_RGBA)
     {
-        return fast_convert_rgb48_to_rgba64(image_input, image_output, 0, 1, 2, 0, 1, 2, 3);
+        return set_fast_conversion(fast_conversion, fast_convert_rgb48_to_rgba64_rows, 0, 1, 2, 0, 0, 1, 2, 3);
     }
 
     /* Fast-path 29: RGB48 → BGRA64 */
-    if (input_format == SAIL_PIXEL_FORMAT_BPP48_RGB && output_pixel_format == SAIL_PIXEL_FORMAT_BPP64_BGRA)
+    if (input_pixel_format == SAIL_PIXEL_FORMAT_BPP48_RGB && output_pixel_format == SAIL_PIXEL_FORMAT_BPP64_BGRA)
     {
-        return fast_convert_rgb48_to_rgba64(image_input, image_output, 0, 1, 2, 2, 1, 0, 3);
+        return set_fast_conversion(fast_conversion, fast_convert_rgb48_to_rgba64_rows, 0, 1, 2, 0, 2, 1, 0, 3);
     }
 
     /* Fast-path 30: BGR48 → RGBA64 */
-    if (input_format == SAIL_PIXEL_FORMAT_BPP48_BGR && output_pixel_format == SAIL_PIXEL_FORMAT_BPP64_RGBA)
+    if (input_pixel_format == SAIL_PIXEL_FORMAT_BPP48_BGR && output_pixel_format == SAIL_PIXEL_FORMAT_BPP64_RGBA)
     {
-        return fast_convert_rgb48_to_rgba64(image_input, image_output, 2, 1, 0, 0, 1, 2, 3);
+        return set_fast_conversion(fast_conversion, fast_convert_rgb48_to_rgba64_rows, 2, 1, 0, 0, 0, 1, 2, 3);
     }
 
     /* Fast-path 31: BGR48 → BGRA64 */
-    if (input_format == SAIL_PIXEL_FORMAT_BPP48_BGR && output_pixel_format == SAIL_PIXEL_FORMAT_BPP64_BGRA)
+    if (input_pixel_format == SAIL_PIXEL_FORMAT_BPP48_BGR && output_pixel_format == SAIL_PIXEL_FORMAT_BPP64_BGRA)
     {
-        return fast_convert_rgb48_to_rgba64(image_input, image_output, 2, 1, 0, 2, 1, 0, 3);
+        return set_fast_conversion(fast_conversion, fast_convert_rgb48_to_rgba64_rows, 2, 1, 0, 0, 2, 1, 0, 3);
     }
 
     /* Fast-path 32: RGB555 ↔ BGR555 */
-    if ((input_format == SAIL_PIXEL_FORMAT_BPP16_RGB555 && output_pixel_format == SAIL_PIXEL_FORMAT_BPP16_BGR555)
-        || (input_format == SAIL_PIXEL_FORMAT_BPP16_BGR555 && output_pixel_format == SAIL_PIXEL_FORMAT_BPP16_RGB555))
+    if ((input_pixel_format == SAIL_PIXEL_FORMAT_BPP16_RGB555 && output_pixel_format == SAIL_PIXEL_FORMAT_BPP16_BGR555)
+        || (input_pixel_format == SAIL_PIXEL_FORMAT_BPP16_BGR555
+            && output_pixel_format == SAIL_PIXEL_FORMAT_BPP16_RGB555))
     {
-        return fast_convert_rgb555_bgr555(image_input, image_output);
+        return set_fast_conversion(fast_conversion, fast_convert_rgb555_bgr555_rows, 0, 0, 0, 0, 0, 0, 0, 0);
     }
 
     /* Fast-path 33: RGB565 ↔ BGR565 */
-    if ((input_format == SAIL_PIXEL_FORMAT_BPP16_RGB565 && output_pixel_format == SAIL_PIXEL_FORMAT_BPP16_BGR565)
-        || (input_format == SAIL_PIXEL_FORMAT_BPP16_BGR565 && output_pixel_format == SAIL_PIXEL_FORMAT_BPP16_RGB565))
+    if ((input_pixel_format == SAIL_PIXEL_FORMAT_BPP16_RGB565 && output_pixel_format == SAIL_PIXEL_FORMAT_BPP16_BGR565)
+        || (input_pixel_format == SAIL_PIXEL_FORMAT_BPP16_BGR565
+            && output_pixel_format == SAIL_PIXEL_FORMAT_BPP16_RGB565))
     {
-        return fast_convert_rgb565_bgr565(image_input, image_output);
+        return set_fast_conversion(fast_conversion, fast_convert_rgb565_bgr565_rows, 0, 0, 0, 0, 0, 0, 0, 0);
     }
 
     /* No fast-path available - use standard conversion */
     return false;
 }
+
+bool sail_execute_fast_conversion(const struct sail_fast_conversion* fast_conversion,
+                                  const struct sail_image* image_input,
+                                  struct sail_image* image_output,
+                                  unsigned max_threads)
+{
+    if (fast_conversion->rows == NULL)
+    {
+        return fast_convert_identical(image_input, image_output);
+    }
+
+    const struct fast_conversion_context fast_context = {
+        .image_input  = image_input,
+        .image_output = image_output,
+        .r_in         = fast_conversion->r_in,
+        .g_in         = fast_conversion->g_in,
+        .b_in         = fast_conversion->b_in,
+        .a_in         = fast_conversion->a_in,
+        .r_out        = fast_conversion->r_out,
+        .g_out        = fast_conversion->g_out,
+        .b_out        = fast_conversion->b_out,
+        .a_out        = fast_conversion->a_out,
+    };
+
+    return sail_parallel_for(image_input->height, max_threads, fast_conversion->rows, (void*)&fast_context) == SAIL_OK;
+}
+
+bool sail_try_fast_conversion(const struct sail_image* image_input,
+                              struct sail_image* image_output,
+                              enum SailPixelFormat output_pixel_format,
+                              unsigned max_threads)
+{
+    struct sail_fast_conversion fast_conversion;
+
+    if (!sail_prepare_fast_conversion(image_input->pixel_format, output_pixel_format, &fast_conversion))
+    {
+        return false;
+    }
+
+    return sail_execute_fast_conversion(&fast_conversion, image_input, image_output, max_threads);
+}
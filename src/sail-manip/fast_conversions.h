@@ -30,6 +30,7 @@
 #include <sail-common/common.h>
 #include <sail-common/export.h>
 #include <sail-common/status.h>
+#include <sail-common/thread_pool.h>
 
 struct sail_image;
 
@@ -39,9 +40,47 @@ struct sail_image;
  * These functions provide optimized conversion paths for common format pairs,
  * bypassing the standard two-step conversion (input → RGBA → output).
  *
+ * The rows are converted in parallel with up to max_threads threads. See sail_parallel_for().
+ *
  * Returns true if fast-path conversion is available and executed successfully.
  * Returns false if no fast-path exists for this conversion pair.
  */
 SAIL_HIDDEN bool sail_try_fast_conversion(const struct sail_image* image_input,
                                           struct sail_image* image_output,
-                                          enum SailPixelFormat output_pixel_format);
+                                          enum SailPixelFormat output_pixel_format,
+                                          unsigned max_threads);
+
+/*
+ * Fast-path conversion chosen for a pair of pixel formats. Conversion plans keep it to convert
+ * many images without looking for the fast path again.
+ */
+struct sail_fast_conversion
+{
+    /* NULL when the pixel formats are identical and the pixels are copied as is. */
+    sail_parallel_rows_func_t rows;
+
+    /* Component indexes of the input and output pixels. */
+    int r_in;
+    int g_in;
+    int b_in;
+    int a_in;
+    int r_out;
+    int g_out;
+    int b_out;
+    int a_out;
+};
+
+/*
+ * Looks for the fast path of the pixel formats. Returns false if no fast path exists.
+ */
+SAIL_HIDDEN bool sail_prepare_fast_conversion(enum SailPixelFormat input_pixel_format,
+                                              enum SailPixelFormat output_pixel_format,
+                                              struct sail_fast_conversion* fast_conversion);
+
+/*
+ * Converts the rows with the prepared fast path. Allocates no memory.
+ */
+SAIL_HIDDEN bool sail_execute_fast_conversion(const struct sail_fast_conversion* fast_conversion,
+                                              const struct sail_image* image_input,
+                                              struct sail_image* image_output,
+                                              unsigned max_threads);
@@ -71,47 +71,41 @@ sail_status_t get_palette_rgba32(const struct sail_palette* palette, unsigned in
     return SAIL_OK;
 }
 
-sail_status_t preconvert_palette_to_rgba32(const struct sail_palette* palette, sail_rgba32_t** rgba32_palette)
+sail_status_t convert_palette_to_rgba32(const struct sail_palette* palette,
+                                        unsigned color_count,
+                                        sail_rgba32_t* rgba32_palette)
 {
     SAIL_CHECK_PTR(palette);
     SAIL_CHECK_PTR(rgba32_palette);
 
-    /* Allocate array for pre-converted palette */
-    void* ptr;
-    SAIL_TRY(sail_malloc(palette->color_count * sizeof(sail_rgba32_t), &ptr));
-    *rgba32_palette = (sail_rgba32_t*)ptr;
+    const uint8_t* src = (const uint8_t*)palette->data;
 
-    /* Convert palette format once */
     switch (palette->pixel_format)
     {
     case SAIL_PIXEL_FORMAT_BPP24_RGB:
     {
-        const uint8_t* src = (const uint8_t*)palette->data;
-        for (unsigned i = 0; i < palette->color_count; i++)
+        for (unsigned i = 0; i < color_count; i++)
         {
-            (*rgba32_palette)[i].component1 = *src++;
-            (*rgba32_palette)[i].component2 = *src++;
-            (*rgba32_palette)[i].component3 = *src++;
-            (*rgba32_palette)[i].component4 = 255;
+            rgba32_palette[i].component1 = *src++;
+            rgba32_palette[i].component2 = *src++;
+            rgba32_palette[i].component3 = *src++;
+            rgba32_palette[i].component4 = 255;
         }
         break;
     }
     case SAIL_PIXEL_FORMAT_BPP32_RGBA:
     {
-        const uint8_t* src = (const uint8_t*)palette->data;
-        for (unsigned i = 0; i < palette->color_count; i++)
+        for (unsigned i = 0; i < color_count; i++)
         {
-            (*rgba32_palette)[i].component1 = *src++;
-            (*rgba32_palette)[i].component2 = *src++;
-            (*rgba32_palette)[i].component3 = *src++;
-            (*rgba32_palette)[i].component4 = *src++;
+            rgba32_palette[i].component1 = *src++;
+            rgba32_palette[i].component2 = *src++;
+            rgba32_palette[i].component3 = *src++;
+            rgba32_palette[i].component4 = *src++;
         }
         break;
     }
     default:
     {
-        sail_free(*rgba32_palette);
-        *rgba32_palette = NULL;
         SAIL_LOG_ERROR("Palette pixel format %s is not currently supported",
                        sail_pixel_format_to_string(palette->pixel_format));
         SAIL_LOG_AND_RETURN(SAIL_ERROR_UNSUPPORTED_PIXEL_FORMAT);
@@ -121,6 +115,24 @@ sail_status_t preconvert_palette_to_rgba32(const struct sail_palette* palette, s
     return SAIL_OK;
 }
 
+sail_status_t preconvert_palette_to_rgba32(const struct sail_palette* palette, sail_rgba32_t** rgba32_palette)
+{
+    SAIL_CHECK_PTR(palette);
+    SAIL_CHECK_PTR(rgba32_palette);
+
+    /* Allocate array for pre-converted palette */
+    void* ptr;
+    SAIL_TRY(sail_malloc(palette->color_count * sizeof(sail_rgba32_t), &ptr));
+
+    /* Convert palette format once */
+    SAIL_TRY_OR_CLEANUP(convert_palette_to_rgba32(palette, palette->color_count, ptr),
+                        /* cleanup */ sail_free(ptr));
+
+    *rgba32_palette = (sail_rgba32_t*)ptr;
+
+    return SAIL_OK;
+}
+
 void spread_gray8_to_rgba32(uint8_t value, sail_rgba32_t* rgba32)
 {
     rgba32->component1 = rgba32->component2 = rgba32->component3 = value;
@@ -356,6 +368,11 @@ void fill_rgba32_pixel_from_uint8_values(const sail_rgba32_t* rgba32,
     {
         *(scan + a) = rgba32->component4;
     }
+    else
+    {
+        /* Padding byte of RGBX-like formats. R, G, B, and X indexes are a permutation of 0..3. */
+        *(scan + 6 - r - g - b) = 255;
+    }
 }
 
 void fill_rgba32_pixel_from_uint16_values(const sail_rgba64_t* rgba64,
@@ -389,6 +406,10 @@ void fill_rgba32_pixel_from_uint16_values(const sail_rgba64_t* rgba64,
     {
         *(scan + a) = SAIL_COMPONENT_16_TO_8(rgba64->component4);
     }
+    else
+    {
+        *(scan + 6 - r - g - b) = 255;
+    }
 }
 
 void fill_rgba64_pixel_from_uint8_values(const sail_rgba32_t* rgba32,
@@ -421,6 +442,10 @@ void fill_rgba64_pixel_from_uint8_values(const sail_rgba32_t* rgba32,
     {
         *(scan + a) = SAIL_COMPONENT_8_TO_16(rgba32->component4);
     }
+    else
+    {
+        *(scan + 6 - r - g - b) = 65535;
+    }
 }
 
 void fill_rgba64_pixel_from_uint16_values(const sail_rgba64_t* rgba64,
@@ -451,6 +476,10 @@ void fill_rgba64_pixel_from_uint16_values(const sail_rgba64_t* rgba64,
     {
         *(scan + a) = rgba64->component4;
     }
+    else
+    {
+        *(scan + 6 - r - g - b) = 65535;
+    }
 }
 
 void fill_ycbcr_pixel_from_uint8_values(const sail_rgba32_t* rgba32,
@@ -36,6 +36,11 @@ struct sail_palette;
 
 SAIL_HIDDEN sail_status_t get_palette_rgba32(const struct sail_palette* palette, unsigned index, sail_rgba32_t* rgba32);
 
+/* Converts the first color_count palette colors into the RGBA32 array. */
+SAIL_HIDDEN sail_status_t convert_palette_to_rgba32(const struct sail_palette* palette,
+                                                    unsigned color_count,
+                                                    sail_rgba32_t* rgba32_palette);
+
 SAIL_HIDDEN sail_status_t preconvert_palette_to_rgba32(const struct sail_palette* palette, sail_rgba32_t** rgba32_palette);
 
 SAIL_HIDDEN void spread_gray8_to_rgba32(uint8_t value, sail_rgba32_t* rgba32);
@@ -105,7 +105,7 @@ static void wu_Hist3d(wu_state_t* state, long int* vwt, long int* vmr, long int*
         table[i] = i * i;
     }
 
-    state->Qadd = (unsigned short int*)malloc(sizeof(short int) * state->size);
+    state->Qadd = (unsigned short int*)sail_malloc_std_signature(sizeof(short int) * state->size);
     if (state->Qadd == NULL)
     {
         return;
@@ -737,10 +737,10 @@ static sail_status_t apply_floyd_steinberg_dithering(struct sail_image* indexed_
     return SAIL_OK;
 }
 
-sail_status_t sail_quantize_image(const struct sail_image* source_image,
-                                  enum SailPixelFormat output_pixel_format,
-                                  bool dither,
-                                  struct sail_image** target_image)
+static sail_status_t quantize_image(const struct sail_image* source_image,
+                                    enum SailPixelFormat output_pixel_format,
+                                    bool dither,
+                                    struct sail_image** target_image)
 {
     SAIL_CHECK_PTR(source_image);
     SAIL_CHECK_PTR(target_image);
@@ -987,3 +987,15 @@ sail_status_t sail_quantize_image(const struct sail_image* source_image,
 
     return SAIL_OK;
 }
+
+sail_status_t sail_quantize_image(const struct sail_image* source_image,
+                                  enum SailPixelFormat output_pixel_format,
+                                  bool dither,
+                                  struct sail_image** target_image)
+{
+    sail_trace_begin("sail_quantize_image", "manip");
+    const sail_status_t status = quantize_image(source_image, output_pixel_format, dither, target_image);
+    sail_trace_end("sail_quantize_image", "manip");
+
+    return status;
+}
@@ -37,11 +37,15 @@
  * Private functions.
  */
 
-static sail_status_t rotate_90_clockwise(const struct sail_image* image, struct sail_image* output)
+struct rotate_context
 {
-    SAIL_TRY(sail_check_image_valid(image));
-    SAIL_CHECK_PTR(output);
+    const struct sail_image* image;
+    struct sail_image* output;
+    unsigned bytes_per_pixel;
+};
 
+static sail_status_t check_byte_aligned(const struct sail_image* image, unsigned* bytes_per_pixel)
+{
     const unsigned bits_per_pixel = sail_bits_per_pixel(image->pixel_format);
 
     if (bits_per_pixel % 8 != 0)
@@ -50,23 +54,27 @@ static sail_status_t rotate_90_clockwise(const struct sail_image* image, struct
         SAIL_LOG_AND_RETURN(SAIL_ERROR_UNSUPPORTED_PIXEL_FORMAT);
     }
 
-    const unsigned bytes_per_pixel = bits_per_pixel / 8;
-    const unsigned src_width = image->width;
-    const unsigned src_height = image->height;
+    *bytes_per_pixel = bits_per_pixel / 8;
 
-    /* For 90° CW rotation: new[x][y] = old[height-1-y][x] */
-    unsigned row;
+    return SAIL_OK;
+}
+
+/* For 90° CW rotation: new[x][y] = old[height-1-y][x] */
+static sail_status_t rotate_90_clockwise_rows(void* context, unsigned row_begin, unsigned row_end)
+{
+    const struct rotate_context* rotate_context = context;
+    const struct sail_image* image              = rotate_context->image;
+    const unsigned bytes_per_pixel              = rotate_context->bytes_per_pixel;
 
-    SAIL_OMP_PARALLEL_FOR
-    for (row = 0; row < src_height; row++)
+    for (unsigned row = row_begin; row < row_end; row++)
     {
         const uint8_t* src_scan = (const uint8_t*)sail_scan_line(image, row);
-        const unsigned dst_col = src_height - 1 - row;
+        const unsigned dst_col = image->height - 1 - row;
 
-        for (unsigned col = 0; col < src_width; col++)
+        for (unsigned col = 0; col < image->width; col++)
         {
             const unsigned dst_row = col;
-            uint8_t* dst_pixel = (uint8_t*)sail_scan_line(output, dst_row) + dst_col * bytes_per_pixel;
+            uint8_t* dst_pixel = (uint8_t*)sail_scan_line(rotate_context->output, dst_row) + dst_col * bytes_per_pixel;
             const uint8_t* src_pixel = src_scan + col * bytes_per_pixel;
 
             memcpy(dst_pixel, src_pixel, bytes_per_pixel);
@@ -76,37 +84,23 @@ static sail_status_t rotate_90_clockwise(const struct sail_image* image, struct
     return SAIL_OK;
 }
 
-static sail_status_t rotate_180(const struct sail_image* image, struct sail_image* output)
+/* For 180° rotation: new[x][y] = old[width-1-x][height-1-y] */
+static sail_status_t rotate_180_rows(void* context, unsigned row_begin, unsigned row_end)
 {
-    SAIL_TRY(sail_check_image_valid(image));
-    SAIL_CHECK_PTR(output);
-
-    const unsigned bits_per_pixel = sail_bits_per_pixel(image->pixel_format);
-
-    if (bits_per_pixel % 8 != 0)
-    {
-        SAIL_LOG_ERROR("Only byte-aligned pixels are supported for rotation");
-        SAIL_LOG_AND_RETURN(SAIL_ERROR_UNSUPPORTED_PIXEL_FORMAT);
-    }
+    const struct rotate_context* rotate_context = context;
+    const struct sail_image* image              = rotate_context->image;
+    const unsigned bytes_per_pixel              = rotate_context->bytes_per_pixel;
 
-    const unsigned bytes_per_pixel = bits_per_pixel / 8;
-    const unsigned width = image->width;
-    const unsigned height = image->height;
-
-    /* For 180° rotation: new[x][y] = old[width-1-x][height-1-y] */
-    unsigned row;
-
-    SAIL_OMP_PARALLEL_FOR
-    for (row = 0; row < height; row++)
+    for (unsigned row = row_begin; row < row_end; row++)
     {
         const uint8_t* src_scan = (const uint8_t*)sail_scan_line(image, row);
-        uint8_t* dst_scan = (uint8_t*)sail_scan_line(output, height - 1 - row);
+        uint8_t* dst_scan = (uint8_t*)sail_scan_line(rotate_context->output, image->height - 1 - row);
 
         /* Copy pixels in reverse order */
-        for (unsigned col = 0; col < width; col++)
+        for (unsigned col = 0; col < image->width; col++)
         {
             const uint8_t* src_pixel = src_scan + col * bytes_per_pixel;
-            uint8_t* dst_pixel = dst_scan + (width - 1 - col) * bytes_per_pixel;
+            uint8_t* dst_pixel = dst_scan + (image->width - 1 - col) * bytes_per_pixel;
 
             memcpy(dst_pixel, src_pixel, bytes_per_pixel);
         }
@@ -115,36 +109,22 @@ static sail_status_t rotate_180(const struct sail_image* image, struct sail_imag
     return SAIL_OK;
 }
 
-static sail_status_t rotate_270_clockwise(const struct sail_image* image, struct sail_image* output)
+/* For 270° CW rotation: new[x][y] = old[y][width-1-x] */
+static sail_status_t rotate_270_clockwise_rows(void* context, unsigned row_begin, unsigned row_end)
 {
-    SAIL_TRY(sail_check_image_valid(image));
-    SAIL_CHECK_PTR(output);
-
-    const unsigned bits_per_pixel = sail_bits_per_pixel(image->pixel_format);
+    const struct rotate_context* rotate_context = context;
+    const struct sail_image* image              = rotate_context->image;
+    const unsigned bytes_per_pixel              = rotate_context->bytes_per_pixel;
 
-    if (bits_per_pixel % 8 != 0)
-    {
-        SAIL_LOG_ERROR("Only byte-aligned pixels are supported for rotation");
-        SAIL_LOG_AND_RETURN(SAIL_ERROR_UNSUPPORTED_PIXEL_FORMAT);
-    }
-
-    const unsigned bytes_per_pixel = bits_per_pixel / 8;
-    const unsigned src_width = image->width;
-    const unsigned src_height = image->height;
-
-    /* For 270° CW rotation: new[x][y] = old[y][width-1-x] */
-    unsigned row;
-
-    SAIL_OMP_PARALLEL_FOR
-    for (row = 0; row < src_height; row++)
+    for (unsigned row = row_begin; row < row_end; row++)
     {
         const uint8_t* src_scan = (const uint8_t*)sail_scan_line(image, row);
         const unsigned dst_col = row;
 
-        for (unsigned col = 0; col < src_width; col++)
+        for (unsigned col = 0; col < image->width; col++)
         {
-            const unsigned dst_row = src_width - 1 - col;
-            uint8_t* dst_pixel = (uint8_t*)sail_scan_line(output, dst_row) + dst_col * bytes_per_pixel;
+            const unsigned dst_row = image->width - 1 - col;
+            uint8_t* dst_pixel = (uint8_t*)sail_scan_line(rotate_context->output, dst_row) + dst_col * bytes_per_pixel;
             const uint8_t* src_pixel = src_scan + col * bytes_per_pixel;
 
             memcpy(dst_pixel, src_pixel, bytes_per_pixel);
@@ -154,6 +134,21 @@ static sail_status_t rotate_270_clockwise(const struct sail_image* image, struct
     return SAIL_OK;
 }
 
+static sail_status_t rotate(const struct sail_image* image,
+                            struct sail_image* output,
+                            sail_parallel_rows_func_t rotate_rows)
+{
+    SAIL_TRY(sail_check_image_valid(image));
+    SAIL_CHECK_PTR(output);
+
+    struct rotate_context rotate_context = {image, output, 0};
+    SAIL_TRY(check_byte_aligned(image, &rotate_context.bytes_per_pixel));
+
+    SAIL_TRY(sail_parallel_for(image->height, 0 /* max threads */, rotate_rows, &rotate_context));
+
+    return SAIL_OK;
+}
+
 /*
  * Public functions.
  */
@@ -236,15 +231,15 @@ sail_status_t sail_rotate_image(const struct sail_image* image,
     switch (angle)
     {
     case SAIL_ORIENTATION_ROTATED_90:
-        status = rotate_90_clockwise(image, output);
+        status = rotate(image, output, rotate_90_clockwise_rows);
         break;
 
     case SAIL_ORIENTATION_ROTATED_180:
-        status = rotate_180(image, output);
+        status = rotate(image, output, rotate_180_rows);
         break;
 
     case SAIL_ORIENTATION_ROTATED_270:
-        status = rotate_270_clockwise(image, output);
+        status = rotate(image, output, rotate_270_clockwise_rows);
         break;
 
     default:
@@ -267,42 +262,39 @@ sail_status_t sail_rotate_image_180_inplace(struct sail_image* image)
 {
     SAIL_TRY(sail_check_image_valid(image));
 
-    const unsigned bits_per_pixel = sail_bits_per_pixel(image->pixel_format);
+    unsigned bytes_per_pixel;
+    SAIL_TRY(check_byte_aligned(image, &bytes_per_pixel));
 
-    if (bits_per_pixel % 8 != 0)
-    {
-        SAIL_LOG_ERROR("Only byte-aligned pixels are supported for rotation");
-        SAIL_LOG_AND_RETURN(SAIL_ERROR_UNSUPPORTED_PIXEL_FORMAT);
-    }
-
-    const unsigned bytes_per_pixel = bits_per_pixel / 8;
-    const unsigned width           = image->width;
-    const unsigned height          = image->height;
-    size_t total_pixels;
-    size_t half_pixels;
-
-    SAIL_TRY(sail_size_mul(width, height, &total_pixels));
-
-    half_pixels = total_pixels / 2;
-
-    uint8_t* pixels = (uint8_t*)image->pixels;
+    const unsigned width  = image->width;
+    const unsigned height = image->height;
 
     /* Allocate temporary buffer for pixel swap */
     void* temp_pixel;
     SAIL_TRY(sail_malloc(bytes_per_pixel, &temp_pixel));
 
-    /* Swap pixels from opposite ends moving toward center */
-    for (size_t i = 0; i < half_pixels; i++)
+    /*
+     * Swap pixels from opposite ends moving toward center. Walk scan lines rather than
+     * the whole buffer, so padded scan lines are handled too.
+     */
+    for (unsigned row = 0; row < (height + 1) / 2; row++)
     {
-        const size_t opposite_i = total_pixels - 1 - i;
+        const unsigned opposite_row = height - 1 - row;
+        uint8_t* scan1              = sail_scan_line(image, row);
+        uint8_t* scan2              = sail_scan_line(image, opposite_row);
 
-        uint8_t* pixel1 = pixels + i * bytes_per_pixel;
-        uint8_t* pixel2 = pixels + opposite_i * bytes_per_pixel;
+        /* The middle row of an odd-height image is mirrored around its own center. */
+        const unsigned columns = (row == opposite_row) ? width / 2 : width;
 
-        /* Swap pixels */
-        memcpy(temp_pixel, pixel1, bytes_per_pixel);
-        memcpy(pixel1, pixel2, bytes_per_pixel);
-        memcpy(pixel2, temp_pixel, bytes_per_pixel);
+        for (unsigned column = 0; column < columns; column++)
+        {
+            uint8_t* pixel1 = scan1 + (size_t)column * bytes_per_pixel;
+            uint8_t* pixel2 = scan2 + (size_t)(width - 1 - column) * bytes_per_pixel;
+
+            /* Swap pixels */
+            memcpy(temp_pixel, pixel1, bytes_per_pixel);
+            memcpy(pixel1, pixel2, bytes_per_pixel);
+            memcpy(pixel2, temp_pixel, bytes_per_pixel);
+        }
     }
 
     sail_free(temp_pixel);
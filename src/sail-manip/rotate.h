@@ -42,7 +42,7 @@ struct sail_image;
  * For 90° and 270° rotations, the output image dimensions are swapped (width <-> height).
  * For 180° rotation, the dimensions remain the same.
  *
- * The rotation is optimized using OpenMP for parallel processing when available.
+ * The rows are rotated in parallel. See sail_set_max_threads().
  * All pixel formats with byte-aligned pixels (bits_per_pixel % 8 == 0) are supported.
  *
  * Supported angles:
@@ -0,0 +1,196 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <string.h>
+
+#include <sail-manip/sail-manip.h>
+
+#include "manip_utils.h"
+#include "row_conversions.h"
+#include "row_kernels.h"
+
+/* Pixels converted at once. The RGBA32 tile stays in the L1 cache. */
+#define SAIL_ROW_CONVERSION_TILE 256
+
+/* Arguments of the parallel loop. */
+struct row_conversion_context
+{
+    const struct sail_image* image_input;
+    struct sail_image* image_output;
+
+    const struct sail_row_conversion* row_conversion;
+
+    /* 256 entries. Indexes beyond the image palette map to the first color. */
+    const sail_rgba32_t* palette;
+};
+
+static sail_status_t convert_rows(void* context, unsigned row_begin, unsigned row_end)
+{
+    const struct row_conversion_context* row_context = context;
+    const struct sail_image* image_input             = row_context->image_input;
+    struct sail_image* image_output                  = row_context->image_output;
+    const struct sail_row_conversion* row_conversion = row_context->row_conversion;
+
+    sail_rgba32_t tile[SAIL_ROW_CONVERSION_TILE];
+
+    for (unsigned row = row_begin; row < row_end; row++)
+    {
+        const uint8_t* scan_input = sail_scan_line(image_input, row);
+        uint8_t* scan_output      = sail_scan_line(image_output, row);
+
+        if (row_conversion->pack == NULL)
+        {
+            row_conversion->unpack(scan_input, (sail_rgba32_t*)scan_output, image_input->width, row_context->palette);
+            continue;
+        }
+
+        if (row_conversion->unpack == NULL)
+        {
+            row_conversion->pack((const sail_rgba32_t*)scan_input, scan_output, image_input->width);
+            continue;
+        }
+
+        for (unsigned column = 0; column < image_input->width; column += SAIL_ROW_CONVERSION_TILE)
+        {
+            const unsigned count = (image_input->width - column < SAIL_ROW_CONVERSION_TILE)
+                                       ? image_input->width - column
+                                       : SAIL_ROW_CONVERSION_TILE;
+
+            row_conversion->unpack(scan_input + (size_t)column * row_conversion->input_pixel_size, tile, count,
+                                   row_context->palette);
+            row_conversion->pack(tile, scan_output + (size_t)column * row_conversion->output_pixel_size, count);
+        }
+    }
+
+    return SAIL_OK;
+}
+
+bool sail_prepare_row_conversion(enum SailPixelFormat input_pixel_format,
+                                 enum SailPixelFormat output_pixel_format,
+                                 const struct sail_conversion_options* options,
+                                 struct sail_row_conversion* row_conversion)
+{
+    enum SailRowFormat input_row_format;
+    enum SailRowFormat output_row_format;
+
+    if (!sail_row_format_from_pixel_format(input_pixel_format, &input_row_format)
+        || !sail_row_format_from_pixel_format(output_pixel_format, &output_row_format)
+        || input_row_format == output_row_format)
+    {
+        return false;
+    }
+
+    /* Swapping R and B in place is faster than two passes. Leave it to the fast path. */
+    if ((input_row_format == SAIL_ROW_FORMAT_RGB24 && output_row_format == SAIL_ROW_FORMAT_BGR24)
+        || (input_row_format == SAIL_ROW_FORMAT_BGR24 && output_row_format == SAIL_ROW_FORMAT_RGB24))
+    {
+        return false;
+    }
+
+    /* Packing drops alpha. Let the generic path blend it. */
+    if (options != NULL && (options->options & SAIL_CONVERSION_OPTION_BLEND_ALPHA)
+        && !sail_has_alpha(output_pixel_format))
+    {
+        return false;
+    }
+
+    struct sail_row_kernels kernels;
+    sail_select_row_kernels(&kernels);
+
+    row_conversion->unpack = (input_row_format == SAIL_ROW_FORMAT_RGBA32) ? NULL : kernels.unpack[input_row_format];
+    row_conversion->pack   = (output_row_format == SAIL_ROW_FORMAT_RGBA32) ? NULL : kernels.pack[output_row_format];
+    row_conversion->input_pixel_size  = sail_bits_per_pixel(input_pixel_format) / 8;
+    row_conversion->output_pixel_size = sail_bits_per_pixel(output_pixel_format) / 8;
+    row_conversion->indexed_input     = input_row_format == SAIL_ROW_FORMAT_INDEXED8;
+
+    if ((row_conversion->unpack == NULL && input_row_format != SAIL_ROW_FORMAT_RGBA32)
+        || (row_conversion->pack == NULL && output_row_format != SAIL_ROW_FORMAT_RGBA32))
+    {
+        return false;
+    }
+
+    return true;
+}
+
+bool sail_build_row_palette(const struct sail_palette* palette, sail_rgba32_t palette256[256])
+{
+    if (palette == NULL || palette->data == NULL || palette->color_count == 0)
+    {
+        return false;
+    }
+
+    const unsigned color_count = (palette->color_count < 256) ? palette->color_count : 256;
+
+    if (convert_palette_to_rgba32(palette, color_count, palette256) != SAIL_OK)
+    {
+        return false;
+    }
+
+    for (unsigned i = color_count; i < 256; i++)
+    {
+        palette256[i] = palette256[0];
+    }
+
+    return true;
+}
+
+bool sail_execute_row_conversion(const struct sail_row_conversion* row_conversion,
+                                 const struct sail_image* image_input,
+                                 struct sail_image* image_output,
+                                 const sail_rgba32_t* palette256,
+                                 unsigned max_threads)
+{
+    const struct row_conversion_context row_context = {
+        .image_input    = image_input,
+        .image_output   = image_output,
+        .row_conversion = row_conversion,
+        .palette        = palette256,
+    };
+
+    return sail_parallel_for(image_input->height, max_threads, convert_rows, (void*)&row_context) == SAIL_OK;
+}
+
+bool sail_try_row_conversion(const struct sail_image* image_input,
+                             struct sail_image* image_output,
+                             const struct sail_conversion_options* options)
+{
+    struct sail_row_conversion row_conversion;
+
+    if (!sail_prepare_row_conversion(image_input->pixel_format, image_output->pixel_format, options, &row_conversion))
+    {
+        return false;
+    }
+
+    sail_rgba32_t palette256[256];
+
+    if (row_conversion.indexed_input && !sail_build_row_palette(image_input->palette, palette256))
+    {
+        return false;
+    }
+
+    return sail_execute_row_conversion(&row_conversion, image_input, image_output,
+                                       row_conversion.indexed_input ? palette256 : NULL,
+                                       (options == NULL) ? 0 : options->max_threads);
+}
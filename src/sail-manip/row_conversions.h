@@ -0,0 +1,96 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <stdbool.h>
+
+#include <sail-common/common.h>
+#include <sail-common/export.h>
+#include <sail-common/pixel.h>
+
+#include "row_kernels.h"
+
+struct sail_conversion_options;
+struct sail_image;
+struct sail_palette;
+
+/*
+ * Row-batched conversions between 8-bit grayscale, indexed, RGB, and RGBA pixel formats.
+ *
+ * Scan lines are unpacked into RGBA32 and packed into the output pixel format in tiles with
+ * the row kernels selected for the CPU. See sail_select_row_kernels(). The rows are converted
+ * in parallel with up to options->max_threads threads.
+ *
+ * Returns true if both pixel formats have row kernels and the conversion succeeded.
+ * Returns false if the conversion must be done by the generic per-pixel path.
+ */
+SAIL_HIDDEN bool sail_try_row_conversion(const struct sail_image* image_input,
+                                         struct sail_image* image_output,
+                                         const struct sail_conversion_options* options);
+
+/*
+ * Row kernels chosen for a pair of pixel formats. Conversion plans keep it to convert
+ * many images without choosing the kernels again.
+ */
+struct sail_row_conversion
+{
+    /* NULL when the input is RGBA32. The input scan line is packed directly. */
+    sail_unpack_row_func_t unpack;
+    /* NULL when the output is RGBA32. The input scan line is unpacked directly into the output. */
+    sail_pack_row_func_t pack;
+
+    unsigned input_pixel_size;
+    unsigned output_pixel_size;
+
+    /* The conversion needs a 256-entry palette. See sail_build_row_palette(). */
+    bool indexed_input;
+};
+
+/*
+ * Chooses the row kernels for the pixel formats. Returns false if the conversion must be done
+ * by another path.
+ */
+SAIL_HIDDEN bool sail_prepare_row_conversion(enum SailPixelFormat input_pixel_format,
+                                             enum SailPixelFormat output_pixel_format,
+                                             const struct sail_conversion_options* options,
+                                             struct sail_row_conversion* row_conversion);
+
+/*
+ * Converts the palette into 256 RGBA32 colors without allocating memory. Indexes beyond
+ * the palette map to the first color like in the generic path. Returns false if the palette
+ * is empty or its pixel format is not supported.
+ */
+SAIL_HIDDEN bool sail_build_row_palette(const struct sail_palette* palette, sail_rgba32_t palette256[256]);
+
+/*
+ * Converts the rows with the prepared kernels. palette256 is used for indexed input images only.
+ * Allocates no memory.
+ */
+SAIL_HIDDEN bool sail_execute_row_conversion(const struct sail_row_conversion* row_conversion,
+                                             const struct sail_image* image_input,
+                                             struct sail_image* image_output,
+                                             const sail_rgba32_t* palette256,
+                                             unsigned max_threads);
@@ -0,0 +1,294 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <string.h>
+
+#include <sail-manip/sail-manip.h>
+
+#include "row_kernels.h"
+
+/* https://en.wikipedia.org/wiki/Grayscale. Must match fill_gray_alpha16_pixel_from_uint8_values(). */
+static const double R_TO_GRAY_COEFFICIENT = 0.299;
+static const double G_TO_GRAY_COEFFICIENT = 0.587;
+static const double B_TO_GRAY_COEFFICIENT = 0.114;
+
+/*
+ * Scalar kernels.
+ */
+
+static void unpack_gray8(const uint8_t* input, sail_rgba32_t* output, unsigned width, const sail_rgba32_t* palette)
+{
+    (void)palette;
+
+    sail_unpack_gray8_pixels(input, output, width);
+}
+
+static void unpack_gray_alpha16(const uint8_t* input,
+                                sail_rgba32_t* output,
+                                unsigned width,
+                                const sail_rgba32_t* palette)
+{
+    (void)palette;
+
+    sail_unpack_gray_alpha16_pixels(input, output, width);
+}
+
+static void unpack_indexed8(const uint8_t* input, sail_rgba32_t* output, unsigned width, const sail_rgba32_t* palette)
+{
+    sail_unpack_indexed8_pixels(input, output, width, palette);
+}
+
+#define SAIL_UNPACK_RGB24_KIND(name, r, g, b)                                                                          \
+    static void unpack_##name(const uint8_t* input, sail_rgba32_t* output, unsigned width,                             \
+                              const sail_rgba32_t* palette)                                                            \
+    {                                                                                                                  \
+        (void)palette;                                                                                                 \
+        sail_unpack_rgb24_kind_pixels(input, output, width, r, g, b);                                                  \
+    }
+
+#define SAIL_UNPACK_RGBA32_KIND(name, r, g, b, a)                                                                      \
+    static void unpack_##name(const uint8_t* input, sail_rgba32_t* output, unsigned width,                             \
+                              const sail_rgba32_t* palette)                                                            \
+    {                                                                                                                  \
+        (void)palette;                                                                                                 \
+        sail_unpack_rgba32_kind_pixels(input, output, width, r, g, b, a);                                              \
+    }
+
+SAIL_UNPACK_RGB24_KIND(rgb24, 0, 1, 2)
+SAIL_UNPACK_RGB24_KIND(bgr24, 2, 1, 0)
+SAIL_UNPACK_RGBA32_KIND(rgba32, 0, 1, 2, 3)
+SAIL_UNPACK_RGBA32_KIND(bgra32, 2, 1, 0, 3)
+SAIL_UNPACK_RGBA32_KIND(argb32, 1, 2, 3, 0)
+SAIL_UNPACK_RGBA32_KIND(abgr32, 3, 2, 1, 0)
+SAIL_UNPACK_RGBA32_KIND(rgbx32, 0, 1, 2, -1)
+SAIL_UNPACK_RGBA32_KIND(bgrx32, 2, 1, 0, -1)
+SAIL_UNPACK_RGBA32_KIND(xrgb32, 1, 2, 3, -1)
+SAIL_UNPACK_RGBA32_KIND(xbgr32, 3, 2, 1, -1)
+
+static void pack_gray8(const sail_rgba32_t* input, uint8_t* output, unsigned width)
+{
+    sail_pack_gray8_pixels(input, output, width);
+}
+
+static void pack_gray_alpha16(const sail_rgba32_t* input, uint8_t* output, unsigned width)
+{
+    for (unsigned i = 0; i < width; i++, output += 2)
+    {
+        output[0] = (uint8_t)((R_TO_GRAY_COEFFICIENT * input[i].component1)
+                              + (G_TO_GRAY_COEFFICIENT * input[i].component2)
+                              + (B_TO_GRAY_COEFFICIENT * input[i].component3));
+        output[1] = input[i].component4;
+    }
+}
+
+static void pack_rgba32(const sail_rgba32_t* input, uint8_t* output, unsigned width)
+{
+    memcpy(output, input, (size_t)width * sizeof(sail_rgba32_t));
+}
+
+#define SAIL_PACK_RGB24_KIND(name, r, g, b)                                                                            \
+    static void pack_##name(const sail_rgba32_t* input, uint8_t* output, unsigned width)                               \
+    {                                                                                                                  \
+        sail_pack_rgb24_kind_pixels(input, output, width, r, g, b);                                                    \
+    }
+
+#define SAIL_PACK_RGBA32_KIND(name, r, g, b, a, x)                                                                     \
+    static void pack_##name(const sail_rgba32_t* input, uint8_t* output, unsigned width)                               \
+    {                                                                                                                  \
+        sail_pack_rgba32_kind_pixels(input, output, width, r, g, b, a, x);                                             \
+    }
+
+SAIL_PACK_RGB24_KIND(rgb24, 0, 1, 2)
+SAIL_PACK_RGB24_KIND(bgr24, 2, 1, 0)
+SAIL_PACK_RGBA32_KIND(bgra32, 2, 1, 0, 3, -1)
+SAIL_PACK_RGBA32_KIND(argb32, 1, 2, 3, 0, -1)
+SAIL_PACK_RGBA32_KIND(abgr32, 3, 2, 1, 0, -1)
+SAIL_PACK_RGBA32_KIND(rgbx32, 0, 1, 2, -1, 3)
+SAIL_PACK_RGBA32_KIND(bgrx32, 2, 1, 0, -1, 3)
+SAIL_PACK_RGBA32_KIND(xrgb32, 1, 2, 3, -1, 0)
+SAIL_PACK_RGBA32_KIND(xbgr32, 3, 2, 1, -1, 0)
+
+/*
+ * Public functions.
+ */
+
+bool sail_row_format_from_pixel_format(enum SailPixelFormat pixel_format, enum SailRowFormat* row_format)
+{
+    switch (pixel_format)
+    {
+    case SAIL_PIXEL_FORMAT_BPP8_GRAYSCALE:
+    {
+        *row_format = SAIL_ROW_FORMAT_GRAY8;
+        break;
+    }
+    case SAIL_PIXEL_FORMAT_BPP16_GRAYSCALE_ALPHA:
+    {
+        *row_format = SAIL_ROW_FORMAT_GRAY_ALPHA16;
+        break;
+    }
+    case SAIL_PIXEL_FORMAT_BPP8_INDEXED:
+    {
+        *row_format = SAIL_ROW_FORMAT_INDEXED8;
+        break;
+    }
+    case SAIL_PIXEL_FORMAT_BPP24_RGB:
+    {
+        *row_format = SAIL_ROW_FORMAT_RGB24;
+        break;
+    }
+    case SAIL_PIXEL_FORMAT_BPP24_BGR:
+    {
+        *row_format = SAIL_ROW_FORMAT_BGR24;
+        break;
+    }
+    case SAIL_PIXEL_FORMAT_BPP32_RGBA:
+    {
+        *row_format = SAIL_ROW_FORMAT_RGBA32;
+        break;
+    }
+    case SAIL_PIXEL_FORMAT_BPP32_BGRA:
+    {
+        *row_format = SAIL_ROW_FORMAT_BGRA32;
+        break;
+    }
+    case SAIL_PIXEL_FORMAT_BPP32_ARGB:
+    {
+        *row_format = SAIL_ROW_FORMAT_ARGB32;
+        break;
+    }
+    case SAIL_PIXEL_FORMAT_BPP32_ABGR:
+    {
+        *row_format = SAIL_ROW_FORMAT_ABGR32;
+        break;
+    }
+    case SAIL_PIXEL_FORMAT_BPP32_RGBX:
+    {
+        *row_format = SAIL_ROW_FORMAT_RGBX32;
+        break;
+    }
+    case SAIL_PIXEL_FORMAT_BPP32_BGRX:
+    {
+        *row_format = SAIL_ROW_FORMAT_BGRX32;
+        break;
+    }
+    case SAIL_PIXEL_FORMAT_BPP32_XRGB:
+    {
+        *row_format = SAIL_ROW_FORMAT_XRGB32;
+        break;
+    }
+    case SAIL_PIXEL_FORMAT_BPP32_XBGR:
+    {
+        *row_format = SAIL_ROW_FORMAT_XBGR32;
+        break;
+    }
+    default:
+    {
+        return false;
+    }
+    }
+
+    return true;
+}
+
+void sail_row_kernels_init_scalar(struct sail_row_kernels* kernels)
+{
+    kernels->name = "scalar";
+
+    kernels->unpack[SAIL_ROW_FORMAT_GRAY8]        = unpack_gray8;
+    kernels->unpack[SAIL_ROW_FORMAT_GRAY_ALPHA16] = unpack_gray_alpha16;
+    kernels->unpack[SAIL_ROW_FORMAT_INDEXED8]     = unpack_indexed8;
+    kernels->unpack[SAIL_ROW_FORMAT_RGB24]        = unpack_rgb24;
+    kernels->unpack[SAIL_ROW_FORMAT_BGR24]        = unpack_bgr24;
+    kernels->unpack[SAIL_ROW_FORMAT_RGBA32]       = unpack_rgba32;
+    kernels->unpack[SAIL_ROW_FORMAT_BGRA32]       = unpack_bgra32;
+    kernels->unpack[SAIL_ROW_FORMAT_ARGB32]       = unpack_argb32;
+    kernels->unpack[SAIL_ROW_FORMAT_ABGR32]       = unpack_abgr32;
+    kernels->unpack[SAIL_ROW_FORMAT_RGBX32]       = unpack_rgbx32;
+    kernels->unpack[SAIL_ROW_FORMAT_BGRX32]       = unpack_bgrx32;
+    kernels->unpack[SAIL_ROW_FORMAT_XRGB32]       = unpack_xrgb32;
+    kernels->unpack[SAIL_ROW_FORMAT_XBGR32]       = unpack_xbgr32;
+
+    kernels->pack[SAIL_ROW_FORMAT_GRAY8]        = pack_gray8;
+    kernels->pack[SAIL_ROW_FORMAT_GRAY_ALPHA16] = pack_gray_alpha16;
+    kernels->pack[SAIL_ROW_FORMAT_INDEXED8]     = NULL;
+    kernels->pack[SAIL_ROW_FORMAT_RGB24]        = pack_rgb24;
+    kernels->pack[SAIL_ROW_FORMAT_BGR24]        = pack_bgr24;
+    kernels->pack[SAIL_ROW_FORMAT_RGBA32]       = pack_rgba32;
+    kernels->pack[SAIL_ROW_FORMAT_BGRA32]       = pack_bgra32;
+    kernels->pack[SAIL_ROW_FORMAT_ARGB32]       = pack_argb32;
+    kernels->pack[SAIL_ROW_FORMAT_ABGR32]       = pack_abgr32;
+    kernels->pack[SAIL_ROW_FORMAT_RGBX32]       = pack_rgbx32;
+    kernels->pack[SAIL_ROW_FORMAT_BGRX32]       = pack_bgrx32;
+    kernels->pack[SAIL_ROW_FORMAT_XRGB32]       = pack_xrgb32;
+    kernels->pack[SAIL_ROW_FORMAT_XBGR32]       = pack_xbgr32;
+}
+
+/*
+ * Kernel sets for sail_select_kernel(). Every set starts with the set of the previous level
+ * and replaces the kernels it has, so it needs the features of all the levels below.
+ */
+typedef void (*init_row_kernels_func_t)(struct sail_row_kernels* kernels);
+
+static void init_sse2_row_kernels(struct sail_row_kernels* kernels)
+{
+    sail_row_kernels_init_scalar(kernels);
+    sail_row_kernels_init_sse2(kernels);
+}
+
+static void init_avx2_row_kernels(struct sail_row_kernels* kernels)
+{
+    init_sse2_row_kernels(kernels);
+    sail_row_kernels_init_avx2(kernels);
+}
+
+static void init_avx512_row_kernels(struct sail_row_kernels* kernels)
+{
+    init_avx2_row_kernels(kernels);
+    sail_row_kernels_init_avx512(kernels);
+}
+
+static void init_neon_row_kernels(struct sail_row_kernels* kernels)
+{
+    sail_row_kernels_init_scalar(kernels);
+    sail_row_kernels_init_neon(kernels);
+}
+
+// clang-format off
+static const struct sail_kernel_variant ROW_KERNELS_VARIANTS[] = {
+    {SAIL_CPU_FEATURE_AVX512 | SAIL_CPU_FEATURE_AVX2 | SAIL_CPU_FEATURE_SSE2, (sail_kernel_func_t)init_avx512_row_kernels},
+    {SAIL_CPU_FEATURE_AVX2 | SAIL_CPU_FEATURE_SSE2,                          (sail_kernel_func_t)init_avx2_row_kernels  },
+    {SAIL_CPU_FEATURE_SSE2,                                                  (sail_kernel_func_t)init_sse2_row_kernels  },
+    {SAIL_CPU_FEATURE_NEON,                                                  (sail_kernel_func_t)init_neon_row_kernels  },
+    {0,                                                                      (sail_kernel_func_t)sail_row_kernels_init_scalar},
+};
+// clang-format on
+
+void sail_select_row_kernels(struct sail_row_kernels* kernels)
+{
+    const init_row_kernels_func_t init_row_kernels = (init_row_kernels_func_t)sail_select_kernel(
+        ROW_KERNELS_VARIANTS, sizeof(ROW_KERNELS_VARIANTS) / sizeof(ROW_KERNELS_VARIANTS[0]));
+
+    init_row_kernels(kernels);
+}
@@ -0,0 +1,213 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <sail-common/common.h>
+#include <sail-common/export.h>
+#include <sail-common/pixel.h>
+
+#include <sail-manip/manip_common.h>
+
+/*
+ * Scan line layouts with row kernels. The conversion engine unpacks a scan line into RGBA32 pixels
+ * and packs the RGBA32 pixels into the output scan line. Layouts with 4-byte pixels are named
+ * by their byte order in memory.
+ */
+enum SailRowFormat
+{
+    SAIL_ROW_FORMAT_GRAY8,
+    SAIL_ROW_FORMAT_GRAY_ALPHA16,
+    SAIL_ROW_FORMAT_INDEXED8,
+    SAIL_ROW_FORMAT_RGB24,
+    SAIL_ROW_FORMAT_BGR24,
+    SAIL_ROW_FORMAT_RGBA32,
+    SAIL_ROW_FORMAT_BGRA32,
+    SAIL_ROW_FORMAT_ARGB32,
+    SAIL_ROW_FORMAT_ABGR32,
+    SAIL_ROW_FORMAT_RGBX32,
+    SAIL_ROW_FORMAT_BGRX32,
+    SAIL_ROW_FORMAT_XRGB32,
+    SAIL_ROW_FORMAT_XBGR32,
+
+    SAIL_ROW_FORMAT_COUNT,
+};
+
+/*
+ * Unpacks the pixels of a scan line into RGBA32. The palette is used by indexed layouts only
+ * and must have 256 entries.
+ */
+typedef void (*sail_unpack_row_func_t)(const uint8_t* input,
+                                       sail_rgba32_t* output,
+                                       unsigned width,
+                                       const sail_rgba32_t* palette);
+
+/*
+ * Packs RGBA32 pixels into a scan line. Alpha is dropped, not blended, by layouts without alpha,
+ * and padding bytes are set to 255.
+ */
+typedef void (*sail_pack_row_func_t)(const sail_rgba32_t* input, uint8_t* output, unsigned width);
+
+/*
+ * Row kernels of every layout. Entries are NULL for layouts that cannot be unpacked or packed,
+ * like packing into indexed scan lines.
+ */
+struct sail_row_kernels
+{
+    /* "scalar", "sse2", "avx2", "avx512", or "neon". The most advanced instruction set used by the kernels. */
+    const char* name;
+
+    sail_unpack_row_func_t unpack[SAIL_ROW_FORMAT_COUNT];
+    sail_pack_row_func_t pack[SAIL_ROW_FORMAT_COUNT];
+};
+
+/*
+ * Finds the row layout of the pixel format. Returns false if the pixel format has no row kernels.
+ */
+SAIL_HIDDEN bool sail_row_format_from_pixel_format(enum SailPixelFormat pixel_format, enum SailRowFormat* row_format);
+
+/*
+ * Fills the kernels with the fastest implementations sail_cpu_features() reports. The kernel set
+ * is picked from a dispatch table with sail_select_kernel(). Every SIMD kernel produces the same
+ * output as its scalar counterpart.
+ */
+SAIL_HIDDEN void sail_select_row_kernels(struct sail_row_kernels* kernels);
+
+/*
+ * Fill the kernels with the portable implementations, or replace them with the implementations
+ * that use the instruction set. The SIMD functions return false and leave the kernels untouched
+ * when SAIL is built without the instruction set.
+ */
+SAIL_HIDDEN void sail_row_kernels_init_scalar(struct sail_row_kernels* kernels);
+
+SAIL_HIDDEN bool sail_row_kernels_init_sse2(struct sail_row_kernels* kernels);
+
+SAIL_HIDDEN bool sail_row_kernels_init_avx2(struct sail_row_kernels* kernels);
+
+SAIL_HIDDEN bool sail_row_kernels_init_avx512(struct sail_row_kernels* kernels);
+
+SAIL_HIDDEN bool sail_row_kernels_init_neon(struct sail_row_kernels* kernels);
+
+/*
+ * Scalar building blocks of the kernels. The SIMD kernels use them for the pixels left
+ * after the last full vector. Component indexes are byte offsets within a pixel.
+ */
+
+static inline void sail_unpack_gray8_pixels(const uint8_t* input, sail_rgba32_t* output, unsigned width)
+{
+    for (unsigned i = 0; i < width; i++)
+    {
+        output[i].component1 = output[i].component2 = output[i].component3 = input[i];
+        output[i].component4                                             = 255;
+    }
+}
+
+static inline void sail_unpack_gray_alpha16_pixels(const uint8_t* input, sail_rgba32_t* output, unsigned width)
+{
+    for (unsigned i = 0; i < width; i++, input += 2)
+    {
+        output[i].component1 = output[i].component2 = output[i].component3 = input[0];
+        output[i].component4                                             = input[1];
+    }
+}
+
+static inline void sail_unpack_indexed8_pixels(const uint8_t* input,
+                                               sail_rgba32_t* output,
+                                               unsigned width,
+                                               const sail_rgba32_t* palette)
+{
+    for (unsigned i = 0; i < width; i++)
+    {
+        output[i] = palette[input[i]];
+    }
+}
+
+static inline void sail_unpack_rgb24_kind_pixels(
+    const uint8_t* input, sail_rgba32_t* output, unsigned width, int r, int g, int b)
+{
+    for (unsigned i = 0; i < width; i++, input += 3)
+    {
+        output[i].component1 = input[r];
+        output[i].component2 = input[g];
+        output[i].component3 = input[b];
+        output[i].component4 = 255;
+    }
+}
+
+/* Alpha is 255 when a is negative. */
+static inline void sail_unpack_rgba32_kind_pixels(
+    const uint8_t* input, sail_rgba32_t* output, unsigned width, int r, int g, int b, int a)
+{
+    for (unsigned i = 0; i < width; i++, input += 4)
+    {
+        output[i].component1 = input[r];
+        output[i].component2 = input[g];
+        output[i].component3 = input[b];
+        output[i].component4 = (a >= 0) ? input[a] : 255;
+    }
+}
+
+static inline void sail_pack_gray8_pixels(const sail_rgba32_t* input, uint8_t* output, unsigned width)
+{
+    for (unsigned i = 0; i < width; i++)
+    {
+        output[i] = SAIL_RGB8_TO_GRAY8(input[i].component1, input[i].component2, input[i].component3);
+    }
+}
+
+static inline void sail_pack_rgb24_kind_pixels(
+    const sail_rgba32_t* input, uint8_t* output, unsigned width, int r, int g, int b)
+{
+    for (unsigned i = 0; i < width; i++, output += 3)
+    {
+        output[r] = input[i].component1;
+        output[g] = input[i].component2;
+        output[b] = input[i].component3;
+    }
+}
+
+/* When a is negative, the padding byte at x is set to 255. */
+static inline void sail_pack_rgba32_kind_pixels(
+    const sail_rgba32_t* input, uint8_t* output, unsigned width, int r, int g, int b, int a, int x)
+{
+    for (unsigned i = 0; i < width; i++, output += 4)
+    {
+        output[r] = input[i].component1;
+        output[g] = input[i].component2;
+        output[b] = input[i].component3;
+
+        if (a >= 0)
+        {
+            output[a] = input[i].component4;
+        }
+        else
+        {
+            output[x] = 255;
+        }
+    }
+}
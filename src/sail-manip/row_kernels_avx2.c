@@ -0,0 +1,289 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <sail-manip/sail-manip.h>
+
+#include "row_kernels.h"
+
+#ifdef SAIL_HAVE_AVX2
+
+#include <immintrin.h>
+
+/*
+ * AVX2 kernels. Byte shuffles work within 128-bit lanes, so the shuffle masks repeat
+ * the same 16-byte pattern in both lanes.
+ */
+
+static inline char shuffle_index(int component, int offset)
+{
+    /* Negative indexes make the shuffle zero the byte. */
+    return (char)(component < 0 ? -1 : component + offset);
+}
+
+/* Output byte N of every pixel takes byte cN of the input pixel. */
+static inline __m256i pixel_shuffle_mask(int c0, int c1, int c2, int c3)
+{
+#define SAIL_PIXEL(n) shuffle_index(c0, n), shuffle_index(c1, n), shuffle_index(c2, n), shuffle_index(c3, n)
+    return _mm256_setr_epi8(SAIL_PIXEL(0), SAIL_PIXEL(4), SAIL_PIXEL(8), SAIL_PIXEL(12), SAIL_PIXEL(0), SAIL_PIXEL(4),
+                            SAIL_PIXEL(8), SAIL_PIXEL(12));
+#undef SAIL_PIXEL
+}
+
+static inline unsigned shuffle_row(const uint8_t* input, uint8_t* output, unsigned width, __m256i mask, int set_mask)
+{
+    const __m256i set = _mm256_set1_epi32(set_mask);
+    unsigned i        = 0;
+
+    for (; i + 8 <= width; i += 8)
+    {
+        const __m256i pixels = _mm256_loadu_si256((const __m256i*)(input + i * 4));
+        _mm256_storeu_si256((__m256i*)(output + i * 4), _mm256_or_si256(_mm256_shuffle_epi8(pixels, mask), set));
+    }
+
+    return i;
+}
+
+#define SAIL_UNPACK_RGBA32_KIND(name, set_mask, r, g, b, a)                                                            \
+    static void unpack_##name(const uint8_t* input, sail_rgba32_t* output, unsigned width,                             \
+                              const sail_rgba32_t* palette)                                                            \
+    {                                                                                                                  \
+        (void)palette;                                                                                                 \
+        const unsigned i =                                                                                             \
+            shuffle_row(input, (uint8_t*)output, width, pixel_shuffle_mask(r, g, b, a), (int)(set_mask));              \
+        sail_unpack_rgba32_kind_pixels(input + i * 4, output + i, width - i, r, g, b, a);                              \
+    }
+
+/* c0-c3 are the RGBA components stored at bytes 0-3 of the output pixel. */
+#define SAIL_PACK_RGBA32_KIND(name, set_mask, c0, c1, c2, c3, r, g, b, a, x)                                           \
+    static void pack_##name(const sail_rgba32_t* input, uint8_t* output, unsigned width)                               \
+    {                                                                                                                  \
+        const unsigned i = shuffle_row((const uint8_t*)input, output, width, pixel_shuffle_mask(c0, c1, c2, c3),       \
+                                       (int)(set_mask));                                                               \
+        sail_pack_rgba32_kind_pixels(input + i, output + i * 4, width - i, r, g, b, a, x);                             \
+    }
+
+SAIL_UNPACK_RGBA32_KIND(bgra32, 0, 2, 1, 0, 3)
+SAIL_UNPACK_RGBA32_KIND(argb32, 0, 1, 2, 3, 0)
+SAIL_UNPACK_RGBA32_KIND(abgr32, 0, 3, 2, 1, 0)
+SAIL_UNPACK_RGBA32_KIND(rgbx32, 0xFF000000u, 0, 1, 2, -1)
+SAIL_UNPACK_RGBA32_KIND(bgrx32, 0xFF000000u, 2, 1, 0, -1)
+SAIL_UNPACK_RGBA32_KIND(xrgb32, 0xFF000000u, 1, 2, 3, -1)
+SAIL_UNPACK_RGBA32_KIND(xbgr32, 0xFF000000u, 3, 2, 1, -1)
+
+SAIL_PACK_RGBA32_KIND(bgra32, 0, 2, 1, 0, 3, 2, 1, 0, 3, -1)
+SAIL_PACK_RGBA32_KIND(argb32, 0, 3, 0, 1, 2, 1, 2, 3, 0, -1)
+SAIL_PACK_RGBA32_KIND(abgr32, 0, 3, 2, 1, 0, 3, 2, 1, 0, -1)
+SAIL_PACK_RGBA32_KIND(rgbx32, 0xFF000000u, 0, 1, 2, -1, 0, 1, 2, -1, 3)
+SAIL_PACK_RGBA32_KIND(bgrx32, 0xFF000000u, 2, 1, 0, -1, 2, 1, 0, -1, 3)
+SAIL_PACK_RGBA32_KIND(xrgb32, 0x000000FFu, -1, 0, 1, 2, 1, 2, 3, -1, 0)
+SAIL_PACK_RGBA32_KIND(xbgr32, 0x000000FFu, -1, 2, 1, 0, 3, 2, 1, -1, 0)
+
+/*
+ * 3-byte layouts. Every lane holds four pixels: 12 bytes of a 3-byte scan line, or 16 bytes of RGBA32.
+ * The loads and stores of the upper lane touch 4 bytes past the eight pixels, so the loops stop
+ * 10 pixels before the end of the scan line.
+ */
+
+#define SAIL_UNPACK_RGB24_KIND(name, r, g, b)                                                                          \
+    static void unpack_##name(const uint8_t* input, sail_rgba32_t* output, unsigned width,                             \
+                              const sail_rgba32_t* palette)                                                            \
+    {                                                                                                                  \
+        (void)palette;                                                                                                 \
+        const __m256i mask   = _mm256_setr_epi8(r, g, b, -1, r + 3, g + 3, b + 3, -1, r + 6, g + 6, b + 6, -1,         \
+                                                r + 9, g + 9, b + 9, -1, r, g, b, -1, r + 3, g + 3, b + 3, -1, r + 6,  \
+                                                g + 6, b + 6, -1, r + 9, g + 9, b + 9, -1);                            \
+        const __m256i opaque = _mm256_set1_epi32((int)0xFF000000u);                                                    \
+        unsigned i           = 0;                                                                                      \
+        for (; i + 10 <= width; i += 8)                                                                                \
+        {                                                                                                              \
+            const __m128i low    = _mm_loadu_si128((const __m128i*)(input + i * 3));                                   \
+            const __m128i high   = _mm_loadu_si128((const __m128i*)(input + i * 3 + 12));                              \
+            const __m256i pixels = _mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1);                      \
+            _mm256_storeu_si256((__m256i*)(output + i), _mm256_or_si256(_mm256_shuffle_epi8(pixels, mask), opaque));   \
+        }                                                                                                              \
+        sail_unpack_rgb24_kind_pixels(input + i * 3, output + i, width - i, r, g, b);                                  \
+    }
+
+/* c0-c2 are the RGBA components stored at bytes 0-2 of the output pixel. */
+#define SAIL_PACK_RGB24_KIND(name, c0, c1, c2, r, g, b)                                                                \
+    static void pack_##name(const sail_rgba32_t* input, uint8_t* output, unsigned width)                               \
+    {                                                                                                                  \
+        const __m256i mask = _mm256_setr_epi8(c0, c1, c2, c0 + 4, c1 + 4, c2 + 4, c0 + 8, c1 + 8, c2 + 8, c0 + 12,     \
+                                              c1 + 12, c2 + 12, -1, -1, -1, -1, c0, c1, c2, c0 + 4, c1 + 4, c2 + 4,    \
+                                              c0 + 8, c1 + 8, c2 + 8, c0 + 12, c1 + 12, c2 + 12, -1, -1, -1, -1);      \
+        unsigned i         = 0;                                                                                        \
+        for (; i + 10 <= width; i += 8)                                                                                \
+        {                                                                                                              \
+            const __m256i pixels = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)(input + i)), mask);         \
+            /* The upper lane overwrites the 4 junk bytes of the lower lane. */                                        \
+            _mm_storeu_si128((__m128i*)(output + i * 3), _mm256_castsi256_si128(pixels));                              \
+            _mm_storeu_si128((__m128i*)(output + i * 3 + 12), _mm256_extracti128_si256(pixels, 1));                    \
+        }                                                                                                              \
+        sail_pack_rgb24_kind_pixels(input + i, output + i * 3, width - i, r, g, b);                                    \
+    }
+
+SAIL_UNPACK_RGB24_KIND(rgb24, 0, 1, 2)
+SAIL_UNPACK_RGB24_KIND(bgr24, 2, 1, 0)
+
+SAIL_PACK_RGB24_KIND(rgb24, 0, 1, 2, 0, 1, 2)
+SAIL_PACK_RGB24_KIND(bgr24, 2, 1, 0, 2, 1, 0)
+
+/*
+ * Grayscale and indexed layouts.
+ */
+
+static void unpack_gray8(const uint8_t* input, sail_rgba32_t* output, unsigned width, const sail_rgba32_t* palette)
+{
+    (void)palette;
+
+    /* The lower lane expands bytes 0-3 of the broadcast, and the upper lane expands bytes 4-7. */
+    const __m256i mask   = _mm256_setr_epi8(0, 0, 0, -1, 1, 1, 1, -1, 2, 2, 2, -1, 3, 3, 3, -1, 4, 4, 4, -1, 5, 5, 5,
+                                            -1, 6, 6, 6, -1, 7, 7, 7, -1);
+    const __m256i opaque = _mm256_set1_epi32((int)0xFF000000u);
+    unsigned i           = 0;
+
+    for (; i + 8 <= width; i += 8)
+    {
+        const __m256i gray = _mm256_broadcastq_epi64(_mm_loadl_epi64((const __m128i*)(input + i)));
+        _mm256_storeu_si256((__m256i*)(output + i), _mm256_or_si256(_mm256_shuffle_epi8(gray, mask), opaque));
+    }
+
+    sail_unpack_gray8_pixels(input + i, output + i, width - i);
+}
+
+static void unpack_gray_alpha16(const uint8_t* input,
+                                sail_rgba32_t* output,
+                                unsigned width,
+                                const sail_rgba32_t* palette)
+{
+    (void)palette;
+
+    const __m256i mask = _mm256_setr_epi8(0, 0, 0, 1, 2, 2, 2, 3, 4, 4, 4, 5, 6, 6, 6, 7, 8, 8, 8, 9, 10, 10, 10, 11,
+                                          12, 12, 12, 13, 14, 14, 14, 15);
+    unsigned i         = 0;
+
+    for (; i + 8 <= width; i += 8)
+    {
+        const __m256i gray_alpha = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)(input + i * 2)));
+        _mm256_storeu_si256((__m256i*)(output + i), _mm256_shuffle_epi8(gray_alpha, mask));
+    }
+
+    sail_unpack_gray_alpha16_pixels(input + i * 2, output + i, width - i);
+}
+
+static void unpack_indexed8(const uint8_t* input, sail_rgba32_t* output, unsigned width, const sail_rgba32_t* palette)
+{
+    unsigned i = 0;
+
+    for (; i + 8 <= width; i += 8)
+    {
+        const __m256i indexes = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(input + i)));
+        _mm256_storeu_si256((__m256i*)(output + i), _mm256_i32gather_epi32((const int*)palette, indexes, 4));
+    }
+
+    sail_unpack_indexed8_pixels(input + i, output + i, width - i, palette);
+}
+
+/* Computes SAIL_RGB8_TO_GRAY8() of eight RGBA32 pixels as 32-bit integers. */
+static inline __m256i rgba32_to_gray(__m256i pixels)
+{
+    const __m256i rb = _mm256_and_si256(pixels, _mm256_set1_epi32(0x00FF00FF));
+    const __m256i g  = _mm256_and_si256(_mm256_srli_epi32(pixels, 8), _mm256_set1_epi32(0x000000FF));
+
+    const __m256i rb_weights = _mm256_set1_epi32(SAIL_RGB_TO_GRAY_R_WEIGHT | (SAIL_RGB_TO_GRAY_B_WEIGHT << 16));
+    const __m256i g_weights  = _mm256_set1_epi32(SAIL_RGB_TO_GRAY_G_WEIGHT);
+
+    const __m256i sum = _mm256_add_epi32(_mm256_madd_epi16(rb, rb_weights), _mm256_madd_epi16(g, g_weights));
+
+    return _mm256_srli_epi32(sum, 8);
+}
+
+static void pack_gray8(const sail_rgba32_t* input, uint8_t* output, unsigned width)
+{
+    /* The packs interleave the lanes. The permutation restores the pixel order. */
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    unsigned i          = 0;
+
+    for (; i + 32 <= width; i += 32)
+    {
+        const __m256i* const scan = (const __m256i*)(input + i);
+
+        const __m256i gray0 = rgba32_to_gray(_mm256_loadu_si256(scan + 0));
+        const __m256i gray1 = rgba32_to_gray(_mm256_loadu_si256(scan + 1));
+        const __m256i gray2 = rgba32_to_gray(_mm256_loadu_si256(scan + 2));
+        const __m256i gray3 = rgba32_to_gray(_mm256_loadu_si256(scan + 3));
+
+        /* The values fit into 8 bits, so saturation never happens. */
+        const __m256i gray01 = _mm256_packs_epi32(gray0, gray1);
+        const __m256i gray23 = _mm256_packs_epi32(gray2, gray3);
+        const __m256i gray   = _mm256_packus_epi16(gray01, gray23);
+
+        _mm256_storeu_si256((__m256i*)(output + i), _mm256_permutevar8x32_epi32(gray, order));
+    }
+
+    sail_pack_gray8_pixels(input + i, output + i, width - i);
+}
+
+bool sail_row_kernels_init_avx2(struct sail_row_kernels* kernels)
+{
+    kernels->name = "avx2";
+
+    kernels->unpack[SAIL_ROW_FORMAT_GRAY8]        = unpack_gray8;
+    kernels->unpack[SAIL_ROW_FORMAT_GRAY_ALPHA16] = unpack_gray_alpha16;
+    kernels->unpack[SAIL_ROW_FORMAT_INDEXED8]     = unpack_indexed8;
+    kernels->unpack[SAIL_ROW_FORMAT_RGB24]        = unpack_rgb24;
+    kernels->unpack[SAIL_ROW_FORMAT_BGR24]        = unpack_bgr24;
+    kernels->unpack[SAIL_ROW_FORMAT_BGRA32]       = unpack_bgra32;
+    kernels->unpack[SAIL_ROW_FORMAT_ARGB32]       = unpack_argb32;
+    kernels->unpack[SAIL_ROW_FORMAT_ABGR32]       = unpack_abgr32;
+    kernels->unpack[SAIL_ROW_FORMAT_RGBX32]       = unpack_rgbx32;
+    kernels->unpack[SAIL_ROW_FORMAT_BGRX32]       = unpack_bgrx32;
+    kernels->unpack[SAIL_ROW_FORMAT_XRGB32]       = unpack_xrgb32;
+    kernels->unpack[SAIL_ROW_FORMAT_XBGR32]       = unpack_xbgr32;
+
+    kernels->pack[SAIL_ROW_FORMAT_GRAY8]  = pack_gray8;
+    kernels->pack[SAIL_ROW_FORMAT_RGB24]  = pack_rgb24;
+    kernels->pack[SAIL_ROW_FORMAT_BGR24]  = pack_bgr24;
+    kernels->pack[SAIL_ROW_FORMAT_BGRA32] = pack_bgra32;
+    kernels->pack[SAIL_ROW_FORMAT_ARGB32] = pack_argb32;
+    kernels->pack[SAIL_ROW_FORMAT_ABGR32] = pack_abgr32;
+    kernels->pack[SAIL_ROW_FORMAT_RGBX32] = pack_rgbx32;
+    kernels->pack[SAIL_ROW_FORMAT_BGRX32] = pack_bgrx32;
+    kernels->pack[SAIL_ROW_FORMAT_XRGB32] = pack_xrgb32;
+    kernels->pack[SAIL_ROW_FORMAT_XBGR32] = pack_xbgr32;
+
+    return true;
+}
+
+#else
+
+bool sail_row_kernels_init_avx2(struct sail_row_kernels* kernels)
+{
+    (void)kernels;
+
+    return false;
+}
+
+#endif
@@ -0,0 +1,171 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <sail-manip/sail-manip.h>
+
+#include "row_kernels.h"
+
+#ifdef SAIL_HAVE_AVX512
+
+#include <immintrin.h>
+
+/*
+ * AVX-512 kernels. They need AVX512F and AVX512BW. Masked loads and stores convert
+ * the pixels left after the last full vector, so most kernels have no scalar tails.
+ */
+
+static inline char shuffle_index(int component, int offset)
+{
+    /* Negative indexes make the shuffle zero the byte. */
+    return (char)(component < 0 ? -1 : component + offset);
+}
+
+/* Output byte N of every pixel takes byte cN of the input pixel. Byte shuffles work within 128-bit lanes. */
+static inline __m512i pixel_shuffle_mask(int c0, int c1, int c2, int c3)
+{
+#define SAIL_PIXEL(n) shuffle_index(c0, n), shuffle_index(c1, n), shuffle_index(c2, n), shuffle_index(c3, n)
+    return _mm512_broadcast_i32x4(_mm_setr_epi8(SAIL_PIXEL(0), SAIL_PIXEL(4), SAIL_PIXEL(8), SAIL_PIXEL(12)));
+#undef SAIL_PIXEL
+}
+
+static inline void shuffle_row(const uint8_t* input, uint8_t* output, unsigned width, __m512i mask, int set_mask)
+{
+    const __m512i set = _mm512_set1_epi32(set_mask);
+    unsigned i        = 0;
+
+    for (; i + 16 <= width; i += 16)
+    {
+        const __m512i pixels = _mm512_loadu_si512(input + i * 4);
+        _mm512_storeu_si512(output + i * 4, _mm512_or_si512(_mm512_shuffle_epi8(pixels, mask), set));
+    }
+
+    if (i < width)
+    {
+        const __mmask16 tail = (__mmask16)((1u << (width - i)) - 1);
+        const __m512i pixels = _mm512_maskz_loadu_epi32(tail, input + i * 4);
+        _mm512_mask_storeu_epi32(output + i * 4, tail, _mm512_or_si512(_mm512_shuffle_epi8(pixels, mask), set));
+    }
+}
+
+#define SAIL_UNPACK_RGBA32_KIND(name, set_mask, r, g, b, a)                                                            \
+    static void unpack_##name(const uint8_t* input, sail_rgba32_t* output, unsigned width,                             \
+                              const sail_rgba32_t* palette)                                                            \
+    {                                                                                                                  \
+        (void)palette;                                                                                                 \
+        shuffle_row(input, (uint8_t*)output, width, pixel_shuffle_mask(r, g, b, a), (int)(set_mask));                  \
+    }
+
+/* c0-c3 are the RGBA components stored at bytes 0-3 of the output pixel. */
+#define SAIL_PACK_RGBA32_KIND(name, set_mask, c0, c1, c2, c3)                                                          \
+    static void pack_##name(const sail_rgba32_t* input, uint8_t* output, unsigned width)                               \
+    {                                                                                                                  \
+        shuffle_row((const uint8_t*)input, output, width, pixel_shuffle_mask(c0, c1, c2, c3), (int)(set_mask));        \
+    }
+
+SAIL_UNPACK_RGBA32_KIND(bgra32, 0, 2, 1, 0, 3)
+SAIL_UNPACK_RGBA32_KIND(argb32, 0, 1, 2, 3, 0)
+SAIL_UNPACK_RGBA32_KIND(abgr32, 0, 3, 2, 1, 0)
+SAIL_UNPACK_RGBA32_KIND(rgbx32, 0xFF000000u, 0, 1, 2, -1)
+SAIL_UNPACK_RGBA32_KIND(bgrx32, 0xFF000000u, 2, 1, 0, -1)
+SAIL_UNPACK_RGBA32_KIND(xrgb32, 0xFF000000u, 1, 2, 3, -1)
+SAIL_UNPACK_RGBA32_KIND(xbgr32, 0xFF000000u, 3, 2, 1, -1)
+
+SAIL_PACK_RGBA32_KIND(bgra32, 0, 2, 1, 0, 3)
+SAIL_PACK_RGBA32_KIND(argb32, 0, 3, 0, 1, 2)
+SAIL_PACK_RGBA32_KIND(abgr32, 0, 3, 2, 1, 0)
+SAIL_PACK_RGBA32_KIND(rgbx32, 0xFF000000u, 0, 1, 2, -1)
+SAIL_PACK_RGBA32_KIND(bgrx32, 0xFF000000u, 2, 1, 0, -1)
+SAIL_PACK_RGBA32_KIND(xrgb32, 0x000000FFu, -1, 0, 1, 2)
+SAIL_PACK_RGBA32_KIND(xbgr32, 0x000000FFu, -1, 2, 1, 0)
+
+/*
+ * 1-byte layouts. Sixteen pixels are widened to 32-bit integers at once.
+ */
+
+static void unpack_gray8(const uint8_t* input, sail_rgba32_t* output, unsigned width, const sail_rgba32_t* palette)
+{
+    (void)palette;
+
+    const __m512i spread = _mm512_set1_epi32(0x00010101);
+    const __m512i opaque = _mm512_set1_epi32((int)0xFF000000u);
+    unsigned i           = 0;
+
+    for (; i + 16 <= width; i += 16)
+    {
+        const __m512i gray = _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i*)(input + i)));
+        _mm512_storeu_si512(output + i, _mm512_or_si512(_mm512_mullo_epi32(gray, spread), opaque));
+    }
+
+    sail_unpack_gray8_pixels(input + i, output + i, width - i);
+}
+
+static void unpack_indexed8(const uint8_t* input, sail_rgba32_t* output, unsigned width, const sail_rgba32_t* palette)
+{
+    unsigned i = 0;
+
+    for (; i + 16 <= width; i += 16)
+    {
+        const __m512i indexes = _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i*)(input + i)));
+        _mm512_storeu_si512(output + i, _mm512_i32gather_epi32(indexes, (const void*)palette, 4));
+    }
+
+    sail_unpack_indexed8_pixels(input + i, output + i, width - i, palette);
+}
+
+bool sail_row_kernels_init_avx512(struct sail_row_kernels* kernels)
+{
+    kernels->name = "avx512";
+
+    kernels->unpack[SAIL_ROW_FORMAT_GRAY8]    = unpack_gray8;
+    kernels->unpack[SAIL_ROW_FORMAT_INDEXED8] = unpack_indexed8;
+    kernels->unpack[SAIL_ROW_FORMAT_BGRA32]   = unpack_bgra32;
+    kernels->unpack[SAIL_ROW_FORMAT_ARGB32]   = unpack_argb32;
+    kernels->unpack[SAIL_ROW_FORMAT_ABGR32]   = unpack_abgr32;
+    kernels->unpack[SAIL_ROW_FORMAT_RGBX32]   = unpack_rgbx32;
+    kernels->unpack[SAIL_ROW_FORMAT_BGRX32]   = unpack_bgrx32;
+    kernels->unpack[SAIL_ROW_FORMAT_XRGB32]   = unpack_xrgb32;
+    kernels->unpack[SAIL_ROW_FORMAT_XBGR32]   = unpack_xbgr32;
+
+    kernels->pack[SAIL_ROW_FORMAT_BGRA32] = pack_bgra32;
+    kernels->pack[SAIL_ROW_FORMAT_ARGB32] = pack_argb32;
+    kernels->pack[SAIL_ROW_FORMAT_ABGR32] = pack_abgr32;
+    kernels->pack[SAIL_ROW_FORMAT_RGBX32] = pack_rgbx32;
+    kernels->pack[SAIL_ROW_FORMAT_BGRX32] = pack_bgrx32;
+    kernels->pack[SAIL_ROW_FORMAT_XRGB32] = pack_xrgb32;
+    kernels->pack[SAIL_ROW_FORMAT_XBGR32] = pack_xbgr32;
+
+    return true;
+}
+
+#else
+
+bool sail_row_kernels_init_avx512(struct sail_row_kernels* kernels)
+{
+    (void)kernels;
+
+    return false;
+}
+
+#endif
@@ -0,0 +1,293 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <sail-manip/sail-manip.h>
+
+#include "row_kernels.h"
+
+#ifdef SAIL_HAVE_NEON
+
+#include <arm_neon.h>
+
+/*
+ * NEON kernels. The structure loads and stores de-interleave and interleave up to four
+ * channels, so every kernel works on planes of 16 pixels.
+ */
+
+/* Component N of the RGBA32 planes is taken from plane cN of the input. Negative means 255. */
+static inline uint8x16x4_t to_rgba_planes(uint8x16x4_t planes, int c0, int c1, int c2, int c3)
+{
+    const uint8x16_t opaque = vdupq_n_u8(255);
+    uint8x16x4_t rgba;
+
+    rgba.val[0] = planes.val[c0];
+    rgba.val[1] = planes.val[c1];
+    rgba.val[2] = planes.val[c2];
+    rgba.val[3] = (c3 < 0) ? opaque : planes.val[c3];
+
+    return rgba;
+}
+
+#define SAIL_UNPACK_RGBA32_KIND(name, r, g, b, a)                                                                      \
+    static void unpack_##name(const uint8_t* input, sail_rgba32_t* output, unsigned width,                             \
+                              const sail_rgba32_t* palette)                                                            \
+    {                                                                                                                  \
+        (void)palette;                                                                                                 \
+        unsigned i = 0;                                                                                                \
+        for (; i + 16 <= width; i += 16)                                                                               \
+        {                                                                                                              \
+            vst4q_u8((uint8_t*)(output + i), to_rgba_planes(vld4q_u8(input + i * 4), r, g, b, a));                     \
+        }                                                                                                              \
+        sail_unpack_rgba32_kind_pixels(input + i * 4, output + i, width - i, r, g, b, a);                              \
+    }
+
+/* c0-c3 are the RGBA components stored at bytes 0-3 of the output pixel. */
+#define SAIL_PACK_RGBA32_KIND(name, c0, c1, c2, c3, r, g, b, a, x)                                                     \
+    static void pack_##name(const sail_rgba32_t* input, uint8_t* output, unsigned width)                               \
+    {                                                                                                                  \
+        unsigned i = 0;                                                                                                \
+        for (; i + 16 <= width; i += 16)                                                                               \
+        {                                                                                                              \
+            vst4q_u8(output + i * 4, to_rgba_planes(vld4q_u8((const uint8_t*)(input + i)), c0, c1, c2, c3));           \
+        }                                                                                                              \
+        sail_pack_rgba32_kind_pixels(input + i, output + i * 4, width - i, r, g, b, a, x);                             \
+    }
+
+SAIL_UNPACK_RGBA32_KIND(bgra32, 2, 1, 0, 3)
+SAIL_UNPACK_RGBA32_KIND(argb32, 1, 2, 3, 0)
+SAIL_UNPACK_RGBA32_KIND(abgr32, 3, 2, 1, 0)
+SAIL_UNPACK_RGBA32_KIND(rgbx32, 0, 1, 2, -1)
+SAIL_UNPACK_RGBA32_KIND(bgrx32, 2, 1, 0, -1)
+SAIL_UNPACK_RGBA32_KIND(xrgb32, 1, 2, 3, -1)
+SAIL_UNPACK_RGBA32_KIND(xbgr32, 3, 2, 1, -1)
+
+/* to_rgba_planes() only fills the last plane with 255, so XRGB and XBGR are packed by hand. */
+static void pack_xrgb32(const sail_rgba32_t* input, uint8_t* output, unsigned width)
+{
+    unsigned i = 0;
+
+    for (; i + 16 <= width; i += 16)
+    {
+        const uint8x16x4_t rgba = vld4q_u8((const uint8_t*)(input + i));
+        uint8x16x4_t xrgb;
+
+        xrgb.val[0] = vdupq_n_u8(255);
+        xrgb.val[1] = rgba.val[0];
+        xrgb.val[2] = rgba.val[1];
+        xrgb.val[3] = rgba.val[2];
+
+        vst4q_u8(output + i * 4, xrgb);
+    }
+
+    sail_pack_rgba32_kind_pixels(input + i, output + i * 4, width - i, 1, 2, 3, -1, 0);
+}
+
+static void pack_xbgr32(const sail_rgba32_t* input, uint8_t* output, unsigned width)
+{
+    unsigned i = 0;
+
+    for (; i + 16 <= width; i += 16)
+    {
+        const uint8x16x4_t rgba = vld4q_u8((const uint8_t*)(input + i));
+        uint8x16x4_t xbgr;
+
+        xbgr.val[0] = vdupq_n_u8(255);
+        xbgr.val[1] = rgba.val[2];
+        xbgr.val[2] = rgba.val[1];
+        xbgr.val[3] = rgba.val[0];
+
+        vst4q_u8(output + i * 4, xbgr);
+    }
+
+    sail_pack_rgba32_kind_pixels(input + i, output + i * 4, width - i, 3, 2, 1, -1, 0);
+}
+
+SAIL_PACK_RGBA32_KIND(bgra32, 2, 1, 0, 3, 2, 1, 0, 3, -1)
+SAIL_PACK_RGBA32_KIND(argb32, 3, 0, 1, 2, 1, 2, 3, 0, -1)
+SAIL_PACK_RGBA32_KIND(abgr32, 3, 2, 1, 0, 3, 2, 1, 0, -1)
+SAIL_PACK_RGBA32_KIND(rgbx32, 0, 1, 2, -1, 0, 1, 2, -1, 3)
+SAIL_PACK_RGBA32_KIND(bgrx32, 2, 1, 0, -1, 2, 1, 0, -1, 3)
+
+/*
+ * 3-byte layouts.
+ */
+
+#define SAIL_UNPACK_RGB24_KIND(name, r, g, b)                                                                          \
+    static void unpack_##name(const uint8_t* input, sail_rgba32_t* output, unsigned width,                             \
+                              const sail_rgba32_t* palette)                                                            \
+    {                                                                                                                  \
+        (void)palette;                                                                                                 \
+        unsigned i = 0;                                                                                                \
+        for (; i + 16 <= width; i += 16)                                                                               \
+        {                                                                                                              \
+            const uint8x16x3_t planes = vld3q_u8(input + i * 3);                                                       \
+            uint8x16x4_t rgba;                                                                                         \
+            rgba.val[0] = planes.val[r];                                                                               \
+            rgba.val[1] = planes.val[g];                                                                               \
+            rgba.val[2] = planes.val[b];                                                                               \
+            rgba.val[3] = vdupq_n_u8(255);                                                                             \
+            vst4q_u8((uint8_t*)(output + i), rgba);                                                                    \
+        }                                                                                                              \
+        sail_unpack_rgb24_kind_pixels(input + i * 3, output + i, width - i, r, g, b);                                  \
+    }
+
+#define SAIL_PACK_RGB24_KIND(name, r, g, b)                                                                            \
+    static void pack_##name(const sail_rgba32_t* input, uint8_t* output, unsigned width)                               \
+    {                                                                                                                  \
+        unsigned i = 0;                                                                                                \
+        for (; i + 16 <= width; i += 16)                                                                               \
+        {                                                                                                              \
+            const uint8x16x4_t rgba = vld4q_u8((const uint8_t*)(input + i));                                           \
+            uint8x16x3_t planes;                                                                                       \
+            planes.val[r] = rgba.val[0];                                                                               \
+            planes.val[g] = rgba.val[1];                                                                               \
+            planes.val[b] = rgba.val[2];                                                                               \
+            vst3q_u8(output + i * 3, planes);                                                                          \
+        }                                                                                                              \
+        sail_pack_rgb24_kind_pixels(input + i, output + i * 3, width - i, r, g, b);                                    \
+    }
+
+SAIL_UNPACK_RGB24_KIND(rgb24, 0, 1, 2)
+SAIL_UNPACK_RGB24_KIND(bgr24, 2, 1, 0)
+
+SAIL_PACK_RGB24_KIND(rgb24, 0, 1, 2)
+SAIL_PACK_RGB24_KIND(bgr24, 2, 1, 0)
+
+/*
+ * Grayscale layouts.
+ */
+
+static void unpack_gray8(const uint8_t* input, sail_rgba32_t* output, unsigned width, const sail_rgba32_t* palette)
+{
+    (void)palette;
+
+    unsigned i = 0;
+
+    for (; i + 16 <= width; i += 16)
+    {
+        const uint8x16_t gray = vld1q_u8(input + i);
+        uint8x16x4_t rgba;
+
+        rgba.val[0] = rgba.val[1] = rgba.val[2] = gray;
+        rgba.val[3]                             = vdupq_n_u8(255);
+
+        vst4q_u8((uint8_t*)(output + i), rgba);
+    }
+
+    sail_unpack_gray8_pixels(input + i, output + i, width - i);
+}
+
+static void unpack_gray_alpha16(const uint8_t* input,
+                                sail_rgba32_t* output,
+                                unsigned width,
+                                const sail_rgba32_t* palette)
+{
+    (void)palette;
+
+    unsigned i = 0;
+
+    for (; i + 16 <= width; i += 16)
+    {
+        const uint8x16x2_t gray_alpha = vld2q_u8(input + i * 2);
+        uint8x16x4_t rgba;
+
+        rgba.val[0] = rgba.val[1] = rgba.val[2] = gray_alpha.val[0];
+        rgba.val[3]                             = gray_alpha.val[1];
+
+        vst4q_u8((uint8_t*)(output + i), rgba);
+    }
+
+    sail_unpack_gray_alpha16_pixels(input + i * 2, output + i, width - i);
+}
+
+/* Computes SAIL_RGB8_TO_GRAY8() of eight pixels. The sum fits into 16 bits. */
+static inline uint8x8_t rgb_to_gray(uint8x8_t r, uint8x8_t g, uint8x8_t b)
+{
+    uint16x8_t sum = vmull_u8(r, vdup_n_u8(SAIL_RGB_TO_GRAY_R_WEIGHT));
+    sum            = vmlal_u8(sum, g, vdup_n_u8(SAIL_RGB_TO_GRAY_G_WEIGHT));
+    sum            = vmlal_u8(sum, b, vdup_n_u8(SAIL_RGB_TO_GRAY_B_WEIGHT));
+
+    return vshrn_n_u16(sum, 8);
+}
+
+static void pack_gray8(const sail_rgba32_t* input, uint8_t* output, unsigned width)
+{
+    unsigned i = 0;
+
+    for (; i + 16 <= width; i += 16)
+    {
+        const uint8x16x4_t rgba = vld4q_u8((const uint8_t*)(input + i));
+
+        const uint8x8_t low =
+            rgb_to_gray(vget_low_u8(rgba.val[0]), vget_low_u8(rgba.val[1]), vget_low_u8(rgba.val[2]));
+        const uint8x8_t high =
+            rgb_to_gray(vget_high_u8(rgba.val[0]), vget_high_u8(rgba.val[1]), vget_high_u8(rgba.val[2]));
+
+        vst1q_u8(output + i, vcombine_u8(low, high));
+    }
+
+    sail_pack_gray8_pixels(input + i, output + i, width - i);
+}
+
+bool sail_row_kernels_init_neon(struct sail_row_kernels* kernels)
+{
+    kernels->name = "neon";
+
+    kernels->unpack[SAIL_ROW_FORMAT_GRAY8]        = unpack_gray8;
+    kernels->unpack[SAIL_ROW_FORMAT_GRAY_ALPHA16] = unpack_gray_alpha16;
+    kernels->unpack[SAIL_ROW_FORMAT_RGB24]        = unpack_rgb24;
+    kernels->unpack[SAIL_ROW_FORMAT_BGR24]        = unpack_bgr24;
+    kernels->unpack[SAIL_ROW_FORMAT_BGRA32]       = unpack_bgra32;
+    kernels->unpack[SAIL_ROW_FORMAT_ARGB32]       = unpack_argb32;
+    kernels->unpack[SAIL_ROW_FORMAT_ABGR32]       = unpack_abgr32;
+    kernels->unpack[SAIL_ROW_FORMAT_RGBX32]       = unpack_rgbx32;
+    kernels->unpack[SAIL_ROW_FORMAT_BGRX32]       = unpack_bgrx32;
+    kernels->unpack[SAIL_ROW_FORMAT_XRGB32]       = unpack_xrgb32;
+    kernels->unpack[SAIL_ROW_FORMAT_XBGR32]       = unpack_xbgr32;
+
+    kernels->pack[SAIL_ROW_FORMAT_GRAY8]  = pack_gray8;
+    kernels->pack[SAIL_ROW_FORMAT_RGB24]  = pack_rgb24;
+    kernels->pack[SAIL_ROW_FORMAT_BGR24]  = pack_bgr24;
+    kernels->pack[SAIL_ROW_FORMAT_BGRA32] = pack_bgra32;
+    kernels->pack[SAIL_ROW_FORMAT_ARGB32] = pack_argb32;
+    kernels->pack[SAIL_ROW_FORMAT_ABGR32] = pack_abgr32;
+    kernels->pack[SAIL_ROW_FORMAT_RGBX32] = pack_rgbx32;
+    kernels->pack[SAIL_ROW_FORMAT_BGRX32] = pack_bgrx32;
+    kernels->pack[SAIL_ROW_FORMAT_XRGB32] = pack_xrgb32;
+    kernels->pack[SAIL_ROW_FORMAT_XBGR32] = pack_xbgr32;
+
+    return true;
+}
+
+#else
+
+bool sail_row_kernels_init_neon(struct sail_row_kernels* kernels)
+{
+    (void)kernels;
+
+    return false;
+}
+
+#endif
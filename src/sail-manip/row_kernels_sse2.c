@@ -0,0 +1,267 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <sail-manip/sail-manip.h>
+
+#include "row_kernels.h"
+
+#ifdef SAIL_HAVE_SSE2
+
+#include <emmintrin.h>
+
+/*
+ * SSE2 kernels. SSE2 has no byte shuffles, so the 4-byte layouts are permuted with shifts
+ * and masks on 32-bit pixels, and 3-byte layouts are left to the scalar kernels.
+ */
+
+/* Byte permutations of 32-bit little-endian pixels. */
+enum SailPixelPermutation
+{
+    SAIL_PERMUTATION_NONE,
+    /* Swap bytes 0 and 2: BGRA <-> RGBA. */
+    SAIL_PERMUTATION_SWAP_02,
+    /* Move every byte one position down: ARGB -> RGBA. */
+    SAIL_PERMUTATION_ROTATE_DOWN,
+    /* Move every byte one position up: RGBA -> ARGB. */
+    SAIL_PERMUTATION_ROTATE_UP,
+    /* Reverse the bytes: ABGR <-> RGBA. */
+    SAIL_PERMUTATION_REVERSE,
+};
+
+static inline __m128i permute_pixels(__m128i pixels, enum SailPixelPermutation permutation, uint32_t set_mask)
+{
+    switch (permutation)
+    {
+    case SAIL_PERMUTATION_NONE:
+    {
+        break;
+    }
+    case SAIL_PERMUTATION_SWAP_02:
+    {
+        const __m128i ga = _mm_and_si128(pixels, _mm_set1_epi32((int)0xFF00FF00));
+        const __m128i r  = _mm_and_si128(_mm_srli_epi32(pixels, 16), _mm_set1_epi32(0x000000FF));
+        const __m128i b  = _mm_and_si128(_mm_slli_epi32(pixels, 16), _mm_set1_epi32(0x00FF0000));
+
+        pixels = _mm_or_si128(ga, _mm_or_si128(r, b));
+        break;
+    }
+    case SAIL_PERMUTATION_ROTATE_DOWN:
+    {
+        pixels = _mm_or_si128(_mm_srli_epi32(pixels, 8), _mm_slli_epi32(pixels, 24));
+        break;
+    }
+    case SAIL_PERMUTATION_ROTATE_UP:
+    {
+        pixels = _mm_or_si128(_mm_slli_epi32(pixels, 8), _mm_srli_epi32(pixels, 24));
+        break;
+    }
+    case SAIL_PERMUTATION_REVERSE:
+    {
+        const __m128i byte0 = _mm_srli_epi32(pixels, 24);
+        const __m128i byte1 = _mm_and_si128(_mm_srli_epi32(pixels, 8), _mm_set1_epi32(0x0000FF00));
+        const __m128i byte2 = _mm_and_si128(_mm_slli_epi32(pixels, 8), _mm_set1_epi32(0x00FF0000));
+        const __m128i byte3 = _mm_slli_epi32(pixels, 24);
+
+        pixels = _mm_or_si128(_mm_or_si128(byte0, byte1), _mm_or_si128(byte2, byte3));
+        break;
+    }
+    }
+
+    return (set_mask != 0) ? _mm_or_si128(pixels, _mm_set1_epi32((int)set_mask)) : pixels;
+}
+
+static inline unsigned permute_row(const uint8_t* input,
+                                   uint8_t* output,
+                                   unsigned width,
+                                   enum SailPixelPermutation permutation,
+                                   uint32_t set_mask)
+{
+    unsigned i = 0;
+
+    for (; i + 4 <= width; i += 4)
+    {
+        const __m128i pixels = _mm_loadu_si128((const __m128i*)(input + i * 4));
+        _mm_storeu_si128((__m128i*)(output + i * 4), permute_pixels(pixels, permutation, set_mask));
+    }
+
+    return i;
+}
+
+#define SAIL_UNPACK_RGBA32_KIND(name, permutation, set_mask, r, g, b, a)                                               \
+    static void unpack_##name(const uint8_t* input, sail_rgba32_t* output, unsigned width,                             \
+                              const sail_rgba32_t* palette)                                                            \
+    {                                                                                                                  \
+        (void)palette;                                                                                                 \
+        const unsigned i = permute_row(input, (uint8_t*)output, width, permutation, set_mask);                         \
+        sail_unpack_rgba32_kind_pixels(input + i * 4, output + i, width - i, r, g, b, a);                              \
+    }
+
+#define SAIL_PACK_RGBA32_KIND(name, permutation, set_mask, r, g, b, a, x)                                              \
+    static void pack_##name(const sail_rgba32_t* input, uint8_t* output, unsigned width)                               \
+    {                                                                                                                  \
+        const unsigned i = permute_row((const uint8_t*)input, output, width, permutation, set_mask);                   \
+        sail_pack_rgba32_kind_pixels(input + i, output + i * 4, width - i, r, g, b, a, x);                             \
+    }
+
+SAIL_UNPACK_RGBA32_KIND(bgra32, SAIL_PERMUTATION_SWAP_02, 0, 2, 1, 0, 3)
+SAIL_UNPACK_RGBA32_KIND(argb32, SAIL_PERMUTATION_ROTATE_DOWN, 0, 1, 2, 3, 0)
+SAIL_UNPACK_RGBA32_KIND(abgr32, SAIL_PERMUTATION_REVERSE, 0, 3, 2, 1, 0)
+SAIL_UNPACK_RGBA32_KIND(rgbx32, SAIL_PERMUTATION_NONE, 0xFF000000u, 0, 1, 2, -1)
+SAIL_UNPACK_RGBA32_KIND(bgrx32, SAIL_PERMUTATION_SWAP_02, 0xFF000000u, 2, 1, 0, -1)
+SAIL_UNPACK_RGBA32_KIND(xrgb32, SAIL_PERMUTATION_ROTATE_DOWN, 0xFF000000u, 1, 2, 3, -1)
+SAIL_UNPACK_RGBA32_KIND(xbgr32, SAIL_PERMUTATION_REVERSE, 0xFF000000u, 3, 2, 1, -1)
+
+SAIL_PACK_RGBA32_KIND(bgra32, SAIL_PERMUTATION_SWAP_02, 0, 2, 1, 0, 3, -1)
+SAIL_PACK_RGBA32_KIND(argb32, SAIL_PERMUTATION_ROTATE_UP, 0, 1, 2, 3, 0, -1)
+SAIL_PACK_RGBA32_KIND(abgr32, SAIL_PERMUTATION_REVERSE, 0, 3, 2, 1, 0, -1)
+SAIL_PACK_RGBA32_KIND(rgbx32, SAIL_PERMUTATION_NONE, 0xFF000000u, 0, 1, 2, -1, 3)
+SAIL_PACK_RGBA32_KIND(bgrx32, SAIL_PERMUTATION_SWAP_02, 0xFF000000u, 2, 1, 0, -1, 3)
+SAIL_PACK_RGBA32_KIND(xrgb32, SAIL_PERMUTATION_ROTATE_UP, 0x000000FFu, 1, 2, 3, -1, 0)
+SAIL_PACK_RGBA32_KIND(xbgr32, SAIL_PERMUTATION_REVERSE, 0x000000FFu, 3, 2, 1, -1, 0)
+
+static void unpack_gray8(const uint8_t* input, sail_rgba32_t* output, unsigned width, const sail_rgba32_t* palette)
+{
+    (void)palette;
+
+    const __m128i opaque = _mm_set1_epi8((char)0xFF);
+    unsigned i           = 0;
+
+    for (; i + 16 <= width; i += 16)
+    {
+        const __m128i gray = _mm_loadu_si128((const __m128i*)(input + i));
+
+        /* Bytes g,g and g,255, then interleaved into g,g,g,255. */
+        const __m128i gg_low  = _mm_unpacklo_epi8(gray, gray);
+        const __m128i gg_high = _mm_unpackhi_epi8(gray, gray);
+        const __m128i ga_low  = _mm_unpacklo_epi8(gray, opaque);
+        const __m128i ga_high = _mm_unpackhi_epi8(gray, opaque);
+        __m128i* const scan   = (__m128i*)(output + i);
+
+        _mm_storeu_si128(scan + 0, _mm_unpacklo_epi16(gg_low, ga_low));
+        _mm_storeu_si128(scan + 1, _mm_unpackhi_epi16(gg_low, ga_low));
+        _mm_storeu_si128(scan + 2, _mm_unpacklo_epi16(gg_high, ga_high));
+        _mm_storeu_si128(scan + 3, _mm_unpackhi_epi16(gg_high, ga_high));
+    }
+
+    sail_unpack_gray8_pixels(input + i, output + i, width - i);
+}
+
+static void unpack_gray_alpha16(const uint8_t* input,
+                                sail_rgba32_t* output,
+                                unsigned width,
+                                const sail_rgba32_t* palette)
+{
+    (void)palette;
+
+    unsigned i = 0;
+
+    for (; i + 8 <= width; i += 8)
+    {
+        /* Every 16-bit word is g,a. Build g,g words and interleave them into g,g,g,a. */
+        const __m128i gray_alpha = _mm_loadu_si128((const __m128i*)(input + i * 2));
+        const __m128i gray       = _mm_and_si128(gray_alpha, _mm_set1_epi16(0x00FF));
+        const __m128i gray_gray  = _mm_or_si128(gray, _mm_slli_epi16(gray, 8));
+        __m128i* const scan      = (__m128i*)(output + i);
+
+        _mm_storeu_si128(scan + 0, _mm_unpacklo_epi16(gray_gray, gray_alpha));
+        _mm_storeu_si128(scan + 1, _mm_unpackhi_epi16(gray_gray, gray_alpha));
+    }
+
+    sail_unpack_gray_alpha16_pixels(input + i * 2, output + i, width - i);
+}
+
+/* Computes SAIL_RGB8_TO_GRAY8() of four RGBA32 pixels as 32-bit integers. */
+static inline __m128i rgba32_to_gray(__m128i pixels)
+{
+    const __m128i rb = _mm_and_si128(pixels, _mm_set1_epi32(0x00FF00FF));
+    const __m128i g  = _mm_and_si128(_mm_srli_epi32(pixels, 8), _mm_set1_epi32(0x000000FF));
+
+    const __m128i rb_weights = _mm_set1_epi32(SAIL_RGB_TO_GRAY_R_WEIGHT | (SAIL_RGB_TO_GRAY_B_WEIGHT << 16));
+    const __m128i g_weights  = _mm_set1_epi32(SAIL_RGB_TO_GRAY_G_WEIGHT);
+
+    const __m128i sum = _mm_add_epi32(_mm_madd_epi16(rb, rb_weights), _mm_madd_epi16(g, g_weights));
+
+    return _mm_srli_epi32(sum, 8);
+}
+
+static void pack_gray8(const sail_rgba32_t* input, uint8_t* output, unsigned width)
+{
+    unsigned i = 0;
+
+    for (; i + 16 <= width; i += 16)
+    {
+        const __m128i* const scan = (const __m128i*)(input + i);
+
+        const __m128i gray0 = rgba32_to_gray(_mm_loadu_si128(scan + 0));
+        const __m128i gray1 = rgba32_to_gray(_mm_loadu_si128(scan + 1));
+        const __m128i gray2 = rgba32_to_gray(_mm_loadu_si128(scan + 2));
+        const __m128i gray3 = rgba32_to_gray(_mm_loadu_si128(scan + 3));
+
+        /* The values fit into 8 bits, so saturation never happens. */
+        const __m128i gray01 = _mm_packs_epi32(gray0, gray1);
+        const __m128i gray23 = _mm_packs_epi32(gray2, gray3);
+
+        _mm_storeu_si128((__m128i*)(output + i), _mm_packus_epi16(gray01, gray23));
+    }
+
+    sail_pack_gray8_pixels(input + i, output + i, width - i);
+}
+
+bool sail_row_kernels_init_sse2(struct sail_row_kernels* kernels)
+{
+    kernels->name = "sse2";
+
+    kernels->unpack[SAIL_ROW_FORMAT_GRAY8]        = unpack_gray8;
+    kernels->unpack[SAIL_ROW_FORMAT_GRAY_ALPHA16] = unpack_gray_alpha16;
+    kernels->unpack[SAIL_ROW_FORMAT_BGRA32]       = unpack_bgra32;
+    kernels->unpack[SAIL_ROW_FORMAT_ARGB32]       = unpack_argb32;
+    kernels->unpack[SAIL_ROW_FORMAT_ABGR32]       = unpack_abgr32;
+    kernels->unpack[SAIL_ROW_FORMAT_RGBX32]       = unpack_rgbx32;
+    kernels->unpack[SAIL_ROW_FORMAT_BGRX32]       = unpack_bgrx32;
+    kernels->unpack[SAIL_ROW_FORMAT_XRGB32]       = unpack_xrgb32;
+    kernels->unpack[SAIL_ROW_FORMAT_XBGR32]       = unpack_xbgr32;
+
+    kernels->pack[SAIL_ROW_FORMAT_GRAY8]  = pack_gray8;
+    kernels->pack[SAIL_ROW_FORMAT_BGRA32] = pack_bgra32;
+    kernels->pack[SAIL_ROW_FORMAT_ARGB32] = pack_argb32;
+    kernels->pack[SAIL_ROW_FORMAT_ABGR32] = pack_abgr32;
+    kernels->pack[SAIL_ROW_FORMAT_RGBX32] = pack_rgbx32;
+    kernels->pack[SAIL_ROW_FORMAT_BGRX32] = pack_bgrx32;
+    kernels->pack[SAIL_ROW_FORMAT_XRGB32] = pack_xrgb32;
+    kernels->pack[SAIL_ROW_FORMAT_XBGR32] = pack_xbgr32;
+
+    return true;
+}
+
+#else
+
+bool sail_row_kernels_init_sse2(struct sail_row_kernels* kernels)
+{
+    (void)kernels;
+
+    return false;
+}
+
+#endif
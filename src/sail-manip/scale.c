@@ -49,11 +49,11 @@ static sail_status_t scale_with_manual(const struct sail_image* src_image,
  * Public functions.
  */
 
-sail_status_t sail_scale_image(const struct sail_image* image,
-                               unsigned new_width,
-                               unsigned new_height,
-                               enum SailScaling algorithm,
-                               struct sail_image** image_output)
+static sail_status_t scale_image(const struct sail_image* image,
+                                 unsigned new_width,
+                                 unsigned new_height,
+                                 enum SailScaling algorithm,
+                                 struct sail_image** image_output)
 {
     SAIL_TRY(sail_check_image_valid(image));
     SAIL_CHECK_PTR(image_output);
@@ -202,6 +202,19 @@ sail_status_t sail_scale_image(const struct sail_image* image,
     return SAIL_OK;
 }
 
+sail_status_t sail_scale_image(const struct sail_image* image,
+                               unsigned new_width,
+                               unsigned new_height,
+                               enum SailScaling algorithm,
+                               struct sail_image** image_output)
+{
+    sail_trace_begin("sail_scale_image", "manip");
+    const sail_status_t status = scale_image(image, new_width, new_height, algorithm, image_output);
+    sail_trace_end("sail_scale_image", "manip");
+
+    return status;
+}
+
 /*
  * Manual scaling implementation (fallback when swscale is not available or fails).
  */
@@ -567,13 +580,13 @@ WRITE_PIXEL_16BIT_TEMPLATE(write_bgra64, 8, 4, 2, 0, 6)
                                     uint8_t* dst_pixels,                                                         \
                                     unsigned dst_width,                                                          \
                                     unsigned dst_height,                                                         \
-                                    unsigned dst_bytes_per_line)                                                 \
+                                    unsigned dst_bytes_per_line,                                                 \
+                                    unsigned row_begin,                                                          \
+                                    unsigned row_end)                                                            \
     {                                                                                                            \
         const double x_scale = (double)src_width / (double)dst_width;                                            \
         const double y_scale = (double)src_height / (double)dst_height;                                          \
-        unsigned row;                                                                                            \
-        SAIL_OMP_PARALLEL_FOR                                                                                    \
-        for (row = 0; row < dst_height; row++)                                                                   \
+        for (unsigned row = row_begin; row < row_end; row++)                                                     \
         {                                                                                                        \
             const int src_y   = (int)((double)row * y_scale + 0.5);                                              \
             uint8_t* dst_scan = dst_pixels + row * dst_bytes_per_line;                                           \
@@ -597,13 +610,13 @@ WRITE_PIXEL_16BIT_TEMPLATE(write_bgra64, 8, 4, 2, 0, 6)
                                     uint8_t* dst_pixels,                                                           \
                                     unsigned dst_width,                                                            \
                                     unsigned dst_height,                                                           \
-                                    unsigned dst_bytes_per_line)                                                   \
+                                    unsigned dst_bytes_per_line,                                                   \
+                                    unsigned row_begin,                                                            \
+                                    unsigned row_end)                                                              \
     {                                                                                                              \
         const double x_scale = (double)src_width / (double)dst_width;                                              \
         const double y_scale = (double)src_height / (double)dst_height;                                            \
-        unsigned row;                                                                                              \
-        SAIL_OMP_PARALLEL_FOR                                                                                      \
-        for (row = 0; row < dst_height; row++)                                                                     \
+        for (unsigned row = row_begin; row < row_end; row++)                                                       \
         {                                                                                                          \
             const int src_y   = (int)((double)row * y_scale + 0.5);                                                \
             uint8_t* dst_scan = dst_pixels + row * dst_bytes_per_line;                                             \
@@ -626,13 +639,13 @@ WRITE_PIXEL_16BIT_TEMPLATE(write_bgra64, 8, 4, 2, 0, 6)
                                     uint8_t* dst_pixels,                                                 \
                                     unsigned dst_width,                                                  \
                                     unsigned dst_height,                                                 \
-                                    unsigned dst_bytes_per_line)                                         \
+                                    unsigned dst_bytes_per_line,                                         \
+                                    unsigned row_begin,                                                  \
+                                    unsigned row_end)                                                    \
     {                                                                                                    \
         const double x_scale = (double)src_width / (double)dst_width;                                    \
         const double y_scale = (double)src_height / (double)dst_height;                                  \
-        unsigned row;                                                                                    \
-        SAIL_OMP_PARALLEL_FOR                                                                            \
-        for (row = 0; row < dst_height; row++)                                                           \
+        for (unsigned row = row_begin; row < row_end; row++)                                             \
         {                                                                                                \
             const int src_y   = (int)((double)row * y_scale + 0.5);                                      \
             uint8_t* dst_scan = dst_pixels + row * dst_bytes_per_line;                                   \
@@ -656,13 +669,13 @@ WRITE_PIXEL_16BIT_TEMPLATE(write_bgra64, 8, 4, 2, 0, 6)
                                     uint8_t* dst_pixels,                                                           \
                                     unsigned dst_width,                                                            \
                                     unsigned dst_height,                                                           \
-                                    unsigned dst_bytes_per_line)                                                   \
+                                    unsigned dst_bytes_per_line,                                                   \
+                                    unsigned row_begin,                                                            \
+                                    unsigned row_end)                                                              \
     {                                                                                                              \
         const double x_scale = (double)src_width / (double)dst_width;                                              \
         const double y_scale = (double)src_height / (double)dst_height;                                            \
-        unsigned row;                                                                                              \
-        SAIL_OMP_PARALLEL_FOR                                                                                      \
-        for (row = 0; row < dst_height; row++)                                                                     \
+        for (unsigned row = row_begin; row < row_end; row++)                                                       \
         {                                                                                                          \
             const double src_y = (double)row * y_scale;                                                            \
             const int y0       = (int)src_y;                                                                       \
@@ -707,13 +720,13 @@ WRITE_PIXEL_16BIT_TEMPLATE(write_bgra64, 8, 4, 2, 0, 6)
                                     uint8_t* dst_pixels,                                                        \
                                     unsigned dst_width,                                                         \
                                     unsigned dst_height,                                                        \
-                                    unsigned dst_bytes_per_line)                                                \
+                                    unsigned dst_bytes_per_line,                                                \
+                                    unsigned row_begin,                                                         \
+                                    unsigned row_end)                                                           \
     {                                                                                                           \
         const double x_scale = (double)src_width / (double)dst_width;                                           \
         const double y_scale = (double)src_height / (double)dst_height;                                         \
-        unsigned row;                                                                                           \
-        SAIL_OMP_PARALLEL_FOR                                                                                   \
-        for (row = 0; row < dst_height; row++)                                                                  \
+        for (unsigned row = row_begin; row < row_end; row++)                                                    \
         {                                                                                                       \
             const double src_y = (double)row * y_scale;                                                         \
             const int y0       = (int)src_y;                                                                    \
@@ -750,13 +763,13 @@ WRITE_PIXEL_16BIT_TEMPLATE(write_bgra64, 8, 4, 2, 0, 6)
                                     uint8_t* dst_pixels,                                                    \
                                     unsigned dst_width,                                                     \
                                     unsigned dst_height,                                                    \
-                                    unsigned dst_bytes_per_line)                                            \
+                                    unsigned dst_bytes_per_line,                                            \
+                                    unsigned row_begin,                                                     \
+                                    unsigned row_end)                                                       \
     {                                                                                                       \
         const double x_scale = (double)src_width / (double)dst_width;                                       \
         const double y_scale = (double)src_height / (double)dst_height;                                     \
-        unsigned row;                                                                                       \
-        SAIL_OMP_PARALLEL_FOR                                                                               \
-        for (row = 0; row < dst_height; row++)                                                              \
+        for (unsigned row = row_begin; row < row_end; row++)                                                \
         {                                                                                                   \
             const double src_y = (double)row * y_scale;                                                     \
             const int y0       = (int)src_y;                                                                \
@@ -795,13 +808,13 @@ WRITE_PIXEL_16BIT_TEMPLATE(write_bgra64, 8, 4, 2, 0, 6)
                                     uint8_t* dst_pixels,                                                         \
                                     unsigned dst_width,                                                          \
                                     unsigned dst_height,                                                         \
-                                    unsigned dst_bytes_per_line)                                                 \
+                                    unsigned dst_bytes_per_line,                                                 \
+                                    unsigned row_begin,                                                          \
+                                    unsigned row_end)                                                            \
     {                                                                                                            \
         const double x_scale = (double)src_width / (double)dst_width;                                            \
         const double y_scale = (double)src_height / (double)dst_height;                                          \
-        unsigned row;                                                                                            \
-        SAIL_OMP_PARALLEL_FOR                                                                                    \
-        for (row = 0; row < dst_height; row++)                                                                   \
+        for (unsigned row = row_begin; row < row_end; row++)                                                     \
         {                                                                                                        \
             const double src_y = (double)row * y_scale;                                                          \
             const int y0       = (int)floor(src_y);                                                              \
@@ -855,13 +868,13 @@ WRITE_PIXEL_16BIT_TEMPLATE(write_bgra64, 8, 4, 2, 0, 6)
                                     uint8_t* dst_pixels,                                                               \
                                     unsigned dst_width,                                                                \
                                     unsigned dst_height,                                                               \
-                                    unsigned dst_bytes_per_line)                                                       \
+                                    unsigned dst_bytes_per_line,                                                       \
+                                    unsigned row_begin,                                                                \
+                                    unsigned row_end)                                                                  \
     {                                                                                                                  \
         const double x_scale = (double)src_width / (double)dst_width;                                                  \
         const double y_scale = (double)src_height / (double)dst_height;                                                \
-        unsigned row;                                                                                                  \
-        SAIL_OMP_PARALLEL_FOR                                                                                          \
-        for (row = 0; row < dst_height; row++)                                                                         \
+        for (unsigned row = row_begin; row < row_end; row++)                                                           \
         {                                                                                                              \
             const double src_y = (double)row * y_scale;                                                                \
             const int y0       = (int)floor(src_y);                                                                    \
@@ -907,14 +920,14 @@ WRITE_PIXEL_16BIT_TEMPLATE(write_bgra64, 8, 4, 2, 0, 6)
                                     uint8_t* dst_pixels,                                                         \
                                     unsigned dst_width,                                                          \
                                     unsigned dst_height,                                                         \
-                                    unsigned dst_bytes_per_line)                                                 \
+                                    unsigned dst_bytes_per_line,                                                 \
+                                    unsigned row_begin,                                                          \
+                                    unsigned row_end)                                                            \
     {                                                                                                            \
         const int lanczos_a  = 3;                                                                                \
         const double x_scale = (double)src_width / (double)dst_width;                                            \
         const double y_scale = (double)src_height / (double)dst_height;                                          \
-        unsigned row;                                                                                            \
-        SAIL_OMP_PARALLEL_FOR                                                                                    \
-        for (row = 0; row < dst_height; row++)                                                                   \
+        for (unsigned row = row_begin; row < row_end; row++)                                                     \
         {                                                                                                        \
             const double src_y = (double)row * y_scale;                                                          \
             const int y0       = (int)floor(src_y);                                                              \
@@ -970,14 +983,14 @@ WRITE_PIXEL_16BIT_TEMPLATE(write_bgra64, 8, 4, 2, 0, 6)
                                     uint8_t* dst_pixels,                                                               \
                                     unsigned dst_width,                                                                \
                                     unsigned dst_height,                                                               \
-                                    unsigned dst_bytes_per_line)                                                       \
+                                    unsigned dst_bytes_per_line,                                                       \
+                                    unsigned row_begin,                                                                \
+                                    unsigned row_end)                                                                  \
     {                                                                                                                  \
         const int lanczos_a  = 3;                                                                                      \
         const double x_scale = (double)src_width / (double)dst_width;                                                  \
         const double y_scale = (double)src_height / (double)dst_height;                                                \
-        unsigned row;                                                                                                  \
-        SAIL_OMP_PARALLEL_FOR                                                                                          \
-        for (row = 0; row < dst_height; row++)                                                                         \
+        for (unsigned row = row_begin; row < row_end; row++)                                                           \
         {                                                                                                              \
             const double src_y = (double)row * y_scale;                                                                \
             const int y0       = (int)floor(src_y);                                                                    \
@@ -1142,7 +1155,44 @@ typedef sail_status_t (*scale_func_t)(const uint8_t* src_pixels,
                                       uint8_t* dst_pixels,
                                       unsigned dst_width,
                                       unsigned dst_height,
-                                      unsigned dst_bytes_per_line);
+                                      unsigned dst_bytes_per_line,
+                                      unsigned row_begin,
+                                      unsigned row_end);
+
+/*
+ * Arguments of the parallel scaling loop.
+ */
+struct scale_context
+{
+    scale_func_t scale_func;
+    const struct sail_image* src_image;
+    struct sail_image* dst_image;
+};
+
+static sail_status_t scale_rows(void* context, unsigned row_begin, unsigned row_end)
+{
+    const struct scale_context* scale_context = context;
+    const struct sail_image* src_image        = scale_context->src_image;
+    struct sail_image* dst_image              = scale_context->dst_image;
+
+    return scale_context->scale_func((const uint8_t*)src_image->pixels, src_image->width, src_image->height,
+                                     src_image->bytes_per_line, (uint8_t*)dst_image->pixels, dst_image->width,
+                                     dst_image->height, dst_image->bytes_per_line, row_begin, row_end);
+}
+
+/*
+ * Scales the destination rows in parallel.
+ */
+static sail_status_t run_scale_func(scale_func_t scale_func,
+                                    const struct sail_image* src_image,
+                                    struct sail_image* dst_image)
+{
+    struct scale_context scale_context = {scale_func, src_image, dst_image};
+
+    SAIL_TRY(sail_parallel_for(dst_image->height, 0 /* max threads */, scale_rows, &scale_context));
+
+    return SAIL_OK;
+}
 
 /*
  * Format dispatcher structure.
@@ -1257,9 +1307,7 @@ static sail_status_t scale_with_manual(const struct sail_image* src_image,
         }
 
         /* Perform scaling. */
-        return scale_func((const uint8_t*)src_image->pixels, src_image->width, src_image->height,
-                          src_image->bytes_per_line, (uint8_t*)dst_image->pixels, dst_image->width, dst_image->height,
-                          dst_image->bytes_per_line);
+        return run_scale_func(scale_func, src_image, dst_image);
     }
 
     /* Fallback: convert to RGBA32/64, scale, then convert back. */
@@ -1358,9 +1406,7 @@ static sail_status_t scale_with_manual(const struct sail_image* src_image,
         return SAIL_ERROR_UNSUPPORTED_PIXEL_FORMAT;
     }
 
-    status = scale_func((const uint8_t*)rgba_image->pixels, rgba_image->width, rgba_image->height,
-                        rgba_image->bytes_per_line, (uint8_t*)rgba_output->pixels, rgba_output->width,
-                        rgba_output->height, rgba_output->bytes_per_line);
+    status = run_scale_func(scale_func, rgba_image, rgba_output);
 
     sail_destroy_image(rgba_image);
 
@@ -110,34 +110,70 @@ static enum AVPixelFormat sail_to_av_pixel_format(enum SailPixelFormat sail_pix_
     }
 }
 
-/* Check if swscale supports this conversion. */
-static bool swscale_supports_conversion(enum AVPixelFormat src_fmt, enum AVPixelFormat dst_fmt)
+/*
+ * Public functions.
+ */
+
+struct SwsContext* sail_alloc_swscale_conversion(enum SailPixelFormat input_pixel_format,
+                                                 enum SailPixelFormat output_pixel_format,
+                                                 unsigned width,
+                                                 unsigned height)
 {
-    if (src_fmt == AV_PIX_FMT_NONE || dst_fmt == AV_PIX_FMT_NONE)
+    /* Convert formats to AVPixelFormat. */
+    const enum AVPixelFormat src_av = sail_to_av_pixel_format(input_pixel_format);
+    const enum AVPixelFormat dst_av = sail_to_av_pixel_format(output_pixel_format);
+
+    if (src_av == AV_PIX_FMT_NONE || dst_av == AV_PIX_FMT_NONE)
     {
-        return false;
+        return NULL;
+    }
+
+    /* Skip indexed formats - swscale doesn't handle palette directly. */
+    if (src_av == AV_PIX_FMT_PAL8 || sail_is_indexed(input_pixel_format))
+    {
+        return NULL;
     }
 
     /* Check if formats are supported. */
-    if (!sws_isSupportedInput(src_fmt) || !sws_isSupportedOutput(dst_fmt))
+    if (!sws_isSupportedInput(src_av) || !sws_isSupportedOutput(dst_av))
     {
-        return false;
+        return NULL;
     }
 
-    /* Try to create a context to verify conversion is possible. */
-    struct SwsContext* test_ctx = sws_getContext(1, 1, src_fmt, 1, 1, dst_fmt, SWS_BILINEAR, NULL, NULL, NULL);
-    if (test_ctx == NULL)
+    /* Creating the context verifies the conversion is possible. */
+    return sws_getContext((int)width, (int)height, src_av, (int)width, (int)height, dst_av,
+                          SWS_BILINEAR | SWS_ACCURATE_RND, NULL, NULL, NULL);
+}
+
+bool sail_execute_swscale_conversion(struct SwsContext* sws_context,
+                                     const struct sail_image* image_input,
+                                     struct sail_image* image_output)
+{
+    /* Prepare source data pointers. */
+    const uint8_t* src_data[4] = {(const uint8_t*)image_input->pixels, NULL, NULL, NULL};
+    int src_linesize[4]        = {(int)image_input->bytes_per_line, 0, 0, 0};
+
+    /* Prepare destination data pointers. */
+    uint8_t* dst_data[4] = {(uint8_t*)image_output->pixels, NULL, NULL, NULL};
+    int dst_linesize[4]  = {(int)image_output->bytes_per_line, 0, 0, 0};
+
+    /* Perform conversion. */
+    int result = sws_scale(sws_context, src_data, src_linesize, 0, image_input->height, dst_data, dst_linesize);
+
+    if (result < 0 || result != (int)image_output->height)
     {
+        SAIL_LOG_ERROR("SWSCALE: Conversion failed or incomplete (result: %d, expected: %u)", result,
+                       image_output->height);
         return false;
     }
-    sws_freeContext(test_ctx);
 
     return true;
 }
 
-/*
- * Public functions.
- */
+void sail_destroy_swscale_conversion(struct SwsContext* sws_context)
+{
+    sws_freeContext(sws_context);
+}
 
 bool sail_try_swscale_conversion(const struct sail_image* image_input,
                                  struct sail_image* image_output,
@@ -149,53 +185,22 @@ bool sail_try_swscale_conversion(const struct sail_image* image_input,
         return false;
     }
 
-    /* Convert formats to AVPixelFormat. */
-    enum AVPixelFormat src_av = sail_to_av_pixel_format(image_input->pixel_format);
-    enum AVPixelFormat dst_av = sail_to_av_pixel_format(output_pixel_format);
-
-    /* Check if swscale supports this conversion. */
-    if (!swscale_supports_conversion(src_av, dst_av))
-    {
-        return false;
-    }
-
-    /* Skip indexed formats - swscale doesn't handle palette directly. */
-    if (src_av == AV_PIX_FMT_PAL8 || image_input->pixel_format == SAIL_PIXEL_FORMAT_BPP8_INDEXED
-        || image_input->pixel_format == SAIL_PIXEL_FORMAT_BPP4_INDEXED
-        || image_input->pixel_format == SAIL_PIXEL_FORMAT_BPP1_INDEXED)
-    {
-        return false;
-    }
-
-    /* Create swscale context. */
-    struct SwsContext* sws_ctx =
-        sws_getContext(image_input->width, image_input->height, src_av, image_output->width, image_output->height,
-                       dst_av, SWS_BILINEAR | SWS_ACCURATE_RND, NULL, NULL, NULL);
+    /* Create swscale context. Fails if swscale doesn't support this conversion. */
+    struct SwsContext* sws_context = sail_alloc_swscale_conversion(image_input->pixel_format, output_pixel_format,
+                                                                   image_input->width, image_input->height);
 
-    if (sws_ctx == NULL)
+    if (sws_context == NULL)
     {
-        SAIL_LOG_ERROR("SWSCALE: Failed to create context for conversion");
         return false;
     }
 
-    /* Prepare source data pointers. */
-    const uint8_t* src_data[4] = {(const uint8_t*)image_input->pixels, NULL, NULL, NULL};
-    int src_linesize[4]        = {(int)image_input->bytes_per_line, 0, 0, 0};
-
-    /* Prepare destination data pointers. */
-    uint8_t* dst_data[4] = {(uint8_t*)image_output->pixels, NULL, NULL, NULL};
-    int dst_linesize[4]  = {(int)image_output->bytes_per_line, 0, 0, 0};
-
-    /* Perform conversion. */
-    int result = sws_scale(sws_ctx, src_data, src_linesize, 0, image_input->height, dst_data, dst_linesize);
+    const bool converted = sail_execute_swscale_conversion(sws_context, image_input, image_output);
 
     /* Cleanup. */
-    sws_freeContext(sws_ctx);
+    sail_destroy_swscale_conversion(sws_context);
 
-    if (result < 0 || result != (int)image_output->height)
+    if (!converted)
     {
-        SAIL_LOG_ERROR("SWSCALE: Conversion failed or incomplete (result: %d, expected: %u)", result,
-                       image_output->height);
         return false;
     }
 
@@ -33,6 +33,7 @@
 #include <sail-common/status.h>
 
 struct sail_image;
+struct SwsContext;
 
 #ifdef SAIL_MANIP_SWSCALE_ENABLED
 
@@ -57,6 +58,31 @@ SAIL_HIDDEN bool sail_try_swscale_conversion(const struct sail_image* image_inpu
                                              struct sail_image* image_output,
                                              enum SailPixelFormat output_pixel_format);
 
+/*
+ * Creates a swscale context that converts images of the size between the pixel formats.
+ * Conversion plans keep it to convert many images with the same context.
+ *
+ * Returns NULL if swscale doesn't support this conversion pair.
+ */
+SAIL_HIDDEN struct SwsContext* sail_alloc_swscale_conversion(enum SailPixelFormat input_pixel_format,
+                                                             enum SailPixelFormat output_pixel_format,
+                                                             unsigned width,
+                                                             unsigned height);
+
+/*
+ * Converts the image with the context created by sail_alloc_swscale_conversion().
+ *
+ * Returns true on success.
+ */
+SAIL_HIDDEN bool sail_execute_swscale_conversion(struct SwsContext* sws_context,
+                                                 const struct sail_image* image_input,
+                                                 struct sail_image* image_output);
+
+/*
+ * Destroys the context created by sail_alloc_swscale_conversion(). Does nothing if the context is NULL.
+ */
+SAIL_HIDDEN void sail_destroy_swscale_conversion(struct SwsContext* sws_context);
+
 #else
 
 /* Stub when swscale is not available */
@@ -70,4 +96,31 @@ static inline bool sail_try_swscale_conversion(const struct sail_image* image_in
     return false;
 }
 
+static inline struct SwsContext* sail_alloc_swscale_conversion(enum SailPixelFormat input_pixel_format,
+                                                               enum SailPixelFormat output_pixel_format,
+                                                               unsigned width,
+                                                               unsigned height)
+{
+    (void)input_pixel_format;
+    (void)output_pixel_format;
+    (void)width;
+    (void)height;
+    return NULL;
+}
+
+static inline bool sail_execute_swscale_conversion(struct SwsContext* sws_context,
+                                                   const struct sail_image* image_input,
+                                                   struct sail_image* image_output)
+{
+    (void)sws_context;
+    (void)image_input;
+    (void)image_output;
+    return false;
+}
+
+static inline void sail_destroy_swscale_conversion(struct SwsContext* sws_context)
+{
+    (void)sws_context;
+}
+
 #endif /* SAIL_MANIP_SWSCALE_ENABLED */
@@ -52,6 +52,8 @@ static sail_status_t alloc_codec(struct sail_codec** codec)
     (*codec)->handle = NULL;
     (*codec)->v8     = NULL;
 
+    memset(&(*codec)->stats, 0, sizeof((*codec)->stats));
+
     return SAIL_OK;
 }
 
@@ -29,6 +29,7 @@
 #include <sail-common/status.h>
 
 #include <sail/layout/v8_pointers.h>
+#include <sail/operation_stats.h>
 
 struct sail_codec_info;
 struct sail_codec_layout_v8;
@@ -46,6 +47,9 @@ struct sail_codec
 
     /* Codec interface. */
     struct sail_codec_layout_v8* v8;
+
+    /* Aggregated performance counters. Accessed atomically. */
+    struct sail_codec_stats stats;
 };
 
 typedef struct sail_codec sail_codec_t;
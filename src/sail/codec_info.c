@@ -29,6 +29,31 @@
 
 #include <sail/sail.h>
 
+/*
+ * Private functions.
+ */
+
+/* Formats \xFF\xDD into "ff dd". The output buffer must be at least buffer_size * 3 + 1 bytes long. */
+static void format_magic_number(const unsigned char* buffer, size_t buffer_size, char* hex_numbers)
+{
+    char* hex_numbers_ptr = hex_numbers;
+
+    for (size_t i = 0; i < buffer_size; i++, hex_numbers_ptr += 3)
+    {
+#ifdef _MSC_VER
+        sprintf_s(hex_numbers_ptr, 4, "%02x ", buffer[i]);
+#else
+        snprintf(hex_numbers_ptr, 4, "%02x ", buffer[i]);
+#endif
+    }
+
+    *(hex_numbers_ptr - 1) = '\0';
+}
+
+/*
+ * Public functions.
+ */
+
 sail_status_t sail_codec_info_from_path(const char* path, const struct sail_codec_info** codec_info)
 {
     SAIL_CHECK_PTR(path);
@@ -116,7 +141,7 @@ sail_status_t sail_codec_info_by_magic_number_from_io(struct sail_io* io, const
     SAIL_CHECK_PTR(codec_info);
 
     struct sail_context* context;
-    SAIL_TRY(fetch_global_context_guarded(&context));
+    SAIL_TRY(fetch_global_context_lock_free(&context));
 
     size_t saved_offset;
     SAIL_TRY(io->tell(io->stream, &saved_offset));
@@ -130,90 +155,28 @@ sail_status_t sail_codec_info_by_magic_number_from_io(struct sail_io* io, const
 
     /* \xFF\xDD => "FF DD" + string terminator. */
     char hex_numbers[sizeof(buffer) * 3 + 1];
+    hex_numbers[0] = '\0';
 
-    /* Debug print. */
+    /* Debug print. Skip formatting if the message would be filtered out anyway. */
+    if (sail_is_log_level_enabled(SAIL_LOG_LEVEL_DEBUG))
     {
-        char* hex_numbers_ptr = hex_numbers;
-
-        for (size_t i = 0; i < sizeof(buffer); i++, hex_numbers_ptr += 3)
-        {
-#ifdef _MSC_VER
-            sprintf_s(hex_numbers_ptr, 4, "%02x ", buffer[i]);
-#else
-            snprintf(hex_numbers_ptr, 4, "%02x ", buffer[i]);
-#endif
-        }
-
-        *(hex_numbers_ptr - 1) = '\0';
+        format_magic_number(buffer, sizeof(buffer), hex_numbers);
         SAIL_LOG_DEBUG("Read magic number: '%s'", hex_numbers);
     }
 
     /* Find the codec info. */
-    for (struct sail_codec_bundle_node* codec_bundle_node = context->codec_bundle_node; codec_bundle_node != NULL;
-         codec_bundle_node                                = codec_bundle_node->next)
-    {
-        const struct sail_codec_bundle* codec_bundle     = codec_bundle_node->codec_bundle;
-        const struct sail_string_node* magic_number_node = codec_bundle->codec_info->magic_number_node;
-
-        /*
-         * Split "ab cd" into bytes and compare individual bytes against the read magic number.
-         * Additionally, we support "??" pattern matching any byte. For example, "?? ?? 66 74"
-         * matches both "00 20 66 74" and "20 30 66 74".
-         */
-        while (magic_number_node != NULL)
-        {
-            size_t buffer_index = 0;
-            const char* magic   = magic_number_node->string;
-            char hex_byte[3];
-            int bytes_consumed = 0;
-            bool mismatch      = false;
-
-            SAIL_LOG_TRACE("Check against %s magic '%s'", codec_bundle->codec_info->name, magic);
+    *codec_info = match_compiled_magic_numbers(context->magic_numbers, context->magic_numbers_length, buffer);
 
-#ifdef _MSC_VER
-            while (buffer_index < sizeof(buffer)
-                   && sscanf_s(magic, "%2s%n", hex_byte, (unsigned)sizeof(hex_byte), &bytes_consumed) == 1)
-            {
-#else
-            while (buffer_index < sizeof(buffer) && sscanf(magic, "%2s%n", hex_byte, &bytes_consumed) == 1)
-            {
-#endif
-                if (hex_byte[0] == '?')
-                {
-                    SAIL_LOG_TRACE("Skipping ? character");
-                }
-                else
-                {
-                    unsigned byte = 0;
+    if (*codec_info != NULL)
+    {
+        SAIL_LOG_DEBUG("Found codec info: %s", (*codec_info)->name);
+        return SAIL_OK;
+    }
 
-#ifdef _MSC_VER
-                    if (sscanf_s(hex_byte, "%02x", &byte) != 1 || byte != buffer[buffer_index])
-                    {
-#else
-                    if (sscanf(hex_byte, "%02x", &byte) != 1 || byte != buffer[buffer_index])
-                    {
-#endif
-                        SAIL_LOG_TRACE("Character mismatch %02x != %02x", buffer[buffer_index], byte);
-                        mismatch = true;
-                        break;
-                    }
-                }
-
-                magic += bytes_consumed;
-                buffer_index++;
-            }
-
-            if (mismatch)
-            {
-                magic_number_node = magic_number_node->next;
-            }
-            else
-            {
-                *codec_info = codec_bundle->codec_info;
-                SAIL_LOG_DEBUG("Found codec info: %s", (*codec_info)->name);
-                return SAIL_OK;
-            }
-        }
+    /* The magic number is not formatted yet when debug logging is disabled. */
+    if (hex_numbers[0] == '\0')
+    {
+        format_magic_number(buffer, sizeof(buffer), hex_numbers);
     }
 
     SAIL_LOG_ERROR("Magic number '%s' is not supported by any codec", hex_numbers);
@@ -233,51 +196,23 @@ sail_status_t sail_codec_info_from_extension(const char* extension, const struct
         SAIL_LOG_AND_RETURN(SAIL_ERROR_INVALID_ARGUMENT);
     }
 
-    struct sail_context* context;
-    SAIL_TRY(fetch_global_context_guarded(&context));
+    /* Skip leading dot if present. */
+    const char* extension_to_find = extension[0] == '.' ? extension + 1 : extension;
 
-    char* extension_copy;
-    SAIL_TRY(sail_strdup(extension, &extension_copy));
+    struct sail_context* context;
+    SAIL_TRY(fetch_global_context_lock_free(&context));
 
-    /* Will compare in lower case. */
-    sail_to_lower(extension_copy);
+    *codec_info = codec_info_index_find(context->extension_index, extension_to_find);
 
-    /* Skip leading dot if present. */
-    const char* extension_to_compare = extension_copy;
-    if (extension_to_compare[0] == '.')
+    if (*codec_info == NULL)
     {
-        extension_to_compare++;
+        SAIL_LOG_ERROR("Extension %s is not supported by any codec", extension);
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_CODEC_NOT_FOUND);
     }
 
-    for (struct sail_codec_bundle_node* codec_bundle_node = context->codec_bundle_node; codec_bundle_node != NULL;
-         codec_bundle_node                                = codec_bundle_node->next)
-    {
-        const struct sail_codec_bundle* codec_bundle  = codec_bundle_node->codec_bundle;
-        const struct sail_string_node* extension_node = codec_bundle->codec_info->extension_node;
-
-        while (extension_node != NULL)
-        {
-            SAIL_LOG_TRACE("Check against %s extension '%s'", codec_bundle->codec_info->name, extension_node->string);
-
-            if (strcmp(extension_node->string, extension_to_compare) == 0)
-            {
-                sail_free(extension_copy);
-                *codec_info = codec_bundle->codec_info;
-                SAIL_LOG_DEBUG("Found codec info: %s", (*codec_info)->name);
-                return SAIL_OK;
-            }
-            else
-            {
-                SAIL_LOG_TRACE("Extension mismatch '%s' != '%s'", extension_to_compare, extension_node->string);
-            }
-
-            extension_node = extension_node->next;
-        }
-    }
+    SAIL_LOG_DEBUG("Found codec info: %s", (*codec_info)->name);
 
-    sail_free(extension_copy);
-    SAIL_LOG_ERROR("Extension %s is not supported by any codec", extension);
-    SAIL_LOG_AND_RETURN(SAIL_ERROR_CODEC_NOT_FOUND);
+    return SAIL_OK;
 }
 
 sail_status_t sail_codec_info_from_mime_type(const char* mime_type, const struct sail_codec_info** codec_info)
@@ -288,43 +223,19 @@ sail_status_t sail_codec_info_from_mime_type(const char* mime_type, const struct
     SAIL_LOG_DEBUG("Finding codec info for mime type '%s'", mime_type);
 
     struct sail_context* context;
-    SAIL_TRY(fetch_global_context_guarded(&context));
+    SAIL_TRY(fetch_global_context_lock_free(&context));
 
-    char* mime_type_copy;
-    SAIL_TRY(sail_strdup(mime_type, &mime_type_copy));
+    *codec_info = codec_info_index_find(context->mime_type_index, mime_type);
 
-    /* Will compare in lower case. */
-    sail_to_lower(mime_type_copy);
-
-    for (struct sail_codec_bundle_node* codec_bundle_node = context->codec_bundle_node; codec_bundle_node != NULL;
-         codec_bundle_node                                = codec_bundle_node->next)
+    if (*codec_info == NULL)
     {
-        const struct sail_codec_bundle* codec_bundle  = codec_bundle_node->codec_bundle;
-        const struct sail_string_node* mime_type_node = codec_bundle->codec_info->mime_type_node;
-
-        while (mime_type_node != NULL)
-        {
-            SAIL_LOG_TRACE("Check against %s MIME type '%s'", codec_bundle->codec_info->name, mime_type_node->string);
-
-            if (strcmp(mime_type_node->string, mime_type_copy) == 0)
-            {
-                sail_free(mime_type_copy);
-                *codec_info = codec_bundle->codec_info;
-                SAIL_LOG_DEBUG("Found codec info: %s", (*codec_info)->name);
-                return SAIL_OK;
-            }
-            else
-            {
-                SAIL_LOG_TRACE("MIME type mismatch '%s' != '%s'", mime_type_copy, mime_type_node->string);
-            }
-
-            mime_type_node = mime_type_node->next;
-        }
+        SAIL_LOG_ERROR("MIME type %s is not supported by any codec", mime_type);
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_CODEC_NOT_FOUND);
     }
 
-    sail_free(mime_type_copy);
-    SAIL_LOG_ERROR("MIME type %s is not supported by any codec", mime_type);
-    SAIL_LOG_AND_RETURN(SAIL_ERROR_CODEC_NOT_FOUND);
+    SAIL_LOG_DEBUG("Found codec info: %s", (*codec_info)->name);
+
+    return SAIL_OK;
 }
 
 sail_status_t sail_codec_info_from_name(const char* name, const struct sail_codec_info** codec_info)
@@ -341,36 +252,61 @@ sail_status_t sail_codec_info_from_name(const char* name, const struct sail_code
     }
 
     struct sail_context* context;
-    SAIL_TRY(fetch_global_context_guarded(&context));
+    SAIL_TRY(fetch_global_context_lock_free(&context));
+
+    *codec_info = codec_info_index_find(context->name_index, name);
 
-    char* name_copy;
-    SAIL_TRY(sail_strdup(name, &name_copy));
+    if (*codec_info == NULL)
+    {
+        SAIL_LOG_ERROR("Codec name %s is not supported", name);
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_CODEC_NOT_FOUND);
+    }
 
-    /* Will compare in upper case. */
-    sail_to_upper(name_copy);
+    SAIL_LOG_DEBUG("Found codec info: %s", (*codec_info)->name);
 
-    for (struct sail_codec_bundle_node* codec_bundle_node = context->codec_bundle_node; codec_bundle_node != NULL;
-         codec_bundle_node                                = codec_bundle_node->next)
+    return SAIL_OK;
+}
+
+void* sail_codec_info_binding_data(const struct sail_codec_info* codec_info)
+{
+    if (codec_info == NULL)
     {
-        const struct sail_codec_bundle* codec_bundle = codec_bundle_node->codec_bundle;
-        const char* codec_name                       = codec_bundle->codec_info->name;
+        return NULL;
+    }
 
-        SAIL_LOG_TRACE("Check against codec name '%s'", codec_name);
+    const struct sail_codec_info_private* codec_info_private = (const struct sail_codec_info_private*)codec_info;
 
-        if (strcmp(codec_name, name_copy) == 0)
-        {
-            sail_free(name_copy);
-            *codec_info = codec_bundle->codec_info;
-            SAIL_LOG_DEBUG("Found codec info: %s", (*codec_info)->name);
-            return SAIL_OK;
-        }
-        else
-        {
-            SAIL_LOG_TRACE("Name mismatch '%s' != '%s'", name_copy, codec_name);
-        }
+    return SAIL_ATOMIC_LOAD_POINTER(&codec_info_private->binding_data);
+}
+
+sail_status_t sail_attach_codec_info_binding_data(const struct sail_codec_info* codec_info,
+                                                  void* binding_data,
+                                                  void (*binding_data_destroy)(void* binding_data),
+                                                  void** attached_binding_data)
+{
+    SAIL_CHECK_PTR(codec_info);
+    SAIL_CHECK_PTR(binding_data);
+    SAIL_CHECK_PTR(binding_data_destroy);
+    SAIL_CHECK_PTR(attached_binding_data);
+
+    /* Codec info objects are allocated by alloc_codec_info() as parts of the private structure. */
+    struct sail_codec_info_private* codec_info_private = (struct sail_codec_info_private*)codec_info;
+
+    void* previous = SAIL_ATOMIC_COMPARE_EXCHANGE_POINTER(&codec_info_private->binding_data, NULL, binding_data);
+
+    if (previous != NULL)
+    {
+        binding_data_destroy(binding_data);
+        *attached_binding_data = previous;
+        return SAIL_OK;
     }
 
-    sail_free(name_copy);
-    SAIL_LOG_ERROR("Codec name %s is not supported", name);
-    SAIL_LOG_AND_RETURN(SAIL_ERROR_CODEC_NOT_FOUND);
+    /*
+     * Only the thread that won the exchange writes the callback. It's read in destroy_codec_info()
+     * when no other thread uses the codec info object.
+     */
+    codec_info_private->binding_data_destroy = binding_data_destroy;
+    *attached_binding_data                   = binding_data;
+
+    return SAIL_OK;
 }
@@ -250,6 +250,28 @@ SAIL_EXPORT sail_status_t sail_codec_info_from_mime_type(const char* mime_type,
 SAIL_EXPORT sail_status_t sail_codec_info_from_name(const char* name,
                                                     const struct sail_codec_info** codec_info);
 
+/*
+ * Returns the data attached to the codec info object with sail_attach_codec_info_binding_data(),
+ * or NULL. Intended for language bindings that cache their own copies of codec info objects.
+ * The lookup is a single atomic load.
+ */
+SAIL_EXPORT void* sail_codec_info_binding_data(const struct sail_codec_info* codec_info);
+
+/*
+ * Attaches the data to the codec info object. The data is destroyed with the specified callback
+ * together with the codec info object in sail_finish(), so it never outlives the codec info object.
+ *
+ * If another thread attached its data first, the specified data is destroyed with the callback,
+ * and the already attached data is assigned to the output argument. Otherwise, the specified data
+ * is assigned to the output argument.
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_EXPORT sail_status_t sail_attach_codec_info_binding_data(const struct sail_codec_info* codec_info,
+                                                              void* binding_data,
+                                                              void (*binding_data_destroy)(void* binding_data),
+                                                              void** attached_binding_data);
+
 /* extern "C" */
 #ifdef __cplusplus
 }
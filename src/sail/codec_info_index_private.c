@@ -0,0 +1,314 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <ctype.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <sail/sail.h>
+
+/*
+ * Private functions.
+ */
+
+/* Case-insensitive variant of sail_string_hash(). */
+static uint64_t case_insensitive_string_hash(const char* str)
+{
+    const unsigned char* ustr = (const unsigned char*)str;
+
+    uint64_t hash = 5381;
+    unsigned c;
+
+    while ((c = *ustr++) != 0)
+    {
+        hash = ((hash << 5) + hash) + (unsigned)tolower(c); /* hash * 33 + c */
+    }
+
+    return hash;
+}
+
+static bool case_insensitive_string_equal(const char* str1, const char* str2)
+{
+    for (; *str1 != '\0' && *str2 != '\0'; str1++, str2++)
+    {
+        if (tolower((unsigned char)*str1) != tolower((unsigned char)*str2))
+        {
+            return false;
+        }
+    }
+
+    return *str1 == *str2;
+}
+
+/* Fibonacci hashing of pointers. The low bits of pointers are always zero due to alignment. */
+static size_t pointer_hash(const void* pointer)
+{
+    return (size_t)(((uint64_t)(uintptr_t)pointer * UINT64_C(11400714819323198485)) >> 32);
+}
+
+static void put_into_index(struct sail_codec_info_index* codec_info_index,
+                           const char* key,
+                           const struct sail_codec_info* codec_info)
+{
+    const size_t mask = codec_info_index->capacity - 1;
+
+    for (size_t i = (size_t)case_insensitive_string_hash(key) & mask;; i = (i + 1) & mask)
+    {
+        struct sail_codec_info_index_entry* entry = &codec_info_index->entries[i];
+
+        if (entry->key == NULL)
+        {
+            entry->key        = key;
+            entry->codec_info = codec_info;
+            return;
+        }
+
+        /* Keep the codec with a higher priority. */
+        if (case_insensitive_string_equal(entry->key, key))
+        {
+            SAIL_LOG_TRACE("Key '%s' is already indexed for %s, ignoring it for %s", key, entry->codec_info->name,
+                           codec_info->name);
+            return;
+        }
+    }
+}
+
+static size_t count_keys(const struct sail_codec_info* codec_info, enum SailCodecInfoIndexKey index_key)
+{
+    const struct sail_string_node* string_node;
+
+    switch (index_key)
+    {
+    case SAIL_CODEC_INFO_INDEX_EXTENSION: string_node = codec_info->extension_node; break;
+    case SAIL_CODEC_INFO_INDEX_MIME_TYPE: string_node = codec_info->mime_type_node; break;
+    case SAIL_CODEC_INFO_INDEX_NAME: return codec_info->name == NULL ? 0 : 1;
+
+    default: return 0;
+    }
+
+    size_t count = 0;
+
+    for (; string_node != NULL; string_node = string_node->next)
+    {
+        count++;
+    }
+
+    return count;
+}
+
+static void put_codec_info_into_index(struct sail_codec_info_index* codec_info_index,
+                                      const struct sail_codec_info* codec_info,
+                                      enum SailCodecInfoIndexKey index_key)
+{
+    const struct sail_string_node* string_node;
+
+    switch (index_key)
+    {
+    case SAIL_CODEC_INFO_INDEX_EXTENSION: string_node = codec_info->extension_node; break;
+    case SAIL_CODEC_INFO_INDEX_MIME_TYPE: string_node = codec_info->mime_type_node; break;
+    case SAIL_CODEC_INFO_INDEX_NAME:
+    {
+        if (codec_info->name != NULL)
+        {
+            put_into_index(codec_info_index, codec_info->name, codec_info);
+        }
+        return;
+    }
+
+    default: return;
+    }
+
+    for (; string_node != NULL; string_node = string_node->next)
+    {
+        put_into_index(codec_info_index, string_node->string, codec_info);
+    }
+}
+
+/*
+ * Public functions.
+ */
+
+sail_status_t alloc_codec_info_index(const struct sail_codec_bundle_node* codec_bundle_node,
+                                     enum SailCodecInfoIndexKey index_key,
+                                     struct sail_codec_info_index** codec_info_index)
+{
+    SAIL_CHECK_PTR(codec_info_index);
+
+    size_t keys_count = 0;
+
+    for (const struct sail_codec_bundle_node* node = codec_bundle_node; node != NULL; node = node->next)
+    {
+        keys_count += count_keys(node->codec_bundle->codec_info, index_key);
+    }
+
+    /* Keep the load factor at most 0.5 so probe sequences stay short. */
+    size_t capacity = 16;
+
+    while (capacity < keys_count * 2)
+    {
+        capacity *= 2;
+    }
+
+    void* ptr;
+    SAIL_TRY(sail_malloc(sizeof(struct sail_codec_info_index), &ptr));
+    struct sail_codec_info_index* local_codec_info_index = ptr;
+
+    SAIL_TRY_OR_CLEANUP(sail_calloc(capacity, sizeof(struct sail_codec_info_index_entry), &ptr),
+                        /* cleanup */ sail_free(local_codec_info_index));
+    local_codec_info_index->entries  = ptr;
+    local_codec_info_index->capacity = capacity;
+
+    for (const struct sail_codec_bundle_node* node = codec_bundle_node; node != NULL; node = node->next)
+    {
+        put_codec_info_into_index(local_codec_info_index, node->codec_bundle->codec_info, index_key);
+    }
+
+    *codec_info_index = local_codec_info_index;
+
+    return SAIL_OK;
+}
+
+void destroy_codec_info_index(struct sail_codec_info_index* codec_info_index)
+{
+    if (codec_info_index == NULL)
+    {
+        return;
+    }
+
+    sail_free(codec_info_index->entries);
+    sail_free(codec_info_index);
+}
+
+const struct sail_codec_info* codec_info_index_find(const struct sail_codec_info_index* codec_info_index,
+                                                    const char* key)
+{
+    if (codec_info_index == NULL || key == NULL)
+    {
+        return NULL;
+    }
+
+    const size_t mask = codec_info_index->capacity - 1;
+
+    for (size_t i = (size_t)case_insensitive_string_hash(key) & mask;; i = (i + 1) & mask)
+    {
+        const struct sail_codec_info_index_entry* entry = &codec_info_index->entries[i];
+
+        if (entry->key == NULL)
+        {
+            return NULL;
+        }
+
+        if (case_insensitive_string_equal(entry->key, key))
+        {
+            return entry->codec_info;
+        }
+    }
+}
+
+sail_status_t alloc_codec_bundle_index(const struct sail_codec_bundle_node* codec_bundle_node,
+                                       struct sail_codec_bundle_index** codec_bundle_index)
+{
+    SAIL_CHECK_PTR(codec_bundle_index);
+
+    size_t bundles_count = 0;
+
+    for (const struct sail_codec_bundle_node* node = codec_bundle_node; node != NULL; node = node->next)
+    {
+        bundles_count++;
+    }
+
+    size_t capacity = 16;
+
+    while (capacity < bundles_count * 2)
+    {
+        capacity *= 2;
+    }
+
+    void* ptr;
+    SAIL_TRY(sail_malloc(sizeof(struct sail_codec_bundle_index), &ptr));
+    struct sail_codec_bundle_index* local_codec_bundle_index = ptr;
+
+    SAIL_TRY_OR_CLEANUP(sail_calloc(capacity, sizeof(struct sail_codec_bundle_index_entry), &ptr),
+                        /* cleanup */ sail_free(local_codec_bundle_index));
+    local_codec_bundle_index->entries  = ptr;
+    local_codec_bundle_index->capacity = capacity;
+
+    const size_t mask = capacity - 1;
+
+    for (const struct sail_codec_bundle_node* node = codec_bundle_node; node != NULL; node = node->next)
+    {
+        size_t i = pointer_hash(node->codec_bundle->codec_info) & mask;
+
+        while (local_codec_bundle_index->entries[i].codec_info != NULL)
+        {
+            i = (i + 1) & mask;
+        }
+
+        local_codec_bundle_index->entries[i].codec_info   = node->codec_bundle->codec_info;
+        local_codec_bundle_index->entries[i].codec_bundle = node->codec_bundle;
+    }
+
+    *codec_bundle_index = local_codec_bundle_index;
+
+    return SAIL_OK;
+}
+
+void destroy_codec_bundle_index(struct sail_codec_bundle_index* codec_bundle_index)
+{
+    if (codec_bundle_index == NULL)
+    {
+        return;
+    }
+
+    sail_free(codec_bundle_index->entries);
+    sail_free(codec_bundle_index);
+}
+
+struct sail_codec_bundle* codec_bundle_index_find(const struct sail_codec_bundle_index* codec_bundle_index,
+                                                  const struct sail_codec_info* codec_info)
+{
+    if (codec_bundle_index == NULL || codec_info == NULL)
+    {
+        return NULL;
+    }
+
+    const size_t mask = codec_bundle_index->capacity - 1;
+
+    for (size_t i = pointer_hash(codec_info) & mask;; i = (i + 1) & mask)
+    {
+        const struct sail_codec_bundle_index_entry* entry = &codec_bundle_index->entries[i];
+
+        if (entry->codec_info == NULL)
+        {
+            return NULL;
+        }
+
+        if (entry->codec_info == codec_info)
+        {
+            return entry->codec_bundle;
+        }
+    }
+}
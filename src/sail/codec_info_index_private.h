@@ -0,0 +1,135 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <stddef.h> /* size_t */
+
+#include <sail-common/export.h>
+#include <sail-common/status.h>
+
+struct sail_codec_bundle;
+struct sail_codec_bundle_node;
+struct sail_codec_info;
+
+/*
+ * Immutable case-insensitive hash index that maps strings like file extensions to codec info objects.
+ * Keys are borrowed from the indexed codec info objects, so the index must not outlive them.
+ * The index is built once when the context is initialized and then read without locking.
+ */
+struct sail_codec_info_index_entry
+{
+    /* Borrowed key. NULL for empty slots. */
+    const char* key;
+
+    /* Borrowed codec info. */
+    const struct sail_codec_info* codec_info;
+};
+
+struct sail_codec_info_index
+{
+    /* Open addressing table with linear probing. */
+    struct sail_codec_info_index_entry* entries;
+
+    /* The number of slots. Always a power of two. */
+    size_t capacity;
+};
+
+/*
+ * What string properties of codec info objects to index.
+ */
+enum SailCodecInfoIndexKey
+{
+    SAIL_CODEC_INFO_INDEX_EXTENSION,
+    SAIL_CODEC_INFO_INDEX_MIME_TYPE,
+    SAIL_CODEC_INFO_INDEX_NAME,
+};
+
+/*
+ * Builds a new index of all the codecs in the chain by the specified key. When multiple codecs share the same key,
+ * the first codec in the chain wins. The chain is expected to be sorted by priority.
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_HIDDEN sail_status_t alloc_codec_info_index(const struct sail_codec_bundle_node* codec_bundle_node,
+                                                 enum SailCodecInfoIndexKey index_key,
+                                                 struct sail_codec_info_index** codec_info_index);
+
+/*
+ * Destroys the specified index. Does nothing if the index is NULL.
+ */
+SAIL_HIDDEN void destroy_codec_info_index(struct sail_codec_info_index* codec_info_index);
+
+/*
+ * Finds a codec info by the specified key compared case-insensitively.
+ *
+ * Returns the found codec info or NULL.
+ */
+SAIL_HIDDEN const struct sail_codec_info* codec_info_index_find(const struct sail_codec_info_index* codec_info_index,
+                                                                const char* key);
+
+/*
+ * Immutable hash index that maps codec info objects to the bundles holding them. It's built once
+ * when the context is initialized and then read without locking, so resolving the codec of a codec
+ * info object doesn't walk the codec list.
+ */
+struct sail_codec_bundle_index_entry
+{
+    /* Borrowed codec info. NULL for empty slots. */
+    const struct sail_codec_info* codec_info;
+
+    /* Borrowed codec bundle. */
+    struct sail_codec_bundle* codec_bundle;
+};
+
+struct sail_codec_bundle_index
+{
+    /* Open addressing table with linear probing. */
+    struct sail_codec_bundle_index_entry* entries;
+
+    /* The number of slots. Always a power of two. */
+    size_t capacity;
+};
+
+/*
+ * Builds a new index of all the codec bundles in the chain.
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_HIDDEN sail_status_t alloc_codec_bundle_index(const struct sail_codec_bundle_node* codec_bundle_node,
+                                                   struct sail_codec_bundle_index** codec_bundle_index);
+
+/*
+ * Destroys the specified index. Does nothing if the index is NULL.
+ */
+SAIL_HIDDEN void destroy_codec_bundle_index(struct sail_codec_bundle_index* codec_bundle_index);
+
+/*
+ * Finds the codec bundle holding the specified codec info object.
+ *
+ * Returns the found codec bundle or NULL.
+ */
+SAIL_HIDDEN struct sail_codec_bundle* codec_bundle_index_find(const struct sail_codec_bundle_index* codec_bundle_index,
+                                                              const struct sail_codec_info* codec_info);
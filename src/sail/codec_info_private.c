@@ -412,24 +412,16 @@ static sail_status_t check_codec_info(const struct sail_codec_info* codec_info)
     return SAIL_OK;
 }
 
-static sail_status_t alloc_codec_info(struct sail_codec_info** codec_info)
+static sail_status_t check_codec_layout_and_info(const struct sail_codec_info* codec_info)
 {
-    SAIL_CHECK_PTR(codec_info);
-
-    void* ptr;
-    SAIL_TRY(sail_malloc(sizeof(struct sail_codec_info), &ptr));
-    *codec_info = ptr;
+    if (codec_info->layout != SAIL_CODEC_LAYOUT_V8)
+    {
+        SAIL_LOG_ERROR("Unsupported codec layout version %d. Please check your codec info files", codec_info->layout);
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_UNSUPPORTED_CODEC_LAYOUT);
+    }
 
-    (*codec_info)->path              = NULL;
-    (*codec_info)->layout            = 0;
-    (*codec_info)->version           = NULL;
-    (*codec_info)->name              = NULL;
-    (*codec_info)->description       = NULL;
-    (*codec_info)->magic_number_node = NULL;
-    (*codec_info)->extension_node    = NULL;
-    (*codec_info)->mime_type_node    = NULL;
-    (*codec_info)->load_features     = NULL;
-    (*codec_info)->save_features     = NULL;
+    /* Paranoid error checks. */
+    SAIL_TRY(check_codec_info(codec_info));
 
     return SAIL_OK;
 }
@@ -460,16 +452,7 @@ static sail_status_t codec_read_info_from_input(const char* input,
     /* Success. */
     if (code == 0)
     {
-        if (codec_info_local->layout != SAIL_CODEC_LAYOUT_V8)
-        {
-            SAIL_LOG_ERROR("Unsupported codec layout version %d. Please check your codec info files",
-                           codec_info_local->layout);
-            destroy_codec_info(codec_info_local);
-            SAIL_LOG_AND_RETURN(SAIL_ERROR_UNSUPPORTED_CODEC_LAYOUT);
-        }
-
-        /* Paranoid error checks. */
-        SAIL_TRY_OR_CLEANUP(check_codec_info(codec_info_local),
+        SAIL_TRY_OR_CLEANUP(check_codec_layout_and_info(codec_info_local),
                             /* cleanup */ destroy_codec_info(codec_info_local));
 
         *codec_info = codec_info_local;
@@ -490,10 +473,144 @@ static sail_status_t codec_read_info_from_input(const char* input,
     }
 }
 
+static sail_status_t string_node_chain_from_list(const char* const* list, struct sail_string_node** string_node)
+{
+    struct sail_string_node* first_node = NULL;
+    struct sail_string_node** last_node = &first_node;
+
+    for (; list != NULL && *list != NULL; list++)
+    {
+        SAIL_TRY_OR_CLEANUP(sail_alloc_string_node(last_node),
+                            /* cleanup */ sail_destroy_string_node_chain(first_node));
+        SAIL_TRY_OR_CLEANUP(sail_strdup(*list, &(*last_node)->string),
+                            /* cleanup */ sail_destroy_string_node_chain(first_node));
+        last_node = &(*last_node)->next;
+    }
+
+    *string_node = first_node;
+
+    return SAIL_OK;
+}
+
+static sail_status_t strdup_optional(const char* str, char** result)
+{
+    if (str == NULL)
+    {
+        *result = NULL;
+        return SAIL_OK;
+    }
+
+    SAIL_TRY(sail_strdup(str, result));
+
+    return SAIL_OK;
+}
+
+static sail_status_t fill_codec_info_from_table(const struct sail_codec_info_table* table,
+                                                struct sail_codec_info* codec_info)
+{
+    codec_info->layout   = table->layout;
+    codec_info->priority = table->priority;
+
+    SAIL_TRY(strdup_optional(table->version, &codec_info->version));
+    SAIL_TRY(strdup_optional(table->name, &codec_info->name));
+    SAIL_TRY(strdup_optional(table->description, &codec_info->description));
+
+    SAIL_TRY(string_node_chain_from_list(table->magic_numbers, &codec_info->magic_number_node));
+
+    for (struct sail_string_node* node = codec_info->magic_number_node; node != NULL; node = node->next)
+    {
+        if (strlen(node->string) > SAIL_MAGIC_BUFFER_SIZE * 3 - 1)
+        {
+            SAIL_LOG_ERROR("Magic number '%s' is too long. Magic numbers for the '%s' codec are disabled",
+                           node->string, codec_info->name);
+            sail_destroy_string_node_chain(codec_info->magic_number_node);
+            codec_info->magic_number_node = NULL;
+            break;
+        }
+    }
+
+    SAIL_TRY(string_node_chain_from_list(table->extensions, &codec_info->extension_node));
+    SAIL_TRY(string_node_chain_from_list(table->mime_types, &codec_info->mime_type_node));
+
+    struct sail_load_features* load_features = codec_info->load_features;
+
+    load_features->features = table->load_features;
+    SAIL_TRY(string_node_chain_from_list(table->load_tuning, &load_features->tuning));
+
+    struct sail_save_features* save_features = codec_info->save_features;
+
+    save_features->features = table->save_features;
+
+    if (table->pixel_formats_length > 0)
+    {
+        void* ptr;
+        SAIL_TRY(sail_malloc(table->pixel_formats_length * sizeof(enum SailPixelFormat), &ptr));
+        save_features->pixel_formats = ptr;
+
+        memcpy(save_features->pixel_formats, table->pixel_formats,
+               table->pixel_formats_length * sizeof(enum SailPixelFormat));
+        save_features->pixel_formats_length = table->pixel_formats_length;
+    }
+
+    if (table->compressions_length > 0)
+    {
+        void* ptr;
+        SAIL_TRY(sail_malloc(table->compressions_length * sizeof(enum SailCompression), &ptr));
+        save_features->compressions = ptr;
+
+        memcpy(save_features->compressions, table->compressions,
+               table->compressions_length * sizeof(enum SailCompression));
+        save_features->compressions_length = table->compressions_length;
+    }
+
+    save_features->default_compression = table->default_compression;
+
+    if (table->has_compression_level)
+    {
+        SAIL_TRY(sail_alloc_compression_level(&save_features->compression_level));
+
+        save_features->compression_level->min_level     = table->compression_level_min;
+        save_features->compression_level->max_level     = table->compression_level_max;
+        save_features->compression_level->default_level = table->compression_level_default;
+        save_features->compression_level->step          = table->compression_level_step;
+    }
+
+    SAIL_TRY(string_node_chain_from_list(table->save_tuning, &save_features->tuning));
+
+    return SAIL_OK;
+}
+
 /*
  * Public functions.
  */
 
+sail_status_t alloc_codec_info(struct sail_codec_info** codec_info)
+{
+    SAIL_CHECK_PTR(codec_info);
+
+    void* ptr;
+    SAIL_TRY(sail_malloc(sizeof(struct sail_codec_info_private), &ptr));
+    struct sail_codec_info_private* codec_info_private = ptr;
+
+    codec_info_private->binding_data         = NULL;
+    codec_info_private->binding_data_destroy = NULL;
+
+    *codec_info = &codec_info_private->codec_info;
+
+    (*codec_info)->path              = NULL;
+    (*codec_info)->layout            = 0;
+    (*codec_info)->version           = NULL;
+    (*codec_info)->name              = NULL;
+    (*codec_info)->description       = NULL;
+    (*codec_info)->magic_number_node = NULL;
+    (*codec_info)->extension_node    = NULL;
+    (*codec_info)->mime_type_node    = NULL;
+    (*codec_info)->load_features     = NULL;
+    (*codec_info)->save_features     = NULL;
+
+    return SAIL_OK;
+}
+
 void destroy_codec_info(struct sail_codec_info* codec_info)
 {
     if (codec_info == NULL)
@@ -513,7 +630,14 @@ void destroy_codec_info(struct sail_codec_info* codec_info)
     sail_destroy_load_features(codec_info->load_features);
     sail_destroy_save_features(codec_info->save_features);
 
-    sail_free(codec_info);
+    struct sail_codec_info_private* codec_info_private = (struct sail_codec_info_private*)codec_info;
+
+    if (codec_info_private->binding_data != NULL && codec_info_private->binding_data_destroy != NULL)
+    {
+        codec_info_private->binding_data_destroy(codec_info_private->binding_data);
+    }
+
+    sail_free(codec_info_private);
 }
 
 sail_status_t codec_read_info_from_file(const char* path, struct sail_codec_info** codec_info)
@@ -528,12 +652,88 @@ sail_status_t codec_read_info_from_file(const char* path, struct sail_codec_info
     return SAIL_OK;
 }
 
-sail_status_t codec_read_info_from_string(const char* str, struct sail_codec_info** codec_info)
+sail_status_t codec_read_info_from_table(const struct sail_codec_info_table* table,
+                                        struct sail_codec_info** codec_info)
 {
-    SAIL_CHECK_PTR(str);
+    SAIL_CHECK_PTR(table);
     SAIL_CHECK_PTR(codec_info);
 
-    SAIL_TRY(codec_read_info_from_input(str, ini_parse_string, codec_info));
+    struct sail_codec_info* codec_info_local;
+    SAIL_TRY(alloc_codec_info(&codec_info_local));
+    SAIL_TRY_OR_CLEANUP(sail_alloc_load_features(&codec_info_local->load_features),
+                        destroy_codec_info(codec_info_local));
+    SAIL_TRY_OR_CLEANUP(sail_alloc_save_features(&codec_info_local->save_features),
+                        destroy_codec_info(codec_info_local));
+
+    SAIL_TRY_OR_CLEANUP(fill_codec_info_from_table(table, codec_info_local),
+                        /* cleanup */ destroy_codec_info(codec_info_local));
+    SAIL_TRY_OR_CLEANUP(check_codec_layout_and_info(codec_info_local),
+                        /* cleanup */ destroy_codec_info(codec_info_local));
+
+    *codec_info = codec_info_local;
+
+    return SAIL_OK;
+}
+
+#ifdef SAIL_WIN32
+static const char* const CODEC_LIB_SUFFIX = "dll";
+#else
+static const char* const CODEC_LIB_SUFFIX = "so";
+#endif
+
+sail_status_t codec_path_from_codec_info_path(const char* codec_info_path, char** codec_path)
+{
+    SAIL_CHECK_PTR(codec_info_path);
+    SAIL_CHECK_PTR(codec_path);
+
+    /* Build "/path/jpeg.so" from "/path/jpeg.codec.info". */
+    const char* codec_info_part = strstr(codec_info_path, ".codec.info");
+
+    if (codec_info_part == NULL)
+    {
+        SAIL_LOG_ERROR("Codec info path '%s' doesn't end with .codec.info", codec_info_path);
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_INVALID_ARGUMENT);
+    }
+
+    /* The length of "/path/jpeg.". */
+    const size_t base_length = (size_t)(codec_info_part - codec_info_path) + 1;
+
+    char* base;
+    SAIL_TRY(sail_strdup_length(codec_info_path, base_length, &base));
+
+    SAIL_TRY_OR_CLEANUP(sail_concat(codec_path, 2, base, CODEC_LIB_SUFFIX),
+                        /* cleanup */ sail_free(base));
+
+    sail_free(base);
+
+    return SAIL_OK;
+}
+
+sail_status_t codec_info_path_from_codec_path(const char* codec_path, char** codec_info_path)
+{
+    SAIL_CHECK_PTR(codec_path);
+    SAIL_CHECK_PTR(codec_info_path);
+
+    /* Build "/path/jpeg.codec.info" from "/path/jpeg.so". */
+    const size_t codec_path_length = strlen(codec_path);
+    const size_t suffix_length     = strlen(CODEC_LIB_SUFFIX);
+
+    if (codec_path_length <= suffix_length
+        || strcmp(codec_path + codec_path_length - suffix_length, CODEC_LIB_SUFFIX) != 0
+        || codec_path[codec_path_length - suffix_length - 1] != '.')
+    {
+        SAIL_LOG_ERROR("Codec path '%s' doesn't end with .%s", codec_path, CODEC_LIB_SUFFIX);
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_INVALID_ARGUMENT);
+    }
+
+    /* The length of "/path/jpeg.". */
+    char* base;
+    SAIL_TRY(sail_strdup_length(codec_path, codec_path_length - suffix_length, &base));
+
+    SAIL_TRY_OR_CLEANUP(sail_concat(codec_info_path, 2, base, "codec.info"),
+                        /* cleanup */ sail_free(base));
+
+    sail_free(base);
 
     return SAIL_OK;
 }
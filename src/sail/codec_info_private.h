@@ -28,12 +28,33 @@
 #include <sail-common/export.h>
 #include <sail-common/status.h>
 
-struct sail_codec_info;
+#include <sail/codec_info.h>
+#include <sail/codec_info_table.h>
+
+/*
+ * Codec info object with private data attached. alloc_codec_info() allocates codec info objects
+ * as parts of this structure, so the private data is reachable from a public codec info pointer.
+ */
+struct sail_codec_info_private
+{
+    struct sail_codec_info codec_info;
+
+    /* Data attached by language bindings. Published atomically. */
+    void* binding_data;
+    void (*binding_data_destroy)(void* binding_data);
+};
 
 /*
  * Private codec info functions.
  */
 
+/*
+ * Allocates a new codec info object with all the fields set to NULL or zero.
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_HIDDEN sail_status_t alloc_codec_info(struct sail_codec_info** codec_info);
+
 SAIL_HIDDEN void destroy_codec_info(struct sail_codec_info* codec_info);
 
 /*
@@ -45,9 +66,25 @@ SAIL_HIDDEN void destroy_codec_info(struct sail_codec_info* codec_info);
 SAIL_HIDDEN sail_status_t codec_read_info_from_file(const char* path, struct sail_codec_info** codec_info);
 
 /*
- * Reads SAIL codec info from the specified string and stores the parsed information into the specified
- * codec info object.
+ * Builds SAIL codec info from the specified table pre-parsed at build time.
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_HIDDEN sail_status_t codec_read_info_from_table(const struct sail_codec_info_table* table,
+                                                     struct sail_codec_info** codec_info);
+
+/*
+ * Builds the codec library path from the codec info file path. For example, "/path/jpeg.so"
+ * from "/path/jpeg.codec.info".
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_HIDDEN sail_status_t codec_path_from_codec_info_path(const char* codec_info_path, char** codec_path);
+
+/*
+ * Builds the codec info file path from the codec library path. For example, "/path/jpeg.codec.info"
+ * from "/path/jpeg.so".
  *
  * Returns SAIL_OK on success.
  */
-SAIL_HIDDEN sail_status_t codec_read_info_from_string(const char* str, struct sail_codec_info** codec_info);
+SAIL_HIDDEN sail_status_t codec_info_path_from_codec_path(const char* codec_path, char** codec_info_path);
@@ -0,0 +1,69 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <stdbool.h>
+
+#include <sail-common/common.h>
+
+#include <sail/codec_priority.h>
+
+/*
+ * Codec info pre-parsed at build time. The combined sail-codecs library compiles every codec
+ * info file into one table, so initializing SAIL doesn't parse codec info files.
+ *
+ * String lists are NULL-terminated. Magic numbers, extensions, and MIME types are lower-case.
+ */
+struct sail_codec_info_table
+{
+    int layout;
+    const char* version;
+    enum SailCodecPriority priority;
+    const char* name;
+    const char* description;
+    const char* const* magic_numbers;
+    const char* const* extensions;
+    const char* const* mime_types;
+
+    int load_features;
+    const char* const* load_tuning;
+
+    int save_features;
+    const enum SailPixelFormat* pixel_formats;
+    unsigned pixel_formats_length;
+    const enum SailCompression* compressions;
+    unsigned compressions_length;
+    enum SailCompression default_compression;
+
+    /* Compression levels are used only when has_compression_level is true. */
+    bool has_compression_level;
+    double compression_level_min;
+    double compression_level_max;
+    double compression_level_default;
+    double compression_level_step;
+
+    const char* const* save_tuning;
+};
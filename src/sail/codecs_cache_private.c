@@ -0,0 +1,1044 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#ifdef SAIL_WIN32
+#include <direct.h>  /* _mkdir */
+#include <fcntl.h>   /* _O_CREAT */
+#include <io.h>      /* _sopen_s */
+#include <process.h> /* _getpid */
+#include <windows.h> /* MoveFileEx */
+#else
+#include <unistd.h> /* close */
+#endif
+
+#include <sail/sail.h>
+
+/*
+ * Private functions.
+ */
+
+/* Bump when the binary layout changes. */
+static const char CODECS_CACHE_MAGIC[8] = {'S', 'A', 'I', 'L', 'C', 'C', 'H', '3'};
+
+/* Magic, SAIL version, payload size, and payload hash. */
+#define CODECS_CACHE_HEADER_SIZE (8 + 4 + 8 + 8)
+
+static const char* getenv_value(const char* name)
+{
+#ifdef _MSC_VER
+    static SAIL_THREAD_LOCAL char* value = NULL;
+
+    free(value);
+    value = NULL;
+    _dupenv_s(&value, NULL, name);
+
+    return value;
+#else
+    return getenv(name);
+#endif
+}
+
+/* FNV-1a. */
+static uint64_t payload_hash(const unsigned char* data, size_t size)
+{
+    uint64_t hash = 14695981039346656037ULL;
+
+    for (size_t i = 0; i < size; i++)
+    {
+        hash ^= data[i];
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+/*
+ * Returns true if the modification time has a whole-second precision and is too close to the current time.
+ * Files added in the same second would not change the modification time, so the cache must not be saved.
+ */
+static bool modification_time_is_racy(uint64_t modification_time)
+{
+    if (modification_time % 1000000000ULL != 0)
+    {
+        return false;
+    }
+
+    const uint64_t now = (uint64_t)time(NULL);
+
+    return modification_time / 1000000000ULL + 2 > now;
+}
+
+/* Retrieves the modification time in nanoseconds since the epoch and the size of the specified file or directory. */
+static sail_status_t path_attributes(const char* path, uint64_t* modification_time, uint64_t* size)
+{
+#ifdef _MSC_VER
+    struct _stat64 attrs;
+
+    if (_stat64(path, &attrs) != 0)
+#else
+    struct stat attrs;
+
+    if (stat(path, &attrs) != 0)
+#endif
+    {
+        SAIL_LOG_ERROR("Failed to get attributes of '%s': %s", path, strerror(errno));
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_OPEN_FILE);
+    }
+
+#if defined SAIL_UNIX && !defined SAIL_APPLE
+    *modification_time = (uint64_t)attrs.st_mtim.tv_sec * 1000000000ULL + (uint64_t)attrs.st_mtim.tv_nsec;
+#else
+    *modification_time = (uint64_t)attrs.st_mtime * 1000000000ULL;
+#endif
+    *size = (uint64_t)attrs.st_size;
+
+    return SAIL_OK;
+}
+
+/*
+ * Reading the cache.
+ */
+
+/* Cursor over the loaded cache file to read values with bounds checking. */
+struct cache_reader
+{
+    const unsigned char* data;
+    size_t size;
+    size_t offset;
+};
+
+static sail_status_t read_bytes(struct cache_reader* reader, void* buffer, size_t size)
+{
+    if (reader->size - reader->offset < size)
+    {
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_EOF);
+    }
+
+    memcpy(buffer, reader->data + reader->offset, size);
+    reader->offset += size;
+
+    return SAIL_OK;
+}
+
+static sail_status_t read_u32(struct cache_reader* reader, uint32_t* value)
+{
+    SAIL_TRY(read_bytes(reader, value, sizeof(*value)));
+
+    return SAIL_OK;
+}
+
+static sail_status_t read_int(struct cache_reader* reader, int* value)
+{
+    int32_t value32;
+    SAIL_TRY(read_bytes(reader, &value32, sizeof(value32)));
+
+    *value = value32;
+
+    return SAIL_OK;
+}
+
+/* Returns the string without copying. The string is null-terminated in the cache. */
+static sail_status_t peek_string(struct cache_reader* reader, const char** str)
+{
+    uint32_t length;
+    SAIL_TRY(read_u32(reader, &length));
+
+    if (reader->size - reader->offset <= length || reader->data[reader->offset + length] != '\0')
+    {
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_EOF);
+    }
+
+    *str = (const char*)reader->data + reader->offset;
+    reader->offset += length + 1;
+
+    return SAIL_OK;
+}
+
+static sail_status_t read_string(struct cache_reader* reader, char** str)
+{
+    const char* cached_str;
+    SAIL_TRY(peek_string(reader, &cached_str));
+
+    SAIL_TRY(sail_strdup(cached_str, str));
+
+    return SAIL_OK;
+}
+
+static sail_status_t read_string_node_chain(struct cache_reader* reader, struct sail_string_node** string_node)
+{
+    uint32_t length;
+    SAIL_TRY(read_u32(reader, &length));
+
+    struct sail_string_node* first_node = NULL;
+    struct sail_string_node** last_node = &first_node;
+
+    for (uint32_t i = 0; i < length; i++)
+    {
+        SAIL_TRY_OR_CLEANUP(sail_alloc_string_node(last_node),
+                            /* cleanup */ sail_destroy_string_node_chain(first_node));
+        SAIL_TRY_OR_CLEANUP(read_string(reader, &(*last_node)->string),
+                            /* cleanup */ sail_destroy_string_node_chain(first_node));
+        last_node = &(*last_node)->next;
+    }
+
+    *string_node = first_node;
+
+    return SAIL_OK;
+}
+
+/* Enums might be narrower than int, so every element is read into an int first. */
+static sail_status_t read_pixel_formats(struct cache_reader* reader,
+                                        enum SailPixelFormat** pixel_formats,
+                                        unsigned* pixel_formats_length)
+{
+    uint32_t length;
+    SAIL_TRY(read_u32(reader, &length));
+
+    if (length == 0)
+    {
+        *pixel_formats        = NULL;
+        *pixel_formats_length = 0;
+        return SAIL_OK;
+    }
+
+    if ((reader->size - reader->offset) / sizeof(int32_t) < length)
+    {
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_EOF);
+    }
+
+    void* ptr;
+    SAIL_TRY(sail_malloc(length * sizeof(enum SailPixelFormat), &ptr));
+    enum SailPixelFormat* local_pixel_formats = ptr;
+
+    for (uint32_t i = 0; i < length; i++)
+    {
+        int value;
+        SAIL_TRY_OR_CLEANUP(read_int(reader, &value),
+                            /* cleanup */ sail_free(local_pixel_formats));
+        local_pixel_formats[i] = (enum SailPixelFormat)value;
+    }
+
+    *pixel_formats        = local_pixel_formats;
+    *pixel_formats_length = length;
+
+    return SAIL_OK;
+}
+
+static sail_status_t read_compressions(struct cache_reader* reader,
+                                       enum SailCompression** compressions,
+                                       unsigned* compressions_length)
+{
+    uint32_t length;
+    SAIL_TRY(read_u32(reader, &length));
+
+    if (length == 0)
+    {
+        *compressions        = NULL;
+        *compressions_length = 0;
+        return SAIL_OK;
+    }
+
+    if ((reader->size - reader->offset) / sizeof(int32_t) < length)
+    {
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_EOF);
+    }
+
+    void* ptr;
+    SAIL_TRY(sail_malloc(length * sizeof(enum SailCompression), &ptr));
+    enum SailCompression* local_compressions = ptr;
+
+    for (uint32_t i = 0; i < length; i++)
+    {
+        int value;
+        SAIL_TRY_OR_CLEANUP(read_int(reader, &value),
+                            /* cleanup */ sail_free(local_compressions));
+        local_compressions[i] = (enum SailCompression)value;
+    }
+
+    *compressions        = local_compressions;
+    *compressions_length = length;
+
+    return SAIL_OK;
+}
+
+static sail_status_t read_load_features(struct cache_reader* reader, struct sail_load_features* load_features)
+{
+    SAIL_TRY(read_int(reader, &load_features->features));
+    SAIL_TRY(read_string_node_chain(reader, &load_features->tuning));
+
+    return SAIL_OK;
+}
+
+static sail_status_t read_save_features(struct cache_reader* reader, struct sail_save_features* save_features)
+{
+    SAIL_TRY(read_pixel_formats(reader, &save_features->pixel_formats, &save_features->pixel_formats_length));
+    SAIL_TRY(read_int(reader, &save_features->features));
+    SAIL_TRY(read_compressions(reader, &save_features->compressions, &save_features->compressions_length));
+
+    int default_compression;
+    SAIL_TRY(read_int(reader, &default_compression));
+    save_features->default_compression = default_compression;
+
+    unsigned char has_compression_level;
+    SAIL_TRY(read_bytes(reader, &has_compression_level, sizeof(has_compression_level)));
+
+    if (has_compression_level)
+    {
+        SAIL_TRY(sail_alloc_compression_level(&save_features->compression_level));
+
+        struct sail_compression_level* compression_level = save_features->compression_level;
+
+        SAIL_TRY(read_bytes(reader, &compression_level->min_level, sizeof(compression_level->min_level)));
+        SAIL_TRY(read_bytes(reader, &compression_level->max_level, sizeof(compression_level->max_level)));
+        SAIL_TRY(read_bytes(reader, &compression_level->default_level, sizeof(compression_level->default_level)));
+        SAIL_TRY(read_bytes(reader, &compression_level->step, sizeof(compression_level->step)));
+    }
+
+    SAIL_TRY(read_string_node_chain(reader, &save_features->tuning));
+
+    return SAIL_OK;
+}
+
+static sail_status_t read_codec_info(struct cache_reader* reader, struct sail_codec_info* codec_info)
+{
+    int priority;
+
+    SAIL_TRY(read_int(reader, &codec_info->layout));
+    SAIL_TRY(read_int(reader, &priority));
+    codec_info->priority = priority;
+    SAIL_TRY(read_string(reader, &codec_info->version));
+    SAIL_TRY(read_string(reader, &codec_info->name));
+    SAIL_TRY(read_string(reader, &codec_info->description));
+    SAIL_TRY(read_string_node_chain(reader, &codec_info->magic_number_node));
+    SAIL_TRY(read_string_node_chain(reader, &codec_info->extension_node));
+    SAIL_TRY(read_string_node_chain(reader, &codec_info->mime_type_node));
+
+    SAIL_TRY(sail_alloc_load_features(&codec_info->load_features));
+    SAIL_TRY(read_load_features(reader, codec_info->load_features));
+
+    SAIL_TRY(sail_alloc_save_features(&codec_info->save_features));
+    SAIL_TRY(read_save_features(reader, codec_info->save_features));
+
+    return SAIL_OK;
+}
+
+/*
+ * Sets *matches to false if the codec info file was modified after the cache was built.
+ * The codec path is not cached. It's built from the codec info file path.
+ */
+static sail_status_t read_codec_bundle_node(struct cache_reader* reader,
+                                            bool* matches,
+                                            struct sail_codec_bundle_node** codec_bundle_node)
+{
+    const char* codec_info_path;
+    uint64_t cached_modification_time;
+    uint64_t cached_size;
+    SAIL_TRY(peek_string(reader, &codec_info_path));
+    SAIL_TRY(read_bytes(reader, &cached_modification_time, sizeof(cached_modification_time)));
+    SAIL_TRY(read_bytes(reader, &cached_size, sizeof(cached_size)));
+
+    uint64_t modification_time;
+    uint64_t size;
+
+    if (path_attributes(codec_info_path, &modification_time, &size) != SAIL_OK
+        || modification_time != cached_modification_time || size != cached_size)
+    {
+        SAIL_LOG_DEBUG("Codec info '%s' was modified", codec_info_path);
+        *matches = false;
+        return SAIL_OK;
+    }
+
+    struct sail_codec_bundle_node* local_codec_bundle_node;
+    SAIL_TRY(alloc_codec_bundle_node(&local_codec_bundle_node));
+
+    SAIL_TRY_OR_CLEANUP(alloc_codec_bundle(&local_codec_bundle_node->codec_bundle),
+                        /* cleanup */ destroy_codec_bundle_node(local_codec_bundle_node));
+    SAIL_TRY_OR_CLEANUP(alloc_codec_info(&local_codec_bundle_node->codec_bundle->codec_info),
+                        /* cleanup */ destroy_codec_bundle_node(local_codec_bundle_node));
+    SAIL_TRY_OR_CLEANUP(read_codec_info(reader, local_codec_bundle_node->codec_bundle->codec_info),
+                        /* cleanup */ destroy_codec_bundle_node(local_codec_bundle_node));
+    SAIL_TRY_OR_CLEANUP(
+        codec_path_from_codec_info_path(codec_info_path, &local_codec_bundle_node->codec_bundle->codec_info->path),
+        /* cleanup */ destroy_codec_bundle_node(local_codec_bundle_node));
+
+    *matches           = true;
+    *codec_bundle_node = local_codec_bundle_node;
+
+    return SAIL_OK;
+}
+
+/*
+ * Sets *matches to false if the cache was built by another SAIL version, from different directories,
+ * or if any of the cached codec info files was modified.
+ */
+static sail_status_t read_codecs_cache(struct cache_reader* reader,
+                                       const struct sail_string_node* codecs_paths,
+                                       const uint64_t* modification_times,
+                                       bool* matches,
+                                       struct sail_codec_bundle_node** codec_bundle_node)
+{
+    *matches = false;
+
+    char magic[sizeof(CODECS_CACHE_MAGIC)];
+    SAIL_TRY(read_bytes(reader, magic, sizeof(magic)));
+
+    uint32_t version;
+    SAIL_TRY(read_u32(reader, &version));
+
+    if (memcmp(magic, CODECS_CACHE_MAGIC, sizeof(magic)) != 0 || version != SAIL_VERSION)
+    {
+        SAIL_LOG_DEBUG("Codecs cache is incompatible with this SAIL version");
+        return SAIL_OK;
+    }
+
+    uint64_t payload_size;
+    uint64_t expected_payload_hash;
+    SAIL_TRY(read_bytes(reader, &payload_size, sizeof(payload_size)));
+    SAIL_TRY(read_bytes(reader, &expected_payload_hash, sizeof(expected_payload_hash)));
+
+    if (payload_size != reader->size - reader->offset
+        || payload_hash(reader->data + reader->offset, (size_t)payload_size) != expected_payload_hash)
+    {
+        SAIL_LOG_ERROR("Codecs cache is corrupted");
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_PARSE_FILE);
+    }
+
+    /* Directories. */
+    uint32_t paths_length;
+    SAIL_TRY(read_u32(reader, &paths_length));
+
+    unsigned index = 0;
+
+    for (; codecs_paths != NULL; codecs_paths = codecs_paths->next, index++)
+    {
+        if (index == paths_length)
+        {
+            SAIL_LOG_DEBUG("Codecs directories changed");
+            return SAIL_OK;
+        }
+
+        const char* path;
+        uint64_t modification_time;
+        SAIL_TRY(peek_string(reader, &path));
+        SAIL_TRY(read_bytes(reader, &modification_time, sizeof(modification_time)));
+
+        if (strcmp(path, codecs_paths->string) != 0)
+        {
+            SAIL_LOG_DEBUG("Codecs directories changed");
+            return SAIL_OK;
+        }
+
+        if (modification_time != modification_times[index])
+        {
+            SAIL_LOG_DEBUG("Codecs directory '%s' was modified", path);
+            return SAIL_OK;
+        }
+    }
+
+    if (index != paths_length)
+    {
+        SAIL_LOG_DEBUG("Codecs directories changed");
+        return SAIL_OK;
+    }
+
+    /* Codec info objects. */
+    uint32_t codecs_length;
+    SAIL_TRY(read_u32(reader, &codecs_length));
+
+    struct sail_codec_bundle_node* first_codec_bundle_node = NULL;
+    struct sail_codec_bundle_node** last_codec_bundle_node = &first_codec_bundle_node;
+
+    for (uint32_t i = 0; i < codecs_length; i++)
+    {
+        bool codec_matches;
+        SAIL_TRY_OR_CLEANUP(read_codec_bundle_node(reader, &codec_matches, last_codec_bundle_node),
+                            /* cleanup */ destroy_codec_bundle_node_chain(first_codec_bundle_node));
+
+        if (!codec_matches)
+        {
+            destroy_codec_bundle_node_chain(first_codec_bundle_node);
+            return SAIL_OK;
+        }
+
+        last_codec_bundle_node = &(*last_codec_bundle_node)->next;
+    }
+
+    *matches           = true;
+    *codec_bundle_node = first_codec_bundle_node;
+
+    return SAIL_OK;
+}
+
+/*
+ * Writing the cache.
+ */
+
+/* Growing memory buffer to serialize the whole cache before writing it with a single call. */
+struct cache_writer
+{
+    unsigned char* data;
+    size_t size;
+    size_t capacity;
+};
+
+static sail_status_t write_bytes(struct cache_writer* writer, const void* buffer, size_t size)
+{
+    if (writer->capacity - writer->size < size)
+    {
+        size_t new_capacity = writer->capacity == 0 ? 4096 : writer->capacity;
+
+        while (new_capacity - writer->size < size)
+        {
+            new_capacity *= 2;
+        }
+
+        void* ptr = writer->data;
+        SAIL_TRY(sail_realloc(new_capacity, &ptr));
+        writer->data     = ptr;
+        writer->capacity = new_capacity;
+    }
+
+    memcpy(writer->data + writer->size, buffer, size);
+    writer->size += size;
+
+    return SAIL_OK;
+}
+
+static sail_status_t write_u32(struct cache_writer* writer, uint32_t value)
+{
+    SAIL_TRY(write_bytes(writer, &value, sizeof(value)));
+
+    return SAIL_OK;
+}
+
+static sail_status_t write_int(struct cache_writer* writer, int value)
+{
+    const int32_t value32 = value;
+
+    SAIL_TRY(write_bytes(writer, &value32, sizeof(value32)));
+
+    return SAIL_OK;
+}
+
+/* NULL strings are saved as empty strings. */
+static sail_status_t write_string(struct cache_writer* writer, const char* str)
+{
+    if (str == NULL)
+    {
+        str = "";
+    }
+
+    const uint32_t length = (uint32_t)strlen(str);
+
+    SAIL_TRY(write_u32(writer, length));
+    SAIL_TRY(write_bytes(writer, str, length + 1));
+
+    return SAIL_OK;
+}
+
+static sail_status_t write_string_node_chain(struct cache_writer* writer, const struct sail_string_node* string_node)
+{
+    uint32_t length = 0;
+
+    for (const struct sail_string_node* node = string_node; node != NULL; node = node->next)
+    {
+        length++;
+    }
+
+    SAIL_TRY(write_u32(writer, length));
+
+    for (const struct sail_string_node* node = string_node; node != NULL; node = node->next)
+    {
+        SAIL_TRY(write_string(writer, node->string));
+    }
+
+    return SAIL_OK;
+}
+
+/*
+ * Saves the codec info file path with its modification time and size instead of the codec path.
+ * Sets *racy to true if the file was modified too recently to be cached.
+ */
+static sail_status_t write_codec_info(struct cache_writer* writer, const struct sail_codec_info* codec_info, bool* racy)
+{
+    char* codec_info_path;
+    SAIL_TRY(codec_info_path_from_codec_path(codec_info->path, &codec_info_path));
+
+    uint64_t modification_time;
+    uint64_t size;
+    SAIL_TRY_OR_CLEANUP(path_attributes(codec_info_path, &modification_time, &size),
+                        /* cleanup */ sail_free(codec_info_path));
+
+    if (modification_time_is_racy(modification_time))
+    {
+        SAIL_LOG_DEBUG("Codec info '%s' was modified too recently", codec_info_path);
+        *racy = true;
+    }
+
+    SAIL_TRY_OR_CLEANUP(write_string(writer, codec_info_path),
+                        /* cleanup */ sail_free(codec_info_path));
+    sail_free(codec_info_path);
+
+    SAIL_TRY(write_bytes(writer, &modification_time, sizeof(modification_time)));
+    SAIL_TRY(write_bytes(writer, &size, sizeof(size)));
+
+    SAIL_TRY(write_int(writer, codec_info->layout));
+    SAIL_TRY(write_int(writer, codec_info->priority));
+    SAIL_TRY(write_string(writer, codec_info->version));
+    SAIL_TRY(write_string(writer, codec_info->name));
+    SAIL_TRY(write_string(writer, codec_info->description));
+    SAIL_TRY(write_string_node_chain(writer, codec_info->magic_number_node));
+    SAIL_TRY(write_string_node_chain(writer, codec_info->extension_node));
+    SAIL_TRY(write_string_node_chain(writer, codec_info->mime_type_node));
+
+    const struct sail_load_features* load_features = codec_info->load_features;
+
+    SAIL_TRY(write_int(writer, load_features->features));
+    SAIL_TRY(write_string_node_chain(writer, load_features->tuning));
+
+    const struct sail_save_features* save_features = codec_info->save_features;
+
+    SAIL_TRY(write_u32(writer, save_features->pixel_formats_length));
+
+    for (unsigned i = 0; i < save_features->pixel_formats_length; i++)
+    {
+        SAIL_TRY(write_int(writer, save_features->pixel_formats[i]));
+    }
+
+    SAIL_TRY(write_int(writer, save_features->features));
+    SAIL_TRY(write_u32(writer, save_features->compressions_length));
+
+    for (unsigned i = 0; i < save_features->compressions_length; i++)
+    {
+        SAIL_TRY(write_int(writer, save_features->compressions[i]));
+    }
+
+    SAIL_TRY(write_int(writer, save_features->default_compression));
+
+    const unsigned char has_compression_level = save_features->compression_level != NULL;
+    SAIL_TRY(write_bytes(writer, &has_compression_level, sizeof(has_compression_level)));
+
+    if (has_compression_level)
+    {
+        const struct sail_compression_level* compression_level = save_features->compression_level;
+
+        SAIL_TRY(write_bytes(writer, &compression_level->min_level, sizeof(compression_level->min_level)));
+        SAIL_TRY(write_bytes(writer, &compression_level->max_level, sizeof(compression_level->max_level)));
+        SAIL_TRY(write_bytes(writer, &compression_level->default_level, sizeof(compression_level->default_level)));
+        SAIL_TRY(write_bytes(writer, &compression_level->step, sizeof(compression_level->step)));
+    }
+
+    SAIL_TRY(write_string_node_chain(writer, save_features->tuning));
+
+    return SAIL_OK;
+}
+
+static sail_status_t write_codecs_cache(struct cache_writer* writer,
+                                        const struct sail_string_node* codecs_paths,
+                                        const uint64_t* modification_times,
+                                        const struct sail_codec_bundle_node* codec_bundle_node,
+                                        bool* racy)
+{
+    /* The header is filled in when the payload is ready. */
+    const unsigned char header[CODECS_CACHE_HEADER_SIZE] = {0};
+    SAIL_TRY(write_bytes(writer, header, sizeof(header)));
+
+    uint32_t paths_length = 0;
+
+    for (const struct sail_string_node* node = codecs_paths; node != NULL; node = node->next)
+    {
+        paths_length++;
+    }
+
+    SAIL_TRY(write_u32(writer, paths_length));
+
+    unsigned index = 0;
+
+    for (const struct sail_string_node* node = codecs_paths; node != NULL; node = node->next, index++)
+    {
+        SAIL_TRY(write_string(writer, node->string));
+        SAIL_TRY(write_bytes(writer, &modification_times[index], sizeof(modification_times[index])));
+    }
+
+    uint32_t codecs_length = 0;
+
+    for (const struct sail_codec_bundle_node* node = codec_bundle_node; node != NULL; node = node->next)
+    {
+        codecs_length++;
+    }
+
+    SAIL_TRY(write_u32(writer, codecs_length));
+
+    for (const struct sail_codec_bundle_node* node = codec_bundle_node; node != NULL; node = node->next)
+    {
+        SAIL_TRY(write_codec_info(writer, node->codec_bundle->codec_info, racy));
+    }
+
+    /* Header. */
+    const uint32_t version      = SAIL_VERSION;
+    const uint64_t payload_size = writer->size - CODECS_CACHE_HEADER_SIZE;
+    const uint64_t hash         = payload_hash(writer->data + CODECS_CACHE_HEADER_SIZE, (size_t)payload_size);
+
+    unsigned char* output = writer->data;
+
+    memcpy(output, CODECS_CACHE_MAGIC, sizeof(CODECS_CACHE_MAGIC));
+    output += sizeof(CODECS_CACHE_MAGIC);
+    memcpy(output, &version, sizeof(version));
+    output += sizeof(version);
+    memcpy(output, &payload_size, sizeof(payload_size));
+    output += sizeof(payload_size);
+    memcpy(output, &hash, sizeof(hash));
+
+    return SAIL_OK;
+}
+
+static sail_status_t make_directory(const char* path)
+{
+#ifdef SAIL_WIN32
+    const int result = _mkdir(path);
+#else
+    /* Per the XDG base directory specification. */
+    const int result = mkdir(path, 0700);
+#endif
+
+    if (result != 0 && errno != EEXIST)
+    {
+        SAIL_LOG_ERROR("Failed to create directory '%s': %s", path, strerror(errno));
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_WRITE_IO);
+    }
+
+    return SAIL_OK;
+}
+
+/* Creates the missing parent directories of the specified file. */
+static sail_status_t make_parent_directories(const char* file_path)
+{
+    char* path;
+    SAIL_TRY(sail_strdup(file_path, &path));
+
+    /* Skip the root and, on Windows, the drive letter. */
+    char* separator = path + 1;
+
+    while ((separator = strpbrk(separator, "/\\")) != NULL)
+    {
+        const char separator_char = *separator;
+        *separator                = '\0';
+
+        if (separator[-1] != ':' && !sail_is_dir(path))
+        {
+            SAIL_TRY_OR_CLEANUP(make_directory(path),
+                                /* cleanup */ sail_free(path));
+        }
+
+        *separator = separator_char;
+        separator++;
+    }
+
+    sail_free(path);
+
+    return SAIL_OK;
+}
+
+/* Creates and opens for writing a new file with a unique name next to the specified file. */
+static sail_status_t create_temp_file(const char* path, char** temp_path, FILE** file)
+{
+#ifdef SAIL_WIN32
+    /* _mktemp_s() produces only 26 unique names per template, so add the process ID to the template. */
+    char pid_suffix[32];
+#ifdef _MSC_VER
+    sprintf_s(pid_suffix, sizeof(pid_suffix), ".%d.XXXXXX", _getpid());
+#else
+    snprintf(pid_suffix, sizeof(pid_suffix), ".%d.XXXXXX", _getpid());
+#endif
+
+    char* local_temp_path;
+    SAIL_TRY(sail_concat(&local_temp_path, 2, path, pid_suffix));
+
+    int fd = -1;
+
+    if (_mktemp_s(local_temp_path, strlen(local_temp_path) + 1) != 0
+        || _sopen_s(&fd, local_temp_path, _O_CREAT | _O_EXCL | _O_WRONLY | _O_BINARY, _SH_DENYNO, _S_IREAD | _S_IWRITE)
+               != 0)
+    {
+        SAIL_LOG_ERROR("Failed to create a temporary file for '%s'", path);
+        sail_free(local_temp_path);
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_OPEN_FILE);
+    }
+
+    FILE* local_file = _fdopen(fd, "wb");
+#else
+    char* local_temp_path;
+    SAIL_TRY(sail_concat(&local_temp_path, 2, path, ".XXXXXX"));
+
+    const int fd = mkstemp(local_temp_path);
+
+    if (fd < 0)
+    {
+        SAIL_LOG_ERROR("Failed to create a temporary file for '%s': %s", path, strerror(errno));
+        sail_free(local_temp_path);
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_OPEN_FILE);
+    }
+
+    FILE* local_file = fdopen(fd, "wb");
+#endif
+
+    if (local_file == NULL)
+    {
+#ifdef SAIL_WIN32
+        _close(fd);
+#else
+        close(fd);
+#endif
+        SAIL_LOG_ERROR("Failed to open '%s'", local_temp_path);
+        remove(local_temp_path);
+        sail_free(local_temp_path);
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_OPEN_FILE);
+    }
+
+    *temp_path = local_temp_path;
+    *file      = local_file;
+
+    return SAIL_OK;
+}
+
+/*
+ * Public functions.
+ */
+
+sail_status_t codecs_cache_path(const char* codecs_paths, bool enabled, char** path)
+{
+    SAIL_CHECK_PTR(codecs_paths);
+    SAIL_CHECK_PTR(path);
+
+    *path = NULL;
+
+    if (!enabled)
+    {
+        return SAIL_OK;
+    }
+
+    const char* env = getenv_value("SAIL_CODECS_CACHE_PATH");
+
+    if (env != NULL && env[0] != '\0')
+    {
+        SAIL_TRY(sail_strdup(env, path));
+        return SAIL_OK;
+    }
+
+    /* Different SAIL installations get different caches. */
+    char file_name[64];
+#ifdef _MSC_VER
+    sprintf_s(file_name, sizeof(file_name), "sail-codecs-%llx.cache",
+              (unsigned long long)sail_string_hash(codecs_paths));
+#else
+    snprintf(file_name, sizeof(file_name), "sail-codecs-%llx.cache",
+             (unsigned long long)sail_string_hash(codecs_paths));
+#endif
+
+#ifdef SAIL_WIN32
+    const char* cache_dir = getenv_value("LOCALAPPDATA");
+
+    if (cache_dir == NULL || cache_dir[0] == '\0')
+    {
+        SAIL_LOG_DEBUG("LOCALAPPDATA is not set. Not using codecs cache");
+        return SAIL_OK;
+    }
+
+    SAIL_TRY(sail_concat(path, 3, cache_dir, "\\", file_name));
+#else
+    const char* cache_dir = getenv_value("XDG_CACHE_HOME");
+
+    if (cache_dir != NULL && cache_dir[0] != '\0')
+    {
+        SAIL_TRY(sail_concat(path, 3, cache_dir, "/", file_name));
+    }
+    else
+    {
+        const char* home = getenv_value("HOME");
+
+        if (home == NULL || home[0] == '\0')
+        {
+            SAIL_LOG_DEBUG("Neither XDG_CACHE_HOME nor HOME is set. Not using codecs cache");
+            return SAIL_OK;
+        }
+
+        SAIL_TRY(sail_concat(path, 3, home, "/.cache/", file_name));
+    }
+#endif
+
+    return SAIL_OK;
+}
+
+sail_status_t codecs_cache_modification_time(const char* path, uint64_t* modification_time)
+{
+    SAIL_CHECK_PTR(path);
+    SAIL_CHECK_PTR(modification_time);
+
+    uint64_t size;
+    SAIL_TRY(path_attributes(path, modification_time, &size));
+
+    return SAIL_OK;
+}
+
+sail_status_t load_codecs_cache(const char* path,
+                                const struct sail_string_node* codecs_paths,
+                                const uint64_t* modification_times,
+                                bool* loaded,
+                                struct sail_codec_bundle_node** codec_bundle_node)
+{
+    SAIL_CHECK_PTR(path);
+    SAIL_CHECK_PTR(modification_times);
+    SAIL_CHECK_PTR(loaded);
+    SAIL_CHECK_PTR(codec_bundle_node);
+
+    *loaded            = false;
+    *codec_bundle_node = NULL;
+
+    if (!sail_is_file(path))
+    {
+        SAIL_LOG_DEBUG("Codecs cache '%s' doesn't exist", path);
+        return SAIL_OK;
+    }
+
+    void* data;
+    size_t data_size;
+
+    /* The cache is just an optimization, so ignore broken caches. */
+    if (sail_alloc_data_from_file_contents(path, &data, &data_size) != SAIL_OK)
+    {
+        return SAIL_OK;
+    }
+
+    struct cache_reader reader = {data, data_size, 0};
+    bool matches;
+
+    if (read_codecs_cache(&reader, codecs_paths, modification_times, &matches, codec_bundle_node) != SAIL_OK)
+    {
+        SAIL_LOG_WARNING("Ignoring invalid codecs cache '%s'", path);
+    }
+    else if (matches)
+    {
+        *loaded = true;
+        SAIL_LOG_DEBUG("Loaded codecs cache '%s'", path);
+    }
+    else
+    {
+        SAIL_LOG_DEBUG("Codecs cache '%s' is outdated", path);
+    }
+
+    sail_free(data);
+
+    return SAIL_OK;
+}
+
+sail_status_t save_codecs_cache(const char* path,
+                                const struct sail_string_node* codecs_paths,
+                                const uint64_t* modification_times,
+                                const struct sail_codec_bundle_node* codec_bundle_node)
+{
+    SAIL_CHECK_PTR(path);
+    SAIL_CHECK_PTR(modification_times);
+
+    {
+        unsigned index = 0;
+
+        for (const struct sail_string_node* node = codecs_paths; node != NULL; node = node->next, index++)
+        {
+            if (modification_time_is_racy(modification_times[index]))
+            {
+                SAIL_LOG_DEBUG("Codecs directory '%s' was modified too recently. Not saving codecs cache",
+                               node->string);
+                return SAIL_OK;
+            }
+        }
+    }
+
+    struct cache_writer writer = {NULL, 0, 0};
+    bool racy                  = false;
+
+    SAIL_TRY_OR_CLEANUP(write_codecs_cache(&writer, codecs_paths, modification_times, codec_bundle_node, &racy),
+                        /* cleanup */ sail_free(writer.data));
+
+    if (racy)
+    {
+        SAIL_LOG_DEBUG("Not saving codecs cache");
+        sail_free(writer.data);
+        return SAIL_OK;
+    }
+
+    SAIL_TRY_OR_CLEANUP(make_parent_directories(path),
+                        /* cleanup */ sail_free(writer.data));
+
+    /*
+     * Write into a uniquely named temporary file and then rename it to never expose partially written caches.
+     * Concurrent processes never write into the same temporary file.
+     */
+    char* temp_path;
+    FILE* file;
+    SAIL_TRY_OR_CLEANUP(create_temp_file(path, &temp_path, &file),
+                        /* cleanup */ sail_free(writer.data));
+
+    const bool written = fwrite(writer.data, 1, writer.size, file) == writer.size;
+    const bool closed  = fclose(file) == 0;
+
+    sail_free(writer.data);
+
+    if (!written || !closed)
+    {
+        SAIL_LOG_ERROR("Failed to write '%s'", temp_path);
+        remove(temp_path);
+        sail_free(temp_path);
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_WRITE_IO);
+    }
+
+#ifdef SAIL_WIN32
+    const bool renamed = MoveFileExA(temp_path, path, MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+    const bool renamed = rename(temp_path, path) == 0;
+#endif
+
+    if (!renamed)
+    {
+        SAIL_LOG_ERROR("Failed to rename '%s' to '%s'", temp_path, path);
+        remove(temp_path);
+        sail_free(temp_path);
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_WRITE_IO);
+    }
+
+    sail_free(temp_path);
+
+    SAIL_LOG_DEBUG("Saved codecs cache '%s'", path);
+
+    return SAIL_OK;
+}
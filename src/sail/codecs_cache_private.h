@@ -0,0 +1,91 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <sail-common/export.h>
+#include <sail-common/status.h>
+
+struct sail_codec_bundle_node;
+struct sail_string_node;
+
+/*
+ * On-disk cache of parsed codec info objects. The cache is keyed by the list of codecs directories
+ * with their modification times, and by the codec info files with their modification times and sizes.
+ * A valid cache is used without listing the directories or parsing the codec info files. Installing
+ * or removing a codec changes the directory modification time, and editing a codec info file in place
+ * changes the file modification time or size. Codec paths are not cached. They're built from the codec
+ * info file paths. The payload is protected with a hash to reject truncated or corrupted caches.
+ *
+ * The cache is loaded with a single read, and the cached codec info files are checked with stat().
+ */
+
+/*
+ * Returns NULL in *path when the cache is not enabled. Otherwise, returns the cache file path from
+ * the SAIL_CODECS_CACHE_PATH environment variable. If the variable is not set, builds a per-user
+ * default path from the specified codecs paths.
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_HIDDEN sail_status_t codecs_cache_path(const char* codecs_paths, bool enabled, char** path);
+
+/*
+ * Retrieves the modification time of the specified file or directory in nanoseconds since the epoch.
+ * The precision depends on the platform and the file system.
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_HIDDEN sail_status_t codecs_cache_modification_time(const char* path, uint64_t* modification_time);
+
+/*
+ * Loads the codec bundles from the cache. The cache is used only when it's intact, was built from
+ * the same codecs directories with the same modification times, and none of the cached codec info
+ * files was modified. Otherwise, sets *codec_bundle_node
+ * to NULL and *loaded to false. Codec bundles are returned in the order they were saved with their codecs
+ * not loaded.
+ *
+ * Returns SAIL_OK on success, even if the cache cannot be used.
+ */
+SAIL_HIDDEN sail_status_t load_codecs_cache(const char* path,
+                                            const struct sail_string_node* codecs_paths,
+                                            const uint64_t* modification_times,
+                                            bool* loaded,
+                                            struct sail_codec_bundle_node** codec_bundle_node);
+
+/*
+ * Saves the codec info objects of the specified codec bundles into the cache. The modification times
+ * of the codecs directories must be taken before enumerating them, so changes made while enumerating
+ * invalidate the cache. Creates missing parent directories of the cache file. The file is written
+ * into a uniquely named temporary file and then replaced atomically where possible.
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_HIDDEN sail_status_t save_codecs_cache(const char* path,
+                                            const struct sail_string_node* codecs_paths,
+                                            const uint64_t* modification_times,
+                                            const struct sail_codec_bundle_node* codec_bundle_node);
@@ -54,4 +54,6 @@ sail_status_t sail_unload_codecs(void)
 void sail_finish(void)
 {
     destroy_global_context();
+
+    sail_shutdown_thread_pool();
 }
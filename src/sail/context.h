@@ -66,6 +66,22 @@ enum SailInitFlags
      * this option has no effect.
      */
     SAIL_FLAG_PRELOAD_CODECS = 1 << 0,
+
+    /*
+     * Cache the parsed codec info files on disk and re-use them on subsequent initializations
+     * to avoid listing the codecs directories and parsing every codec info file. The cache
+     * is keyed by the codecs directories and their modification times, and by the codec info
+     * files and their modification times and sizes. Installed, updated, or removed codecs
+     * and codec info files edited in place are picked up automatically.
+     *
+     * The cache is stored in $XDG_CACHE_HOME or $HOME/.cache on Unix, and in %LOCALAPPDATA%
+     * on Windows. Missing directories are created. The SAIL_CODECS_CACHE_PATH environment variable
+     * overrides the cache file path. It doesn't enable the cache without this flag.
+     *
+     * When SAIL is compiled with SAIL_COMBINE_CODECS enabled, this option only affects
+     * codecs loaded from SAIL_THIRD_PARTY_CODECS_PATH.
+     */
+    SAIL_FLAG_CACHE_CODECS_INFO = 1 << 1,
 };
 
 /*
@@ -138,6 +154,9 @@ SAIL_EXPORT sail_status_t sail_unload_codecs(void);
  * sail_codec_info_from_*(), and every pointer to load or save features inside those objects,
  * becomes invalid. Do not dereference them after this call.
  *
+ * Also stops and joins the worker threads of the parallel loops with sail_shutdown_thread_pool(),
+ * so no SAIL threads outlive it. New workers are started on demand.
+ *
  * It's possible to initialize a new global static context afterwards, implicitly or explicitly.
  *
  * Do not call this function between sail_start_loading_*() and sail_stop_loading(), or between
@@ -44,6 +44,9 @@
 
 static struct sail_context* global_context = NULL;
 
+/* The same as global_context, but set only after the context is fully initialized. */
+static struct sail_context* published_global_context = NULL;
+
 #ifdef SAIL_THREAD_SAFE
 static sail_mutex_t global_context_guard_mutex;
 
@@ -215,7 +218,13 @@ static sail_status_t alloc_context(struct sail_context** context)
     *context = ptr;
 
     (*context)->initialized       = false;
-    (*context)->codec_bundle_node = NULL;
+    (*context)->codec_bundle_node    = NULL;
+    (*context)->magic_numbers        = NULL;
+    (*context)->magic_numbers_length = 0;
+    (*context)->extension_index      = NULL;
+    (*context)->mime_type_index      = NULL;
+    (*context)->name_index           = NULL;
+    (*context)->codec_bundle_index   = NULL;
 
     return SAIL_OK;
 }
@@ -243,29 +252,123 @@ static sail_status_t destroy_context(struct sail_context* context)
     }
 
     destroy_codec_bundle_node_chain(context->codec_bundle_node);
+    sail_free(context->magic_numbers);
+    destroy_codec_info_index(context->extension_index);
+    destroy_codec_info_index(context->mime_type_index);
+    destroy_codec_info_index(context->name_index);
+    destroy_codec_bundle_index(context->codec_bundle_index);
     sail_free(context);
 
     return SAIL_OK;
 }
 
+/* The maximum number of threads used to preload codecs, including the calling thread. */
+#ifdef SAIL_THREAD_SAFE
+#define SAIL_PRELOAD_CODECS_THREADS 4
+#else
+#define SAIL_PRELOAD_CODECS_THREADS 1
+#endif
+
+struct preload_codecs_state
+{
+    struct sail_codec_bundle** codec_bundles;
+    /* Codec load times in microseconds. Sub-millisecond loads are common. */
+    uint64_t* load_times;
+    size_t codec_bundles_length;
+};
+
+/*
+ * Loads the codecs in the range in a thread of the pool. The context is locked by the caller, so no other
+ * thread loads codecs concurrently. Loaded codecs are published atomically for lock-free readers.
+ */
+static sail_status_t preload_codecs_rows(void* context, unsigned row_begin, unsigned row_end)
+{
+    struct preload_codecs_state* state = context;
+
+    for (unsigned index = row_begin; index < row_end; index++)
+    {
+        struct sail_codec_bundle* codec_bundle = state->codec_bundles[index];
+
+        if (codec_bundle->codec != NULL)
+        {
+            continue;
+        }
+
+        const uint64_t start_time = sail_now_us();
+        struct sail_codec* codec;
+
+        /* Ignore loading errors on purpose. */
+        if (alloc_and_load_codec(codec_bundle->codec_info, &codec) == SAIL_OK)
+        {
+            SAIL_ATOMIC_STORE_POINTER(&codec_bundle->codec, codec);
+            state->load_times[index] = sail_now_us() - start_time;
+        }
+    }
+
+    return SAIL_OK;
+}
+
 static sail_status_t preload_codecs(struct sail_context* context)
 {
     SAIL_CHECK_PTR(context);
 
-    SAIL_TRY(lock_context());
-
     SAIL_LOG_DEBUG("Preloading codecs");
 
+    struct preload_codecs_state state;
+    state.codec_bundles        = NULL;
+    state.load_times           = NULL;
+    state.codec_bundles_length = 0;
+
+    for (const struct sail_codec_bundle_node* codec_bundle_node = context->codec_bundle_node;
+         codec_bundle_node != NULL; codec_bundle_node = codec_bundle_node->next)
+    {
+        state.codec_bundles_length++;
+    }
+
+    if (state.codec_bundles_length == 0)
+    {
+        return SAIL_OK;
+    }
+
+    void* ptr;
+    SAIL_TRY(sail_malloc(state.codec_bundles_length * sizeof(struct sail_codec_bundle*), &ptr));
+    state.codec_bundles = ptr;
+
+    SAIL_TRY_OR_CLEANUP(sail_calloc(state.codec_bundles_length, sizeof(uint64_t), &ptr),
+                        /* cleanup */ sail_free(state.codec_bundles));
+    state.load_times = ptr;
+
+    size_t index = 0;
     for (struct sail_codec_bundle_node* codec_bundle_node = context->codec_bundle_node; codec_bundle_node != NULL;
          codec_bundle_node                                = codec_bundle_node->next)
     {
-        const struct sail_codec* codec;
+        state.codec_bundles[index++] = codec_bundle_node->codec_bundle;
+    }
 
-        /* Ignore loading errors on purpose. */
-        (void)load_codec_by_codec_info(codec_bundle_node->codec_bundle->codec_info, &codec);
+    const uint64_t start_time = sail_now();
+
+    SAIL_TRY_OR_CLEANUP(lock_context(),
+                        /* cleanup */ sail_free(state.load_times), sail_free(state.codec_bundles));
+    SAIL_TRY_OR_CLEANUP(sail_parallel_for((unsigned)state.codec_bundles_length, SAIL_PRELOAD_CODECS_THREADS,
+                                          preload_codecs_rows, &state),
+                        /* cleanup */ unlock_context(), sail_free(state.load_times), sail_free(state.codec_bundles));
+    SAIL_TRY_OR_CLEANUP(unlock_context(),
+                        /* cleanup */ sail_free(state.load_times), sail_free(state.codec_bundles));
+
+    /* Print the timings from a single thread to keep the output readable. */
+    for (size_t i = 0; i < state.codec_bundles_length; i++)
+    {
+        if (state.codec_bundles[i]->codec != NULL)
+        {
+            SAIL_LOG_DEBUG("Preloaded codec '%s' in %lu us", state.codec_bundles[i]->codec_info->name,
+                           (unsigned long)state.load_times[i]);
+        }
     }
 
-    SAIL_TRY(unlock_context());
+    SAIL_LOG_DEBUG("Preloaded codecs in %lu ms", (unsigned long)(sail_now() - start_time));
+
+    sail_free(state.load_times);
+    sail_free(state.codec_bundles);
 
     return SAIL_OK;
 }
@@ -381,35 +484,8 @@ static sail_status_t build_codec_bundle_from_codec_info_path(const char* codec_i
     SAIL_CHECK_PTR(codec_info_full_path);
     SAIL_CHECK_PTR(codec_bundle_node);
 
-    /* Build "/path/jpeg.so" from "/path/jpeg.codec.info". */
-    char* codec_info_part = strstr(codec_info_full_path, ".codec.info");
-
-    if (codec_info_part == NULL)
-    {
-        SAIL_LOG_AND_RETURN(SAIL_ERROR_MEMORY_ALLOCATION);
-    }
-
-    /* The length of "/path/jpeg". */
-    size_t codec_full_path_length = strlen(codec_info_full_path) - strlen(codec_info_part);
     char* codec_full_path;
-
-#ifdef SAIL_WIN32
-    static const char* const LIB_SUFFIX = "dll";
-#else
-    static const char* const LIB_SUFFIX = "so";
-#endif
-
-    /* The resulting string will be "/path/jpeg.plu" (on Windows) or "/path/jpeg.pl". */
-    SAIL_TRY(
-        sail_strdup_length(codec_info_full_path, codec_full_path_length + strlen(LIB_SUFFIX) + 1, &codec_full_path));
-
-#ifdef _MSC_VER
-    /* Overwrite the end of the path with "dll". */
-    strcpy_s(codec_full_path + codec_full_path_length + 1, strlen(LIB_SUFFIX) + 1, LIB_SUFFIX);
-#else
-    /* Overwrite the end of the path with "so". */
-    strcpy(codec_full_path + codec_full_path_length + 1, LIB_SUFFIX);
-#endif
+    SAIL_TRY(codec_path_from_codec_info_path(codec_info_full_path, &codec_full_path));
 
     struct sail_codec_bundle_node* local_codec_bundle_node;
 
@@ -430,12 +506,13 @@ static sail_status_t build_codec_bundle_from_codec_info_path(const char* codec_i
     return SAIL_OK;
 }
 
-static sail_status_t enumerate_codecs_in_paths(struct sail_context* context, const struct sail_string_node* string_node)
+/* Appends the codec bundles found in the specified paths to the specified list. */
+static sail_status_t enumerate_codecs_in_paths_impl(struct sail_codec_bundle_node** last_codec_bundle_node,
+                                                    const struct sail_string_node* string_node)
 {
-    SAIL_CHECK_PTR(context);
+    SAIL_CHECK_PTR(last_codec_bundle_node);
 
     /* Used to load and store codec info objects. */
-    struct sail_codec_bundle_node** last_codec_bundle_node = &context->codec_bundle_node;
     struct sail_codec_bundle_node* codec_bundle_node;
 
     for (; string_node != NULL; string_node = string_node->next)
@@ -546,11 +623,104 @@ static sail_status_t enumerate_codecs_in_paths(struct sail_context* context, con
 
     return SAIL_OK;
 }
+
+/* Joins the codecs paths with ';' to distinguish caches of different installations. */
+static sail_status_t join_codecs_paths(const struct sail_string_node* string_node, char** codecs_paths)
+{
+    char* result;
+    SAIL_TRY(sail_strdup("", &result));
+
+    for (; string_node != NULL; string_node = string_node->next)
+    {
+        char* joined;
+        SAIL_TRY_OR_CLEANUP(sail_concat(&joined, 3, result, string_node->string, ";"),
+                            /* cleanup */ sail_free(result));
+        sail_free(result);
+        result = joined;
+    }
+
+    *codecs_paths = result;
+
+    return SAIL_OK;
+}
+
+static sail_status_t enumerate_codecs_in_paths(struct sail_context* context,
+                                               const struct sail_string_node* string_node,
+                                               int flags)
+{
+    SAIL_CHECK_PTR(context);
+
+    /* Codecs from other paths may be already enumerated. */
+    struct sail_codec_bundle_node** last_codec_bundle_node = &context->codec_bundle_node;
+
+    while (*last_codec_bundle_node != NULL)
+    {
+        last_codec_bundle_node = &(*last_codec_bundle_node)->next;
+    }
+
+    char* codecs_paths;
+    SAIL_TRY(join_codecs_paths(string_node, &codecs_paths));
+
+    char* cache_path;
+    SAIL_TRY_OR_CLEANUP(codecs_cache_path(codecs_paths, flags & SAIL_FLAG_CACHE_CODECS_INFO, &cache_path),
+                        /* cleanup */ sail_free(codecs_paths));
+    sail_free(codecs_paths);
+
+    if (cache_path == NULL)
+    {
+        SAIL_TRY(enumerate_codecs_in_paths_impl(last_codec_bundle_node, string_node));
+        return SAIL_OK;
+    }
+
+    /*
+     * The modification times are taken before listing the directories, so codecs installed
+     * while enumerating invalidate the saved cache. Missing directories get zero.
+     */
+    unsigned paths_length = 0;
+
+    for (const struct sail_string_node* node = string_node; node != NULL; node = node->next)
+    {
+        paths_length++;
+    }
+
+    void* ptr;
+    SAIL_TRY_OR_CLEANUP(sail_calloc(paths_length + 1, sizeof(uint64_t), &ptr),
+                        /* cleanup */ sail_free(cache_path));
+    uint64_t* modification_times = ptr;
+
+    {
+        unsigned index = 0;
+
+        for (const struct sail_string_node* node = string_node; node != NULL; node = node->next, index++)
+        {
+            SAIL_TRY_OR_SUPPRESS(codecs_cache_modification_time(node->string, &modification_times[index]));
+        }
+    }
+
+    bool loaded;
+    SAIL_TRY_OR_CLEANUP(
+        load_codecs_cache(cache_path, string_node, modification_times, &loaded, last_codec_bundle_node),
+        /* cleanup */ sail_free(modification_times), sail_free(cache_path));
+
+    if (!loaded)
+    {
+        SAIL_TRY_OR_CLEANUP(enumerate_codecs_in_paths_impl(last_codec_bundle_node, string_node),
+                            /* cleanup */ sail_free(modification_times), sail_free(cache_path));
+
+        /* The cache is optional, so just report errors. */
+        SAIL_TRY_OR_SUPPRESS(save_codecs_cache(cache_path, string_node, modification_times, *last_codec_bundle_node));
+    }
+
+    sail_free(modification_times);
+    sail_free(cache_path);
+
+    return SAIL_OK;
+}
 #endif
 
 /* Initializes the context and loads all the codec info files. */
 #ifdef SAIL_COMBINE_CODECS
-static sail_status_t init_context_impl(struct sail_context* context)
+static sail_status_t init_context_impl(struct sail_context* context, int flags)
 {
     SAIL_CHECK_PTR(context);
 
@@ -558,10 +728,10 @@ static sail_status_t init_context_impl(struct sail_context* context)
 #ifdef SAIL_STATIC
     /* For example: [ "gif", "jpeg", "png" ]. */
     extern const char* const sail_enabled_codecs[];
-    extern const char* const sail_enabled_codecs_info[];
+    extern struct sail_codec_info_table const sail_enabled_codecs_info[];
 #else
     SAIL_IMPORT extern const char* const sail_enabled_codecs[];
-    SAIL_IMPORT extern const char* const sail_enabled_codecs_info[];
+    SAIL_IMPORT extern struct sail_codec_info_table const sail_enabled_codecs_info[];
 #endif
 
     /* Load codec info objects. */
@@ -569,9 +739,7 @@ static sail_status_t init_context_impl(struct sail_context* context)
 
     for (size_t i = 0; sail_enabled_codecs[i] != NULL; i++)
     {
-        const char* sail_codec_info = sail_enabled_codecs_info[i];
-
-        /* Parse codec info. */
+        /* Codec info is pre-parsed at build time. See sail_codec_info_table.cmake. */
         struct sail_codec_bundle_node* codec_bundle_node;
         SAIL_TRY_OR_EXECUTE(alloc_codec_bundle_node(&codec_bundle_node),
                             /* on error */ continue);
@@ -580,9 +748,10 @@ static sail_status_t init_context_impl(struct sail_context* context)
                             /* on error */ destroy_codec_bundle_node(codec_bundle_node);
                             continue);
 
-        SAIL_TRY_OR_EXECUTE(codec_read_info_from_string(sail_codec_info, &codec_bundle_node->codec_bundle->codec_info),
-                            /* on error */ destroy_codec_bundle_node(codec_bundle_node);
-                            continue);
+        SAIL_TRY_OR_EXECUTE(
+            codec_read_info_from_table(&sail_enabled_codecs_info[i], &codec_bundle_node->codec_bundle->codec_info),
+            /* on error */ destroy_codec_bundle_node(codec_bundle_node);
+            continue);
 
         *last_codec_bundle_node = codec_bundle_node;
         last_codec_bundle_node  = &codec_bundle_node->next;
@@ -593,10 +762,12 @@ static sail_status_t init_context_impl(struct sail_context* context)
     struct sail_string_node* client_codecs_paths;
     SAIL_TRY(client_codecs_paths_to_string_node_chain(&client_codecs_paths));
 
-    SAIL_TRY_OR_CLEANUP(enumerate_codecs_in_paths(context, client_codecs_paths),
+    SAIL_TRY_OR_CLEANUP(enumerate_codecs_in_paths(context, client_codecs_paths, flags),
                         /* cleanup */ sail_destroy_string_node_chain(client_codecs_paths));
 
     sail_destroy_string_node_chain(client_codecs_paths);
+#else
+    (void)flags;
 #endif
 
     return SAIL_OK;
@@ -647,7 +818,7 @@ static const char* sail_codecs_path(void)
     return path;
 }
 
-static sail_status_t init_context_impl(struct sail_context* context)
+static sail_status_t init_context_impl(struct sail_context* context, int flags)
 {
     SAIL_CHECK_PTR(context);
 
@@ -678,7 +849,7 @@ static sail_status_t init_context_impl(struct sail_context* context)
                         /* cleanup */ sail_destroy_string_node_chain(codecs_paths_node));
 #endif
 
-    SAIL_TRY_OR_CLEANUP(enumerate_codecs_in_paths(context, codecs_paths_node),
+    SAIL_TRY_OR_CLEANUP(enumerate_codecs_in_paths(context, codecs_paths_node, flags),
                         /* cleanup */ sail_destroy_string_node_chain(codecs_paths_node));
 
     sail_destroy_string_node_chain(codecs_paths_node);
@@ -766,7 +937,10 @@ static sail_status_t init_context(struct sail_context* context, int flags)
     }
 #endif
 
-    SAIL_TRY(init_context_impl(context));
+    SAIL_TRY(init_context_impl(context, flags));
+
+    /* Let codecs decode embedded previews in other formats. */
+    sail_set_embedded_image_loader(sail_load_from_memory);
 
     if (context->codec_bundle_node == NULL)
     {
@@ -777,6 +951,15 @@ static sail_status_t init_context(struct sail_context* context, int flags)
 
     SAIL_TRY(print_enumerated_codecs(context));
 
+    SAIL_TRY(compile_magic_numbers(context->codec_bundle_node, &context->magic_numbers, &context->magic_numbers_length));
+
+    SAIL_TRY(alloc_codec_info_index(context->codec_bundle_node, SAIL_CODEC_INFO_INDEX_EXTENSION,
+                                    &context->extension_index));
+    SAIL_TRY(alloc_codec_info_index(context->codec_bundle_node, SAIL_CODEC_INFO_INDEX_MIME_TYPE,
+                                    &context->mime_type_index));
+    SAIL_TRY(alloc_codec_info_index(context->codec_bundle_node, SAIL_CODEC_INFO_INDEX_NAME, &context->name_index));
+    SAIL_TRY(alloc_codec_bundle_index(context->codec_bundle_node, &context->codec_bundle_index));
+
     if (flags & SAIL_FLAG_PRELOAD_CODECS)
     {
         SAIL_TRY(preload_codecs(context));
@@ -796,6 +979,7 @@ sail_status_t destroy_global_context(void)
     SAIL_TRY(lock_context());
 
     SAIL_LOG_DEBUG("Destroyed context %p", global_context);
+    SAIL_ATOMIC_STORE_POINTER(&published_global_context, NULL);
     destroy_context(global_context);
     global_context = NULL;
 
@@ -818,6 +1002,23 @@ sail_status_t fetch_global_context_unsafe(struct sail_context** context)
     return SAIL_OK;
 }
 
+sail_status_t fetch_global_context_lock_free(struct sail_context** context)
+{
+    SAIL_CHECK_PTR(context);
+
+    struct sail_context* local_context = SAIL_ATOMIC_LOAD_POINTER(&published_global_context);
+
+    if (SAIL_LIKELY(local_context != NULL))
+    {
+        *context = local_context;
+        return SAIL_OK;
+    }
+
+    SAIL_TRY(fetch_global_context_guarded(context));
+
+    return SAIL_OK;
+}
+
 sail_status_t fetch_global_context_guarded_with_flags(struct sail_context** context, int flags)
 {
     SAIL_CHECK_PTR(context);
@@ -841,6 +1042,8 @@ sail_status_t fetch_global_context_unsafe_with_flags(struct sail_context** conte
     SAIL_TRY(allocate_global_context(&local_context));
     SAIL_TRY(init_context(local_context, flags));
 
+    SAIL_ATOMIC_STORE_POINTER(&published_global_context, local_context);
+
     *context = local_context;
 
     return SAIL_OK;
@@ -868,10 +1071,12 @@ sail_status_t sail_unload_codecs_private(void)
     {
         struct sail_codec_bundle* codec_bundle = codec_bundle_node->codec_bundle;
 
-        if (codec_bundle->codec != NULL)
+        struct sail_codec* codec = codec_bundle->codec;
+
+        if (codec != NULL)
         {
-            destroy_codec(codec_bundle->codec);
-            codec_bundle->codec = NULL;
+            SAIL_ATOMIC_STORE_POINTER(&codec_bundle->codec, NULL);
+            destroy_codec(codec);
             counter++;
         }
     }
@@ -26,11 +26,17 @@
 #pragma once
 
 #include <stdbool.h>
+#include <stddef.h> /* size_t */
 
+#include <sail-common/atomic_private.h>
+#include <sail-common/config.h>
 #include <sail-common/export.h>
 #include <sail-common/status.h>
 
+struct sail_codec_bundle_index;
 struct sail_codec_bundle_node;
+struct sail_codec_info_index;
+struct sail_compiled_magic_number;
 
 /*
  * Context is a main entry point to start working with SAIL. It enumerates codec info objects which could be
@@ -43,16 +49,63 @@ struct sail_context
 
     /* Linked list of found codec info objects. */
     struct sail_codec_bundle_node* codec_bundle_node;
+
+    /* Magic numbers of all the codecs compiled in the priority order. */
+    struct sail_compiled_magic_number* magic_numbers;
+    size_t magic_numbers_length;
+
+    /* Indexes to find codecs by file extensions, MIME types, and names. */
+    struct sail_codec_info_index* extension_index;
+    struct sail_codec_info_index* mime_type_index;
+    struct sail_codec_info_index* name_index;
+
+    /* Index to find codec bundles by codec info objects. */
+    struct sail_codec_bundle_index* codec_bundle_index;
 };
 
 typedef struct sail_context sail_context_t;
 
+/*
+ * Atomic pointer access used to publish lazily initialized data without holding the context lock.
+ * Without SAIL_THREAD_SAFE, these are plain reads and writes.
+ */
+#ifdef SAIL_THREAD_SAFE
+#define SAIL_ATOMIC_LOAD_POINTER(pointer) sail_atomic_load_pointer((void* const*)(pointer))
+#define SAIL_ATOMIC_STORE_POINTER(pointer, value) sail_atomic_store_pointer((void**)(pointer), (void*)(value))
+#define SAIL_ATOMIC_COMPARE_EXCHANGE_POINTER(pointer, expected, desired)                                              \
+    sail_atomic_compare_exchange_pointer((void**)(pointer), (void*)(expected), (void*)(desired))
+#else
+#define SAIL_ATOMIC_LOAD_POINTER(pointer) ((void*)*(pointer))
+#define SAIL_ATOMIC_STORE_POINTER(pointer, value) (*(pointer) = (value))
+#define SAIL_ATOMIC_COMPARE_EXCHANGE_POINTER(pointer, expected, desired)                                              \
+    (*(pointer) == (expected) ? (*(pointer) = (desired), (void*)(expected)) : (void*)*(pointer))
+#endif
+
+/*
+ * Atomic statistics counters. Without SAIL_THREAD_SAFE, these are plain reads and writes.
+ */
+#ifdef SAIL_THREAD_SAFE
+#define SAIL_ATOMIC_LOAD_U64(value) sail_atomic_load_u64(value)
+#define SAIL_ATOMIC_STORE_U64(value, new_value) sail_atomic_store_u64((value), (new_value))
+#define SAIL_ATOMIC_ADD_U64(value, delta) sail_atomic_add_u64((value), (delta))
+#else
+#define SAIL_ATOMIC_LOAD_U64(value) (*(value))
+#define SAIL_ATOMIC_STORE_U64(value, new_value) (*(value) = (new_value))
+#define SAIL_ATOMIC_ADD_U64(value, delta) (*(value) += (delta))
+#endif
+
 SAIL_HIDDEN sail_status_t destroy_global_context(void);
 
 SAIL_HIDDEN sail_status_t fetch_global_context_guarded(struct sail_context** context);
 
 SAIL_HIDDEN sail_status_t fetch_global_context_unsafe(struct sail_context** context);
 
+/*
+ * Returns the global context without locking if it's already fully initialized. Otherwise,
+ * initializes it under the context lock.
+ */
+SAIL_HIDDEN sail_status_t fetch_global_context_lock_free(struct sail_context** context);
+
 SAIL_HIDDEN sail_status_t fetch_global_context_guarded_with_flags(struct sail_context** context, int flags);
 
 SAIL_HIDDEN sail_status_t fetch_global_context_unsafe_with_flags(struct sail_context** context, int flags);
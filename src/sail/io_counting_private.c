@@ -0,0 +1,221 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdio.h>
+
+#include <sail/sail.h>
+
+/*
+ * Private functions.
+ */
+
+static sail_status_t io_counting_tolerant_read(void* stream, void* buf, size_t size_to_read, size_t* read_size)
+{
+    SAIL_CHECK_PTR(stream);
+    SAIL_CHECK_PTR(read_size);
+
+    struct io_counting_stream* io_counting_stream = stream;
+    struct sail_io* target                        = io_counting_stream->target;
+
+    sail_trace_begin("read", "io");
+    SAIL_TRY_OR_CLEANUP(target->tolerant_read(target->stream, buf, size_to_read, read_size),
+                        /* cleanup */ sail_trace_end("read", "io"));
+    sail_trace_end("read", "io");
+
+    io_counting_stream->bytes_read += *read_size;
+
+    return SAIL_OK;
+}
+
+static sail_status_t io_counting_strict_read(void* stream, void* buf, size_t size_to_read)
+{
+    SAIL_CHECK_PTR(stream);
+
+    struct io_counting_stream* io_counting_stream = stream;
+    struct sail_io* target                        = io_counting_stream->target;
+
+    sail_trace_begin("read", "io");
+    SAIL_TRY_OR_CLEANUP(target->strict_read(target->stream, buf, size_to_read),
+                        /* cleanup */ sail_trace_end("read", "io"));
+    sail_trace_end("read", "io");
+
+    io_counting_stream->bytes_read += size_to_read;
+
+    return SAIL_OK;
+}
+
+static sail_status_t io_counting_tolerant_write(void* stream,
+                                                const void* buf,
+                                                size_t size_to_write,
+                                                size_t* written_size)
+{
+    SAIL_CHECK_PTR(stream);
+    SAIL_CHECK_PTR(written_size);
+
+    struct io_counting_stream* io_counting_stream = stream;
+    struct sail_io* target                        = io_counting_stream->target;
+
+    sail_trace_begin("write", "io");
+    SAIL_TRY_OR_CLEANUP(target->tolerant_write(target->stream, buf, size_to_write, written_size),
+                        /* cleanup */ sail_trace_end("write", "io"));
+    sail_trace_end("write", "io");
+
+    io_counting_stream->bytes_written += *written_size;
+
+    return SAIL_OK;
+}
+
+static sail_status_t io_counting_strict_write(void* stream, const void* buf, size_t size_to_write)
+{
+    SAIL_CHECK_PTR(stream);
+
+    struct io_counting_stream* io_counting_stream = stream;
+    struct sail_io* target                        = io_counting_stream->target;
+
+    sail_trace_begin("write", "io");
+    SAIL_TRY_OR_CLEANUP(target->strict_write(target->stream, buf, size_to_write),
+                        /* cleanup */ sail_trace_end("write", "io"));
+    sail_trace_end("write", "io");
+
+    io_counting_stream->bytes_written += size_to_write;
+
+    return SAIL_OK;
+}
+
+static sail_status_t io_counting_seek(void* stream, long offset, int whence)
+{
+    SAIL_CHECK_PTR(stream);
+
+    struct sail_io* target = ((struct io_counting_stream*)stream)->target;
+
+    SAIL_TRY(target->seek(target->stream, offset, whence));
+
+    return SAIL_OK;
+}
+
+static sail_status_t io_counting_tell(void* stream, size_t* offset)
+{
+    SAIL_CHECK_PTR(stream);
+
+    struct sail_io* target = ((struct io_counting_stream*)stream)->target;
+
+    SAIL_TRY(target->tell(target->stream, offset));
+
+    return SAIL_OK;
+}
+
+static sail_status_t io_counting_flush(void* stream)
+{
+    SAIL_CHECK_PTR(stream);
+
+    struct sail_io* target = ((struct io_counting_stream*)stream)->target;
+
+    SAIL_TRY(target->flush(target->stream));
+
+    return SAIL_OK;
+}
+
+static sail_status_t io_counting_close(void* stream)
+{
+    /* The target I/O object is closed by its owner. */
+    sail_free(stream);
+
+    return SAIL_OK;
+}
+
+static sail_status_t io_counting_eof(void* stream, bool* result)
+{
+    SAIL_CHECK_PTR(stream);
+
+    struct sail_io* target = ((struct io_counting_stream*)stream)->target;
+
+    SAIL_TRY(target->eof(target->stream, result));
+
+    return SAIL_OK;
+}
+
+static sail_status_t io_counting_size(void* stream, size_t* size)
+{
+    SAIL_CHECK_PTR(stream);
+
+    struct sail_io* target = ((struct io_counting_stream*)stream)->target;
+
+    SAIL_TRY(target->size(target->stream, size));
+
+    return SAIL_OK;
+}
+
+static sail_status_t io_counting_borrow(void* stream, size_t size, const void** data)
+{
+    SAIL_CHECK_PTR(stream);
+
+    struct io_counting_stream* io_counting_stream = stream;
+    struct sail_io* target                        = io_counting_stream->target;
+
+    SAIL_TRY(target->borrow(target->stream, size, data));
+    io_counting_stream->bytes_read += size;
+
+    return SAIL_OK;
+}
+
+/*
+ * Public functions.
+ */
+
+sail_status_t alloc_io_counting(struct sail_io* target, struct sail_io** io)
+{
+    SAIL_TRY(sail_check_io_valid(target));
+    SAIL_CHECK_PTR(io);
+
+    struct sail_io* io_local;
+    SAIL_TRY(sail_alloc_io(&io_local));
+
+    void* ptr;
+    SAIL_TRY_OR_CLEANUP(sail_malloc(sizeof(struct io_counting_stream), &ptr),
+                        /* cleanup */ sail_destroy_io(io_local));
+    struct io_counting_stream* io_counting_stream = ptr;
+
+    io_counting_stream->target        = target;
+    io_counting_stream->bytes_read    = 0;
+    io_counting_stream->bytes_written = 0;
+
+    io_local->features       = target->features;
+    io_local->stream         = io_counting_stream;
+    io_local->tolerant_read  = io_counting_tolerant_read;
+    io_local->strict_read    = io_counting_strict_read;
+    io_local->tolerant_write = io_counting_tolerant_write;
+    io_local->strict_write   = io_counting_strict_write;
+    io_local->seek           = io_counting_seek;
+    io_local->tell           = io_counting_tell;
+    io_local->flush          = io_counting_flush;
+    io_local->close          = io_counting_close;
+    io_local->eof            = io_counting_eof;
+    io_local->size           = io_counting_size;
+    io_local->borrow         = (target->borrow != NULL) ? io_counting_borrow : NULL;
+
+    *io = io_local;
+
+    return SAIL_OK;
+}
@@ -265,6 +265,26 @@ static sail_status_t io_memory_size(void* stream, size_t* size)
     return SAIL_OK;
 }
 
+static sail_status_t io_memory_borrow(void* stream, size_t size, const void** data)
+{
+    SAIL_CHECK_PTR(stream);
+    SAIL_CHECK_PTR(data);
+
+    struct mem_io_read_stream* mem_io_read_stream = (struct mem_io_read_stream*)stream;
+    struct mem_io_buffer_info* mem_io_buffer_info = &mem_io_read_stream->mem_io_buffer_info;
+
+    if (mem_io_buffer_info->pos > mem_io_buffer_info->accessible_length
+        || size > mem_io_buffer_info->accessible_length - mem_io_buffer_info->pos)
+    {
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_READ_IO);
+    }
+
+    *data = (const char*)mem_io_read_stream->buffer + mem_io_buffer_info->pos;
+    mem_io_buffer_info->pos += size;
+
+    return SAIL_OK;
+}
+
 /*
  * Public functions.
  */
@@ -301,6 +321,7 @@ sail_status_t sail_alloc_io_read_memory(const void* buffer, size_t length, struc
     io_local->close          = io_memory_close;
     io_local->eof            = io_memory_eof;
     io_local->size           = io_memory_size;
+    io_local->borrow         = io_memory_borrow;
 
     *io = io_local;
 
@@ -339,6 +360,7 @@ sail_status_t sail_alloc_io_read_write_memory(void* buffer, size_t length, struc
     io_local->close          = io_memory_close;
     io_local->eof            = io_memory_eof;
     io_local->size           = io_memory_size;
+    io_local->borrow         = io_memory_borrow;
 
     *io = io_local;
 
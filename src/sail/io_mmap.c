@@ -0,0 +1,372 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdbool.h>
+#include <stddef.h> /* size_t */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef SAIL_WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <sail/sail.h>
+
+struct io_mmap_state
+{
+    /* The mapped file contents. NULL for empty files. */
+    const void* buffer;
+    size_t length;
+
+    /* Current stream position. */
+    size_t pos;
+};
+
+/*
+ * Private functions.
+ */
+
+static sail_status_t io_mmap_tolerant_read(void* stream, void* buf, size_t size_to_read, size_t* read_size)
+{
+    SAIL_CHECK_PTR(stream);
+    SAIL_CHECK_PTR(buf);
+    SAIL_CHECK_PTR(read_size);
+
+    struct io_mmap_state* io_mmap_state = stream;
+
+    *read_size = 0;
+
+    if (io_mmap_state->pos >= io_mmap_state->length)
+    {
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_EOF);
+    }
+
+    const size_t available           = io_mmap_state->length - io_mmap_state->pos;
+    const size_t actual_size_to_read = (size_to_read > available) ? available : size_to_read;
+
+    memcpy(buf, (const char*)io_mmap_state->buffer + io_mmap_state->pos, actual_size_to_read);
+    io_mmap_state->pos += actual_size_to_read;
+
+    *read_size = actual_size_to_read;
+
+    return SAIL_OK;
+}
+
+static sail_status_t io_mmap_strict_read(void* stream, void* buf, size_t size_to_read)
+{
+    size_t read_size;
+
+    SAIL_TRY(io_mmap_tolerant_read(stream, buf, size_to_read, &read_size));
+
+    if (read_size != size_to_read)
+    {
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_READ_IO);
+    }
+
+    return SAIL_OK;
+}
+
+static sail_status_t io_mmap_seek(void* stream, long offset, int whence)
+{
+    SAIL_CHECK_PTR(stream);
+
+    struct io_mmap_state* io_mmap_state = stream;
+
+    size_t origin;
+
+    switch (whence)
+    {
+    case SEEK_SET:
+    {
+        origin = 0;
+        break;
+    }
+
+    case SEEK_CUR:
+    {
+        origin = io_mmap_state->pos;
+        break;
+    }
+
+    case SEEK_END:
+    {
+        origin = io_mmap_state->length;
+        break;
+    }
+
+    default:
+    {
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_UNSUPPORTED_SEEK_WHENCE);
+    }
+    }
+
+    size_t new_pos;
+    SAIL_TRY(sail_io_compute_seek_position(origin, offset, &new_pos));
+
+    /* Seeking past the end is allowed like with files. Subsequent reads return EOF. */
+    io_mmap_state->pos = new_pos;
+
+    return SAIL_OK;
+}
+
+static sail_status_t io_mmap_tell(void* stream, size_t* offset)
+{
+    SAIL_CHECK_PTR(stream);
+    SAIL_CHECK_PTR(offset);
+
+    struct io_mmap_state* io_mmap_state = stream;
+
+    *offset = io_mmap_state->pos;
+
+    return SAIL_OK;
+}
+
+static sail_status_t io_mmap_close(void* stream)
+{
+    SAIL_CHECK_PTR(stream);
+
+    struct io_mmap_state* io_mmap_state = stream;
+
+    if (io_mmap_state->buffer != NULL)
+    {
+#ifdef SAIL_WIN32
+        if (!UnmapViewOfFile(io_mmap_state->buffer))
+        {
+            SAIL_LOG_ERROR("Failed to unmap the file. Error: 0x%X", GetLastError());
+            sail_free(io_mmap_state);
+            SAIL_LOG_AND_RETURN(SAIL_ERROR_CLOSE_IO);
+        }
+#else
+        if (munmap((void*)io_mmap_state->buffer, io_mmap_state->length) != 0)
+        {
+            SAIL_LOG_ERROR("Failed to unmap the file: %s", sail_strerror());
+            sail_free(io_mmap_state);
+            SAIL_LOG_AND_RETURN(SAIL_ERROR_CLOSE_IO);
+        }
+#endif
+    }
+
+    sail_free(io_mmap_state);
+
+    return SAIL_OK;
+}
+
+static sail_status_t io_mmap_eof(void* stream, bool* result)
+{
+    SAIL_CHECK_PTR(stream);
+    SAIL_CHECK_PTR(result);
+
+    struct io_mmap_state* io_mmap_state = stream;
+
+    *result = io_mmap_state->pos >= io_mmap_state->length;
+
+    return SAIL_OK;
+}
+
+static sail_status_t io_mmap_size(void* stream, size_t* size)
+{
+    SAIL_CHECK_PTR(stream);
+    SAIL_CHECK_PTR(size);
+
+    struct io_mmap_state* io_mmap_state = stream;
+
+    *size = io_mmap_state->length;
+
+    return SAIL_OK;
+}
+
+static sail_status_t io_mmap_borrow(void* stream, size_t size, const void** data)
+{
+    SAIL_CHECK_PTR(stream);
+    SAIL_CHECK_PTR(data);
+
+    struct io_mmap_state* io_mmap_state = stream;
+
+    if (io_mmap_state->pos > io_mmap_state->length || size > io_mmap_state->length - io_mmap_state->pos)
+    {
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_READ_IO);
+    }
+
+    *data = (const char*)io_mmap_state->buffer + io_mmap_state->pos;
+    io_mmap_state->pos += size;
+
+    return SAIL_OK;
+}
+
+/* Maps the whole file into memory. Empty files produce a NULL buffer. */
+static sail_status_t map_file(const char* path, const void** buffer, size_t* length)
+{
+#ifdef SAIL_WIN32
+    wchar_t* wpath;
+    SAIL_TRY(sail_multibyte_to_wchar(path, &wpath));
+
+    HANDLE file = CreateFileW(wpath, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+    sail_free(wpath);
+
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        SAIL_LOG_ERROR("Failed to open the specified file. Error: 0x%X", GetLastError());
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_OPEN_FILE);
+    }
+
+    LARGE_INTEGER file_size;
+
+    if (!GetFileSizeEx(file, &file_size))
+    {
+        SAIL_LOG_ERROR("Failed to get the file size. Error: 0x%X", GetLastError());
+        CloseHandle(file);
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_OPEN_FILE);
+    }
+
+    if ((unsigned long long)file_size.QuadPart > SIZE_MAX)
+    {
+        SAIL_LOG_ERROR("The file is too large to be mapped");
+        CloseHandle(file);
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_OPEN_FILE);
+    }
+
+    *length = (size_t)file_size.QuadPart;
+
+    if (*length == 0)
+    {
+        CloseHandle(file);
+        *buffer = NULL;
+        return SAIL_OK;
+    }
+
+    HANDLE mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+
+    /* The mapping keeps the file open. */
+    CloseHandle(file);
+
+    if (mapping == NULL)
+    {
+        SAIL_LOG_ERROR("Failed to map the file. Error: 0x%X", GetLastError());
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_OPEN_FILE);
+    }
+
+    *buffer = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+    /* The view keeps the mapping alive. */
+    CloseHandle(mapping);
+
+    if (*buffer == NULL)
+    {
+        SAIL_LOG_ERROR("Failed to map the file. Error: 0x%X", GetLastError());
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_OPEN_FILE);
+    }
+#else
+    const int fd = open(path, O_RDONLY);
+
+    if (fd < 0)
+    {
+        SAIL_LOG_ERROR("Failed to open the specified file: %s", sail_strerror());
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_OPEN_FILE);
+    }
+
+    struct stat attrs;
+
+    if (fstat(fd, &attrs) != 0)
+    {
+        SAIL_LOG_ERROR("Failed to get the file size: %s", sail_strerror());
+        close(fd);
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_OPEN_FILE);
+    }
+
+    *length = (size_t)attrs.st_size;
+
+    if (*length == 0)
+    {
+        close(fd);
+        *buffer = NULL;
+        return SAIL_OK;
+    }
+
+    void* mapped = mmap(NULL, *length, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    /* The mapping keeps the file open. */
+    close(fd);
+
+    if (mapped == MAP_FAILED)
+    {
+        SAIL_LOG_ERROR("Failed to map the file: %s", sail_strerror());
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_OPEN_FILE);
+    }
+
+    *buffer = mapped;
+#endif
+
+    return SAIL_OK;
+}
+
+/*
+ * Public functions.
+ */
+
+sail_status_t sail_alloc_io_read_mmap(const char* path, struct sail_io** io)
+{
+    SAIL_CHECK_PTR(path);
+    SAIL_CHECK_PTR(io);
+
+    SAIL_LOG_DEBUG("Mapping file '%s' for reading", path);
+
+    void* ptr;
+    SAIL_TRY(sail_malloc(sizeof(struct io_mmap_state), &ptr));
+    struct io_mmap_state* io_mmap_state = ptr;
+
+    io_mmap_state->pos = 0;
+
+    SAIL_TRY_OR_CLEANUP(map_file(path, &io_mmap_state->buffer, &io_mmap_state->length),
+                        /* cleanup */ sail_free(io_mmap_state));
+
+    struct sail_io* io_local;
+    SAIL_TRY_OR_CLEANUP(sail_alloc_io(&io_local),
+                        /* cleanup */ io_mmap_close(io_mmap_state));
+
+    io_local->features       = SAIL_IO_FEATURE_SEEKABLE;
+    io_local->stream         = io_mmap_state;
+    io_local->tolerant_read  = io_mmap_tolerant_read;
+    io_local->strict_read    = io_mmap_strict_read;
+    io_local->tolerant_write = sail_io_not_implemented_tolerant_write;
+    io_local->strict_write   = sail_io_not_implemented_strict_write;
+    io_local->seek           = io_mmap_seek;
+    io_local->tell           = io_mmap_tell;
+    io_local->flush          = sail_io_noop_flush;
+    io_local->close          = io_mmap_close;
+    io_local->eof            = io_mmap_eof;
+    io_local->size           = io_mmap_size;
+    io_local->borrow         = io_mmap_borrow;
+
+    *io = io_local;
+
+    return SAIL_OK;
+}
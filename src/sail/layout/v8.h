@@ -131,6 +131,10 @@ Please define SAIL_CODEC_NAME before including this header.
  * During probing, libsail calls load_init, then this function once, then load_finish. load_frame is
  * not called. Fill every field needed to describe the image without pixels.
  *
+ * Probing sets SAIL_OPTION_PROBE in load options. When it's set, load_init and this function should
+ * stop after parsing headers: don't start the underlying decoder, decode frames, or allocate buffers
+ * needed only by load_frame.
+ *
  * Respect load_options->options flags. For example, allocate and fill sail_image.source_image only when
  * SAIL_OPTION_SOURCE_IMAGE is set. Fill meta data only when SAIL_OPTION_META_DATA is set. Fill ICC profile
  * only when SAIL_OPTION_ICCP is set.
@@ -0,0 +1,201 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdbool.h>
+#include <string.h>
+
+#include <sail/sail.h>
+
+/*
+ * Private functions.
+ */
+
+static int hex_digit_value(char c)
+{
+    if (c >= '0' && c <= '9')
+    {
+        return c - '0';
+    }
+    else if (c >= 'a' && c <= 'f')
+    {
+        return c - 'a' + 10;
+    }
+    else if (c >= 'A' && c <= 'F')
+    {
+        return c - 'A' + 10;
+    }
+    else
+    {
+        return -1;
+    }
+}
+
+/*
+ * Compiles "ab ?? cd" into bytes and a mask. Magic numbers longer than SAIL_MAGIC_BUFFER_SIZE
+ * are truncated as only SAIL_MAGIC_BUFFER_SIZE bytes are read from images.
+ */
+static sail_status_t compile_magic_number(const char* magic, struct sail_compiled_magic_number* compiled_magic_number)
+{
+    size_t length = 0;
+
+    while (length < SAIL_MAGIC_BUFFER_SIZE)
+    {
+        /* Skip whitespaces. */
+        while (*magic == ' ' || *magic == '\t')
+        {
+            magic++;
+        }
+
+        if (*magic == '\0')
+        {
+            break;
+        }
+
+        /* Every byte must be exactly two characters long. */
+        const char hi = magic[0];
+        const char lo = magic[1];
+
+        if (lo == '\0' || (magic[2] != '\0' && magic[2] != ' ' && magic[2] != '\t'))
+        {
+            SAIL_LOG_AND_RETURN(SAIL_ERROR_PARSE_FILE);
+        }
+
+        if (hi == '?')
+        {
+            compiled_magic_number->bytes[length] = 0;
+            compiled_magic_number->mask[length]  = 0;
+        }
+        else
+        {
+            const int hi_value = hex_digit_value(hi);
+            const int lo_value = hex_digit_value(lo);
+
+            if (hi_value < 0 || lo_value < 0)
+            {
+                SAIL_LOG_AND_RETURN(SAIL_ERROR_PARSE_FILE);
+            }
+
+            compiled_magic_number->bytes[length] = (unsigned char)(hi_value << 4 | lo_value);
+            compiled_magic_number->mask[length]  = 0xFF;
+        }
+
+        magic += 2;
+        length++;
+    }
+
+    compiled_magic_number->length = length;
+
+    return SAIL_OK;
+}
+
+/*
+ * Public functions.
+ */
+
+sail_status_t compile_magic_numbers(const struct sail_codec_bundle_node* codec_bundle_node,
+                                    struct sail_compiled_magic_number** magic_numbers,
+                                    size_t* magic_numbers_length)
+{
+    SAIL_CHECK_PTR(magic_numbers);
+    SAIL_CHECK_PTR(magic_numbers_length);
+
+    /* Count the magic numbers. */
+    size_t count = 0;
+
+    for (const struct sail_codec_bundle_node* node = codec_bundle_node; node != NULL; node = node->next)
+    {
+        for (const struct sail_string_node* magic_number_node = node->codec_bundle->codec_info->magic_number_node;
+             magic_number_node != NULL; magic_number_node = magic_number_node->next)
+        {
+            count++;
+        }
+    }
+
+    if (count == 0)
+    {
+        *magic_numbers        = NULL;
+        *magic_numbers_length = 0;
+        return SAIL_OK;
+    }
+
+    void* ptr;
+    SAIL_TRY(sail_malloc(sizeof(struct sail_compiled_magic_number) * count, &ptr));
+    struct sail_compiled_magic_number* local_magic_numbers = ptr;
+
+    size_t index = 0;
+
+    for (const struct sail_codec_bundle_node* node = codec_bundle_node; node != NULL; node = node->next)
+    {
+        const struct sail_codec_info* codec_info = node->codec_bundle->codec_info;
+
+        for (const struct sail_string_node* magic_number_node = codec_info->magic_number_node;
+             magic_number_node != NULL; magic_number_node = magic_number_node->next)
+        {
+            struct sail_compiled_magic_number* compiled_magic_number = &local_magic_numbers[index];
+
+            if (compile_magic_number(magic_number_node->string, compiled_magic_number) == SAIL_OK)
+            {
+                compiled_magic_number->codec_info = codec_info;
+                index++;
+            }
+            else
+            {
+                SAIL_LOG_ERROR("Skipping invalid %s magic number '%s'", codec_info->name, magic_number_node->string);
+            }
+        }
+    }
+
+    *magic_numbers        = local_magic_numbers;
+    *magic_numbers_length = index;
+
+    return SAIL_OK;
+}
+
+const struct sail_codec_info* match_compiled_magic_numbers(const struct sail_compiled_magic_number* magic_numbers,
+                                                           size_t magic_numbers_length,
+                                                           const unsigned char* buffer)
+{
+    for (size_t i = 0; i < magic_numbers_length; i++)
+    {
+        const struct sail_compiled_magic_number* compiled_magic_number = &magic_numbers[i];
+        bool mismatch                                                  = false;
+
+        for (size_t k = 0; k < compiled_magic_number->length; k++)
+        {
+            if ((buffer[k] & compiled_magic_number->mask[k]) != compiled_magic_number->bytes[k])
+            {
+                mismatch = true;
+                break;
+            }
+        }
+
+        if (!mismatch)
+        {
+            return compiled_magic_number->codec_info;
+        }
+    }
+
+    return NULL;
+}
@@ -0,0 +1,75 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <stddef.h> /* size_t */
+
+#include <sail-common/config.h>
+#include <sail-common/export.h>
+#include <sail-common/status.h>
+
+struct sail_codec_bundle_node;
+struct sail_codec_info;
+
+/*
+ * Magic number compiled into a byte/mask table. Compiled once when the context is initialized
+ * to avoid parsing hex strings on every probe.
+ */
+struct sail_compiled_magic_number
+{
+    /* Shallow pointer to the codec info the magic number belongs to. */
+    const struct sail_codec_info* codec_info;
+
+    /* Expected bytes. Bytes matched by "??" are zeroed. */
+    unsigned char bytes[SAIL_MAGIC_BUFFER_SIZE];
+
+    /* 0xFF for the bytes to compare, 0x00 for bytes matched by "??". */
+    unsigned char mask[SAIL_MAGIC_BUFFER_SIZE];
+
+    /* The number of bytes to compare. */
+    size_t length;
+};
+
+/*
+ * Compiles the magic numbers of all the codecs in the chain into a flat array. The resulting array
+ * preserves the order of the codecs and the order of their magic numbers. Invalid magic numbers are skipped.
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_HIDDEN sail_status_t compile_magic_numbers(const struct sail_codec_bundle_node* codec_bundle_node,
+                                                struct sail_compiled_magic_number** magic_numbers,
+                                                size_t* magic_numbers_length);
+
+/*
+ * Finds the first compiled magic number matching the buffer. The buffer must be
+ * at least SAIL_MAGIC_BUFFER_SIZE bytes long.
+ *
+ * Returns the matched codec info or NULL.
+ */
+SAIL_HIDDEN const struct sail_codec_info* match_compiled_magic_numbers(
+    const struct sail_compiled_magic_number* magic_numbers,
+    size_t magic_numbers_length,
+    const unsigned char* buffer);
@@ -0,0 +1,161 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <string.h>
+
+#include <sail/sail.h>
+
+/* Counters of the last operation finished on the current thread. */
+static SAIL_THREAD_LOCAL struct sail_operation_stats last_operation_stats;
+
+/*
+ * Private functions.
+ */
+
+static void add_operation_stats(struct sail_operation_stats* total, const struct sail_operation_stats* stats)
+{
+    SAIL_ATOMIC_ADD_U64(&total->operations, stats->operations);
+    SAIL_ATOMIC_ADD_U64(&total->frames, stats->frames);
+    SAIL_ATOMIC_ADD_U64(&total->init_time, stats->init_time);
+    SAIL_ATOMIC_ADD_U64(&total->seek_next_frame_time, stats->seek_next_frame_time);
+    SAIL_ATOMIC_ADD_U64(&total->frame_time, stats->frame_time);
+    SAIL_ATOMIC_ADD_U64(&total->finish_time, stats->finish_time);
+    SAIL_ATOMIC_ADD_U64(&total->conversion_time, stats->conversion_time);
+    SAIL_ATOMIC_ADD_U64(&total->bytes_read, stats->bytes_read);
+    SAIL_ATOMIC_ADD_U64(&total->bytes_written, stats->bytes_written);
+    SAIL_ATOMIC_ADD_U64(&total->bytes_allocated, stats->bytes_allocated);
+}
+
+static void load_operation_stats(const struct sail_operation_stats* total, struct sail_operation_stats* stats)
+{
+    stats->operations           = SAIL_ATOMIC_LOAD_U64(&total->operations);
+    stats->frames               = SAIL_ATOMIC_LOAD_U64(&total->frames);
+    stats->init_time            = SAIL_ATOMIC_LOAD_U64(&total->init_time);
+    stats->seek_next_frame_time = SAIL_ATOMIC_LOAD_U64(&total->seek_next_frame_time);
+    stats->frame_time           = SAIL_ATOMIC_LOAD_U64(&total->frame_time);
+    stats->finish_time          = SAIL_ATOMIC_LOAD_U64(&total->finish_time);
+    stats->conversion_time      = SAIL_ATOMIC_LOAD_U64(&total->conversion_time);
+    stats->bytes_read           = SAIL_ATOMIC_LOAD_U64(&total->bytes_read);
+    stats->bytes_written        = SAIL_ATOMIC_LOAD_U64(&total->bytes_written);
+    stats->bytes_allocated      = SAIL_ATOMIC_LOAD_U64(&total->bytes_allocated);
+}
+
+static void reset_operation_stats(struct sail_operation_stats* total)
+{
+    SAIL_ATOMIC_STORE_U64(&total->operations, 0);
+    SAIL_ATOMIC_STORE_U64(&total->frames, 0);
+    SAIL_ATOMIC_STORE_U64(&total->init_time, 0);
+    SAIL_ATOMIC_STORE_U64(&total->seek_next_frame_time, 0);
+    SAIL_ATOMIC_STORE_U64(&total->frame_time, 0);
+    SAIL_ATOMIC_STORE_U64(&total->finish_time, 0);
+    SAIL_ATOMIC_STORE_U64(&total->conversion_time, 0);
+    SAIL_ATOMIC_STORE_U64(&total->bytes_read, 0);
+    SAIL_ATOMIC_STORE_U64(&total->bytes_written, 0);
+    SAIL_ATOMIC_STORE_U64(&total->bytes_allocated, 0);
+}
+
+/*
+ * Public functions.
+ */
+
+void record_operation_stats(struct hidden_state* state)
+{
+    const struct io_counting_stream* io_counting_stream = state->io->stream;
+
+    state->stats.operations    = 1;
+    state->stats.bytes_read    = io_counting_stream->bytes_read;
+    state->stats.bytes_written = io_counting_stream->bytes_written;
+
+    last_operation_stats = state->stats;
+
+    struct sail_context* context;
+    SAIL_TRY_OR_EXECUTE(fetch_global_context_lock_free(&context),
+                        /* on error */ return);
+
+    struct sail_codec_bundle* codec_bundle;
+    SAIL_TRY_OR_EXECUTE(find_codec_bundle(context, state->codec_info, &codec_bundle),
+                        /* on error */ return);
+
+    struct sail_codec* codec = SAIL_ATOMIC_LOAD_POINTER(&codec_bundle->codec);
+
+    if (codec != NULL)
+    {
+        add_operation_stats((state->save_options != NULL) ? &codec->stats.save : &codec->stats.load, &state->stats);
+    }
+}
+
+sail_status_t sail_get_last_operation_stats(struct sail_operation_stats* stats)
+{
+    SAIL_CHECK_PTR(stats);
+
+    *stats = last_operation_stats;
+
+    return SAIL_OK;
+}
+
+sail_status_t sail_codec_stats(const struct sail_codec_info* codec_info, struct sail_codec_stats* stats)
+{
+    SAIL_CHECK_PTR(codec_info);
+    SAIL_CHECK_PTR(stats);
+
+    struct sail_context* context;
+    SAIL_TRY(fetch_global_context_lock_free(&context));
+
+    struct sail_codec_bundle* codec_bundle;
+    SAIL_TRY(find_codec_bundle(context, codec_info, &codec_bundle));
+
+    const struct sail_codec* codec = SAIL_ATOMIC_LOAD_POINTER(&codec_bundle->codec);
+
+    if (codec == NULL)
+    {
+        memset(stats, 0, sizeof(*stats));
+        return SAIL_OK;
+    }
+
+    load_operation_stats(&codec->stats.load, &stats->load);
+    load_operation_stats(&codec->stats.save, &stats->save);
+
+    return SAIL_OK;
+}
+
+sail_status_t sail_reset_codec_stats(void)
+{
+    struct sail_context* context;
+    SAIL_TRY(fetch_global_context_lock_free(&context));
+
+    for (struct sail_codec_bundle_node* codec_bundle_node = context->codec_bundle_node; codec_bundle_node != NULL;
+         codec_bundle_node                                = codec_bundle_node->next)
+    {
+        struct sail_codec* codec = SAIL_ATOMIC_LOAD_POINTER(&codec_bundle_node->codec_bundle->codec);
+
+        if (codec != NULL)
+        {
+            reset_operation_stats(&codec->stats.load);
+            reset_operation_stats(&codec->stats.save);
+        }
+    }
+
+    return SAIL_OK;
+}
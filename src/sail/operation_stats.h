@@ -0,0 +1,121 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+#include <sail-common/export.h>
+#include <sail-common/status.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+struct sail_codec_info;
+
+/*
+ * Performance counters of loading or saving operations. An operation starts with
+ * sail_start_loading_*() or sail_start_saving_*() and ends with sail_stop_loading() or sail_stop_saving().
+ * Times are in microseconds.
+ */
+struct sail_operation_stats
+{
+    /* The number of finished operations. */
+    uint64_t operations;
+
+    /* The number of frames the codecs seeked to, including skipped frames. */
+    uint64_t frames;
+
+    /* Time spent in the codec load_init or save_init functions. */
+    uint64_t init_time;
+
+    /* Time spent in the codec load_seek_next_frame or save_seek_next_frame functions. */
+    uint64_t seek_next_frame_time;
+
+    /* Time spent in the codec load_frame or save_frame functions, including row band callbacks. */
+    uint64_t frame_time;
+
+    /* Time spent in the codec load_finish or save_finish functions. */
+    uint64_t finish_time;
+
+    /* Time SAIL spent converting loaded pixels: generic cropping and aligning scan lines. */
+    uint64_t conversion_time;
+
+    /* Bytes read through the I/O object. */
+    uint64_t bytes_read;
+
+    /* Bytes written through the I/O object. */
+    uint64_t bytes_written;
+
+    /* Bytes allocated with sail_malloc() and friends on the calling thread, including frame pixels. */
+    uint64_t bytes_allocated;
+};
+
+typedef struct sail_operation_stats sail_operation_stats_t;
+
+/*
+ * Aggregated performance counters of a codec.
+ */
+struct sail_codec_stats
+{
+    /* Sums of all finished loading operations. */
+    struct sail_operation_stats load;
+
+    /* Sums of all finished saving operations. */
+    struct sail_operation_stats save;
+};
+
+typedef struct sail_codec_stats sail_codec_stats_t;
+
+/*
+ * Assigns the performance counters of the last loading or saving operation finished
+ * on the calling thread. All the values are zero if no operation has finished yet.
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_EXPORT sail_status_t sail_get_last_operation_stats(struct sail_operation_stats* stats);
+
+/*
+ * Assigns the performance counters of the specified codec aggregated over all finished operations
+ * since the codec was loaded or the counters were reset. All the values are zero if the codec
+ * is not loaded yet. Thread-safe.
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_EXPORT sail_status_t sail_codec_stats(const struct sail_codec_info* codec_info, struct sail_codec_stats* stats);
+
+/*
+ * Resets the aggregated performance counters of all codecs. Thread-safe.
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_EXPORT sail_status_t sail_reset_codec_stats(void);
+
+/* extern "C" */
+#ifdef __cplusplus
+}
+#endif
@@ -37,8 +37,10 @@
 #include <sail/io_expanding_buffer.h>
 #include <sail/io_file.h>
 #include <sail/io_memory.h>
+#include <sail/io_mmap.h>
 #include <sail/io_noop.h>
 #include <sail/io_not_implemented.h>
+#include <sail/operation_stats.h>
 #include <sail/sail_advanced.h>
 #include <sail/sail_deep_diver.h>
 #include <sail/sail_junior.h>
@@ -48,11 +50,17 @@
 #include <sail/codec.h>
 #include <sail/codec_bundle_node_private.h>
 #include <sail/codec_bundle_private.h>
+#include <sail/codec_info_index_private.h>
 #include <sail/codec_info_private.h>
+#include <sail/codec_info_table.h>
 #include <sail/codec_layout.h>
+#include <sail/codecs_cache_private.h>
 #include <sail/context_private.h>
+#include <sail/io_counting_private.h>
 #include <sail/ini.h>
 #include <sail/ini_malloc.h>
+#include <sail/magic_number_private.h>
+#include <sail/operation_stats_private.h>
 #include <sail/sail_private.h>
 #include <sail/sail_technical_diver_private.h>
 #ifdef SAIL_THREAD_SAFE
@@ -23,13 +23,17 @@
     SOFTWARE.
 */
 
+#include <limits.h> /* UINT_MAX */
 #include <stddef.h>
 #include <stdint.h> /* SIZE_MAX */
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <sail/sail.h>
 
+#include <sail-common/options_private.h>
+
 sail_status_t sail_probe_io(struct sail_io* io, struct sail_image** image, const struct sail_codec_info** codec_info)
 {
     SAIL_CHECK_PTR(io);
@@ -61,6 +65,165 @@ sail_status_t sail_probe_memory(const void* buffer,
     return SAIL_OK;
 }
 
+struct probe_many_state
+{
+    const char* const* paths;
+    struct sail_probe_result* results;
+    size_t prefix_size;
+};
+
+static sail_status_t probe_prefix(const void* prefix,
+                                  size_t prefix_length,
+                                  const struct sail_codec_info* codec_info,
+                                  struct sail_image** image)
+{
+    struct sail_io* io;
+    SAIL_TRY(sail_alloc_io_read_memory(prefix, prefix_length, &io));
+
+    SAIL_TRY_OR_CLEANUP(sail_probe_io_with_options(io, codec_info, NULL, image),
+                        /* cleanup */ sail_destroy_io(io));
+
+    sail_destroy_io(io);
+
+    return SAIL_OK;
+}
+
+/*
+ * Reads the file prefix with a single request and parses headers from it. Falls back to the opened file
+ * when the prefix is too short for the headers.
+ */
+static sail_status_t probe_file_with_prefix(const char* path,
+                                            size_t prefix_size,
+                                            struct sail_image** image,
+                                            const struct sail_codec_info** codec_info)
+{
+    struct sail_io* io;
+    SAIL_TRY(sail_alloc_io_read_file(path, &io));
+
+    void* prefix;
+    SAIL_TRY_OR_CLEANUP(sail_malloc(prefix_size, &prefix),
+                        /* cleanup */ sail_destroy_io(io));
+
+    size_t prefix_length;
+    SAIL_TRY_OR_CLEANUP(io->tolerant_read(io->stream, prefix, prefix_size, &prefix_length),
+                        /* cleanup */ sail_free(prefix), sail_destroy_io(io));
+
+    const struct sail_codec_info* codec_info_local;
+    sail_status_t status = sail_codec_info_from_path(path, &codec_info_local);
+
+    if (status != SAIL_OK)
+    {
+        status = sail_codec_info_by_magic_number_from_memory(prefix, prefix_length, &codec_info_local);
+    }
+
+    if (status == SAIL_OK)
+    {
+        status = probe_prefix(prefix, prefix_length, codec_info_local, image);
+
+        if (status != SAIL_OK && prefix_length == prefix_size)
+        {
+            SAIL_LOG_DEBUG("Headers of '%s' don't fit into the prefix, probing the whole file", path);
+
+            status = io->seek(io->stream, 0, SEEK_SET);
+
+            if (status == SAIL_OK)
+            {
+                status = sail_probe_io_with_options(io, codec_info_local, NULL, image);
+            }
+        }
+    }
+
+    sail_free(prefix);
+    sail_destroy_io(io);
+
+    if (status == SAIL_OK)
+    {
+        *codec_info = codec_info_local;
+    }
+
+    return status;
+}
+
+/* Probes the files [index_begin, index_end). Failures are stored into the results, so the loop never stops. */
+static sail_status_t probe_many_files(void* context, unsigned index_begin, unsigned index_end)
+{
+    const struct probe_many_state* state = context;
+
+    for (unsigned index = index_begin; index < index_end; index++)
+    {
+        struct sail_probe_result* result = &state->results[index];
+
+        result->status = probe_file_with_prefix(state->paths[index], state->prefix_size, &result->image,
+                                                &result->codec_info);
+    }
+
+    return SAIL_OK;
+}
+
+sail_status_t sail_probe_many(const char* const* paths,
+                              size_t count,
+                              struct sail_probe_result** results,
+                              const struct sail_probe_many_options* options)
+{
+    SAIL_CHECK_PTR(paths);
+    SAIL_CHECK_PTR(results);
+
+    if (count == 0)
+    {
+        *results = NULL;
+        return SAIL_OK;
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        SAIL_CHECK_PTR(paths[i]);
+    }
+
+    void* ptr;
+    SAIL_TRY(sail_calloc(count, sizeof(struct sail_probe_result), &ptr));
+    struct sail_probe_result* results_local = ptr;
+
+    const unsigned threads = (options == NULL || options->threads == 0) ? SAIL_PROBE_MANY_DEFAULT_THREADS
+                                                                         : options->threads;
+    const size_t prefix_size = (options == NULL || options->prefix_size == 0) ? SAIL_PROBE_MANY_DEFAULT_PREFIX_SIZE
+                                                                              : options->prefix_size;
+
+    SAIL_LOG_DEBUG("Probing %u file(s) in up to %u thread(s)", (unsigned)count, threads);
+
+    /* The pool counts rows in unsigned, so probe huge lists in batches. */
+    for (size_t batch_begin = 0; batch_begin < count; batch_begin += UINT_MAX)
+    {
+        const size_t batch_length = (count - batch_begin < UINT_MAX) ? count - batch_begin : UINT_MAX;
+
+        struct probe_many_state state;
+        state.paths       = paths + batch_begin;
+        state.results     = results_local + batch_begin;
+        state.prefix_size = prefix_size;
+
+        SAIL_TRY_OR_CLEANUP(sail_parallel_for((unsigned)batch_length, threads, probe_many_files, &state),
+                            /* cleanup */ sail_destroy_probe_results(results_local, count));
+    }
+
+    *results = results_local;
+
+    return SAIL_OK;
+}
+
+void sail_destroy_probe_results(struct sail_probe_result* results, size_t count)
+{
+    if (results == NULL)
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        sail_destroy_image(results[i].image);
+    }
+
+    sail_free(results);
+}
+
 sail_status_t sail_start_loading_from_file(const char* path, const struct sail_codec_info* codec_info, void** state)
 {
     SAIL_TRY(sail_start_loading_from_file_with_options(path, codec_info, NULL, state));
@@ -78,23 +241,44 @@ sail_status_t sail_start_loading_from_memory(const void* buffer,
     return SAIL_OK;
 }
 
-sail_status_t sail_load_next_frame(void* state, struct sail_image** image)
+/*
+ * Seeks to the next frame and returns its validated skeleton without pixels.
+ */
+static sail_status_t load_next_frame_skeleton(struct hidden_state* state_of_mind, struct sail_image** image)
 {
-    SAIL_CHECK_PTR(state);
-    SAIL_CHECK_PTR(image);
-
-    struct hidden_state* state_of_mind = (struct hidden_state*)state;
-
     SAIL_TRY(sail_check_io_valid(state_of_mind->io));
     SAIL_CHECK_PTR(state_of_mind->state);
     SAIL_CHECK_PTR(state_of_mind->codec);
 
+    if (state_of_mind->load_options != NULL && (state_of_mind->load_options->options & SAIL_OPTION_PROBE))
+    {
+        SAIL_LOG_ERROR("Frames cannot be loaded with SAIL_OPTION_PROBE");
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_CONFLICTING_OPERATION);
+    }
+
+    if (state_of_mind->frame_count_known && state_of_mind->frame_index >= state_of_mind->frame_count)
+    {
+        return SAIL_ERROR_NO_MORE_FRAMES;
+    }
+
     struct sail_image* image_local;
-    SAIL_TRY(state_of_mind->codec->v8->load_seek_next_frame(state_of_mind->state, &image_local));
+    const sail_status_t status = codec_load_seek_next_frame(state_of_mind, &image_local);
+
+    if (status == SAIL_ERROR_NO_MORE_FRAMES)
+    {
+        state_of_mind->frame_count       = state_of_mind->frame_index;
+        state_of_mind->frame_count_known = true;
+    }
+
+    SAIL_TRY(status);
+
+    state_of_mind->frame_index++;
 
     SAIL_TRY_OR_CLEANUP(sail_check_image_skeleton_valid(image_local),
                         /* cleanup */ sail_destroy_image(image_local));
 
+    fill_source_image_dimensions(image_local);
+
     if (image_local->pixels != NULL)
     {
         SAIL_LOG_ERROR("Internal error in %s codec: codecs must not allocate pixels", state_of_mind->codec_info->name);
@@ -102,23 +286,638 @@ sail_status_t sail_load_next_frame(void* state, struct sail_image** image)
         SAIL_LOG_AND_RETURN(SAIL_ERROR_CONFLICTING_OPERATION);
     }
 
+    *image = image_local;
+
+    return SAIL_OK;
+}
+
+/*
+ * Codecs without row bands write packed rows with their own bytes per line. Spreads packed rows to a larger stride
+ * in place. Rows are moved from the last to the first one, so no source row is overwritten before it's moved.
+ */
+static void spread_rows(void* pixels, unsigned height, unsigned packed_bytes_per_line, unsigned bytes_per_line)
+{
+    unsigned char* pixels_bytes = pixels;
+
+    for (unsigned row = height; row > 1; row--)
+    {
+        memmove(pixels_bytes + (size_t)(row - 1) * bytes_per_line,
+                pixels_bytes + (size_t)(row - 1) * packed_bytes_per_line, packed_bytes_per_line);
+    }
+}
+
+/*
+ * Returns true if the codec can decode frames straight into scan lines of any stride.
+ * Codecs with row bands write every scan line through sail_load_scan_line(), so they can.
+ */
+static bool codec_loads_at_stride(const struct hidden_state* state_of_mind)
+{
+    return state_of_mind->load_options != NULL
+           && (state_of_mind->codec_info->load_features->features & SAIL_CODEC_FEATURE_ROW_BANDS) != 0;
+}
+
+/*
+ * Decodes the frame into the pixels at the specified stride through a row band that holds the whole frame.
+ * The band never moves, so it's never flushed. Like in sail_load_next_frame_rows(), the image has no pixels
+ * while the codec works, so codecs can only reach them through sail_load_scan_line().
+ */
+static sail_status_t load_frame_at_stride(struct hidden_state* state_of_mind,
+                                          struct sail_image* image,
+                                          void* pixels,
+                                          unsigned bytes_per_line)
+{
+    struct sail_row_band row_band = {
+        .callback         = NULL,
+        .save_callback    = NULL,
+        .user_data        = NULL,
+        .pixels           = pixels,
+        .bytes_per_line   = bytes_per_line,
+        .rows             = image->height,
+        .pixels_alignment = 0,
+        .first_row        = 0,
+        .rows_count       = image->height,
+        .rows_flushed     = 0,
+        .bypass           = false,
+    };
+
+    image->pixels = NULL;
+    sail_set_load_options_row_band(state_of_mind->load_options, &row_band);
+
+    const sail_status_t status = codec_load_frame(state_of_mind, image);
+
+    sail_set_load_options_row_band(state_of_mind->load_options, NULL);
+    image->pixels = pixels;
+
+    SAIL_TRY(status);
+
+    image->bytes_per_line = bytes_per_line;
+
+    return SAIL_OK;
+}
+
+sail_status_t sail_load_next_frame(void* state, struct sail_image** image)
+{
+    SAIL_CHECK_PTR(state);
+    SAIL_CHECK_PTR(image);
+
+    struct hidden_state* state_of_mind = (struct hidden_state*)state;
+
+    struct sail_image* image_local;
+    SAIL_TRY(load_next_frame_skeleton(state_of_mind, &image_local));
+
+    /* Codecs without native cropping decode whole frames, and SAIL crops them in place. */
+    unsigned crop_x, crop_y, crop_width, crop_height;
+    bool crop;
+
+    SAIL_TRY_OR_CLEANUP(generic_crop_rectangle(&state_of_mind->generic_crop, image_local->width, image_local->height,
+                                               &crop_x, &crop_y, &crop_width, &crop_height, &crop),
+                        /* cleanup */ sail_destroy_image(image_local));
+
+    const unsigned pixels_alignment =
+        (state_of_mind->load_options != NULL && state_of_mind->load_options->pixels_alignment != 0)
+            ? state_of_mind->load_options->pixels_alignment
+            : sail_default_pixels_alignment();
+    const unsigned frame_bytes_per_line = image_local->bytes_per_line;
+    const unsigned codec_bytes_per_line =
+        crop ? sail_bytes_per_line(crop_width, image_local->pixel_format) : frame_bytes_per_line;
+    const unsigned bytes_per_line = sail_align_bytes_per_line(codec_bytes_per_line, pixels_alignment);
+
+    if (bytes_per_line == 0)
+    {
+        SAIL_LOG_ERROR("Bytes per line %u aligned to %u bytes doesn't fit into unsigned int", codec_bytes_per_line,
+                       pixels_alignment);
+        sail_destroy_image(image_local);
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_INVALID_BYTES_PER_LINE);
+    }
+
     /* Validate and allocate pixels. */
     size_t pixels_size;
 
-    SAIL_TRY_OR_CLEANUP(sail_pixels_buffer_size(image_local->height, image_local->bytes_per_line, &pixels_size),
+    SAIL_TRY_OR_CLEANUP(sail_pixels_buffer_size(crop_height, bytes_per_line, &pixels_size),
                         /* cleanup */ sail_destroy_image(image_local));
 
-    SAIL_TRY_OR_CLEANUP(sail_malloc(pixels_size, &image_local->pixels),
+    if (crop)
+    {
+        size_t frame_pixels_size;
+
+        SAIL_TRY_OR_CLEANUP(sail_pixels_buffer_size(image_local->height, frame_bytes_per_line, &frame_pixels_size),
+                            /* cleanup */ sail_destroy_image(image_local));
+
+        if (frame_pixels_size > pixels_size)
+        {
+            pixels_size = frame_pixels_size;
+        }
+    }
+
+    if (pixels_alignment != 0)
+    {
+        SAIL_TRY_OR_CLEANUP(sail_malloc_aligned(pixels_alignment, pixels_size, &image_local->pixels),
+                            /* cleanup */ sail_destroy_image(image_local));
+
+        image_local->pixels_alignment = pixels_alignment;
+    }
+    else
+    {
+        SAIL_TRY_OR_CLEANUP(sail_malloc(pixels_size, &image_local->pixels),
+                            /* cleanup */ sail_destroy_image(image_local));
+    }
+
+    state_of_mind->stats.bytes_allocated += pixels_size;
+
+    if (!crop && bytes_per_line > codec_bytes_per_line && codec_loads_at_stride(state_of_mind))
+    {
+        SAIL_TRY_OR_CLEANUP(load_frame_at_stride(state_of_mind, image_local, image_local->pixels, bytes_per_line),
+                            /* cleanup */ sail_destroy_image(image_local));
+
+        *image = image_local;
+
+        return SAIL_OK;
+    }
+
+    SAIL_TRY_OR_CLEANUP(codec_load_frame(state_of_mind, image_local),
                         /* cleanup */ sail_destroy_image(image_local));
 
-    SAIL_TRY_OR_CLEANUP(state_of_mind->codec->v8->load_frame(state_of_mind->state, image_local),
+    const uint64_t conversion_start = sail_now_us();
+
+    if (crop)
+    {
+        SAIL_TRY_OR_CLEANUP(sail_copy_pixels_rectangle(image_local->pixels, frame_bytes_per_line,
+                                                       image_local->pixel_format, crop_x, crop_y, crop_width,
+                                                       crop_height, image_local->pixels, codec_bytes_per_line),
+                            /* cleanup */ sail_destroy_image(image_local));
+
+        image_local->width          = crop_width;
+        image_local->height         = crop_height;
+        image_local->bytes_per_line = codec_bytes_per_line;
+    }
+
+    if (bytes_per_line > codec_bytes_per_line)
+    {
+        spread_rows(image_local->pixels, image_local->height, codec_bytes_per_line, bytes_per_line);
+        image_local->bytes_per_line = bytes_per_line;
+    }
+
+    state_of_mind->stats.conversion_time += sail_now_us() - conversion_start;
+
+    *image = image_local;
+
+    return SAIL_OK;
+}
+
+/* Destroys the image without freeing the pixels owned by the caller. */
+static void destroy_image_with_caller_pixels(struct sail_image* image)
+{
+    image->pixels = NULL;
+    sail_destroy_image(image);
+}
+
+/*
+ * Decodes a whole frame into a temporary buffer and copies the crop rectangle into the caller buffer.
+ */
+static sail_status_t load_frame_cropped_into(struct hidden_state* state_of_mind,
+                                             struct sail_image* image,
+                                             unsigned crop_x,
+                                             unsigned crop_y,
+                                             unsigned crop_width,
+                                             unsigned crop_height,
+                                             void* pixels,
+                                             unsigned bytes_per_line)
+{
+    size_t frame_pixels_size;
+    SAIL_TRY(sail_pixels_buffer_size(image->height, image->bytes_per_line, &frame_pixels_size));
+
+    SAIL_TRY(sail_malloc(frame_pixels_size, &image->pixels));
+
+    state_of_mind->stats.bytes_allocated += frame_pixels_size;
+
+    SAIL_TRY_OR_CLEANUP(codec_load_frame(state_of_mind, image),
+                        /* cleanup */ sail_free(image->pixels), image->pixels = NULL);
+
+    const uint64_t conversion_start = sail_now_us();
+
+    SAIL_TRY_OR_CLEANUP(sail_copy_pixels_rectangle(image->pixels, image->bytes_per_line, image->pixel_format, crop_x,
+                                                   crop_y, crop_width, crop_height, pixels, bytes_per_line),
+                        /* cleanup */ sail_free(image->pixels), image->pixels = NULL);
+
+    state_of_mind->stats.conversion_time += sail_now_us() - conversion_start;
+
+    sail_free(image->pixels);
+
+    image->pixels         = pixels;
+    image->width          = crop_width;
+    image->height         = crop_height;
+    image->bytes_per_line = bytes_per_line;
+
+    return SAIL_OK;
+}
+
+sail_status_t sail_load_next_frame_into(
+    void* state, void* pixels, size_t pixels_size, unsigned bytes_per_line, struct sail_image** image)
+{
+    SAIL_CHECK_PTR(state);
+    SAIL_CHECK_PTR(pixels);
+    SAIL_CHECK_PTR(image);
+
+    struct hidden_state* state_of_mind = (struct hidden_state*)state;
+
+    struct sail_image* image_local;
+    SAIL_TRY(load_next_frame_skeleton(state_of_mind, &image_local));
+
+    unsigned crop_x, crop_y, crop_width, crop_height;
+    bool crop;
+
+    SAIL_TRY_OR_CLEANUP(generic_crop_rectangle(&state_of_mind->generic_crop, image_local->width, image_local->height,
+                                               &crop_x, &crop_y, &crop_width, &crop_height, &crop),
                         /* cleanup */ sail_destroy_image(image_local));
 
+    /* Validate the caller buffer. */
+    const unsigned codec_bytes_per_line =
+        crop ? sail_bytes_per_line(crop_width, image_local->pixel_format) : image_local->bytes_per_line;
+
+    if (bytes_per_line == 0)
+    {
+        bytes_per_line = codec_bytes_per_line;
+    }
+    else if (bytes_per_line < codec_bytes_per_line)
+    {
+        SAIL_LOG_ERROR("The requested bytes per line %u is less than the frame bytes per line %u", bytes_per_line,
+                       codec_bytes_per_line);
+        sail_destroy_image(image_local);
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_INVALID_BYTES_PER_LINE);
+    }
+
+    size_t required_size;
+
+    SAIL_TRY_OR_CLEANUP(sail_pixels_buffer_size(crop_height, bytes_per_line, &required_size),
+                        /* cleanup */ sail_destroy_image(image_local));
+
+    if (pixels_size < required_size)
+    {
+        SAIL_LOG_ERROR("The pixel buffer of %zu bytes is too small for a %ux%u frame, %zu bytes required", pixels_size,
+                       crop_width, crop_height, required_size);
+        sail_destroy_image(image_local);
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_INVALID_ARGUMENT);
+    }
+
+    if (crop)
+    {
+        SAIL_TRY_OR_CLEANUP(load_frame_cropped_into(state_of_mind, image_local, crop_x, crop_y, crop_width,
+                                                    crop_height, pixels, bytes_per_line),
+                            /* cleanup */ sail_destroy_image(image_local));
+
+        *image = image_local;
+
+        return SAIL_OK;
+    }
+
+    if (bytes_per_line > codec_bytes_per_line && codec_loads_at_stride(state_of_mind))
+    {
+        SAIL_TRY_OR_CLEANUP(load_frame_at_stride(state_of_mind, image_local, pixels, bytes_per_line),
+                            /* cleanup */ destroy_image_with_caller_pixels(image_local));
+
+        *image = image_local;
+
+        return SAIL_OK;
+    }
+
+    /* Decode packed rows into the caller buffer and spread them to the requested stride afterwards. */
+    image_local->pixels = pixels;
+
+    SAIL_TRY_OR_CLEANUP(codec_load_frame(state_of_mind, image_local),
+                        /* cleanup */ destroy_image_with_caller_pixels(image_local));
+
+    if (bytes_per_line > codec_bytes_per_line)
+    {
+        const uint64_t conversion_start = sail_now_us();
+
+        spread_rows(pixels, image_local->height, codec_bytes_per_line, bytes_per_line);
+        image_local->bytes_per_line = bytes_per_line;
+
+        state_of_mind->stats.conversion_time += sail_now_us() - conversion_start;
+    }
+
     *image = image_local;
 
     return SAIL_OK;
 }
 
+/*
+ * Passes the scan lines of the loaded frame to the callback in bands.
+ */
+static sail_status_t split_into_row_bands(const struct sail_image* image,
+                                          unsigned rows_per_band,
+                                          sail_load_rows_func_t callback,
+                                          void* user_data)
+{
+    /* Shallow view of the frame. It doesn't own anything, so it's never destroyed. */
+    struct sail_image band = *image;
+
+    for (unsigned first_row = 0; first_row < image->height; first_row += band.height)
+    {
+        const unsigned rows_left = image->height - first_row;
+
+        band.pixels = sail_scan_line(image, first_row);
+        band.height = (rows_left < rows_per_band) ? rows_left : rows_per_band;
+
+        SAIL_TRY(callback(user_data, &band, first_row, image->height));
+    }
+
+    return SAIL_OK;
+}
+
+sail_status_t sail_load_next_frame_rows(void* state,
+                                        unsigned rows_per_band,
+                                        sail_load_rows_func_t callback,
+                                        void* user_data)
+{
+    SAIL_CHECK_PTR(state);
+    SAIL_CHECK_PTR(callback);
+
+    if (rows_per_band == 0)
+    {
+        SAIL_LOG_ERROR("Rows per band must be greater than 0");
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_INVALID_ARGUMENT);
+    }
+
+    struct hidden_state* state_of_mind = (struct hidden_state*)state;
+
+    SAIL_CHECK_PTR(state_of_mind->codec_info);
+    SAIL_CHECK_PTR(state_of_mind->load_options);
+
+    /* Codecs without row bands and the generic crop work on whole frames. */
+    if ((state_of_mind->codec_info->load_features->features & SAIL_CODEC_FEATURE_ROW_BANDS) == 0
+        || (state_of_mind->generic_crop.width != 0 && state_of_mind->generic_crop.height != 0))
+    {
+        struct sail_image* image;
+        SAIL_TRY(sail_load_next_frame(state, &image));
+
+        SAIL_TRY_OR_CLEANUP(split_into_row_bands(image, rows_per_band, callback, user_data),
+                            /* cleanup */ sail_destroy_image(image));
+
+        sail_destroy_image(image);
+
+        return SAIL_OK;
+    }
+
+    struct sail_image* image_local;
+    SAIL_TRY(load_next_frame_skeleton(state_of_mind, &image_local));
+
+    const unsigned pixels_alignment = (state_of_mind->load_options->pixels_alignment != 0)
+                                          ? state_of_mind->load_options->pixels_alignment
+                                          : sail_default_pixels_alignment();
+    const unsigned bytes_per_line   = sail_align_bytes_per_line(image_local->bytes_per_line, pixels_alignment);
+
+    if (bytes_per_line == 0)
+    {
+        SAIL_LOG_ERROR("Bytes per line %u aligned to %u bytes doesn't fit into unsigned int",
+                       image_local->bytes_per_line, pixels_alignment);
+        sail_destroy_image(image_local);
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_INVALID_BYTES_PER_LINE);
+    }
+
+    /* Codecs decode scan lines into the band buffer, so the image has no pixels. */
+    struct sail_row_band* row_band;
+    SAIL_TRY_OR_CLEANUP(sail_alloc_row_band((rows_per_band < image_local->height) ? rows_per_band : image_local->height,
+                                            bytes_per_line, pixels_alignment, callback, user_data, &row_band),
+                        /* cleanup */ sail_destroy_image(image_local));
+
+    state_of_mind->stats.bytes_allocated += (uint64_t)row_band->rows * row_band->bytes_per_line;
+    sail_set_load_options_row_band(state_of_mind->load_options, row_band);
+
+    SAIL_TRY_OR_CLEANUP(codec_load_frame(state_of_mind, image_local),
+                        /* cleanup */ sail_set_load_options_row_band(state_of_mind->load_options, NULL),
+                        sail_destroy_row_band(row_band), sail_destroy_image(image_local));
+
+    sail_set_load_options_row_band(state_of_mind->load_options, NULL);
+
+    SAIL_TRY_OR_CLEANUP(sail_flush_row_band(row_band, image_local),
+                        /* cleanup */ sail_destroy_row_band(row_band), sail_destroy_image(image_local));
+
+    if (row_band->rows_flushed < image_local->height)
+    {
+        SAIL_LOG_ERROR("Internal error in %s codec: %u of %u scan lines were loaded", state_of_mind->codec_info->name,
+                       row_band->rows_flushed, image_local->height);
+        sail_destroy_row_band(row_band);
+        sail_destroy_image(image_local);
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_CONFLICTING_OPERATION);
+    }
+
+    sail_destroy_row_band(row_band);
+    sail_destroy_image(image_local);
+
+    return SAIL_OK;
+}
+
+/*
+ * Fills the scan lines of the frame to save from the callback in bands.
+ */
+static sail_status_t fill_from_row_bands(struct sail_image* image,
+                                         unsigned rows_per_band,
+                                         sail_save_rows_func_t callback,
+                                         void* user_data)
+{
+    /* Shallow view of the frame. It doesn't own anything, so it's never destroyed. */
+    struct sail_image band = *image;
+
+    for (unsigned first_row = 0; first_row < image->height; first_row += band.height)
+    {
+        const unsigned rows_left = image->height - first_row;
+
+        band.pixels = sail_scan_line(image, first_row);
+        band.height = (rows_left < rows_per_band) ? rows_left : rows_per_band;
+
+        SAIL_TRY(callback(user_data, &band, first_row, image->height));
+    }
+
+    return SAIL_OK;
+}
+
+/*
+ * Finishes the codec and starts loading from the initial I/O offset again.
+ */
+static sail_status_t restart_loading(struct hidden_state* state_of_mind)
+{
+    SAIL_TRY(codec_load_finish(state_of_mind));
+
+    SAIL_TRY(state_of_mind->io->seek(state_of_mind->io->stream, (long)state_of_mind->start_offset, SEEK_SET));
+
+    SAIL_TRY_OR_CLEANUP(codec_load_init(state_of_mind),
+                        /* cleanup */ state_of_mind->codec->v8->load_finish(&state_of_mind->state));
+
+    state_of_mind->frame_index    = 0;
+    state_of_mind->frames_skipped = false;
+
+    if (state_of_mind->visited_frames != NULL)
+    {
+        state_of_mind->visited_frames->resume = false;
+    }
+
+    return SAIL_OK;
+}
+
+/*
+ * Asks the codec to resume loading at the specified recorded frame.
+ */
+static void resume_at_frame(struct hidden_state* state_of_mind, unsigned frame)
+{
+    struct sail_frame_index* frame_index = state_of_mind->visited_frames;
+
+    frame_index->resume           = true;
+    state_of_mind->frame_index    = frame;
+    state_of_mind->frames_skipped = !frame_index->entries[frame].keyframe;
+}
+
+/*
+ * Seeks over the next frame without decoding it. The codec records it in the frame index.
+ */
+static sail_status_t skip_frame_without_decoding(struct hidden_state* state_of_mind)
+{
+    struct sail_image* image;
+    SAIL_TRY(load_next_frame_skeleton(state_of_mind, &image));
+
+    sail_destroy_image(image);
+
+    state_of_mind->frames_skipped = true;
+
+    return SAIL_OK;
+}
+
+/*
+ * Records the frames up to the specified one in the frame index, and resumes loading
+ * at the nearest keyframe before it. The frames from the keyframe to the specified one
+ * still need decoding.
+ */
+static sail_status_t seek_to_keyframe(struct hidden_state* state_of_mind, unsigned frame)
+{
+    const struct sail_frame_index* frame_index = state_of_mind->visited_frames;
+
+    /* The end of the image is known, so the codec is not asked for more frames. */
+    if (state_of_mind->frame_count_known && frame == state_of_mind->frame_count)
+    {
+        state_of_mind->frame_index    = frame;
+        state_of_mind->frames_skipped = true;
+        return SAIL_OK;
+    }
+
+    while (frame_index->entries_count <= frame)
+    {
+        /* Continue scanning from the last recorded frame. */
+        if (state_of_mind->frame_index < frame_index->entries_count)
+        {
+            resume_at_frame(state_of_mind, frame_index->entries_count - 1);
+        }
+
+        const sail_status_t status = skip_frame_without_decoding(state_of_mind);
+
+        /* Seeking right past the last frame. */
+        if (status == SAIL_ERROR_NO_MORE_FRAMES && frame == state_of_mind->frame_count)
+        {
+            return SAIL_OK;
+        }
+
+        SAIL_TRY(status);
+    }
+
+    unsigned keyframe;
+
+    if (sail_find_keyframe(frame_index, frame, &keyframe))
+    {
+        /* Decoding forward from the current frame is valid just when no frames were skipped. */
+        if (state_of_mind->frames_skipped || state_of_mind->frame_index < keyframe
+            || state_of_mind->frame_index > frame)
+        {
+            resume_at_frame(state_of_mind, keyframe);
+        }
+    }
+    else if (state_of_mind->frames_skipped || state_of_mind->frame_index > frame)
+    {
+        SAIL_TRY(restart_loading(state_of_mind));
+    }
+
+    return SAIL_OK;
+}
+
+/*
+ * Seeks over the next frame. Decodes it into the scratch buffer unless the codec can skip frames.
+ */
+static sail_status_t skip_frame(struct hidden_state* state_of_mind, void** scratch, size_t* scratch_size)
+{
+    struct sail_image* image;
+    SAIL_TRY(load_next_frame_skeleton(state_of_mind, &image));
+
+    if (state_of_mind->codec_info->load_features->features & SAIL_CODEC_FEATURE_SEEK)
+    {
+        sail_destroy_image(image);
+        return SAIL_OK;
+    }
+
+    size_t pixels_size;
+    SAIL_TRY_OR_CLEANUP(sail_pixels_buffer_size(image->height, image->bytes_per_line, &pixels_size),
+                        /* cleanup */ sail_destroy_image(image));
+
+    if (pixels_size > *scratch_size)
+    {
+        SAIL_TRY_OR_CLEANUP(sail_realloc(pixels_size, scratch),
+                            /* cleanup */ sail_destroy_image(image));
+        *scratch_size = pixels_size;
+
+        state_of_mind->stats.bytes_allocated += pixels_size;
+    }
+
+    image->pixels = *scratch;
+
+    SAIL_TRY_OR_CLEANUP(codec_load_frame(state_of_mind, image),
+                        /* cleanup */ destroy_image_with_caller_pixels(image));
+
+    destroy_image_with_caller_pixels(image);
+
+    return SAIL_OK;
+}
+
+sail_status_t sail_seek_to_frame(void* state, unsigned frame)
+{
+    SAIL_CHECK_PTR(state);
+
+    struct hidden_state* state_of_mind = (struct hidden_state*)state;
+
+    SAIL_TRY(sail_check_io_valid(state_of_mind->io));
+    SAIL_CHECK_PTR(state_of_mind->state);
+    SAIL_CHECK_PTR(state_of_mind->codec);
+
+    if (state_of_mind->frame_count_known && frame > state_of_mind->frame_count)
+    {
+        return SAIL_ERROR_NO_MORE_FRAMES;
+    }
+
+    if (state_of_mind->visited_frames != NULL)
+    {
+        SAIL_TRY(seek_to_keyframe(state_of_mind, frame));
+    }
+    else if (frame < state_of_mind->frame_index)
+    {
+        if (!(state_of_mind->io->features & SAIL_IO_FEATURE_SEEKABLE))
+        {
+            SAIL_LOG_ERROR("Seeking backwards requires a seekable I/O source");
+            SAIL_LOG_AND_RETURN(SAIL_ERROR_NOT_IMPLEMENTED);
+        }
+
+        SAIL_TRY(restart_loading(state_of_mind));
+    }
+
+    void* scratch       = NULL;
+    size_t scratch_size = 0;
+
+    while (state_of_mind->frame_index < frame)
+    {
+        SAIL_TRY_OR_CLEANUP(skip_frame(state_of_mind, &scratch, &scratch_size),
+                            /* cleanup */ sail_free(scratch));
+    }
+
+    sail_free(scratch);
+
+    return SAIL_OK;
+}
+
 sail_status_t sail_stop_loading(void* state)
 {
     /* Not an error. */
@@ -129,16 +928,17 @@ sail_status_t sail_stop_loading(void* state)
 
     struct hidden_state* state_of_mind = (struct hidden_state*)state;
 
-    /* Not an error. */
-    if (state_of_mind->codec == NULL)
+    /* Not an error. The codec state is NULL when restarting loading failed. */
+    if (state_of_mind->codec == NULL || state_of_mind->state == NULL)
     {
         destroy_hidden_state(state_of_mind);
         return SAIL_OK;
     }
 
-    SAIL_TRY_OR_CLEANUP(state_of_mind->codec->v8->load_finish(&state_of_mind->state),
-                        /* cleanup */ destroy_hidden_state(state_of_mind));
+    SAIL_TRY_OR_CLEANUP(codec_load_finish(state_of_mind),
+                        /* cleanup */ record_operation_stats(state_of_mind), destroy_hidden_state(state_of_mind));
 
+    record_operation_stats(state_of_mind);
     destroy_hidden_state(state_of_mind);
 
     return SAIL_OK;
@@ -176,8 +976,88 @@ sail_status_t sail_write_next_frame(void* state, const struct sail_image* image)
     /* Check if we actually able to save the requested pixel format. */
     SAIL_TRY(allowed_write_output_pixel_format(state_of_mind->codec_info->save_features, image->pixel_format));
 
-    SAIL_TRY(state_of_mind->codec->v8->save_seek_next_frame(state_of_mind->state, image));
-    SAIL_TRY(state_of_mind->codec->v8->save_frame(state_of_mind->state, image));
+    SAIL_TRY(codec_save_seek_next_frame(state_of_mind, image));
+    SAIL_TRY(codec_save_frame(state_of_mind, image));
+
+    return SAIL_OK;
+}
+
+sail_status_t sail_write_next_frame_rows(void* state,
+                                         const struct sail_image* image,
+                                         unsigned rows_per_band,
+                                         sail_save_rows_func_t callback,
+                                         void* user_data)
+{
+    SAIL_CHECK_PTR(state);
+    SAIL_CHECK_PTR(callback);
+    SAIL_TRY(sail_check_image_skeleton_valid(image));
+
+    if (rows_per_band == 0)
+    {
+        SAIL_LOG_ERROR("Rows per band must be greater than 0");
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_INVALID_ARGUMENT);
+    }
+
+    struct hidden_state* state_of_mind = (struct hidden_state*)state;
+
+    SAIL_TRY(sail_check_io_valid(state_of_mind->io));
+    SAIL_CHECK_PTR(state_of_mind->state);
+    SAIL_CHECK_PTR(state_of_mind->codec_info);
+    SAIL_CHECK_PTR(state_of_mind->codec);
+    SAIL_CHECK_PTR(state_of_mind->save_options);
+
+    /* Check if we actually able to save the requested pixel format. */
+    SAIL_TRY(allowed_write_output_pixel_format(state_of_mind->codec_info->save_features, image->pixel_format));
+
+    /* Codecs without row bands need the whole frame. */
+    if ((state_of_mind->codec_info->save_features->features & SAIL_CODEC_FEATURE_ROW_BANDS) == 0)
+    {
+        /* Shallow copy of the frame properties with a temporary pixel buffer. */
+        struct sail_image frame = *image;
+
+        size_t pixels_size;
+        SAIL_TRY(sail_pixels_buffer_size(frame.height, frame.bytes_per_line, &pixels_size));
+        SAIL_TRY(sail_malloc(pixels_size, &frame.pixels));
+
+        state_of_mind->stats.bytes_allocated += pixels_size;
+
+        SAIL_TRY_OR_CLEANUP(fill_from_row_bands(&frame, rows_per_band, callback, user_data),
+                            /* cleanup */ sail_free(frame.pixels));
+        SAIL_TRY_OR_CLEANUP(sail_write_next_frame(state, &frame),
+                            /* cleanup */ sail_free(frame.pixels));
+
+        sail_free(frame.pixels);
+
+        return SAIL_OK;
+    }
+
+    /* Codecs encode scan lines from the band buffer, so the image pixels are never accessed. */
+    struct sail_row_band* row_band;
+    SAIL_TRY(sail_alloc_save_row_band((rows_per_band < image->height) ? rows_per_band : image->height,
+                                      image->bytes_per_line, 0, callback, user_data, &row_band));
+
+    state_of_mind->stats.bytes_allocated += (uint64_t)row_band->rows * row_band->bytes_per_line;
+
+    SAIL_TRY_OR_CLEANUP(codec_save_seek_next_frame(state_of_mind, image),
+                        /* cleanup */ sail_destroy_row_band(row_band));
+
+    sail_set_save_options_row_band(state_of_mind->save_options, row_band);
+
+    SAIL_TRY_OR_CLEANUP(codec_save_frame(state_of_mind, image),
+                        /* cleanup */ sail_set_save_options_row_band(state_of_mind->save_options, NULL),
+                        sail_destroy_row_band(row_band));
+
+    sail_set_save_options_row_band(state_of_mind->save_options, NULL);
+
+    if (row_band->rows_flushed < image->height)
+    {
+        SAIL_LOG_ERROR("Internal error in %s codec: %u of %u scan lines were saved", state_of_mind->codec_info->name,
+                       row_band->rows_flushed, image->height);
+        sail_destroy_row_band(row_band);
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_CONFLICTING_OPERATION);
+    }
+
+    sail_destroy_row_band(row_band);
 
     return SAIL_OK;
 }
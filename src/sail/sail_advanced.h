@@ -28,6 +28,7 @@
 #include <stddef.h> /* size_t */
 
 #include <sail-common/export.h>
+#include <sail-common/row_band.h>
 #include <sail-common/status.h>
 
 #ifdef __cplusplus
@@ -83,6 +84,80 @@ SAIL_EXPORT sail_status_t sail_probe_memory(const void* buffer,
                                             struct sail_image** image,
                                             const struct sail_codec_info** codec_info);
 
+/* Default maximum number of bytes sail_probe_many() reads from every file before falling back to full I/O. */
+#define SAIL_PROBE_MANY_DEFAULT_PREFIX_SIZE (64 * 1024)
+
+/* Default number of threads sail_probe_many() probes files in. */
+#define SAIL_PROBE_MANY_DEFAULT_THREADS 8
+
+/*
+ * Options for sail_probe_many().
+ */
+struct sail_probe_many_options
+{
+    /*
+     * Maximum number of threads to probe files in, including the calling thread.
+     * 0 means SAIL_PROBE_MANY_DEFAULT_THREADS. Values greater than sail_max_threads() are truncated.
+     */
+    unsigned threads;
+
+    /*
+     * Maximum number of bytes to read from every file in one request. 0 means
+     * SAIL_PROBE_MANY_DEFAULT_PREFIX_SIZE.
+     */
+    size_t prefix_size;
+};
+
+/*
+ * Result of probing a single file with sail_probe_many().
+ */
+struct sail_probe_result
+{
+    /* SAIL_OK if the file was probed successfully. */
+    sail_status_t status;
+
+    /*
+     * Image properties without pixels. Source image properties are available in image->source_image.
+     * NULL on error.
+     */
+    struct sail_image* image;
+
+    /*
+     * Borrowed pointer to internal context data. Do not free or modify it. Remains valid
+     * until sail_finish(). NULL on error.
+     */
+    const struct sail_codec_info* codec_info;
+};
+
+/*
+ * Probes the specified image files concurrently and returns their properties without pixels.
+ * Pass NULL options to use the defaults. The files are probed in the global thread pool shared
+ * with the other parallel operations, see sail_parallel_for().
+ *
+ * Every file is opened once and only its prefix of options->prefix_size bytes is read. Codecs are
+ * selected by file extension first, and by magic number in the prefix second. Headers are parsed
+ * from the prefix in memory. If the headers don't fit into the prefix, the file is probed again
+ * from the already opened file without the size limit.
+ *
+ * Allocates an array of 'count' results and assigns it to the 'results' argument. Every result
+ * has its own status, so failing to probe one file doesn't fail the others. The results are
+ * in the same order as the paths. Destroy them with sail_destroy_probe_results().
+ *
+ * Typical usage: This is a standalone function that could be called at any time.
+ *
+ * Returns SAIL_OK on success even if some files failed to probe. Check the results statuses.
+ */
+SAIL_EXPORT sail_status_t sail_probe_many(const char* const* paths,
+                                          size_t count,
+                                          struct sail_probe_result** results,
+                                          const struct sail_probe_many_options* options);
+
+/*
+ * Destroys the specified results returned by sail_probe_many() and all their internal memory buffers.
+ * Does nothing if results is NULL.
+ */
+SAIL_EXPORT void sail_destroy_probe_results(struct sail_probe_result* results, size_t count);
+
 /*
  * Starts loading the specified image file. Pass codec info if you would like to start loading
  * with a specific codec. If not, just pass NULL, and SAIL will detect it automatically.
@@ -141,6 +216,79 @@ SAIL_EXPORT sail_status_t sail_start_loading_from_memory(const void* buffer,
  */
 SAIL_EXPORT sail_status_t sail_load_next_frame(void* state, struct sail_image** image);
 
+/*
+ * Continues loading started by sail_start_loading_from_file() and brothers. Decodes the next frame
+ * into the specified caller-owned pixel buffer instead of allocating a new one.
+ *
+ * Pass 0 as bytes per line to use the frame bytes per line. A larger value produces padded scan lines,
+ * for example to satisfy alignment requirements of the target memory. The buffer must hold at least
+ * height * bytes_per_line bytes. The required size is known only after the frame header is read, so
+ * use sail_probe_*() or a generously sized buffer when the frame size is not known in advance.
+ *
+ * The assigned image points to the caller buffer. Set image->pixels to NULL before calling
+ * sail_destroy_image() on it. The buffer must remain valid as long as the image uses it.
+ *
+ * Returns SAIL_OK on success.
+ * Returns SAIL_ERROR_NO_MORE_FRAMES when no more frames are available.
+ * Returns SAIL_ERROR_INVALID_BYTES_PER_LINE when bytes per line is less than the frame bytes per line.
+ * Returns SAIL_ERROR_INVALID_ARGUMENT when the buffer is too small for the frame.
+ *
+ * The frame is consumed on error as well. Always call sail_stop_loading() when you are done.
+ */
+SAIL_EXPORT sail_status_t sail_load_next_frame_into(
+    void* state, void* pixels, size_t pixels_size, unsigned bytes_per_line, struct sail_image** image);
+
+/*
+ * Continues loading started by sail_start_loading_from_file() and brothers. Decodes the next frame
+ * in bands of up to rows_per_band scan lines and passes every band to the callback instead of
+ * returning the whole frame. The band buffer is reused, so the memory used for pixels is proportional
+ * to rows_per_band rather than to the frame height.
+ *
+ * Codecs with SAIL_CODEC_FEATURE_ROW_BANDS decode frames row by row into the band buffer. Bands are
+ * passed in the order the codec decodes them, which is bottom to top for formats like bottom-up BMP.
+ * Some frames, like interlaced PNG frames, are still decoded whole. Other codecs and the crop rectangle
+ * from the load options for codecs without SAIL_CODEC_FEATURE_CROP need the whole frame too. In these
+ * cases, the frame is loaded with sail_load_next_frame() and passed to the callback in bands from top
+ * to bottom.
+ *
+ * Returns SAIL_OK on success.
+ * Returns SAIL_ERROR_NO_MORE_FRAMES when no more frames are available.
+ * Returns the callback status when the callback fails.
+ *
+ * The frame is consumed on error as well. Always call sail_stop_loading() when you are done.
+ */
+SAIL_EXPORT sail_status_t sail_load_next_frame_rows(void* state,
+                                                    unsigned rows_per_band,
+                                                    sail_load_rows_func_t callback,
+                                                    void* user_data);
+
+/*
+ * Positions loading started by sail_start_loading_from_file() and brothers at the specified zero-based
+ * frame, so the next call to sail_load_next_frame() returns it.
+ *
+ * Codecs with SAIL_CODEC_FEATURE_FRAME_INDEX record the position of every visited frame and whether
+ * it's a keyframe, i.e. decoded without the previous frames, in a frame index of the loading state. When
+ * the I/O source has SAIL_IO_FEATURE_SEEKABLE, seeking to a recorded frame resumes loading at the nearest
+ * keyframe at or before it, and decodes just the frames from the keyframe to the target into a temporary
+ * buffer. Frames not recorded yet are scanned without decoding them. For example, seeking to any page
+ * of a multi-page TIFF reads just its directory once the page is recorded.
+ *
+ * Other codecs walk every frame between the current and the target one. Codecs with SAIL_CODEC_FEATURE_SEEK
+ * skip intermediate frames without decoding them. The rest decode intermediate frames into a temporary
+ * buffer and discard them. Seeking backwards restarts loading from the beginning, and the I/O source must
+ * have SAIL_IO_FEATURE_SEEKABLE.
+ *
+ * Seeking right past the last frame succeeds, and sail_load_next_frame() returns SAIL_ERROR_NO_MORE_FRAMES.
+ *
+ * Returns SAIL_OK on success.
+ * Returns SAIL_ERROR_NO_MORE_FRAMES when the image has less frames than the seek requires.
+ * Returns SAIL_ERROR_NOT_IMPLEMENTED when seeking backwards in a non-seekable I/O source.
+ *
+ * Always call sail_stop_loading() when you are done, including after any error. The result of calling
+ * sail_load_next_frame() after an error other than SAIL_ERROR_NO_MORE_FRAMES is unspecified.
+ */
+SAIL_EXPORT sail_status_t sail_seek_to_frame(void* state, unsigned frame);
+
 /*
  * Stops loading started by sail_start_loading_from_file() and brothers.
  * Does nothing if state is NULL.
@@ -214,6 +362,33 @@ SAIL_EXPORT sail_status_t sail_start_saving_into_memory(void* buffer,
  */
 SAIL_EXPORT sail_status_t sail_write_next_frame(void* state, const struct sail_image* image);
 
+/*
+ * Continues saving started by sail_start_saving_into_file() and brothers. Writes a frame with
+ * the properties of the specified image, and pulls its pixels from the callback in bands of up to
+ * rows_per_band scan lines instead of taking them from image->pixels, which is ignored. The band
+ * buffer is reused, so the memory used for pixels is proportional to rows_per_band rather than
+ * to the frame height.
+ *
+ * Codecs with SAIL_CODEC_FEATURE_ROW_BANDS in their save features encode frames row by row from
+ * the band buffer. Bands are requested in the order the codec encodes them, which is bottom to top
+ * for formats like BMP. Some frames, like interlaced PNG frames, still need the whole frame. Other
+ * codecs need it too. In these cases, the whole frame is filled from the callback in bands from top
+ * to bottom and then saved with sail_write_next_frame().
+ *
+ * If the selected image format doesn't support the image pixel format, an error is returned.
+ *
+ * On error always call sail_stop_saving(). The result of calling sail_write_next_frame() again
+ * after an error is unspecified.
+ *
+ * Returns SAIL_OK on success.
+ * Returns the callback status when the callback fails.
+ */
+SAIL_EXPORT sail_status_t sail_write_next_frame_rows(void* state,
+                                                     const struct sail_image* image,
+                                                     unsigned rows_per_band,
+                                                     sail_save_rows_func_t callback,
+                                                     void* user_data);
+
 /*
  * Stops saving started by sail_start_saving_into_file() and brothers. Closes the underlying I/O target.
  * Does nothing if state is NULL.
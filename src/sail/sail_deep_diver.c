@@ -63,6 +63,12 @@ sail_status_t sail_probe_io_with_options(struct sail_io* io,
         SAIL_TRY(sail_copy_load_options(load_options, &load_options_local));
     }
 
+    /* Parse headers only. */
+    load_options_local->options |= SAIL_OPTION_PROBE;
+
+    struct generic_crop generic_crop;
+    take_generic_crop(codec_info_local, load_options_local, &generic_crop);
+
     void* state = NULL;
     SAIL_TRY_OR_CLEANUP(codec->v8->load_init(io, load_options_local, &state),
                         /* cleanup */ codec->v8->load_finish(&state), sail_destroy_load_options(load_options_local));
@@ -76,6 +82,23 @@ sail_status_t sail_probe_io_with_options(struct sail_io* io,
 
     sail_destroy_load_options(load_options_local);
 
+    fill_source_image_dimensions(image_local);
+
+    /* Report the dimensions the generic crop produces. */
+    unsigned crop_x, crop_y, crop_width, crop_height;
+    bool crop;
+
+    SAIL_TRY_OR_CLEANUP(generic_crop_rectangle(&generic_crop, image_local->width, image_local->height, &crop_x, &crop_y,
+                                               &crop_width, &crop_height, &crop),
+                        /* cleanup */ sail_destroy_image(image_local));
+
+    if (crop)
+    {
+        image_local->width          = crop_width;
+        image_local->height         = crop_height;
+        image_local->bytes_per_line = sail_bytes_per_line(crop_width, image_local->pixel_format);
+    }
+
     SAIL_TRY_OR_CLEANUP(io->seek(io->stream, (long)saved_offset, SEEK_SET),
                         /* cleanup */ sail_destroy_image(image_local));
 
@@ -84,6 +107,50 @@ sail_status_t sail_probe_io_with_options(struct sail_io* io,
     return SAIL_OK;
 }
 
+sail_status_t sail_load_thumbnail_from_io(struct sail_io* io,
+                                          const struct sail_codec_info* codec_info,
+                                          unsigned min_size,
+                                          struct sail_image** image)
+{
+    SAIL_CHECK_PTR(io);
+    SAIL_CHECK_PTR(image);
+
+    const struct sail_codec_info* codec_info_local;
+
+    if (codec_info == NULL)
+    {
+        SAIL_TRY(sail_codec_info_by_magic_number_from_io(io, &codec_info_local));
+    }
+    else
+    {
+        codec_info_local = codec_info;
+    }
+
+    struct sail_load_options* load_options;
+    SAIL_TRY(sail_alloc_load_options_from_features(codec_info_local->load_features, &load_options));
+
+    load_options->options |= SAIL_OPTION_THUMBNAIL;
+
+    load_options->max_width  = min_size;
+    load_options->max_height = min_size;
+
+    void* state = NULL;
+    SAIL_TRY_OR_CLEANUP(sail_start_loading_from_io_with_options(io, codec_info_local, load_options, &state),
+                        /* cleanup */ sail_stop_loading(state), sail_destroy_load_options(load_options));
+
+    sail_destroy_load_options(load_options);
+
+    struct sail_image* image_local;
+    SAIL_TRY_OR_CLEANUP(sail_load_next_frame(state, &image_local),
+                        /* cleanup */ sail_stop_loading(state));
+    SAIL_TRY_OR_CLEANUP(sail_stop_loading(state),
+                        /* cleanup */ sail_destroy_image(image_local));
+
+    *image = image_local;
+
+    return SAIL_OK;
+}
+
 sail_status_t sail_start_loading_from_file_with_options(const char* path,
                                                         const struct sail_codec_info* codec_info,
                                                         const struct sail_load_options* load_options,
@@ -48,6 +48,8 @@ struct sail_save_options;
  * pass NULL. Codec-specific defaults will be used in this case.
  *
  * This function is pretty fast because it doesn't decode the whole image data for most image formats.
+ * It adds SAIL_OPTION_PROBE to the load options, so codecs parse headers only and don't start
+ * their decoders.
  *
  * When codec info is NULL, the codec is selected by magic number. Some formats share the same
  * magic numbers (for example TIFF and DNG), so the selected codec may be incorrect. Prefer an
@@ -65,6 +67,25 @@ SAIL_EXPORT sail_status_t sail_probe_io_with_options(struct sail_io* io,
                                                      const struct sail_load_options* load_options,
                                                      struct sail_image** image);
 
+/*
+ * Loads the smallest embedded preview, like an EXIF thumbnail, that is at least min_size x min_size pixels
+ * from the specified I/O source. Pass codec info if you would like to load with a specific codec. If not,
+ * just pass NULL, and SAIL will detect it by magic number.
+ *
+ * Codecs with SAIL_CODEC_FEATURE_THUMBNAIL look for embedded previews. When there is no such preview,
+ * the first frame is loaded at the cheapest reduced size that still covers min_size x min_size
+ * with codecs supporting SAIL_CODEC_FEATURE_SCALE, or at the full size with others. The loaded image
+ * is not scaled exactly to min_size. Use sail_scale_image() afterwards to get the exact size.
+ *
+ * Typical usage: This is a standalone function that could be called at any time.
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_EXPORT sail_status_t sail_load_thumbnail_from_io(struct sail_io* io,
+                                                      const struct sail_codec_info* codec_info,
+                                                      unsigned min_size,
+                                                      struct sail_image** image);
+
 /*
  * Starts loading the specified image file with the specified load options. Pass codec info if you would like
  * to start loading with a specific codec. If not, just pass NULL, and SAIL will detect it automatically.
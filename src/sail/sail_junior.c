@@ -94,6 +94,25 @@ sail_status_t sail_load_from_file(const char* path, struct sail_image** image)
     return SAIL_OK;
 }
 
+sail_status_t sail_load_thumbnail_from_file(const char* path, unsigned min_size, struct sail_image** image)
+{
+    SAIL_CHECK_PTR(path);
+    SAIL_CHECK_PTR(image);
+
+    const struct sail_codec_info* codec_info;
+    SAIL_TRY(sail_codec_info_from_path(path, &codec_info));
+
+    struct sail_io* io;
+    SAIL_TRY(sail_alloc_io_read_file(path, &io));
+
+    SAIL_TRY_OR_CLEANUP(sail_load_thumbnail_from_io(io, codec_info, min_size, image),
+                        /* cleanup */ sail_destroy_io(io));
+
+    sail_destroy_io(io);
+
+    return SAIL_OK;
+}
+
 sail_status_t sail_load_from_memory(const void* buffer, size_t buffer_size, struct sail_image** image)
 {
     SAIL_CHECK_PTR(buffer);
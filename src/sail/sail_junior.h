@@ -70,6 +70,17 @@ SAIL_EXPORT sail_status_t sail_probe_file(const char* path,
  */
 SAIL_EXPORT sail_status_t sail_load_from_file(const char* path, struct sail_image** image);
 
+/*
+ * Loads the smallest embedded preview, like an EXIF thumbnail, that is at least min_size x min_size pixels
+ * from the specified image file. When there is no such preview, loads the first frame at the cheapest reduced
+ * size that still covers min_size x min_size. See sail_load_thumbnail_from_io().
+ *
+ * Typical usage: This is a standalone function that could be called at any time.
+ *
+ * Returns SAIL_OK on success.
+ */
+SAIL_EXPORT sail_status_t sail_load_thumbnail_from_file(const char* path, unsigned min_size, struct sail_image** image);
+
 /*
  * Loads an image from the specified memory buffer and returns its properties and pixels.
  *
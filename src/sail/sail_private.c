@@ -23,6 +23,8 @@
     SOFTWARE.
 */
 
+#include <string.h>
+
 #include <sail/sail.h>
 
 /*
@@ -36,35 +38,61 @@ static void print_unsupported_write_pixel_format(enum SailPixelFormat pixel_form
         sail_pixel_format_to_string(pixel_format));
 }
 
-static sail_status_t load_codec_by_codec_info_unsafe(const struct sail_codec_info* codec_info,
-                                                     const struct sail_codec** codec)
+static sail_status_t load_codec_into_bundle_unsafe(struct sail_codec_bundle* codec_bundle,
+                                                   const struct sail_codec** codec)
 {
-    SAIL_CHECK_PTR(codec_info);
-    SAIL_CHECK_PTR(codec);
+    /* Another thread could load the codec while we were waiting for the lock. */
+    if (codec_bundle->codec == NULL)
+    {
+        struct sail_codec* local_codec;
+        SAIL_TRY(alloc_and_load_codec(codec_bundle->codec_info, &local_codec));
 
-    struct sail_context* context;
-    SAIL_TRY(fetch_global_context_unsafe(&context));
+        /* Publish the fully loaded codec to lock-free readers. */
+        SAIL_ATOMIC_STORE_POINTER(&codec_bundle->codec, local_codec);
+    }
 
-    /* Find the codec in the cache. */
-    struct sail_codec_bundle* found_codec_bundle = NULL;
+    *codec = codec_bundle->codec;
 
-    for (struct sail_codec_bundle_node* codec_bundle_node = context->codec_bundle_node; codec_bundle_node != NULL;
-         codec_bundle_node                                = codec_bundle_node->next)
-    {
-        struct sail_codec_bundle* codec_bundle = codec_bundle_node->codec_bundle;
+    return SAIL_OK;
+}
 
-        if (codec_bundle->codec_info == codec_info)
-        {
-            if (codec_bundle->codec != NULL)
-            {
-                *codec = codec_bundle->codec;
-                return SAIL_OK;
-            }
-
-            found_codec_bundle = codec_bundle_node->codec_bundle;
-            break;
-        }
-    }
+/* A codec function call measured in the performance counters and traced. */
+struct phase
+{
+    const char* name;
+    uint64_t start_time;
+    uint64_t start_allocated;
+};
+
+static void begin_phase(struct phase* phase, const char* name)
+{
+    sail_trace_begin(name, "codec");
+
+    phase->name            = name;
+    phase->start_time      = sail_now_us();
+    phase->start_allocated = sail_thread_allocated_bytes();
+}
+
+static void end_phase(struct hidden_state* state, const struct phase* phase, uint64_t* time)
+{
+    *time += sail_now_us() - phase->start_time;
+    state->stats.bytes_allocated += sail_thread_allocated_bytes() - phase->start_allocated;
+
+    sail_trace_end(phase->name, "codec");
+}
+
+/*
+ * Public functions.
+ */
+
+/*
+ * The codec bundle index is immutable while the context is alive, so it's safe to read it without locking.
+ */
+sail_status_t find_codec_bundle(const struct sail_context* context,
+                                const struct sail_codec_info* codec_info,
+                                struct sail_codec_bundle** codec_bundle)
+{
+    struct sail_codec_bundle* found_codec_bundle = codec_bundle_index_find(context->codec_bundle_index, codec_info);
 
     /* Something weird. The pointer to the codec info is not found in the cache. */
     if (found_codec_bundle == NULL)
@@ -72,28 +100,35 @@ static sail_status_t load_codec_by_codec_info_unsafe(const struct sail_codec_inf
         SAIL_LOG_AND_RETURN(SAIL_ERROR_CODEC_NOT_FOUND);
     }
 
-    if (found_codec_bundle->codec == NULL)
-    {
-        SAIL_TRY(alloc_and_load_codec(found_codec_bundle->codec_info, &found_codec_bundle->codec));
-    }
-
-    *codec = found_codec_bundle->codec;
+    *codec_bundle = found_codec_bundle;
 
     return SAIL_OK;
 }
 
-/*
- * Public functions.
- */
-
 sail_status_t load_codec_by_codec_info(const struct sail_codec_info* codec_info, const struct sail_codec** codec)
 {
     SAIL_CHECK_PTR(codec_info);
     SAIL_CHECK_PTR(codec);
 
+    struct sail_context* context;
+    SAIL_TRY(fetch_global_context_lock_free(&context));
+
+    struct sail_codec_bundle* codec_bundle;
+    SAIL_TRY(find_codec_bundle(context, codec_info, &codec_bundle));
+
+    /* Fast path: the codec is already loaded. */
+    const struct sail_codec* loaded_codec = SAIL_ATOMIC_LOAD_POINTER(&codec_bundle->codec);
+
+    if (SAIL_LIKELY(loaded_codec != NULL))
+    {
+        *codec = loaded_codec;
+        return SAIL_OK;
+    }
+
+    /* Slow path: load the codec once under the lock. */
     SAIL_TRY(lock_context());
 
-    SAIL_TRY_OR_CLEANUP(load_codec_by_codec_info_unsafe(codec_info, codec),
+    SAIL_TRY_OR_CLEANUP(load_codec_into_bundle_unsafe(codec_bundle, codec),
                         /* cleanup */ unlock_context());
 
     SAIL_TRY(unlock_context());
@@ -108,11 +143,14 @@ void destroy_hidden_state(struct hidden_state* state)
         return;
     }
 
+    sail_destroy_io(state->io);
+
     if (state->own_io)
     {
-        sail_destroy_io(state->io);
+        sail_destroy_io(state->original_io);
     }
 
+    sail_destroy_frame_index(state->visited_frames);
     sail_destroy_load_options(state->load_options);
     sail_destroy_save_options(state->save_options);
 
@@ -122,6 +160,173 @@ void destroy_hidden_state(struct hidden_state* state)
     sail_free(state);
 }
 
+sail_status_t codec_load_init(struct hidden_state* state)
+{
+    struct phase phase;
+    begin_phase(&phase, "load_init");
+
+    const sail_status_t status = state->codec->v8->load_init(state->io, state->load_options, &state->state);
+
+    end_phase(state, &phase, &state->stats.init_time);
+
+    return status;
+}
+
+sail_status_t codec_load_seek_next_frame(struct hidden_state* state, struct sail_image** image)
+{
+    if (state->visited_frames != NULL)
+    {
+        state->visited_frames->next_frame = state->frame_index;
+    }
+
+    struct phase phase;
+    begin_phase(&phase, "load_seek_next_frame");
+
+    const sail_status_t status = state->codec->v8->load_seek_next_frame(state->state, image);
+
+    end_phase(state, &phase, &state->stats.seek_next_frame_time);
+
+    if (status == SAIL_OK)
+    {
+        state->stats.frames++;
+    }
+
+    return status;
+}
+
+sail_status_t codec_load_frame(struct hidden_state* state, struct sail_image* image)
+{
+    struct phase phase;
+    begin_phase(&phase, "load_frame");
+
+    const sail_status_t status = state->codec->v8->load_frame(state->state, image);
+
+    end_phase(state, &phase, &state->stats.frame_time);
+
+    return status;
+}
+
+sail_status_t codec_load_finish(struct hidden_state* state)
+{
+    struct phase phase;
+    begin_phase(&phase, "load_finish");
+
+    const sail_status_t status = state->codec->v8->load_finish(&state->state);
+
+    end_phase(state, &phase, &state->stats.finish_time);
+
+    return status;
+}
+
+sail_status_t codec_save_init(struct hidden_state* state)
+{
+    struct phase phase;
+    begin_phase(&phase, "save_init");
+
+    const sail_status_t status = state->codec->v8->save_init(state->io, state->save_options, &state->state);
+
+    end_phase(state, &phase, &state->stats.init_time);
+
+    return status;
+}
+
+sail_status_t codec_save_seek_next_frame(struct hidden_state* state, const struct sail_image* image)
+{
+    struct phase phase;
+    begin_phase(&phase, "save_seek_next_frame");
+
+    const sail_status_t status = state->codec->v8->save_seek_next_frame(state->state, image);
+
+    end_phase(state, &phase, &state->stats.seek_next_frame_time);
+
+    if (status == SAIL_OK)
+    {
+        state->stats.frames++;
+    }
+
+    return status;
+}
+
+sail_status_t codec_save_frame(struct hidden_state* state, const struct sail_image* image)
+{
+    struct phase phase;
+    begin_phase(&phase, "save_frame");
+
+    const sail_status_t status = state->codec->v8->save_frame(state->state, image);
+
+    end_phase(state, &phase, &state->stats.frame_time);
+
+    return status;
+}
+
+sail_status_t codec_save_finish(struct hidden_state* state)
+{
+    struct phase phase;
+    begin_phase(&phase, "save_finish");
+
+    const sail_status_t status = state->codec->v8->save_finish(&state->state);
+
+    end_phase(state, &phase, &state->stats.finish_time);
+
+    return status;
+}
+
+void fill_source_image_dimensions(struct sail_image* image)
+{
+    if (image->source_image != NULL && image->source_image->width == 0 && image->source_image->height == 0)
+    {
+        image->source_image->width  = image->width;
+        image->source_image->height = image->height;
+    }
+}
+
+void take_generic_crop(const struct sail_codec_info* codec_info,
+                       struct sail_load_options* load_options,
+                       struct generic_crop* generic_crop)
+{
+    memset(generic_crop, 0, sizeof(*generic_crop));
+
+    if (load_options == NULL || (codec_info->load_features->features & SAIL_CODEC_FEATURE_CROP))
+    {
+        return;
+    }
+
+    generic_crop->x      = load_options->crop_x;
+    generic_crop->y      = load_options->crop_y;
+    generic_crop->width  = load_options->crop_width;
+    generic_crop->height = load_options->crop_height;
+
+    load_options->crop_x      = 0;
+    load_options->crop_y      = 0;
+    load_options->crop_width  = 0;
+    load_options->crop_height = 0;
+}
+
+sail_status_t generic_crop_rectangle(const struct generic_crop* generic_crop,
+                                     unsigned width,
+                                     unsigned height,
+                                     unsigned* x,
+                                     unsigned* y,
+                                     unsigned* crop_width,
+                                     unsigned* crop_height,
+                                     bool* crop)
+{
+    SAIL_CHECK_PTR(crop);
+
+    struct sail_load_options load_options = {0};
+
+    load_options.crop_x      = generic_crop->x;
+    load_options.crop_y      = generic_crop->y;
+    load_options.crop_width  = generic_crop->width;
+    load_options.crop_height = generic_crop->height;
+
+    SAIL_TRY(sail_crop_rectangle_from_load_options(&load_options, width, height, x, y, crop_width, crop_height));
+
+    *crop = *crop_width != width || *crop_height != height;
+
+    return SAIL_OK;
+}
+
 sail_status_t stop_saving(void* state, size_t* written)
 {
     if (written != NULL)
@@ -144,8 +349,8 @@ sail_status_t stop_saving(void* state, size_t* written)
         return SAIL_OK;
     }
 
-    SAIL_TRY_OR_CLEANUP(state_of_mind->codec->v8->save_finish(&state_of_mind->state),
-                        /* cleanup */ destroy_hidden_state(state_of_mind));
+    SAIL_TRY_OR_CLEANUP(codec_save_finish(state_of_mind),
+                        /* cleanup */ record_operation_stats(state_of_mind), destroy_hidden_state(state_of_mind));
 
     if (written != NULL)
     {
@@ -155,6 +360,7 @@ sail_status_t stop_saving(void* state, size_t* written)
         state_of_mind->io->tell(state_of_mind->io->stream, written);
     }
 
+    record_operation_stats(state_of_mind);
     destroy_hidden_state(state_of_mind);
 
     return SAIL_OK;
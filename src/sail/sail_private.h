@@ -32,13 +32,31 @@
 #include <sail-common/export.h>
 #include <sail-common/status.h>
 
+#include <sail/operation_stats.h>
+
+struct sail_codec_bundle;
 struct sail_codec_info;
 struct sail_codec;
+struct sail_context;
+struct sail_frame_index;
+struct sail_image;
+struct sail_load_options;
 struct sail_save_features;
 
+/* Crop rectangle applied by SAIL itself for codecs without SAIL_CODEC_FEATURE_CROP. */
+struct generic_crop
+{
+    unsigned x;
+    unsigned y;
+    unsigned width;
+    unsigned height;
+};
+
 struct hidden_state
 {
+    /* I/O object passed to codecs. Counts bytes passed through the original I/O object. */
     struct sail_io* io;
+    struct sail_io* original_io;
     bool own_io;
 
     struct sail_load_options* load_options;
@@ -50,13 +68,86 @@ struct hidden_state
     /* Shallow pointers to internal data structures so no need to free these. */
     const struct sail_codec_info* codec_info;
     const struct sail_codec* codec;
+
+    struct generic_crop generic_crop;
+
+    /* I/O offset where loading started. Used to restart loading when seeking backwards. */
+    size_t start_offset;
+    /* Zero-based index of the frame returned by the next load_seek_next_frame. */
+    unsigned frame_index;
+    /* Number of frames, known after load_seek_next_frame reported the end of the image. */
+    unsigned frame_count;
+    bool frame_count_known;
+    /* Frames were skipped without decoding them, so the codec state is valid just at keyframes. */
+    bool frames_skipped;
+    /*
+     * Index of the frames visited so far, or NULL when frames are not indexed. Codecs reach it
+     * through the load options with the functions from frame_index.h.
+     */
+    struct sail_frame_index* visited_frames;
+
+    /* Performance counters of the operation. */
+    struct sail_operation_stats stats;
 };
 
+/*
+ * Finds the codec bundle of the specified codec info in the context.
+ */
+SAIL_HIDDEN sail_status_t find_codec_bundle(const struct sail_context* context,
+                                            const struct sail_codec_info* codec_info,
+                                            struct sail_codec_bundle** codec_bundle);
+
 SAIL_HIDDEN sail_status_t load_codec_by_codec_info(const struct sail_codec_info* codec_info,
                                                    const struct sail_codec** codec);
 
 SAIL_HIDDEN void destroy_hidden_state(struct hidden_state* state);
 
+/*
+ * Codec function calls measured in the operation performance counters.
+ */
+SAIL_HIDDEN sail_status_t codec_load_init(struct hidden_state* state);
+
+SAIL_HIDDEN sail_status_t codec_load_seek_next_frame(struct hidden_state* state, struct sail_image** image);
+
+SAIL_HIDDEN sail_status_t codec_load_frame(struct hidden_state* state, struct sail_image* image);
+
+SAIL_HIDDEN sail_status_t codec_load_finish(struct hidden_state* state);
+
+SAIL_HIDDEN sail_status_t codec_save_init(struct hidden_state* state);
+
+SAIL_HIDDEN sail_status_t codec_save_seek_next_frame(struct hidden_state* state, const struct sail_image* image);
+
+SAIL_HIDDEN sail_status_t codec_save_frame(struct hidden_state* state, const struct sail_image* image);
+
+SAIL_HIDDEN sail_status_t codec_save_finish(struct hidden_state* state);
+
+/*
+ * Assigns the source image dimensions from the image when the codec didn't set them,
+ * so they keep the original dimensions after the generic crop.
+ */
+SAIL_HIDDEN void fill_source_image_dimensions(struct sail_image* image);
+
+/*
+ * Moves the crop rectangle from the load options into the generic crop when the codec
+ * cannot crop natively. Zeroes the generic crop otherwise.
+ */
+SAIL_HIDDEN void take_generic_crop(const struct sail_codec_info* codec_info,
+                                   struct sail_load_options* load_options,
+                                   struct generic_crop* generic_crop);
+
+/*
+ * Intersects the generic crop with a frame of the specified dimensions. Sets *crop to false
+ * when the intersection is the whole frame.
+ */
+SAIL_HIDDEN sail_status_t generic_crop_rectangle(const struct generic_crop* generic_crop,
+                                                 unsigned width,
+                                                 unsigned height,
+                                                 unsigned* x,
+                                                 unsigned* y,
+                                                 unsigned* crop_width,
+                                                 unsigned* crop_height,
+                                                 bool* crop);
+
 SAIL_HIDDEN sail_status_t stop_saving(void* state, size_t* written);
 
 SAIL_HIDDEN sail_status_t allowed_write_output_pixel_format(const struct sail_save_features* save_features,
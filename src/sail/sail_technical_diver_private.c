@@ -24,9 +24,12 @@
 */
 
 #include <stdlib.h>
+#include <string.h>
 
 #include <sail/sail.h>
 
+#include <sail-common/options_private.h>
+
 /*
  * Private functions.
  */
@@ -76,7 +79,8 @@ sail_status_t start_loading_io_with_options(struct sail_io* io,
                         /* cleanup */ if (own_io) sail_destroy_io(io));
     struct hidden_state* state_of_mind = ptr;
 
-    state_of_mind->io           = io;
+    state_of_mind->io           = NULL;
+    state_of_mind->original_io  = io;
     state_of_mind->own_io       = own_io;
     state_of_mind->load_options = NULL;
     state_of_mind->save_options = NULL;
@@ -84,6 +88,20 @@ sail_status_t start_loading_io_with_options(struct sail_io* io,
     state_of_mind->codec_info   = codec_info;
     state_of_mind->codec        = NULL;
 
+    memset(&state_of_mind->generic_crop, 0, sizeof(state_of_mind->generic_crop));
+
+    state_of_mind->start_offset      = 0;
+    state_of_mind->frame_index       = 0;
+    state_of_mind->frame_count       = 0;
+    state_of_mind->frame_count_known = false;
+    state_of_mind->frames_skipped    = false;
+    state_of_mind->visited_frames    = NULL;
+
+    memset(&state_of_mind->stats, 0, sizeof(state_of_mind->stats));
+
+    SAIL_TRY_OR_CLEANUP(alloc_io_counting(io, &state_of_mind->io),
+                        /* cleanup */ destroy_hidden_state(state_of_mind));
+
     SAIL_TRY_OR_CLEANUP(load_codec_by_codec_info(state_of_mind->codec_info, &state_of_mind->codec),
                         /* cleanup */ destroy_hidden_state(state_of_mind));
 
@@ -99,10 +117,27 @@ sail_status_t start_loading_io_with_options(struct sail_io* io,
                             /* cleanup */ destroy_hidden_state(state_of_mind));
     }
 
-    SAIL_TRY_OR_CLEANUP(
-        state_of_mind->codec->v8->load_init(state_of_mind->io, state_of_mind->load_options, &state_of_mind->state),
-        /* cleanup */ state_of_mind->codec->v8->load_finish(&state_of_mind->state),
-        destroy_hidden_state(state_of_mind));
+    take_generic_crop(state_of_mind->codec_info, state_of_mind->load_options, &state_of_mind->generic_crop);
+
+    /* Backward seeks return here. Non-seekable streams may not even support tell(). */
+    if (state_of_mind->io->features & SAIL_IO_FEATURE_SEEKABLE)
+    {
+        SAIL_TRY_OR_CLEANUP(state_of_mind->io->tell(state_of_mind->io->stream, &state_of_mind->start_offset),
+                            /* cleanup */ destroy_hidden_state(state_of_mind));
+
+        /* Codecs resume at indexed frames by seeking the I/O source. */
+        if (state_of_mind->codec_info->load_features->features & SAIL_CODEC_FEATURE_FRAME_INDEX)
+        {
+            SAIL_TRY_OR_CLEANUP(sail_alloc_frame_index(&state_of_mind->visited_frames),
+                                /* cleanup */ destroy_hidden_state(state_of_mind));
+
+            sail_set_load_options_frame_index(state_of_mind->load_options, state_of_mind->visited_frames);
+        }
+    }
+
+    SAIL_TRY_OR_CLEANUP(codec_load_init(state_of_mind),
+                        /* cleanup */ state_of_mind->codec->v8->load_finish(&state_of_mind->state),
+                        destroy_hidden_state(state_of_mind));
 
     *state = state_of_mind;
 
@@ -135,7 +170,8 @@ sail_status_t start_saving_io_with_options(struct sail_io* io,
                         /* cleanup */ if (own_io) sail_destroy_io(io));
     struct hidden_state* state_of_mind = ptr;
 
-    state_of_mind->io           = io;
+    state_of_mind->io           = NULL;
+    state_of_mind->original_io  = io;
     state_of_mind->own_io       = own_io;
     state_of_mind->load_options = NULL;
     state_of_mind->save_options = NULL;
@@ -143,6 +179,20 @@ sail_status_t start_saving_io_with_options(struct sail_io* io,
     state_of_mind->codec_info   = codec_info;
     state_of_mind->codec        = NULL;
 
+    memset(&state_of_mind->generic_crop, 0, sizeof(state_of_mind->generic_crop));
+
+    state_of_mind->start_offset      = 0;
+    state_of_mind->frame_index       = 0;
+    state_of_mind->frame_count       = 0;
+    state_of_mind->frame_count_known = false;
+    state_of_mind->frames_skipped    = false;
+    state_of_mind->visited_frames    = NULL;
+
+    memset(&state_of_mind->stats, 0, sizeof(state_of_mind->stats));
+
+    SAIL_TRY_OR_CLEANUP(alloc_io_counting(io, &state_of_mind->io),
+                        /* cleanup */ destroy_hidden_state(state_of_mind));
+
     SAIL_TRY_OR_CLEANUP(load_codec_by_codec_info(state_of_mind->codec_info, &state_of_mind->codec),
                         /* cleanup */ destroy_hidden_state(state_of_mind));
 
@@ -158,10 +208,9 @@ sail_status_t start_saving_io_with_options(struct sail_io* io,
                             /* cleanup */ destroy_hidden_state(state_of_mind));
     }
 
-    SAIL_TRY_OR_CLEANUP(
-        state_of_mind->codec->v8->save_init(state_of_mind->io, state_of_mind->save_options, &state_of_mind->state),
-        /* cleanup */ state_of_mind->codec->v8->save_finish(&state_of_mind->state),
-        destroy_hidden_state(state_of_mind));
+    SAIL_TRY_OR_CLEANUP(codec_save_init(state_of_mind),
+                        /* cleanup */ state_of_mind->codec->v8->save_finish(&state_of_mind->state),
+                        destroy_hidden_state(state_of_mind));
 
     *state = state_of_mind;
 
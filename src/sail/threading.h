@@ -70,3 +70,4 @@ SAIL_HIDDEN sail_status_t threading_lock_mutex(sail_mutex_t* mutex);
 SAIL_HIDDEN sail_status_t threading_unlock_mutex(sail_mutex_t* mutex);
 
 SAIL_HIDDEN sail_status_t threading_destroy_mutex(sail_mutex_t* mutex);
+
@@ -23,6 +23,11 @@
     SOFTWARE.
 */
 
+#include <algorithm> /* std::min */
+#include <cstring> /* memcmp */
+#include <string>
+#include <vector>
+
 #include <sail-c++/suppress_begin.h>
 #include <sail-c++/suppress_c4251.h>
 
@@ -31,6 +36,7 @@
 #include <sail-c++/codec_info.h>
 #include <sail-c++/image.h>
 #include <sail-c++/image_input.h>
+#include <sail-c++/image_output.h>
 #include <sail-c++/io_base_private.h>
 #include <sail-c++/io_file.h>
 #include <sail-c++/io_memory.h>
@@ -284,6 +290,240 @@ static MunitResult test_can_probe_memory_then_load(const MunitParameter params[]
     return MUNIT_OK;
 }
 
+static MunitResult test_can_load_into_caller_pixels(const MunitParameter params[], void* user_data)
+{
+
+    (void)user_data;
+
+    const char* path = munit_parameters_get(params, "path");
+
+    const sail::image reference(path);
+    munit_assert(reference.is_valid());
+
+    const unsigned bytes_per_line = reference.bytes_per_line() + 16;
+    std::vector<unsigned char> pixels(static_cast<std::size_t>(bytes_per_line) * reference.height());
+
+    sail::image image(pixels.data(), reference.pixel_format(), reference.width(), reference.height(), bytes_per_line);
+
+    sail::image_input input(path);
+    munit_assert(input.next_frame(&image) == SAIL_OK);
+    munit_assert(image.is_valid());
+
+    munit_assert_ptr_equal(image.pixels(), pixels.data());
+    munit_assert_uint(image.bytes_per_line(), ==, bytes_per_line);
+    munit_assert_uint(image.width(), ==, reference.width());
+    munit_assert_uint(image.height(), ==, reference.height());
+
+    for (unsigned row = 0; row < image.height(); row++)
+    {
+        munit_assert(memcmp(image.scan_line(row), reference.scan_line(row), reference.bytes_per_line()) == 0);
+    }
+
+    return MUNIT_OK;
+}
+
+static MunitResult test_can_probe_many(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    std::vector<std::string> paths;
+
+    for (const char* const* path = SAIL_TEST_IMAGES; *path != NULL; path++)
+    {
+        paths.push_back(*path);
+    }
+
+    paths.push_back("missing-file.png");
+
+    const auto results = sail::image_input::probe_many(paths, 2);
+    munit_assert(results.size() == paths.size());
+
+    for (std::size_t i = 0; i < paths.size() - 1; i++)
+    {
+        const auto probe_result           = sail::image_input(paths[i]).probe();
+        const sail::image probed          = std::get<0>(probe_result);
+        const sail::codec_info codec_info = std::get<1>(probe_result);
+
+        /* Some acceptance images cannot be probed (for example unknown codecs). */
+        if (!codec_info.is_valid())
+        {
+            munit_assert(std::get<0>(results[i]) != SAIL_OK);
+            continue;
+        }
+
+        munit_assert(std::get<0>(results[i]) == SAIL_OK);
+        munit_assert(std::get<1>(results[i]).width() == probed.width());
+        munit_assert(std::get<1>(results[i]).height() == probed.height());
+        munit_assert(std::get<1>(results[i]).pixel_format() == probed.pixel_format());
+        munit_assert(std::get<2>(results[i]).name() == codec_info.name());
+    }
+
+    munit_assert(std::get<0>(results.back()) != SAIL_OK);
+    munit_assert_false(std::get<2>(results.back()).is_valid());
+
+    return MUNIT_OK;
+}
+
+static MunitResult test_can_load_thumbnail(const MunitParameter params[], void* user_data)
+{
+    (void)user_data;
+
+    const char* path = munit_parameters_get(params, "path");
+
+    const sail::image full_image = sail::image_input(path).next_frame();
+    munit_assert(full_image.is_valid());
+
+    const unsigned min_size = std::min(full_image.width(), full_image.height()) / 4;
+
+    const sail::image image = sail::image_input(path).thumbnail(min_size);
+    munit_assert(image.is_valid());
+    munit_assert(image.width() >= min_size && image.width() <= full_image.width());
+    munit_assert(image.height() >= min_size && image.height() <= full_image.height());
+
+    /* Thumbnails are loaded instead of frames. */
+    sail::image_input input(path);
+    munit_assert(input.next_frame().is_valid());
+    munit_assert_false(input.thumbnail(min_size).is_valid());
+
+    return MUNIT_OK;
+}
+
+static MunitResult test_can_seek_to_frame(const MunitParameter params[], void* user_data)
+{
+    (void)user_data;
+
+    const char* path = munit_parameters_get(params, "path");
+
+    std::vector<sail::image> frames;
+
+    {
+        sail::image_input input(path);
+
+        for (sail::image image = input.next_frame(); image.is_valid() && frames.size() < 8; image = input.next_frame())
+        {
+            frames.push_back(std::move(image));
+        }
+    }
+
+    munit_assert_false(frames.empty());
+
+    sail::image_input input(path);
+
+    for (std::size_t i = frames.size(); i > 0; i--)
+    {
+        munit_assert(input.seek_to_frame(static_cast<unsigned>(i - 1)) == SAIL_OK);
+
+        const sail::image image = input.next_frame();
+        munit_assert(image.is_valid());
+        munit_assert(image.width() == frames[i - 1].width());
+        munit_assert(image.height() == frames[i - 1].height());
+        munit_assert(std::memcmp(image.pixels(), frames[i - 1].pixels(), image.pixels_size()) == 0);
+    }
+
+    return MUNIT_OK;
+}
+
+static MunitResult test_can_load_rows(const MunitParameter params[], void* user_data)
+{
+    (void)user_data;
+
+    const char* path = munit_parameters_get(params, "path");
+
+    const sail::image reference = sail::image_input(path).next_frame();
+    munit_assert(reference.is_valid());
+
+    const unsigned bytes_per_line = sail::image::bytes_per_line(reference.width(), reference.pixel_format());
+    std::vector<unsigned char> pixels(static_cast<std::size_t>(reference.height()) * bytes_per_line);
+    unsigned rows = 0;
+
+    sail::image_input input(path);
+
+    munit_assert(input.next_frame_rows(5,
+                                       [&](const sail::image& band, unsigned first_row, unsigned frame_height) {
+                                           munit_assert(band.width() == reference.width());
+                                           munit_assert(band.height() <= 5);
+                                           munit_assert(frame_height == reference.height());
+
+                                           for (unsigned row = 0; row < band.height(); row++)
+                                           {
+                                               std::memcpy(pixels.data()
+                                                               + static_cast<std::size_t>(first_row + row)
+                                                                     * bytes_per_line,
+                                                           band.scan_line(row), bytes_per_line);
+                                           }
+
+                                           rows += band.height();
+
+                                           return SAIL_OK;
+                                       })
+                 == SAIL_OK);
+
+    munit_assert(rows == reference.height());
+
+    for (unsigned row = 0; row < reference.height(); row++)
+    {
+        munit_assert(std::memcmp(pixels.data() + static_cast<std::size_t>(row) * bytes_per_line,
+                                 reference.scan_line(row), bytes_per_line)
+                     == 0);
+    }
+
+    return MUNIT_OK;
+}
+
+static MunitResult test_can_save_rows(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    const sail::codec_info codec_info = sail::codec_info::from_extension("bmp");
+
+    if (!codec_info.is_valid())
+    {
+        return MUNIT_SKIP;
+    }
+
+    // The frame properties come from the image, the pixels come from the callback
+    const sail::image skeleton(nullptr, SAIL_PIXEL_FORMAT_BPP24_BGR, 33, 47);
+    std::vector<unsigned char> buffer(64 * 1024);
+    unsigned rows = 0;
+
+    sail::image_output output(buffer.data(), buffer.size(), codec_info);
+
+    munit_assert(output.next_frame_rows(skeleton, 5,
+                                        [&](sail::image& band, unsigned first_row, unsigned frame_height) {
+                                            munit_assert(band.width() == skeleton.width());
+                                            munit_assert(band.height() <= 5);
+                                            munit_assert(frame_height == skeleton.height());
+
+                                            for (unsigned row = 0; row < band.height(); row++)
+                                            {
+                                                std::memset(band.scan_line(row), static_cast<int>(first_row + row),
+                                                            band.bytes_per_line());
+                                            }
+
+                                            rows += band.height();
+
+                                            return SAIL_OK;
+                                        })
+                 == SAIL_OK);
+    munit_assert(output.finish() == SAIL_OK);
+
+    munit_assert(rows == skeleton.height());
+
+    const sail::image image = sail::image_input(buffer.data(), buffer.size()).next_frame();
+    munit_assert(image.is_valid());
+    munit_assert(image.height() == skeleton.height());
+
+    for (unsigned row = 0; row < image.height(); row++)
+    {
+        const unsigned char* scan = static_cast<const unsigned char*>(image.scan_line(row));
+        munit_assert(scan[0] == row && scan[image.width() * 3 - 1] == row);
+    }
+
+    return MUNIT_OK;
+}
+
 static MunitParameterEnum test_params[] = {
     {(char*)"path", (char**)SAIL_TEST_IMAGES},
     {NULL, NULL},
@@ -299,8 +539,14 @@ static MunitTest test_suite_tests[] = {
     { (char *)"/can-load-io-memory3",        test_can_load_io_memory3,        NULL, NULL, MUNIT_TEST_OPTION_NONE, test_params },
     { (char *)"/can-load-io-memory4",        test_can_load_io_memory4,        NULL, NULL, MUNIT_TEST_OPTION_NONE, test_params },
     { (char *)"/can-load-io-memory5",        test_can_load_io_memory5,        NULL, NULL, MUNIT_TEST_OPTION_NONE, test_params },
+    { (char *)"/can-load-into-caller-pixels", test_can_load_into_caller_pixels, NULL, NULL, MUNIT_TEST_OPTION_NONE, test_params },
     { (char *)"/can-probe-then-load",        test_can_probe_then_load,        NULL, NULL, MUNIT_TEST_OPTION_NONE, test_params },
     { (char *)"/can-probe-memory-then-load", test_can_probe_memory_then_load, NULL, NULL, MUNIT_TEST_OPTION_NONE, test_params },
+    { (char *)"/can-probe-many",             test_can_probe_many,             NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/can-load-thumbnail",         test_can_load_thumbnail,         NULL, NULL, MUNIT_TEST_OPTION_NONE, test_params },
+    { (char *)"/can-seek-to-frame",          test_can_seek_to_frame,          NULL, NULL, MUNIT_TEST_OPTION_NONE, test_params },
+    { (char *)"/can-load-rows",              test_can_load_rows,              NULL, NULL, MUNIT_TEST_OPTION_NONE, test_params },
+    { (char *)"/can-save-rows",              test_can_save_rows,              NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
 
     { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
 };
@@ -0,0 +1,125 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <sail-c++/sail-c++.h>
+#include <sail/sail.h>
+
+#include "munit.h"
+
+static MunitResult test_codec_info_lookup(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    const std::vector<sail::codec_info> codecs = sail::codec_info::list();
+    munit_assert(codecs.size() > 0U);
+
+    const sail::codec_info& first_codec = codecs.front();
+
+    const sail::codec_info by_name = sail::codec_info::from_name(first_codec.name());
+    munit_assert(by_name.is_valid());
+    munit_assert(by_name.name() == first_codec.name());
+    munit_assert(by_name.extensions() == first_codec.extensions());
+    munit_assert(by_name.mime_types() == first_codec.mime_types());
+
+    // Lookups return wrappers sharing the same cached string lists
+    {
+        const sail::codec_info by_name2 = sail::codec_info::from_name(first_codec.name());
+
+        munit_assert(&by_name.extensions() == &by_name2.extensions());
+        munit_assert(&by_name.mime_types() == &first_codec.mime_types());
+    }
+
+    if (!first_codec.extensions().empty())
+    {
+        const sail::codec_info by_extension = sail::codec_info::from_extension(first_codec.extensions().front());
+        munit_assert(by_extension.is_valid());
+    }
+
+    munit_assert(!sail::codec_info::from_name("unknown-codec-name").is_valid());
+
+    return MUNIT_OK;
+}
+
+static MunitResult test_codec_info_after_finish(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    const std::string name = sail::codec_info::list().front().name();
+
+    sail::context::finish();
+
+    // The cache must be rebuilt from the new context
+    const sail::codec_info by_name = sail::codec_info::from_name(name);
+    munit_assert(by_name.is_valid());
+    munit_assert(by_name.name() == name);
+
+    return MUNIT_OK;
+}
+
+static MunitResult test_codec_info_after_direct_finish(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    const sail::codec_info before = sail::codec_info::list().front();
+
+    // Bypass context::finish(). Cached copies must die with the C codec info objects
+    sail_finish();
+
+    // Copies made before finish stay valid
+    munit_assert(before.is_valid());
+
+    for (const sail::codec_info& codec_info : sail::codec_info::list())
+    {
+        const sail_codec_info* sail_codec_info;
+        munit_assert(sail_codec_info_from_name(codec_info.name().c_str(), &sail_codec_info) == SAIL_OK);
+
+        munit_assert(codec_info.is_valid());
+        munit_assert(codec_info.version() == sail_codec_info->version);
+    }
+
+    return MUNIT_OK;
+}
+
+// clang-format off
+static MunitTest test_suite_tests[] = {
+    { (char *)"/lookup",              test_codec_info_lookup,              NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/after-finish",        test_codec_info_after_finish,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/after-direct-finish", test_codec_info_after_direct_finish, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+
+    { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
+};
+
+static const MunitSuite test_suite = {
+    (char *)"/bindings/c++/codec-info", test_suite_tests, NULL, 1, MUNIT_SUITE_OPTION_NONE
+};
+// clang-format on
+
+int main(int argc, char* argv[MUNIT_ARRAY_PARAM(argc + 1)])
+{
+    return munit_suite_main(&test_suite, NULL, argc, argv);
+}
@@ -124,11 +124,53 @@ static MunitResult test_load_options_move(const MunitParameter params[], void* u
     return MUNIT_OK;
 }
 
+static MunitResult test_load_options_crop(const MunitParameter params[], void* user_data)
+{
+
+    (void)params;
+    (void)user_data;
+
+    sail::load_options load_options;
+    munit_assert(load_options.crop_width() == 0);
+    munit_assert(load_options.crop_height() == 0);
+
+    load_options.set_crop(1, 2, 3, 4);
+
+    const sail::load_options load_options2 = load_options;
+    munit_assert(load_options2.crop_x() == 1);
+    munit_assert(load_options2.crop_y() == 2);
+    munit_assert(load_options2.crop_width() == 3);
+    munit_assert(load_options2.crop_height() == 4);
+
+    return MUNIT_OK;
+}
+
+static MunitResult test_load_options_max_size(const MunitParameter params[], void* user_data)
+{
+
+    (void)params;
+    (void)user_data;
+
+    sail::load_options load_options;
+    munit_assert(load_options.max_width() == 0);
+    munit_assert(load_options.max_height() == 0);
+
+    load_options.set_max_size(5, 6);
+
+    const sail::load_options load_options2 = load_options;
+    munit_assert(load_options2.max_width() == 5);
+    munit_assert(load_options2.max_height() == 6);
+
+    return MUNIT_OK;
+}
+
 // clang-format off
 static MunitTest test_suite_tests[] = {
     { (char *)"/construct", test_load_options_construct, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
     { (char *)"/copy",      test_load_options_copy,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
     { (char *)"/move",      test_load_options_move,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/crop",      test_load_options_crop,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/max-size",  test_load_options_max_size,  NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
 
     { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
 };
@@ -0,0 +1,1358 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+/*
+ * sail-bench measures initialization, decoding, encoding, probing, conversion, scaling, rotation,
+ * and quantization on synthetic images and prints the results as JSON. The compare mode reads two such files and
+ * reports the benchmarks that got slower. No input files or network access are needed.
+ *
+ * Usage:
+ *     sail-bench [--quick] [--iterations N] [--threads N] [--filter SUBSTRING] [--output FILE]
+ *     sail-bench --compare BASELINE CURRENT [--threshold PERCENT] [--min-delta MICROSECONDS]
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <sail-manip/sail-manip.h>
+#include <sail/sail.h>
+
+#define BENCH_MAX_ITERATIONS 1000
+#define BENCH_NAME_LENGTH    160
+#define BENCH_LINE_LENGTH    512
+
+struct bench_options
+{
+    bool quick;
+    unsigned iterations;
+    const char* filter;
+    FILE* output;
+
+    unsigned emitted;
+    unsigned skipped;
+};
+
+struct bench_record
+{
+    char name[BENCH_NAME_LENGTH];
+    unsigned long long median_us;
+};
+
+typedef sail_status_t (*bench_func_t)(void* user_data);
+
+/*
+ * Synthetic images.
+ */
+
+static uint32_t bench_random(uint32_t* seed)
+{
+    /* xorshift32. Deterministic, so every run benchmarks the same pixels. */
+    uint32_t x = *seed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *seed = x;
+
+    return x;
+}
+
+/* A smooth RGBA gradient with a bit of noise, so lossless codecs cannot collapse it to nothing. */
+static sail_status_t alloc_gradient_image(unsigned width, unsigned height, struct sail_image** image)
+{
+    struct sail_image* image_local;
+    SAIL_TRY(sail_alloc_image_with_alignment(SAIL_PIXEL_FORMAT_BPP32_RGBA, width, height, 1, &image_local));
+
+    uint32_t seed = 0x9E3779B9u;
+
+    for (unsigned row = 0; row < height; row++)
+    {
+        uint8_t* scan = sail_scan_line(image_local, row);
+
+        for (unsigned column = 0; column < width; column++)
+        {
+            const uint32_t noise = bench_random(&seed);
+
+            scan[column * 4 + 0] = (uint8_t)((column * 255 / width) ^ (noise & 0x7));
+            scan[column * 4 + 1] = (uint8_t)((row * 255 / height) ^ ((noise >> 3) & 0x7));
+            scan[column * 4 + 2] = (uint8_t)(((column + row) * 127 / (width + height)) ^ ((noise >> 6) & 0x7));
+            scan[column * 4 + 3] = (uint8_t)(255 - (row * 63 / height));
+        }
+    }
+
+    *image = image_local;
+
+    return SAIL_OK;
+}
+
+/*
+ * Allocates an image in the pixel format. Formats reachable from BPP32-RGBA are converted from the
+ * gradient, others are filled with pseudo-random bytes and, if indexed, a random palette.
+ */
+static sail_status_t alloc_source_image(enum SailPixelFormat pixel_format,
+                                        unsigned width,
+                                        unsigned height,
+                                        struct sail_image** image)
+{
+    /* Random bytes are often NaN when read as floats, so float RGB is filled from the gradient. */
+    if (pixel_format == SAIL_PIXEL_FORMAT_BPP96)
+    {
+        struct sail_image* gradient;
+        SAIL_TRY(alloc_gradient_image(width, height, &gradient));
+
+        struct sail_image* image_local;
+        SAIL_TRY_OR_CLEANUP(sail_alloc_image_with_alignment(pixel_format, width, height, 1, &image_local),
+                            /* cleanup */ sail_destroy_image(gradient));
+
+        for (unsigned row = 0; row < height; row++)
+        {
+            const uint8_t* source = sail_scan_line(gradient, row);
+            float* target         = sail_scan_line(image_local, row);
+
+            for (unsigned column = 0; column < width; column++)
+            {
+                for (unsigned channel = 0; channel < 3; channel++)
+                {
+                    target[column * 3 + channel] = (float)source[column * 4 + channel] / 255.0f;
+                }
+            }
+        }
+
+        sail_destroy_image(gradient);
+        *image = image_local;
+
+        return SAIL_OK;
+    }
+
+    if (sail_can_convert(SAIL_PIXEL_FORMAT_BPP32_RGBA, pixel_format))
+    {
+        struct sail_image* gradient;
+        SAIL_TRY(alloc_gradient_image(width, height, &gradient));
+
+        if (pixel_format == SAIL_PIXEL_FORMAT_BPP32_RGBA)
+        {
+            *image = gradient;
+            return SAIL_OK;
+        }
+
+        SAIL_TRY_OR_CLEANUP(sail_convert_image(gradient, pixel_format, image),
+                            /* cleanup */ sail_destroy_image(gradient));
+        sail_destroy_image(gradient);
+
+        return SAIL_OK;
+    }
+
+    struct sail_image* image_local;
+    SAIL_TRY(sail_alloc_image_with_alignment(pixel_format, width, height, 1, &image_local));
+
+    uint32_t seed = 0x2545F491u;
+    uint8_t* pixels = image_local->pixels;
+
+    for (size_t i = 0; i < (size_t)image_local->bytes_per_line * height; i++)
+    {
+        pixels[i] = (uint8_t)bench_random(&seed);
+    }
+
+    if (sail_is_indexed(pixel_format))
+    {
+        const unsigned bits        = sail_bits_per_pixel(pixel_format);
+        const unsigned color_count = bits >= 8 ? 256 : 1u << bits;
+
+        SAIL_TRY_OR_CLEANUP(
+            sail_alloc_palette_for_data(SAIL_PIXEL_FORMAT_BPP24_RGB, color_count, &image_local->palette),
+            /* cleanup */ sail_destroy_image(image_local));
+
+        uint8_t* palette_data = image_local->palette->data;
+
+        for (unsigned i = 0; i < color_count * 3; i++)
+        {
+            palette_data[i] = (uint8_t)bench_random(&seed);
+        }
+    }
+
+    *image = image_local;
+
+    return SAIL_OK;
+}
+
+/*
+ * Timing.
+ */
+
+static bool bench_selected(const struct bench_options* options, const char* name)
+{
+    return options->filter == NULL || strstr(name, options->filter) != NULL;
+}
+
+static int compare_samples(const void* a, const void* b)
+{
+    const uint64_t x = *(const uint64_t*)a;
+    const uint64_t y = *(const uint64_t*)b;
+
+    return (x > y) - (x < y);
+}
+
+/*
+ * Runs the function once to warm up caches and then the requested number of times,
+ * and emits a JSON record with the minimum, median, and mean wall clock time. If the function
+ * processes a known number of bytes, the record also gets the median throughput in MB/s.
+ */
+static sail_status_t run_benchmark(struct bench_options* options,
+                                   const char* name,
+                                   bench_func_t func,
+                                   void* user_data,
+                                   size_t bytes)
+{
+    if (!bench_selected(options, name))
+    {
+        return SAIL_OK;
+    }
+
+    sail_status_t status = func(user_data);
+
+    if (status != SAIL_OK)
+    {
+        fprintf(stderr, "%-60s skipped (error %d)\n", name, status);
+        options->skipped++;
+        return status;
+    }
+
+    uint64_t samples[BENCH_MAX_ITERATIONS];
+    uint64_t total = 0;
+
+    for (unsigned i = 0; i < options->iterations; i++)
+    {
+        const uint64_t start = sail_now_us();
+        SAIL_TRY(func(user_data));
+        samples[i] = sail_now_us() - start;
+        total += samples[i];
+    }
+
+    qsort(samples, options->iterations, sizeof(samples[0]), compare_samples);
+
+    const unsigned n      = options->iterations;
+    const uint64_t median = (n % 2 == 1) ? samples[n / 2] : (samples[n / 2 - 1] + samples[n / 2]) / 2;
+    const uint64_t mean   = total / n;
+
+    fprintf(options->output,
+            "%s    {\"name\": \"%s\", \"iterations\": %u, \"min_us\": %llu, \"median_us\": %llu, \"mean_us\": %llu",
+            options->emitted > 0 ? ",\n" : "", name, n, (unsigned long long)samples[0],
+            (unsigned long long)median, (unsigned long long)mean);
+    options->emitted++;
+
+    if (bytes > 0)
+    {
+        /* Bytes per microsecond are megabytes per second. */
+        const double mb_per_s = (double)bytes / (double)(median > 0 ? median : 1);
+
+        fprintf(options->output, ", \"mb_per_s\": %.1f}", mb_per_s);
+        fprintf(stderr, "%-60s %10llu us %10.1f MB/s\n", name, (unsigned long long)median, mb_per_s);
+    }
+    else
+    {
+        fprintf(options->output, "}");
+        fprintf(stderr, "%-60s %10llu us\n", name, (unsigned long long)median);
+    }
+
+    return SAIL_OK;
+}
+
+/*
+ * Initialization benchmarks.
+ */
+
+static sail_status_t bench_init(void* user_data)
+{
+    const int* flags = user_data;
+
+    sail_finish();
+    SAIL_TRY(sail_init_with_flags(*flags));
+
+    return SAIL_OK;
+}
+
+/*
+ * Re-creates the global context, so it must run before the other benchmarks that keep pointers
+ * to codec info objects. The warm-up run writes the codecs cache, the measured runs read it.
+ */
+static void bench_init_flags(struct bench_options* options)
+{
+    static const struct
+    {
+        int flags;
+        const char* name;
+    } variants[] = {
+        {0, "init/default"},
+        {SAIL_FLAG_CACHE_CODECS_INFO, "init/codecs-cache"},
+    };
+
+    for (size_t i = 0; i < sizeof(variants) / sizeof(variants[0]); i++)
+    {
+        run_benchmark(options, variants[i].name, bench_init, (void*)&variants[i].flags, 0);
+    }
+}
+
+/*
+ * Codec benchmarks.
+ */
+
+struct codec_context
+{
+    const struct sail_codec_info* codec_info;
+    const struct sail_image* image;
+
+    void* buffer;
+    size_t buffer_size;
+    size_t written;
+};
+
+static sail_status_t bench_encode(void* user_data)
+{
+    struct codec_context* context = user_data;
+
+    void* state;
+    SAIL_TRY(sail_start_saving_into_memory(context->buffer, context->buffer_size, context->codec_info, &state));
+
+    SAIL_TRY_OR_CLEANUP(sail_write_next_frame(state, context->image),
+                        /* cleanup */ sail_stop_saving(state));
+    SAIL_TRY(sail_stop_saving_with_written(state, &context->written));
+
+    return SAIL_OK;
+}
+
+/*
+ * Saving into a fixed memory buffer reports the whole buffer as written, so the exact encoded size
+ * for the throughput numbers comes from an expanding buffer.
+ */
+static sail_status_t encoded_size(const struct codec_context* context, size_t* size)
+{
+    struct sail_io* io;
+    SAIL_TRY(sail_alloc_io_write_expanding_buffer(context->buffer_size, &io));
+
+    void* state = NULL;
+    SAIL_TRY_OR_CLEANUP(sail_start_saving_into_io(io, context->codec_info, &state),
+                        /* cleanup */ sail_destroy_io(io));
+    SAIL_TRY_OR_CLEANUP(sail_write_next_frame(state, context->image),
+                        /* cleanup */ sail_stop_saving(state), sail_destroy_io(io));
+    SAIL_TRY_OR_CLEANUP(sail_stop_saving(state),
+                        /* cleanup */ sail_destroy_io(io));
+    SAIL_TRY_OR_CLEANUP(sail_io_expanding_buffer_size(io, size),
+                        /* cleanup */ sail_destroy_io(io));
+
+    sail_destroy_io(io);
+
+    return SAIL_OK;
+}
+
+static sail_status_t bench_decode(void* user_data)
+{
+    struct codec_context* context = user_data;
+
+    void* state;
+    SAIL_TRY(sail_start_loading_from_memory(context->buffer, context->written, context->codec_info, &state));
+
+    struct sail_image* image;
+    SAIL_TRY_OR_CLEANUP(sail_load_next_frame(state, &image),
+                        /* cleanup */ sail_stop_loading(state));
+    sail_destroy_image(image);
+
+    SAIL_TRY(sail_stop_loading(state));
+
+    return SAIL_OK;
+}
+
+static sail_status_t bench_probe(void* user_data)
+{
+    struct codec_context* context = user_data;
+
+    struct sail_image* image;
+    SAIL_TRY(sail_probe_memory(context->buffer, context->written, &image, NULL));
+    sail_destroy_image(image);
+
+    return SAIL_OK;
+}
+
+static bool codec_saves_pixel_format(const struct sail_codec_info* codec_info, enum SailPixelFormat pixel_format)
+{
+    for (unsigned i = 0; i < codec_info->save_features->pixel_formats_length; i++)
+    {
+        if (codec_info->save_features->pixel_formats[i] == pixel_format)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void format_name(char* name, const char* operation, const char* subject, const char* detail, unsigned size)
+{
+    snprintf(name, BENCH_NAME_LENGTH, "%s/%s/%s/%ux%u", operation, subject, detail, size, size);
+
+    /* Codec names are upper case, but lower case reads better in benchmark names. */
+    sail_to_lower(name);
+}
+
+static sail_status_t bench_codec(struct bench_options* options,
+                                 const struct sail_codec_info* codec_info,
+                                 enum SailPixelFormat pixel_format,
+                                 unsigned size)
+{
+    struct sail_image* image;
+    SAIL_TRY(alloc_source_image(pixel_format, size, size, &image));
+
+    size_t pixels_size;
+    SAIL_TRY_OR_CLEANUP(sail_pixels_buffer_size(image->height, image->bytes_per_line, &pixels_size),
+                        /* cleanup */ sail_destroy_image(image));
+
+    struct codec_context context = {
+        .codec_info  = codec_info,
+        .image       = image,
+        .buffer      = NULL,
+        .buffer_size = pixels_size * 4 + 1024 * 1024,
+        .written     = 0,
+    };
+
+    SAIL_TRY_OR_CLEANUP(sail_malloc(context.buffer_size, &context.buffer),
+                        /* cleanup */ sail_destroy_image(image));
+
+    const char* pixel_format_string = sail_pixel_format_to_string(pixel_format);
+    char name[BENCH_NAME_LENGTH];
+
+    /* Decoding and probing need the encoded data, so they are skipped if encoding fails. */
+    format_name(name, "encode", codec_info->name, pixel_format_string, size);
+
+    const sail_status_t status = bench_selected(options, name) ? run_benchmark(options, name, bench_encode, &context, 0)
+                                                                : bench_encode(&context);
+
+    if (status == SAIL_OK && context.written > 0 && encoded_size(&context, &context.written) == SAIL_OK)
+    {
+        /* Decoding throughput is measured in encoded bytes. */
+        format_name(name, "decode", codec_info->name, pixel_format_string, size);
+        run_benchmark(options, name, bench_decode, &context, context.written);
+
+        /* Probing detects codecs by magic numbers, so codecs without them cannot be probed. */
+        const struct sail_codec_info* probed_codec_info;
+
+        if (sail_codec_info_by_magic_number_from_memory(context.buffer, context.written, &probed_codec_info) == SAIL_OK
+            && probed_codec_info == codec_info)
+        {
+            format_name(name, "probe", codec_info->name, pixel_format_string, size);
+            run_benchmark(options, name, bench_probe, &context, 0);
+        }
+    }
+
+    sail_free(context.buffer);
+    sail_destroy_image(image);
+
+    return SAIL_OK;
+}
+
+static void bench_codecs(struct bench_options* options, const unsigned* sizes, unsigned sizes_length)
+{
+    static const enum SailPixelFormat pixel_formats[] = {
+        SAIL_PIXEL_FORMAT_BPP1_INDEXED, SAIL_PIXEL_FORMAT_BPP8_INDEXED, SAIL_PIXEL_FORMAT_BPP8_GRAYSCALE,
+        SAIL_PIXEL_FORMAT_BPP24_RGB,    SAIL_PIXEL_FORMAT_BPP24_BGR,    SAIL_PIXEL_FORMAT_BPP32_RGBA,
+        SAIL_PIXEL_FORMAT_BPP32_BGRA,   SAIL_PIXEL_FORMAT_BPP96,
+    };
+
+    for (const struct sail_codec_bundle_node* node = sail_codec_bundle_list(); node != NULL; node = node->next)
+    {
+        const struct sail_codec_info* codec_info = node->codec_bundle->codec_info;
+
+        if ((codec_info->save_features->features & SAIL_CODEC_FEATURE_STATIC) == 0)
+        {
+            continue;
+        }
+
+        for (size_t i = 0; i < sizeof(pixel_formats) / sizeof(pixel_formats[0]); i++)
+        {
+            if (!codec_saves_pixel_format(codec_info, pixel_formats[i]))
+            {
+                continue;
+            }
+
+            for (unsigned j = 0; j < sizes_length; j++)
+            {
+                if (bench_codec(options, codec_info, pixel_formats[i], sizes[j]) != SAIL_OK)
+                {
+                    fprintf(stderr, "Failed to prepare %s/%s/%u\n", codec_info->name,
+                            sail_pixel_format_to_string(pixel_formats[i]), sizes[j]);
+                }
+            }
+        }
+    }
+}
+
+/*
+ * PSD can only be loaded, so its RLE decoding benchmark gets a synthesized file.
+ */
+
+static uint8_t* put_big_endian(uint8_t* output, uint32_t value, unsigned bytes)
+{
+    for (unsigned i = 0; i < bytes; i++)
+    {
+        output[i] = (uint8_t)(value >> (8 * (bytes - 1 - i)));
+    }
+
+    return output + bytes;
+}
+
+/* Encodes the row with PackBits. Runs of three or more equal bytes are replicated, the rest are literals. */
+static size_t pack_bits(const uint8_t* row, unsigned length, uint8_t* output)
+{
+    size_t written = 0;
+    unsigned i     = 0;
+
+    while (i < length)
+    {
+        unsigned run = 1;
+
+        while (i + run < length && run < 128 && row[i + run] == row[i])
+        {
+            run++;
+        }
+
+        if (run >= 3)
+        {
+            output[written++] = (uint8_t)(257 - run);
+            output[written++] = row[i];
+            i += run;
+            continue;
+        }
+
+        unsigned literal = 0;
+
+        while (i + literal < length && literal < 128)
+        {
+            if (i + literal + 2 < length && row[i + literal] == row[i + literal + 1]
+                && row[i + literal] == row[i + literal + 2])
+            {
+                break;
+            }
+
+            literal++;
+        }
+
+        output[written++] = (uint8_t)(literal - 1);
+        memcpy(output + written, row + i, literal);
+        written += literal;
+        i       += literal;
+    }
+
+    return written;
+}
+
+/* Builds an 8-bit RGB RLE-compressed PSD from the gradient. */
+static sail_status_t alloc_psd_rle(unsigned size, void** data, size_t* data_size)
+{
+    enum
+    {
+        CHANNELS = 3
+    };
+
+    struct sail_image* gradient;
+    SAIL_TRY(alloc_gradient_image(size, size, &gradient));
+
+    const size_t header_size = 26 + 4 + 4 + 4 + 2;
+    const size_t counts_size = (size_t)CHANNELS * size * 2;
+    const size_t max_row     = size + size / 128 + 1;
+
+    void* ptr;
+    SAIL_TRY_OR_CLEANUP(sail_malloc(header_size + counts_size + (size_t)CHANNELS * size * max_row + size, &ptr),
+                        /* cleanup */ sail_destroy_image(gradient));
+    uint8_t* psd = ptr;
+
+    uint8_t* output = psd;
+    memcpy(output, "8BPS", 4);
+    output = put_big_endian(output + 4, 1, 2);   /* Version. */
+    output = put_big_endian(output, 0, 4);       /* Reserved. */
+    output = put_big_endian(output, 0, 2);       /* Reserved. */
+    output = put_big_endian(output, CHANNELS, 2);
+    output = put_big_endian(output, size, 4);    /* Height. */
+    output = put_big_endian(output, size, 4);    /* Width. */
+    output = put_big_endian(output, 8, 2);       /* Depth. */
+    output = put_big_endian(output, 3, 2);       /* RGB mode. */
+    output = put_big_endian(output, 0, 4);       /* Color mode data. */
+    output = put_big_endian(output, 0, 4);       /* Image resources. */
+    output = put_big_endian(output, 0, 4);       /* Layer and mask information. */
+    output = put_big_endian(output, 1, 2);       /* RLE compression. */
+
+    uint8_t* counts = output;
+    output         += counts_size;
+    uint8_t* plane  = psd + header_size + counts_size + (size_t)CHANNELS * size * max_row;
+
+    for (unsigned channel = 0; channel < CHANNELS; channel++)
+    {
+        for (unsigned row = 0; row < size; row++)
+        {
+            const uint8_t* scan = sail_scan_line(gradient, row);
+
+            for (unsigned column = 0; column < size; column++)
+            {
+                plane[column] = scan[column * 4 + channel];
+            }
+
+            const size_t packed = pack_bits(plane, size, output);
+            counts              = put_big_endian(counts, (uint32_t)packed, 2);
+            output             += packed;
+        }
+    }
+
+    sail_destroy_image(gradient);
+
+    *data      = psd;
+    *data_size = (size_t)(output - psd);
+
+    return SAIL_OK;
+}
+
+static void bench_psd(struct bench_options* options, const unsigned* sizes, unsigned sizes_length)
+{
+    const struct sail_codec_info* codec_info;
+
+    if (sail_codec_info_from_name("PSD", &codec_info) != SAIL_OK)
+    {
+        return;
+    }
+
+    for (unsigned i = 0; i < sizes_length; i++)
+    {
+        struct codec_context context = {
+            .codec_info  = codec_info,
+            .image       = NULL,
+            .buffer      = NULL,
+            .buffer_size = 0,
+            .written     = 0,
+        };
+
+        if (alloc_psd_rle(sizes[i], &context.buffer, &context.written) != SAIL_OK)
+        {
+            fprintf(stderr, "Failed to prepare psd/%u\n", sizes[i]);
+            continue;
+        }
+
+        char name[BENCH_NAME_LENGTH];
+        format_name(name, "decode", codec_info->name, "bpp24-rgb-rle", sizes[i]);
+        run_benchmark(options, name, bench_decode, &context, context.written);
+
+        sail_free(context.buffer);
+    }
+}
+
+/*
+ * Manipulation benchmarks.
+ */
+
+struct convert_context
+{
+    const struct sail_image* image;
+    enum SailPixelFormat output_pixel_format;
+};
+
+static sail_status_t bench_convert(void* user_data)
+{
+    const struct convert_context* context = user_data;
+
+    struct sail_image* image;
+    SAIL_TRY(sail_convert_image(context->image, context->output_pixel_format, &image));
+    sail_destroy_image(image);
+
+    return SAIL_OK;
+}
+
+struct scale_context
+{
+    const struct sail_image* image;
+    unsigned width;
+    unsigned height;
+    enum SailScaling algorithm;
+};
+
+static sail_status_t bench_scale(void* user_data)
+{
+    const struct scale_context* context = user_data;
+
+    struct sail_image* image;
+    SAIL_TRY(sail_scale_image(context->image, context->width, context->height, context->algorithm, &image));
+    sail_destroy_image(image);
+
+    return SAIL_OK;
+}
+
+struct rotate_context
+{
+    const struct sail_image* image;
+    enum SailOrientation orientation;
+};
+
+static sail_status_t bench_rotate(void* user_data)
+{
+    const struct rotate_context* context = user_data;
+
+    struct sail_image* image;
+    SAIL_TRY(sail_rotate_image(context->image, context->orientation, &image));
+    sail_destroy_image(image);
+
+    return SAIL_OK;
+}
+
+struct quantize_context
+{
+    const struct sail_image* image;
+    bool dither;
+};
+
+static sail_status_t bench_quantize(void* user_data)
+{
+    const struct quantize_context* context = user_data;
+
+    struct sail_image* image;
+    SAIL_TRY(sail_quantize_image(context->image, SAIL_PIXEL_FORMAT_BPP8_INDEXED, context->dither, &image));
+    sail_destroy_image(image);
+
+    return SAIL_OK;
+}
+
+/* Every supported conversion pair, measured on one small image to keep the matrix affordable. */
+static void bench_convert_matrix(struct bench_options* options, unsigned size)
+{
+    for (int input = SAIL_PIXEL_FORMAT_UNKNOWN + 1; input <= SAIL_PIXEL_FORMAT_BPP48_CIE_LAB; input++)
+    {
+        struct sail_image* image = NULL;
+
+        for (int output = SAIL_PIXEL_FORMAT_UNKNOWN + 1; output <= SAIL_PIXEL_FORMAT_BPP48_CIE_LAB; output++)
+        {
+            if (!sail_can_convert(input, output))
+            {
+                continue;
+            }
+
+            char detail[BENCH_NAME_LENGTH];
+            snprintf(detail, sizeof(detail), "%s-to-%s", sail_pixel_format_to_string(input),
+                     sail_pixel_format_to_string(output));
+
+            char name[BENCH_NAME_LENGTH];
+            format_name(name, "convert", "image", detail, size);
+
+            if (!bench_selected(options, name))
+            {
+                continue;
+            }
+
+            if (image == NULL && alloc_source_image(input, size, size, &image) != SAIL_OK)
+            {
+                fprintf(stderr, "Failed to prepare a %s image\n", sail_pixel_format_to_string(input));
+                break;
+            }
+
+            struct convert_context context = {
+                .image               = image,
+                .output_pixel_format = output,
+            };
+
+            run_benchmark(options, name, bench_convert, &context, 0);
+        }
+
+        sail_destroy_image(image);
+    }
+}
+
+static void bench_manip(struct bench_options* options, const unsigned* sizes, unsigned sizes_length)
+{
+    static const struct
+    {
+        enum SailScaling algorithm;
+        const char* name;
+    } algorithms[] = {
+        {SAIL_SCALING_NEAREST_NEIGHBOR, "nearest-neighbor"},
+        {SAIL_SCALING_BILINEAR, "bilinear"},
+        {SAIL_SCALING_BICUBIC, "bicubic"},
+        {SAIL_SCALING_LANCZOS, "lanczos"},
+    };
+
+    static const struct
+    {
+        enum SailOrientation orientation;
+        const char* name;
+    } orientations[] = {
+        {SAIL_ORIENTATION_ROTATED_90, "90"},
+        {SAIL_ORIENTATION_ROTATED_180, "180"},
+        {SAIL_ORIENTATION_ROTATED_270, "270"},
+    };
+
+    static const enum SailPixelFormat rotate_pixel_formats[] = {
+        SAIL_PIXEL_FORMAT_BPP24_RGB,
+        SAIL_PIXEL_FORMAT_BPP32_RGBA,
+    };
+
+    char detail[BENCH_NAME_LENGTH];
+    char name[BENCH_NAME_LENGTH];
+
+    for (unsigned i = 0; i < sizes_length; i++)
+    {
+        const unsigned size = sizes[i];
+
+        struct sail_image* rgba;
+        struct sail_image* rgb;
+
+        if (alloc_source_image(SAIL_PIXEL_FORMAT_BPP32_RGBA, size, size, &rgba) != SAIL_OK)
+        {
+            fprintf(stderr, "Failed to prepare a %ux%u image\n", size, size);
+            continue;
+        }
+
+        if (sail_convert_image(rgba, SAIL_PIXEL_FORMAT_BPP24_RGB, &rgb) != SAIL_OK)
+        {
+            fprintf(stderr, "Failed to prepare a %ux%u image\n", size, size);
+            sail_destroy_image(rgba);
+            continue;
+        }
+
+        /* Scaling: downscale by half and upscale twice. */
+        for (size_t j = 0; j < sizeof(algorithms) / sizeof(algorithms[0]); j++)
+        {
+            struct scale_context context = {
+                .image     = rgba,
+                .width     = size / 2,
+                .height    = size / 2,
+                .algorithm = algorithms[j].algorithm,
+            };
+
+            snprintf(detail, sizeof(detail), "%s-down", algorithms[j].name);
+            format_name(name, "scale", "bpp32-rgba", detail, size);
+            run_benchmark(options, name, bench_scale, &context, 0);
+
+            context.width  = size * 2;
+            context.height = size * 2;
+
+            snprintf(detail, sizeof(detail), "%s-up", algorithms[j].name);
+            format_name(name, "scale", "bpp32-rgba", detail, size);
+            run_benchmark(options, name, bench_scale, &context, 0);
+        }
+
+        /* Rotation. */
+        for (size_t j = 0; j < sizeof(rotate_pixel_formats) / sizeof(rotate_pixel_formats[0]); j++)
+        {
+            for (size_t k = 0; k < sizeof(orientations) / sizeof(orientations[0]); k++)
+            {
+                struct rotate_context context = {
+                    .image       = rotate_pixel_formats[j] == SAIL_PIXEL_FORMAT_BPP24_RGB ? rgb : rgba,
+                    .orientation = orientations[k].orientation,
+                };
+
+                format_name(name, "rotate", sail_pixel_format_to_string(rotate_pixel_formats[j]), orientations[k].name,
+                            size);
+                run_benchmark(options, name, bench_rotate, &context, 0);
+            }
+        }
+
+        /* Quantization. */
+        for (int dither = 0; dither <= 1; dither++)
+        {
+            struct quantize_context context = {
+                .image  = rgb,
+                .dither = dither == 1,
+            };
+
+            format_name(name, "quantize", "bpp24-rgb", dither == 1 ? "bpp8-indexed-dither" : "bpp8-indexed", size);
+            run_benchmark(options, name, bench_quantize, &context, 0);
+        }
+
+        sail_destroy_image(rgb);
+        sail_destroy_image(rgba);
+    }
+}
+
+/*
+ * Compare mode.
+ */
+
+/*
+ * A tiny tokenizer for the records sail-bench writes. Every record is a JSON object on its own line
+ * with string keys and string or number values, for example:
+ *
+ * {"name": "load/png/bpp24-rgb/256x256", "iterations": 5, "median_us": 1234, "mb_per_s": 53.1}
+ */
+static void skip_spaces(const char** it)
+{
+    while (**it == ' ' || **it == '\t' || **it == '\r' || **it == '\n')
+    {
+        (*it)++;
+    }
+}
+
+static bool skip_char(const char** it, char c)
+{
+    skip_spaces(it);
+
+    if (**it != c)
+    {
+        return false;
+    }
+
+    (*it)++;
+
+    return true;
+}
+
+/* Reads a quoted string into the buffer. Supports the escapes of quotes and backslashes. */
+static bool read_string(const char** it, char* buffer, size_t buffer_size)
+{
+    if (!skip_char(it, '"'))
+    {
+        return false;
+    }
+
+    size_t length = 0;
+
+    for (; **it != '"'; (*it)++)
+    {
+        if (**it == '\0')
+        {
+            return false;
+        }
+
+        if (**it == '\\')
+        {
+            (*it)++;
+
+            if (**it != '"' && **it != '\\')
+            {
+                return false;
+            }
+        }
+
+        if (length + 1 >= buffer_size)
+        {
+            return false;
+        }
+
+        buffer[length++] = **it;
+    }
+
+    (*it)++;
+    buffer[length] = '\0';
+
+    return true;
+}
+
+/* Reads a number token like 1234 or 53.1 into the buffer. */
+static bool read_number(const char** it, char* buffer, size_t buffer_size)
+{
+    skip_spaces(it);
+
+    size_t length = 0;
+
+    for (; (**it >= '0' && **it <= '9') || **it == '.' || **it == '-' || **it == '+' || **it == 'e' || **it == 'E';
+         (*it)++)
+    {
+        if (length + 1 >= buffer_size)
+        {
+            return false;
+        }
+
+        buffer[length++] = **it;
+    }
+
+    buffer[length] = '\0';
+
+    return length > 0;
+}
+
+/* Parses a record line. Returns false if the line is malformed or misses the name or the median. */
+static bool parse_record(const char* line, struct bench_record* record)
+{
+    const char* it  = line;
+    bool has_name   = false;
+    bool has_median = false;
+
+    if (!skip_char(&it, '{'))
+    {
+        return false;
+    }
+
+    do
+    {
+        char key[32];
+        char value[BENCH_NAME_LENGTH];
+
+        if (!read_string(&it, key, sizeof(key)) || !skip_char(&it, ':'))
+        {
+            return false;
+        }
+
+        skip_spaces(&it);
+
+        if (*it == '"')
+        {
+            if (!read_string(&it, value, sizeof(value)))
+            {
+                return false;
+            }
+
+            if (strcmp(key, "name") == 0)
+            {
+                strcpy(record->name, value);
+                has_name = true;
+            }
+        }
+        else
+        {
+            if (!read_number(&it, value, sizeof(value)))
+            {
+                return false;
+            }
+
+            if (strcmp(key, "median_us") == 0)
+            {
+                char* end;
+                record->median_us = strtoull(value, &end, 10);
+
+                if (*end != '\0')
+                {
+                    return false;
+                }
+
+                has_median = true;
+            }
+        }
+    } while (skip_char(&it, ','));
+
+    if (!skip_char(&it, '}'))
+    {
+        return false;
+    }
+
+    /* The separator before the next record. */
+    skip_char(&it, ',');
+    skip_spaces(&it);
+
+    return *it == '\0' && has_name && has_median;
+}
+
+static sail_status_t read_records(const char* path, struct bench_record** records, unsigned* records_length)
+{
+    FILE* file = fopen(path, "r");
+
+    if (file == NULL)
+    {
+        fprintf(stderr, "Failed to open '%s'\n", path);
+        SAIL_LOG_AND_RETURN(SAIL_ERROR_OPEN_FILE);
+    }
+
+    struct bench_record* records_local = NULL;
+    unsigned length                    = 0;
+    unsigned capacity                  = 0;
+    unsigned line_number               = 0;
+    char line[BENCH_LINE_LENGTH];
+
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        line_number++;
+
+        const char* it = line;
+        skip_spaces(&it);
+
+        /* Records are objects on a single line. Skip the header, the brackets, and empty lines. */
+        const char* after_brace = it + 1;
+        skip_spaces(&after_brace);
+
+        if (*it != '{' || *after_brace == '\0')
+        {
+            continue;
+        }
+
+        if (length == capacity)
+        {
+            capacity = capacity == 0 ? 256 : capacity * 2;
+
+            void* ptr = records_local;
+            SAIL_TRY_OR_CLEANUP(sail_realloc(sizeof(struct bench_record) * capacity, &ptr),
+                                /* cleanup */ sail_free(records_local), fclose(file));
+            records_local = ptr;
+        }
+
+        /* Lines longer than the buffer have no line feed and fail to parse. */
+        if ((strchr(line, '\n') == NULL && !feof(file)) || !parse_record(it, &records_local[length]))
+        {
+            fprintf(stderr, "Malformed record at %s:%u\n", path, line_number);
+            sail_free(records_local);
+            fclose(file);
+            SAIL_LOG_AND_RETURN(SAIL_ERROR_INVALID_ARGUMENT);
+        }
+
+        length++;
+    }
+
+    fclose(file);
+
+    *records        = records_local;
+    *records_length = length;
+
+    return SAIL_OK;
+}
+
+static const struct bench_record* find_record(const struct bench_record* records,
+                                              unsigned records_length,
+                                              const char* name)
+{
+    for (unsigned i = 0; i < records_length; i++)
+    {
+        if (strcmp(records[i].name, name) == 0)
+        {
+            return &records[i];
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ * Flags the benchmarks whose median grew by more than the threshold percentage and the minimum delta,
+ * and the baseline benchmarks that disappeared. Returns the process exit code.
+ */
+static int compare(const char* baseline_path, const char* current_path, double threshold, unsigned long long min_delta)
+{
+    struct bench_record* baseline;
+    unsigned baseline_length;
+    struct bench_record* current;
+    unsigned current_length;
+
+    SAIL_TRY_OR_EXECUTE(read_records(baseline_path, &baseline, &baseline_length),
+                        /* on error */ return 2);
+    SAIL_TRY_OR_EXECUTE(read_records(current_path, &current, &current_length),
+                        /* on error */ sail_free(baseline); return 2);
+
+    if (baseline_length == 0)
+    {
+        fprintf(stderr, "No benchmarks found in '%s'\n", baseline_path);
+        sail_free(current);
+        return 2;
+    }
+
+    unsigned regressions = 0;
+    unsigned missing     = 0;
+    unsigned added       = 0;
+
+    for (unsigned i = 0; i < baseline_length; i++)
+    {
+        const struct bench_record* record = find_record(current, current_length, baseline[i].name);
+
+        if (record == NULL)
+        {
+            printf("MISSING     %s\n", baseline[i].name);
+            missing++;
+            continue;
+        }
+
+        const unsigned long long before = baseline[i].median_us;
+        const unsigned long long after  = record->median_us;
+
+        if (after > before && after - before >= min_delta && after > before * (1.0 + threshold / 100.0))
+        {
+            printf("REGRESSION  %s: %llu us -> %llu us (+%.1f%%)\n", baseline[i].name, before, after,
+                   before == 0 ? 100.0 : (after - before) * 100.0 / before);
+            regressions++;
+        }
+    }
+
+    for (unsigned i = 0; i < current_length; i++)
+    {
+        if (find_record(baseline, baseline_length, current[i].name) == NULL)
+        {
+            printf("NEW         %s\n", current[i].name);
+            added++;
+        }
+    }
+
+    printf("%u benchmarks compared, %u regressions, %u missing, %u new\n", baseline_length, regressions, missing,
+           added);
+
+    sail_free(current);
+    sail_free(baseline);
+
+    return (regressions > 0 || missing > 0) ? 1 : 0;
+}
+
+/*
+ * Entry point.
+ */
+
+static void usage(const char* program)
+{
+    fprintf(stderr,
+            "Usage: %s [--quick] [--iterations N] [--threads N] [--filter SUBSTRING] [--output FILE]\n"
+            "       %s --compare BASELINE CURRENT [--threshold PERCENT] [--min-delta MICROSECONDS]\n",
+            program, program);
+}
+
+static bool parse_unsigned(const char* str, unsigned min, unsigned max, unsigned* value)
+{
+    char* end;
+    const unsigned long result = strtoul(str, &end, 10);
+
+    if (*str == '\0' || *end != '\0' || result < min || result > max)
+    {
+        return false;
+    }
+
+    *value = (unsigned)result;
+
+    return true;
+}
+
+int main(int argc, char* argv[])
+{
+    struct bench_options options = {
+        .quick      = false,
+        .iterations = 5,
+        .filter     = NULL,
+        .output     = stdout,
+        .emitted    = 0,
+        .skipped    = 0,
+    };
+
+    const char* output_path   = NULL;
+    const char* baseline_path = NULL;
+    const char* current_path  = NULL;
+    double threshold          = 10.0;
+    unsigned min_delta        = 20;
+    unsigned threads          = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const bool has_value = i + 1 < argc;
+
+        if (strcmp(argv[i], "--quick") == 0)
+        {
+            options.quick = true;
+        }
+        else if (strcmp(argv[i], "--iterations") == 0 && has_value)
+        {
+            if (!parse_unsigned(argv[++i], 1, BENCH_MAX_ITERATIONS, &options.iterations))
+            {
+                fprintf(stderr, "Iterations must be in the range [1, %d]\n", BENCH_MAX_ITERATIONS);
+                return 2;
+            }
+        }
+        else if (strcmp(argv[i], "--threads") == 0 && has_value)
+        {
+            if (!parse_unsigned(argv[++i], 1, 1024, &threads))
+            {
+                fprintf(stderr, "Threads must be in the range [1, 1024]\n");
+                return 2;
+            }
+        }
+        else if (strcmp(argv[i], "--filter") == 0 && has_value)
+        {
+            options.filter = argv[++i];
+        }
+        else if (strcmp(argv[i], "--output") == 0 && has_value)
+        {
+            output_path = argv[++i];
+        }
+        else if (strcmp(argv[i], "--compare") == 0 && i + 2 < argc)
+        {
+            baseline_path = argv[++i];
+            current_path  = argv[++i];
+        }
+        else if (strcmp(argv[i], "--threshold") == 0 && has_value)
+        {
+            threshold = strtod(argv[++i], NULL);
+
+            if (threshold < 0)
+            {
+                fprintf(stderr, "Threshold must not be negative\n");
+                return 2;
+            }
+        }
+        else if (strcmp(argv[i], "--min-delta") == 0 && has_value)
+        {
+            if (!parse_unsigned(argv[++i], 0, UINT32_MAX, &min_delta))
+            {
+                fprintf(stderr, "Invalid minimum delta\n");
+                return 2;
+            }
+        }
+        else
+        {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+
+    if (baseline_path != NULL)
+    {
+        return compare(baseline_path, current_path, threshold, min_delta);
+    }
+
+    /* Failed conversions and unsupported codec options are reported as skipped benchmarks. */
+    sail_set_log_barrier(SAIL_LOG_LEVEL_SILENCE);
+
+    if (threads > 0)
+    {
+        sail_set_max_threads(threads);
+    }
+
+    if (output_path != NULL)
+    {
+        options.output = fopen(output_path, "w");
+
+        if (options.output == NULL)
+        {
+            fprintf(stderr, "Failed to open '%s' for writing\n", output_path);
+            return 2;
+        }
+    }
+
+    static const unsigned quick_sizes[] = {64, 256};
+    static const unsigned full_sizes[]  = {64, 512, 2048};
+
+    const unsigned* sizes       = options.quick ? quick_sizes : full_sizes;
+    const unsigned sizes_length = options.quick ? 2 : 3;
+
+    fprintf(options.output, "{\n  \"sail_version\": \"%s\",\n  \"quick\": %s,\n  \"iterations\": %u,\n  \"benchmarks\": [\n",
+            SAIL_VERSION_STRING, options.quick ? "true" : "false", options.iterations);
+
+    bench_init_flags(&options);
+    bench_codecs(&options, sizes, sizes_length);
+    bench_psd(&options, sizes, sizes_length);
+    bench_convert_matrix(&options, options.quick ? 32 : 128);
+    bench_manip(&options, sizes, sizes_length);
+
+    fprintf(options.output, "\n  ]\n}\n");
+
+    if (options.output != stdout)
+    {
+        fclose(options.output);
+    }
+
+    fprintf(stderr, "%u benchmarks, %u skipped\n", options.emitted, options.skipped);
+
+    return options.emitted > 0 ? 0 : 1;
+}
@@ -169,6 +169,12 @@ static MunitResult test_codec_feature_binary_compatibility(const MunitParameter
     munit_assert_int(SAIL_CODEC_FEATURE_MULTI_PAGED, ==, 1 << 3);
     munit_assert_int(SAIL_CODEC_FEATURE_ICCP, ==, 1 << 6);
     munit_assert_int(SAIL_CODEC_FEATURE_SOURCE_IMAGE, ==, 1 << 7);
+    munit_assert_int(SAIL_CODEC_FEATURE_CROP, ==, 1 << 8);
+    munit_assert_int(SAIL_CODEC_FEATURE_SCALE, ==, 1 << 9);
+    munit_assert_int(SAIL_CODEC_FEATURE_THUMBNAIL, ==, 1 << 10);
+    munit_assert_int(SAIL_CODEC_FEATURE_SEEK, ==, 1 << 11);
+    munit_assert_int(SAIL_CODEC_FEATURE_ROW_BANDS, ==, 1 << 12);
+    munit_assert_int(SAIL_CODEC_FEATURE_FRAME_INDEX, ==, 1 << 13);
 
     return MUNIT_OK;
 }
@@ -184,6 +190,8 @@ static MunitResult test_option_binary_compatibility(const MunitParameter params[
     munit_assert_int(SAIL_OPTION_INTERLACED, ==, 1 << 1);
     munit_assert_int(SAIL_OPTION_ICCP, ==, 1 << 2);
     munit_assert_int(SAIL_OPTION_SOURCE_IMAGE, ==, 1 << 3);
+    munit_assert_int(SAIL_OPTION_PROBE, ==, 1 << 4);
+    munit_assert_int(SAIL_OPTION_THUMBNAIL, ==, 1 << 5);
 
     return MUNIT_OK;
 }
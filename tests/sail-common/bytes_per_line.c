@@ -236,6 +236,21 @@ static MunitResult test_cie_lab(const MunitParameter params[], void* user_data)
     return MUNIT_OK;
 }
 
+static MunitResult test_aligned(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    munit_assert(sail_align_bytes_per_line(100, 0) == 100);
+    munit_assert(sail_align_bytes_per_line(100, 1) == 100);
+    munit_assert(sail_align_bytes_per_line(100, 64) == 128);
+    munit_assert(sail_align_bytes_per_line(128, 64) == 128);
+    munit_assert(sail_align_bytes_per_line(1, 4096) == 4096);
+    munit_assert(sail_align_bytes_per_line(UINT_MAX - 10, 64) == 0);
+
+    return MUNIT_OK;
+}
+
 static MunitResult test_overflow(const MunitParameter params[], void* user_data)
 {
     (void)params;
@@ -258,6 +273,7 @@ static MunitTest test_suite_tests[] = {
     { (char *)"/ycbcr",           test_ycbcr,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
     { (char *)"/ycck",            test_ycck,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
     { (char *)"/cie-lab",         test_cie_lab,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/aligned",         test_aligned,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
     { (char *)"/overflow",        test_overflow,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
 
     { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
@@ -0,0 +1,163 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <sail-common/sail-common.h>
+
+#include "munit.h"
+
+static void kernel_first(void)
+{
+}
+
+static void kernel_second(void)
+{
+}
+
+static MunitResult test_features(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    const int cpu_features = sail_cpu_features();
+
+    munit_assert_int(cpu_features, >=, 0);
+    munit_assert_int(sail_cpu_features(), ==, cpu_features);
+
+    /* x86 and ARM features never appear together. */
+    munit_assert_false((cpu_features & SAIL_CPU_FEATURE_SSE2) && (cpu_features & SAIL_CPU_FEATURE_NEON));
+
+    /* Newer x86 instruction sets imply the older ones. */
+    if (cpu_features & SAIL_CPU_FEATURE_AVX512)
+    {
+        munit_assert_true(cpu_features & SAIL_CPU_FEATURE_AVX2);
+    }
+    if (cpu_features & SAIL_CPU_FEATURE_AVX2)
+    {
+        munit_assert_true(cpu_features & SAIL_CPU_FEATURE_SSE4_1);
+    }
+    if (cpu_features & SAIL_CPU_FEATURE_SSE4_1)
+    {
+        munit_assert_true(cpu_features & SAIL_CPU_FEATURE_SSSE3);
+    }
+    if (cpu_features & SAIL_CPU_FEATURE_SSSE3)
+    {
+        munit_assert_true(cpu_features & SAIL_CPU_FEATURE_SSE2);
+    }
+
+    const char* cpu_level = getenv("SAIL_CPU_LEVEL");
+
+    if (cpu_level != NULL && strcmp(cpu_level, "scalar") == 0)
+    {
+        munit_assert_int(cpu_features, ==, 0);
+    }
+
+    return MUNIT_OK;
+}
+
+static MunitResult test_feature_to_string(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    munit_assert_string_equal(sail_cpu_feature_to_string(SAIL_CPU_FEATURE_SSE2), "SSE2");
+    munit_assert_string_equal(sail_cpu_feature_to_string(SAIL_CPU_FEATURE_SSE4_1), "SSE4.1");
+    munit_assert_string_equal(sail_cpu_feature_to_string(SAIL_CPU_FEATURE_AVX512), "AVX-512");
+    munit_assert_string_equal(sail_cpu_feature_to_string(SAIL_CPU_FEATURE_NEON), "NEON");
+    munit_assert_null(sail_cpu_feature_to_string((enum SailCpuFeature)0));
+
+    return MUNIT_OK;
+}
+
+static MunitResult test_select_kernel(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    /* Portable variants are always selected. */
+    {
+        const struct sail_kernel_variant variants[] = {
+            {0, (sail_kernel_func_t)kernel_first},
+            {0, (sail_kernel_func_t)kernel_second},
+        };
+
+        munit_assert_true(sail_select_kernel(variants, 2) == (sail_kernel_func_t)kernel_first);
+    }
+
+    /* No CPU has both SSE2 and NEON. */
+    {
+        const struct sail_kernel_variant variants[] = {
+            {SAIL_CPU_FEATURE_SSE2 | SAIL_CPU_FEATURE_NEON, (sail_kernel_func_t)kernel_first},
+            {0, (sail_kernel_func_t)kernel_second},
+        };
+
+        munit_assert_true(sail_select_kernel(variants, 2) == (sail_kernel_func_t)kernel_second);
+        munit_assert_true(sail_select_kernel(variants, 1) == NULL);
+    }
+
+    /* Variants matching the detected features. */
+    {
+        const struct sail_kernel_variant variants[] = {
+            {sail_cpu_features(), (sail_kernel_func_t)kernel_first},
+            {0, (sail_kernel_func_t)kernel_second},
+        };
+
+        munit_assert_true(sail_select_kernel(variants, 2) == (sail_kernel_func_t)kernel_first);
+    }
+
+    munit_assert_true(sail_select_kernel(NULL, 2) == NULL);
+
+    {
+        const struct sail_kernel_variant variants[] = {
+            {0, (sail_kernel_func_t)kernel_first},
+        };
+
+        munit_assert_true(sail_select_kernel(variants, 0) == NULL);
+    }
+
+    return MUNIT_OK;
+}
+
+// clang-format off
+static MunitTest test_suite_tests[] = {
+    { (char *)"/features",          test_features,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/feature-to-string", test_feature_to_string, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/select-kernel",     test_select_kernel,     NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+
+    { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
+};
+
+static const MunitSuite test_suite = {
+    (char *)"/cpu-features", test_suite_tests, NULL, 1, MUNIT_SUITE_OPTION_NONE
+};
+// clang-format on
+
+int main(int argc, char* argv[MUNIT_ARRAY_PARAM(argc + 1)])
+{
+    return munit_suite_main(&test_suite, NULL, argc, argv);
+}
@@ -728,6 +728,12 @@ static MunitResult test_codec_feature_to_string(const MunitParameter params[], v
     munit_assert_string_equal(sail_codec_feature_to_string(SAIL_CODEC_FEATURE_INTERLACED), "INTERLACED");
     munit_assert_string_equal(sail_codec_feature_to_string(SAIL_CODEC_FEATURE_ICCP), "ICCP");
     munit_assert_string_equal(sail_codec_feature_to_string(SAIL_CODEC_FEATURE_SOURCE_IMAGE), "SOURCE-IMAGE");
+    munit_assert_string_equal(sail_codec_feature_to_string(SAIL_CODEC_FEATURE_CROP), "CROP");
+    munit_assert_string_equal(sail_codec_feature_to_string(SAIL_CODEC_FEATURE_SCALE), "SCALE");
+    munit_assert_string_equal(sail_codec_feature_to_string(SAIL_CODEC_FEATURE_THUMBNAIL), "THUMBNAIL");
+    munit_assert_string_equal(sail_codec_feature_to_string(SAIL_CODEC_FEATURE_SEEK), "SEEK");
+    munit_assert_string_equal(sail_codec_feature_to_string(SAIL_CODEC_FEATURE_ROW_BANDS), "ROW-BANDS");
+    munit_assert_string_equal(sail_codec_feature_to_string(SAIL_CODEC_FEATURE_FRAME_INDEX), "FRAME-INDEX");
 
     return MUNIT_OK;
 }
@@ -748,6 +754,12 @@ static MunitResult test_codec_feature_from_string(const MunitParameter params[],
     munit_assert(sail_codec_feature_from_string("INTERLACED") == SAIL_CODEC_FEATURE_INTERLACED);
     munit_assert(sail_codec_feature_from_string("ICCP") == SAIL_CODEC_FEATURE_ICCP);
     munit_assert(sail_codec_feature_from_string("SOURCE-IMAGE") == SAIL_CODEC_FEATURE_SOURCE_IMAGE);
+    munit_assert(sail_codec_feature_from_string("CROP") == SAIL_CODEC_FEATURE_CROP);
+    munit_assert(sail_codec_feature_from_string("SCALE") == SAIL_CODEC_FEATURE_SCALE);
+    munit_assert(sail_codec_feature_from_string("THUMBNAIL") == SAIL_CODEC_FEATURE_THUMBNAIL);
+    munit_assert(sail_codec_feature_from_string("SEEK") == SAIL_CODEC_FEATURE_SEEK);
+    munit_assert(sail_codec_feature_from_string("ROW-BANDS") == SAIL_CODEC_FEATURE_ROW_BANDS);
+    munit_assert(sail_codec_feature_from_string("FRAME-INDEX") == SAIL_CODEC_FEATURE_FRAME_INDEX);
 
     return MUNIT_OK;
 }
@@ -58,10 +58,33 @@ static MunitResult test_log_level_from_string_invalid(const MunitParameter param
     return MUNIT_OK;
 }
 
+static MunitResult test_log_level_enabled(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    sail_set_log_barrier(SAIL_LOG_LEVEL_WARNING);
+
+    munit_assert_true(sail_is_log_level_enabled(SAIL_LOG_LEVEL_ERROR));
+    munit_assert_true(sail_is_log_level_enabled(SAIL_LOG_LEVEL_WARNING));
+    munit_assert_false(sail_is_log_level_enabled(SAIL_LOG_LEVEL_INFO));
+    munit_assert_false(sail_is_log_level_enabled(SAIL_LOG_LEVEL_DEBUG));
+
+    sail_set_log_barrier(SAIL_LOG_LEVEL_SILENCE);
+    munit_assert_false(sail_is_log_level_enabled(SAIL_LOG_LEVEL_ERROR));
+
+    sail_set_log_barrier(SAIL_LOG_LEVEL_DEBUG);
+    munit_assert_true(sail_is_log_level_enabled(SAIL_LOG_LEVEL_DEBUG));
+    munit_assert_false(sail_is_log_level_enabled(SAIL_LOG_LEVEL_TRACE));
+
+    return MUNIT_OK;
+}
+
 // clang-format off
 static MunitTest test_suite_tests[] = {
     { (char *)"/log-level-from-string-valid", test_log_level_from_string_valid, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
     { (char *)"/log-level-from-string-invalid", test_log_level_from_string_invalid, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/log-level-enabled",             test_log_level_enabled,             NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
 
     { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
 };
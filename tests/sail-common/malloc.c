@@ -23,6 +23,7 @@
     SOFTWARE.
 */
 
+#include <stdint.h>
 #include <string.h>
 
 #include <sail-common/sail-common.h>
@@ -98,11 +99,55 @@ static MunitResult test_realloc(const MunitParameter params[], void* user_data)
     return MUNIT_OK;
 }
 
+static MunitResult test_malloc_aligned(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    const size_t alignments[] = { 1, 16, 64, 4096 };
+
+    for (size_t i = 0; i < sizeof(alignments) / sizeof(alignments[0]); i++)
+    {
+        void* ptr = NULL;
+        munit_assert(sail_malloc_aligned(alignments[i], 1000, &ptr) == SAIL_OK);
+        munit_assert_not_null(ptr);
+        munit_assert((uintptr_t)ptr % alignments[i] == 0);
+
+        memset(ptr, 0, 1000);
+        sail_free_aligned(ptr);
+    }
+
+    /* Not a power of two. */
+    void* ptr = NULL;
+    munit_assert(sail_malloc_aligned(48, 1000, &ptr) == SAIL_ERROR_INVALID_ARGUMENT);
+
+    sail_free_aligned(NULL);
+
+    /* Aligned image. */
+    struct sail_image* image = NULL;
+    munit_assert(sail_alloc_image_with_alignment(SAIL_PIXEL_FORMAT_BPP24_RGB, 17, 5, 64, &image) == SAIL_OK);
+    munit_assert(image->bytes_per_line == 64);
+    munit_assert(image->pixels_alignment == 64);
+    munit_assert((uintptr_t)image->pixels % 64 == 0);
+
+    struct sail_image* image_copy = NULL;
+    munit_assert(sail_copy_image(image, &image_copy) == SAIL_OK);
+    munit_assert(image_copy->bytes_per_line == 64);
+    munit_assert(image_copy->pixels_alignment == 64);
+    munit_assert((uintptr_t)image_copy->pixels % 64 == 0);
+
+    sail_destroy_image(image_copy);
+    sail_destroy_image(image);
+
+    return MUNIT_OK;
+}
+
 // clang-format off
 static MunitTest test_suite_tests[] = {
-    { (char *)"/malloc",  test_malloc,  NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
-    { (char *)"/calloc",  test_calloc,  NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
-    { (char *)"/realloc", test_realloc, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/malloc",           test_malloc,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/calloc",           test_calloc,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/realloc",          test_realloc,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/malloc-aligned",   test_malloc_aligned,   NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
 
     { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
 };
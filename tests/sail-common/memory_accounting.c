@@ -0,0 +1,383 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <sail-common/sail-common.h>
+
+#include "munit.h"
+
+/*
+ * The memory configuration cannot be changed after SAIL has allocated memory, so main() installs
+ * the counting allocator and enables accounting before any test runs. The tests check deltas.
+ */
+struct counting_allocator
+{
+    unsigned allocations;
+    unsigned reallocations;
+    unsigned deallocations;
+};
+
+static struct counting_allocator counting_allocator = { 0, 0, 0 };
+
+static void* counting_allocate(void* user_data, size_t size)
+{
+    struct counting_allocator* allocator = user_data;
+    allocator->allocations++;
+
+    return malloc(size);
+}
+
+static void* counting_reallocate(void* user_data, void* ptr, size_t size)
+{
+    struct counting_allocator* allocator = user_data;
+    allocator->reallocations++;
+
+    return realloc(ptr, size);
+}
+
+static void counting_deallocate(void* user_data, void* ptr)
+{
+    struct counting_allocator* allocator = user_data;
+
+    if (ptr != NULL)
+    {
+        allocator->deallocations++;
+    }
+
+    free(ptr);
+}
+
+static MunitResult test_custom_allocator(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    const struct counting_allocator before = counting_allocator;
+
+    void* ptr = NULL;
+    munit_assert(sail_malloc(100, &ptr) == SAIL_OK);
+    munit_assert(sail_realloc(200, &ptr) == SAIL_OK);
+    sail_free(ptr);
+
+    munit_assert(sail_calloc(10, 10, &ptr) == SAIL_OK);
+    munit_assert(*(unsigned char*)ptr == 0);
+    sail_free(ptr);
+
+    munit_assert_uint(counting_allocator.allocations - before.allocations, ==, 2);
+    munit_assert_uint(counting_allocator.reallocations - before.reallocations, ==, 1);
+    munit_assert_uint(counting_allocator.deallocations - before.deallocations, ==, 2);
+
+    /* Incomplete allocators are rejected. */
+    const struct sail_allocator incomplete_allocator = {
+        .allocate   = counting_allocate,
+        .reallocate = NULL,
+        .deallocate = counting_deallocate,
+        .user_data  = NULL,
+    };
+
+    munit_assert(sail_set_allocator(&incomplete_allocator) == SAIL_ERROR_NULL_PTR);
+
+    return MUNIT_OK;
+}
+
+static MunitResult test_accounting(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    struct sail_memory_stats before;
+    munit_assert(sail_memory_stats(&before) == SAIL_OK);
+
+    struct sail_memory_stats stats;
+
+    void* ptr1 = NULL;
+    void* ptr2 = NULL;
+    munit_assert(sail_malloc(1000, &ptr1) == SAIL_OK);
+    munit_assert(sail_calloc(10, 50, &ptr2) == SAIL_OK);
+
+    munit_assert(sail_memory_stats(&stats) == SAIL_OK);
+    munit_assert_size(stats.current_bytes - before.current_bytes, ==, 1500);
+    munit_assert_size(stats.peak_bytes, >=, before.current_bytes + 1500);
+    munit_assert_uint64(stats.allocations - before.allocations, ==, 2);
+    munit_assert_uint64(stats.deallocations - before.deallocations, ==, 0);
+
+    /* Realloc preserves the data and accounts the size difference. */
+    memset(ptr1, 0xAB, 1000);
+    uint64_t thread_bytes = sail_thread_allocated_bytes();
+    munit_assert(sail_realloc(3000, &ptr1) == SAIL_OK);
+    munit_assert(((unsigned char*)ptr1)[999] == 0xAB);
+    munit_assert_uint64(sail_thread_allocated_bytes() - thread_bytes, ==, 2000);
+
+    munit_assert(sail_memory_stats(&stats) == SAIL_OK);
+    munit_assert_size(stats.current_bytes - before.current_bytes, ==, 3500);
+
+    /* Shrinking requests no memory. */
+    thread_bytes = sail_thread_allocated_bytes();
+    munit_assert(sail_realloc(2000, &ptr1) == SAIL_OK);
+    munit_assert(sail_realloc(3000, &ptr1) == SAIL_OK);
+    munit_assert_uint64(sail_thread_allocated_bytes() - thread_bytes, ==, 1000);
+
+    sail_reset_memory_peak();
+    munit_assert(sail_memory_stats(&stats) == SAIL_OK);
+    munit_assert_size(stats.peak_bytes, ==, stats.current_bytes);
+
+    sail_free(ptr1);
+    munit_assert(sail_memory_stats(&stats) == SAIL_OK);
+    munit_assert_size(stats.current_bytes - before.current_bytes, ==, 500);
+    munit_assert_size(stats.peak_bytes - before.current_bytes, ==, 3500);
+
+    sail_free(ptr2);
+    sail_free(NULL);
+
+    munit_assert(sail_memory_stats(&stats) == SAIL_OK);
+    munit_assert_size(stats.current_bytes, ==, before.current_bytes);
+    munit_assert_uint64(stats.allocations - before.allocations, ==, 5);
+    munit_assert_uint64(stats.deallocations - before.deallocations, ==, 2);
+
+    return MUNIT_OK;
+}
+
+static MunitResult test_late_switch(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    void* ptr = NULL;
+    munit_assert(sail_malloc(100, &ptr) == SAIL_OK);
+
+    /* The memory configuration is fixed after the first allocation. */
+    munit_assert(sail_set_memory_accounting(false) == SAIL_ERROR_CONFLICTING_OPERATION);
+    munit_assert(sail_set_memory_accounting(true) == SAIL_ERROR_CONFLICTING_OPERATION);
+    munit_assert(sail_set_allocator(NULL) == SAIL_ERROR_CONFLICTING_OPERATION);
+
+    /* The block is still freed in the mode it was allocated in. */
+    sail_free(ptr);
+
+    return MUNIT_OK;
+}
+
+static MunitResult test_scope(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    struct sail_memory_stats stats;
+
+    munit_assert(sail_begin_memory_scope(0) == SAIL_OK);
+
+    void* ptr1 = NULL;
+    void* ptr2 = NULL;
+    munit_assert(sail_malloc(1000, &ptr1) == SAIL_OK);
+    munit_assert(sail_calloc(10, 50, &ptr2) == SAIL_OK);
+    munit_assert(sail_realloc(3000, &ptr1) == SAIL_OK);
+
+    munit_assert(sail_memory_scope_stats(&stats) == SAIL_OK);
+    munit_assert_size(stats.current_bytes, ==, 3500);
+    munit_assert_size(stats.peak_bytes, ==, 3500);
+    munit_assert_uint64(stats.allocations, ==, 3);
+    munit_assert_uint64(stats.deallocations, ==, 0);
+
+    sail_free(ptr1);
+    sail_free(ptr2);
+
+    munit_assert(sail_end_memory_scope(&stats) == SAIL_OK);
+    munit_assert_size(stats.current_bytes, ==, 0);
+    munit_assert_size(stats.peak_bytes, ==, 3500);
+    munit_assert_uint64(stats.deallocations, ==, 2);
+
+    return MUNIT_OK;
+}
+
+static MunitResult test_scope_limit(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    struct sail_memory_stats stats;
+
+    munit_assert(sail_begin_memory_scope(1000) == SAIL_OK);
+
+    void* ptr1 = NULL;
+    void* ptr2 = NULL;
+    munit_assert(sail_malloc(600, &ptr1) == SAIL_OK);
+    munit_assert(sail_malloc(600, &ptr2) == SAIL_ERROR_MEMORY_ALLOCATION);
+    munit_assert(sail_calloc(60, 10, &ptr2) == SAIL_ERROR_MEMORY_ALLOCATION);
+    munit_assert_null(ptr2);
+
+    /* Reallocations are limited by the size difference. */
+    munit_assert(sail_realloc(1000, &ptr1) == SAIL_OK);
+    void* ptr1_before = ptr1;
+    munit_assert(sail_realloc(1001, &ptr1) == SAIL_ERROR_MEMORY_ALLOCATION);
+    munit_assert_ptr_equal(ptr1, ptr1_before);
+
+    munit_assert(sail_memory_scope_stats(&stats) == SAIL_OK);
+    munit_assert_size(stats.current_bytes, ==, 1000);
+
+    /* Freed memory can be allocated again. */
+    munit_assert(sail_realloc(100, &ptr1) == SAIL_OK);
+    munit_assert(sail_malloc(900, &ptr2) == SAIL_OK);
+
+    sail_free(ptr2);
+    sail_free(ptr1);
+
+    munit_assert(sail_end_memory_scope(&stats) == SAIL_OK);
+    munit_assert_size(stats.current_bytes, ==, 0);
+    munit_assert_size(stats.peak_bytes, ==, 1000);
+
+    return MUNIT_OK;
+}
+
+static MunitResult test_nested_scopes(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    struct sail_memory_stats stats;
+
+    munit_assert(sail_begin_memory_scope(0) == SAIL_OK);
+
+    void* ptr1 = NULL;
+    munit_assert(sail_malloc(100, &ptr1) == SAIL_OK);
+
+    munit_assert(sail_begin_memory_scope(0) == SAIL_OK);
+
+    void* ptr2 = NULL;
+    munit_assert(sail_malloc(200, &ptr2) == SAIL_OK);
+
+    /* The outer block doesn't belong to the inner scope. */
+    sail_free(ptr1);
+
+    munit_assert(sail_end_memory_scope(&stats) == SAIL_OK);
+    munit_assert_size(stats.current_bytes, ==, 200);
+    munit_assert_uint64(stats.deallocations, ==, 0);
+
+    /* A new inner scope doesn't own the blocks of the ended one, the outer scope does. */
+    munit_assert(sail_begin_memory_scope(0) == SAIL_OK);
+    sail_free(ptr2);
+    munit_assert(sail_end_memory_scope(&stats) == SAIL_OK);
+    munit_assert_size(stats.current_bytes, ==, 0);
+    munit_assert_uint64(stats.deallocations, ==, 0);
+
+    munit_assert(sail_end_memory_scope(&stats) == SAIL_OK);
+    munit_assert_size(stats.current_bytes, ==, 0);
+    munit_assert_size(stats.peak_bytes, ==, 300);
+    munit_assert_uint64(stats.allocations, ==, 2);
+    munit_assert_uint64(stats.deallocations, ==, 2);
+
+    /* Nesting is limited. */
+    unsigned nested = 0;
+
+    while (sail_begin_memory_scope(0) == SAIL_OK)
+    {
+        nested++;
+        munit_assert_uint(nested, <=, 8);
+    }
+
+    munit_assert_uint(nested, ==, 8);
+
+    while (nested-- > 0)
+    {
+        munit_assert(sail_end_memory_scope(NULL) == SAIL_OK);
+    }
+
+    munit_assert(sail_end_memory_scope(NULL) == SAIL_ERROR_CONFLICTING_OPERATION);
+    munit_assert(sail_memory_scope_stats(&stats) == SAIL_ERROR_CONFLICTING_OPERATION);
+
+    return MUNIT_OK;
+}
+
+static MunitResult test_scope_foreign_blocks(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    struct sail_memory_stats stats;
+
+    void* ptr1 = NULL;
+    void* ptr2 = NULL;
+    munit_assert(sail_malloc(100, &ptr1) == SAIL_OK);
+    munit_assert(sail_malloc(100, &ptr2) == SAIL_OK);
+
+    munit_assert(sail_begin_memory_scope(0) == SAIL_OK);
+
+    /* Freeing a block allocated before the scope doesn't affect it. */
+    sail_free(ptr1);
+
+    munit_assert(sail_memory_scope_stats(&stats) == SAIL_OK);
+    munit_assert_size(stats.current_bytes, ==, 0);
+    munit_assert_uint64(stats.deallocations, ==, 0);
+
+    /* Reallocating such a block makes the scope adopt it. */
+    munit_assert(sail_realloc(500, &ptr2) == SAIL_OK);
+
+    munit_assert(sail_memory_scope_stats(&stats) == SAIL_OK);
+    munit_assert_size(stats.current_bytes, ==, 500);
+
+    sail_free(ptr2);
+
+    munit_assert(sail_end_memory_scope(&stats) == SAIL_OK);
+    munit_assert_size(stats.current_bytes, ==, 0);
+    munit_assert_size(stats.peak_bytes, ==, 500);
+
+    return MUNIT_OK;
+}
+
+// clang-format off
+static MunitTest test_suite_tests[] = {
+    { (char *)"/custom-allocator",     test_custom_allocator,     NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/accounting",           test_accounting,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/late-switch",          test_late_switch,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/scope",                test_scope,                NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/scope-limit",          test_scope_limit,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/nested-scopes",        test_nested_scopes,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/scope-foreign-blocks", test_scope_foreign_blocks, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+
+    { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
+};
+
+static const MunitSuite test_suite = {
+    (char *)"/memory-accounting", test_suite_tests, NULL, 1, MUNIT_SUITE_OPTION_NONE
+};
+// clang-format on
+
+int main(int argc, char* argv[MUNIT_ARRAY_PARAM(argc + 1)])
+{
+    const struct sail_allocator allocator = {
+        .allocate   = counting_allocate,
+        .reallocate = counting_reallocate,
+        .deallocate = counting_deallocate,
+        .user_data  = &counting_allocator,
+    };
+
+    /* Must be called before any other SAIL call. */
+    if (sail_set_allocator(&allocator) != SAIL_OK || sail_set_memory_accounting(true) != SAIL_OK)
+    {
+        return 1;
+    }
+
+    return munit_suite_main(&test_suite, NULL, argc, argv);
+}
@@ -0,0 +1,247 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <sail-common/sail-common.h>
+
+#include "munit.h"
+
+#define ROWS 1000
+
+struct rows_context
+{
+    unsigned char visits[ROWS];
+
+    /* Set to fail the loop on this row. */
+    unsigned failing_row;
+    bool nested;
+};
+
+static sail_status_t visit_rows(void* context, unsigned row_begin, unsigned row_end)
+{
+    struct rows_context* rows_context = context;
+
+    for (unsigned row = row_begin; row < row_end; row++)
+    {
+        rows_context->visits[row]++;
+    }
+
+    return SAIL_OK;
+}
+
+static sail_status_t visit_rows_or_fail(void* context, unsigned row_begin, unsigned row_end)
+{
+    const struct rows_context* rows_context = context;
+
+    if (rows_context->failing_row >= row_begin && rows_context->failing_row < row_end)
+    {
+        return SAIL_ERROR_EOF;
+    }
+
+    return SAIL_OK;
+}
+
+static sail_status_t visit_rows_nested(void* context, unsigned row_begin, unsigned row_end)
+{
+    struct rows_context* rows_context = context;
+    struct rows_context nested_context;
+    memset(&nested_context, 0, sizeof(nested_context));
+
+    /* Nested loops run serially in the calling thread. */
+    SAIL_TRY(sail_parallel_for(ROWS, 0 /* max threads */, visit_rows, &nested_context));
+
+    for (unsigned row = 0; row < ROWS; row++)
+    {
+        if (nested_context.visits[row] != 1)
+        {
+            return SAIL_ERROR_INVALID_ARGUMENT;
+        }
+    }
+
+    SAIL_TRY(visit_rows(rows_context, row_begin, row_end));
+
+    return SAIL_OK;
+}
+
+static MunitResult test_all_rows(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    static const unsigned rows_list[]        = {0, 1, 2, 7, 64, ROWS};
+    static const unsigned max_threads_list[] = {0, 1, 2, 3, 64};
+
+    for (size_t i = 0; i < sizeof(rows_list) / sizeof(rows_list[0]); i++)
+    {
+        for (size_t j = 0; j < sizeof(max_threads_list) / sizeof(max_threads_list[0]); j++)
+        {
+            struct rows_context rows_context;
+            memset(&rows_context, 0, sizeof(rows_context));
+
+            munit_assert(sail_parallel_for(rows_list[i], max_threads_list[j], visit_rows, &rows_context) == SAIL_OK);
+
+            for (unsigned row = 0; row < ROWS; row++)
+            {
+                munit_assert_uint8(rows_context.visits[row], ==, row < rows_list[i] ? 1 : 0);
+            }
+        }
+    }
+
+    return MUNIT_OK;
+}
+
+static MunitResult test_nested(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    struct rows_context rows_context;
+    memset(&rows_context, 0, sizeof(rows_context));
+
+    munit_assert(sail_parallel_for(ROWS, 0 /* max threads */, visit_rows_nested, &rows_context) == SAIL_OK);
+
+    for (unsigned row = 0; row < ROWS; row++)
+    {
+        munit_assert_uint8(rows_context.visits[row], ==, 1);
+    }
+
+    return MUNIT_OK;
+}
+
+static MunitResult test_error(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    struct rows_context rows_context;
+    memset(&rows_context, 0, sizeof(rows_context));
+
+    rows_context.failing_row = ROWS - 1;
+    munit_assert(sail_parallel_for(ROWS, 0 /* max threads */, visit_rows_or_fail, &rows_context)
+                 == SAIL_ERROR_EOF);
+
+    rows_context.failing_row = 0;
+    munit_assert(sail_parallel_for(ROWS, 1 /* max threads */, visit_rows_or_fail, &rows_context)
+                 == SAIL_ERROR_EOF);
+
+    rows_context.failing_row = ROWS;
+    munit_assert(sail_parallel_for(ROWS, 0 /* max threads */, visit_rows_or_fail, &rows_context) == SAIL_OK);
+
+    munit_assert(sail_parallel_for(ROWS, 0 /* max threads */, NULL, &rows_context) == SAIL_ERROR_NULL_PTR);
+
+    return MUNIT_OK;
+}
+
+static MunitResult test_max_threads(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    const unsigned default_max_threads = sail_max_threads();
+    munit_assert_uint(default_max_threads, >=, 1);
+
+    sail_set_max_threads(3);
+    munit_assert_uint(sail_max_threads(), ==, 3);
+
+    struct rows_context rows_context;
+    memset(&rows_context, 0, sizeof(rows_context));
+
+    munit_assert(sail_parallel_for(ROWS, 8 /* max threads */, visit_rows, &rows_context) == SAIL_OK);
+
+    for (unsigned row = 0; row < ROWS; row++)
+    {
+        munit_assert_uint8(rows_context.visits[row], ==, 1);
+    }
+
+    sail_set_max_threads(0);
+    munit_assert_uint(sail_max_threads(), ==, default_max_threads);
+
+    return MUNIT_OK;
+}
+
+static sail_status_t visit_rows_and_shutdown(void* context, unsigned row_begin, unsigned row_end)
+{
+    /* Ignored in parallel loops. */
+    sail_shutdown_thread_pool();
+
+    SAIL_TRY(visit_rows(context, row_begin, row_end));
+
+    return SAIL_OK;
+}
+
+static MunitResult test_shutdown(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    sail_set_max_threads(4);
+
+    /* Shutting down starts new workers on demand, and twice in a row is fine. */
+    for (unsigned i = 0; i < 3; i++)
+    {
+        struct rows_context rows_context;
+        memset(&rows_context, 0, sizeof(rows_context));
+
+        munit_assert(sail_parallel_for(ROWS, 0 /* max threads */, i == 1 ? visit_rows_and_shutdown : visit_rows,
+                                       &rows_context)
+                     == SAIL_OK);
+
+        for (unsigned row = 0; row < ROWS; row++)
+        {
+            munit_assert_uint8(rows_context.visits[row], ==, 1);
+        }
+
+        sail_shutdown_thread_pool();
+        sail_shutdown_thread_pool();
+    }
+
+    sail_set_max_threads(0);
+
+    return MUNIT_OK;
+}
+
+// clang-format off
+static MunitTest test_suite_tests[] = {
+    { (char *)"/all-rows",    test_all_rows,    NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/nested",      test_nested,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/error",       test_error,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/max-threads", test_max_threads, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/shutdown",    test_shutdown,    NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+
+    { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
+};
+
+static const MunitSuite test_suite = {
+    (char *)"/thread-pool", test_suite_tests, NULL, 1, MUNIT_SUITE_OPTION_NONE
+};
+// clang-format on
+
+int main(int argc, char* argv[MUNIT_ARRAY_PARAM(argc + 1)])
+{
+    return munit_suite_main(&test_suite, NULL, argc, argv);
+}
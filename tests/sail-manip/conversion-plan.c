@@ -0,0 +1,222 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <string.h>
+
+#include <sail-manip/sail-manip.h>
+#include <sail/sail.h>
+
+#include "munit.h"
+
+/*
+ * Conversion plans must produce the same pixels as the one-shot conversions on every path
+ * and when reused for many images.
+ */
+
+#define WIDTH  37
+#define HEIGHT 5
+
+struct conversion
+{
+    enum SailPixelFormat input_pixel_format;
+    enum SailPixelFormat output_pixel_format;
+    int options;
+};
+
+static const struct conversion CONVERSIONS[] = {
+    /* Row kernels. */
+    {SAIL_PIXEL_FORMAT_BPP24_RGB,          SAIL_PIXEL_FORMAT_BPP8_GRAYSCALE,  0                                 },
+    {SAIL_PIXEL_FORMAT_BPP8_INDEXED,       SAIL_PIXEL_FORMAT_BPP32_BGRA,      0                                 },
+    {SAIL_PIXEL_FORMAT_BPP32_RGBA,         SAIL_PIXEL_FORMAT_BPP32_XBGR,      0                                 },
+    /* Fast paths. */
+    {SAIL_PIXEL_FORMAT_BPP24_RGB,          SAIL_PIXEL_FORMAT_BPP24_BGR,       0                                 },
+    {SAIL_PIXEL_FORMAT_BPP64_RGBA,         SAIL_PIXEL_FORMAT_BPP48_BGR,       0                                 },
+    {SAIL_PIXEL_FORMAT_BPP16_GRAYSCALE,    SAIL_PIXEL_FORMAT_BPP16_GRAYSCALE, 0                                 },
+    /* Generic path. */
+    {SAIL_PIXEL_FORMAT_BPP4_INDEXED,       SAIL_PIXEL_FORMAT_BPP24_RGB,       0                                 },
+    {SAIL_PIXEL_FORMAT_BPP48_RGB,          SAIL_PIXEL_FORMAT_BPP32_CMYK,      0                                 },
+    {SAIL_PIXEL_FORMAT_BPP32_RGBA,         SAIL_PIXEL_FORMAT_BPP24_RGB,       SAIL_CONVERSION_OPTION_BLEND_ALPHA},
+    {SAIL_PIXEL_FORMAT_BPP128_RGBA_FLOAT,  SAIL_PIXEL_FORMAT_BPP64_RGBA,      0                                 },
+};
+
+static struct sail_image* create_image(enum SailPixelFormat pixel_format)
+{
+    struct sail_image* image = NULL;
+    munit_assert_int(sail_alloc_image(&image), ==, SAIL_OK);
+
+    image->width          = WIDTH;
+    image->height         = HEIGHT;
+    image->pixel_format   = pixel_format;
+    image->bytes_per_line = sail_bytes_per_line(image->width, image->pixel_format);
+
+    munit_assert_int(sail_malloc((size_t)image->bytes_per_line * image->height, &image->pixels), ==, SAIL_OK);
+    munit_rand_memory((size_t)image->bytes_per_line * image->height, image->pixels);
+
+    if (sail_is_indexed(pixel_format))
+    {
+        /* Fewer colors than the indexes address. */
+        const unsigned color_count = (1u << sail_bits_per_pixel(pixel_format)) - 3;
+
+        munit_assert_int(sail_alloc_palette_for_data(SAIL_PIXEL_FORMAT_BPP24_RGB, color_count, &image->palette), ==,
+                         SAIL_OK);
+        munit_rand_memory((size_t)color_count * 3, image->palette->data);
+    }
+
+    /* Keep floating-point pixels finite. */
+    if (pixel_format == SAIL_PIXEL_FORMAT_BPP128_RGBA_FLOAT)
+    {
+        float* pixels = image->pixels;
+
+        for (size_t i = 0; i < (size_t)image->width * image->height * 4; i++)
+        {
+            pixels[i] = (float)munit_rand_double();
+        }
+    }
+
+    return image;
+}
+
+static MunitResult test_matches_convert(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    for (size_t i = 0; i < sizeof(CONVERSIONS) / sizeof(CONVERSIONS[0]); i++)
+    {
+        const struct conversion* conversion = &CONVERSIONS[i];
+
+        struct sail_conversion_options* options = NULL;
+        munit_assert_int(sail_alloc_conversion_options(&options), ==, SAIL_OK);
+        options->options                 = conversion->options;
+        options->background24.component1 = 10;
+        options->background24.component2 = 20;
+        options->background24.component3 = 30;
+
+        const struct sail_conversion_options reference_options = *options;
+
+        struct sail_conversion_plan* conversion_plan = NULL;
+        munit_assert_int(sail_alloc_conversion_plan(conversion->input_pixel_format, conversion->output_pixel_format,
+                                                    WIDTH, HEIGHT, options, &conversion_plan),
+                         ==, SAIL_OK);
+
+        /* The plan keeps a copy of the options. */
+        sail_destroy_conversion_options(options);
+
+        /* Reuse the plan for several images. */
+        for (unsigned frame = 0; frame < 3; frame++)
+        {
+            struct sail_image* image_input = create_image(conversion->input_pixel_format);
+
+            struct sail_image* image_expected = NULL;
+            munit_assert_int(sail_convert_image_with_options(image_input, conversion->output_pixel_format,
+                                                             &reference_options, &image_expected),
+                             ==, SAIL_OK);
+
+            struct sail_image* image_output = NULL;
+            munit_assert_int(sail_copy_image(image_expected, &image_output), ==, SAIL_OK);
+            memset(image_output->pixels, 0, (size_t)image_output->bytes_per_line * image_output->height);
+
+            munit_assert_int(sail_execute_conversion_plan(conversion_plan, image_input, image_output), ==, SAIL_OK);
+            munit_assert_memory_equal((size_t)image_output->bytes_per_line * image_output->height,
+                                      image_output->pixels, image_expected->pixels);
+
+            sail_destroy_image(image_output);
+            sail_destroy_image(image_expected);
+            sail_destroy_image(image_input);
+        }
+
+        sail_destroy_conversion_plan(conversion_plan);
+    }
+
+    return MUNIT_OK;
+}
+
+static MunitResult test_invalid(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    struct sail_conversion_plan* conversion_plan = NULL;
+
+    munit_assert_int(sail_alloc_conversion_plan(SAIL_PIXEL_FORMAT_BPP24_RGB, SAIL_PIXEL_FORMAT_BPP32_RGBA, 0, HEIGHT,
+                                                NULL, &conversion_plan),
+                     ==, SAIL_ERROR_INVALID_IMAGE_DIMENSIONS);
+    munit_assert_int(sail_alloc_conversion_plan(SAIL_PIXEL_FORMAT_BPP24_RGB, SAIL_PIXEL_FORMAT_BPP8_INDEXED, WIDTH,
+                                                HEIGHT, NULL, &conversion_plan),
+                     ==, SAIL_ERROR_UNSUPPORTED_PIXEL_FORMAT);
+    munit_assert_int(sail_alloc_conversion_plan(SAIL_PIXEL_FORMAT_BPP24_RGB, SAIL_PIXEL_FORMAT_BPP24_RGB, WIDTH, HEIGHT,
+                                                NULL, NULL),
+                     ==, SAIL_ERROR_NULL_PTR);
+    munit_assert_null(conversion_plan);
+
+    munit_assert_int(sail_alloc_conversion_plan(SAIL_PIXEL_FORMAT_BPP24_RGB, SAIL_PIXEL_FORMAT_BPP32_RGBA, WIDTH, HEIGHT,
+                                                NULL, &conversion_plan),
+                     ==, SAIL_OK);
+
+    struct sail_image* image_input = create_image(SAIL_PIXEL_FORMAT_BPP24_RGB);
+
+    struct sail_image* image_output = NULL;
+    munit_assert_int(sail_convert_image(image_input, SAIL_PIXEL_FORMAT_BPP32_RGBA, &image_output), ==, SAIL_OK);
+
+    munit_assert_int(sail_execute_conversion_plan(NULL, image_input, image_output), ==, SAIL_ERROR_NULL_PTR);
+    munit_assert_int(sail_execute_conversion_plan(conversion_plan, image_input, NULL), ==, SAIL_ERROR_NULL_PTR);
+
+    /* Wrong pixel formats. */
+    munit_assert_int(sail_execute_conversion_plan(conversion_plan, image_output, image_input), ==,
+                     SAIL_ERROR_UNSUPPORTED_PIXEL_FORMAT);
+
+    /* Wrong size. */
+    image_input->height--;
+    munit_assert_int(sail_execute_conversion_plan(conversion_plan, image_input, image_output), ==,
+                     SAIL_ERROR_INVALID_IMAGE_DIMENSIONS);
+    image_input->height++;
+
+    munit_assert_int(sail_execute_conversion_plan(conversion_plan, image_input, image_output), ==, SAIL_OK);
+
+    sail_destroy_image(image_output);
+    sail_destroy_image(image_input);
+    sail_destroy_conversion_plan(conversion_plan);
+    sail_destroy_conversion_plan(NULL);
+
+    return MUNIT_OK;
+}
+
+// clang-format off
+static MunitTest test_suite_tests[] = {
+    { (char *)"/matches-convert", test_matches_convert, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/invalid",         test_invalid,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+
+    { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
+};
+
+static const MunitSuite test_suite = {
+    (char *)"/conversion-plan", test_suite_tests, NULL, 1, MUNIT_SUITE_OPTION_NONE
+};
+// clang-format on
+
+int main(int argc, char* argv[MUNIT_ARRAY_PARAM(argc + 1)])
+{
+    return munit_suite_main(&test_suite, NULL, argc, argv);
+}
@@ -31,6 +31,40 @@
 
 #include "munit.h"
 
+/* Helper function to make a copy of the image with scan lines padded to the alignment. */
+static sail_status_t copy_to_padded_image(const struct sail_image* image,
+                                          unsigned alignment,
+                                          struct sail_image** image_output)
+{
+    struct sail_image* padded = NULL;
+    SAIL_TRY(sail_alloc_image_with_alignment(image->pixel_format, image->width, image->height, alignment, &padded));
+
+    const unsigned row_size = sail_bytes_per_line(image->width, image->pixel_format);
+
+    for (unsigned row = 0; row < image->height; row++)
+    {
+        memcpy(sail_scan_line(padded, row), sail_scan_line(image, row), row_size);
+    }
+
+    *image_output = padded;
+    return SAIL_OK;
+}
+
+/* Helper function to compare pixels of two images with possibly different strides. */
+static void assert_same_pixels(const struct sail_image* image1, const struct sail_image* image2)
+{
+    munit_assert_uint(image1->width, ==, image2->width);
+    munit_assert_uint(image1->height, ==, image2->height);
+    munit_assert_int(image1->pixel_format, ==, image2->pixel_format);
+
+    const unsigned row_size = sail_bytes_per_line(image1->width, image1->pixel_format);
+
+    for (unsigned row = 0; row < image1->height; row++)
+    {
+        munit_assert_memory_equal(row_size, sail_scan_line(image1, row), sail_scan_line(image2, row));
+    }
+}
+
 static MunitResult test_grayscale_alpha_conversion(const MunitParameter params[], void* user_data)
 {
     (void)params;
@@ -423,6 +457,120 @@ static MunitResult test_float_to_integer_conversion(const MunitParameter params[
     return MUNIT_OK;
 }
 
+static MunitResult test_padded_stride_conversion(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    /* Create a packed BPP24_RGB image with a gradient */
+    struct sail_image* packed;
+    munit_assert_int(sail_alloc_image(&packed), ==, SAIL_OK);
+
+    packed->width          = 13;
+    packed->height         = 7;
+    packed->pixel_format   = SAIL_PIXEL_FORMAT_BPP24_RGB;
+    packed->bytes_per_line = sail_bytes_per_line(packed->width, packed->pixel_format);
+
+    const size_t pixels_size = (size_t)packed->height * packed->bytes_per_line;
+    munit_assert_int(sail_malloc(pixels_size, &packed->pixels), ==, SAIL_OK);
+
+    uint8_t* pixels = packed->pixels;
+
+    for (size_t i = 0; i < pixels_size; i++)
+    {
+        pixels[i] = (uint8_t)(i * 7);
+    }
+
+    struct sail_image* padded;
+    munit_assert_int(copy_to_padded_image(packed, 64, &padded), ==, SAIL_OK);
+    munit_assert_uint(padded->bytes_per_line % 64, ==, 0);
+
+    /* Identical format, a fast path, and a generic path */
+    const enum SailPixelFormat output_pixel_formats[] = {
+        SAIL_PIXEL_FORMAT_BPP24_RGB,
+        SAIL_PIXEL_FORMAT_BPP24_BGR,
+        SAIL_PIXEL_FORMAT_BPP32_RGBA,
+        SAIL_PIXEL_FORMAT_BPP8_GRAYSCALE,
+    };
+
+    for (size_t i = 0; i < sizeof(output_pixel_formats) / sizeof(output_pixel_formats[0]); i++)
+    {
+        struct sail_image* converted_packed;
+        struct sail_image* converted_padded;
+
+        munit_assert_int(sail_convert_image(packed, output_pixel_formats[i], &converted_packed), ==, SAIL_OK);
+        munit_assert_int(sail_convert_image(padded, output_pixel_formats[i], &converted_padded), ==, SAIL_OK);
+
+        assert_same_pixels(converted_packed, converted_padded);
+
+        sail_destroy_image(converted_packed);
+        sail_destroy_image(converted_padded);
+    }
+
+    sail_destroy_image(packed);
+    sail_destroy_image(padded);
+
+    return MUNIT_OK;
+}
+
+static MunitResult test_max_threads_conversion(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    /* Tall enough to be split across several threads */
+    struct sail_image* image;
+    munit_assert_int(sail_alloc_image(&image), ==, SAIL_OK);
+
+    image->width          = 31;
+    image->height         = 257;
+    image->pixel_format   = SAIL_PIXEL_FORMAT_BPP24_RGB;
+    image->bytes_per_line = sail_bytes_per_line(image->width, image->pixel_format);
+
+    const size_t pixels_size = (size_t)image->height * image->bytes_per_line;
+    munit_assert_int(sail_malloc(pixels_size, &image->pixels), ==, SAIL_OK);
+
+    uint8_t* pixels = image->pixels;
+
+    for (size_t i = 0; i < pixels_size; i++)
+    {
+        pixels[i] = (uint8_t)(i * 13);
+    }
+
+    struct sail_conversion_options* options;
+    munit_assert_int(sail_alloc_conversion_options(&options), ==, SAIL_OK);
+
+    /* A fast path and a generic path */
+    const enum SailPixelFormat output_pixel_formats[] = {
+        SAIL_PIXEL_FORMAT_BPP32_BGRA,
+        SAIL_PIXEL_FORMAT_BPP16_GRAYSCALE,
+    };
+
+    for (size_t i = 0; i < sizeof(output_pixel_formats) / sizeof(output_pixel_formats[0]); i++)
+    {
+        struct sail_image* converted_serial;
+        struct sail_image* converted_parallel;
+
+        options->max_threads = 1;
+        munit_assert_int(sail_convert_image_with_options(image, output_pixel_formats[i], options, &converted_serial),
+                         ==, SAIL_OK);
+
+        options->max_threads = 4;
+        munit_assert_int(sail_convert_image_with_options(image, output_pixel_formats[i], options, &converted_parallel),
+                         ==, SAIL_OK);
+
+        assert_same_pixels(converted_serial, converted_parallel);
+
+        sail_destroy_image(converted_serial);
+        sail_destroy_image(converted_parallel);
+    }
+
+    sail_destroy_conversion_options(options);
+    sail_destroy_image(image);
+
+    return MUNIT_OK;
+}
+
 // clang-format off
 static MunitTest test_suite_tests[] = {
     { (char *)"/grayscale-alpha",        test_grayscale_alpha_conversion,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
@@ -436,6 +584,8 @@ static MunitTest test_suite_tests[] = {
     { (char *)"/float-grayscale",        test_float_grayscale_conversion,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
     { (char *)"/float-rgb",              test_float_rgb_conversion,              NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
     { (char *)"/float-to-integer",       test_float_to_integer_conversion,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/padded-stride",          test_padded_stride_conversion,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/max-threads",            test_max_threads_conversion,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
 
     { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
 };
@@ -71,6 +71,40 @@ static sail_status_t create_test_image(unsigned width,
     return SAIL_OK;
 }
 
+/* Helper function to make a copy of the image with scan lines padded to the alignment. */
+static sail_status_t copy_to_padded_image(const struct sail_image* image,
+                                          unsigned alignment,
+                                          struct sail_image** image_output)
+{
+    struct sail_image* padded = NULL;
+    SAIL_TRY(sail_alloc_image_with_alignment(image->pixel_format, image->width, image->height, alignment, &padded));
+
+    const unsigned row_size = sail_bytes_per_line(image->width, image->pixel_format);
+
+    for (unsigned row = 0; row < image->height; row++)
+    {
+        memcpy(sail_scan_line(padded, row), sail_scan_line(image, row), row_size);
+    }
+
+    *image_output = padded;
+    return SAIL_OK;
+}
+
+/* Helper function to compare pixels of two images with possibly different strides. */
+static void assert_same_pixels(const struct sail_image* image1, const struct sail_image* image2)
+{
+    munit_assert_uint(image1->width, ==, image2->width);
+    munit_assert_uint(image1->height, ==, image2->height);
+    munit_assert_int(image1->pixel_format, ==, image2->pixel_format);
+
+    const unsigned row_size = sail_bytes_per_line(image1->width, image1->pixel_format);
+
+    for (unsigned row = 0; row < image1->height; row++)
+    {
+        munit_assert_memory_equal(row_size, sail_scan_line(image1, row), sail_scan_line(image2, row));
+    }
+}
+
 static MunitResult test_rotate_90(const MunitParameter params[], void* user_data)
 {
     (void)params;
@@ -273,6 +307,47 @@ static MunitResult test_rotate_invalid_angle(const MunitParameter params[], void
     return MUNIT_OK;
 }
 
+static MunitResult test_rotate_padded_stride(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    const enum SailOrientation angles[] = { SAIL_ORIENTATION_ROTATED_90, SAIL_ORIENTATION_ROTATED_180,
+                                            SAIL_ORIENTATION_ROTATED_270 };
+
+    /* Odd dimensions to cover the middle row and column of the in-place rotation. */
+    struct sail_image* packed = NULL;
+    struct sail_image* padded = NULL;
+    munit_assert_int(create_test_image(5, 3, SAIL_PIXEL_FORMAT_BPP24_RGB, &packed), ==, SAIL_OK);
+    munit_assert_int(copy_to_padded_image(packed, 64, &padded), ==, SAIL_OK);
+    munit_assert_uint(padded->bytes_per_line, ==, 64);
+
+    for (size_t i = 0; i < sizeof(angles) / sizeof(angles[0]); i++)
+    {
+        struct sail_image* rotated_packed = NULL;
+        struct sail_image* rotated_padded = NULL;
+
+        munit_assert_int(sail_rotate_image(packed, angles[i], &rotated_packed), ==, SAIL_OK);
+        munit_assert_int(sail_rotate_image(padded, angles[i], &rotated_padded), ==, SAIL_OK);
+
+        assert_same_pixels(rotated_packed, rotated_padded);
+
+        sail_destroy_image(rotated_packed);
+        sail_destroy_image(rotated_padded);
+    }
+
+    struct sail_image* reference = NULL;
+    munit_assert_int(sail_rotate_image(packed, SAIL_ORIENTATION_ROTATED_180, &reference), ==, SAIL_OK);
+    munit_assert_int(sail_rotate_image_180_inplace(padded), ==, SAIL_OK);
+    assert_same_pixels(reference, padded);
+    sail_destroy_image(reference);
+
+    sail_destroy_image(packed);
+    sail_destroy_image(padded);
+
+    return MUNIT_OK;
+}
+
 // clang-format off
 static MunitTest test_suite_tests[] = {
     { (char*)"/rotate-90",            test_rotate_90,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
@@ -281,6 +356,7 @@ static MunitTest test_suite_tests[] = {
     { (char*)"/rotate-180-inplace",   test_rotate_180_inplace,   NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
     { (char*)"/rotate-with-palette",  test_rotate_with_palette,  NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
     { (char*)"/rotate-invalid-angle", test_rotate_invalid_angle, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char*)"/rotate-padded-stride", test_rotate_padded_stride, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
 
     { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
 };
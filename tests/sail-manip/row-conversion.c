@@ -0,0 +1,340 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <string.h>
+
+#include <sail-manip/sail-manip.h>
+#include <sail/sail.h>
+
+#include "munit.h"
+
+/*
+ * Conversions between 8-bit grayscale, indexed, RGB, and RGBA formats run through the row kernels
+ * selected for the CPU. Check them against per-pixel reference conversions. The widths cover
+ * every tail length of the SIMD loops.
+ */
+
+#define MAX_WIDTH 70
+#define HEIGHT    3
+
+struct layout
+{
+    enum SailPixelFormat pixel_format;
+    unsigned pixel_size;
+    /* Byte offsets of the components. Alpha and padding are negative when missing. */
+    int r, g, b, a, x;
+};
+
+static const struct layout LAYOUTS[] = {
+    {SAIL_PIXEL_FORMAT_BPP8_GRAYSCALE,        1, 0, 0, 0, -1, -1},
+    {SAIL_PIXEL_FORMAT_BPP16_GRAYSCALE_ALPHA, 2, 0, 0, 0, 1,  -1},
+    {SAIL_PIXEL_FORMAT_BPP8_INDEXED,          1, 0, 0, 0, -1, -1},
+    {SAIL_PIXEL_FORMAT_BPP24_RGB,             3, 0, 1, 2, -1, -1},
+    {SAIL_PIXEL_FORMAT_BPP24_BGR,             3, 2, 1, 0, -1, -1},
+    {SAIL_PIXEL_FORMAT_BPP32_RGBA,            4, 0, 1, 2, 3,  -1},
+    {SAIL_PIXEL_FORMAT_BPP32_BGRA,            4, 2, 1, 0, 3,  -1},
+    {SAIL_PIXEL_FORMAT_BPP32_ARGB,            4, 1, 2, 3, 0,  -1},
+    {SAIL_PIXEL_FORMAT_BPP32_ABGR,            4, 3, 2, 1, 0,  -1},
+    {SAIL_PIXEL_FORMAT_BPP32_RGBX,            4, 0, 1, 2, -1, 3 },
+    {SAIL_PIXEL_FORMAT_BPP32_BGRX,            4, 2, 1, 0, -1, 3 },
+    {SAIL_PIXEL_FORMAT_BPP32_XRGB,            4, 1, 2, 3, -1, 0 },
+    {SAIL_PIXEL_FORMAT_BPP32_XBGR,            4, 3, 2, 1, -1, 0 },
+};
+
+/* Fewer colors than an 8-bit index addresses. Indexes beyond the palette map to the first color. */
+#define PALETTE_COLORS 200
+
+static struct sail_image* create_image(const struct layout* layout, unsigned width)
+{
+    struct sail_image* image = NULL;
+    munit_assert_int(sail_alloc_image(&image), ==, SAIL_OK);
+
+    image->width          = width;
+    image->height         = HEIGHT;
+    image->pixel_format   = layout->pixel_format;
+    image->bytes_per_line = sail_bytes_per_line(image->width, image->pixel_format);
+
+    munit_assert_int(sail_malloc((size_t)image->bytes_per_line * image->height, &image->pixels), ==, SAIL_OK);
+    munit_rand_memory((size_t)image->bytes_per_line * image->height, image->pixels);
+
+    if (layout->pixel_format == SAIL_PIXEL_FORMAT_BPP8_INDEXED)
+    {
+        munit_assert_int(sail_alloc_palette_for_data(SAIL_PIXEL_FORMAT_BPP24_RGB, PALETTE_COLORS, &image->palette), ==,
+                         SAIL_OK);
+        munit_rand_memory(PALETTE_COLORS * 3, image->palette->data);
+    }
+
+    return image;
+}
+
+static void reference_unpack(const struct sail_image* image,
+                             const struct layout* layout,
+                             const uint8_t* pixel,
+                             uint8_t rgba[4])
+{
+    if (layout->pixel_format == SAIL_PIXEL_FORMAT_BPP8_INDEXED)
+    {
+        const unsigned index = (pixel[0] < PALETTE_COLORS) ? pixel[0] : 0;
+        const uint8_t* color = (const uint8_t*)image->palette->data + index * 3;
+
+        rgba[0] = color[0];
+        rgba[1] = color[1];
+        rgba[2] = color[2];
+        rgba[3] = 255;
+        return;
+    }
+
+    rgba[0] = pixel[layout->r];
+    rgba[1] = pixel[layout->g];
+    rgba[2] = pixel[layout->b];
+    rgba[3] = (layout->a >= 0) ? pixel[layout->a] : 255;
+}
+
+static void reference_pack(const struct layout* layout, const uint8_t rgba[4], uint8_t* pixel)
+{
+    switch (layout->pixel_format)
+    {
+    case SAIL_PIXEL_FORMAT_BPP8_GRAYSCALE:
+    {
+        pixel[0] = (uint8_t)((77 * rgba[0] + 150 * rgba[1] + 29 * rgba[2]) >> 8);
+        break;
+    }
+    case SAIL_PIXEL_FORMAT_BPP16_GRAYSCALE_ALPHA:
+    {
+        pixel[0] = (uint8_t)(0.299 * rgba[0] + 0.587 * rgba[1] + 0.114 * rgba[2]);
+        pixel[1] = rgba[3];
+        break;
+    }
+    default:
+    {
+        pixel[layout->r] = rgba[0];
+        pixel[layout->g] = rgba[1];
+        pixel[layout->b] = rgba[2];
+
+        if (layout->a >= 0)
+        {
+            pixel[layout->a] = rgba[3];
+        }
+        if (layout->x >= 0)
+        {
+            pixel[layout->x] = 255;
+        }
+    }
+    }
+}
+
+static void check_conversion(const struct layout* input_layout, const struct layout* output_layout, unsigned width)
+{
+    struct sail_image* image = create_image(input_layout, width);
+
+    struct sail_image* converted = NULL;
+    munit_assert_int(sail_convert_image(image, output_layout->pixel_format, &converted), ==, SAIL_OK);
+    munit_assert_int(converted->pixel_format, ==, output_layout->pixel_format);
+
+    for (unsigned row = 0; row < image->height; row++)
+    {
+        const uint8_t* scan_input  = sail_scan_line(image, row);
+        const uint8_t* scan_output = sail_scan_line(converted, row);
+
+        for (unsigned column = 0; column < width; column++)
+        {
+            uint8_t rgba[4];
+            uint8_t expected[4];
+
+            reference_unpack(image, input_layout, scan_input + column * input_layout->pixel_size, rgba);
+            reference_pack(output_layout, rgba, expected);
+
+            if (memcmp(expected, scan_output + column * output_layout->pixel_size, output_layout->pixel_size) != 0)
+            {
+                munit_errorf("%s -> %s, width %u: pixel (%u, %u) differs",
+                             sail_pixel_format_to_string(input_layout->pixel_format),
+                             sail_pixel_format_to_string(output_layout->pixel_format), width, column, row);
+            }
+        }
+    }
+
+    sail_destroy_image(converted);
+    sail_destroy_image(image);
+}
+
+static MunitResult test_row_conversion(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    const size_t layouts_count = sizeof(LAYOUTS) / sizeof(LAYOUTS[0]);
+
+    for (size_t i = 0; i < layouts_count; i++)
+    {
+        for (size_t o = 0; o < layouts_count; o++)
+        {
+            /* Converting into indexed formats quantizes the image. */
+            if (i == o || LAYOUTS[o].pixel_format == SAIL_PIXEL_FORMAT_BPP8_INDEXED)
+            {
+                continue;
+            }
+
+            for (unsigned width = 1; width <= MAX_WIDTH; width++)
+            {
+                check_conversion(&LAYOUTS[i], &LAYOUTS[o], width);
+            }
+        }
+    }
+
+    return MUNIT_OK;
+}
+
+/* Wider than a tile of the row conversion engine. */
+static MunitResult test_row_conversion_wide(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    const size_t layouts_count = sizeof(LAYOUTS) / sizeof(LAYOUTS[0]);
+
+    for (size_t i = 0; i < layouts_count; i++)
+    {
+        check_conversion(&LAYOUTS[i], &LAYOUTS[3] /* RGB24 */, 1000);
+        check_conversion(&LAYOUTS[i], &LAYOUTS[0] /* GRAY8 */, 1000);
+    }
+
+    return MUNIT_OK;
+}
+
+/* Blending into formats without alpha still blends with the background. */
+static MunitResult test_row_conversion_blend_alpha(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    struct sail_image* image = create_image(&LAYOUTS[5] /* RGBA32 */, 16);
+
+    uint8_t* pixels = image->pixels;
+    pixels[0]       = 255;
+    pixels[1]       = 255;
+    pixels[2]       = 255;
+    pixels[3]       = 0;
+
+    struct sail_conversion_options options = {
+        .options      = SAIL_CONVERSION_OPTION_BLEND_ALPHA,
+        .background48 = {0, 0, 0},
+        .background24 = {0, 0, 0},
+    };
+
+    struct sail_image* converted = NULL;
+    munit_assert_int(sail_convert_image_with_options(image, SAIL_PIXEL_FORMAT_BPP24_RGB, &options, &converted), ==,
+                     SAIL_OK);
+
+    const uint8_t* converted_pixels = converted->pixels;
+    munit_assert_uint8(converted_pixels[0], ==, 0);
+    munit_assert_uint8(converted_pixels[1], ==, 0);
+    munit_assert_uint8(converted_pixels[2], ==, 0);
+
+    sail_destroy_image(converted);
+    sail_destroy_image(image);
+
+    return MUNIT_OK;
+}
+
+/* The per-pixel path fills padding the same way the row kernels do. */
+static MunitResult test_row_conversion_padding(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    struct sail_image* image = NULL;
+    munit_assert_int(sail_alloc_image(&image), ==, SAIL_OK);
+
+    image->width          = 16;
+    image->height         = HEIGHT;
+    image->pixel_format   = SAIL_PIXEL_FORMAT_BPP48_RGB;
+    image->bytes_per_line = sail_bytes_per_line(image->width, image->pixel_format);
+
+    munit_assert_int(sail_malloc((size_t)image->bytes_per_line * image->height, &image->pixels), ==, SAIL_OK);
+    munit_rand_memory((size_t)image->bytes_per_line * image->height, image->pixels);
+
+    const size_t layouts_count = sizeof(LAYOUTS) / sizeof(LAYOUTS[0]);
+
+    for (size_t o = 0; o < layouts_count; o++)
+    {
+        if (LAYOUTS[o].x < 0)
+        {
+            continue;
+        }
+
+        struct sail_image* converted = NULL;
+        munit_assert_int(sail_convert_image(image, LAYOUTS[o].pixel_format, &converted), ==, SAIL_OK);
+
+        for (unsigned row = 0; row < converted->height; row++)
+        {
+            const uint8_t* scan = sail_scan_line(converted, row);
+
+            for (unsigned column = 0; column < converted->width; column++)
+            {
+                munit_assert_uint8(scan[column * LAYOUTS[o].pixel_size + LAYOUTS[o].x], ==, 255);
+            }
+        }
+
+        sail_destroy_image(converted);
+    }
+
+    struct sail_image* converted = NULL;
+    munit_assert_int(sail_convert_image(image, SAIL_PIXEL_FORMAT_BPP64_XRGB, &converted), ==, SAIL_OK);
+
+    for (unsigned row = 0; row < converted->height; row++)
+    {
+        const uint16_t* scan = sail_scan_line(converted, row);
+
+        for (unsigned column = 0; column < converted->width; column++)
+        {
+            munit_assert_uint16(scan[column * 4], ==, 65535);
+        }
+    }
+
+    sail_destroy_image(converted);
+    sail_destroy_image(image);
+
+    return MUNIT_OK;
+}
+
+// clang-format off
+static MunitTest test_suite_tests[] = {
+    { (char *)"/blend-alpha", test_row_conversion_blend_alpha, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/formats",     test_row_conversion,             NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/padding",     test_row_conversion_padding,     NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/wide",        test_row_conversion_wide,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+
+    { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
+};
+
+static const MunitSuite test_suite = {
+    (char *)"/row-conversion", test_suite_tests, NULL, 1, MUNIT_SUITE_OPTION_NONE
+};
+// clang-format on
+
+int main(int argc, char* argv[MUNIT_ARRAY_PARAM(argc + 1)])
+{
+    return munit_suite_main(&test_suite, NULL, argc, argv);
+}
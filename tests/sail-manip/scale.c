@@ -70,6 +70,40 @@ static sail_status_t create_test_image(unsigned width,
     return SAIL_OK;
 }
 
+/* Helper function to make a copy of the image with scan lines padded to the alignment. */
+static sail_status_t copy_to_padded_image(const struct sail_image* image,
+                                          unsigned alignment,
+                                          struct sail_image** image_output)
+{
+    struct sail_image* padded = NULL;
+    SAIL_TRY(sail_alloc_image_with_alignment(image->pixel_format, image->width, image->height, alignment, &padded));
+
+    const unsigned row_size = sail_bytes_per_line(image->width, image->pixel_format);
+
+    for (unsigned row = 0; row < image->height; row++)
+    {
+        memcpy(sail_scan_line(padded, row), sail_scan_line(image, row), row_size);
+    }
+
+    *image_output = padded;
+    return SAIL_OK;
+}
+
+/* Helper function to compare pixels of two images with possibly different strides. */
+static void assert_same_pixels(const struct sail_image* image1, const struct sail_image* image2)
+{
+    munit_assert_uint(image1->width, ==, image2->width);
+    munit_assert_uint(image1->height, ==, image2->height);
+    munit_assert_int(image1->pixel_format, ==, image2->pixel_format);
+
+    const unsigned row_size = sail_bytes_per_line(image1->width, image1->pixel_format);
+
+    for (unsigned row = 0; row < image1->height; row++)
+    {
+        munit_assert_memory_equal(row_size, sail_scan_line(image1, row), sail_scan_line(image2, row));
+    }
+}
+
 static MunitResult test_scale_down(const MunitParameter params[], void* user_data)
 {
     (void)params;
@@ -372,6 +406,46 @@ static MunitResult test_scale_invalid_dimensions(const MunitParameter params[],
     return MUNIT_OK;
 }
 
+static MunitResult test_scale_padded_stride(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    struct sail_image* packed = NULL;
+    struct sail_image* padded = NULL;
+
+    munit_assert_int(create_test_image(37, 21, SAIL_PIXEL_FORMAT_BPP24_RGB, &packed), ==, SAIL_OK);
+    munit_assert_int(copy_to_padded_image(packed, 64, &padded), ==, SAIL_OK);
+    munit_assert_uint(padded->bytes_per_line % 64, ==, 0);
+
+    /* Scaling must skip the padding and produce the same pixels for both strides. */
+    enum SailScaling algorithms[] = {
+        SAIL_SCALING_NEAREST_NEIGHBOR,
+        SAIL_SCALING_BILINEAR,
+        SAIL_SCALING_BICUBIC,
+        SAIL_SCALING_LANCZOS
+    };
+
+    for (unsigned i = 0; i < sizeof(algorithms) / sizeof(algorithms[0]); i++)
+    {
+        struct sail_image* scaled_packed = NULL;
+        struct sail_image* scaled_padded = NULL;
+
+        munit_assert_int(sail_scale_image(packed, 19, 30, algorithms[i], &scaled_packed), ==, SAIL_OK);
+        munit_assert_int(sail_scale_image(padded, 19, 30, algorithms[i], &scaled_padded), ==, SAIL_OK);
+
+        assert_same_pixels(scaled_packed, scaled_padded);
+
+        sail_destroy_image(scaled_packed);
+        sail_destroy_image(scaled_padded);
+    }
+
+    sail_destroy_image(packed);
+    sail_destroy_image(padded);
+
+    return MUNIT_OK;
+}
+
 // clang-format off
 static MunitTest test_suite_tests[] = {
     { (char*)"/scale-down",                 test_scale_down,                 NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
@@ -382,6 +456,7 @@ static MunitTest test_suite_tests[] = {
     { (char*)"/scale-with-palette",         test_scale_with_palette,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
     { (char*)"/scale-with-iccp",            test_scale_with_iccp,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
     { (char*)"/scale-invalid-dimensions",   test_scale_invalid_dimensions,   NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char*)"/scale-padded-stride",        test_scale_padded_stride,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
 
     { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
 };
@@ -23,6 +23,7 @@
     SOFTWARE.
 */
 
+#include <stdint.h>
 #include <stdio.h>
 #include <string.h>
 
@@ -109,6 +110,137 @@ static MunitResult test_advanced_load_from_memory(const MunitParameter params[],
     return MUNIT_OK;
 }
 
+static MunitResult test_advanced_load_next_frame_into(const MunitParameter params[], void* user_data)
+{
+    (void)user_data;
+
+    const char* path = munit_parameters_get(params, "path");
+
+    /* Reference frame. */
+    void* state = NULL;
+    munit_assert(sail_start_loading_from_file(path, NULL, &state) == SAIL_OK);
+
+    struct sail_image* reference = NULL;
+    munit_assert(sail_load_next_frame(state, &reference) == SAIL_OK);
+    munit_assert(sail_stop_loading(state) == SAIL_OK);
+
+    /* Padded caller buffer. */
+    const unsigned bytes_per_line = reference->bytes_per_line + 16;
+    const size_t pixels_size      = (size_t)bytes_per_line * reference->height;
+
+    void* pixels;
+    munit_assert(sail_malloc(pixels_size, &pixels) == SAIL_OK);
+
+    state = NULL;
+    munit_assert(sail_start_loading_from_file(path, NULL, &state) == SAIL_OK);
+
+    struct sail_image* image = NULL;
+    munit_assert(sail_load_next_frame_into(state, pixels, pixels_size, bytes_per_line, &image) == SAIL_OK);
+    munit_assert(sail_stop_loading(state) == SAIL_OK);
+
+    munit_assert(image->pixels == pixels);
+    munit_assert(image->bytes_per_line == bytes_per_line);
+    munit_assert(image->width == reference->width);
+    munit_assert(image->height == reference->height);
+    munit_assert(image->pixel_format == reference->pixel_format);
+
+    for (unsigned row = 0; row < image->height; row++)
+    {
+        munit_assert_memory_equal(reference->bytes_per_line, sail_scan_line(image, row),
+                                  sail_scan_line(reference, row));
+    }
+
+    image->pixels = NULL;
+    sail_destroy_image(image);
+
+    /* Too small buffer. */
+    state = NULL;
+    munit_assert(sail_start_loading_from_file(path, NULL, &state) == SAIL_OK);
+    munit_assert(sail_load_next_frame_into(state, pixels, pixels_size - 1, bytes_per_line, &image)
+                 == SAIL_ERROR_INVALID_ARGUMENT);
+    munit_assert(sail_stop_loading(state) == SAIL_OK);
+
+    /* Too small stride. 0 means the frame stride. */
+    if (reference->bytes_per_line > 1)
+    {
+        state = NULL;
+        munit_assert(sail_start_loading_from_file(path, NULL, &state) == SAIL_OK);
+        munit_assert(sail_load_next_frame_into(state, pixels, pixels_size, reference->bytes_per_line - 1, &image)
+                     == SAIL_ERROR_INVALID_BYTES_PER_LINE);
+        munit_assert(sail_stop_loading(state) == SAIL_OK);
+    }
+
+    sail_free(pixels);
+    sail_destroy_image(reference);
+
+    return MUNIT_OK;
+}
+
+static MunitResult test_advanced_load_aligned(const MunitParameter params[], void* user_data)
+{
+    (void)user_data;
+
+    const char* path = munit_parameters_get(params, "path");
+
+    /* Reference frame. */
+    void* state = NULL;
+    munit_assert(sail_start_loading_from_file(path, NULL, &state) == SAIL_OK);
+
+    struct sail_image* reference = NULL;
+    munit_assert(sail_load_next_frame(state, &reference) == SAIL_OK);
+    munit_assert(sail_stop_loading(state) == SAIL_OK);
+
+    const struct sail_codec_info* codec_info;
+    munit_assert(sail_codec_info_from_path(path, &codec_info) == SAIL_OK);
+
+    struct sail_load_options* load_options;
+    munit_assert(sail_alloc_load_options_from_features(codec_info->load_features, &load_options) == SAIL_OK);
+    load_options->pixels_alignment = 64;
+
+    state = NULL;
+    munit_assert(sail_start_loading_from_file_with_options(path, NULL, load_options, &state) == SAIL_OK);
+    sail_destroy_load_options(load_options);
+
+    struct sail_image* image = NULL;
+    munit_assert(sail_load_next_frame(state, &image) == SAIL_OK);
+    munit_assert(sail_stop_loading(state) == SAIL_OK);
+
+    munit_assert(image->pixels_alignment == 64);
+    munit_assert((uintptr_t)image->pixels % 64 == 0);
+    munit_assert(image->bytes_per_line % 64 == 0);
+    munit_assert(image->bytes_per_line >= reference->bytes_per_line);
+    munit_assert(image->width == reference->width);
+    munit_assert(image->height == reference->height);
+    munit_assert(image->pixel_format == reference->pixel_format);
+
+    for (unsigned row = 0; row < image->height; row++)
+    {
+        munit_assert_memory_equal(reference->bytes_per_line, sail_scan_line(image, row),
+                                  sail_scan_line(reference, row));
+    }
+
+    sail_destroy_image(image);
+
+    /* The default alignment applies when the load options don't override it. */
+    munit_assert(sail_set_default_pixels_alignment(32) == SAIL_OK);
+
+    state = NULL;
+    munit_assert(sail_start_loading_from_file(path, NULL, &state) == SAIL_OK);
+    munit_assert(sail_load_next_frame(state, &image) == SAIL_OK);
+    munit_assert(sail_stop_loading(state) == SAIL_OK);
+
+    munit_assert(sail_set_default_pixels_alignment(0) == SAIL_OK);
+
+    munit_assert(image->pixels_alignment == 32);
+    munit_assert((uintptr_t)image->pixels % 32 == 0);
+    munit_assert(image->bytes_per_line % 32 == 0);
+
+    sail_destroy_image(image);
+    sail_destroy_image(reference);
+
+    return MUNIT_OK;
+}
+
 /* Test that attempting to load after EOF returns SAIL_ERROR_NO_MORE_FRAMES or succeeds for multi-frame */
 static MunitResult test_advanced_load_no_more_frames(const MunitParameter params[], void* user_data)
 {
@@ -554,6 +686,80 @@ static MunitResult test_advanced_probe_io_with_options(const MunitParameter para
     return MUNIT_OK;
 }
 
+/* Test that magic number detection finds the same codec as the file extension. */
+static MunitResult test_advanced_codec_info_by_magic_number(const MunitParameter params[], void* user_data)
+{
+    (void)user_data;
+
+    const char* path = munit_parameters_get(params, "path");
+
+    const struct sail_codec_info* codec_info_from_path = NULL;
+    munit_assert(sail_codec_info_from_path(path, &codec_info_from_path) == SAIL_OK);
+
+    /* Some formats have no magic numbers. */
+    if (codec_info_from_path->magic_number_node == NULL)
+    {
+        return MUNIT_SKIP;
+    }
+
+    const struct sail_codec_info* codec_info_from_magic = NULL;
+    munit_assert(sail_codec_info_by_magic_number_from_path(path, &codec_info_from_magic) == SAIL_OK);
+    munit_assert_ptr_equal(codec_info_from_magic, codec_info_from_path);
+
+    return MUNIT_OK;
+}
+
+/* Test that codec info lookups by extension, MIME type, and name are case-insensitive. */
+static MunitResult test_advanced_codec_info_lookups(const MunitParameter params[], void* user_data)
+{
+    (void)user_data;
+
+    const char* path = munit_parameters_get(params, "path");
+
+    const struct sail_codec_info* codec_info = NULL;
+    munit_assert(sail_codec_info_from_path(path, &codec_info) == SAIL_OK);
+
+    const struct sail_codec_info* found_codec_info = NULL;
+
+    /* Name. */
+    char* name;
+    munit_assert(sail_strdup(codec_info->name, &name) == SAIL_OK);
+    sail_to_lower(name);
+    munit_assert(sail_codec_info_from_name(name, &found_codec_info) == SAIL_OK);
+    munit_assert_ptr_equal(found_codec_info, codec_info);
+    sail_free(name);
+
+    /* Extensions. Shared extensions resolve to the codec with a higher priority. */
+    for (const struct sail_string_node* node = codec_info->extension_node; node != NULL; node = node->next)
+    {
+        char* extension;
+        munit_assert(sail_concat(&extension, 2, ".", node->string) == SAIL_OK);
+        sail_to_upper(extension);
+
+        munit_assert(sail_codec_info_from_extension(extension, &found_codec_info) == SAIL_OK);
+        munit_assert_int(found_codec_info->priority, <=, codec_info->priority);
+        sail_free(extension);
+    }
+
+    /* MIME types. */
+    for (const struct sail_string_node* node = codec_info->mime_type_node; node != NULL; node = node->next)
+    {
+        char* mime_type;
+        munit_assert(sail_strdup(node->string, &mime_type) == SAIL_OK);
+        sail_to_upper(mime_type);
+
+        munit_assert(sail_codec_info_from_mime_type(mime_type, &found_codec_info) == SAIL_OK);
+        munit_assert_int(found_codec_info->priority, <=, codec_info->priority);
+        sail_free(mime_type);
+    }
+
+    munit_assert(sail_codec_info_from_extension("no-such-extension", &found_codec_info) == SAIL_ERROR_CODEC_NOT_FOUND);
+    munit_assert(sail_codec_info_from_mime_type("image/no-such-type", &found_codec_info)
+                 == SAIL_ERROR_CODEC_NOT_FOUND);
+
+    return MUNIT_OK;
+}
+
 // clang-format off
 static MunitParameterEnum test_params[] = {
     { (char *)"path", (char **)SAIL_TEST_IMAGES },
@@ -564,6 +770,8 @@ static MunitTest test_suite_tests[] = {
     { (char *)"/load-single-frame-from-file", test_advanced_load_single_frame_from_file, NULL, NULL, MUNIT_TEST_OPTION_NONE, test_params },
     { (char *)"/load-with-codec-info",        test_advanced_load_with_codec_info,        NULL, NULL, MUNIT_TEST_OPTION_NONE, test_params },
     { (char *)"/load-from-memory",            test_advanced_load_from_memory,            NULL, NULL, MUNIT_TEST_OPTION_NONE, test_params },
+    { (char *)"/load-next-frame-into",        test_advanced_load_next_frame_into,        NULL, NULL, MUNIT_TEST_OPTION_NONE, test_params },
+    { (char *)"/load-aligned",                test_advanced_load_aligned,                NULL, NULL, MUNIT_TEST_OPTION_NONE, test_params },
     { (char *)"/load-no-more-frames",         test_advanced_load_no_more_frames,         NULL, NULL, MUNIT_TEST_OPTION_NONE, test_params },
     { (char *)"/early-stop-loading",          test_advanced_early_stop_loading,          NULL, NULL, MUNIT_TEST_OPTION_NONE, test_params },
     { (char *)"/stop-loading-null",           test_advanced_stop_loading_null,           NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
@@ -574,6 +782,8 @@ static MunitTest test_suite_tests[] = {
     { (char *)"/roundtrip",                   test_advanced_roundtrip,                   NULL, NULL, MUNIT_TEST_OPTION_NONE, test_params },
     { (char *)"/probe-then-load-from-io",     test_advanced_probe_then_load_from_io,     NULL, NULL, MUNIT_TEST_OPTION_NONE, test_params },
     { (char *)"/probe-io-with-options",       test_advanced_probe_io_with_options,       NULL, NULL, MUNIT_TEST_OPTION_NONE, test_params },
+    { (char *)"/codec-info-by-magic-number",  test_advanced_codec_info_by_magic_number,  NULL, NULL, MUNIT_TEST_OPTION_NONE, test_params },
+    { (char *)"/codec-info-lookups",          test_advanced_codec_info_lookups,          NULL, NULL, MUNIT_TEST_OPTION_NONE, test_params },
 
     { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
 };
@@ -0,0 +1,343 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <sail/sail.h>
+
+#include "munit.h"
+
+#include "tests/images/acceptance/test-images.h"
+
+#define TEST_DATA_SIZE 1000
+#define TEST_CAPACITY  64
+
+static void fill_test_data(unsigned char* data)
+{
+    for (unsigned i = 0; i < TEST_DATA_SIZE; i++)
+    {
+        data[i] = (unsigned char)(i * 7 + 3);
+    }
+}
+
+static MunitResult test_get_peek(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    unsigned char data[TEST_DATA_SIZE];
+    fill_test_data(data);
+
+    struct sail_io* io;
+    munit_assert(sail_alloc_io_read_memory(data, sizeof(data), &io) == SAIL_OK);
+
+    struct sail_buffered_reader* reader;
+    munit_assert(sail_alloc_buffered_reader(io, TEST_CAPACITY, &reader) == SAIL_OK);
+
+    for (unsigned i = 0; i < TEST_DATA_SIZE; i++)
+    {
+        unsigned char byte;
+        munit_assert(sail_buffered_reader_peek_byte(reader, &byte) == SAIL_OK);
+        munit_assert_uint8(byte, ==, data[i]);
+        munit_assert(sail_buffered_reader_get_byte(reader, &byte) == SAIL_OK);
+        munit_assert_uint8(byte, ==, data[i]);
+    }
+
+    bool eof;
+    munit_assert(sail_buffered_reader_eof(reader, &eof) == SAIL_OK);
+    munit_assert(eof);
+
+    unsigned char byte;
+    munit_assert(sail_buffered_reader_get_byte(reader, &byte) == SAIL_ERROR_EOF);
+
+    sail_destroy_buffered_reader(reader);
+    sail_destroy_io(io);
+
+    return MUNIT_OK;
+}
+
+static MunitResult test_read(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    unsigned char data[TEST_DATA_SIZE];
+    fill_test_data(data);
+
+    struct sail_io* io;
+    munit_assert(sail_alloc_io_read_memory(data, sizeof(data), &io) == SAIL_OK);
+
+    struct sail_buffered_reader* reader;
+    munit_assert(sail_alloc_buffered_reader(io, TEST_CAPACITY, &reader) == SAIL_OK);
+
+    unsigned char buffer[TEST_DATA_SIZE];
+
+    /* Small read, a read crossing the buffer boundary, and a read bypassing the buffer. */
+    munit_assert(sail_buffered_reader_read(reader, buffer, 10) == SAIL_OK);
+    munit_assert(sail_buffered_reader_read(reader, buffer + 10, TEST_CAPACITY) == SAIL_OK);
+    munit_assert(sail_buffered_reader_read(reader, buffer + 10 + TEST_CAPACITY, TEST_CAPACITY * 4) == SAIL_OK);
+
+    const size_t total = 10 + TEST_CAPACITY * 5;
+    munit_assert_memory_equal(total, buffer, data);
+
+    size_t offset;
+    munit_assert(sail_buffered_reader_tell(reader, &offset) == SAIL_OK);
+    munit_assert_size(offset, ==, total);
+
+    /* Not enough data. */
+    munit_assert(sail_buffered_reader_read(reader, buffer, TEST_DATA_SIZE) != SAIL_OK);
+
+    sail_destroy_buffered_reader(reader);
+    sail_destroy_io(io);
+
+    return MUNIT_OK;
+}
+
+static MunitResult test_seek_tell_sync(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    unsigned char data[TEST_DATA_SIZE];
+    fill_test_data(data);
+
+    struct sail_io* io;
+    munit_assert(sail_alloc_io_read_memory(data, sizeof(data), &io) == SAIL_OK);
+
+    struct sail_buffered_reader* reader;
+    munit_assert(sail_alloc_buffered_reader(io, TEST_CAPACITY, &reader) == SAIL_OK);
+
+    unsigned char byte;
+    size_t offset;
+
+    /* Seek within the buffered data. */
+    munit_assert(sail_buffered_reader_get_byte(reader, &byte) == SAIL_OK);
+    munit_assert(sail_buffered_reader_seek(reader, 20, SEEK_CUR) == SAIL_OK);
+    munit_assert(sail_buffered_reader_get_byte(reader, &byte) == SAIL_OK);
+    munit_assert_uint8(byte, ==, data[21]);
+    munit_assert(sail_buffered_reader_seek(reader, -4, SEEK_CUR) == SAIL_OK);
+    munit_assert(sail_buffered_reader_get_byte(reader, &byte) == SAIL_OK);
+    munit_assert_uint8(byte, ==, data[18]);
+
+    /* Seek outside of the buffered data. */
+    munit_assert(sail_buffered_reader_seek(reader, 500, SEEK_CUR) == SAIL_OK);
+    munit_assert(sail_buffered_reader_tell(reader, &offset) == SAIL_OK);
+    munit_assert_size(offset, ==, 519);
+    munit_assert(sail_buffered_reader_get_byte(reader, &byte) == SAIL_OK);
+    munit_assert_uint8(byte, ==, data[519]);
+
+    munit_assert(sail_buffered_reader_seek(reader, 100, SEEK_SET) == SAIL_OK);
+    munit_assert(sail_buffered_reader_get_byte(reader, &byte) == SAIL_OK);
+    munit_assert_uint8(byte, ==, data[100]);
+
+    munit_assert(sail_buffered_reader_seek(reader, -1, SEEK_END) == SAIL_OK);
+    munit_assert(sail_buffered_reader_get_byte(reader, &byte) == SAIL_OK);
+    munit_assert_uint8(byte, ==, data[TEST_DATA_SIZE - 1]);
+
+    /* Sync moves the I/O object back to the reader position. */
+    munit_assert(sail_buffered_reader_seek(reader, 300, SEEK_SET) == SAIL_OK);
+    munit_assert(sail_buffered_reader_get_byte(reader, &byte) == SAIL_OK);
+    munit_assert(sail_buffered_reader_sync(reader) == SAIL_OK);
+
+    munit_assert(io->tell(io->stream, &offset) == SAIL_OK);
+    munit_assert_size(offset, ==, 301);
+    munit_assert(io->strict_read(io->stream, &byte, 1) == SAIL_OK);
+    munit_assert_uint8(byte, ==, data[301]);
+
+    sail_destroy_buffered_reader(reader);
+    sail_destroy_io(io);
+
+    return MUNIT_OK;
+}
+
+static sail_status_t failing_seek(void* stream, long offset, int whence)
+{
+    (void)stream;
+    (void)offset;
+    (void)whence;
+
+    return SAIL_ERROR_NOT_IMPLEMENTED;
+}
+
+/* Turns a memory I/O object into one that behaves like a pipe. */
+static void make_non_seekable(struct sail_io* io)
+{
+    io->features = 0;
+    io->seek     = failing_seek;
+}
+
+static MunitResult test_non_seekable(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    unsigned char data[TEST_DATA_SIZE];
+    fill_test_data(data);
+
+    struct sail_io* io;
+    munit_assert(sail_alloc_io_read_memory(data, sizeof(data), &io) == SAIL_OK);
+    make_non_seekable(io);
+
+    struct sail_buffered_reader* reader;
+    munit_assert(sail_alloc_buffered_reader(io, TEST_CAPACITY, &reader) == SAIL_OK);
+
+    unsigned char byte;
+
+    /* Forward seeks past the buffered data skip by reading. */
+    munit_assert(sail_buffered_reader_get_byte(reader, &byte) == SAIL_OK);
+    munit_assert(sail_buffered_reader_seek(reader, 500, SEEK_CUR) == SAIL_OK);
+    munit_assert(sail_buffered_reader_get_byte(reader, &byte) == SAIL_OK);
+    munit_assert_uint8(byte, ==, data[501]);
+
+    /* Backward seeks within the buffered data still work. */
+    munit_assert(sail_buffered_reader_seek(reader, -2, SEEK_CUR) == SAIL_OK);
+    munit_assert(sail_buffered_reader_get_byte(reader, &byte) == SAIL_OK);
+    munit_assert_uint8(byte, ==, data[500]);
+
+    /* The read-ahead cannot be given back. */
+    munit_assert(sail_buffered_reader_sync(reader) == SAIL_ERROR_NOT_IMPLEMENTED);
+
+    munit_assert(sail_buffered_reader_seek(reader, 10000, SEEK_CUR) == SAIL_ERROR_EOF);
+
+    sail_destroy_buffered_reader(reader);
+    sail_destroy_io(io);
+
+    return MUNIT_OK;
+}
+
+static bool is_stream_parsed_image(const char* path)
+{
+    static const char* const suffixes[] = {".hdr", ".pbm", ".pgm", ".pnm", ".ppm", ".pam"};
+
+    const size_t length = strlen(path);
+
+    for (size_t i = 0; i < sizeof(suffixes) / sizeof(suffixes[0]); i++)
+    {
+        const size_t suffix_length = strlen(suffixes[i]);
+
+        if (length > suffix_length && strcmp(path + length - suffix_length, suffixes[i]) == 0)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/* The codecs that parse their input through the buffered reader must not need a seekable I/O object. */
+static MunitResult test_decode_non_seekable(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    for (size_t i = 0; SAIL_TEST_IMAGES[i] != NULL; i++)
+    {
+        const char* path = SAIL_TEST_IMAGES[i];
+
+        if (!is_stream_parsed_image(path))
+        {
+            continue;
+        }
+
+        const struct sail_codec_info* codec_info;
+        munit_assert(sail_codec_info_from_path(path, &codec_info) == SAIL_OK);
+
+        void* data;
+        size_t data_size;
+        munit_assert(sail_alloc_data_from_file_contents(path, &data, &data_size) == SAIL_OK);
+
+        struct sail_image* expected_image;
+        munit_assert(sail_load_from_memory(data, data_size, &expected_image) == SAIL_OK);
+
+        struct sail_io* io;
+        munit_assert(sail_alloc_io_read_memory(data, data_size, &io) == SAIL_OK);
+        make_non_seekable(io);
+
+        void* state = NULL;
+        munit_assert(sail_start_loading_from_io(io, codec_info, &state) == SAIL_OK);
+
+        struct sail_image* image;
+        munit_assert(sail_load_next_frame(state, &image) == SAIL_OK);
+        munit_assert(sail_stop_loading(state) == SAIL_OK);
+
+        size_t pixels_size;
+        munit_assert(sail_pixels_buffer_size(image->height, image->bytes_per_line, &pixels_size) == SAIL_OK);
+        munit_assert_uint(image->width, ==, expected_image->width);
+        munit_assert_uint(image->height, ==, expected_image->height);
+        munit_assert_memory_equal(pixels_size, image->pixels, expected_image->pixels);
+
+        sail_destroy_image(image);
+        sail_destroy_image(expected_image);
+        sail_destroy_io(io);
+        sail_free(data);
+    }
+
+    return MUNIT_OK;
+}
+
+/* The last sample must be read completely even without a trailing delimiter. */
+static MunitResult test_pnm_sample_at_eof(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    static const char PGM[] = "P2\n2 1\n255\n10 255";
+
+    struct sail_image* image;
+    munit_assert(sail_load_from_memory(PGM, strlen(PGM), &image) == SAIL_OK);
+
+    const unsigned char* pixels = image->pixels;
+    munit_assert_uint(image->width, ==, 2);
+    munit_assert_uint8(pixels[0], ==, 10);
+    munit_assert_uint8(pixels[1], ==, 255);
+
+    sail_destroy_image(image);
+
+    return MUNIT_OK;
+}
+
+// clang-format off
+static MunitTest test_suite_tests[] = {
+    { (char *)"/get-peek",            test_get_peek,            NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/read",                test_read,                NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/seek-tell-sync",      test_seek_tell_sync,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/non-seekable",        test_non_seekable,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/decode-non-seekable", test_decode_non_seekable, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/pnm-sample-at-eof",   test_pnm_sample_at_eof,   NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+
+    { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
+};
+
+static const MunitSuite test_suite = {
+    (char *)"/buffered-reader", test_suite_tests, NULL, 1, MUNIT_SUITE_OPTION_NONE
+};
+// clang-format on
+
+int main(int argc, char* argv[MUNIT_ARRAY_PARAM(argc + 1)])
+{
+    return munit_suite_main(&test_suite, NULL, argc, argv);
+}
@@ -0,0 +1,293 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <sail/sail.h>
+
+#include "munit.h"
+
+#ifndef SAIL_COMBINE_CODECS
+#define MAX_CODECS 128
+
+/* Collects codec names in the priority order. */
+static unsigned collect_codec_names(const char* names[MAX_CODECS])
+{
+    unsigned count = 0;
+
+    const struct sail_codec_bundle_node* node = sail_codec_bundle_list();
+
+    for (; node != NULL && count < MAX_CODECS; node = node->next)
+    {
+        names[count++] = node->codec_bundle->codec_info->name;
+    }
+
+    return count;
+}
+#endif
+
+static MunitResult test_codecs_cache_cold_and_warm(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+#ifdef SAIL_COMBINE_CODECS
+    return MUNIT_SKIP;
+#else
+    const char* cache_path = getenv("SAIL_CODECS_CACHE_PATH");
+
+    if (cache_path == NULL)
+    {
+        return MUNIT_SKIP;
+    }
+
+    /* The cache directory is missing on a fresh system and must be created. */
+    remove(cache_path);
+
+    char* cache_dir;
+    munit_assert(sail_strdup(cache_path, &cache_dir) == SAIL_OK);
+    char* separator = strrchr(cache_dir, '/');
+    munit_assert_not_null(separator);
+    *separator = '\0';
+    remove(cache_dir);
+
+    /* Cold start: reads codec info files and writes the cache. */
+    sail_finish();
+
+    uint64_t start_time = sail_now();
+    munit_assert(sail_init_with_flags(SAIL_FLAG_CACHE_CODECS_INFO) == SAIL_OK);
+    const uint64_t cold_time = sail_now() - start_time;
+
+    munit_assert(sail_is_dir(cache_dir));
+    munit_assert(sail_is_file(cache_path));
+    sail_free(cache_dir);
+
+    char* cold_names[MAX_CODECS];
+    const char* names[MAX_CODECS];
+    const unsigned cold_count = collect_codec_names(names);
+    munit_assert_uint(cold_count, >, 0);
+
+    for (unsigned i = 0; i < cold_count; i++)
+    {
+        munit_assert(sail_strdup(names[i], &cold_names[i]) == SAIL_OK);
+    }
+
+    /* Warm start: reads the cache. */
+    sail_finish();
+
+    start_time = sail_now();
+    munit_assert(sail_init_with_flags(SAIL_FLAG_CACHE_CODECS_INFO) == SAIL_OK);
+    const uint64_t warm_time = sail_now() - start_time;
+
+    const unsigned warm_count = collect_codec_names(names);
+    munit_assert_uint(warm_count, ==, cold_count);
+
+    for (unsigned i = 0; i < cold_count; i++)
+    {
+        munit_assert_string_equal(names[i], cold_names[i]);
+        sail_free(cold_names[i]);
+    }
+
+    munit_logf(MUNIT_LOG_INFO, "%u codecs: cold init %lu ms, warm init %lu ms", cold_count,
+               (unsigned long)cold_time, (unsigned long)warm_time);
+
+    sail_finish();
+
+    return MUNIT_OK;
+#endif
+}
+
+static MunitResult test_codecs_cache_corrupted(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+#ifdef SAIL_COMBINE_CODECS
+    return MUNIT_SKIP;
+#else
+    const char* cache_path = getenv("SAIL_CODECS_CACHE_PATH");
+
+    if (cache_path == NULL)
+    {
+        return MUNIT_SKIP;
+    }
+
+    FILE* f = fopen(cache_path, "wb");
+    munit_assert_not_null(f);
+    fputs("SAILCCH1 garbage", f);
+    fclose(f);
+
+    /* Corrupted caches are ignored and rewritten. */
+    sail_finish();
+    munit_assert(sail_init_with_flags(SAIL_FLAG_CACHE_CODECS_INFO) == SAIL_OK);
+    munit_assert_not_null(sail_codec_bundle_list());
+
+    size_t cache_size;
+    munit_assert(sail_file_size(cache_path, &cache_size) == SAIL_OK);
+    munit_assert_size(cache_size, >, strlen("SAILCCH1 garbage"));
+
+    sail_finish();
+
+    return MUNIT_OK;
+#endif
+}
+
+static MunitResult test_codecs_cache_codec_info_edited(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+#ifdef SAIL_COMBINE_CODECS
+    return MUNIT_SKIP;
+#else
+    const char* cache_path = getenv("SAIL_CODECS_CACHE_PATH");
+
+    if (cache_path == NULL)
+    {
+        return MUNIT_SKIP;
+    }
+
+    /* Build a valid cache. */
+    sail_finish();
+    munit_assert(sail_init_with_flags(SAIL_FLAG_CACHE_CODECS_INFO) == SAIL_OK);
+
+    const struct sail_codec_info* codec_info = sail_codec_bundle_list()->codec_bundle->codec_info;
+
+    /* Build "/path/jpeg.codec.info" from "/path/jpeg.so". */
+    const char* suffix = strrchr(codec_info->path, '.');
+    munit_assert_not_null(suffix);
+
+    char* codec_info_path;
+    munit_assert(sail_strdup_length(codec_info->path, (size_t)(suffix - codec_info->path) + 1, &codec_info_path)
+                 == SAIL_OK);
+    char* full_codec_info_path;
+    munit_assert(sail_concat(&full_codec_info_path, 2, codec_info_path, "codec.info") == SAIL_OK);
+    sail_free(codec_info_path);
+
+    void* original;
+    size_t original_size;
+    munit_assert(sail_alloc_data_from_file_contents(full_codec_info_path, &original, &original_size) == SAIL_OK);
+
+    /* The codecs directory might be read-only. */
+    FILE* f = fopen(full_codec_info_path, "wb");
+
+    if (f == NULL)
+    {
+        sail_free(original);
+        sail_free(full_codec_info_path);
+        sail_finish();
+        return MUNIT_SKIP;
+    }
+
+    /* Edit the description in place. The directory modification time doesn't change. */
+    const char* description = strstr(original, "\ndescription=");
+    munit_assert_not_null(description);
+    const size_t prefix_size = (size_t)(description - (const char*)original) + strlen("\ndescription=");
+
+    fwrite(original, 1, prefix_size, f);
+    fputs("Edited ", f);
+    fwrite((const char*)original + prefix_size, 1, original_size - prefix_size, f);
+    fclose(f);
+
+    sail_finish();
+    munit_assert(sail_init_with_flags(SAIL_FLAG_CACHE_CODECS_INFO) == SAIL_OK);
+
+    bool found = false;
+
+    for (const struct sail_codec_bundle_node* node = sail_codec_bundle_list(); node != NULL; node = node->next)
+    {
+        if (strncmp(node->codec_bundle->codec_info->description, "Edited ", strlen("Edited ")) == 0)
+        {
+            found = true;
+        }
+    }
+
+    /* Restore the original codec info. */
+    f = fopen(full_codec_info_path, "wb");
+    munit_assert_not_null(f);
+    fwrite(original, 1, original_size, f);
+    fclose(f);
+
+    sail_free(original);
+    sail_free(full_codec_info_path);
+    sail_finish();
+
+    munit_assert(found);
+
+    return MUNIT_OK;
+#endif
+}
+
+/* The environment variable overrides the cache path, but doesn't enable the cache. */
+static MunitResult test_codecs_cache_env_without_flag(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+#ifdef SAIL_COMBINE_CODECS
+    return MUNIT_SKIP;
+#else
+    const char* cache_path = getenv("SAIL_CODECS_CACHE_PATH");
+
+    if (cache_path == NULL)
+    {
+        return MUNIT_SKIP;
+    }
+
+    remove(cache_path);
+
+    sail_finish();
+    munit_assert(sail_init_with_flags(0) == SAIL_OK);
+    munit_assert_not_null(sail_codec_bundle_list());
+
+    munit_assert_false(sail_is_file(cache_path));
+
+    sail_finish();
+
+    return MUNIT_OK;
+#endif
+}
+
+// clang-format off
+static MunitTest test_suite_tests[] = {
+    { (char *)"/cold-and-warm",     test_codecs_cache_cold_and_warm,     NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/corrupted",         test_codecs_cache_corrupted,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/codec-info-edited", test_codecs_cache_codec_info_edited, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/env-without-flag",  test_codecs_cache_env_without_flag,  NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+
+    { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
+};
+
+static const MunitSuite test_suite = {
+    (char *)"/codecs-cache", test_suite_tests, NULL, 1, MUNIT_SUITE_OPTION_NONE
+};
+// clang-format on
+
+int main(int argc, char* argv[MUNIT_ARRAY_PARAM(argc + 1)])
+{
+    return munit_suite_main(&test_suite, NULL, argc, argv);
+}
@@ -0,0 +1,364 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdbool.h>
+#include <string.h>
+
+#include <sail/sail.h>
+
+#include "munit.h"
+
+#include "tests/images/acceptance/test-images.h"
+
+/*
+ * Loads all the frames of the image. Returns the number of frames loaded.
+ */
+static unsigned load_frames(const char* path,
+                            const struct sail_load_options* load_options,
+                            struct sail_image** frames,
+                            unsigned max_frames)
+{
+    void* state = NULL;
+    munit_assert(sail_start_loading_from_file_with_options(path, NULL, load_options, &state) == SAIL_OK);
+
+    unsigned count = 0;
+
+    while (count < max_frames && sail_load_next_frame(state, &frames[count]) == SAIL_OK)
+    {
+        count++;
+    }
+
+    munit_assert(sail_stop_loading(state) == SAIL_OK);
+
+    return count;
+}
+
+/*
+ * Compares whole pixels of two scan lines. Bits after the last pixel are undefined.
+ */
+static void assert_scan_lines_equal(const void* scan1, const void* scan2, unsigned width,
+                                    enum SailPixelFormat pixel_format)
+{
+    const size_t bits = (size_t)width * sail_bits_per_pixel(pixel_format);
+
+    munit_assert_memory_equal(bits / 8, scan1, scan2);
+
+    if (bits % 8 != 0)
+    {
+        const unsigned char mask = (unsigned char)(0xFF << (8 - bits % 8));
+
+        munit_assert_uint8(((const unsigned char*)scan1)[bits / 8] & mask, ==,
+                           ((const unsigned char*)scan2)[bits / 8] & mask);
+    }
+}
+
+/*
+ * Asserts the cropped frame matches the rectangle cut from the full frame.
+ */
+static void assert_cropped_frame(const struct sail_image* full_image,
+                                 const struct sail_image* cropped_image,
+                                 const struct sail_load_options* load_options)
+{
+    unsigned x, y, width, height;
+    munit_assert(sail_crop_rectangle_from_load_options(load_options, full_image->width, full_image->height, &x, &y,
+                                                       &width, &height)
+                 == SAIL_OK);
+
+    munit_assert(cropped_image->width == width);
+    munit_assert(cropped_image->height == height);
+    munit_assert(cropped_image->pixel_format == full_image->pixel_format);
+    munit_assert(cropped_image->bytes_per_line >= sail_bytes_per_line(width, full_image->pixel_format));
+
+    const unsigned bytes_per_line = sail_bytes_per_line(width, full_image->pixel_format);
+    void* expected;
+    munit_assert(sail_malloc((size_t)bytes_per_line * height, &expected) == SAIL_OK);
+
+    munit_assert(sail_copy_pixels_rectangle(full_image->pixels, full_image->bytes_per_line, full_image->pixel_format, x,
+                                            y, width, height, expected, bytes_per_line)
+                 == SAIL_OK);
+
+    for (unsigned row = 0; row < height; row++)
+    {
+        assert_scan_lines_equal((const unsigned char*)expected + (size_t)row * bytes_per_line,
+                                sail_scan_line(cropped_image, row), width, full_image->pixel_format);
+    }
+
+    sail_free(expected);
+}
+
+enum
+{
+    MAX_FRAMES = 64
+};
+
+/*
+ * Builds a crop rectangle with odd offsets that fits into all the frames.
+ */
+static void setup_crop(struct sail_image* const* frames, unsigned count, struct sail_load_options* load_options)
+{
+    unsigned min_width  = frames[0]->width;
+    unsigned min_height = frames[0]->height;
+
+    for (unsigned i = 1; i < count; i++)
+    {
+        min_width  = frames[i]->width < min_width ? frames[i]->width : min_width;
+        min_height = frames[i]->height < min_height ? frames[i]->height : min_height;
+    }
+
+    load_options->crop_x      = min_width / 3;
+    load_options->crop_y      = min_height / 3;
+    load_options->crop_width  = min_width / 2 + 1;
+    load_options->crop_height = min_height / 2 + 1;
+}
+
+static void destroy_frames(struct sail_image** frames, unsigned count)
+{
+    for (unsigned i = 0; i < count; i++)
+    {
+        sail_destroy_image(frames[i]);
+    }
+}
+
+/*
+ * Cropped frames must match the rectangles cut from fully loaded frames.
+ */
+static MunitResult test_crop_matches_full_load(const MunitParameter params[], void* user_data)
+{
+    (void)user_data;
+
+    const char* path = munit_parameters_get(params, "path");
+
+    struct sail_image* full_frames[MAX_FRAMES];
+    const unsigned full_count = load_frames(path, NULL, full_frames, MAX_FRAMES);
+    munit_assert(full_count > 0);
+
+    const struct sail_codec_info* codec_info;
+    munit_assert(sail_codec_info_from_path(path, &codec_info) == SAIL_OK);
+
+    struct sail_load_options* load_options;
+    munit_assert(sail_alloc_load_options_from_features(codec_info->load_features, &load_options) == SAIL_OK);
+    setup_crop(full_frames, full_count, load_options);
+
+    /* Test the default and a custom alignment. */
+    const unsigned alignments[] = {0, 64};
+
+    for (size_t a = 0; a < sizeof(alignments) / sizeof(alignments[0]); a++)
+    {
+        load_options->pixels_alignment = alignments[a];
+
+        struct sail_image* cropped_frames[MAX_FRAMES];
+        const unsigned cropped_count = load_frames(path, load_options, cropped_frames, MAX_FRAMES);
+        munit_assert(cropped_count == full_count);
+
+        for (unsigned i = 0; i < full_count; i++)
+        {
+            assert_cropped_frame(full_frames[i], cropped_frames[i], load_options);
+        }
+
+        destroy_frames(cropped_frames, cropped_count);
+    }
+
+    sail_destroy_load_options(load_options);
+    destroy_frames(full_frames, full_count);
+
+    return MUNIT_OK;
+}
+
+/*
+ * Loading into a caller buffer crops too.
+ */
+static MunitResult test_crop_load_into(const MunitParameter params[], void* user_data)
+{
+    (void)user_data;
+
+    const char* path = munit_parameters_get(params, "path");
+
+    struct sail_image* full_image;
+    munit_assert(load_frames(path, NULL, &full_image, 1) == 1);
+
+    struct sail_load_options* load_options;
+    munit_assert(sail_alloc_load_options(&load_options) == SAIL_OK);
+    setup_crop(&full_image, 1, load_options);
+
+    unsigned x, y, width, height;
+    munit_assert(sail_crop_rectangle_from_load_options(load_options, full_image->width, full_image->height, &x, &y,
+                                                       &width, &height)
+                 == SAIL_OK);
+
+    /* Pad scan lines to test strides too. */
+    const unsigned bytes_per_line = sail_bytes_per_line(width, full_image->pixel_format) + 3;
+    const size_t pixels_size      = (size_t)bytes_per_line * height;
+    void* pixels;
+    munit_assert(sail_malloc(pixels_size, &pixels) == SAIL_OK);
+
+    void* state = NULL;
+    munit_assert(sail_start_loading_from_file_with_options(path, NULL, load_options, &state) == SAIL_OK);
+
+    struct sail_image* image;
+    munit_assert(sail_load_next_frame_into(state, pixels, pixels_size, bytes_per_line, &image) == SAIL_OK);
+    munit_assert(sail_stop_loading(state) == SAIL_OK);
+
+    munit_assert(image->pixels == pixels);
+    munit_assert(image->bytes_per_line == bytes_per_line);
+    assert_cropped_frame(full_image, image, load_options);
+
+    image->pixels = NULL;
+    sail_destroy_image(image);
+    sail_free(pixels);
+    sail_destroy_load_options(load_options);
+    sail_destroy_image(full_image);
+
+    return MUNIT_OK;
+}
+
+/*
+ * Probing reports the dimensions of the region of interest.
+ */
+static MunitResult test_crop_probe(const MunitParameter params[], void* user_data)
+{
+    (void)user_data;
+
+    const char* path = munit_parameters_get(params, "path");
+
+    struct sail_image* full_image;
+    munit_assert(load_frames(path, NULL, &full_image, 1) == 1);
+
+    const struct sail_codec_info* codec_info;
+    munit_assert(sail_codec_info_from_path(path, &codec_info) == SAIL_OK);
+
+    struct sail_load_options* load_options;
+    munit_assert(sail_alloc_load_options_from_features(codec_info->load_features, &load_options) == SAIL_OK);
+    setup_crop(&full_image, 1, load_options);
+
+    unsigned x, y, width, height;
+    munit_assert(sail_crop_rectangle_from_load_options(load_options, full_image->width, full_image->height, &x, &y,
+                                                       &width, &height)
+                 == SAIL_OK);
+
+    struct sail_io* io;
+    munit_assert(sail_alloc_io_read_file(path, &io) == SAIL_OK);
+
+    struct sail_image* probed_image;
+    munit_assert(sail_probe_io_with_options(io, codec_info, load_options, &probed_image) == SAIL_OK);
+
+    munit_assert(probed_image->width == width);
+    munit_assert(probed_image->height == height);
+    munit_assert(probed_image->bytes_per_line == sail_bytes_per_line(width, probed_image->pixel_format));
+
+    sail_destroy_image(probed_image);
+    sail_destroy_io(io);
+    sail_destroy_load_options(load_options);
+    sail_destroy_image(full_image);
+
+    return MUNIT_OK;
+}
+
+/*
+ * Rectangles outside of frames are rejected.
+ */
+static MunitResult test_crop_outside(const MunitParameter params[], void* user_data)
+{
+    (void)user_data;
+
+    const char* path = munit_parameters_get(params, "path");
+
+    struct sail_load_options* load_options;
+    munit_assert(sail_alloc_load_options(&load_options) == SAIL_OK);
+
+    load_options->crop_x      = 1000000;
+    load_options->crop_y      = 0;
+    load_options->crop_width  = 1;
+    load_options->crop_height = 1;
+
+    void* state = NULL;
+    const sail_status_t status = sail_start_loading_from_file_with_options(path, NULL, load_options, &state);
+
+    /* Codecs cropping natively may reject the rectangle when reading headers. */
+    if (status == SAIL_OK)
+    {
+        struct sail_image* image = NULL;
+        munit_assert(sail_load_next_frame(state, &image) == SAIL_ERROR_INVALID_ARGUMENT);
+        munit_assert_null(image);
+    }
+    else
+    {
+        munit_assert(status == SAIL_ERROR_INVALID_ARGUMENT);
+    }
+
+    munit_assert(sail_stop_loading(state) == SAIL_OK);
+    sail_destroy_load_options(load_options);
+
+    return MUNIT_OK;
+}
+
+/*
+ * Sub-byte pixels are copied bit by bit.
+ */
+static MunitResult test_copy_pixels_rectangle(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    /* Two rows of 16 1-bit pixels. */
+    const unsigned char src[] = {0xA5, 0x3C, 0xFF, 0x0F};
+    unsigned char dst[2]      = {0};
+
+    munit_assert(sail_copy_pixels_rectangle(src, 2, SAIL_PIXEL_FORMAT_BPP1_INDEXED, 3, 1, 7, 1, dst, 2) == SAIL_OK);
+
+    /* Bits 3..9 of 11111111 00001111. */
+    munit_assert_uint8(dst[0] & 0xFE, ==, 0xF8);
+
+    munit_assert(sail_copy_pixels_rectangle(src, 2, SAIL_PIXEL_FORMAT_BPP4_INDEXED, 1, 0, 2, 2, dst, 1) == SAIL_OK);
+    munit_assert_uint8(dst[0], ==, 0x53);
+    munit_assert_uint8(dst[1], ==, 0xF0);
+
+    return MUNIT_OK;
+}
+
+// clang-format off
+static MunitParameterEnum test_params[] = {
+    { (char *)"path", (char **)SAIL_TEST_IMAGES },
+    { NULL, NULL },
+};
+
+static MunitTest test_suite_tests[] = {
+    { (char *)"/matches-full-load",    test_crop_matches_full_load, NULL, NULL, MUNIT_TEST_OPTION_NONE, test_params },
+    { (char *)"/load-into",            test_crop_load_into,         NULL, NULL, MUNIT_TEST_OPTION_NONE, test_params },
+    { (char *)"/probe",                test_crop_probe,             NULL, NULL, MUNIT_TEST_OPTION_NONE, test_params },
+    { (char *)"/outside",              test_crop_outside,           NULL, NULL, MUNIT_TEST_OPTION_NONE, test_params },
+    { (char *)"/copy-pixels-rectangle", test_copy_pixels_rectangle, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+
+    { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
+};
+
+static const MunitSuite test_suite = {
+    (char *)"/crop", test_suite_tests, NULL, 1, MUNIT_SUITE_OPTION_NONE
+};
+// clang-format on
+
+int main(int argc, char* argv[MUNIT_ARRAY_PARAM(argc + 1)])
+{
+    return munit_suite_main(&test_suite, NULL, argc, argv);
+}
@@ -0,0 +1,272 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <sail/sail.h>
+
+#include "munit.h"
+
+#include "tests/images/acceptance/test-images.h"
+
+static void write_test_file(const char* path, const void* data, size_t size)
+{
+    FILE* f = fopen(path, "wb");
+    munit_assert_not_null(f);
+    munit_assert(fwrite(data, 1, size, f) == size);
+    fclose(f);
+}
+
+static MunitResult test_io_mmap_read(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    char* test_file = NULL;
+    munit_assert(sail_temp_file_path("sail_io_mmap_test_read", &test_file) == SAIL_OK);
+
+    const char* test_data       = "Test data for reading";
+    const size_t test_data_size = strlen(test_data);
+
+    write_test_file(test_file, test_data, test_data_size);
+
+    struct sail_io* io = NULL;
+    munit_assert(sail_alloc_io_read_mmap(test_file, &io) == SAIL_OK);
+    munit_assert_not_null(io);
+    munit_assert(sail_check_io_valid(io) == SAIL_OK);
+
+    size_t size;
+    munit_assert(sail_io_size(io, &size) == SAIL_OK);
+    munit_assert(size == test_data_size);
+
+    char read_buffer[256];
+    size_t read_size;
+    munit_assert(io->tolerant_read(io->stream, read_buffer, sizeof(read_buffer), &read_size) == SAIL_OK);
+    munit_assert(read_size == test_data_size);
+    munit_assert(memcmp(read_buffer, test_data, test_data_size) == 0);
+
+    /* Writing is not supported. */
+    munit_assert(io->strict_write(io->stream, test_data, test_data_size) != SAIL_OK);
+
+    sail_destroy_io(io);
+    remove(test_file);
+    sail_free(test_file);
+
+    return MUNIT_OK;
+}
+
+static MunitResult test_io_mmap_seek_tell_eof(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    char* test_file = NULL;
+    munit_assert(sail_temp_file_path("sail_io_mmap_test_seek", &test_file) == SAIL_OK);
+
+    const char* test_data = "0123456789ABCDEF";
+    write_test_file(test_file, test_data, strlen(test_data));
+
+    struct sail_io* io = NULL;
+    munit_assert(sail_alloc_io_read_mmap(test_file, &io) == SAIL_OK);
+
+    size_t offset;
+    bool eof_result;
+    munit_assert(io->tell(io->stream, &offset) == SAIL_OK);
+    munit_assert(offset == 0);
+    munit_assert(io->eof(io->stream, &eof_result) == SAIL_OK);
+    munit_assert(eof_result == false);
+
+    munit_assert(io->seek(io->stream, 5, SEEK_SET) == SAIL_OK);
+
+    char read_buffer[5];
+    munit_assert(io->strict_read(io->stream, read_buffer, 5) == SAIL_OK);
+    munit_assert(memcmp(read_buffer, "56789", 5) == 0);
+
+    munit_assert(io->seek(io->stream, -3, SEEK_CUR) == SAIL_OK);
+    munit_assert(io->tell(io->stream, &offset) == SAIL_OK);
+    munit_assert(offset == 7);
+
+    munit_assert(io->seek(io->stream, -1, SEEK_END) == SAIL_OK);
+    munit_assert(io->strict_read(io->stream, read_buffer, 1) == SAIL_OK);
+    munit_assert(read_buffer[0] == 'F');
+
+    munit_assert(io->eof(io->stream, &eof_result) == SAIL_OK);
+    munit_assert(eof_result == true);
+    munit_assert(io->strict_read(io->stream, read_buffer, 1) != SAIL_OK);
+
+    /* Seeking before the beginning fails. */
+    munit_assert(io->seek(io->stream, -1, SEEK_SET) != SAIL_OK);
+
+    sail_destroy_io(io);
+    remove(test_file);
+    sail_free(test_file);
+
+    return MUNIT_OK;
+}
+
+static MunitResult test_io_mmap_borrow(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    char* test_file = NULL;
+    munit_assert(sail_temp_file_path("sail_io_mmap_test_borrow", &test_file) == SAIL_OK);
+
+    const char* test_data = "0123456789ABCDEF";
+    write_test_file(test_file, test_data, strlen(test_data));
+
+    /* Memory-mapped files are borrowed without copying. */
+    struct sail_io* io = NULL;
+    munit_assert(sail_alloc_io_read_mmap(test_file, &io) == SAIL_OK);
+    munit_assert(io->borrow != NULL);
+
+    munit_assert(io->seek(io->stream, 4, SEEK_SET) == SAIL_OK);
+
+    const void* data;
+    size_t data_size;
+    void* data_to_free;
+    munit_assert(sail_borrow_or_alloc_data_from_io_contents(io, &data, &data_size, &data_to_free) == SAIL_OK);
+    munit_assert_null(data_to_free);
+    munit_assert(data_size == 12);
+    munit_assert(memcmp(data, "456789ABCDEF", data_size) == 0);
+
+    /* Borrowing advances the position. */
+    bool eof_result;
+    munit_assert(io->eof(io->stream, &eof_result) == SAIL_OK);
+    munit_assert(eof_result == true);
+
+    /* Borrowing past the end fails. */
+    munit_assert(io->seek(io->stream, 10, SEEK_SET) == SAIL_OK);
+    munit_assert(sail_borrow_or_alloc_data_from_io(io, 7, &data, &data_to_free) != SAIL_OK);
+
+    sail_destroy_io(io);
+
+    /* Regular files fall back to copying. */
+    munit_assert(sail_alloc_io_read_file(test_file, &io) == SAIL_OK);
+    munit_assert(io->borrow == NULL);
+
+    munit_assert(sail_borrow_or_alloc_data_from_io(io, 4, &data, &data_to_free) == SAIL_OK);
+    munit_assert_not_null(data_to_free);
+    munit_assert(memcmp(data, "0123", 4) == 0);
+    sail_free(data_to_free);
+
+    sail_destroy_io(io);
+    remove(test_file);
+    sail_free(test_file);
+
+    return MUNIT_OK;
+}
+
+static MunitResult test_io_mmap_empty_file(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    char* test_file = NULL;
+    munit_assert(sail_temp_file_path("sail_io_mmap_test_empty", &test_file) == SAIL_OK);
+
+    write_test_file(test_file, "", 0);
+
+    struct sail_io* io = NULL;
+    munit_assert(sail_alloc_io_read_mmap(test_file, &io) == SAIL_OK);
+
+    size_t size;
+    munit_assert(sail_io_size(io, &size) == SAIL_OK);
+    munit_assert(size == 0);
+
+    bool eof_result;
+    munit_assert(io->eof(io->stream, &eof_result) == SAIL_OK);
+    munit_assert(eof_result == true);
+
+    sail_destroy_io(io);
+    remove(test_file);
+    sail_free(test_file);
+
+    /* Missing files fail. */
+    munit_assert(sail_alloc_io_read_mmap("/non/existing/file", &io) != SAIL_OK);
+
+    return MUNIT_OK;
+}
+
+static MunitResult test_io_mmap_load_images(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    for (size_t i = 0; SAIL_TEST_IMAGES[i] != NULL; i++)
+    {
+        const char* path = SAIL_TEST_IMAGES[i];
+
+        const struct sail_codec_info* codec_info;
+        munit_assert(sail_codec_info_from_path(path, &codec_info) == SAIL_OK);
+
+        struct sail_image* expected_image = NULL;
+        munit_assert(sail_load_from_file(path, &expected_image) == SAIL_OK);
+
+        struct sail_io* io = NULL;
+        munit_assert(sail_alloc_io_read_mmap(path, &io) == SAIL_OK);
+
+        void* state = NULL;
+        struct sail_image* image = NULL;
+        munit_assert(sail_start_loading_from_io(io, codec_info, &state) == SAIL_OK);
+        munit_assert(sail_load_next_frame(state, &image) == SAIL_OK);
+        munit_assert(sail_stop_loading(state) == SAIL_OK);
+        sail_destroy_io(io);
+
+        munit_assert_uint(image->width, ==, expected_image->width);
+        munit_assert_uint(image->height, ==, expected_image->height);
+        munit_assert_int(image->pixel_format, ==, expected_image->pixel_format);
+        munit_assert_memory_equal((size_t)image->bytes_per_line * image->height, image->pixels,
+                                  expected_image->pixels);
+
+        sail_destroy_image(image);
+        sail_destroy_image(expected_image);
+    }
+
+    return MUNIT_OK;
+}
+
+// clang-format off
+static MunitTest test_suite_tests[] = {
+    { (char *)"/read",          test_io_mmap_read,          NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/seek-tell-eof", test_io_mmap_seek_tell_eof, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/borrow",        test_io_mmap_borrow,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/empty-file",    test_io_mmap_empty_file,    NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/load-images",   test_io_mmap_load_images,   NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+
+    { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
+};
+
+static const MunitSuite test_suite = {
+    (char *)"/io-mmap", test_suite_tests, NULL, 1, MUNIT_SUITE_OPTION_NONE
+};
+// clang-format on
+
+int main(int argc, char* argv[MUNIT_ARRAY_PARAM(argc + 1)])
+{
+    return munit_suite_main(&test_suite, NULL, argc, argv);
+}
@@ -0,0 +1,315 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <sail/sail.h>
+
+#include "munit.h"
+
+#include "tests/images/acceptance/test-images.h"
+
+/*
+ * Loads the first frame of the image.
+ */
+static struct sail_image* load_first_frame(const char* path, const struct sail_load_options* load_options)
+{
+    void* state = NULL;
+    munit_assert(sail_start_loading_from_file_with_options(path, NULL, load_options, &state) == SAIL_OK);
+
+    struct sail_image* image = NULL;
+    munit_assert(sail_load_next_frame(state, &image) == SAIL_OK);
+    munit_assert(sail_stop_loading(state) == SAIL_OK);
+
+    return image;
+}
+
+/*
+ * Allocates load options with the size hint of a quarter of the full frame.
+ */
+static struct sail_load_options* alloc_quarter_size_options(const struct sail_codec_info* codec_info,
+                                                            const struct sail_image* full_image)
+{
+    struct sail_load_options* load_options;
+    munit_assert(sail_alloc_load_options_from_features(codec_info->load_features, &load_options) == SAIL_OK);
+
+    load_options->options |= SAIL_OPTION_SOURCE_IMAGE;
+
+    load_options->max_width  = full_image->width / 4 > 0 ? full_image->width / 4 : 1;
+    load_options->max_height = full_image->height / 4 > 0 ? full_image->height / 4 : 1;
+
+    return load_options;
+}
+
+/*
+ * Frames are reduced but still cover the size hint. Source images keep the original dimensions.
+ */
+static MunitResult test_scale_reduced_size(const MunitParameter params[], void* user_data)
+{
+    (void)user_data;
+
+    const char* path = munit_parameters_get(params, "path");
+
+    const struct sail_codec_info* codec_info;
+    munit_assert(sail_codec_info_from_path(path, &codec_info) == SAIL_OK);
+
+    struct sail_load_options* load_options;
+    munit_assert(sail_alloc_load_options_from_features(codec_info->load_features, &load_options) == SAIL_OK);
+    load_options->options |= SAIL_OPTION_SOURCE_IMAGE;
+
+    struct sail_image* full_image = load_first_frame(path, load_options);
+    sail_destroy_load_options(load_options);
+
+    if (full_image->source_image != NULL)
+    {
+        munit_assert(full_image->source_image->width == full_image->width);
+        munit_assert(full_image->source_image->height == full_image->height);
+    }
+
+    load_options                     = alloc_quarter_size_options(codec_info, full_image);
+    struct sail_image* reduced_image = load_first_frame(path, load_options);
+
+    if (codec_info->load_features->features & SAIL_CODEC_FEATURE_SCALE)
+    {
+        munit_assert(reduced_image->width >= load_options->max_width);
+        munit_assert(reduced_image->height >= load_options->max_height);
+        munit_assert(reduced_image->width <= full_image->width);
+        munit_assert(reduced_image->height <= full_image->height);
+
+        if (full_image->width >= 4 && full_image->height >= 4)
+        {
+            munit_assert(reduced_image->width < full_image->width || reduced_image->height < full_image->height);
+        }
+    }
+    else
+    {
+        munit_assert(reduced_image->width == full_image->width);
+        munit_assert(reduced_image->height == full_image->height);
+    }
+
+    munit_assert(reduced_image->bytes_per_line >= sail_bytes_per_line(reduced_image->width,
+                                                                      reduced_image->pixel_format));
+
+    if (reduced_image->source_image != NULL)
+    {
+        munit_assert(reduced_image->source_image->width == full_image->width);
+        munit_assert(reduced_image->source_image->height == full_image->height);
+    }
+
+    sail_destroy_image(reduced_image);
+    sail_destroy_load_options(load_options);
+    sail_destroy_image(full_image);
+
+    return MUNIT_OK;
+}
+
+/*
+ * Probing reports the reduced dimensions.
+ */
+static MunitResult test_scale_probe(const MunitParameter params[], void* user_data)
+{
+    (void)user_data;
+
+    const char* path = munit_parameters_get(params, "path");
+
+    const struct sail_codec_info* codec_info;
+    munit_assert(sail_codec_info_from_path(path, &codec_info) == SAIL_OK);
+
+    struct sail_image* full_image          = load_first_frame(path, NULL);
+    struct sail_load_options* load_options = alloc_quarter_size_options(codec_info, full_image);
+    struct sail_image* reduced_image       = load_first_frame(path, load_options);
+
+    struct sail_io* io;
+    munit_assert(sail_alloc_io_read_file(path, &io) == SAIL_OK);
+
+    struct sail_image* probed_image;
+    munit_assert(sail_probe_io_with_options(io, codec_info, load_options, &probed_image) == SAIL_OK);
+
+    munit_assert(probed_image->width == reduced_image->width);
+    munit_assert(probed_image->height == reduced_image->height);
+
+    if (probed_image->source_image != NULL)
+    {
+        munit_assert(probed_image->source_image->width == full_image->width);
+        munit_assert(probed_image->source_image->height == full_image->height);
+    }
+
+    sail_destroy_image(probed_image);
+    sail_destroy_io(io);
+    sail_destroy_image(reduced_image);
+    sail_destroy_load_options(load_options);
+    sail_destroy_image(full_image);
+
+    return MUNIT_OK;
+}
+
+/*
+ * The crop rectangle is applied to reduced frames.
+ */
+static MunitResult test_scale_with_crop(const MunitParameter params[], void* user_data)
+{
+    (void)user_data;
+
+    const char* path = munit_parameters_get(params, "path");
+
+    const struct sail_codec_info* codec_info;
+    munit_assert(sail_codec_info_from_path(path, &codec_info) == SAIL_OK);
+
+    struct sail_image* full_image          = load_first_frame(path, NULL);
+    struct sail_load_options* load_options = alloc_quarter_size_options(codec_info, full_image);
+    struct sail_image* reduced_image       = load_first_frame(path, load_options);
+
+    load_options->crop_x      = reduced_image->width / 3;
+    load_options->crop_y      = reduced_image->height / 3;
+    load_options->crop_width  = reduced_image->width;
+    load_options->crop_height = 1;
+
+    struct sail_image* cropped_image = load_first_frame(path, load_options);
+
+    munit_assert(cropped_image->width == reduced_image->width - load_options->crop_x);
+    munit_assert(cropped_image->height == 1);
+
+    sail_destroy_image(cropped_image);
+    sail_destroy_image(reduced_image);
+    sail_destroy_load_options(load_options);
+    sail_destroy_image(full_image);
+
+    return MUNIT_OK;
+}
+
+static MunitResult test_reduction_from_load_options(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    munit_assert_uint(sail_reduction_from_load_options(NULL, 100, 100, 8), ==, 1);
+
+    struct sail_load_options* load_options;
+    munit_assert(sail_alloc_load_options(&load_options) == SAIL_OK);
+
+    munit_assert_uint(sail_reduction_from_load_options(load_options, 100, 100, 8), ==, 1);
+
+    load_options->max_width  = 25;
+    load_options->max_height = 0;
+    munit_assert_uint(sail_reduction_from_load_options(load_options, 100, 100, 8), ==, 4);
+    munit_assert_uint(sail_reduction_from_load_options(load_options, 100, 100, 2), ==, 2);
+
+    /* 101 / 8 rounded up is 13, still covers 13. */
+    load_options->max_width  = 0;
+    load_options->max_height = 13;
+    munit_assert_uint(sail_reduction_from_load_options(load_options, 50, 101, 8), ==, 8);
+
+    /* Larger hints don't enlarge frames. */
+    load_options->max_width  = 1000;
+    load_options->max_height = 1000;
+    munit_assert_uint(sail_reduction_from_load_options(load_options, 100, 100, 8), ==, 1);
+
+    sail_destroy_load_options(load_options);
+
+    return MUNIT_OK;
+}
+
+/*
+ * WAL mipmap dimensions are rounded down, so a 10x10 texture has 5x5, 2x2, and 1x1 mipmaps.
+ * A 3x3 size hint must select the 5x5 mipmap.
+ */
+static MunitResult test_scale_wal_odd_mipmaps(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    const struct sail_codec_info* codec_info;
+
+    if (sail_codec_info_from_name("WAL", &codec_info) != SAIL_OK)
+    {
+        return MUNIT_SKIP;
+    }
+
+    enum
+    {
+        HEADER_SIZE = 100,
+        PIXELS_SIZE = 10 * 10 + 5 * 5 + 2 * 2 + 1 * 1,
+    };
+
+    unsigned char wal[HEADER_SIZE + PIXELS_SIZE] = {0};
+    const uint32_t header[] = {10, 10, HEADER_SIZE, HEADER_SIZE + 100, HEADER_SIZE + 125, HEADER_SIZE + 129};
+
+    /* Width, height, and mipmap offsets follow the 32-byte name. Little-endian. */
+    for (size_t i = 0; i < sizeof(header) / sizeof(header[0]); i++)
+    {
+        for (unsigned b = 0; b < 4; b++)
+        {
+            wal[32 + i * 4 + b] = (unsigned char)(header[i] >> (b * 8));
+        }
+    }
+
+    struct sail_load_options* load_options;
+    munit_assert(sail_alloc_load_options_from_features(codec_info->load_features, &load_options) == SAIL_OK);
+    load_options->max_width  = 3;
+    load_options->max_height = 3;
+
+    void* state = NULL;
+    munit_assert(sail_start_loading_from_memory_with_options(wal, sizeof(wal), codec_info, load_options, &state)
+                 == SAIL_OK);
+
+    struct sail_image* image = NULL;
+    munit_assert(sail_load_next_frame(state, &image) == SAIL_OK);
+    munit_assert(sail_stop_loading(state) == SAIL_OK);
+
+    munit_assert_uint(image->width, ==, 5);
+    munit_assert_uint(image->height, ==, 5);
+
+    sail_destroy_image(image);
+    sail_destroy_load_options(load_options);
+
+    return MUNIT_OK;
+}
+
+// clang-format off
+static MunitParameterEnum test_params[] = {
+    { (char *)"path", (char **)SAIL_TEST_IMAGES },
+    { NULL, NULL },
+};
+
+static MunitTest test_suite_tests[] = {
+    { (char *)"/reduced-size", test_scale_reduced_size,          NULL, NULL, MUNIT_TEST_OPTION_NONE, test_params },
+    { (char *)"/probe",        test_scale_probe,                 NULL, NULL, MUNIT_TEST_OPTION_NONE, test_params },
+    { (char *)"/with-crop",    test_scale_with_crop,             NULL, NULL, MUNIT_TEST_OPTION_NONE, test_params },
+    { (char *)"/reduction",    test_reduction_from_load_options, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/wal-mipmaps",  test_scale_wal_odd_mipmaps,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+
+    { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
+};
+
+static const MunitSuite test_suite = {
+    (char *)"/load-scale", test_suite_tests, NULL, 1, MUNIT_SUITE_OPTION_NONE
+};
+// clang-format on
+
+int main(int argc, char* argv[MUNIT_ARRAY_PARAM(argc + 1)])
+{
+    return munit_suite_main(&test_suite, NULL, argc, argv);
+}
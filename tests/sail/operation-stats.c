@@ -0,0 +1,190 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdbool.h>
+#include <string.h>
+
+#include <sail/sail.h>
+
+#include "munit.h"
+
+#include "tests/images/acceptance/test-images.h"
+
+/* Allocates a small BGR image that every tested codec can save. */
+static struct sail_image* alloc_test_image(void)
+{
+    struct sail_image* image;
+    munit_assert(sail_alloc_image(&image) == SAIL_OK);
+
+    image->width          = 16;
+    image->height         = 8;
+    image->pixel_format   = SAIL_PIXEL_FORMAT_BPP24_BGR;
+    image->bytes_per_line = sail_bytes_per_line(image->width, image->pixel_format);
+
+    const size_t pixels_size = (size_t)image->height * image->bytes_per_line;
+    munit_assert(sail_malloc(pixels_size, &image->pixels) == SAIL_OK);
+    memset(image->pixels, 0x7F, pixels_size);
+
+    return image;
+}
+
+static void assert_zero_stats(const struct sail_operation_stats* stats)
+{
+    munit_assert_uint64(stats->operations, ==, 0);
+    munit_assert_uint64(stats->frames, ==, 0);
+    munit_assert_uint64(stats->bytes_read, ==, 0);
+    munit_assert_uint64(stats->bytes_written, ==, 0);
+    munit_assert_uint64(stats->bytes_allocated, ==, 0);
+}
+
+static MunitResult test_load(const MunitParameter params[], void* user_data)
+{
+    (void)user_data;
+
+    const char* path = munit_parameters_get(params, "path");
+
+    struct sail_image* image;
+    munit_assert(sail_load_from_file(path, &image) == SAIL_OK);
+
+    struct sail_operation_stats stats;
+    munit_assert(sail_get_last_operation_stats(&stats) == SAIL_OK);
+
+    munit_assert_uint64(stats.operations, ==, 1);
+    munit_assert_uint64(stats.frames, ==, 1);
+    munit_assert_uint64(stats.bytes_read, >, 0);
+    munit_assert_uint64(stats.bytes_written, ==, 0);
+
+    /* At least the frame pixels are allocated. */
+    munit_assert_uint64(stats.bytes_allocated, >=, (uint64_t)image->height * image->bytes_per_line);
+
+    sail_destroy_image(image);
+
+    return MUNIT_OK;
+}
+
+static MunitResult test_save(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    struct sail_image* image = alloc_test_image();
+
+    char buffer[4096];
+
+    const struct sail_codec_info* codec_info;
+    munit_assert(sail_codec_info_from_extension("bmp", &codec_info) == SAIL_OK);
+
+    void* state;
+    munit_assert(sail_start_saving_into_memory(buffer, sizeof(buffer), codec_info, &state) == SAIL_OK);
+    munit_assert(sail_write_next_frame(state, image) == SAIL_OK);
+    munit_assert(sail_stop_saving(state) == SAIL_OK);
+
+    struct sail_operation_stats stats;
+    munit_assert(sail_get_last_operation_stats(&stats) == SAIL_OK);
+
+    munit_assert_uint64(stats.operations, ==, 1);
+    munit_assert_uint64(stats.frames, ==, 1);
+    munit_assert_uint64(stats.bytes_read, ==, 0);
+    munit_assert_uint64(stats.bytes_written, >, (uint64_t)image->height * image->bytes_per_line);
+
+    sail_destroy_image(image);
+
+    return MUNIT_OK;
+}
+
+static MunitResult test_codec_stats(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    const struct sail_codec_info* codec_info;
+    munit_assert(sail_codec_info_from_extension("bmp", &codec_info) == SAIL_OK);
+
+    munit_assert(sail_reset_codec_stats() == SAIL_OK);
+
+    struct sail_image* image = alloc_test_image();
+
+    char buffer[4096];
+
+    /* Save two files and load one of them. */
+    for (unsigned i = 0; i < 2; i++)
+    {
+        void* state;
+        munit_assert(sail_start_saving_into_memory(buffer, sizeof(buffer), codec_info, &state) == SAIL_OK);
+        munit_assert(sail_write_next_frame(state, image) == SAIL_OK);
+        munit_assert(sail_stop_saving(state) == SAIL_OK);
+    }
+
+    struct sail_image* loaded_image;
+    munit_assert(sail_load_from_memory(buffer, sizeof(buffer), &loaded_image) == SAIL_OK);
+
+    struct sail_operation_stats last_stats;
+    munit_assert(sail_get_last_operation_stats(&last_stats) == SAIL_OK);
+
+    struct sail_codec_stats stats;
+    munit_assert(sail_codec_stats(codec_info, &stats) == SAIL_OK);
+
+    munit_assert_uint64(stats.save.operations, ==, 2);
+    munit_assert_uint64(stats.save.frames, ==, 2);
+    munit_assert_uint64(stats.save.bytes_written, >, 0);
+    munit_assert_uint64(stats.load.operations, ==, 1);
+    munit_assert_uint64(stats.load.frames, ==, 1);
+    munit_assert_uint64(stats.load.bytes_read, ==, last_stats.bytes_read);
+
+    munit_assert(sail_reset_codec_stats() == SAIL_OK);
+    munit_assert(sail_codec_stats(codec_info, &stats) == SAIL_OK);
+
+    assert_zero_stats(&stats.load);
+    assert_zero_stats(&stats.save);
+
+    sail_destroy_image(loaded_image);
+    sail_destroy_image(image);
+
+    return MUNIT_OK;
+}
+
+// clang-format off
+static MunitParameterEnum test_params[] = {
+    { (char *)"path", (char **)SAIL_TEST_IMAGES },
+    { NULL, NULL },
+};
+
+static MunitTest test_suite_tests[] = {
+    { (char *)"/load",        test_load,        NULL, NULL, MUNIT_TEST_OPTION_NONE, test_params },
+    { (char *)"/save",        test_save,        NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/codec-stats", test_codec_stats, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+
+    { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
+};
+
+static const MunitSuite test_suite = {
+    (char *)"/operation-stats", test_suite_tests, NULL, 1, MUNIT_SUITE_OPTION_NONE
+};
+// clang-format on
+
+int main(int argc, char* argv[MUNIT_ARRAY_PARAM(argc + 1)])
+{
+    return munit_suite_main(&test_suite, NULL, argc, argv);
+}
@@ -0,0 +1,390 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <sail/sail.h>
+
+#include "munit.h"
+
+#include "tests/images/acceptance/test-images.h"
+
+/*
+ * I/O object that forwards to a memory I/O object and counts the bytes read.
+ * It doesn't implement borrowing, so codecs that borrow memory read through it too.
+ */
+struct counting_stream
+{
+    struct sail_io* io;
+    size_t bytes_read;
+};
+
+static sail_status_t counting_tolerant_read(void* stream, void* buf, size_t size_to_read, size_t* read_size)
+{
+    struct counting_stream* counting_stream = stream;
+
+    SAIL_TRY(counting_stream->io->tolerant_read(counting_stream->io->stream, buf, size_to_read, read_size));
+    counting_stream->bytes_read += *read_size;
+
+    return SAIL_OK;
+}
+
+static sail_status_t counting_strict_read(void* stream, void* buf, size_t size_to_read)
+{
+    struct counting_stream* counting_stream = stream;
+
+    SAIL_TRY(counting_stream->io->strict_read(counting_stream->io->stream, buf, size_to_read));
+    counting_stream->bytes_read += size_to_read;
+
+    return SAIL_OK;
+}
+
+static sail_status_t counting_seek(void* stream, long offset, int whence)
+{
+    struct counting_stream* counting_stream = stream;
+
+    return counting_stream->io->seek(counting_stream->io->stream, offset, whence);
+}
+
+static sail_status_t counting_tell(void* stream, size_t* offset)
+{
+    struct counting_stream* counting_stream = stream;
+
+    return counting_stream->io->tell(counting_stream->io->stream, offset);
+}
+
+static sail_status_t counting_eof(void* stream, bool* result)
+{
+    struct counting_stream* counting_stream = stream;
+
+    return counting_stream->io->eof(counting_stream->io->stream, result);
+}
+
+static sail_status_t counting_size(void* stream, size_t* size)
+{
+    struct counting_stream* counting_stream = stream;
+
+    return counting_stream->io->size(counting_stream->io->stream, size);
+}
+
+static sail_status_t counting_tolerant_write(void* stream, const void* buf, size_t size_to_write, size_t* written_size)
+{
+    (void)stream;
+    (void)buf;
+    (void)size_to_write;
+    (void)written_size;
+
+    return SAIL_ERROR_NOT_IMPLEMENTED;
+}
+
+static sail_status_t counting_strict_write(void* stream, const void* buf, size_t size_to_write)
+{
+    (void)stream;
+    (void)buf;
+    (void)size_to_write;
+
+    return SAIL_ERROR_NOT_IMPLEMENTED;
+}
+
+static sail_status_t counting_flush(void* stream)
+{
+    (void)stream;
+
+    return SAIL_OK;
+}
+
+static sail_status_t counting_close(void* stream)
+{
+    (void)stream;
+
+    return SAIL_OK;
+}
+
+static void alloc_counting_io(struct counting_stream* counting_stream, struct sail_io** io)
+{
+    munit_assert(sail_alloc_io(io) == SAIL_OK);
+
+    (*io)->features       = SAIL_IO_FEATURE_SEEKABLE;
+    (*io)->stream         = counting_stream;
+    (*io)->tolerant_read  = counting_tolerant_read;
+    (*io)->strict_read    = counting_strict_read;
+    (*io)->tolerant_write = counting_tolerant_write;
+    (*io)->strict_write   = counting_strict_write;
+    (*io)->seek           = counting_seek;
+    (*io)->tell           = counting_tell;
+    (*io)->eof            = counting_eof;
+    (*io)->size           = counting_size;
+    (*io)->flush          = counting_flush;
+    (*io)->close          = counting_close;
+}
+
+/*
+ * Header-only probing must report the same image properties as loading.
+ */
+static MunitResult test_probe_matches_load(const MunitParameter params[], void* user_data)
+{
+    (void)user_data;
+
+    const char* path = munit_parameters_get(params, "path");
+
+    struct sail_image* probed_image;
+    munit_assert(sail_probe_file(path, &probed_image, NULL) == SAIL_OK);
+    munit_assert_null(probed_image->pixels);
+
+    struct sail_image* image;
+    munit_assert(sail_load_from_file(path, &image) == SAIL_OK);
+
+    munit_assert(probed_image->width == image->width);
+    munit_assert(probed_image->height == image->height);
+    munit_assert(probed_image->pixel_format == image->pixel_format);
+    munit_assert(probed_image->bytes_per_line == image->bytes_per_line);
+
+    sail_destroy_image(image);
+    sail_destroy_image(probed_image);
+
+    return MUNIT_OK;
+}
+
+/*
+ * Probe mode states cannot load frames.
+ */
+static MunitResult test_probe_option_disables_loading(const MunitParameter params[], void* user_data)
+{
+    (void)user_data;
+
+    const char* path = munit_parameters_get(params, "path");
+
+    struct sail_load_options* load_options;
+    munit_assert(sail_alloc_load_options(&load_options) == SAIL_OK);
+    load_options->options = SAIL_OPTION_PROBE;
+
+    void* state = NULL;
+    munit_assert(sail_start_loading_from_file_with_options(path, NULL, load_options, &state) == SAIL_OK);
+    sail_destroy_load_options(load_options);
+
+    struct sail_image* image = NULL;
+    munit_assert(sail_load_next_frame(state, &image) == SAIL_ERROR_CONFLICTING_OPERATION);
+    munit_assert_null(image);
+    munit_assert(sail_stop_loading(state) == SAIL_OK);
+
+    return MUNIT_OK;
+}
+
+/*
+ * Compares header-only probing with the previous probing path that ran the full codec initialization
+ * and frame seeking. The numbers depend on the machine, so they are logged, not asserted. Bytes read
+ * are compared, as header-only probing must never read more.
+ */
+static MunitResult test_probe_benchmark(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    enum
+    {
+        ITERATIONS = 50
+    };
+
+    for (size_t i = 0; SAIL_TEST_IMAGES[i] != NULL; i++)
+    {
+        const char* path = SAIL_TEST_IMAGES[i];
+
+        const struct sail_codec_info* codec_info;
+        munit_assert(sail_codec_info_from_path(path, &codec_info) == SAIL_OK);
+
+        void* data;
+        size_t data_size;
+        munit_assert(sail_alloc_data_from_file_contents(path, &data, &data_size) == SAIL_OK);
+
+        struct counting_stream counting_stream = { NULL, 0 };
+        munit_assert(sail_alloc_io_read_memory(data, data_size, &counting_stream.io) == SAIL_OK);
+
+        struct sail_io* io;
+        alloc_counting_io(&counting_stream, &io);
+
+        /* Header-only probing. */
+        uint64_t start_time = sail_now();
+
+        for (unsigned iteration = 0; iteration < ITERATIONS; iteration++)
+        {
+            munit_assert(counting_stream.io->seek(counting_stream.io->stream, 0, SEEK_SET) == SAIL_OK);
+
+            struct sail_image* image;
+            munit_assert(sail_probe_io_with_options(io, codec_info, NULL, &image) == SAIL_OK);
+            sail_destroy_image(image);
+        }
+
+        const uint64_t probe_elapsed  = sail_now() - start_time;
+        const size_t probe_bytes_read = counting_stream.bytes_read / ITERATIONS;
+        counting_stream.bytes_read    = 0;
+
+        /*
+         * Full initialization. sail_load_next_frame_into() with an empty buffer fails right after
+         * seeking to the first frame, which is exactly what probing did before.
+         */
+        sail_set_log_barrier(SAIL_LOG_LEVEL_SILENCE);
+
+        start_time = sail_now();
+
+        for (unsigned iteration = 0; iteration < ITERATIONS; iteration++)
+        {
+            munit_assert(counting_stream.io->seek(counting_stream.io->stream, 0, SEEK_SET) == SAIL_OK);
+
+            void* state = NULL;
+            munit_assert(sail_start_loading_from_io_with_options(io, codec_info, NULL, &state) == SAIL_OK);
+
+            unsigned char pixel;
+            struct sail_image* image;
+            munit_assert(sail_load_next_frame_into(state, &pixel, 0, 0, &image) == SAIL_ERROR_INVALID_ARGUMENT);
+            munit_assert(sail_stop_loading(state) == SAIL_OK);
+        }
+
+        const uint64_t init_elapsed  = sail_now() - start_time;
+        const size_t init_bytes_read = counting_stream.bytes_read / ITERATIONS;
+
+        sail_set_log_barrier(SAIL_LOG_LEVEL_DEBUG);
+
+        munit_logf(MUNIT_LOG_INFO, "%s: probe %.3f ms, %zu bytes; full init %.3f ms, %zu bytes", path,
+                   (double)probe_elapsed / ITERATIONS, probe_bytes_read, (double)init_elapsed / ITERATIONS,
+                   init_bytes_read);
+
+        munit_assert(probe_bytes_read <= init_bytes_read);
+
+        sail_destroy_io(io);
+        sail_destroy_io(counting_stream.io);
+        sail_free(data);
+    }
+
+    return MUNIT_OK;
+}
+
+/*
+ * Batch probing must report the same image properties as probing files one by one,
+ * and failing files must not affect the others.
+ */
+static MunitResult test_probe_many(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    size_t images_count = 0;
+    while (SAIL_TEST_IMAGES[images_count] != NULL)
+    {
+        images_count++;
+    }
+
+    /* Test images plus a missing file in the middle. */
+    const size_t count         = images_count + 1;
+    const size_t missing_index = images_count / 2;
+
+    void* ptr;
+    munit_assert(sail_malloc(count * sizeof(const char*), &ptr) == SAIL_OK);
+    const char** paths = ptr;
+
+    for (size_t i = 0, image_index = 0; i < count; i++)
+    {
+        paths[i] = (i == missing_index) ? "missing-file.png" : SAIL_TEST_IMAGES[image_index++];
+    }
+
+    /* A tiny prefix forces falling back to full I/O. */
+    const size_t prefix_sizes[] = { 0, 16 };
+
+    for (size_t p = 0; p < sizeof(prefix_sizes) / sizeof(prefix_sizes[0]); p++)
+    {
+        struct sail_probe_many_options options = { 3, prefix_sizes[p] };
+        struct sail_probe_result* results;
+
+        munit_assert(sail_probe_many(paths, count, &results, &options) == SAIL_OK);
+
+        for (size_t i = 0; i < count; i++)
+        {
+            if (i == missing_index)
+            {
+                munit_assert(results[i].status != SAIL_OK);
+                munit_assert_null(results[i].image);
+                munit_assert_null(results[i].codec_info);
+                continue;
+            }
+
+            struct sail_image* image;
+            const struct sail_codec_info* codec_info;
+
+            if (sail_probe_file(paths[i], &image, &codec_info) != SAIL_OK)
+            {
+                munit_assert(results[i].status != SAIL_OK);
+                continue;
+            }
+
+            munit_assert(results[i].status == SAIL_OK);
+            munit_assert_not_null(results[i].image);
+            munit_assert_null(results[i].image->pixels);
+
+            munit_assert(results[i].codec_info == codec_info);
+            munit_assert(results[i].image->width == image->width);
+            munit_assert(results[i].image->height == image->height);
+            munit_assert(results[i].image->pixel_format == image->pixel_format);
+            munit_assert(results[i].image->source_image->pixel_format == image->source_image->pixel_format);
+
+            sail_destroy_image(image);
+        }
+
+        sail_destroy_probe_results(results, count);
+    }
+
+    struct sail_probe_result* results = (struct sail_probe_result*)1;
+    munit_assert(sail_probe_many(paths, 0, &results, NULL) == SAIL_OK);
+    munit_assert_null(results);
+
+    sail_free(paths);
+
+    return MUNIT_OK;
+}
+
+// clang-format off
+static MunitParameterEnum test_params[] = {
+    { (char *)"path", (char **)SAIL_TEST_IMAGES },
+    { NULL, NULL },
+};
+
+static MunitTest test_suite_tests[] = {
+    { (char *)"/matches-load",             test_probe_matches_load,            NULL, NULL, MUNIT_TEST_OPTION_NONE, test_params },
+    { (char *)"/option-disables-loading",  test_probe_option_disables_loading, NULL, NULL, MUNIT_TEST_OPTION_NONE, test_params },
+    { (char *)"/benchmark",                test_probe_benchmark,               NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/probe-many",               test_probe_many,                    NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+
+    { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
+};
+
+static const MunitSuite test_suite = {
+    (char *)"/probe", test_suite_tests, NULL, 1, MUNIT_SUITE_OPTION_NONE
+};
+// clang-format on
+
+int main(int argc, char* argv[MUNIT_ARRAY_PARAM(argc + 1)])
+{
+    return munit_suite_main(&test_suite, NULL, argc, argv);
+}
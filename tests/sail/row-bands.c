@@ -0,0 +1,815 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <sail/sail.h>
+
+#include "munit.h"
+
+#include "tests/images/acceptance/test-images.h"
+
+/* Frame assembled from bands. */
+struct assembled_frame
+{
+    void* pixels;
+    unsigned width;
+    unsigned height;
+    unsigned bytes_per_line;
+    enum SailPixelFormat pixel_format;
+    unsigned* row_hits;
+    unsigned bands;
+    unsigned max_band_height;
+    sail_status_t fail_with;
+};
+
+static void init_assembled_frame(struct assembled_frame* frame)
+{
+    memset(frame, 0, sizeof(*frame));
+    frame->fail_with = SAIL_OK;
+}
+
+static void free_assembled_frame(struct assembled_frame* frame)
+{
+    free(frame->pixels);
+    free(frame->row_hits);
+}
+
+static sail_status_t assemble_rows(void* user_data,
+                                   const struct sail_image* band,
+                                   unsigned first_row,
+                                   unsigned frame_height)
+{
+    struct assembled_frame* frame = user_data;
+
+    if (frame->fail_with != SAIL_OK)
+    {
+        return frame->fail_with;
+    }
+
+    munit_assert_uint(band->height, >, 0);
+    munit_assert_uint(first_row + band->height, <=, frame_height);
+
+    if (frame->pixels == NULL)
+    {
+        frame->width          = band->width;
+        frame->height         = frame_height;
+        frame->pixel_format   = band->pixel_format;
+        frame->bytes_per_line = sail_bytes_per_line(band->width, band->pixel_format);
+        frame->pixels         = calloc(frame_height, frame->bytes_per_line);
+        frame->row_hits       = calloc(frame_height, sizeof(unsigned));
+        munit_assert_not_null(frame->pixels);
+        munit_assert_not_null(frame->row_hits);
+    }
+
+    munit_assert_uint(band->width, ==, frame->width);
+    munit_assert_uint(frame_height, ==, frame->height);
+    munit_assert(band->pixel_format == frame->pixel_format);
+
+    for (unsigned row = 0; row < band->height; row++)
+    {
+        memcpy((unsigned char*)frame->pixels + (size_t)(first_row + row) * frame->bytes_per_line,
+               sail_scan_line(band, row), frame->bytes_per_line);
+        frame->row_hits[first_row + row]++;
+    }
+
+    frame->bands++;
+
+    if (band->height > frame->max_band_height)
+    {
+        frame->max_band_height = band->height;
+    }
+
+    return SAIL_OK;
+}
+
+static void assert_same_frame(const struct assembled_frame* frame, const struct sail_image* reference)
+{
+    munit_assert_uint(frame->width, ==, reference->width);
+    munit_assert_uint(frame->height, ==, reference->height);
+    munit_assert(frame->pixel_format == reference->pixel_format);
+
+    /* Padding bits of the last byte in scan lines of sub-byte pixel formats are undefined. */
+    const size_t bits        = (size_t)frame->width * sail_bits_per_pixel(frame->pixel_format);
+    const size_t whole_bytes = bits / 8;
+    const unsigned char mask = (unsigned char)(0xFF << (8 - bits % 8));
+
+    for (unsigned row = 0; row < frame->height; row++)
+    {
+        const unsigned char* scan           = (const unsigned char*)frame->pixels + (size_t)row * frame->bytes_per_line;
+        const unsigned char* reference_scan = sail_scan_line(reference, row);
+
+        munit_assert_uint(frame->row_hits[row], ==, 1);
+        munit_assert_memory_equal(whole_bytes, scan, reference_scan);
+
+        if (bits % 8 != 0)
+        {
+            munit_assert_uint8(scan[whole_bytes] & mask, ==, reference_scan[whole_bytes] & mask);
+        }
+    }
+}
+
+/* Returns a 24-bit RGB or BGR pixel format the codec can save. */
+static enum SailPixelFormat rgb_save_pixel_format(const struct sail_codec_info* codec_info)
+{
+    for (unsigned i = 0; i < codec_info->save_features->pixel_formats_length; i++)
+    {
+        const enum SailPixelFormat pixel_format = codec_info->save_features->pixel_formats[i];
+
+        if (pixel_format == SAIL_PIXEL_FORMAT_BPP24_RGB || pixel_format == SAIL_PIXEL_FORMAT_BPP24_BGR)
+        {
+            return pixel_format;
+        }
+    }
+
+    return SAIL_PIXEL_FORMAT_UNKNOWN;
+}
+
+/* Fills the 24-bit rows of the band with a gradient. */
+static void fill_gradient(struct sail_image* band, unsigned first_row)
+{
+    for (unsigned row = 0; row < band->height; row++)
+    {
+        unsigned char* scan      = sail_scan_line(band, row);
+        const unsigned frame_row = first_row + row;
+
+        for (unsigned column = 0; column < band->width; column++)
+        {
+            scan[column * 3 + 0] = (unsigned char)frame_row;
+            scan[column * 3 + 1] = (unsigned char)column;
+            scan[column * 3 + 2] = (unsigned char)(frame_row + column);
+        }
+    }
+}
+
+/* Frame generated in bands. */
+struct generated_frame
+{
+    unsigned* row_hits;
+    unsigned bands;
+    unsigned max_band_height;
+    sail_status_t fail_with;
+};
+
+static sail_status_t generate_rows(void* user_data, struct sail_image* band, unsigned first_row, unsigned frame_height)
+{
+    struct generated_frame* frame = user_data;
+
+    if (frame->fail_with != SAIL_OK)
+    {
+        return frame->fail_with;
+    }
+
+    munit_assert_uint(band->height, >, 0);
+    munit_assert_uint(first_row + band->height, <=, frame_height);
+    munit_assert_not_null(band->pixels);
+
+    fill_gradient(band, first_row);
+
+    for (unsigned row = 0; row < band->height; row++)
+    {
+        frame->row_hits[first_row + row]++;
+    }
+
+    frame->bands++;
+
+    if (band->height > frame->max_band_height)
+    {
+        frame->max_band_height = band->height;
+    }
+
+    return SAIL_OK;
+}
+
+static void init_generated_frame(struct generated_frame* frame, unsigned height)
+{
+    memset(frame, 0, sizeof(*frame));
+    frame->fail_with = SAIL_OK;
+    frame->row_hits  = calloc(height, sizeof(unsigned));
+    munit_assert_not_null(frame->row_hits);
+}
+
+/* Allocates a 512 pixels wide gradient the codec can save. Pixels are not allocated when with_pixels is false. */
+static struct sail_image* alloc_gradient_image(const struct sail_codec_info* codec_info,
+                                               unsigned height,
+                                               bool with_pixels)
+{
+    struct sail_image* image;
+    munit_assert(sail_alloc_image(&image) == SAIL_OK);
+
+    image->width          = 512;
+    image->height         = height;
+    image->pixel_format   = rgb_save_pixel_format(codec_info);
+    image->bytes_per_line = sail_bytes_per_line(image->width, image->pixel_format);
+
+    munit_assert(image->pixel_format != SAIL_PIXEL_FORMAT_UNKNOWN);
+
+    if (with_pixels)
+    {
+        munit_assert(sail_malloc((size_t)image->height * image->bytes_per_line, &image->pixels) == SAIL_OK);
+        fill_gradient(image, 0);
+    }
+
+    return image;
+}
+
+/*
+ * Starts saving into an expanding memory buffer. Its end is the end of the written data, not of the
+ * allocated buffer, so codecs that append data at the end of the file like TIFF can save into it.
+ */
+static void* start_saving_into_buffer(const struct sail_codec_info* codec_info,
+                                      const struct sail_save_options* save_options,
+                                      size_t capacity,
+                                      struct sail_io** io)
+{
+    munit_assert(sail_alloc_io_write_expanding_buffer(capacity, io) == SAIL_OK);
+
+    void* state = NULL;
+    munit_assert(sail_start_saving_into_io_with_options(*io, codec_info, save_options, &state) == SAIL_OK);
+
+    return state;
+}
+
+/* Stops saving and returns a copy of the encoded file. Free it with free(). */
+static void* stop_saving_into_buffer(void* state, struct sail_io* io, size_t* size)
+{
+    munit_assert(sail_stop_saving(state) == SAIL_OK);
+    munit_assert(sail_io_expanding_buffer_size(io, size) == SAIL_OK);
+
+    void* buffer = malloc(*size);
+    munit_assert_not_null(buffer);
+
+    munit_assert(io->seek(io->stream, 0, SEEK_SET) == SAIL_OK);
+    munit_assert(io->strict_read(io->stream, buffer, *size) == SAIL_OK);
+
+    sail_destroy_io(io);
+
+    return buffer;
+}
+
+static MunitResult test_same_pixels(const MunitParameter params[], void* user_data)
+{
+    (void)user_data;
+
+    const char* path = munit_parameters_get(params, "path");
+
+    void* reference_state = NULL;
+    void* rows_state      = NULL;
+    munit_assert(sail_start_loading_from_file(path, NULL, &reference_state) == SAIL_OK);
+    munit_assert(sail_start_loading_from_file(path, NULL, &rows_state) == SAIL_OK);
+
+    struct sail_image* reference;
+
+    while (sail_load_next_frame(reference_state, &reference) == SAIL_OK)
+    {
+        struct assembled_frame frame;
+        init_assembled_frame(&frame);
+
+        munit_assert(sail_load_next_frame_rows(rows_state, 7, assemble_rows, &frame) == SAIL_OK);
+        munit_assert_uint(frame.max_band_height, <=, 7);
+        munit_assert_uint(frame.bands, ==, (reference->height + 6) / 7);
+
+        assert_same_frame(&frame, reference);
+
+        free_assembled_frame(&frame);
+        sail_destroy_image(reference);
+    }
+
+    struct assembled_frame frame;
+    init_assembled_frame(&frame);
+    munit_assert(sail_load_next_frame_rows(rows_state, 7, assemble_rows, &frame) == SAIL_ERROR_NO_MORE_FRAMES);
+    munit_assert_uint(frame.bands, ==, 0);
+
+    munit_assert(sail_stop_loading(reference_state) == SAIL_OK);
+    munit_assert(sail_stop_loading(rows_state) == SAIL_OK);
+
+    return MUNIT_OK;
+}
+
+static MunitResult test_bounded_memory(const MunitParameter params[], void* user_data)
+{
+    (void)user_data;
+
+    const char* extension = munit_parameters_get(params, "extension");
+
+    const struct sail_codec_info* codec_info;
+    if (sail_codec_info_from_extension(extension, &codec_info) != SAIL_OK)
+    {
+        return MUNIT_SKIP;
+    }
+
+    munit_assert(codec_info->load_features->features & SAIL_CODEC_FEATURE_ROW_BANDS);
+
+    /* Encode a gradient that is much larger than a band. */
+    struct sail_image* image = alloc_gradient_image(codec_info, 512, true);
+    const size_t frame_size  = (size_t)image->height * image->bytes_per_line;
+
+    struct sail_io* io;
+    void* state = start_saving_into_buffer(codec_info, NULL, frame_size * 2, &io);
+    munit_assert(sail_write_next_frame(state, image) == SAIL_OK);
+
+    size_t buffer_size;
+    void* buffer = stop_saving_into_buffer(state, io, &buffer_size);
+
+    sail_destroy_image(image);
+
+    /* Load in bands and measure the peak memory usage. */
+    unsigned bands = 0;
+    state          = NULL;
+    munit_assert(sail_start_loading_from_memory(buffer, buffer_size, codec_info, &state) == SAIL_OK);
+
+    sail_reset_memory_peak();
+
+    struct sail_memory_stats stats_before;
+    munit_assert(sail_memory_stats(&stats_before) == SAIL_OK);
+
+    struct assembled_frame frame;
+    init_assembled_frame(&frame);
+    munit_assert(sail_load_next_frame_rows(state, 16, assemble_rows, &frame) == SAIL_OK);
+    bands = frame.bands;
+    free_assembled_frame(&frame);
+
+    struct sail_memory_stats stats_after;
+    munit_assert(sail_memory_stats(&stats_after) == SAIL_OK);
+
+    munit_assert(sail_stop_loading(state) == SAIL_OK);
+    free(buffer);
+
+    munit_assert_uint(bands, ==, 512 / 16);
+    munit_assert_size(stats_after.peak_bytes - stats_before.current_bytes, <, frame_size / 4);
+
+    return MUNIT_OK;
+}
+
+/* Stores the value in little-endian byte order, and returns the address past it. */
+static unsigned char* put_little_endian(unsigned char* target, uint32_t value, unsigned bytes)
+{
+    for (unsigned i = 0; i < bytes; i++)
+    {
+        target[i] = (unsigned char)(value >> (8 * i));
+    }
+
+    return target + bytes;
+}
+
+/* Stores a TIFF directory entry with the value or its offset, and returns the address past it. */
+static unsigned char* put_tiff_entry(unsigned char* entry, uint16_t tag, uint16_t type, uint32_t count, uint32_t value)
+{
+    entry = put_little_endian(entry, tag, 2);
+    entry = put_little_endian(entry, type, 2);
+    entry = put_little_endian(entry, count, 4);
+
+    return put_little_endian(entry, value, 4);
+}
+
+/* Encodes the 24-bit gradient as a TIFF with a single PackBits strip for the whole frame. */
+static void* alloc_single_strip_tiff(unsigned width, unsigned height, size_t* size)
+{
+    const size_t bytes_per_line = (size_t)width * 3;
+    const size_t row_size       = bytes_per_line + (bytes_per_line + 127) / 128;
+
+    /* Header, 10 directory entries, and the bits per sample. */
+    const uint32_t strip_offset = 8 + 2 + 10 * 12 + 4 + 6;
+    const uint32_t strip_size   = (uint32_t)(row_size * height);
+
+    *size               = strip_offset + strip_size;
+    unsigned char* tiff = calloc(1, *size);
+    munit_assert_not_null(tiff);
+
+    memcpy(tiff, "II*\0", 4);
+    put_little_endian(tiff + 4, 8, 4);
+    put_little_endian(tiff + 8, 10, 2);
+
+    unsigned char* entry = tiff + 10;
+
+    entry = put_tiff_entry(entry, 256, 4, 1, width);            /* ImageWidth */
+    entry = put_tiff_entry(entry, 257, 4, 1, height);           /* ImageLength */
+    entry = put_tiff_entry(entry, 258, 3, 3, strip_offset - 6); /* BitsPerSample */
+    entry = put_tiff_entry(entry, 259, 3, 1, 32773);            /* Compression: PackBits */
+    entry = put_tiff_entry(entry, 262, 3, 1, 2);                /* PhotometricInterpretation: RGB */
+    entry = put_tiff_entry(entry, 273, 4, 1, strip_offset);     /* StripOffsets */
+    entry = put_tiff_entry(entry, 277, 3, 1, 3);                /* SamplesPerPixel */
+    entry = put_tiff_entry(entry, 278, 4, 1, height);           /* RowsPerStrip */
+    entry = put_tiff_entry(entry, 279, 4, 1, strip_size);       /* StripByteCounts */
+    put_tiff_entry(entry, 284, 3, 1, 1);                        /* PlanarConfiguration: contiguous */
+
+    for (unsigned i = 0; i < 3; i++)
+    {
+        put_little_endian(tiff + strip_offset - 6 + i * 2, 8, 2);
+    }
+
+    /* Literal PackBits runs of up to 128 bytes. */
+    unsigned char* data = tiff + strip_offset;
+
+    for (unsigned row = 0; row < height; row++)
+    {
+        for (size_t column = 0; column < bytes_per_line; column += 128)
+        {
+            const size_t run = (bytes_per_line - column < 128) ? bytes_per_line - column : 128;
+
+            *data++ = (unsigned char)(run - 1);
+
+            for (size_t i = column; i < column + run; i++)
+            {
+                const unsigned pixel          = (unsigned)(i / 3);
+                const unsigned char values[3] = {(unsigned char)row, (unsigned char)pixel,
+                                                 (unsigned char)(row + pixel)};
+
+                *data++ = values[i % 3];
+            }
+        }
+    }
+
+    return tiff;
+}
+
+static MunitResult test_tiff_large_strips(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    const struct sail_codec_info* codec_info;
+    if (sail_codec_info_from_extension("tif", &codec_info) != SAIL_OK)
+    {
+        return MUNIT_SKIP;
+    }
+
+    size_t tiff_size;
+    void* tiff              = alloc_single_strip_tiff(512, 1024, &tiff_size);
+    const size_t frame_size = (size_t)512 * 3 * 1024;
+
+    /* A strip for the whole frame must not be buffered next to the frame. */
+    void* state = NULL;
+    munit_assert(sail_start_loading_from_memory(tiff, tiff_size, codec_info, &state) == SAIL_OK);
+
+    sail_reset_memory_peak();
+
+    struct sail_memory_stats stats_before;
+    munit_assert(sail_memory_stats(&stats_before) == SAIL_OK);
+
+    struct sail_image* image;
+    munit_assert(sail_load_next_frame(state, &image) == SAIL_OK);
+
+    struct sail_memory_stats stats_after;
+    munit_assert(sail_memory_stats(&stats_after) == SAIL_OK);
+
+    munit_assert(sail_stop_loading(state) == SAIL_OK);
+    munit_assert_size(stats_after.peak_bytes - stats_before.current_bytes, <, frame_size + frame_size / 4);
+
+    /* Nor next to a band. */
+    state = NULL;
+    munit_assert(sail_start_loading_from_memory(tiff, tiff_size, codec_info, &state) == SAIL_OK);
+
+    sail_reset_memory_peak();
+    munit_assert(sail_memory_stats(&stats_before) == SAIL_OK);
+
+    struct assembled_frame frame;
+    init_assembled_frame(&frame);
+    munit_assert(sail_load_next_frame_rows(state, 16, assemble_rows, &frame) == SAIL_OK);
+
+    munit_assert(sail_memory_stats(&stats_after) == SAIL_OK);
+    munit_assert(sail_stop_loading(state) == SAIL_OK);
+
+    munit_assert_uint(frame.bands, ==, 1024 / 16);
+    assert_same_frame(&frame, image);
+    munit_assert_size(stats_after.peak_bytes - stats_before.current_bytes, <, frame_size / 4);
+
+    for (unsigned row = 0; row < image->height; row++)
+    {
+        const unsigned char* scan = sail_scan_line(image, row);
+        munit_assert_uint8(scan[3 * 100 + 0], ==, (unsigned char)row);
+        munit_assert_uint8(scan[3 * 100 + 1], ==, 100);
+        munit_assert_uint8(scan[3 * 100 + 2], ==, (unsigned char)(row + 100));
+    }
+
+    free_assembled_frame(&frame);
+    sail_destroy_image(image);
+    free(tiff);
+
+    return MUNIT_OK;
+}
+
+static MunitResult test_crop(const MunitParameter params[], void* user_data)
+{
+    (void)user_data;
+
+    const char* path = munit_parameters_get(params, "path");
+
+    struct sail_load_options* load_options;
+    munit_assert(sail_alloc_load_options(&load_options) == SAIL_OK);
+
+    load_options->crop_x      = 1;
+    load_options->crop_y      = 2;
+    load_options->crop_width  = 5;
+    load_options->crop_height = 9;
+
+    /* Codecs without native cropping load cropped frames whole and split them. */
+    void* reference_state = NULL;
+    void* rows_state      = NULL;
+    munit_assert(sail_start_loading_from_file_with_options(path, NULL, load_options, &reference_state) == SAIL_OK);
+    munit_assert(sail_start_loading_from_file_with_options(path, NULL, load_options, &rows_state) == SAIL_OK);
+
+    struct sail_image* reference;
+    sail_status_t status;
+
+    while ((status = sail_load_next_frame(reference_state, &reference)) == SAIL_OK)
+    {
+        struct assembled_frame frame;
+        init_assembled_frame(&frame);
+
+        munit_assert(sail_load_next_frame_rows(rows_state, 4, assemble_rows, &frame) == SAIL_OK);
+
+        assert_same_frame(&frame, reference);
+
+        free_assembled_frame(&frame);
+        sail_destroy_image(reference);
+    }
+
+    /* Frames smaller than the rectangle fail the same way. */
+    struct assembled_frame frame;
+    init_assembled_frame(&frame);
+    munit_assert(sail_load_next_frame_rows(rows_state, 4, assemble_rows, &frame) == status);
+    free_assembled_frame(&frame);
+
+    munit_assert(sail_stop_loading(reference_state) == SAIL_OK);
+    munit_assert(sail_stop_loading(rows_state) == SAIL_OK);
+    sail_destroy_load_options(load_options);
+
+    return MUNIT_OK;
+}
+
+static MunitResult test_callback_error(const MunitParameter params[], void* user_data)
+{
+    (void)user_data;
+
+    const char* path = munit_parameters_get(params, "path");
+
+    void* state = NULL;
+    munit_assert(sail_start_loading_from_file(path, NULL, &state) == SAIL_OK);
+
+    struct assembled_frame frame;
+    init_assembled_frame(&frame);
+    frame.fail_with = SAIL_ERROR_EOF;
+
+    munit_assert(sail_load_next_frame_rows(state, 1, assemble_rows, &frame) == SAIL_ERROR_EOF);
+    munit_assert(sail_load_next_frame_rows(state, 0, assemble_rows, &frame) == SAIL_ERROR_INVALID_ARGUMENT);
+
+    munit_assert(sail_stop_loading(state) == SAIL_OK);
+
+    return MUNIT_OK;
+}
+
+/* Saves the gradient whole and in bands, and compares the encoded files. */
+static void assert_same_saved_bytes(const struct sail_codec_info* codec_info,
+                                    const struct sail_save_options* save_options,
+                                    unsigned rows_per_band)
+{
+    struct sail_image* image = alloc_gradient_image(codec_info, 512, true);
+    const size_t capacity    = (size_t)image->height * image->bytes_per_line * 2;
+
+    struct sail_io* io;
+    void* state = start_saving_into_buffer(codec_info, save_options, capacity, &io);
+    munit_assert(sail_write_next_frame(state, image) == SAIL_OK);
+
+    size_t reference_size;
+    void* reference_buffer = stop_saving_into_buffer(state, io, &reference_size);
+
+    /* The frame properties are taken from the image, the pixels come from the callback. */
+    sail_free(image->pixels);
+    image->pixels = NULL;
+
+    struct generated_frame frame;
+    init_generated_frame(&frame, image->height);
+
+    state = start_saving_into_buffer(codec_info, save_options, capacity, &io);
+    munit_assert(sail_write_next_frame_rows(state, image, rows_per_band, generate_rows, &frame) == SAIL_OK);
+
+    size_t rows_size;
+    void* rows_buffer = stop_saving_into_buffer(state, io, &rows_size);
+
+    munit_assert_uint(frame.max_band_height, <=, rows_per_band);
+
+    for (unsigned row = 0; row < image->height; row++)
+    {
+        munit_assert_uint(frame.row_hits[row], ==, 1);
+    }
+
+    munit_assert_size(rows_size, ==, reference_size);
+    munit_assert_memory_equal(reference_size, rows_buffer, reference_buffer);
+
+    free(frame.row_hits);
+    free(reference_buffer);
+    free(rows_buffer);
+    sail_destroy_image(image);
+}
+
+static MunitResult test_save_same_bytes(const MunitParameter params[], void* user_data)
+{
+    (void)user_data;
+
+    const char* extension = munit_parameters_get(params, "extension");
+
+    const struct sail_codec_info* codec_info;
+    if (sail_codec_info_from_extension(extension, &codec_info) != SAIL_OK)
+    {
+        return MUNIT_SKIP;
+    }
+
+    assert_same_saved_bytes(codec_info, NULL, 7);
+
+    return MUNIT_OK;
+}
+
+static MunitResult test_save_interlaced(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    const struct sail_codec_info* codec_info;
+    if (sail_codec_info_from_extension("png", &codec_info) != SAIL_OK)
+    {
+        return MUNIT_SKIP;
+    }
+
+    struct sail_save_options* save_options;
+    munit_assert(sail_alloc_save_options_from_features(codec_info->save_features, &save_options) == SAIL_OK);
+    save_options->options |= SAIL_OPTION_INTERLACED;
+
+    /* Interlaced frames are filled whole from the bands. */
+    assert_same_saved_bytes(codec_info, save_options, 16);
+
+    sail_destroy_save_options(save_options);
+
+    return MUNIT_OK;
+}
+
+/* Saves the gradient of the specified height in bands, and returns the peak memory usage. */
+static size_t save_rows_peak_memory(const struct sail_codec_info* codec_info, unsigned height)
+{
+    struct sail_image* image = alloc_gradient_image(codec_info, height, false);
+
+    struct generated_frame frame;
+    init_generated_frame(&frame, image->height);
+
+    /* Preallocate the whole output to keep its growth out of the peak. */
+    struct sail_io* io;
+    void* state = start_saving_into_buffer(codec_info, NULL, (size_t)image->height * image->bytes_per_line * 2, &io);
+
+    sail_reset_memory_peak();
+
+    struct sail_memory_stats stats_before;
+    munit_assert(sail_memory_stats(&stats_before) == SAIL_OK);
+
+    munit_assert(sail_write_next_frame_rows(state, image, 16, generate_rows, &frame) == SAIL_OK);
+
+    struct sail_memory_stats stats_after;
+    munit_assert(sail_memory_stats(&stats_after) == SAIL_OK);
+
+    size_t size;
+    free(stop_saving_into_buffer(state, io, &size));
+
+    munit_assert_uint(frame.bands, ==, height / 16);
+
+    free(frame.row_hits);
+    sail_destroy_image(image);
+
+    return stats_after.peak_bytes - stats_before.current_bytes;
+}
+
+static MunitResult test_save_bounded_memory(const MunitParameter params[], void* user_data)
+{
+    (void)user_data;
+
+    const char* extension = munit_parameters_get(params, "extension");
+
+    const struct sail_codec_info* codec_info;
+    if (sail_codec_info_from_extension(extension, &codec_info) != SAIL_OK)
+    {
+        return MUNIT_SKIP;
+    }
+
+    munit_assert(codec_info->save_features->features & SAIL_CODEC_FEATURE_ROW_BANDS);
+
+    /* Encoders keep their own working memory like deflate windows. It must not grow with the frame height. */
+    const size_t short_frame_peak = save_rows_peak_memory(codec_info, 256);
+    const size_t tall_frame_peak  = save_rows_peak_memory(codec_info, 1024);
+    const size_t short_frame_size = (size_t)256 * sail_bytes_per_line(512, rgb_save_pixel_format(codec_info));
+
+    munit_assert_size(tall_frame_peak, <, short_frame_peak + short_frame_size / 4);
+
+    return MUNIT_OK;
+}
+
+static MunitResult test_save_callback_error(const MunitParameter params[], void* user_data)
+{
+    (void)user_data;
+
+    const char* extension = munit_parameters_get(params, "extension");
+
+    const struct sail_codec_info* codec_info;
+    if (sail_codec_info_from_extension(extension, &codec_info) != SAIL_OK)
+    {
+        return MUNIT_SKIP;
+    }
+
+    struct sail_image* image = alloc_gradient_image(codec_info, 512, false);
+
+    struct generated_frame frame;
+    init_generated_frame(&frame, image->height);
+    frame.fail_with = SAIL_ERROR_EOF;
+
+    struct sail_io* io;
+    void* state = start_saving_into_buffer(codec_info, NULL, (size_t)image->height * image->bytes_per_line * 2, &io);
+    munit_assert(sail_write_next_frame_rows(state, image, 0, generate_rows, &frame) == SAIL_ERROR_INVALID_ARGUMENT);
+    munit_assert(sail_write_next_frame_rows(state, image, 1, generate_rows, &frame) == SAIL_ERROR_EOF);
+    sail_stop_saving(state);
+    sail_destroy_io(io);
+
+    free(frame.row_hits);
+    sail_destroy_image(image);
+
+    return MUNIT_OK;
+}
+
+static char* extensions[] = {
+    (char*)"bmp", (char*)"jpg", (char*)"png", (char*)"ppm", (char*)"qoi", (char*)"tga", (char*)"tif", NULL,
+};
+
+/* PCX encodes whole frames and exercises the fallback. */
+static char* save_extensions[] = {
+    (char*)"bmp", (char*)"jpg", (char*)"pcx", (char*)"png", (char*)"ppm",
+    (char*)"qoi", (char*)"tga", (char*)"tif", NULL,
+};
+
+// clang-format off
+static MunitParameterEnum test_params[] = {
+    { (char *)"path", (char **)SAIL_TEST_IMAGES },
+    { NULL, NULL },
+};
+
+static MunitParameterEnum extension_params[] = {
+    { (char *)"extension", extensions },
+    { NULL, NULL },
+};
+
+static MunitParameterEnum save_extension_params[] = {
+    { (char *)"extension", save_extensions },
+    { NULL, NULL },
+};
+
+static MunitTest test_suite_tests[] = {
+    { (char *)"/same-pixels",    test_same_pixels,    NULL, NULL, MUNIT_TEST_OPTION_NONE, test_params },
+    { (char *)"/bounded-memory", test_bounded_memory, NULL, NULL, MUNIT_TEST_OPTION_NONE, extension_params },
+    { (char *)"/crop",           test_crop,           NULL, NULL, MUNIT_TEST_OPTION_NONE, test_params },
+    { (char *)"/callback-error", test_callback_error, NULL, NULL, MUNIT_TEST_OPTION_NONE, test_params },
+
+    { (char *)"/tiff-large-strips", test_tiff_large_strips, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+
+    { (char *)"/save-same-bytes",     test_save_same_bytes,     NULL, NULL, MUNIT_TEST_OPTION_NONE, save_extension_params },
+    { (char *)"/save-interlaced",     test_save_interlaced,     NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/save-bounded-memory", test_save_bounded_memory, NULL, NULL, MUNIT_TEST_OPTION_NONE, extension_params },
+    { (char *)"/save-callback-error", test_save_callback_error, NULL, NULL, MUNIT_TEST_OPTION_NONE, save_extension_params },
+
+    { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
+};
+
+static const MunitSuite test_suite = {
+    (char *)"/row-bands", test_suite_tests, NULL, 1, MUNIT_SUITE_OPTION_NONE
+};
+// clang-format on
+
+int main(int argc, char* argv[MUNIT_ARRAY_PARAM(argc + 1)])
+{
+    /* Must be enabled before any other SAIL call. */
+    if (sail_set_memory_accounting(true) != SAIL_OK)
+    {
+        return 1;
+    }
+
+    return munit_suite_main(&test_suite, NULL, argc, argv);
+}
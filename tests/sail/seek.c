@@ -0,0 +1,369 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <sail/sail.h>
+
+#include "munit.h"
+
+#include "tests/images/acceptance/test-images.h"
+
+#define MAX_FRAMES 16
+
+/*
+ * Loads up to MAX_FRAMES frames sequentially. Returns the number of loaded frames.
+ */
+static unsigned load_frames(const char* path, struct sail_image* frames[MAX_FRAMES])
+{
+    void* state = NULL;
+    munit_assert(sail_start_loading_from_file(path, NULL, &state) == SAIL_OK);
+
+    unsigned frame_count = 0;
+
+    while (frame_count < MAX_FRAMES && sail_load_next_frame(state, &frames[frame_count]) == SAIL_OK)
+    {
+        frame_count++;
+    }
+
+    munit_assert(sail_stop_loading(state) == SAIL_OK);
+
+    return frame_count;
+}
+
+static void assert_same_frame(const struct sail_image* image, const struct sail_image* reference)
+{
+    munit_assert_uint(image->width, ==, reference->width);
+    munit_assert_uint(image->height, ==, reference->height);
+    munit_assert(image->pixel_format == reference->pixel_format);
+
+    const unsigned bytes_per_line = sail_bytes_per_line(image->width, image->pixel_format);
+
+    for (unsigned row = 0; row < image->height; row++)
+    {
+        munit_assert_memory_equal(bytes_per_line, sail_scan_line(image, row), sail_scan_line(reference, row));
+    }
+
+    munit_assert((image->palette == NULL) == (reference->palette == NULL));
+
+    if (image->palette != NULL)
+    {
+        munit_assert_uint(image->palette->color_count, ==, reference->palette->color_count);
+        munit_assert_memory_equal(
+            sail_bytes_per_line(image->palette->color_count, image->palette->pixel_format), image->palette->data,
+            reference->palette->data);
+    }
+}
+
+static void seek_and_compare(void* state, unsigned frame, const struct sail_image* reference)
+{
+    munit_assert(sail_seek_to_frame(state, frame) == SAIL_OK);
+
+    struct sail_image* image;
+    munit_assert(sail_load_next_frame(state, &image) == SAIL_OK);
+
+    assert_same_frame(image, reference);
+
+    sail_destroy_image(image);
+}
+
+/*
+ * Seeking forwards, backwards, and to the current frame returns the same frames as loading sequentially.
+ */
+static MunitResult test_seek_to_frame(const MunitParameter params[], void* user_data)
+{
+    (void)user_data;
+
+    const char* path = munit_parameters_get(params, "path");
+
+    struct sail_image* frames[MAX_FRAMES];
+    const unsigned frame_count = load_frames(path, frames);
+    munit_assert_uint(frame_count, >, 0);
+
+    void* state = NULL;
+    munit_assert(sail_start_loading_from_file(path, NULL, &state) == SAIL_OK);
+
+    const unsigned last = frame_count - 1;
+
+    seek_and_compare(state, last, frames[last]);
+    seek_and_compare(state, 0, frames[0]);
+    seek_and_compare(state, last / 2, frames[last / 2]);
+    seek_and_compare(state, last, frames[last]);
+
+    /* The next frame follows the seeked one. */
+    munit_assert(sail_seek_to_frame(state, 0) == SAIL_OK);
+
+    for (unsigned i = 0; i < frame_count; i++)
+    {
+        struct sail_image* image;
+        munit_assert(sail_load_next_frame(state, &image) == SAIL_OK);
+        assert_same_frame(image, frames[i]);
+        sail_destroy_image(image);
+    }
+
+    munit_assert(sail_stop_loading(state) == SAIL_OK);
+
+    for (unsigned i = 0; i < frame_count; i++)
+    {
+        sail_destroy_image(frames[i]);
+    }
+
+    return MUNIT_OK;
+}
+
+/*
+ * Seeking to every frame backwards, and then forwards over every other frame, returns the same frames
+ * as loading sequentially. Frame indexes resume at the recorded keyframes.
+ */
+static MunitResult test_seek_every_frame(const MunitParameter params[], void* user_data)
+{
+    (void)user_data;
+
+    const char* path = munit_parameters_get(params, "path");
+
+    struct sail_image* frames[MAX_FRAMES];
+    const unsigned frame_count = load_frames(path, frames);
+    munit_assert_uint(frame_count, >, 0);
+
+    void* state = NULL;
+    munit_assert(sail_start_loading_from_file(path, NULL, &state) == SAIL_OK);
+
+    for (unsigned i = frame_count; i > 0; i--)
+    {
+        seek_and_compare(state, i - 1, frames[i - 1]);
+    }
+
+    for (unsigned i = 0; i < frame_count; i += 2)
+    {
+        seek_and_compare(state, i, frames[i]);
+    }
+
+    munit_assert(sail_stop_loading(state) == SAIL_OK);
+
+    for (unsigned i = 0; i < frame_count; i++)
+    {
+        sail_destroy_image(frames[i]);
+    }
+
+    return MUNIT_OK;
+}
+
+/*
+ * Seeking past the last frame fails and leaves loading usable.
+ */
+static MunitResult test_seek_past_end(const MunitParameter params[], void* user_data)
+{
+    (void)user_data;
+
+    const char* path = munit_parameters_get(params, "path");
+
+    struct sail_image* frames[MAX_FRAMES];
+    const unsigned frame_count = load_frames(path, frames);
+
+    for (unsigned i = 0; i < frame_count; i++)
+    {
+        sail_destroy_image(frames[i]);
+    }
+
+    if (frame_count == MAX_FRAMES)
+    {
+        return MUNIT_SKIP;
+    }
+
+    void* state = NULL;
+    munit_assert(sail_start_loading_from_file(path, NULL, &state) == SAIL_OK);
+
+    munit_assert(sail_seek_to_frame(state, frame_count + 1) == SAIL_ERROR_NO_MORE_FRAMES);
+
+    /* The frame count is known now. */
+    munit_assert(sail_seek_to_frame(state, frame_count + 10) == SAIL_ERROR_NO_MORE_FRAMES);
+
+    struct sail_image* image;
+    munit_assert(sail_seek_to_frame(state, frame_count) == SAIL_OK);
+    munit_assert(sail_load_next_frame(state, &image) == SAIL_ERROR_NO_MORE_FRAMES);
+
+    munit_assert(sail_seek_to_frame(state, 0) == SAIL_OK);
+    munit_assert(sail_load_next_frame(state, &image) == SAIL_OK);
+    sail_destroy_image(image);
+
+    munit_assert(sail_stop_loading(state) == SAIL_OK);
+
+    return MUNIT_OK;
+}
+
+/*
+ * Seeking backwards in a non-seekable I/O source fails, seeking forward works.
+ */
+static MunitResult test_seek_non_seekable(const MunitParameter params[], void* user_data)
+{
+    (void)user_data;
+
+    const char* path = munit_parameters_get(params, "path");
+
+    struct sail_image* frames[MAX_FRAMES];
+    const unsigned frame_count = load_frames(path, frames);
+
+    for (unsigned i = 0; i < frame_count; i++)
+    {
+        sail_destroy_image(frames[i]);
+    }
+
+    if (frame_count < 2)
+    {
+        return MUNIT_SKIP;
+    }
+
+    const struct sail_codec_info* codec_info;
+    munit_assert(sail_codec_info_from_path(path, &codec_info) == SAIL_OK);
+
+    void* data;
+    size_t data_size;
+    munit_assert(sail_alloc_data_from_file_contents(path, &data, &data_size) == SAIL_OK);
+
+    struct sail_io* io;
+    munit_assert(sail_alloc_io_read_memory(data, data_size, &io) == SAIL_OK);
+    io->features = 0;
+
+    void* state = NULL;
+    munit_assert(sail_start_loading_from_io(io, codec_info, &state) == SAIL_OK);
+
+    munit_assert(sail_seek_to_frame(state, 1) == SAIL_OK);
+    munit_assert(sail_seek_to_frame(state, 0) == SAIL_ERROR_NOT_IMPLEMENTED);
+
+    struct sail_image* image;
+    munit_assert(sail_load_next_frame(state, &image) == SAIL_OK);
+    sail_destroy_image(image);
+
+    munit_assert(sail_stop_loading(state) == SAIL_OK);
+
+    sail_destroy_io(io);
+    sail_free(data);
+
+    return MUNIT_OK;
+}
+
+/*
+ * Seeking over indexed frames resumes at the nearest recorded keyframe instead of walking the frames
+ * from the beginning. Pages of multi-paged images are all keyframes, so seeking to an indexed page
+ * in either direction costs the page itself. Animation frames may depend on the preceding frames,
+ * so seeking to them never costs more than walking from the first frame.
+ */
+static MunitResult test_seek_resumes_at_keyframes(const MunitParameter params[], void* user_data)
+{
+    (void)user_data;
+
+    const char* path = munit_parameters_get(params, "path");
+
+    const struct sail_codec_info* codec_info;
+    munit_assert(sail_codec_info_from_path(path, &codec_info) == SAIL_OK);
+
+    if (!(codec_info->load_features->features & SAIL_CODEC_FEATURE_FRAME_INDEX))
+    {
+        return MUNIT_SKIP;
+    }
+
+    struct sail_image* frames[MAX_FRAMES];
+    const unsigned frame_count = load_frames(path, frames);
+
+    if (frame_count < 2 || frame_count == MAX_FRAMES)
+    {
+        for (unsigned i = 0; i < frame_count; i++)
+        {
+            sail_destroy_image(frames[i]);
+        }
+
+        return MUNIT_SKIP;
+    }
+
+    void* state = NULL;
+    munit_assert(sail_start_loading_from_file(path, codec_info, &state) == SAIL_OK);
+
+    const unsigned last = frame_count - 1;
+
+    /* Index all the frames, then seek backwards over them, and jump forwards to the last one. */
+    seek_and_compare(state, last, frames[last]);
+
+    for (unsigned i = last; i > 0; i--)
+    {
+        seek_and_compare(state, i - 1, frames[i - 1]);
+    }
+
+    seek_and_compare(state, last, frames[last]);
+
+    munit_assert(sail_stop_loading(state) == SAIL_OK);
+
+    struct sail_operation_stats stats;
+    munit_assert(sail_get_last_operation_stats(&stats) == SAIL_OK);
+
+    /* Indexing walks every frame once to learn if it's a keyframe, and then resumes at the last one. */
+    const uint64_t indexing_frames = frame_count + 1;
+
+    if (codec_info->load_features->features & SAIL_CODEC_FEATURE_ANIMATED)
+    {
+        /* Without the index, seeking backwards to frame i walks i + 1 frames, and the final jump walks the rest. */
+        const uint64_t walking_frames = (uint64_t)last * (last + 1) / 2 + last;
+
+        munit_assert_uint64(stats.frames, <=, indexing_frames + walking_frames);
+    }
+    else
+    {
+        munit_assert_uint64(stats.frames, ==, indexing_frames + last + 1);
+    }
+
+    for (unsigned i = 0; i < frame_count; i++)
+    {
+        sail_destroy_image(frames[i]);
+    }
+
+    return MUNIT_OK;
+}
+
+// clang-format off
+static MunitParameterEnum test_params[] = {
+    { (char *)"path", (char **)SAIL_TEST_IMAGES },
+    { NULL, NULL },
+};
+
+static MunitTest test_suite_tests[] = {
+    { (char *)"/seek-to-frame",   test_seek_to_frame,             NULL, NULL, MUNIT_TEST_OPTION_NONE, test_params },
+    { (char *)"/every-frame",     test_seek_every_frame,          NULL, NULL, MUNIT_TEST_OPTION_NONE, test_params },
+    { (char *)"/past-end",        test_seek_past_end,             NULL, NULL, MUNIT_TEST_OPTION_NONE, test_params },
+    { (char *)"/non-seekable",    test_seek_non_seekable,         NULL, NULL, MUNIT_TEST_OPTION_NONE, test_params },
+    { (char *)"/keyframe-resume", test_seek_resumes_at_keyframes, NULL, NULL, MUNIT_TEST_OPTION_NONE, test_params },
+
+    { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
+};
+
+static const MunitSuite test_suite = {
+    (char *)"/seek", test_suite_tests, NULL, 1, MUNIT_SUITE_OPTION_NONE
+};
+// clang-format on
+
+int main(int argc, char* argv[MUNIT_ARRAY_PARAM(argc + 1)])
+{
+    return munit_suite_main(&test_suite, NULL, argc, argv);
+}
@@ -35,6 +35,7 @@ typedef DWORD(WINAPI* thread_func_t)(LPVOID);
 #define THREAD_RETURN_VALUE 0
 #else
 #include <pthread.h>
+#include <unistd.h>
 typedef pthread_t thread_t;
 typedef void* (*thread_func_t)(void*);
 #define THREAD_RETURN void*
@@ -44,6 +45,10 @@ typedef void* (*thread_func_t)(void*);
 #include <sail-manip/convert.h>
 #include <sail/sail.h>
 
+#ifdef SAIL_TEST_PRIVATE_API
+#include <sail/sail_private.h>
+#endif
+
 #include "munit.h"
 
 #include "tests/images/acceptance/test-images.h"
@@ -51,6 +56,7 @@ typedef void* (*thread_func_t)(void*);
 /* Stress test configuration */
 #define STRESS_NUM_THREADS 8
 #define STRESS_ITERATIONS_PER_THREAD 100
+#define STRESS_SCALING_ITERATIONS_PER_THREAD 1000000
 
 struct stress_thread_data
 {
@@ -456,12 +462,166 @@ static MunitResult test_stress_shared_context(const MunitParameter params[], voi
     return MUNIT_OK;
 }
 
+#ifdef SAIL_TEST_PRIVATE_API
+struct scaling_thread_data
+{
+    const struct sail_codec_info* codec_info;
+    int iterations;
+    volatile int* success_count;
+};
+
+/* Thread function that resolves the same loaded codec over and over */
+static THREAD_RETURN stress_codec_resolution_thread(void* arg)
+{
+    struct scaling_thread_data* data = (struct scaling_thread_data*)arg;
+
+    int success_count = 0;
+
+    for (int i = 0; i < data->iterations; i++)
+    {
+        const struct sail_codec* codec = NULL;
+
+        if (load_codec_by_codec_info(data->codec_info, &codec) == SAIL_OK && codec != NULL)
+        {
+            success_count++;
+        }
+    }
+
+#ifdef _WIN32
+    InterlockedExchangeAdd((volatile LONG*)data->success_count, success_count);
+#else
+    __sync_add_and_fetch(data->success_count, success_count);
+#endif
+
+    return THREAD_RETURN_VALUE;
+}
+
+static unsigned cpu_cores(void)
+{
+#ifdef _WIN32
+    SYSTEM_INFO system_info;
+    GetSystemInfo(&system_info);
+
+    return (unsigned)system_info.dwNumberOfProcessors;
+#else
+    const long cores = sysconf(_SC_NPROCESSORS_ONLN);
+
+    return cores > 0 ? (unsigned)cores : 1;
+#endif
+}
+
+/* Runs the codec resolution threads and returns their throughput in resolutions per millisecond. */
+static double measure_codec_resolution(const struct sail_codec_info* codec_info, int num_threads)
+{
+    volatile int success_count = 0;
+
+    thread_t threads[STRESS_NUM_THREADS];
+    struct scaling_thread_data thread_data[STRESS_NUM_THREADS];
+
+    const uint64_t start_time = sail_now_us();
+
+    for (int i = 0; i < num_threads; i++)
+    {
+        thread_data[i].codec_info    = codec_info;
+        thread_data[i].iterations    = STRESS_SCALING_ITERATIONS_PER_THREAD;
+        thread_data[i].success_count = &success_count;
+
+        int result = create_thread(&threads[i], stress_codec_resolution_thread, &thread_data[i]);
+        munit_assert(result == 0);
+    }
+
+    for (int i = 0; i < num_threads; i++)
+    {
+        join_thread(threads[i]);
+    }
+
+    const uint64_t elapsed = sail_now_us() - start_time;
+
+    munit_assert_int(success_count, ==, num_threads * STRESS_SCALING_ITERATIONS_PER_THREAD);
+
+    return (double)success_count * 1000 / (double)(elapsed == 0 ? 1 : elapsed);
+}
+#endif
+
+/*
+ * Resolves an already loaded codec with 1, 2, 4 and STRESS_NUM_THREADS threads and logs
+ * the throughput. Resolution is a lock-free pointer read, so the throughput should grow
+ * near-linearly up to the number of CPU cores.
+ *
+ * Wall-clock timings are noisy on shared CI machines and under sanitizers, so the speedup
+ * is asserted only when SAIL_TEST_CODEC_SCALING is set and at least 4 cores are available:
+ * 4 threads must resolve codecs at least twice as fast as a single thread.
+ *
+ * Codec resolution is internal, so this test runs in static builds only.
+ */
+static MunitResult test_stress_codec_scaling(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+#ifdef SAIL_TEST_PRIVATE_API
+    if (SAIL_TEST_IMAGES[0] == NULL)
+    {
+        return MUNIT_SKIP;
+    }
+
+    const struct sail_codec_info* codec_info;
+    munit_assert(sail_codec_info_from_path(SAIL_TEST_IMAGES[0], &codec_info) == SAIL_OK);
+
+    /* Load the codec once, so the threads measure the steady-state lookup. */
+    const struct sail_codec* codec = NULL;
+    munit_assert(load_codec_by_codec_info(codec_info, &codec) == SAIL_OK);
+
+    const int thread_counts[] = {1, 2, 4, STRESS_NUM_THREADS};
+    double single_thread_ops_per_ms = 0;
+    double four_threads_ops_per_ms  = 0;
+
+    for (size_t t = 0; t < sizeof(thread_counts) / sizeof(thread_counts[0]); t++)
+    {
+        const int num_threads   = thread_counts[t];
+        const double ops_per_ms = measure_codec_resolution(codec_info, num_threads);
+
+        if (num_threads == 1)
+        {
+            single_thread_ops_per_ms = ops_per_ms;
+        }
+        else if (num_threads == 4)
+        {
+            four_threads_ops_per_ms = ops_per_ms;
+        }
+
+        munit_logf(MUNIT_LOG_INFO, "%d thread(s): %.1f ops/ms, %.2fx of single-threaded throughput", num_threads,
+                   ops_per_ms, ops_per_ms / single_thread_ops_per_ms);
+    }
+
+    if (getenv("SAIL_TEST_CODEC_SCALING") == NULL)
+    {
+        return MUNIT_OK;
+    }
+
+    const unsigned cores = cpu_cores();
+
+    if (cores < 4)
+    {
+        munit_logf(MUNIT_LOG_INFO, "%u CPU core(s) available, at least 4 are needed to check the speedup", cores);
+        return MUNIT_SKIP;
+    }
+
+    munit_assert_double(four_threads_ops_per_ms, >=, single_thread_ops_per_ms * 2);
+
+    return MUNIT_OK;
+#else
+    return MUNIT_SKIP;
+#endif
+}
+
 // clang-format off
 static MunitTest test_suite_tests[] = {
     { (char *)"/concurrent-loads",   test_stress_concurrent_loads,   NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
     { (char *)"/codec-info-queries", test_stress_codec_info_queries, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
     { (char *)"/advanced-api",       test_stress_advanced_api,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
     { (char *)"/shared-context",     test_stress_shared_context,     NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/codec-scaling",      test_stress_codec_scaling,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
 
     { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
 };
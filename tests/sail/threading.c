@@ -294,12 +294,54 @@ static MunitResult test_threading_context_init_race(const MunitParameter params[
     return MUNIT_OK;
 }
 
+static MunitResult test_threading_preload_codecs(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    sail_finish();
+
+    munit_assert(sail_init_with_flags(SAIL_FLAG_PRELOAD_CODECS) == SAIL_OK);
+
+    /* Every codec is loaded in parallel and published. */
+    for (const struct sail_codec_bundle_node* codec_bundle_node = sail_codec_bundle_list(); codec_bundle_node != NULL;
+         codec_bundle_node                                      = codec_bundle_node->next)
+    {
+        munit_assert_not_null(codec_bundle_node->codec_bundle->codec);
+    }
+
+    /* Preloaded codecs are usable from multiple threads. */
+    thread_t threads[NUM_THREADS];
+    struct thread_data thread_data[NUM_THREADS];
+
+    for (int i = 0; i < NUM_THREADS && SAIL_TEST_IMAGES[i] != NULL; i++)
+    {
+        thread_data[i].path      = SAIL_TEST_IMAGES[i];
+        thread_data[i].success   = false;
+        thread_data[i].thread_id = i;
+
+        int result = create_thread(&threads[i], load_image_thread, &thread_data[i]);
+        munit_assert(result == 0);
+    }
+
+    for (int i = 0; i < NUM_THREADS && SAIL_TEST_IMAGES[i] != NULL; i++)
+    {
+        join_thread(threads[i]);
+        munit_assert(thread_data[i].success);
+    }
+
+    sail_finish();
+
+    return MUNIT_OK;
+}
+
 // clang-format off
 static MunitTest test_suite_tests[] = {
     { (char *)"/advanced-api",       test_threading_advanced_api,       NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
     { (char *)"/codec-info-queries", test_threading_codec_info_queries, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
     { (char *)"/concurrent-loads",   test_threading_concurrent_loads,   NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
     { (char *)"/context-init-race",  test_threading_context_init_race,  NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/preload-codecs",     test_threading_preload_codecs,     NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
     { (char *)"/same-image-loads",   test_threading_same_image_loads,   NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
 
     { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
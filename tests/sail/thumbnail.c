@@ -0,0 +1,477 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <sail/sail.h>
+
+#include "munit.h"
+
+#include "tests/images/acceptance/test-images.h"
+
+/*
+ * Saves a gradient of the specified size as JPEG into a new buffer.
+ */
+static void* save_jpeg(unsigned size, size_t* written)
+{
+    const struct sail_codec_info* codec_info;
+    munit_assert(sail_codec_info_from_extension("jpg", &codec_info) == SAIL_OK);
+
+    struct sail_image* image;
+    munit_assert(sail_alloc_image_with_alignment(SAIL_PIXEL_FORMAT_BPP24_RGB, size, size, 1, &image) == SAIL_OK);
+
+    for (unsigned row = 0; row < size; row++)
+    {
+        unsigned char* scan_line = sail_scan_line(image, row);
+
+        for (unsigned column = 0; column < size * 3; column++)
+        {
+            scan_line[column] = (unsigned char)(row * 255 / size);
+        }
+    }
+
+    struct sail_io* io;
+    munit_assert(sail_alloc_io_write_expanding_buffer(4096, &io) == SAIL_OK);
+
+    void* state = NULL;
+    munit_assert(sail_start_saving_into_io(io, codec_info, &state) == SAIL_OK);
+    munit_assert(sail_write_next_frame(state, image) == SAIL_OK);
+    munit_assert(sail_stop_saving(state) == SAIL_OK);
+
+    munit_assert(sail_io_expanding_buffer_size(io, written) == SAIL_OK);
+
+    void* buffer;
+    munit_assert(sail_malloc(*written, &buffer) == SAIL_OK);
+    munit_assert(io->seek(io->stream, 0, SEEK_SET) == SAIL_OK);
+    munit_assert(io->strict_read(io->stream, buffer, *written) == SAIL_OK);
+
+    sail_destroy_io(io);
+    sail_destroy_image(image);
+
+    return buffer;
+}
+
+/*
+ * Builds a 64x64 JPEG with a 16x16 thumbnail in the EXIF APP1 marker right after SOI.
+ */
+static unsigned char* build_jpeg_with_exif_thumbnail(size_t* size)
+{
+    size_t main_size;
+    unsigned char* main_data = save_jpeg(64, &main_size);
+    size_t thumbnail_size;
+    unsigned char* thumbnail_data = save_jpeg(16, &thumbnail_size);
+
+    /* Big-endian TIFF header, empty IFD0, and IFD1 with JPEGInterchangeFormat[Length]. */
+    const unsigned thumbnail_offset = 8 + 6 + 30;
+    const unsigned char tiff[] = {
+        'M', 'M', 0x00, 0x2A, 0x00, 0x00, 0x00, 0x08,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x0E,
+        0x00, 0x02,
+        0x02, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, (unsigned char)thumbnail_offset,
+        0x02, 0x02, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01,
+        0x00, 0x00, (unsigned char)(thumbnail_size >> 8), (unsigned char)(thumbnail_size & 0xFF),
+        0x00, 0x00, 0x00, 0x00,
+    };
+    munit_assert_size(sizeof(tiff), ==, thumbnail_offset);
+
+    const size_t segment_length = 2 + 6 + sizeof(tiff) + thumbnail_size;
+    munit_assert_size(segment_length, <=, 0xFFFF);
+
+    *size = 2 + 2 + segment_length + main_size - 2;
+    void* ptr;
+    munit_assert(sail_malloc(*size, &ptr) == SAIL_OK);
+    unsigned char* data = ptr;
+
+    unsigned char* it = data;
+    *it++ = 0xFF;
+    *it++ = 0xD8;
+    *it++ = 0xFF;
+    *it++ = 0xE1;
+    *it++ = (unsigned char)(segment_length >> 8);
+    *it++ = (unsigned char)(segment_length & 0xFF);
+    memcpy(it, "Exif\0\0", 6);
+    it += 6;
+    memcpy(it, tiff, sizeof(tiff));
+    it += sizeof(tiff);
+    memcpy(it, thumbnail_data, thumbnail_size);
+    it += thumbnail_size;
+    memcpy(it, main_data + 2, main_size - 2);
+
+    sail_free(thumbnail_data);
+    sail_free(main_data);
+
+    return data;
+}
+
+static unsigned char* put_big_endian(unsigned char* it, uint32_t value, unsigned bytes)
+{
+    while (bytes-- > 0)
+    {
+        *it++ = (unsigned char)(value >> (bytes * 8));
+    }
+
+    return it;
+}
+
+/*
+ * Builds an uncompressed 64x64 RGB PSD with a 16x16 JFIF thumbnail in its image resources.
+ */
+static unsigned char* build_psd_with_thumbnail(size_t* size)
+{
+    size_t thumbnail_size;
+    unsigned char* thumbnail_data = save_jpeg(16, &thumbnail_size);
+
+    const size_t resource_data_size = 28 + thumbnail_size;
+    const size_t resources_size     = 4 + 2 + 2 + 4 + resource_data_size + (resource_data_size & 1);
+    const size_t pixels_size        = 3 * 64 * 64;
+
+    *size = 26 + 4 + 4 + resources_size + 4 + 2 + pixels_size;
+    void* ptr;
+    munit_assert(sail_malloc(*size, &ptr) == SAIL_OK);
+    memset(ptr, 0, *size);
+    unsigned char* data = ptr;
+
+    /* Header: signature, version, reserved, channels, height, width, depth, RGB mode. */
+    unsigned char* it = data;
+    memcpy(it, "8BPS", 4);
+    it = put_big_endian(it + 4, 1, 2);
+    it = put_big_endian(it + 6, 3, 2);
+    it = put_big_endian(it, 64, 4);
+    it = put_big_endian(it, 64, 4);
+    it = put_big_endian(it, 8, 2);
+    it = put_big_endian(it, 3, 2);
+
+    /* No color mode data. */
+    it = put_big_endian(it, 0, 4);
+
+    /* Thumbnail resource: JFIF format, width, height, width bytes, total size, compressed size, bpp, planes. */
+    it = put_big_endian(it, (uint32_t)resources_size, 4);
+    memcpy(it, "8BIM", 4);
+    it = put_big_endian(it + 4, 1036, 2);
+    it = put_big_endian(it + 2, (uint32_t)resource_data_size, 4);
+    it = put_big_endian(it, 1, 4);
+    it = put_big_endian(it, 16, 4);
+    it = put_big_endian(it, 16, 4);
+    it = put_big_endian(it, 16 * 3, 4);
+    it = put_big_endian(it, 16 * 3 * 16, 4);
+    it = put_big_endian(it, (uint32_t)thumbnail_size, 4);
+    it = put_big_endian(it, 24, 2);
+    it = put_big_endian(it, 1, 2);
+    memcpy(it, thumbnail_data, thumbnail_size);
+    it += thumbnail_size + (resource_data_size & 1);
+
+    /* No layers, uncompressed black pixels. */
+    it = put_big_endian(it, 0, 4);
+    it = put_big_endian(it, 0, 2);
+    munit_assert_size((size_t)(it - data) + pixels_size, ==, *size);
+
+    sail_free(thumbnail_data);
+
+    return data;
+}
+
+static unsigned char* put_tiff_entry(unsigned char* it, uint16_t tag, uint16_t type, uint32_t count, uint32_t value)
+{
+    it = put_big_endian(it, tag, 2);
+    it = put_big_endian(it, type, 2);
+    it = put_big_endian(it, count, 4);
+
+    /* Values shorter than 4 bytes are left-justified. */
+    return (type == 3 && count == 1) ? put_big_endian(it, value << 16, 4) : put_big_endian(it, value, 4);
+}
+
+static unsigned char* put_tiff_directory(unsigned char* it,
+                                         uint32_t subfile_type,
+                                         unsigned size,
+                                         uint32_t bits_per_sample_offset,
+                                         uint32_t strip_offset,
+                                         uint32_t next_directory_offset)
+{
+    it = put_big_endian(it, 10, 2);
+    it = put_tiff_entry(it, 254, 4, 1, subfile_type);
+    it = put_tiff_entry(it, 256, 3, 1, size);
+    it = put_tiff_entry(it, 257, 3, 1, size);
+    it = put_tiff_entry(it, 258, 3, 3, bits_per_sample_offset);
+    it = put_tiff_entry(it, 259, 3, 1, 1);
+    it = put_tiff_entry(it, 262, 3, 1, 2);
+    it = put_tiff_entry(it, 273, 4, 1, strip_offset);
+    it = put_tiff_entry(it, 277, 3, 1, 3);
+    it = put_tiff_entry(it, 278, 3, 1, size);
+    it = put_tiff_entry(it, 279, 4, 1, size * size * 3);
+
+    return put_big_endian(it, next_directory_offset, 4);
+}
+
+/*
+ * Builds an uncompressed black 64x64 RGB TIFF followed by a white 16x16 reduced-resolution directory.
+ */
+static unsigned char* build_tiff_with_reduced_image(size_t* size)
+{
+    const uint32_t directory_size         = 2 + 10 * 12 + 4;
+    const uint32_t bits_per_sample_offset = 8 + directory_size;
+    const uint32_t reduced_offset         = bits_per_sample_offset + 6;
+    const uint32_t pixels_offset          = reduced_offset + directory_size;
+    const uint32_t reduced_pixels_offset  = pixels_offset + 64 * 64 * 3;
+
+    *size = reduced_pixels_offset + 16 * 16 * 3;
+    void* ptr;
+    munit_assert(sail_malloc(*size, &ptr) == SAIL_OK);
+    memset(ptr, 0, *size);
+    unsigned char* data = ptr;
+
+    unsigned char* it = data;
+    memcpy(it, "MM", 2);
+    it = put_big_endian(it + 2, 42, 2);
+    it = put_big_endian(it, 8, 4);
+
+    it = put_tiff_directory(it, 0, 64, bits_per_sample_offset, pixels_offset, reduced_offset);
+
+    for (unsigned i = 0; i < 3; i++)
+    {
+        it = put_big_endian(it, 8, 2);
+    }
+
+    it = put_tiff_directory(it, 1, 16, bits_per_sample_offset, reduced_pixels_offset, 0);
+    munit_assert_size((size_t)(it - data), ==, pixels_offset);
+
+    memset(data + reduced_pixels_offset, 0xFF, 16 * 16 * 3);
+
+    return data;
+}
+
+static struct sail_image* load_thumbnail(const unsigned char* data, size_t size, unsigned min_size)
+{
+    struct sail_io* io;
+    munit_assert(sail_alloc_io_read_memory(data, size, &io) == SAIL_OK);
+
+    struct sail_image* image = NULL;
+    munit_assert(sail_load_thumbnail_from_io(io, NULL, min_size, &image) == SAIL_OK);
+
+    sail_destroy_io(io);
+
+    return image;
+}
+
+/*
+ * The EXIF thumbnail is picked when it covers the size. Otherwise, the main image is reduced.
+ */
+static MunitResult test_thumbnail_exif(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    const struct sail_codec_info* codec_info;
+    munit_assert(sail_codec_info_from_extension("jpg", &codec_info) == SAIL_OK);
+
+    if ((codec_info->load_features->features & SAIL_CODEC_FEATURE_THUMBNAIL) == 0)
+    {
+        return MUNIT_SKIP;
+    }
+
+    size_t size;
+    unsigned char* data = build_jpeg_with_exif_thumbnail(&size);
+
+    /* Regular loading ignores the thumbnail. */
+    struct sail_image* image;
+    munit_assert(sail_load_from_memory(data, size, &image) == SAIL_OK);
+    munit_assert_uint(image->width, ==, 64);
+    munit_assert_uint(image->height, ==, 64);
+    sail_destroy_image(image);
+
+    image = load_thumbnail(data, size, 0);
+    munit_assert_uint(image->width, ==, 16);
+    munit_assert_uint(image->height, ==, 16);
+    sail_destroy_image(image);
+
+    /* The thumbnail is reduced further with DCT scaling. */
+    image = load_thumbnail(data, size, 8);
+    munit_assert_uint(image->width, ==, 8);
+    munit_assert_uint(image->height, ==, 8);
+    sail_destroy_image(image);
+
+    /* The thumbnail is too small. */
+    image = load_thumbnail(data, size, 32);
+    munit_assert_uint(image->width, ==, 32);
+    munit_assert_uint(image->height, ==, 32);
+    sail_destroy_image(image);
+
+    sail_free(data);
+
+    return MUNIT_OK;
+}
+
+/*
+ * The JFIF thumbnail from the PSD image resources is picked when it covers the size.
+ */
+static MunitResult test_thumbnail_psd(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    const struct sail_codec_info* codec_info;
+    if (sail_codec_info_from_extension("psd", &codec_info) != SAIL_OK
+        || (codec_info->load_features->features & SAIL_CODEC_FEATURE_THUMBNAIL) == 0
+        || sail_codec_info_from_extension("jpg", &codec_info) != SAIL_OK)
+    {
+        return MUNIT_SKIP;
+    }
+
+    size_t size;
+    unsigned char* data = build_psd_with_thumbnail(&size);
+
+    /* Regular loading ignores the thumbnail. */
+    struct sail_image* image;
+    munit_assert(sail_load_from_memory(data, size, &image) == SAIL_OK);
+    munit_assert_uint(image->width, ==, 64);
+    munit_assert_uint(image->height, ==, 64);
+    sail_destroy_image(image);
+
+    image = load_thumbnail(data, size, 16);
+    munit_assert_uint(image->width, ==, 16);
+    munit_assert_uint(image->height, ==, 16);
+    munit_assert(image->pixel_format == SAIL_PIXEL_FORMAT_BPP24_RGB);
+
+    /* The gradient of the thumbnail, not the black main image. */
+    const unsigned char* last_row = sail_scan_line(image, 15);
+    munit_assert_uint(last_row[0], >, 128);
+    sail_destroy_image(image);
+
+    /* The thumbnail is too small. */
+    image = load_thumbnail(data, size, 32);
+    munit_assert_uint(image->width, >=, 32);
+    munit_assert_uint(image->height, >=, 32);
+    last_row = sail_scan_line(image, image->height - 1);
+    munit_assert_uint(last_row[0], ==, 0);
+    sail_destroy_image(image);
+
+    sail_free(data);
+
+    return MUNIT_OK;
+}
+
+/*
+ * The smallest reduced-resolution TIFF directory that covers the size is picked.
+ */
+static MunitResult test_thumbnail_tiff(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    const struct sail_codec_info* codec_info;
+    if (sail_codec_info_from_extension("tif", &codec_info) != SAIL_OK
+        || (codec_info->load_features->features & SAIL_CODEC_FEATURE_THUMBNAIL) == 0)
+    {
+        return MUNIT_SKIP;
+    }
+
+    size_t size;
+    unsigned char* data = build_tiff_with_reduced_image(&size);
+
+    /* Regular loading starts with the main image. */
+    struct sail_image* image;
+    munit_assert(sail_load_from_memory(data, size, &image) == SAIL_OK);
+    munit_assert_uint(image->width, ==, 64);
+    munit_assert_uint(image->height, ==, 64);
+    sail_destroy_image(image);
+
+    image = load_thumbnail(data, size, 16);
+    munit_assert_uint(image->width, ==, 16);
+    munit_assert_uint(image->height, ==, 16);
+    munit_assert(image->pixel_format == SAIL_PIXEL_FORMAT_BPP24_RGB);
+
+    /* The white reduced image, not the black main image. The source image is the main image. */
+    munit_assert_uint(((const unsigned char*)sail_scan_line(image, 15))[0], ==, 0xFF);
+    munit_assert_not_null(image->source_image);
+    munit_assert_uint(image->source_image->width, ==, 64);
+    munit_assert_uint(image->source_image->height, ==, 64);
+    sail_destroy_image(image);
+
+    /* The reduced image is too small. */
+    image = load_thumbnail(data, size, 32);
+    munit_assert_uint(image->width, ==, 64);
+    munit_assert_uint(image->height, ==, 64);
+    munit_assert_uint(((const unsigned char*)sail_scan_line(image, 63))[0], ==, 0);
+    sail_destroy_image(image);
+
+    sail_free(data);
+
+    return MUNIT_OK;
+}
+
+/*
+ * Images without embedded previews are loaded at reduced sizes still covering the requested size.
+ */
+static MunitResult test_thumbnail_fallback(const MunitParameter params[], void* user_data)
+{
+    (void)user_data;
+
+    const char* path = munit_parameters_get(params, "path");
+
+    struct sail_image* full_image;
+    munit_assert(sail_load_from_file(path, &full_image) == SAIL_OK);
+
+    const unsigned min_size = SAIL_MIN(full_image->width, full_image->height) / 4;
+
+    struct sail_image* image;
+    munit_assert(sail_load_thumbnail_from_file(path, min_size, &image) == SAIL_OK);
+
+    munit_assert_uint(image->width, >=, min_size);
+    munit_assert_uint(image->height, >=, min_size);
+    munit_assert_uint(image->width, <=, full_image->width);
+    munit_assert_uint(image->height, <=, full_image->height);
+
+    sail_destroy_image(image);
+    sail_destroy_image(full_image);
+
+    return MUNIT_OK;
+}
+
+// clang-format off
+static MunitParameterEnum test_params[] = {
+    { (char *)"path", (char **)SAIL_TEST_IMAGES },
+    { NULL, NULL },
+};
+
+static MunitTest test_suite_tests[] = {
+    { (char *)"/exif",     test_thumbnail_exif,     NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/psd",      test_thumbnail_psd,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/tiff",     test_thumbnail_tiff,     NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/fallback", test_thumbnail_fallback, NULL, NULL, MUNIT_TEST_OPTION_NONE, test_params },
+
+    { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
+};
+
+static const MunitSuite test_suite = {
+    (char *)"/thumbnail", test_suite_tests, NULL, 1, MUNIT_SUITE_OPTION_NONE
+};
+// clang-format on
+
+int main(int argc, char* argv[MUNIT_ARRAY_PARAM(argc + 1)])
+{
+    return munit_suite_main(&test_suite, NULL, argc, argv);
+}
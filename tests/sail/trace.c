@@ -0,0 +1,321 @@
+/*  This file is part of SAIL (https://github.com/HappySeaFox/sail)
+
+    Copyright (c) 2026 Dmitry Baryshev
+
+    The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <sail/sail.h>
+
+#include <sail-common/atomic_private.h>
+
+#include <sail-manip/sail-manip.h>
+
+#include "munit.h"
+
+/* Events recorded by the test callbacks. Parallel loops are disabled, so there are no races. */
+struct trace_log
+{
+    unsigned begins;
+    unsigned ends;
+    int depth;
+    bool balanced;
+    bool codec;
+    bool io;
+    bool manip;
+};
+
+static void record_begin(void* user_data, const char* name, const char* category)
+{
+    struct trace_log* log = user_data;
+
+    munit_assert_not_null(name);
+
+    log->begins++;
+    log->depth++;
+
+    log->codec = log->codec || strcmp(category, "codec") == 0;
+    log->io    = log->io || strcmp(category, "io") == 0;
+    log->manip = log->manip || strcmp(category, "manip") == 0;
+}
+
+static void record_end(void* user_data, const char* name, const char* category)
+{
+    struct trace_log* log = user_data;
+
+    (void)name;
+    (void)category;
+
+    log->ends++;
+
+    if (--log->depth < 0)
+    {
+        log->balanced = false;
+    }
+}
+
+/* Saves a small image into the buffer and loads it back, then converts and scales it. */
+static void run_traced_operations(void)
+{
+    const struct sail_codec_info* codec_info;
+    munit_assert(sail_codec_info_from_extension("bmp", &codec_info) == SAIL_OK);
+
+    struct sail_image* image;
+    munit_assert(sail_alloc_image(&image) == SAIL_OK);
+
+    image->width          = 16;
+    image->height         = 8;
+    image->pixel_format   = SAIL_PIXEL_FORMAT_BPP24_BGR;
+    image->bytes_per_line = sail_bytes_per_line(image->width, image->pixel_format);
+
+    const size_t pixels_size = (size_t)image->height * image->bytes_per_line;
+    munit_assert(sail_malloc(pixels_size, &image->pixels) == SAIL_OK);
+    memset(image->pixels, 0x7F, pixels_size);
+
+    char buffer[4096];
+
+    void* state;
+    munit_assert(sail_start_saving_into_memory(buffer, sizeof(buffer), codec_info, &state) == SAIL_OK);
+    munit_assert(sail_write_next_frame(state, image) == SAIL_OK);
+    munit_assert(sail_stop_saving(state) == SAIL_OK);
+
+    struct sail_image* loaded_image;
+    munit_assert(sail_load_from_memory(buffer, sizeof(buffer), &loaded_image) == SAIL_OK);
+
+    struct sail_image* converted_image;
+    munit_assert(sail_convert_image(loaded_image, SAIL_PIXEL_FORMAT_BPP32_RGBA, &converted_image) == SAIL_OK);
+
+    struct sail_image* scaled_image;
+    munit_assert(sail_scale_image(converted_image, 8, 4, SAIL_SCALING_BILINEAR, &scaled_image) == SAIL_OK);
+
+    sail_destroy_image(scaled_image);
+    sail_destroy_image(converted_image);
+    sail_destroy_image(loaded_image);
+    sail_destroy_image(image);
+}
+
+static MunitResult test_callbacks(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    struct trace_log log = {0};
+    log.balanced         = true;
+
+    sail_set_max_threads(1);
+    munit_assert(sail_set_trace_callbacks(record_begin, record_end, &log) == SAIL_OK);
+
+    run_traced_operations();
+
+    munit_assert(sail_set_trace_callbacks(NULL, NULL, NULL) == SAIL_OK);
+    sail_set_max_threads(0);
+
+    munit_assert_uint(log.begins, >, 0);
+    munit_assert_uint(log.begins, ==, log.ends);
+    munit_assert_int(log.depth, ==, 0);
+    munit_assert_true(log.balanced);
+    munit_assert_true(log.codec);
+    munit_assert_true(log.io);
+    munit_assert_true(log.manip);
+
+    /* Disabled tracing calls nothing. */
+    const unsigned begins = log.begins;
+    run_traced_operations();
+    munit_assert_uint(log.begins, ==, begins);
+
+    return MUNIT_OK;
+}
+
+static MunitResult test_invalid_callbacks(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    munit_assert(sail_set_trace_callbacks(record_begin, NULL, NULL) == SAIL_ERROR_INVALID_ARGUMENT);
+    munit_assert(sail_set_trace_callbacks(NULL, record_end, NULL) == SAIL_ERROR_INVALID_ARGUMENT);
+
+    return MUNIT_OK;
+}
+
+static MunitResult test_chrome_trace(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    munit_assert(sail_start_chrome_trace(SAIL_TEST_TRACE_PATH) == SAIL_OK);
+    run_traced_operations();
+    munit_assert(sail_stop_chrome_trace() == SAIL_OK);
+
+    /* Stopping twice is fine. */
+    munit_assert(sail_stop_chrome_trace() == SAIL_OK);
+
+    FILE* file = fopen(SAIL_TEST_TRACE_PATH, "rb");
+    munit_assert_not_null(file);
+
+    static char contents[1024 * 1024];
+    const size_t size = fread(contents, 1, sizeof(contents) - 1, file);
+    fclose(file);
+
+    munit_assert_size(size, >, 0);
+    munit_assert_size(size, <, sizeof(contents) - 1);
+    contents[size] = '\0';
+
+    munit_assert_char(contents[0], ==, '[');
+    munit_assert_not_null(strstr(contents, "{\"name\":\"load_frame\",\"cat\":\"codec\",\"ph\":\"B\""));
+    munit_assert_not_null(strstr(contents, "{\"name\":\"load_frame\",\"cat\":\"codec\",\"ph\":\"E\""));
+    munit_assert_not_null(strstr(contents, "\"cat\":\"manip\""));
+    munit_assert_string_equal(contents + size - 4, "}\n]\n");
+
+    remove(SAIL_TEST_TRACE_PATH);
+
+    return MUNIT_OK;
+}
+
+/* Counts the "test" regions only. The pool traces its own ones. */
+static void count_begin(void* user_data, const char* name, const char* category)
+{
+    (void)name;
+
+    if (strcmp(category, "test") == 0)
+    {
+        sail_atomic_add_u64((uint64_t*)user_data, 1);
+    }
+}
+
+static void count_end(void* user_data, const char* name, const char* category)
+{
+    (void)name;
+
+    if (strcmp(category, "test") == 0)
+    {
+        sail_atomic_add_u64((uint64_t*)user_data + 1, 1);
+    }
+}
+
+/* Begins and ends counted by two sets of callbacks that are swapped while other threads trace. */
+struct swap_context
+{
+    uint64_t counters[2][2];
+};
+
+static sail_status_t trace_or_swap_rows(void* context, unsigned row_begin, unsigned row_end)
+{
+    struct swap_context* swap_context = context;
+
+    for (unsigned row = row_begin; row < row_end; row++)
+    {
+        if (row % 8 == 0)
+        {
+            SAIL_TRY(sail_set_trace_callbacks(count_begin, count_end, swap_context->counters[(row / 8) % 2]));
+        }
+        else
+        {
+            sail_trace_begin("row", "test");
+            sail_trace_end("row", "test");
+        }
+    }
+
+    return SAIL_OK;
+}
+
+static MunitResult test_swap_callbacks(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    struct swap_context context = {{{0, 0}, {0, 0}}};
+    const unsigned rows         = 64 * 1024;
+
+    sail_set_max_threads(4);
+    munit_assert(sail_set_trace_callbacks(count_begin, count_end, context.counters[0]) == SAIL_OK);
+    munit_assert(sail_parallel_for(rows, 0, trace_or_swap_rows, &context) == SAIL_OK);
+    munit_assert(sail_set_trace_callbacks(NULL, NULL, NULL) == SAIL_OK);
+    sail_set_max_threads(0);
+
+    /* Every region is counted once. A region may begin and end with different callbacks. */
+    const uint64_t regions = rows - rows / 8;
+    munit_assert_uint64(context.counters[0][0] + context.counters[1][0], ==, regions);
+    munit_assert_uint64(context.counters[0][1] + context.counters[1][1], ==, regions);
+
+    return MUNIT_OK;
+}
+
+static MunitResult test_session_user_data(const MunitParameter params[], void* user_data)
+{
+    (void)params;
+    (void)user_data;
+
+    uint64_t* previous_counters = NULL;
+
+    /* Replaced user data is not used anymore and may be freed right away. */
+    for (unsigned session = 0; session < 1000; session++)
+    {
+        void* ptr;
+        munit_assert(sail_calloc(2, sizeof(uint64_t), &ptr) == SAIL_OK);
+        uint64_t* counters = ptr;
+
+        munit_assert(sail_set_trace_callbacks(count_begin, count_end, counters) == SAIL_OK);
+
+        if (previous_counters != NULL)
+        {
+            munit_assert_uint64(previous_counters[0], ==, 1);
+            sail_free(previous_counters);
+        }
+
+        sail_trace_begin("session", "test");
+        sail_trace_end("session", "test");
+
+        munit_assert_uint64(counters[0], ==, 1);
+        munit_assert_uint64(counters[1], ==, 1);
+
+        previous_counters = counters;
+    }
+
+    munit_assert(sail_set_trace_callbacks(NULL, NULL, NULL) == SAIL_OK);
+    sail_free(previous_counters);
+
+    return MUNIT_OK;
+}
+
+// clang-format off
+static MunitTest test_suite_tests[] = {
+    { (char *)"/callbacks",         test_callbacks,         NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/invalid-callbacks", test_invalid_callbacks, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/chrome-trace",      test_chrome_trace,      NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/swap-callbacks",    test_swap_callbacks,    NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+    { (char *)"/session-user-data", test_session_user_data, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+
+    { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
+};
+
+static const MunitSuite test_suite = {
+    (char *)"/trace", test_suite_tests, NULL, 1, MUNIT_SUITE_OPTION_NONE
+};
+// clang-format on
+
+int main(int argc, char* argv[MUNIT_ARRAY_PARAM(argc + 1)])
+{
+    return munit_suite_main(&test_suite, NULL, argc, argv);
+}
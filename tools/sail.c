@@ -1430,6 +1430,13 @@ static void print_aligned_image_info(const struct sail_image* image)
     }
 }
 
+static void print_probed_codec_info(const char* path, const struct sail_codec_info* codec_info)
+{
+    printf("File          : %s\n", path);
+    printf("Codec         : %s [%s]\n", codec_info->name, codec_info->description);
+    printf("Codec version : %s\n", codec_info->version);
+}
+
 static sail_status_t probe_impl(const char* path)
 {
     SAIL_CHECK_PTR(path);
@@ -1444,9 +1451,7 @@ static sail_status_t probe_impl(const char* path)
 
     uint64_t elapsed_time = sail_now() - start_time;
 
-    printf("File          : %s\n", path);
-    printf("Codec         : %s [%s]\n", codec_info->name, codec_info->description);
-    printf("Codec version : %s\n", codec_info->version);
+    print_probed_codec_info(path, codec_info);
     printf("Probe time    : %lu ms.\n", (unsigned long)elapsed_time);
 
     print_aligned_image_info(image);
@@ -1456,15 +1461,67 @@ static sail_status_t probe_impl(const char* path)
     return SAIL_OK;
 }
 
+/* Probes multiple files concurrently. Returns the status of the first failed file. */
+static sail_status_t probe_many_impl(const char* const* paths, size_t count)
+{
+    SAIL_CHECK_PTR(paths);
+
+    /* Time counter. */
+    uint64_t start_time = sail_now();
+
+    struct sail_probe_result* results;
+    SAIL_TRY(sail_probe_many(paths, count, &results, NULL /* options */));
+
+    uint64_t elapsed_time = sail_now() - start_time;
+
+    sail_status_t status = SAIL_OK;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if (i > 0)
+        {
+            printf("\n");
+        }
+
+        if (results[i].status != SAIL_OK)
+        {
+            fprintf(stderr, "Error: Failed to probe '%s'.\n", paths[i]);
+
+            if (status == SAIL_OK)
+            {
+                status = results[i].status;
+            }
+
+            continue;
+        }
+
+        print_probed_codec_info(paths[i], results[i].codec_info);
+        print_aligned_image_info(results[i].image);
+    }
+
+    printf("\nProbed %lu file(s) in %lu ms.\n", (unsigned long)count, (unsigned long)elapsed_time);
+
+    sail_destroy_probe_results(results, count);
+
+    return status;
+}
+
 static sail_status_t probe(int argc, char* argv[])
 {
-    if (argc != 3)
+    if (argc < 3)
     {
         print_invalid_argument();
         SAIL_LOG_AND_RETURN(SAIL_ERROR_INVALID_ARGUMENT);
     }
 
-    SAIL_TRY(probe_impl(argv[2]));
+    if (argc == 3)
+    {
+        SAIL_TRY(probe_impl(argv[2]));
+    }
+    else
+    {
+        SAIL_TRY(probe_many_impl((const char* const*)(argv + 2), (size_t)(argc - 2)));
+    }
 
     return SAIL_OK;
 }
@@ -2272,7 +2329,8 @@ static void help(const char* app)
     fprintf(stderr, "        Extract frame #2 and convert to PNG with UP filter:\n");
     fprintf(stderr, "          %s convert animation.gif frame2.png -n 2 --save-tuning png-filter=up\n\n", app);
 
-    fprintf(stderr, "  probe <path>   Display detailed information about image file\n");
+    fprintf(stderr, "  probe <path>   Display detailed information about image file. Pass multiple paths\n");
+    fprintf(stderr, "                 to probe them concurrently\n");
     fprintf(stderr, "  decode <path>  Decode file and show information for all frames\n");
     fprintf(stderr, "  resize         Resize image to specified dimensions\n");
     fprintf(stderr, "      Usage:\n");